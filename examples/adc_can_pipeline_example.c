@@ -0,0 +1,366 @@
+/**
+ * @file    adc_can_pipeline_example.c
+ * @brief   ADC-to-CAN Telemetry Pipeline with Latency Budget for S32K144
+ * @details
+ * Reference pipeline sensor → bus, mỗi stage có timestamp (DWT CYCCNT) và
+ * kết quả count / min / avg / max in qua LPUART1 bằng prof_srv:
+ *
+ *   LPIT0 ch0 ──TRGMUX──▶ PDB0 ──pretrigger──▶ ADC0 SC1[0] ──DMA──▶ block
+ *   (10 kHz)                                         (ping-pong, 16 samples)
+ *        │                                                   │ DMA ISR
+ *        ▼                                                   ▼
+ *   t_trigger (tính lại từ LPIT CVAL)            t_dma ──▶ main loop:
+ *                                                   filter (Q15 biquad) ──▶ CAN_SRV_Send()
+ *                                                 t_task        t_filter          t_queued
+ *
+ * Stage (core cycles @ 80 MHz):
+ * - lat_trigger_to_dma: trigger của sample cuối block → DMA ISR (conversion
+ *   + DMA + IRQ latency); thời điểm trigger suy ra từ LPIT counter, không
+ *   cần LPIT interrupt
+ * - lat_dma_to_task:    DMA ISR → main loop nhận block (dispatch)
+ * - lat_filter:         RawToQ15 + biquad + decimate cả block
+ * - lat_can_enqueue:    CAN_SRV_Send() (nạp MB hoặc TX queue)
+ * - lat_end_to_end:     trigger của sample cuối → frame đã vào TX MB / queue
+ *
+ * Frame 0x180: [0..1] giá trị đã lọc (Q15), [2] sequence, [3] block bị mất,
+ * [4..7] end-to-end của frame trước (us): bus analyzer cộng thêm thời gian
+ * arbitration + truyền (~230 us cho 8 byte @ 500 kbps) là latency tới bus.
+ *
+ * Budget: thời gian điền block (BLOCK_SAMPLES / fs = 1.6 ms) không tính vào
+ * end-to-end (đo từ sample mới nhất); sample cũ nhất thêm (N - 1) / fs.
+ * Latency đo tới lúc frame vào TX MB / queue: can_srv không có TX-complete
+ * hook, phần còn lại là chờ bus + truyền.
+ *
+ * Hardware Setup:
+ * - ADC0 channel 12 (PTC14, potentiometer trên EVB)
+ * - CAN0: PTE4 (RX), PTE5 (TX), transceiver + bus 500 kbps có node ACK
+ * - LPUART1 TX: PTC7 (115200 bps, OpenSDA virtual COM)
+ * - DMA channel 0 (ADC stream)
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+#include "prof_srv.h"
+#include "dsp_srv.h"
+#include "can_srv.h"
+#include "adc.h"
+#include "pdb.h"
+#include "dma.h"
+#include "lpit.h"
+#include "trgmux.h"
+#include "port.h"
+#include "uart.h"
+#include "nvic.h"
+#include "pcc_reg.h"
+#include "clocks_and_modes.h"
+#include <string.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define CORE_CLOCK_HZ               (80000000U)
+
+/* Sampling */
+#define SAMPLE_RATE_HZ              (10000U)
+#define BLOCK_SAMPLES               (16U)
+#define DECIMATE_LOG2               (4U)            /* 16 → 1 giá trị mỗi block */
+#define LPIT_CHANNEL                (0U)
+#define DMA_CHANNEL_ADC             (0U)
+#define ADC_INSTANCE                ADC_INSTANCE_0
+#define ADC_INPUT_CHANNEL           ADC_CHANNEL_AD12
+
+/* CAN */
+#define CAN_TELEMETRY_ID            (0x180U)
+
+/* UART */
+#define UART_INSTANCE               LPUART1
+#define UART_TX_PIN                 (7U)
+#define UART_RX_PIN                 (6U)
+
+/* Report mỗi 1000 block (~1.6 s) */
+#define REPORT_BLOCKS               (1000U)
+
+/*******************************************************************************
+ * Profiling Probes
+ ******************************************************************************/
+
+PROF_SRV_DEFINE(lat_trigger_to_dma);
+PROF_SRV_DEFINE(lat_dma_to_task);
+PROF_SRV_DEFINE(lat_filter);
+PROF_SRV_DEFINE(lat_can_enqueue);
+PROF_SRV_DEFINE(lat_end_to_end);
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+
+static uint16_t g_samples[2U * BLOCK_SAMPLES];
+static dsp_srv_q15_t g_work[BLOCK_SAMPLES] __attribute__((aligned(4)));
+static dsp_srv_biquad_t g_biquad;
+
+/* DMA ISR → main loop */
+static const uint16_t * volatile g_readyBlock = NULL;
+static volatile uint32_t g_tTrigger = 0U;
+static volatile uint32_t g_tDma = 0U;
+static volatile uint32_t g_blocksLost = 0U;
+
+static uint32_t g_lpitPeriod = 0U;
+static uint32_t g_cyclesPerTickQ16 = 0U;
+
+/* LPIT0 ch0 → PDB0 → ADC0: PDB pretrigger 0 start SC1[0] */
+static const trgmux_route_t g_routes[] = {
+    TRGMUX_ROUTE(TRGMUX_SRC_LPIT_CH0, TRGMUX_TARGET_PDB0, 0U)
+};
+
+/*******************************************************************************
+ * Interrupt Handlers
+ ******************************************************************************/
+
+/**
+ * @brief Block đầy (DMA ISR): timestamp stage 1, trigger tính ngược từ LPIT
+ */
+static void OnAdcBlock(ADC_Instance_t instance, const uint16_t *block, uint16_t count, void *userData)
+{
+    uint32_t now = PROF_SRV_CYCCNT;
+    uint32_t cval = 0U;
+    uint32_t ticks;
+
+    (void)instance;
+    (void)count;
+    (void)userData;
+
+    /* Counter đếm xuống từ period: số tick từ timeout gần nhất (trigger của
+       sample cuối), đúng khi ISR trễ ít hơn một chu kỳ sample */
+    (void)LPIT_GetCurrentValue(LPIT_CHANNEL, &cval);
+    ticks = g_lpitPeriod - cval;
+
+    if (g_readyBlock != NULL) {
+        g_blocksLost++;                             /* Main loop chưa lấy block trước */
+    }
+
+    g_tTrigger = now - (uint32_t)(((uint64_t)ticks * g_cyclesPerTickQ16) >> 16);
+    g_tDma = now;
+    g_readyBlock = block;
+}
+
+void DMA0_IRQHandler(void)
+{
+    DMA_IRQHandler(DMA_CHANNEL_ADC);
+}
+
+void CAN0_ORed_0_15_MB_IRQHandler(void)
+{
+    CAN_SRV_IRQHandler(CAN_SRV_CAN0);
+}
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static void InitClocks(void)
+{
+    PCC->PCCn[PCC_PORTC_INDEX] = PCC_PCCn_CGC_MASK;
+    PCC->PCCn[PCC_PORTE_INDEX] = PCC_PCCn_CGC_MASK;
+    PCC->PCCn[PCC_FlexCAN0_INDEX] = PCC_PCCn_CGC_MASK;
+}
+
+static void InitUART(void)
+{
+    UART_Config_t uartConfig;
+
+    UART_EnableClock(1);
+    PORT_SetPinMux(PORT_C, UART_TX_PIN, PORT_MUX_ALT2);
+    PORT_SetPinMux(PORT_C, UART_RX_PIN, PORT_MUX_ALT2);
+
+    UART_GetDefaultConfig(&uartConfig);
+    uartConfig.baudRate = 115200U;
+    (void)UART_Init(UART_INSTANCE, &uartConfig, UART_GetClockFrequency(1));
+}
+
+static bool InitCAN(void)
+{
+    can_srv_config_t config = {
+        .baudrate = 500000U,
+        .filter_id = 0x7FFU,
+        .filter_mask = 0x7FFU,
+        .filter_extended = false
+    };
+
+    PORT_SetPinMux(PORT_E, 4U, PORT_MUX_ALT5);
+    PORT_SetPinMux(PORT_E, 5U, PORT_MUX_ALT5);
+
+    if (CAN_SRV_Init(CAN_SRV_CAN0, &config) != CAN_SRV_SUCCESS) {
+        return false;
+    }
+
+    NVIC_EnableIRQ(CAN0_ORed_0_15_MB_IRQn);
+    return true;
+}
+
+static bool InitAdcPath(void)
+{
+    ADC_Config_t adcConfig = {
+        .clockSource = ADC_CLK_ALT1,
+        .resolution = ADC_RESOLUTION_12BIT,
+        .clockDivider = ADC_CLK_DIV_1,
+        .voltageRef = ADC_VREF_VREFH_VREFL,
+        .triggerSource = ADC_TRIGGER_HARDWARE,
+        .continuousMode = false,
+        .dmaEnable = true,
+        .interruptEnable = false                    /* COCO để DMA đọc */
+    };
+    pdb_config_t pdbConfig = {
+        .prescaler = PDB_PRESCALER_1,
+        .mult_factor = PDB_MULT_1,
+        .trigger_source = PDB_TRIGGER_TRGMUX,
+        .mod_value = 0xFFFFU,
+        .continuous_mode = false,                   /* Mỗi LPIT timeout một lần */
+        .enable_interrupt = false
+    };
+    lpit_channel_config_t lpitConfig = {
+        .channel = LPIT_CHANNEL,
+        .mode = LPIT_MODE_32BIT_PERIODIC,
+        .period = 0U,
+        .enableInterrupt = false,
+        .chainChannel = false,
+        .startOnTrigger = false,
+        .stopOnInterrupt = false,
+        .reloadOnTrigger = false
+    };
+    uint32_t lpitFreq;
+
+    PORT_SetPinMux(PORT_C, 14U, PORT_MUX_DISABLED);
+    ADC_EnableClock(ADC_INSTANCE);
+
+    if ((ADC_Init(ADC_INSTANCE, &adcConfig) != ADC_STATUS_SUCCESS) ||
+        (ADC_Calibrate(ADC_INSTANCE) != ADC_STATUS_SUCCESS) ||
+        (ADC_ConfigHardwareTrigger(ADC_INSTANCE, ADC_INPUT_CHANNEL, false) != ADC_STATUS_SUCCESS)) {
+        return false;
+    }
+
+    PDB_Init(PDB_INSTANCE_0, &pdbConfig);
+    PDB_ConfigADCTrigger(PDB_INSTANCE_0, 0U, 0U, 0U);
+    PDB_LoadConfig(PDB_INSTANCE_0);
+    PDB_Enable(PDB_INSTANCE_0);
+
+    (void)DMA_Init();
+    if (ADC_StartDmaStream(ADC_INSTANCE, DMA_CHANNEL_ADC, g_samples, BLOCK_SAMPLES,
+                           OnAdcBlock, NULL) != ADC_STATUS_SUCCESS) {
+        return false;
+    }
+    NVIC_EnableIRQ(DMA0_IRQn);
+
+    if (LPIT_Init(LPIT_CLK_SRC_FIRC) != STATUS_SUCCESS) {
+        return false;
+    }
+    lpitFreq = LPIT_GetClockFreq();
+    lpitConfig.period = LPIT_CalculatePeriod(lpitFreq, SAMPLE_RATE_HZ);
+    g_lpitPeriod = lpitConfig.period;
+    g_cyclesPerTickQ16 = (uint32_t)(((uint64_t)CORE_CLOCK_HZ << 16) / lpitFreq);
+
+    /* Route trước, start timer sau cùng */
+    if ((LPIT_ConfigChannel(&lpitConfig) != STATUS_SUCCESS) ||
+        (TRGMUX_ApplyRoutes(g_routes, sizeof(g_routes) / sizeof(g_routes[0]), false) != STATUS_SUCCESS)) {
+        return false;
+    }
+
+    return LPIT_StartChannel(LPIT_CHANNEL) == STATUS_SUCCESS;
+}
+
+/**
+ * @brief Filter + CAN stage cho một block, ghi timestamp từng stage
+ */
+static void ProcessBlock(const uint16_t *block, uint32_t tTrigger, uint32_t tDma)
+{
+    static uint8_t sequence = 0U;
+    static uint32_t lastEndToEndUs = 0U;
+    can_srv_message_t msg;
+    uint32_t tTask = PROF_SRV_CYCCNT;
+    uint32_t tFilter;
+    uint32_t tQueued;
+
+    PROF_SRV_Record(&lat_trigger_to_dma, tDma - tTrigger);
+    PROF_SRV_Record(&lat_dma_to_task, tTask - tDma);
+
+    /* Filter stage: Q15, low-pass biquad, decimate 16:1 */
+    (void)DSP_SRV_RawToQ15(block, g_work, BLOCK_SAMPLES, 12U, 0U);
+    DSP_SRV_BiquadQ15(&g_biquad, g_work, g_work, BLOCK_SAMPLES);
+    (void)DSP_SRV_DecimateQ15(g_work, g_work, BLOCK_SAMPLES, DECIMATE_LOG2);
+    tFilter = PROF_SRV_CYCCNT;
+    PROF_SRV_Record(&lat_filter, tFilter - tTask);
+
+    memset(&msg, 0, sizeof(msg));
+    msg.id = CAN_TELEMETRY_ID;
+    msg.length = 8U;
+    msg.isExtended = false;
+    msg.data[0] = (uint8_t)((uint16_t)g_work[0] >> 8);
+    msg.data[1] = (uint8_t)g_work[0];
+    msg.data[2] = sequence++;
+    msg.data[3] = (uint8_t)g_blocksLost;
+    msg.data[4] = (uint8_t)(lastEndToEndUs >> 24);
+    msg.data[5] = (uint8_t)(lastEndToEndUs >> 16);
+    msg.data[6] = (uint8_t)(lastEndToEndUs >> 8);
+    msg.data[7] = (uint8_t)lastEndToEndUs;
+
+    (void)CAN_SRV_Send(CAN_SRV_CAN0, &msg);
+    tQueued = PROF_SRV_CYCCNT;
+    PROF_SRV_Record(&lat_can_enqueue, tQueued - tFilter);
+    PROF_SRV_Record(&lat_end_to_end, tQueued - tTrigger);
+
+    lastEndToEndUs = (tQueued - tTrigger) / (CORE_CLOCK_HZ / 1000000U);
+}
+
+/*******************************************************************************
+ * Main
+ ******************************************************************************/
+
+int main(void)
+{
+    static const uint8_t header[] = "\r\n=== ADC -> CAN pipeline latency (core cycles @ 80 MHz) ===\r\n";
+    const uint16_t *block;
+    uint32_t tTrigger;
+    uint32_t tDma;
+    uint32_t blocks = 0U;
+    uint32_t basepri;
+
+    SOSC_init_8MHz();
+    SPLL_init_160MHz();
+    NormalRUNmode_80MHz();
+
+    InitClocks();
+    InitUART();
+
+    /* Butterworth low-pass fc = fs / 10 */
+    DSP_SRV_BiquadInit(&g_biquad, 1105, 2210, 1105, -18727, 6763);
+
+    if ((PROF_SRV_Init() != PROF_SRV_SUCCESS) || !InitCAN() || !InitAdcPath()) {
+        while (1) {
+        }
+    }
+
+    while (1) {
+        if (g_readyBlock == NULL) {
+            continue;
+        }
+
+        /* Lấy block + timestamp cùng lúc với DMA ISR */
+        basepri = NVIC_EnterCritical();
+        block = g_readyBlock;
+        tTrigger = g_tTrigger;
+        tDma = g_tDma;
+        g_readyBlock = NULL;
+        NVIC_ExitCritical(basepri);
+
+        ProcessBlock(block, tTrigger, tDma);
+
+        if (++blocks >= REPORT_BLOCKS) {
+            blocks = 0U;
+            (void)UART_SendBlocking(UART_INSTANCE, header, sizeof(header) - 1U);
+            (void)PROF_SRV_Dump(UART_INSTANCE);
+            PROF_SRV_ResetAll();
+        }
+    }
+}
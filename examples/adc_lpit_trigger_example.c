@@ -12,6 +12,7 @@
  * 
  * Features:
  * - LPIT trigger ADC tự động (periodic sampling)
+ * - Trigger routing khai báo bằng TRGMUX route table
  * - ADC interrupt khi conversion complete
  * - Real-time voltage monitoring
  * - Threshold detection
@@ -23,6 +24,7 @@
 
 #include "adc.h"
 #include "lpit.h"
+#include "trgmux.h"
 #include "port.h"
 #include "gpio.h"
 #include "nvic.h"
@@ -66,6 +68,11 @@ static volatile uint16_t g_latestAdcValue = 0;
 static volatile uint32_t g_latestVoltage = 0;
 static volatile bool g_newSampleAvailable = false;
 
+/* LPIT CH0 timeout -> ADC0 SC1[0] (TRGMUX, không cần PDB) */
+static const trgmux_route_t g_triggerRoutes[] = {
+    TRGMUX_ROUTE(TRGMUX_SRC_LPIT_CH0, TRGMUX_TARGET_ADC0, 0U)
+};
+
 /*******************************************************************************
  * Private Function Prototypes
  ******************************************************************************/
@@ -227,6 +234,14 @@ static void InitLPIT(void)
         return;
     }
     
+    /* Route LPIT trigger to ADC0 before the timer starts */
+    status = TRGMUX_ApplyRoutes(g_triggerRoutes,
+                                sizeof(g_triggerRoutes) / sizeof(g_triggerRoutes[0]), false);
+    if (status != STATUS_SUCCESS) {
+        printf("TRGMUX routing failed!\n");
+        return;
+    }
+    
     status = LPIT_StartChannel(LPIT_CHANNEL);
     if (status != STATUS_SUCCESS) {
         printf("LPIT Start failed!\n");
@@ -0,0 +1,87 @@
+/**
+ * @file    benchmark_adc_dma.c
+ * @brief   ADC / DMA part of the HAL Hot Path Benchmark (benchmark_example.c)
+ * @details
+ * Tách riêng vì adc.h / dma.h dùng status_t của status.h, can.h khai báo
+ * status_t riêng; hai nhóm header không include chung được.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+#include "prof_srv.h"
+#include "adc.h"
+#include "dma.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define DMA_CHANNEL_COPY            (0U)
+#define DMA_COPY_SIZE               (256U)
+
+/*******************************************************************************
+ * Profiling Probes
+ ******************************************************************************/
+
+PROF_SRV_DEFINE(adc_read_blocking);
+PROF_SRV_DEFINE(dma_memcopy_256);
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+
+static uint8_t g_dmaSrc[DMA_COPY_SIZE];
+static uint8_t g_dmaDst[DMA_COPY_SIZE];
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+void Bench_AdcDmaInit(void)
+{
+    ADC_Config_t adcConfig = {
+        .clockSource = ADC_CLK_ALT1,
+        .resolution = ADC_RESOLUTION_12BIT,
+        .clockDivider = ADC_CLK_DIV_4,
+        .voltageRef = ADC_VREF_VREFH_VREFL,
+        .triggerSource = ADC_TRIGGER_SOFTWARE,
+        .continuousMode = false,
+        .dmaEnable = false,
+        .interruptEnable = false
+    };
+    uint32_t i;
+
+    ADC_EnableClock(ADC_INSTANCE_0);
+    (void)ADC_Init(ADC_INSTANCE_0, &adcConfig);
+    (void)ADC_Calibrate(ADC_INSTANCE_0);
+
+    (void)DMA_Init();
+    for (i = 0U; i < DMA_COPY_SIZE; i++) {
+        g_dmaSrc[i] = (uint8_t)i;
+    }
+}
+
+void Bench_ADC(uint32_t runs)
+{
+    uint16_t value;
+    uint32_t i;
+
+    for (i = 0U; i < runs; i++) {
+        PROF_BEGIN(adc_read_blocking);
+        (void)ADC_ReadBlocking(ADC_INSTANCE_0, ADC_CHANNEL_AD12, &value);
+        PROF_END(adc_read_blocking);
+    }
+}
+
+void Bench_DMA(uint32_t runs)
+{
+    uint32_t i;
+
+    for (i = 0U; i < runs; i++) {
+        PROF_BEGIN(dma_memcopy_256);
+        (void)DMA_MemCopy(DMA_CHANNEL_COPY, g_dmaSrc, g_dmaDst, DMA_COPY_SIZE);
+        PROF_END(dma_memcopy_256);
+    }
+}
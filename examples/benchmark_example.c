@@ -0,0 +1,229 @@
+/**
+ * @file    benchmark_example.c
+ * @brief   HAL Hot Path Benchmark for S32K144
+ * @details
+ * Đo cycle cost của các HAL function hay dùng bằng prof_srv (DWT CYCCNT)
+ * và in bảng count / min / avg / max qua LPUART1. Chạy lại sau mỗi release
+ * để so sánh, số liệu chỉ có ý nghĩa với cùng clock config và compiler flags.
+ *
+ * Hardware Setup:
+ * - LPUART1 TX: PTC7, RX: PTC6 (115200 bps, OpenSDA virtual COM)
+ * - CAN0: loopback mode, không cần transceiver
+ * - ADC0 channel 12 (PTC14, potentiometer trên EVB)
+ * - DMA channel 0 (memory-to-memory)
+ * - Green LED: PTD16
+ *
+ * Measured:
+ * - CAN_Send (queue một frame), CAN_Receive (MB đã có frame)
+ * - UART_SendBlocking (16 bytes, gồm thời gian truyền trên dây)
+ * - DMA_MemCopy (256 bytes)
+ * - ADC_ReadBlocking
+ * - GPIO_TogglePin
+ *
+ * ADC / DMA benchmark nằm trong benchmark_adc_dma.c: adc.h, dma.h (status.h)
+ * và can.h khai báo status_t khác nhau nên không include chung một
+ * translation unit.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+#include "prof_srv.h"
+#include "can.h"
+#include "uart.h"
+#include "gpio.h"
+#include "port.h"
+#include "pcc_reg.h"
+#include "clocks_and_modes.h"
+#include <string.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define BENCH_RUNS                  (100U)
+
+/* UART Configuration */
+#define UART_INSTANCE               LPUART1
+#define UART_PORT                   PORT_C
+#define UART_TX_PIN                 (7U)
+#define UART_RX_PIN                 (6U)
+#define UART_BAUDRATE               (115200U)
+
+/* CAN Configuration */
+#define CAN_INSTANCE                (0U)
+#define CAN_TX_MB                   (8U)
+#define CAN_RX_MB                   (16U)
+#define CAN_BENCH_ID                (0x123U)
+
+/* Frame 8 bytes @ 500 kbps ~ 250 us, chờ loopback trước khi đo CAN_Receive */
+#define CAN_FRAME_WAIT_LOOPS        (40000U)
+
+/* LED Configuration */
+#define LED_GREEN_PORT              GPIO_PORT_D
+#define LED_GREEN_PIN               (16U)
+
+/*******************************************************************************
+ * Profiling Probes
+ ******************************************************************************/
+
+PROF_SRV_DEFINE(can_send);
+PROF_SRV_DEFINE(can_receive);
+PROF_SRV_DEFINE(uart_send_blocking_16);
+PROF_SRV_DEFINE(gpio_toggle_pin);
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+
+static const uint8_t g_uartPattern[16] = "0123456789ABCDE\n";
+
+/*******************************************************************************
+ * External Functions
+ ******************************************************************************/
+
+/* benchmark_adc_dma.c */
+extern void Bench_AdcDmaInit(void);
+extern void Bench_ADC(uint32_t runs);
+extern void Bench_DMA(uint32_t runs);
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static void InitClocks(void)
+{
+    PCC->PCCn[PCC_PORTC_INDEX] = PCC_PCCn_CGC_MASK;
+    PCC->PCCn[PCC_PORTD_INDEX] = PCC_PCCn_CGC_MASK;
+}
+
+static void InitUART(void)
+{
+    UART_Config_t uartConfig;
+
+    UART_EnableClock(1);
+    PORT_SetPinMux(UART_PORT, UART_TX_PIN, PORT_MUX_ALT2);
+    PORT_SetPinMux(UART_PORT, UART_RX_PIN, PORT_MUX_ALT2);
+
+    UART_GetDefaultConfig(&uartConfig);
+    uartConfig.baudRate = UART_BAUDRATE;
+    (void)UART_Init(UART_INSTANCE, &uartConfig, UART_GetClockFrequency(1));
+}
+
+static void InitCAN(void)
+{
+    can_config_t config = {
+        .instance = CAN_INSTANCE,
+        .clockSource = CAN_CLK_SRC_BUSCLOCK,
+        .baudRate = 500000,
+        .mode = CAN_MODE_LOOPBACK,
+        .enableSelfReception = true,
+        .useRxFifo = false
+    };
+    can_rx_filter_t filter = {
+        .id = CAN_BENCH_ID,
+        .mask = 0x7FF,
+        .idType = CAN_ID_STD
+    };
+
+    (void)CAN_Init(&config);
+    (void)CAN_ConfigRxFilter(CAN_INSTANCE, CAN_RX_MB, &filter);
+}
+
+static void InitLED(void)
+{
+    PORT_SetPinMux(PORT_D, LED_GREEN_PIN, PORT_MUX_GPIO);
+    GPIO_SetPinDirection(LED_GREEN_PORT, LED_GREEN_PIN, GPIO_DIR_OUTPUT);
+}
+
+static void BenchCAN(void)
+{
+    can_message_t txMsg;
+    can_message_t rxMsg;
+    volatile uint32_t wait;
+    uint32_t i;
+
+    memset(&txMsg, 0, sizeof(txMsg));
+    txMsg.id = CAN_BENCH_ID;
+    txMsg.idType = CAN_ID_STD;
+    txMsg.frameType = CAN_FRAME_DATA;
+    txMsg.dataLength = 8;
+
+    for (i = 0U; i < BENCH_RUNS; i++) {
+        txMsg.data[0] = (uint8_t)i;
+
+        PROF_BEGIN(can_send);
+        (void)CAN_Send(CAN_INSTANCE, CAN_TX_MB, &txMsg);
+        PROF_END(can_send);
+
+        for (wait = 0U; wait < CAN_FRAME_WAIT_LOOPS; wait++) {
+        }
+
+        PROF_BEGIN(can_receive);
+        (void)CAN_Receive(CAN_INSTANCE, CAN_RX_MB, &rxMsg);
+        PROF_END(can_receive);
+    }
+}
+
+static void BenchUART(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < BENCH_RUNS; i++) {
+        PROF_BEGIN(uart_send_blocking_16);
+        (void)UART_SendBlocking(UART_INSTANCE, g_uartPattern, sizeof(g_uartPattern));
+        PROF_END(uart_send_blocking_16);
+    }
+}
+
+static void BenchGPIO(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < BENCH_RUNS; i++) {
+        PROF_BEGIN(gpio_toggle_pin);
+        GPIO_TogglePin(LED_GREEN_PORT, LED_GREEN_PIN);
+        PROF_END(gpio_toggle_pin);
+    }
+}
+
+/*******************************************************************************
+ * Main
+ ******************************************************************************/
+
+int main(void)
+{
+    static const uint8_t header[] = "\r\n=== HAL benchmark (core cycles) ===\r\n";
+
+    SOSC_init_8MHz();
+    SPLL_init_160MHz();
+    NormalRUNmode_80MHz();
+
+    InitClocks();
+    InitUART();
+    InitCAN();
+    Bench_AdcDmaInit();
+    InitLED();
+
+    if (PROF_SRV_Init() != PROF_SRV_SUCCESS) {
+        while (1) {
+        }
+    }
+
+    while (1) {
+        PROF_SRV_ResetAll();
+
+        BenchCAN();
+        Bench_DMA(BENCH_RUNS);
+        Bench_ADC(BENCH_RUNS);
+        BenchGPIO();
+        BenchUART();
+
+        (void)UART_SendBlocking(UART_INSTANCE, header, sizeof(header) - 1U);
+        (void)PROF_SRV_Dump(UART_INSTANCE);
+
+        for (volatile uint32_t delay = 0U; delay < 8000000U; delay++) {
+        }
+    }
+}
@@ -0,0 +1,629 @@
+/**
+ * @file    can_bootloader.c
+ * @brief   CAN Bootloader - ISO-TP Download with Pipelined P-Flash Programming
+ * @details
+ * Bootloader nạp application qua CAN 500 kbps, dùng subset UDS (ISO 14229)
+ * trên ISO-TP (isotp_srv): RequestDownload / TransferData / RequestTransferExit
+ * và RoutineControl checkMemory (CRC-32 bằng hardware CRC engine).
+ * Flash được program bằng FTFC async nên block N được ghi trong khi block
+ * N + 1 đang nhận trên bus, tổng thời gian gần bằng thời gian truyền trên dây.
+ *
+ * Memory map:
+ * - 0x00000000 - 0x0000FFFF: bootloader (64 KB, gồm vector table và flash config 0x400)
+ * - 0x00010000 - 0x0007FFFF: application (448 KB), vector table ở đầu region
+ *
+ * Protocol (request id 0x7E0, response id 0x7E8, 11-bit):
+ * - 10 02                      DiagnosticSessionControl programming -> 50 02 ...
+ * - 3E 00                      TesterPresent -> 7E 00
+ * - 34 00 44 aaaaaaaa ssssssss RequestDownload -> 74 20 08 02 (block 2048 + 2)
+ * - 36 sc data[<= 2048]        TransferData -> 76 sc (gửi ngay khi block vào queue)
+ * - 37                         RequestTransferExit -> 77 sau khi mọi block đã ghi
+ * - 31 01 02 02 cccccccc       RoutineControl checkMemory: CRC-32 (zlib) của
+ *                              vùng vừa download -> 7F 31 78, rồi 71 01 02 02 00
+ *                              (khớp) / 01 (sai)
+ * - 11 01                      ECUReset -> 51 01, reset
+ * - Lỗi: 7F sid nrc
+ *
+ * Pipeline:
+ * - 2 block buffer 2 KB: CF được copy thẳng vào buffer (streaming RX)
+ * - TransferData hoàn tất -> queue block, trả 76 ngay, tester gửi block tiếp
+ * - Main loop: sector 4 KB được erase lazy khi block đầu tiên chạm tới,
+ *   rồi FTFC_ProgramAsync() (phrase tiếp theo launch từ CCIF ISR)
+ * - Không còn buffer trống khi FF tới (vd. erase chậm): ISOTP_SRV_RxPause(),
+ *   tester nhận FC WAIT cho tới khi một block ghi xong
+ *
+ * Throughput (500 kbps, frame 8 bytes 11-bit ~125 bit có stuffing):
+ * - ~4000 CF/s x 7 bytes ~ 27 KB/s, FC BS = 0 / STmin = 0: chỉ 1 FC mỗi 2 KB
+ * - 448 KB ~ 230 TransferData x ~75 ms ~ 17 s trên dây
+ * - Program 2 KB ~ 256 phrase x ~40 µs ~ 10 ms, erase 4 KB ~ 12 ms (typ):
+ *   nằm gọn trong 75 ms nhận block tiếp theo, không cộng vào tổng thời gian
+ *
+ * Hardware Setup:
+ * - CAN0: PTE4 (RX), PTE5 (TX), transceiver 500 kbps
+ * - Tester: UDS flash tool (vd. python-can-isotp + udsoncan)
+ *
+ * Build:
+ * - FTFC_ASYNC_PFLASH_ENABLE=1, HAL_RAMFUNC_ENABLE=1
+ * - Linker script của bootloader phải đặt toàn bộ .text / .rodata vào SRAM
+ *   (copy lúc startup) và phần flash chỉ chứa vector table, flash config và
+ *   load image. S32K144 P-flash là một read partition: mọi fetch từ P-flash
+ *   trong lúc program / erase gây RDCOLERR, kể cả ISR và main loop.
+ *   tools/ramfunc_report.py kiểm tra map file.
+ *
+ * Files:
+ * - can_bootloader.c: CAN / ISO-TP / UDS (file này)
+ * - can_bootloader_flash.c: block buffer, lazy erase, FTFC async program
+ *
+ * Features:
+ * - ISO-TP streaming RX, FC BS / STmin tuning (BOOT_ISOTP_BS / BOOT_ISOTP_STMIN)
+ * - FTFC async erase / program song song với CAN reception
+ * - Download chỉ được phép trong application region (bootloader và
+ *   flash config field không bao giờ bị erase)
+ * - Vector table application program sau cùng: download dở dang không
+ *   bao giờ được boot
+ * - Tự nhảy vào application khi không có tester trong BOOT_WAIT_MS
+ * - CheckMemory CRC-32 do DMA feed CRC engine (448 KB trong vài ms, main loop
+ *   không bị chặn)
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.1
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "can_bootloader.h"
+#include "can.h"
+#include "nvic.h"
+#include "port.h"
+#include "pcc_reg.h"
+#include "lfqueue.h"
+#include "isotp_srv.h"
+#include "time_srv.h"
+#include <string.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define BOOT_CAN_INSTANCE       (0U)
+#define BOOT_TX_MB              (8U)
+#define BOOT_RX_MB              (16U)
+#define BOOT_REQUEST_ID         (0x7E0U)
+#define BOOT_RESPONSE_ID        (0x7E8U)
+
+/* FC gửi cho tester: BS = 0 (một FC mỗi message), STmin = 0 (back-to-back).
+ * Gateway / tester chậm: vd. BS = 32, STmin = 0xF5 (500 µs) */
+#define BOOT_ISOTP_BS           (0U)
+#define BOOT_ISOTP_STMIN        (0U)
+
+#define BOOT_WAIT_MS            (500U)
+#define BOOT_RX_QUEUE_SIZE      (64U)
+
+/* Bytes đầu của mỗi request (SID + parameters), dài hơn là TransferData */
+#define BOOT_REQ_HEAD_SIZE      (16U)
+
+/* UDS */
+#define UDS_SID_SESSION         (0x10U)
+#define UDS_SID_RESET           (0x11U)
+#define UDS_SID_DOWNLOAD        (0x34U)
+#define UDS_SID_TRANSFER        (0x36U)
+#define UDS_SID_EXIT            (0x37U)
+#define UDS_SID_ROUTINE         (0x31U)
+#define UDS_SID_TESTER_PRESENT  (0x3EU)
+#define UDS_SID_NEGATIVE        (0x7FU)
+#define UDS_POSITIVE(sid)       ((uint8_t)((sid) + 0x40U))
+
+#define UDS_NRC_NOT_SUPPORTED   (0x11U)
+#define UDS_NRC_LENGTH          (0x13U)
+#define UDS_NRC_CONDITIONS      (0x22U)
+#define UDS_NRC_SEQUENCE        (0x24U)
+#define UDS_NRC_OUT_OF_RANGE    (0x31U)
+#define UDS_NRC_SUSPENDED       (0x71U)
+#define UDS_NRC_PROG_FAILURE    (0x72U)
+#define UDS_NRC_BLOCK_COUNTER   (0x73U)
+#define UDS_NRC_PENDING         (0x78U)
+
+#define UDS_ROUTINE_START       (0x01U)
+#define UDS_ROUTINE_CHECK_MEM   (0x0202U)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static isotp_srv_link_t s_link;
+
+/* CAN RX ISR -> main loop */
+static can_message_t s_rx_storage[BOOT_RX_QUEUE_SIZE];
+static lfq_spsc_t s_rx_queue;
+
+/* Request đang nhận */
+static uint8_t s_req[BOOT_REQ_HEAD_SIZE];
+static uint32_t s_req_length;
+static uint32_t s_req_received;
+static int32_t s_fill = -1;                 /* Block nhận payload TransferData */
+static bool s_fill_waiting = false;         /* FF đã tới nhưng chưa có block trống */
+
+static uint8_t s_resp[8];
+
+/* Download state */
+static bool s_programming_session = false;
+static bool s_download_active = false;
+static uint32_t s_download_start;
+static uint32_t s_download_address;
+static uint32_t s_download_end;
+static bool s_image_written = false;        /* Exit thành công, checkMemory được phép */
+static uint32_t s_check_expected;
+static bool s_check_pending = false;
+static uint8_t s_block_counter;
+static bool s_exit_pending = false;
+static bool s_reset_pending = false;
+
+/*******************************************************************************
+ * Private Functions - Response
+ ******************************************************************************/
+
+static void Boot_Respond(const uint8_t *data, uint8_t length)
+{
+    memcpy(s_resp, data, length);
+    /* Response luôn là SF: chỉ chờ MB trống (frame trước, vài trăm µs) */
+    while (ISOTP_SRV_Send(&s_link, s_resp, length) == ISOTP_SRV_BUSY) {
+        ISOTP_SRV_Process(&s_link);
+    }
+}
+
+static void Boot_RespondNegative(uint8_t sid, uint8_t nrc)
+{
+    const uint8_t resp[3] = { UDS_SID_NEGATIVE, sid, nrc };
+
+    Boot_Respond(resp, 3U);
+}
+
+/* Block trống cho TransferData, copy phần payload đã nằm trong s_req */
+static bool Boot_AssignFillBlock(void)
+{
+    s_fill = BootFlash_AcquireBlock();
+    if (s_fill < 0) {
+        return false;
+    }
+    if (s_req_received > 2U) {
+        memcpy(BootFlash_BlockData(s_fill), &s_req[2], s_req_received - 2U);
+    }
+    return true;
+}
+
+/*******************************************************************************
+ * Private Functions - UDS
+ ******************************************************************************/
+
+static uint32_t Boot_ReadU32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24U) | ((uint32_t)p[1] << 16U) | ((uint32_t)p[2] << 8U) | p[3];
+}
+
+static void Boot_HandleDownload(void)
+{
+    uint8_t resp[4] = { UDS_POSITIVE(UDS_SID_DOWNLOAD), 0x20U, 0U, 0U };
+    uint32_t address;
+    uint32_t size;
+
+    if (s_req_length != 11U) {
+        Boot_RespondNegative(UDS_SID_DOWNLOAD, UDS_NRC_LENGTH);
+        return;
+    }
+    /* dataFormatIdentifier 0x00 (không nén), addressAndLengthFormat 0x44 */
+    if (!s_programming_session || s_download_active || (s_req[1] != 0x00U) || (s_req[2] != 0x44U)) {
+        Boot_RespondNegative(UDS_SID_DOWNLOAD, UDS_NRC_SEQUENCE);
+        return;
+    }
+
+    address = Boot_ReadU32(&s_req[3]);
+    size = Boot_ReadU32(&s_req[7]);
+    if ((address < BOOT_APP_BASE) || (address >= BOOT_APP_END) ||
+        ((address % BOOT_PHRASE_SIZE) != 0U) ||
+        (size == 0U) || (size > (BOOT_APP_END - address))) {
+        Boot_RespondNegative(UDS_SID_DOWNLOAD, UDS_NRC_OUT_OF_RANGE);
+        return;
+    }
+
+    BootFlash_Reset();
+    s_download_active = true;
+    s_image_written = false;
+    s_download_start = address;
+    s_download_address = address;
+    s_download_end = address + size;
+    s_block_counter = 1U;
+
+    resp[2] = (uint8_t)((BOOT_BLOCK_SIZE + 2U) >> 8U);
+    resp[3] = (uint8_t)(BOOT_BLOCK_SIZE + 2U);
+    Boot_Respond(resp, 4U);
+}
+
+/* s_fill giữ payload, luôn được queue hoặc release */
+static void Boot_HandleTransfer(void)
+{
+    uint8_t resp[2] = { UDS_POSITIVE(UDS_SID_TRANSFER), 0U };
+    uint32_t length = s_req_length - 2U;
+    uint8_t nrc = 0U;
+
+    if (!s_download_active) {
+        nrc = UDS_NRC_SEQUENCE;
+    } else if (BootFlash_HasError()) {
+        nrc = UDS_NRC_PROG_FAILURE;
+    } else if (s_req[1] != s_block_counter) {
+        nrc = UDS_NRC_BLOCK_COUNTER;
+    } else if (length > (s_download_end - s_download_address)) {
+        nrc = UDS_NRC_OUT_OF_RANGE;
+    } else if (((length % BOOT_PHRASE_SIZE) != 0U) && ((s_download_address + length) != s_download_end)) {
+        /* Chỉ block cuối được lẻ phrase (pad 0xFF) */
+        nrc = UDS_NRC_LENGTH;
+    }
+
+    if (nrc != 0U) {
+        BootFlash_ReleaseBlock(s_fill);
+        s_fill = -1;
+        Boot_RespondNegative(UDS_SID_TRANSFER, nrc);
+        return;
+    }
+
+    BootFlash_QueueBlock(s_fill, s_download_address, length);
+    s_fill = -1;
+    s_download_address += length;
+
+    /* Trả lời trước khi program xong: tester gửi block tiếp song song */
+    resp[1] = s_block_counter;
+    s_block_counter++;
+    Boot_Respond(resp, 2U);
+}
+
+static void Boot_HandleExit(void)
+{
+    if (!s_download_active || (s_req_length != 1U)) {
+        Boot_RespondNegative(UDS_SID_EXIT, UDS_NRC_SEQUENCE);
+        return;
+    }
+
+    /* Response cuối gửi khi pipeline đã ghi hết (Boot_ProcessExit) */
+    s_exit_pending = true;
+    if (!BootFlash_IsIdle()) {
+        Boot_RespondNegative(UDS_SID_EXIT, UDS_NRC_PENDING);
+    }
+}
+
+static void Boot_ProcessExit(void)
+{
+    const uint8_t resp[1] = { UDS_POSITIVE(UDS_SID_EXIT) };
+
+    if (!s_exit_pending || !BootFlash_IsIdle()) {
+        return;
+    }
+
+    s_exit_pending = false;
+    s_download_active = false;
+
+    if ((s_download_address != s_download_end) || !BootFlash_Finish()) {
+        Boot_RespondNegative(UDS_SID_EXIT, UDS_NRC_PROG_FAILURE);
+    } else {
+        s_image_written = true;
+        Boot_Respond(resp, 1U);
+    }
+}
+
+static void Boot_HandleRoutine(void)
+{
+    if ((s_req_length < 4U) || (s_req[1] != UDS_ROUTINE_START) ||
+        ((((uint32_t)s_req[2] << 8U) | s_req[3]) != UDS_ROUTINE_CHECK_MEM)) {
+        Boot_RespondNegative(UDS_SID_ROUTINE, UDS_NRC_NOT_SUPPORTED);
+        return;
+    }
+    if (s_req_length != 8U) {
+        Boot_RespondNegative(UDS_SID_ROUTINE, UDS_NRC_LENGTH);
+        return;
+    }
+    if (!s_image_written || s_check_pending) {
+        Boot_RespondNegative(UDS_SID_ROUTINE, UDS_NRC_SEQUENCE);
+        return;
+    }
+
+    /* Flash đọc bằng DMA, kết quả trả ở Boot_ProcessCheck() */
+    if (!BootFlash_StartCrc(s_download_start, s_download_end - s_download_start)) {
+        Boot_RespondNegative(UDS_SID_ROUTINE, UDS_NRC_CONDITIONS);
+        return;
+    }
+    s_check_expected = Boot_ReadU32(&s_req[4]);
+    s_check_pending = true;
+    Boot_RespondNegative(UDS_SID_ROUTINE, UDS_NRC_PENDING);
+}
+
+static void Boot_ProcessCheck(void)
+{
+    uint8_t resp[5] = { UDS_POSITIVE(UDS_SID_ROUTINE), UDS_ROUTINE_START,
+                        (uint8_t)(UDS_ROUTINE_CHECK_MEM >> 8U), (uint8_t)UDS_ROUTINE_CHECK_MEM, 0U };
+    uint32_t crc;
+
+    if (!s_check_pending || BootFlash_CrcBusy()) {
+        return;
+    }
+
+    s_check_pending = false;
+
+    if (!BootFlash_CrcResult(&crc)) {
+        Boot_RespondNegative(UDS_SID_ROUTINE, UDS_NRC_PROG_FAILURE);
+        return;
+    }
+    resp[4] = (crc == s_check_expected) ? 0x00U : 0x01U;
+    Boot_Respond(resp, 5U);
+}
+
+static void Boot_HandleRequest(void)
+{
+    uint8_t resp[6];
+
+    switch (s_req[0]) {
+        case UDS_SID_SESSION:
+            if ((s_req_length != 2U) || ((s_req[1] & 0x7FU) != 0x02U)) {
+                Boot_RespondNegative(UDS_SID_SESSION, UDS_NRC_NOT_SUPPORTED);
+                break;
+            }
+            s_programming_session = true;
+            /* P2 = 50 ms, P2* = 5000 ms (đơn vị 10 ms) */
+            resp[0] = UDS_POSITIVE(UDS_SID_SESSION);
+            resp[1] = 0x02U;
+            resp[2] = 0x00U;
+            resp[3] = 0x32U;
+            resp[4] = 0x01U;
+            resp[5] = 0xF4U;
+            Boot_Respond(resp, 6U);
+            break;
+
+        case UDS_SID_TESTER_PRESENT:
+            resp[0] = UDS_POSITIVE(UDS_SID_TESTER_PRESENT);
+            resp[1] = 0x00U;
+            Boot_Respond(resp, 2U);
+            break;
+
+        case UDS_SID_DOWNLOAD:
+            Boot_HandleDownload();
+            break;
+
+        case UDS_SID_TRANSFER:
+            /* TransferData ngắn (block cuối) */
+            if ((s_req_length < 3U) || !Boot_AssignFillBlock()) {
+                Boot_RespondNegative(UDS_SID_TRANSFER,
+                                     (s_req_length < 3U) ? UDS_NRC_LENGTH : UDS_NRC_SUSPENDED);
+                break;
+            }
+            Boot_HandleTransfer();
+            break;
+
+        case UDS_SID_EXIT:
+            Boot_HandleExit();
+            break;
+
+        case UDS_SID_ROUTINE:
+            Boot_HandleRoutine();
+            break;
+
+        case UDS_SID_RESET:
+            resp[0] = UDS_POSITIVE(UDS_SID_RESET);
+            resp[1] = 0x01U;
+            Boot_Respond(resp, 2U);
+            s_reset_pending = true;
+            break;
+
+        default:
+            Boot_RespondNegative(s_req[0], UDS_NRC_NOT_SUPPORTED);
+            break;
+    }
+}
+
+/*******************************************************************************
+ * Private Functions - ISO-TP callbacks (main loop context)
+ ******************************************************************************/
+
+static bool Boot_OnRxBegin(uint32_t length, void *user_data)
+{
+    (void)user_data;
+
+    if (length > (BOOT_BLOCK_SIZE + 2U)) {
+        return false;
+    }
+
+    s_req_length = length;
+    s_req_received = 0U;
+    s_fill = -1;
+    s_fill_waiting = false;
+
+    /* Message dài hơn header chỉ có thể là TransferData: cần block buffer,
+     * chưa có thì giữ CTS (FC WAIT) tới khi một block ghi xong */
+    if (length > BOOT_REQ_HEAD_SIZE) {
+        if (Boot_AssignFillBlock()) {
+            ISOTP_SRV_RxResume(&s_link);
+        } else {
+            s_fill_waiting = true;
+            ISOTP_SRV_RxPause(&s_link);
+        }
+    }
+
+    return true;
+}
+
+static void Boot_OnRxData(const uint8_t *data, uint8_t length, uint32_t offset, void *user_data)
+{
+    uint8_t *block;
+    uint32_t i;
+
+    (void)user_data;
+
+    for (i = 0U; (i < length) && ((offset + i) < BOOT_REQ_HEAD_SIZE); i++) {
+        s_req[offset + i] = data[i];
+    }
+
+    /* Payload TransferData (sau SID + counter) đi thẳng vào block buffer */
+    if ((s_req_length > BOOT_REQ_HEAD_SIZE) && (s_fill >= 0)) {
+        block = BootFlash_BlockData(s_fill);
+        for (i = 0U; i < length; i++) {
+            if ((offset + i) >= 2U) {
+                block[offset + i - 2U] = data[i];
+            }
+        }
+    }
+
+    s_req_received = offset + length;
+}
+
+static void Boot_OnRxDone(isotp_srv_status_t status, void *user_data)
+{
+    (void)user_data;
+
+    if (s_req_length <= BOOT_REQ_HEAD_SIZE) {
+        if (status == ISOTP_SRV_SUCCESS) {
+            Boot_HandleRequest();
+        }
+        return;
+    }
+
+    s_fill_waiting = false;
+
+    if ((status == ISOTP_SRV_SUCCESS) && (s_req[0] == UDS_SID_TRANSFER) && (s_fill >= 0)) {
+        Boot_HandleTransfer();
+        return;
+    }
+
+    if (s_fill >= 0) {
+        BootFlash_ReleaseBlock(s_fill);
+        s_fill = -1;
+    }
+    if (status == ISOTP_SRV_SUCCESS) {
+        Boot_RespondNegative(s_req[0], UDS_NRC_LENGTH);
+    }
+}
+
+/*******************************************************************************
+ * Private Functions - CAN
+ ******************************************************************************/
+
+static void Boot_OnCanRx(uint8_t instance, uint8_t mbIndex, void *userData)
+{
+    can_message_t *slot = (can_message_t *)LFQ_SpscReserveWrite(&s_rx_queue);
+    can_message_t drop;
+
+    (void)userData;
+
+    /* Luôn đọc MB để clear flag, kể cả khi queue đầy */
+    if (slot == NULL) {
+        (void)CAN_Receive(instance, mbIndex, &drop);
+        return;
+    }
+    if (CAN_Receive(instance, mbIndex, slot) == STATUS_SUCCESS) {
+        LFQ_SpscCommitWrite(&s_rx_queue);
+    }
+}
+
+static void Boot_InitCan(void)
+{
+    can_config_t config = {
+        .instance = BOOT_CAN_INSTANCE,
+        .clockSource = CAN_CLK_SRC_BUSCLOCK,
+        .baudRate = 500000,
+        .mode = CAN_MODE_NORMAL,
+        .enableSelfReception = false,
+        .useRxFifo = false
+    };
+    const isotp_srv_config_t isotp = {
+        .instance = BOOT_CAN_INSTANCE,
+        .tx_mb = BOOT_TX_MB,
+        .tx_id = BOOT_RESPONSE_ID,
+        .rx_id = BOOT_REQUEST_ID,
+        .id_type = CAN_ID_STD,
+        .block_size = BOOT_ISOTP_BS,
+        .st_min = BOOT_ISOTP_STMIN,
+        .padding = ISOTP_SRV_PADDING_BYTE,
+        .rx_begin = Boot_OnRxBegin,
+        .rx_data = Boot_OnRxData,
+        .rx_done = Boot_OnRxDone,
+        .tx_done = NULL,
+        .user_data = NULL
+    };
+
+    PCC->PCCn[PCC_PORTE_INDEX] = PCC_PCCn_CGC_MASK;
+    PORT_SetPinMux(PORT_E, 4U, PORT_MUX_ALT5);
+    PORT_SetPinMux(PORT_E, 5U, PORT_MUX_ALT5);
+
+    (void)LFQ_SpscInit(&s_rx_queue, s_rx_storage, sizeof(can_message_t), BOOT_RX_QUEUE_SIZE);
+
+    (void)CAN_Init(&config);
+    (void)CAN_SetupTxMailbox(BOOT_CAN_INSTANCE, BOOT_TX_MB);
+    (void)CAN_SetupRxMailbox(BOOT_CAN_INSTANCE, BOOT_RX_MB, BOOT_REQUEST_ID, CAN_ID_STD, 0x7FFU);
+    (void)CAN_InstallRxCallback(BOOT_CAN_INSTANCE, BOOT_RX_MB, Boot_OnCanRx, NULL);
+    (void)CAN_InstallIrqHandlers(BOOT_CAN_INSTANCE);
+    (void)NVIC_EnableIRQ(CAN0_ORed_16_31_MB_IRQn);
+
+    (void)ISOTP_SRV_Init(&s_link, &isotp);
+}
+
+static void Boot_JumpToApp(void)
+{
+    const uint32_t *vectors = (const uint32_t *)BOOT_APP_BASE;
+    uint32_t sp = vectors[0];
+    uint32_t pc = vectors[1];
+
+    (void)NVIC_DisableGlobalIRQ();
+    (void)NVIC_DisableIRQ(CAN0_ORed_16_31_MB_IRQn);
+    (void)NVIC_DisableIRQ(FTFC_IRQn);
+    (void)CAN_Deinit(BOOT_CAN_INSTANCE);
+
+    /* PRIMASK vẫn set: application bật lại interrupt sau khi init */
+    SCB->VTOR = BOOT_APP_BASE;
+    __asm volatile ("msr msp, %0\n"
+                    "bx %1\n" : : "r" (sp), "r" (pc) : "memory");
+}
+
+/*******************************************************************************
+ * Main
+ ******************************************************************************/
+
+int main(void)
+{
+    can_message_t msg;
+    uint32_t start;
+
+    (void)TIME_SRV_Init(3U);
+    (void)NVIC_InitRamVectorTable();
+    BootFlash_Init();
+    Boot_InitCan();
+    NVIC_EnableGlobalIRQ(0U);
+
+    start = TIME_SRV_GetMicros32();
+
+    while (1) {
+        while (LFQ_SpscPop(&s_rx_queue, &msg)) {
+            (void)ISOTP_SRV_OnFrame(&s_link, &msg);
+        }
+
+        ISOTP_SRV_Process(&s_link);
+
+        /* Block vừa ghi xong: tester đang bị giữ bằng FC WAIT thì nhận tiếp */
+        if (BootFlash_Process() && s_fill_waiting && Boot_AssignFillBlock()) {
+            s_fill_waiting = false;
+            ISOTP_SRV_RxResume(&s_link);
+        }
+
+        Boot_ProcessExit();
+        Boot_ProcessCheck();
+
+        if (s_reset_pending && !ISOTP_SRV_IsTxBusy(&s_link)) {
+            NVIC_SystemReset();
+        }
+
+        /* Không có tester trong cửa sổ chờ: chạy application */
+        if (!s_programming_session &&
+            ((TIME_SRV_GetMicros32() - start) >= (BOOT_WAIT_MS * 1000UL)) &&
+            BootFlash_AppValid()) {
+            Boot_JumpToApp();
+        }
+    }
+
+    return 0;
+}
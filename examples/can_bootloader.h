@@ -0,0 +1,102 @@
+/**
+ * @file    can_bootloader.h
+ * @brief   CAN Bootloader - Memory Map and Flash Pipeline Interface
+ * @details
+ * Interface giữa can_bootloader.c (CAN / ISO-TP / UDS, can.h) và
+ * can_bootloader_flash.c (FTFC, status.h): hai header khai báo status_t
+ * khác nhau nên không include chung một translation unit.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.1
+ */
+
+#ifndef CAN_BOOTLOADER_H
+#define CAN_BOOTLOADER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Application region: sau 64 KB bootloader tới hết P-flash */
+#define BOOT_APP_BASE           (0x00010000UL)
+#define BOOT_APP_END            (0x00080000UL)
+
+/** @brief Bytes mỗi TransferData (2 buffer, half sector) */
+#define BOOT_BLOCK_SIZE         (2048U)
+#define BOOT_BLOCK_COUNT        (2U)
+
+/** @brief Program phrase của FTFC */
+#define BOOT_PHRASE_SIZE        (8U)
+
+/*******************************************************************************
+ * Flash pipeline (can_bootloader_flash.c)
+ ******************************************************************************/
+
+/** @brief FTFC init, CCIF interrupt qua RAM vector table */
+void BootFlash_Init(void);
+
+/** @brief Bắt đầu download mới: xóa lazy erase map, error, vector held */
+void BootFlash_Reset(void);
+
+/** @brief Lấy block trống để nhận TransferData, -1 nếu tất cả đang bận */
+int32_t BootFlash_AcquireBlock(void);
+
+/** @brief Data buffer của block (BOOT_BLOCK_SIZE bytes) */
+uint8_t *BootFlash_BlockData(int32_t block);
+
+/** @brief Trả block không dùng (TransferData bị từ chối) */
+void BootFlash_ReleaseBlock(int32_t block);
+
+/**
+ * @brief Queue block để erase (lazy) + program
+ * @param block   Block từ BootFlash_AcquireBlock()
+ * @param address Địa chỉ đích, phrase aligned
+ * @param length  Bytes (<= BOOT_BLOCK_SIZE, pad 0xFF tới phrase)
+ */
+void BootFlash_QueueBlock(int32_t block, uint32_t address, uint32_t length);
+
+/**
+ * @brief Một bước pipeline (main loop)
+ * @return true nếu có block vừa được giải phóng
+ */
+bool BootFlash_Process(void);
+
+/** @brief Không còn block queued / programming và FTFC idle */
+bool BootFlash_IsIdle(void);
+
+/** @brief Có lỗi erase / program từ lần BootFlash_Reset() */
+bool BootFlash_HasError(void);
+
+/**
+ * @brief Kết thúc download: program phrase vector table được giữ lại
+ * @return true nếu toàn bộ image đã ghi thành công
+ * @note Gọi khi BootFlash_IsIdle()
+ */
+bool BootFlash_Finish(void);
+
+/** @brief Vector table application hợp lệ (SP trong SRAM, PC trong region) */
+bool BootFlash_AppValid(void);
+
+/**
+ * @brief Bắt đầu tính CRC-32 của vùng flash bằng CRC engine + DMA
+ * @param address Địa chỉ đầu
+ * @param length  Bytes
+ * @return false nếu pipeline chưa idle hoặc CRC engine / DMA channel đang bận
+ */
+bool BootFlash_StartCrc(uint32_t address, uint32_t length);
+
+/** @brief CRC từ BootFlash_StartCrc() chưa xong */
+bool BootFlash_CrcBusy(void);
+
+/**
+ * @brief Kết quả CRC khi !BootFlash_CrcBusy()
+ * @param crc CRC-32 (zlib)
+ * @return false nếu DMA transfer lỗi
+ */
+bool BootFlash_CrcResult(uint32_t *crc);
+
+#endif /* CAN_BOOTLOADER_H */
@@ -0,0 +1,340 @@
+/**
+ * @file    can_bootloader_flash.c
+ * @brief   CAN Bootloader - Pipelined P-Flash Programming
+ * @details
+ * Flash side của can_bootloader.c: 2 block buffer, sector 4 KB erase lazy
+ * khi block đầu tiên chạm tới, FTFC_ProgramAsync() với phrase tiếp theo
+ * launch từ CCIF ISR. Block được ghi theo thứ tự địa chỉ.
+ *
+ * Phrase đầu application (initial SP + reset vector) được giữ lại và chỉ
+ * program ở BootFlash_Finish(): download bị ngắt giữa chừng để lại vector
+ * table trống (0xFF), BootFlash_AppValid() = false, lần reset sau vẫn ở
+ * bootloader.
+ *
+ * CheckMemory: CRC-32 của image đã ghi được tính bằng CRC engine, DMA
+ * channel BOOT_CRC_DMA_CHANNEL đọc P-flash và ghi vào CRC DATA, CPU chỉ
+ * nhận một interrupt mỗi 128 KB.
+ *
+ * @note Build với FTFC_ASYNC_PFLASH_ENABLE=1, toàn bộ bootloader chạy từ SRAM
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.1
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "can_bootloader.h"
+#include "ftfc.h"
+#include "crc.h"
+#include "dma.h"
+#include "nvic.h"
+#include <string.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define BOOT_APP_SECTORS        ((BOOT_APP_END - BOOT_APP_BASE) / FTFC_PFLASH_SECTOR_SIZE)
+
+#define BOOT_SRAM_START         (0x1FFF8000UL)
+#define BOOT_SRAM_END           (0x20007000UL)
+
+#define BOOT_CRC_DMA_CHANNEL    (0U)
+
+typedef enum {
+    BLOCK_FREE = 0,
+    BLOCK_FILLING,
+    BLOCK_QUEUED,
+    BLOCK_PROGRAMMING
+} boot_block_state_t;
+
+typedef struct {
+    uint8_t data[BOOT_BLOCK_SIZE] __attribute__((aligned(8)));
+    uint32_t address;
+    uint32_t length;
+    uint32_t skip;                  /* Bytes đầu không program (vector phrase) */
+    boot_block_state_t state;
+} boot_block_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static boot_block_t s_blocks[BOOT_BLOCK_COUNT];
+
+/* Lazy erase: bit = sector application đã erase trong download này */
+static uint32_t s_erased[(BOOT_APP_SECTORS + 31U) / 32U];
+static bool s_erasing = false;
+static uint32_t s_erase_sector;
+
+static uint8_t s_vector_phrase[BOOT_PHRASE_SIZE] __attribute__((aligned(8)));
+static bool s_vector_held = false;
+
+static bool s_error = false;
+
+/* FTFC callback (CCIF ISR) */
+static volatile bool s_flash_event = false;
+static volatile status_t s_flash_status = STATUS_SUCCESS;
+
+/* CRC callback (DMA ISR) */
+static const crc_config_t s_crc_config = CRC_CONFIG_CRC32;
+static volatile bool s_crc_busy = false;
+static volatile bool s_crc_ok = false;
+static volatile uint32_t s_crc_value = 0U;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static void BootFlash_OnDone(status_t status, void *userData)
+{
+    (void)userData;
+    s_flash_status = status;
+    s_flash_event = true;
+}
+
+static void BootFlash_OnCrcDone(status_t status, uint32_t result, void *userData)
+{
+    (void)userData;
+    s_crc_ok = (status == STATUS_SUCCESS);
+    s_crc_value = result;
+    s_crc_busy = false;
+}
+
+static bool BootFlash_SectorErased(uint32_t sector)
+{
+    return ((s_erased[sector >> 5U] & (1UL << (sector & 31U))) != 0U);
+}
+
+/* Queued block địa chỉ thấp nhất (download luôn tăng dần) */
+static boot_block_t *BootFlash_NextQueued(void)
+{
+    boot_block_t *next = NULL;
+    uint32_t i;
+
+    for (i = 0U; i < BOOT_BLOCK_COUNT; i++) {
+        if ((s_blocks[i].state == BLOCK_QUEUED) &&
+            ((next == NULL) || (s_blocks[i].address < next->address))) {
+            next = &s_blocks[i];
+        }
+    }
+    return next;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+void BootFlash_Init(void)
+{
+    (void)FTFC_Init();
+    (void)FTFC_InstallIrqHandler();
+    (void)NVIC_EnableIRQ(FTFC_IRQn);
+
+    (void)CRC_Init();
+    (void)DMA_Init();
+    (void)DMA_InstallIrqHandler(BOOT_CRC_DMA_CHANNEL);
+    (void)NVIC_EnableIRQ(DMA0_IRQn);
+}
+
+void BootFlash_Reset(void)
+{
+    uint32_t i;
+
+    memset(s_erased, 0, sizeof(s_erased));
+    for (i = 0U; i < BOOT_BLOCK_COUNT; i++) {
+        s_blocks[i].state = BLOCK_FREE;
+    }
+    s_vector_held = false;
+    s_error = false;
+}
+
+int32_t BootFlash_AcquireBlock(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < BOOT_BLOCK_COUNT; i++) {
+        if (s_blocks[i].state == BLOCK_FREE) {
+            s_blocks[i].state = BLOCK_FILLING;
+            return (int32_t)i;
+        }
+    }
+    return -1;
+}
+
+uint8_t *BootFlash_BlockData(int32_t block)
+{
+    return s_blocks[block].data;
+}
+
+void BootFlash_ReleaseBlock(int32_t block)
+{
+    s_blocks[block].state = BLOCK_FREE;
+}
+
+void BootFlash_QueueBlock(int32_t block, uint32_t address, uint32_t length)
+{
+    boot_block_t *b = &s_blocks[block];
+
+    b->address = address;
+    b->length = (length + BOOT_PHRASE_SIZE - 1U) & ~(BOOT_PHRASE_SIZE - 1U);
+    b->skip = 0U;
+    memset(&b->data[length], 0xFF, b->length - length);
+
+    /* Vector phrase ghi sau cùng, khi cả image đã vào flash */
+    if (address == BOOT_APP_BASE) {
+        memcpy(s_vector_phrase, b->data, BOOT_PHRASE_SIZE);
+        s_vector_held = true;
+        b->skip = BOOT_PHRASE_SIZE;
+    }
+
+    b->state = BLOCK_QUEUED;
+}
+
+bool BootFlash_Process(void)
+{
+    boot_block_t *block;
+    bool released = false;
+    uint32_t first;
+    uint32_t last;
+    uint32_t sector;
+    uint32_t i;
+
+    if (s_flash_event) {
+        s_flash_event = false;
+
+        if (s_flash_status != STATUS_SUCCESS) {
+            s_error = true;
+        }
+
+        if (s_erasing) {
+            s_erasing = false;
+            s_erased[s_erase_sector >> 5U] |= 1UL << (s_erase_sector & 31U);
+        } else {
+            for (i = 0U; i < BOOT_BLOCK_COUNT; i++) {
+                if (s_blocks[i].state == BLOCK_PROGRAMMING) {
+                    s_blocks[i].state = BLOCK_FREE;
+                    released = true;
+                }
+            }
+        }
+    }
+
+    if (FTFC_IsBusy() || s_error) {
+        return released;
+    }
+
+    block = BootFlash_NextQueued();
+    if (block == NULL) {
+        return released;
+    }
+
+    /* Erase mọi sector block chạm tới, mỗi lần gọi tối đa một command */
+    first = (block->address - BOOT_APP_BASE) / FTFC_PFLASH_SECTOR_SIZE;
+    last = (block->address + block->length - 1U - BOOT_APP_BASE) / FTFC_PFLASH_SECTOR_SIZE;
+    for (sector = first; sector <= last; sector++) {
+        if (!BootFlash_SectorErased(sector)) {
+            s_erasing = true;
+            s_erase_sector = sector;
+            if (FTFC_EraseSectorAsync(BOOT_APP_BASE + (sector * FTFC_PFLASH_SECTOR_SIZE),
+                                      BootFlash_OnDone, NULL) != STATUS_SUCCESS) {
+                s_erasing = false;
+                s_error = true;
+            }
+            return released;
+        }
+    }
+
+    if (block->length <= block->skip) {
+        block->state = BLOCK_FREE;
+        return true;
+    }
+
+    block->state = BLOCK_PROGRAMMING;
+    if (FTFC_ProgramAsync(block->address + block->skip, &block->data[block->skip],
+                          block->length - block->skip, BootFlash_OnDone, NULL) != STATUS_SUCCESS) {
+        block->state = BLOCK_FREE;
+        s_error = true;
+        released = true;
+    }
+
+    return released;
+}
+
+bool BootFlash_IsIdle(void)
+{
+    uint32_t i;
+
+    if (FTFC_IsBusy() || s_flash_event) {
+        return false;
+    }
+    for (i = 0U; i < BOOT_BLOCK_COUNT; i++) {
+        if ((s_blocks[i].state == BLOCK_QUEUED) || (s_blocks[i].state == BLOCK_PROGRAMMING)) {
+            /* Lỗi: block queued sẽ không bao giờ được ghi */
+            if (!s_error || (s_blocks[i].state == BLOCK_PROGRAMMING)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool BootFlash_HasError(void)
+{
+    return s_error;
+}
+
+bool BootFlash_Finish(void)
+{
+    if (s_error) {
+        return false;
+    }
+
+    if (s_vector_held) {
+        s_vector_held = false;
+        if (FTFC_Program(BOOT_APP_BASE, s_vector_phrase, BOOT_PHRASE_SIZE) != STATUS_SUCCESS) {
+            s_error = true;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool BootFlash_AppValid(void)
+{
+    const uint32_t *vectors = (const uint32_t *)BOOT_APP_BASE;
+
+    return ((vectors[0] >= BOOT_SRAM_START) && (vectors[0] <= BOOT_SRAM_END) &&
+            (vectors[1] > BOOT_APP_BASE) && (vectors[1] < BOOT_APP_END));
+}
+
+bool BootFlash_StartCrc(uint32_t address, uint32_t length)
+{
+    if (s_crc_busy || !BootFlash_IsIdle()) {
+        return false;
+    }
+
+    s_crc_busy = true;
+    s_crc_ok = false;
+    if (CRC_ComputeDmaAsync(&s_crc_config, BOOT_CRC_DMA_CHANNEL, (const void *)address, length,
+                            BootFlash_OnCrcDone, NULL) != STATUS_SUCCESS) {
+        s_crc_busy = false;
+        return false;
+    }
+
+    return true;
+}
+
+bool BootFlash_CrcBusy(void)
+{
+    return s_crc_busy;
+}
+
+bool BootFlash_CrcResult(uint32_t *crc)
+{
+    *crc = s_crc_value;
+    return s_crc_ok;
+}
@@ -239,7 +239,8 @@ static void InitTouchSensors(void)
         .trigger_mode = TOUCH_TRIGGER_HW_PDB,
         .scan_period_us = 10000,  /* 10ms = 100Hz */
         .num_channels = NUM_TOUCH_BUTTONS,
-        .callback = TouchButton_Callback
+        .callback = TouchButton_Callback,
+        .dma_channel = 0U         /* Scan frames: DMA0 IRQ -> DMA_IRQHandler(0) */
     };
     
     status = TOUCH_Init(&sysConfig);
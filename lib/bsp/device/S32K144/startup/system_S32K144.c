@@ -95,15 +95,33 @@ void SystemInit(void)
                             
   /* Configure timeout */
   WDOG->TOVAL = (uint32_t )0xFFFF;
+#else
+  /* Watchdog stays enabled: the reset timeout (~8 ms) only covers the startup
+   * code, extend it to BOOT_WDOG_TIMEOUT until WDOG_Init() takes over.
+   * No interrupt is enabled yet, the writes follow the unlock within 128 bus clocks. */
+  WDOG->CNT = (uint32_t ) FEATURE_WDOG_UNLOCK_VALUE;
+  (void)WDOG->CNT;
+  WDOG->TOVAL = (uint32_t ) BOOT_WDOG_TIMEOUT;
+  WDOG->CS  = (uint32_t ) ( (1UL << WDOG_CS_CMD32EN_SHIFT)                       |
+                            (FEATURE_WDOG_CLK_FROM_LPO << WDOG_CS_CLK_SHIFT)     |
+                            (1U << WDOG_CS_EN_SHIFT)                             |
+                            (1U << WDOG_CS_UPDATE_SHIFT)                         );
+  while ((WDOG->CS & WDOG_CS_RCS_MASK) == 0u)
+  {
+  }
 #endif /* (DISABLE_WDOG) */
 
 /**************************************************************************/
             /* ENABLE CACHE */
 /**************************************************************************/
-#if defined(I_CACHE) && (ICACHE_ENABLE == 1)
-  /* Invalidate and enable code cache */
-  LMEM->PCCCR = LMEM_PCCCR_INVW0(1) | LMEM_PCCCR_INVW1(1) | LMEM_PCCCR_GO(1) | LMEM_PCCCR_ENCACHE(1);
-#endif /* defined(I_CACHE) && (ICACHE_ENABLE == 1) */
+#if (ICACHE_ENABLE == 1)
+  /* Invalidate both ways, wait for the command to finish, then enable code cache */
+  LMEM->PCCCR = LMEM_PCCCR_INVW0(1) | LMEM_PCCCR_INVW1(1) | LMEM_PCCCR_GO(1);
+  while ((LMEM->PCCCR & LMEM_PCCCR_GO_MASK) != 0u)
+  {
+  }
+  LMEM->PCCCR = LMEM_PCCCR_ENCACHE(1);
+#endif /* (ICACHE_ENABLE == 1) */
 }
 
 /*FUNCTION**********************************************************************
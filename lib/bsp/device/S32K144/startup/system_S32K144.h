@@ -40,9 +40,15 @@ extern "C" {
   #define DISABLE_WDOG                 1
 #endif
 
-/* Cache enablement  */
+/* Watchdog timeout (LPO 128 kHz counts, ~512 ms) from SystemInit() until
+ * WDOG_Init(), used when DISABLE_WDOG is 0 */
+#ifndef BOOT_WDOG_TIMEOUT
+  #define BOOT_WDOG_TIMEOUT            0xFFFFu
+#endif
+
+/* Code cache enablement (LMEM PCCCR, invalidated and enabled in SystemInit) */
 #ifndef ICACHE_ENABLE
-#define ICACHE_ENABLE                  0
+#define ICACHE_ENABLE                  1
 #endif
 
 /* Value of the external crystal or oscillator clock frequency in Hz */
@@ -124,6 +124,12 @@ extern "C" {
                                 | ((a & 0xFF00U) >> 8U) | ((a & 0xFFU) << 8U))
 #endif
 
+/** \brief  Read the current stack pointer into sp (stack painting / usage).
+ */
+#if defined (__GNUC__) || defined (__ICCARM__) || defined (__ghs__) || defined (__ARMCC_VERSION)
+#define GET_SP(sp) __asm volatile ("mov %0, sp" : "=r" (sp))
+#endif
+
 /** \brief  Places a function in RAM.
  */
 #if defined ( __GNUC__ ) || defined (__ARMCC_VERSION)
@@ -57,6 +57,9 @@
 
 #include "startup.h"
 #include <stdint.h>
+#if (STARTUP_EARLY_SPLL != 0U)
+#include "system_S32K144.h"
+#endif
 
 
 /*******************************************************************************
@@ -64,10 +67,268 @@
  ******************************************************************************/
 static volatile uint32_t * const s_vectors[NUMBER_OF_CORES] = FEATURE_INTERRUPT_INT_VECTORS;
 
+#if (STARTUP_BSS_DMA_CLEAR != 0U)
+/* Source word of the eDMA bss clear, must live in flash */
+static const uint32_t s_zeroWord = 0U;
+#endif
+
 /*******************************************************************************
  * Code
  ******************************************************************************/
 
+#if !defined(__ARMCC_VERSION)
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : startup_copy
+ * Description   : Copy [src, src_end) to dst. When both addresses are word
+ * aligned, four words are moved per iteration (LDM / STM with GCC on Thumb-2),
+ * then the remaining words and bytes.
+ *
+ *END**************************************************************************/
+static void startup_copy(uint8_t * dst, const uint8_t * src, const uint8_t * src_end)
+{
+    uint32_t size = (uint32_t)(src_end - src);
+
+    if (((((uint32_t)dst) | ((uint32_t)src)) & 3U) == 0U)
+    {
+        uint32_t * dst_w = (uint32_t *)dst;
+        const uint32_t * src_w = (const uint32_t *)src;
+        uint32_t blocks = size >> 4U;
+
+        while (blocks != 0U)
+        {
+#if defined(__GNUC__) && defined(__thumb2__)
+            __asm volatile ("ldmia %1!, {r3-r6}\n\t"
+                            "stmia %0!, {r3-r6}"
+                            : "+r" (dst_w), "+r" (src_w)
+                            :
+                            : "r3", "r4", "r5", "r6", "memory");
+#else
+            dst_w[0] = src_w[0];
+            dst_w[1] = src_w[1];
+            dst_w[2] = src_w[2];
+            dst_w[3] = src_w[3];
+            dst_w += 4U;
+            src_w += 4U;
+#endif
+            blocks--;
+        }
+
+        for (blocks = (size >> 2U) & 3U; blocks != 0U; blocks--)
+        {
+            *dst_w = *src_w;
+            dst_w++;
+            src_w++;
+        }
+
+        dst = (uint8_t *)dst_w;
+        src = (const uint8_t *)src_w;
+    }
+
+    while (src_end != src)
+    {
+        *dst = *src;
+        dst++;
+        src++;
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : startup_zero
+ * Description   : Clear [start, end), four words per iteration when aligned.
+ *
+ *END**************************************************************************/
+static void startup_zero(uint8_t * start, const uint8_t * end)
+{
+    uint32_t size = (uint32_t)(end - start);
+
+    if ((((uint32_t)start) & 3U) == 0U)
+    {
+        uint32_t * start_w = (uint32_t *)start;
+        uint32_t blocks = size >> 4U;
+
+        while (blocks != 0U)
+        {
+#if defined(__GNUC__) && defined(__thumb2__)
+            __asm volatile ("movs r3, #0\n\t"
+                            "movs r4, #0\n\t"
+                            "movs r5, #0\n\t"
+                            "movs r6, #0\n\t"
+                            "stmia %0!, {r3-r6}"
+                            : "+r" (start_w)
+                            :
+                            : "r3", "r4", "r5", "r6", "cc", "memory");
+#else
+            start_w[0] = 0U;
+            start_w[1] = 0U;
+            start_w[2] = 0U;
+            start_w[3] = 0U;
+            start_w += 4U;
+#endif
+            blocks--;
+        }
+
+        for (blocks = (size >> 2U) & 3U; blocks != 0U; blocks--)
+        {
+            *start_w = 0U;
+            start_w++;
+        }
+
+        start = (uint8_t *)start_w;
+    }
+
+    while (end != start)
+    {
+        *start = 0U;
+        start++;
+    }
+}
+
+#if (STARTUP_BSS_DMA_CLEAR != 0U)
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : startup_dma_zero_start
+ * Description   : Start an eDMA software transfer clearing the word aligned
+ * part of [start, end): one major iteration, 32-bit writes from a constant
+ * zero word. Returns the first byte left for the CPU to clear.
+ *
+ *END**************************************************************************/
+static uint8_t * startup_dma_zero_start(uint8_t * start, const uint8_t * end)
+{
+    uint32_t size = ((uint32_t)(end - start)) & ~3U;
+
+    if (((((uint32_t)start) & 3U) != 0U) || (size == 0U))
+    {
+        return start;
+    }
+
+    DMA->TCD[STARTUP_BSS_DMA_CHANNEL].CSR = 0U;
+    DMA->TCD[STARTUP_BSS_DMA_CHANNEL].SADDR = (uint32_t)&s_zeroWord;
+    DMA->TCD[STARTUP_BSS_DMA_CHANNEL].SOFF = 0U;
+    DMA->TCD[STARTUP_BSS_DMA_CHANNEL].ATTR = DMA_TCD_ATTR_SSIZE(2U) | DMA_TCD_ATTR_DSIZE(2U);
+    DMA->TCD[STARTUP_BSS_DMA_CHANNEL].NBYTES.MLNO = DMA_TCD_NBYTES_MLNO_NBYTES(size);
+    DMA->TCD[STARTUP_BSS_DMA_CHANNEL].SLAST = 0U;
+    DMA->TCD[STARTUP_BSS_DMA_CHANNEL].DADDR = (uint32_t)start;
+    DMA->TCD[STARTUP_BSS_DMA_CHANNEL].DOFF = 4U;
+    DMA->TCD[STARTUP_BSS_DMA_CHANNEL].CITER.ELINKNO = DMA_TCD_CITER_ELINKNO_CITER(1U);
+    DMA->TCD[STARTUP_BSS_DMA_CHANNEL].BITER.ELINKNO = DMA_TCD_BITER_ELINKNO_BITER(1U);
+    DMA->TCD[STARTUP_BSS_DMA_CHANNEL].DLASTSGA = 0U;
+    DMA->TCD[STARTUP_BSS_DMA_CHANNEL].CSR = DMA_TCD_CSR_DREQ(1U) | DMA_TCD_CSR_START_MASK;
+
+    return start + size;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : startup_dma_zero_wait
+ * Description   : Wait for the eDMA bss clear and release the channel.
+ *
+ *END**************************************************************************/
+static void startup_dma_zero_wait(void)
+{
+    while ((DMA->TCD[STARTUP_BSS_DMA_CHANNEL].CSR & DMA_TCD_CSR_DONE_MASK) == 0U)
+    {
+        if (DMA->ES != 0U)
+        {
+            break;
+        }
+    }
+
+    DMA->CDNE = DMA_CDNE_CDNE(STARTUP_BSS_DMA_CHANNEL);
+    DMA->TCD[STARTUP_BSS_DMA_CHANNEL].CSR = 0U;
+}
+#endif /* STARTUP_BSS_DMA_CLEAR */
+#endif /* !defined(__ARMCC_VERSION) */
+
+#if (STARTUP_STACK_PAINT != 0U) && defined(__GNUC__) && !defined(__ARMCC_VERSION)
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : startup_paint
+ * Description   : Fill the word aligned part of [start, end) with the paint
+ * pattern. Leaf function: its own frame (a few words, more without
+ * optimization) is the only stack in use below the caller.
+ *
+ *END**************************************************************************/
+static void startup_paint(uint32_t start, uint32_t end)
+{
+    volatile uint32_t * word = (volatile uint32_t *)((start + 3U) & ~3U);
+    const volatile uint32_t * stop = (const volatile uint32_t *)(end & ~3U);
+
+    while (word < stop)
+    {
+        *word = STARTUP_STACK_PAINT_PATTERN;
+        word++;
+    }
+}
+#endif /* STARTUP_STACK_PAINT */
+
+#if (STARTUP_EARLY_SPLL != 0U)
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : startup_early_clock_init
+ * Description   : Default early clock bring-up: SOSC (8 MHz crystal) -> SPLL
+ * -> RUN system clock, so the RAM initialization runs at the final core clock.
+ * Leaves the clock on FIRC if SOSC or SPLL does not become valid.
+ *
+ *END**************************************************************************/
+__attribute__((weak)) void startup_early_clock_init(void)
+{
+    uint32_t timeout;
+
+    /* Already configured (e.g. warm reset with locked registers) */
+    if ((SCG->SPLLCSR & (SCG_SPLLCSR_LK_MASK | SCG_SPLLCSR_SPLLVLD_MASK)) != 0U)
+    {
+        return;
+    }
+
+    /* SOSC: 8 MHz crystal, high range, SOSCDIV1 / SOSCDIV2 = 1 */
+    SCG->SOSCDIV = SCG_SOSCDIV_SOSCDIV1(1U) | SCG_SOSCDIV_SOSCDIV2(1U);
+    SCG->SOSCCFG = SCG_SOSCCFG_RANGE(3U) | SCG_SOSCCFG_EREFS(1U);
+    SCG->SOSCCSR = SCG_SOSCCSR_SOSCEN(1U);
+
+    timeout = STARTUP_CLOCK_TIMEOUT;
+    while (((SCG->SOSCCSR & SCG_SOSCCSR_SOSCVLD_MASK) == 0U) && (timeout != 0U))
+    {
+        timeout--;
+    }
+    if (timeout == 0U)
+    {
+        SCG->SOSCCSR = 0U;
+        return;
+    }
+
+    /* SPLL: SPLLDIV1 = 2, SPLLDIV2 = 4 (40 MHz peripheral clock at VCO 320 MHz) */
+    SCG->SPLLCSR = 0U;
+    SCG->SPLLDIV = SCG_SPLLDIV_SPLLDIV1(2U) | SCG_SPLLDIV_SPLLDIV2(3U);
+    SCG->SPLLCFG = SCG_SPLLCFG_PREDIV(STARTUP_SPLL_PREDIV) | SCG_SPLLCFG_MULT(STARTUP_SPLL_MULT);
+    SCG->SPLLCSR = SCG_SPLLCSR_SPLLEN(1U);
+
+    timeout = STARTUP_CLOCK_TIMEOUT;
+    while (((SCG->SPLLCSR & SCG_SPLLCSR_SPLLVLD_MASK) == 0U) && (timeout != 0U))
+    {
+        timeout--;
+    }
+    if (timeout == 0U)
+    {
+        SCG->SPLLCSR = 0U;
+        return;
+    }
+
+    /* RUN: system clock = SPLL */
+    SCG->RCCR = SCG_RCCR_SCS(6U) |
+                SCG_RCCR_DIVCORE(STARTUP_RCCR_DIVCORE) |
+                SCG_RCCR_DIVBUS(STARTUP_RCCR_DIVBUS) |
+                SCG_RCCR_DIVSLOW(STARTUP_RCCR_DIVSLOW);
+
+    timeout = STARTUP_CLOCK_TIMEOUT;
+    while ((((SCG->CSR & SCG_CSR_SCS_MASK) >> SCG_CSR_SCS_SHIFT) != 6U) && (timeout != 0U))
+    {
+        timeout--;
+    }
+}
+#endif /* STARTUP_EARLY_SPLL */
+
 /*FUNCTION**********************************************************************
  *
  * Function Name : init_data_bss
@@ -176,38 +437,67 @@ void init_data_bss(void)
 
 #endif
 
+#if (STARTUP_EARLY_SPLL != 0U)
+    /* Run the copies below at the final core clock instead of FIRC */
+    startup_early_clock_init();
+#endif
+
 #if !defined(__ARMCC_VERSION)
+#if (STARTUP_BSS_DMA_CLEAR != 0U)
+    /* eDMA clears the aligned part of .bss while the core copies */
+    bss_start = startup_dma_zero_start(bss_start, bss_end);
+#endif
+
     /* Copy initialized data from ROM to RAM */
-    while (data_rom_end != data_rom)
-    {
-        *data_ram = *data_rom;
-        data_ram++;
-        data_rom++;
-    }
+    startup_copy(data_ram, data_rom, data_rom_end);
 
     /* Copy functions from ROM to RAM */
-    while (code_rom_end != code_rom)
-    {
-        *code_ram = *code_rom;
-        code_ram++;
-        code_rom++;
-    }
+    startup_copy(code_ram, code_rom, code_rom_end);
 
     /* Clear the zero-initialized data section */
-    while(bss_end != bss_start)
+    startup_zero(bss_start, bss_end);
+
+#if defined(__GNUC__)
     {
-        *bss_start = 0;
-        bss_start++;
+        /* Bank-placed .bss (DMA_BUFFER_SRAM_U / FAST_DATA_SRAM_L). Weak: both
+         * symbols resolve to 0 when the linker script has no such section */
+        extern uint32_t __BSS_SRAM_L_START[] __attribute__((weak));
+        extern uint32_t __BSS_SRAM_L_END[] __attribute__((weak));
+        extern uint32_t __BSS_SRAM_U_START[] __attribute__((weak));
+        extern uint32_t __BSS_SRAM_U_END[] __attribute__((weak));
+
+        startup_zero((uint8_t *)__BSS_SRAM_L_START, (const uint8_t *)__BSS_SRAM_L_END);
+        startup_zero((uint8_t *)__BSS_SRAM_U_START, (const uint8_t *)__BSS_SRAM_U_END);
     }
+#endif
 
     /* Copy customsection rom to ram */
-    while(custom_rom_end != custom_rom)
+    startup_copy(custom_ram, custom_rom, custom_rom_end);
+
+#if (STARTUP_BSS_DMA_CLEAR != 0U)
+    startup_dma_zero_wait();
+#endif
+#endif
+
+#if (STARTUP_STACK_PAINT != 0U) && defined(__GNUC__) && !defined(__ARMCC_VERSION)
     {
-        *custom_ram = *custom_rom;
-        custom_rom++;
-        custom_ram++;
+        extern uint32_t __StackLimit[];
+        extern uint32_t __HeapBase[];
+        extern uint32_t __HeapLimit[];
+        uint32_t sp;
+
+        /* Everything below the reset frame is unused so far, except the
+         * frame of startup_paint itself (left out, STARTUP_STACK_PAINT_MARGIN) */
+        GET_SP(sp);
+        startup_paint((uint32_t)__StackLimit, sp - STARTUP_STACK_PAINT_MARGIN);
+        startup_paint((uint32_t)__HeapBase, (uint32_t)__HeapLimit);
     }
 #endif
+
+#if (STARTUP_EARLY_SPLL != 0U)
+    /* SystemCoreClock was just reloaded from its .data initializer */
+    SystemCoreClockUpdate();
+#endif
     coreId = (uint8_t)GET_CORE_ID();
 #if defined (__ARMCC_VERSION)
         /* Copy the vector table from ROM to RAM */
@@ -114,15 +114,98 @@
     #pragma section = "__CODE_ROM"
 #endif
 
+/*!
+ * @brief Fast boot options.
+ *
+ * STARTUP_EARLY_SPLL: switch from FIRC 48 MHz to SOSC + SPLL before the RAM
+ * sections are initialized (default RUN 80 MHz: SOSC 8 MHz, VCO 320 MHz,
+ * core 80 / bus 40 / slow 20 MHz). Stays on FIRC if SOSC or SPLL fail to
+ * become valid within STARTUP_CLOCK_TIMEOUT polls.
+ *
+ * STARTUP_BSS_DMA_CLEAR: clear .bss with eDMA channel STARTUP_BSS_DMA_CHANNEL
+ * while the core copies .data / code RAM, then wait for it.
+ */
+#ifndef STARTUP_EARLY_SPLL
+    #define STARTUP_EARLY_SPLL                         (0U)
+#endif
+
+#ifndef STARTUP_BSS_DMA_CLEAR
+    #define STARTUP_BSS_DMA_CLEAR                      (0U)
+#endif
+
+#ifndef STARTUP_BSS_DMA_CHANNEL
+    #define STARTUP_BSS_DMA_CHANNEL                    (0U)
+#endif
+
+#ifndef STARTUP_CLOCK_TIMEOUT
+    #define STARTUP_CLOCK_TIMEOUT                      (100000U)
+#endif
+
+/*!
+ * @brief Stack / heap painting (GCC linker symbols __StackLimit, __HeapBase,
+ * __HeapLimit).
+ *
+ * STARTUP_STACK_PAINT: fill the unused main stack (__StackLimit up to the
+ * current stack pointer) and the heap with STARTUP_STACK_PAINT_PATTERN, so
+ * the high-water mark can be measured at runtime (stack_srv).
+ */
+#ifndef STARTUP_STACK_PAINT
+    #define STARTUP_STACK_PAINT                        (0U)
+#endif
+
+#ifndef STARTUP_STACK_PAINT_PATTERN
+    #define STARTUP_STACK_PAINT_PATTERN                (0xDEADBEEFUL)
+#endif
+
+/*! @brief Bytes below the stack pointer of init_data_bss() left unpainted */
+#ifndef STARTUP_STACK_PAINT_MARGIN
+    #define STARTUP_STACK_PAINT_MARGIN                 (64U)
+#endif
+
+/*! @brief Early SPLL settings: register field values (SPLL_CLK = 8 MHz / (PREDIV + 1) * (MULT + 16) / 2) */
+#ifndef STARTUP_SPLL_PREDIV
+    #define STARTUP_SPLL_PREDIV                        (0U)
+#endif
+
+#ifndef STARTUP_SPLL_MULT
+    #define STARTUP_SPLL_MULT                          (24U)
+#endif
+
+/*! @brief Early RCCR dividers: register field values (divide by value + 1) */
+#ifndef STARTUP_RCCR_DIVCORE
+    #define STARTUP_RCCR_DIVCORE                       (1U)
+#endif
+
+#ifndef STARTUP_RCCR_DIVBUS
+    #define STARTUP_RCCR_DIVBUS                        (1U)
+#endif
+
+#ifndef STARTUP_RCCR_DIVSLOW
+    #define STARTUP_RCCR_DIVSLOW                       (3U)
+#endif
+
 /*!
  * @brief Make necessary initializations for RAM.
  *
+ * - Optionally switch the system clock to SPLL first (STARTUP_EARLY_SPLL).
  * - Copy initialized data from ROM to RAM.
- * - Clear the zero-initialized data section.
+ * - Clear the zero-initialized data section (optionally by eDMA) and the
+ *   bank-placed .bss_sram_l / .bss_sram_u sections when the linker defines them.
  * - Copy the vector table from ROM to RAM. This could be an option.  
+ * - Optionally paint the unused stack and the heap (STARTUP_STACK_PAINT).
+ *
+ * Word aligned sections are copied four words per iteration (LDM / STM with
+ * GCC), unaligned sections fall back to byte copies.
  */
 void init_data_bss(void);
 
+/*!
+ * @brief Early clock bring-up, called by init_data_bss() when STARTUP_EARLY_SPLL
+ * is set. Weak: override for a different crystal or clock tree. Runs before
+ * .data / .bss are initialized, so it must not use static variables.
+ */
+void startup_early_clock_init(void);
+
 #endif /* STARTUP_H*/
 /*******************************************************************************
  * EOF
@@ -24,6 +24,9 @@
  ******************************************************************************/
 #include "adc.h"
 #include "pcc_reg.h"
+#include "pcc.h"
+#include "dma.h"
+#include "nvic.h"
 
 /*******************************************************************************
  * Definitions
@@ -45,11 +48,61 @@ static ADC_RegType * const s_adcBases[] = {ADC0, ADC1};
 /** @brief Array of ADC callback functions */
 static ADC_Callback_t s_adcCallbacks[2] = {NULL, NULL};
 
+/** @brief DMA streaming state per ADC instance */
+typedef struct {
+    bool active;                    /**< Stream running */
+    ADC_Instance_t instance;        /**< Owning ADC instance */
+    uint8_t channel;                /**< DMA channel */
+    uint8_t nextHalf;               /**< Half expected in the next interrupt */
+    uint16_t *buffer;               /**< 2 * halfSize samples */
+    uint16_t halfSize;              /**< Samples (or pairs) per half */
+    uint8_t stride;                 /**< Buffer entries per sample: 1, or 2 for interleaved pairs */
+    uint32_t overruns;              /**< Blocks lost to late interrupts */
+    ADC_DmaCallback_t callback;     /**< Block callback */
+    void *userData;                 /**< Callback user data */
+} adc_dma_stream_t;
+
+static adc_dma_stream_t s_adcDmaStream[2];
+
+/** @brief Scatter/gather TCDs (frame 0, frame 1) for ADC_StartScanGroupDma() */
+static DMA_TCD_Type s_adcScanTcd[2][2] DMA_TCD_ALIGN DMA_BUFFER_SRAM_U;
+
+/** @brief Dual-ADC synchronous sampling state (interrupts on the ADC1 channel) */
+static adc_dma_stream_t s_adcDualSync;
+
+/** @brief DMA channel moving ADC0 results in dual-ADC mode */
+static uint8_t s_adcDualSyncChannel0;
+
+/** @brief Non-blocking calibration state per ADC instance */
+typedef struct {
+    bool pending;                           /**< ADC_StartCalibration() not yet completed */
+    bool restoreAien;                       /**< SC1[0] AIEN before calibration */
+    ADC_Status_t lastStatus;                /**< Result of the last calibration */
+    ADC_CalibrationCallback_t callback;     /**< Completion callback */
+    void *userData;                         /**< Callback user data */
+} adc_calibration_state_t;
+
+static adc_calibration_state_t s_adcCalibration[2] = {
+    {false, false, ADC_STATUS_ERROR, NULL, NULL},
+    {false, false, ADC_STATUS_ERROR, NULL, NULL}
+};
+
+/** @brief Slots configured by ADC_ConfigScanGroup() per instance (0 = unused) */
+static uint8_t s_adcScanSlots[2] = {0U, 0U};
+
 /*******************************************************************************
  * Private Function Prototypes
  ******************************************************************************/
 
 static ADC_RegType* ADC_GetBase(ADC_Instance_t instance);
+static ADC_Status_t ADC_FinishCalibration(ADC_RegType *base);
+HAL_RAMFUNC static bool ADC_HandleCalibration(ADC_Instance_t instance);
+static uint16_t ADC_CalibrationChecksum(const ADC_CalibrationData_t *data);
+static void ADC_DmaStreamCallback(uint8_t channel, void *userData);
+static void ADC_ScanDmaCallback(uint8_t channel, void *userData);
+static ADC_Status_t ADC_ConfigResultDma(ADC_Instance_t instance, uint8_t dmaChannel,
+                                        uint16_t *dest, uint16_t entries, uint8_t stride,
+                                        bool enableInterrupt);
 
 /*******************************************************************************
  * Code
@@ -66,25 +119,102 @@ static ADC_RegType* ADC_GetBase(ADC_Instance_t instance)
     return s_adcBases[instance];
 }
 
+/**
+ * @brief Check CALF and compute the plus-side gain after calibration
+ * 
+ * @param[in] base ADC base address
+ * @return ADC_Status_t ADC_STATUS_SUCCESS or ADC_STATUS_CALIBRATION_FAILED
+ */
+static ADC_Status_t ADC_FinishCalibration(ADC_RegType *base)
+{
+    uint32_t calValue;
+    
+    /* Check calibration status */
+    if (ADC_IS_CALIBRATION_FAILED(base)) {
+        return ADC_STATUS_CALIBRATION_FAILED;
+    }
+    
+    /* Calculate and store calibration values */
+    calValue = base->CLP0 + base->CLP1 + base->CLP2 + 
+               base->CLP3 + base->CLPS;
+    calValue = calValue >> 1U;
+    calValue |= 0x8000U;  /* Set MSB */
+    base->G = calValue;
+    
+    return ADC_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Complete a pending non-blocking calibration
+ * 
+ * @param[in] instance ADC instance
+ * @return bool true if a pending calibration was completed by this call
+ */
+static bool ADC_HandleCalibration(ADC_Instance_t instance)
+{
+    ADC_RegType *base = ADC_GetBase(instance);
+    adc_calibration_state_t *cal = &s_adcCalibration[instance];
+    uint32_t primask;
+    bool finished = false;
+    
+    /* ISR and main loop poll may race for the same completion */
+    primask = NVIC_DisableGlobalIRQ();
+    if (cal->pending && ((base->SC3 & ADC_SC3_CAL_MASK) == 0U)) {
+        cal->pending = false;
+        finished = true;
+    }
+    NVIC_EnableGlobalIRQ(primask);
+    
+    if (!finished) {
+        return false;
+    }
+    
+    cal->lastStatus = ADC_FinishCalibration(base);
+    
+    /* Reading R[0] clears the COCO left by calibration */
+    (void)base->R[0];
+    base->SC1[0] = ADC_SC1_ADCH(ADC_CHANNEL_DISABLED) |
+                   (cal->restoreAien ? ADC_SC1_AIEN_MASK : 0U);
+    
+    if (cal->callback != NULL) {
+        cal->callback(instance, cal->lastStatus, cal->userData);
+    }
+    
+    return true;
+}
+
+/**
+ * @brief Checksum of a calibration record (all fields before checksum)
+ * 
+ * @param[in] data Calibration data
+ * @return uint16_t Checksum, never matches an all-0xFF / all-0x00 record
+ */
+static uint16_t ADC_CalibrationChecksum(const ADC_CalibrationData_t *data)
+{
+    uint32_t sum;
+    
+    sum = (data->magic & 0xFFFFU) + (data->magic >> 16) +
+          (data->cfg1 & 0xFFFFU) + (data->cfg1 >> 16) +
+          data->clps + data->clp3 + data->clp2 + data->clp1 + data->clp0 +
+          data->clpx + data->clp9 + data->g + data->ug;
+    
+    return (uint16_t)~((sum & 0xFFFFU) + (sum >> 16));
+}
+
 /**
  * @brief Enable ADC peripheral clock
  */
 ADC_Status_t ADC_EnableClock(ADC_Instance_t instance)
 {
-    uint32_t pccIndex;
-    
-    /* Get PCC index based on ADC instance */
+    /* Reference counted: ADC_ReadBlocking() holds its own clock reference while converting */
     if (instance == ADC_INSTANCE_0) {
-        pccIndex = PCC_ADC0_INDEX;
+        (void)PCC_AcquirePeripheralClock(PCC_ADC0_INDEX);
     } else if (instance == ADC_INSTANCE_1) {
-        pccIndex = PCC_ADC1_INDEX;
+        (void)PCC_AcquirePeripheralClock(PCC_ADC1_INDEX);
     } else {
         return ADC_STATUS_ERROR;
     }
     
-    /* Enable clock gate */
-    PCC->PCCn[pccIndex] |= PCC_PCCn_CGC_MASK;
-    
     return ADC_STATUS_SUCCESS;
 }
 
@@ -93,20 +223,15 @@ ADC_Status_t ADC_EnableClock(ADC_Instance_t instance)
  */
 ADC_Status_t ADC_DisableClock(ADC_Instance_t instance)
 {
-    uint32_t pccIndex;
-    
-    /* Get PCC index based on ADC instance */
+    /* The clock is gated only when no reference is left */
     if (instance == ADC_INSTANCE_0) {
-        pccIndex = PCC_ADC0_INDEX;
+        (void)PCC_ReleasePeripheralClock(PCC_ADC0_INDEX);
     } else if (instance == ADC_INSTANCE_1) {
-        pccIndex = PCC_ADC1_INDEX;
+        (void)PCC_ReleasePeripheralClock(PCC_ADC1_INDEX);
     } else {
         return ADC_STATUS_ERROR;
     }
     
-    /* Disable clock gate */
-    PCC->PCCn[pccIndex] &= ~PCC_PCCn_CGC_MASK;
-    
     return ADC_STATUS_SUCCESS;
 }
 
@@ -189,7 +314,6 @@ ADC_Status_t ADC_Calibrate(ADC_Instance_t instance)
 {
     ADC_RegType *base;
     uint32_t timeout;
-    uint32_t calValue;
     
     base = ADC_GetBase(instance);
     
@@ -209,17 +333,123 @@ ADC_Status_t ADC_Calibrate(ADC_Instance_t instance)
         return ADC_STATUS_TIMEOUT;
     }
     
-    /* Check calibration status */
-    if (ADC_IS_CALIBRATION_FAILED(base)) {
-        return ADC_STATUS_CALIBRATION_FAILED;
+    return ADC_FinishCalibration(base);
+}
+
+/**
+ * @brief Start ADC calibration without waiting
+ */
+ADC_Status_t ADC_StartCalibration(ADC_Instance_t instance, ADC_CalibrationCallback_t callback,
+                                  void *userData)
+{
+    ADC_RegType *base;
+    adc_calibration_state_t *cal;
+    
+    if (instance >= 2U) {
+        return ADC_STATUS_ERROR;
     }
     
-    /* Calculate and store calibration values */
-    calValue = base->CLP0 + base->CLP1 + base->CLP2 + 
-               base->CLP3 + base->CLPS;
-    calValue = calValue >> 1U;
-    calValue |= 0x8000U;  /* Set MSB */
-    base->G = calValue;
+    base = ADC_GetBase(instance);
+    cal = &s_adcCalibration[instance];
+    
+    if (cal->pending || ((base->SC3 & ADC_SC3_CAL_MASK) != 0U)) {
+        return ADC_STATUS_BUSY;
+    }
+    
+    cal->callback = callback;
+    cal->userData = userData;
+    cal->restoreAien = ((base->SC1[0] & ADC_SC1_AIEN_MASK) != 0U);
+    cal->pending = true;
+    
+    /* COCO at the end of calibration raises the ADC interrupt; SC1[0] cannot
+     * be written once CAL is set, so arm AIEN first */
+    base->SC1[0] = ADC_SC1_ADCH(ADC_CHANNEL_DISABLED) | ADC_SC1_AIEN_MASK;
+    
+    base->SC3 &= ~ADC_SC3_CALF_MASK;
+    base->SC3 |= ADC_SC3_CAL_MASK;
+    
+    return ADC_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Check progress of ADC_StartCalibration()
+ */
+ADC_Status_t ADC_PollCalibration(ADC_Instance_t instance)
+{
+    ADC_RegType *base;
+    
+    if (instance >= 2U) {
+        return ADC_STATUS_ERROR;
+    }
+    
+    base = ADC_GetBase(instance);
+    
+    if ((base->SC3 & ADC_SC3_CAL_MASK) != 0U) {
+        return s_adcCalibration[instance].pending ? ADC_STATUS_BUSY : ADC_STATUS_ERROR;
+    }
+    
+    (void)ADC_HandleCalibration(instance);
+    
+    return s_adcCalibration[instance].lastStatus;
+}
+
+/**
+ * @brief Save the current calibration registers
+ */
+ADC_Status_t ADC_SaveCalibration(ADC_Instance_t instance, ADC_CalibrationData_t *data)
+{
+    ADC_RegType *base;
+    
+    if ((instance >= 2U) || (data == NULL)) {
+        return ADC_STATUS_ERROR;
+    }
+    
+    base = ADC_GetBase(instance);
+    
+    data->magic = ADC_CALIBRATION_MAGIC;
+    data->cfg1 = base->CFG1;
+    data->clps = (uint16_t)base->CLPS;
+    data->clp3 = (uint16_t)base->CLP3;
+    data->clp2 = (uint16_t)base->CLP2;
+    data->clp1 = (uint16_t)base->CLP1;
+    data->clp0 = (uint16_t)base->CLP0;
+    data->clpx = (uint16_t)base->CLPX;
+    data->clp9 = (uint16_t)base->CLP9;
+    data->g = (uint16_t)base->G;
+    data->ug = (uint16_t)base->UG;
+    data->checksum = ADC_CalibrationChecksum(data);
+    
+    return ADC_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Restore calibration registers saved by ADC_SaveCalibration()
+ */
+ADC_Status_t ADC_RestoreCalibration(ADC_Instance_t instance, const ADC_CalibrationData_t *data)
+{
+    ADC_RegType *base;
+    
+    if ((instance >= 2U) || (data == NULL)) {
+        return ADC_STATUS_ERROR;
+    }
+    
+    base = ADC_GetBase(instance);
+    
+    if ((data->magic != ADC_CALIBRATION_MAGIC) ||
+        (data->checksum != ADC_CalibrationChecksum(data)) ||
+        (data->cfg1 != base->CFG1)) {
+        return ADC_STATUS_ERROR;
+    }
+    
+    base->CLPS = data->clps;
+    base->CLP3 = data->clp3;
+    base->CLP2 = data->clp2;
+    base->CLP1 = data->clp1;
+    base->CLP0 = data->clp0;
+    base->CLPX = data->clpx;
+    base->CLP9 = data->clp9;
+    base->G = data->g;
+    base->UG = data->ug;
     
     return ADC_STATUS_SUCCESS;
 }
@@ -255,6 +485,71 @@ ADC_Status_t ADC_ConfigureAveraging(ADC_Instance_t instance, const ADC_AverageCo
     return ADC_STATUS_SUCCESS;
 }
 
+/**
+ * @brief Configure hardware compare function
+ */
+ADC_Status_t ADC_ConfigureCompare(ADC_Instance_t instance, const ADC_CompareConfig_t *compareConfig)
+{
+    ADC_RegType *base;
+    uint32_t sc2Value;
+    
+    if ((instance >= 2U) || (compareConfig == NULL)) {
+        return ADC_STATUS_ERROR;
+    }
+    
+    base = ADC_GetBase(instance);
+    
+    /* Read current SC2 value and clear compare bits */
+    sc2Value = base->SC2 & ~(ADC_SC2_ACFE_MASK | ADC_SC2_ACFGT_MASK | ADC_SC2_ACREN_MASK);
+    sc2Value |= ADC_SC2_ACFE_MASK;
+    
+    /* Range modes use CV1 <= CV2: ACFGT selects inside (inclusive) or outside */
+    switch (compareConfig->mode) {
+        case ADC_COMPARE_LESS_THAN:
+            break;
+        case ADC_COMPARE_GREATER_OR_EQUAL:
+            sc2Value |= ADC_SC2_ACFGT_MASK;
+            break;
+        case ADC_COMPARE_INSIDE_RANGE:
+            sc2Value |= ADC_SC2_ACFGT_MASK | ADC_SC2_ACREN_MASK;
+            break;
+        case ADC_COMPARE_OUTSIDE_RANGE:
+            sc2Value |= ADC_SC2_ACREN_MASK;
+            break;
+        default:
+            return ADC_STATUS_ERROR;
+    }
+    
+    if (((sc2Value & ADC_SC2_ACREN_MASK) != 0U) &&
+        (compareConfig->threshold1 > compareConfig->threshold2)) {
+        return ADC_STATUS_ERROR;
+    }
+    
+    base->CV[0] = compareConfig->threshold1;
+    base->CV[1] = compareConfig->threshold2;
+    base->SC2 = sc2Value;
+    
+    return ADC_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Disable hardware compare function
+ */
+ADC_Status_t ADC_DisableCompare(ADC_Instance_t instance)
+{
+    ADC_RegType *base;
+    
+    if (instance >= 2U) {
+        return ADC_STATUS_ERROR;
+    }
+    
+    base = ADC_GetBase(instance);
+    
+    base->SC2 &= ~(ADC_SC2_ACFE_MASK | ADC_SC2_ACFGT_MASK | ADC_SC2_ACREN_MASK);
+    
+    return ADC_STATUS_SUCCESS;
+}
+
 /**
  * @brief Start ADC conversion
  */
@@ -361,22 +656,28 @@ ADC_Status_t ADC_ReadBlocking(ADC_Instance_t instance, ADC_Channel_t channel, ui
         return ADC_STATUS_ERROR;
     }
     
-    /* Start conversion */
-    status = ADC_StartConversion(instance, channel);
+    /* Clock runs for the whole conversion, gated again if the application released it */
+    status = ADC_EnableClock(instance);
     if (status != ADC_STATUS_SUCCESS) {
         return status;
     }
     
+    /* Start conversion */
+    status = ADC_StartConversion(instance, channel);
+    
     /* Wait for conversion to complete */
-    status = ADC_WaitForConversion(instance, ADC_TIMEOUT_COUNT);
-    if (status != ADC_STATUS_SUCCESS) {
-        return status;
+    if (status == ADC_STATUS_SUCCESS) {
+        status = ADC_WaitForConversion(instance, ADC_TIMEOUT_COUNT);
     }
     
     /* Get result */
-    *result = ADC_GetResult(instance);
+    if (status == ADC_STATUS_SUCCESS) {
+        *result = ADC_GetResult(instance);
+    }
     
-    return ADC_STATUS_SUCCESS;
+    (void)ADC_DisableClock(instance);
+    
+    return status;
 }
 
 /**
@@ -409,6 +710,65 @@ uint32_t ADC_ConvertToVoltage(uint16_t adcValue, ADC_Resolution_t resolution, ui
     return voltage;
 }
 
+/**
+ * @brief Full-scale result (same convention as ADC_ConvertToVoltage())
+ */
+static uint32_t ADC_GetMaxValue(ADC_Resolution_t resolution)
+{
+    switch (resolution) {
+        case ADC_RESOLUTION_8BIT:
+            return 255U;
+        case ADC_RESOLUTION_10BIT:
+            return 1023U;
+        default:
+            return 4095U;
+    }
+}
+
+/**
+ * @brief Compute the result-to-millivolt scale factor from a bandgap result
+ */
+uint32_t ADC_ComputeVrefScale(uint16_t bandgapResult)
+{
+    if (bandgapResult == 0U) {
+        return 0U;
+    }
+
+    /* The only division; conversions afterwards are multiply + shift */
+    return ((uint32_t)ADC_BANDGAP_MV << ADC_VREF_SCALE_SHIFT) / bandgapResult;
+}
+
+/**
+ * @brief Fixed-point scale factor for a known reference voltage
+ */
+uint32_t ADC_ComputeNominalScale(uint32_t vrefMillivolts, ADC_Resolution_t resolution)
+{
+    return (uint32_t)(((uint64_t)vrefMillivolts << ADC_VREF_SCALE_SHIFT) /
+                      ADC_GetMaxValue(resolution));
+}
+
+/**
+ * @brief Actual VREFH measured through the bandgap
+ */
+uint32_t ADC_GetVrefFromScale(uint32_t scale, ADC_Resolution_t resolution)
+{
+    return ADC_ApplyVrefScale(ADC_GetMaxValue(resolution), scale);
+}
+
+/**
+ * @brief Convert a temperature sensor result to temperature (0.1 degC)
+ */
+int32_t ADC_ConvertToTemperature(uint16_t tempResult, uint32_t scale)
+{
+    int32_t microvolts;
+
+    /* uV to keep the slope resolution (~1.5 mV / degC) */
+    microvolts = (int32_t)(((uint64_t)tempResult * scale * 1000U) >> ADC_VREF_SCALE_SHIFT);
+
+    return 250 - (((microvolts - (int32_t)ADC_TEMP_SENSOR_V25_UV) * 10) /
+                  (int32_t)ADC_TEMP_SENSOR_SLOPE_UV);
+}
+
 /**
  * @brief Register callback function
  */
@@ -428,24 +788,49 @@ ADC_Status_t ADC_RegisterCallback(ADC_Instance_t instance, ADC_Callback_t callba
  ******************************************************************************/
 
 /**
- * @brief ADC0 interrupt handler
- * 
- * @note This function should be called from the ADC0 IRQ handler
+ * @brief Service one ADC conversion interrupt
+ * @details The result register is read before the callback: reading R[0]
+ *          clears COCO, so the request is gone before the callback runs and
+ *          a conversion finishing during the callback pends a new interrupt
+ *          instead of being merged into this one. In fast mode
+ *          (ADC_IRQ_FAST_MASK) the calibration check and the COCO poll are
+ *          skipped; both are constant-folded in the instance vectors, which
+ *          inline this function into their RAM code.
  */
-void ADC0_IRQHandler(void)
+static inline void ADC_ServiceIrq(ADC_Instance_t instance, ADC_RegType *base)
 {
+    ADC_Callback_t callback;
     uint16_t result;
     
-    /* Check if conversion is complete */
-    if (ADC_IS_CONVERSION_COMPLETE(ADC0)) {
-        /* Get result */
-        result = ADC_GetResult(ADC_INSTANCE_0);
+    if ((ADC_IRQ_FAST_MASK & (1UL << (uint32_t)instance)) == 0U) {
+        /* COCO from a non-blocking calibration, not a conversion */
+        if (s_adcCalibration[instance].pending && ADC_HandleCalibration(instance)) {
+            return;
+        }
         
-        /* Call callback if registered */
-        if (s_adcCallbacks[ADC_INSTANCE_0] != NULL) {
-            s_adcCallbacks[ADC_INSTANCE_0](ADC_INSTANCE_0, result);
+        if (!ADC_IS_CONVERSION_COMPLETE(base)) {
+            return;
         }
     }
+    
+    result = (uint16_t)(ADC_GET_RESULT(base, 0) & ADC_R_D_MASK);
+    
+    callback = s_adcCallbacks[instance];
+    if (callback != NULL) {
+        callback(instance, result);
+    }
+}
+
+/**
+ * @brief ADC0 interrupt handler
+ * 
+ * @note This function should be called from the ADC0 IRQ handler
+ */
+HAL_RAMFUNC void ADC0_IRQHandler(void)
+{
+    NVIC_TRACE_ISR_ENTRY(ADC0_IRQn);
+    
+    ADC_ServiceIrq(ADC_INSTANCE_0, ADC0);
 }
 
 /**
@@ -453,39 +838,211 @@ void ADC0_IRQHandler(void)
  * 
  * @note This function should be called from the ADC1 IRQ handler
  */
-void ADC1_IRQHandler(void)
+HAL_RAMFUNC void ADC1_IRQHandler(void)
 {
-    uint16_t result;
+    NVIC_TRACE_ISR_ENTRY(ADC1_IRQn);
     
-    /* Check if conversion is complete */
-    if (ADC_IS_CONVERSION_COMPLETE(ADC1)) {
-        /* Get result */
-        result = ADC_GetResult(ADC_INSTANCE_1);
-        
-        /* Call callback if registered */
-        if (s_adcCallbacks[ADC_INSTANCE_1] != NULL) {
-            s_adcCallbacks[ADC_INSTANCE_1](ADC_INSTANCE_1, result);
-        }
-    }
+    ADC_ServiceIrq(ADC_INSTANCE_1, ADC1);
 }
 
 /*******************************************************************************
- * Hardware Trigger Functions (LPIT Trigger)
+ * DMA Streaming Functions
  ******************************************************************************/
 
 /**
- * @brief Configure ADC for LPIT hardware trigger
+ * @brief DMA half / major loop interrupt for ADC streaming
  */
-ADC_Status_t ADC_ConfigHardwareTrigger(ADC_Instance_t instance, ADC_Channel_t channel, bool enableInterrupt)
+static void ADC_DmaStreamCallback(uint8_t channel, void *userData)
 {
-    ADC_RegType *base;
-    
-    if (instance >= 2U) {
-        return ADC_STATUS_ERROR;
+    adc_dma_stream_t *stream = (adc_dma_stream_t *)userData;
+    uint16_t citer;
+    uint8_t half;
+
+    if (!stream->active) {
+        return;
     }
-    
-    base = ADC_GetBase(instance);
-    
+
+    /* CITER counts down and reloads at the wrap: still above the midpoint
+     * means the loop restarted, so the second half is the one just filled */
+    citer = DMA->TCD[channel].CITER_ELINKNO & DMA_TCD_ITER_ELINKNO_MASK;
+    half = (citer > stream->halfSize) ? 1U : 0U;
+
+    if (half != stream->nextHalf) {
+        stream->overruns++;
+    }
+    stream->nextHalf = half ^ 1U;
+
+    if (stream->callback != NULL) {
+        stream->callback(stream->instance,
+                         &stream->buffer[(uint32_t)half * stream->halfSize * stream->stride],
+                         stream->halfSize, stream->userData);
+    }
+}
+
+/**
+ * @brief Configure a circular DMA channel from R[0] into dest
+ * 
+ * @param[in] instance        ADC instance (DMAMUX source)
+ * @param[in] dmaChannel      DMA channel
+ * @param[in] dest            First destination entry
+ * @param[in] entries         Results per major loop
+ * @param[in] stride          Destination step in uint16_t entries
+ * @param[in] enableInterrupt Half and major loop interrupts
+ * @return ADC_Status_t Status of the operation
+ */
+static ADC_Status_t ADC_ConfigResultDma(ADC_Instance_t instance, uint8_t dmaChannel,
+                                        uint16_t *dest, uint16_t entries, uint8_t stride,
+                                        bool enableInterrupt)
+{
+    ADC_RegType *base = ADC_GetBase(instance);
+    dma_channel_config_t dmaConfig;
+    int16_t step = (int16_t)((uint16_t)stride * 2U);
+
+    /* Source: R[0] (16-bit read clears COCO), destination wraps via DLAST */
+    dmaConfig.channel = dmaChannel;
+    dmaConfig.source = (instance == ADC_INSTANCE_0) ? DMAMUX_SRC_ADC0 : DMAMUX_SRC_ADC1;
+    dmaConfig.transferType = DMA_TRANSFER_PERIPH_TO_MEM;
+    dmaConfig.transferSize = DMA_TRANSFER_SIZE_2B;
+    dmaConfig.priority = DMA_PRIORITY_HIGH;
+    dmaConfig.sourceAddr = (uint32_t)&(base->R[0]);
+    dmaConfig.sourceOffset = 0;
+    dmaConfig.sourceLastAddrAdjust = 0;
+    dmaConfig.destAddr = (uint32_t)dest;
+    dmaConfig.destOffset = step;
+    dmaConfig.destLastAddrAdjust = -((int32_t)entries * step);   /* Back to buffer start */
+    dmaConfig.minorLoopBytes = 2U;
+    dmaConfig.majorLoopCount = entries;
+    dmaConfig.enableInterrupt = enableInterrupt;
+    dmaConfig.disableRequestAfterDone = false;                  /* Keep running forever */
+    dmaConfig.enablePeriodicTrigger = false;
+
+    if (DMA_ConfigChannel(&dmaConfig) != STATUS_SUCCESS) {
+        return ADC_STATUS_ERROR;
+    }
+
+    if (enableInterrupt) {
+        DMA->TCD[dmaChannel].CSR |= DMA_TCD_CSR_INTHALF_MASK;
+    }
+
+    return ADC_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Start streaming ADC results into a ping-pong buffer via eDMA
+ */
+ADC_Status_t ADC_StartDmaStream(ADC_Instance_t instance, uint8_t dmaChannel,
+                                uint16_t *buffer, uint16_t samplesPerHalf,
+                                ADC_DmaCallback_t callback, void *userData)
+{
+    ADC_RegType *base;
+    adc_dma_stream_t *stream;
+
+    if ((instance >= 2U) || (buffer == NULL) || (samplesPerHalf == 0U) ||
+        (samplesPerHalf > ADC_DMA_STREAM_MAX_HALF) || (dmaChannel >= DMA_MAX_CHANNELS)) {
+        return ADC_STATUS_ERROR;
+    }
+
+    base = ADC_GetBase(instance);
+    stream = &s_adcDmaStream[instance];
+
+    if (stream->active || s_adcDualSync.active) {
+        return ADC_STATUS_BUSY;
+    }
+
+    /* COCO cleared by the ADC ISR would never reach the DMA */
+    if ((base->SC1[0] & ADC_SC1_AIEN_MASK) != 0U) {
+        return ADC_STATUS_ERROR;
+    }
+
+    stream->instance = instance;
+    stream->channel = dmaChannel;
+    stream->nextHalf = 0U;
+    stream->buffer = buffer;
+    stream->halfSize = samplesPerHalf;
+    stream->stride = 1U;
+    stream->overruns = 0U;
+    stream->callback = callback;
+    stream->userData = userData;
+
+    if (ADC_ConfigResultDma(instance, dmaChannel, buffer, (uint16_t)(samplesPerHalf * 2U),
+                            1U, true) != ADC_STATUS_SUCCESS) {
+        return ADC_STATUS_ERROR;
+    }
+
+    if (DMA_InstallCallback(dmaChannel, ADC_DmaStreamCallback, stream) != STATUS_SUCCESS) {
+        return ADC_STATUS_ERROR;
+    }
+
+    stream->active = true;
+
+    if (DMA_StartChannel(dmaChannel) != STATUS_SUCCESS) {
+        stream->active = false;
+        return ADC_STATUS_ERROR;
+    }
+
+    /* Requests only start once the channel is armed */
+    base->SC2 |= ADC_SC2_DMAEN_MASK;
+
+    return ADC_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Stop DMA streaming
+ */
+ADC_Status_t ADC_StopDmaStream(ADC_Instance_t instance)
+{
+    ADC_RegType *base;
+    adc_dma_stream_t *stream;
+
+    if (instance >= 2U) {
+        return ADC_STATUS_ERROR;
+    }
+
+    base = ADC_GetBase(instance);
+    stream = &s_adcDmaStream[instance];
+
+    if (!stream->active) {
+        return ADC_STATUS_SUCCESS;
+    }
+
+    base->SC2 &= ~ADC_SC2_DMAEN_MASK;
+    stream->active = false;
+
+    /* Callback stays installed but returns early while inactive */
+    (void)DMA_StopChannel(stream->channel);
+
+    return ADC_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Get number of blocks lost since ADC_StartDmaStream()
+ */
+uint32_t ADC_GetDmaStreamOverruns(ADC_Instance_t instance)
+{
+    if (instance >= 2U) {
+        return 0U;
+    }
+
+    return s_adcDmaStream[instance].overruns;
+}
+
+/*******************************************************************************
+ * Hardware Trigger Functions (LPIT Trigger)
+ ******************************************************************************/
+
+/**
+ * @brief Configure ADC for LPIT hardware trigger
+ */
+ADC_Status_t ADC_ConfigHardwareTrigger(ADC_Instance_t instance, ADC_Channel_t channel, bool enableInterrupt)
+{
+    ADC_RegType *base;
+    
+    if (instance >= 2U) {
+        return ADC_STATUS_ERROR;
+    }
+    
+    base = ADC_GetBase(instance);
+    
     /* Enable hardware trigger in SC2 register */
     base->SC2 |= ADC_SC2_ADTRG_MASK;
     
@@ -558,3 +1115,389 @@ bool ADC_IsHardwareTriggerEnabled(ADC_Instance_t instance)
     
     return ((base->SC2 & ADC_SC2_ADTRG_MASK) != 0U);
 }
+
+/*******************************************************************************
+ * PDB Scan Group Functions
+ ******************************************************************************/
+
+/**
+ * @brief Configure a back-to-back scan group on ADC0 and / or ADC1
+ */
+ADC_Status_t ADC_ConfigScanGroup(const ADC_ScanGroupConfig_t *config)
+{
+    ADC_RegType *base;
+    pdb_config_t pdbConfig;
+    uint32_t instance;
+    uint32_t slot;
+    
+    if (config == NULL) {
+        return ADC_STATUS_ERROR;
+    }
+    
+    if ((config->numChannels[0] == 0U) && (config->numChannels[1] == 0U)) {
+        return ADC_STATUS_ERROR;
+    }
+    
+    for (instance = 0U; instance < 2U; instance++) {
+        if ((config->numChannels[instance] > ADC_SC1_COUNT) ||
+            ((config->numChannels[instance] != 0U) && (config->channels[instance] == NULL))) {
+            return ADC_STATUS_ERROR;
+        }
+    }
+    
+    pdbConfig.prescaler = config->prescaler;
+    pdbConfig.mult_factor = config->multFactor;
+    pdbConfig.trigger_source = config->triggerSource;
+    pdbConfig.mod_value = config->modulus;
+    pdbConfig.continuous_mode = config->continuousMode;
+    pdbConfig.enable_interrupt = false;
+    
+    for (instance = 0U; instance < 2U; instance++) {
+        s_adcScanSlots[instance] = config->numChannels[instance];
+        if (config->numChannels[instance] == 0U) {
+            continue;
+        }
+        
+        base = ADC_GetBase((ADC_Instance_t)instance);
+        
+        /* SC1[n] is converted when PDB pre-trigger n fires */
+        base->SC2 |= ADC_SC2_ADTRG_MASK;
+        for (slot = 0U; slot < config->numChannels[instance]; slot++) {
+            base->SC1[slot] = ADC_SC1_ADCH(config->channels[instance][slot]);
+        }
+        
+        /* PDB0 -> ADC0, PDB1 -> ADC1; LDOK is only accepted while PDBEN = 1 */
+        PDB_Init((pdb_instance_t)instance, &pdbConfig);
+        PDB_ConfigBackToBackChain((pdb_instance_t)instance, config->numChannels[instance], config->delay);
+        PDB_Enable((pdb_instance_t)instance);
+        PDB_LoadConfig((pdb_instance_t)instance);
+    }
+    
+    return ADC_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Software-trigger the scan group on every configured instance
+ */
+ADC_Status_t ADC_StartScanGroup(void)
+{
+    uint32_t primask;
+    
+    if ((s_adcScanSlots[0] == 0U) && (s_adcScanSlots[1] == 0U)) {
+        return ADC_STATUS_ERROR;
+    }
+    
+    /* Keep the two triggers back-to-back so both scans stay phase aligned */
+    primask = NVIC_DisableGlobalIRQ();
+    if (s_adcScanSlots[0] != 0U) {
+        PDB_SoftwareTrigger(PDB_INSTANCE_0);
+    }
+    if (s_adcScanSlots[1] != 0U) {
+        PDB_SoftwareTrigger(PDB_INSTANCE_1);
+    }
+    NVIC_EnableGlobalIRQ(primask);
+    
+    return ADC_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Stop the scan group
+ */
+ADC_Status_t ADC_StopScanGroup(void)
+{
+    ADC_RegType *base;
+    uint32_t instance;
+    uint32_t slot;
+    
+    for (instance = 0U; instance < 2U; instance++) {
+        if (s_adcScanSlots[instance] == 0U) {
+            continue;
+        }
+        
+        PDB_Disable((pdb_instance_t)instance);
+        
+        base = ADC_GetBase((ADC_Instance_t)instance);
+        base->SC2 &= ~ADC_SC2_ADTRG_MASK;
+        for (slot = 0U; slot < s_adcScanSlots[instance]; slot++) {
+            base->SC1[slot] = ADC_SC1_ADCH(ADC_CHANNEL_DISABLED);
+        }
+        
+        s_adcScanSlots[instance] = 0U;
+    }
+    
+    return ADC_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Check whether the last slot of the scan group has converted
+ */
+bool ADC_IsScanGroupComplete(ADC_Instance_t instance)
+{
+    ADC_RegType *base;
+    
+    if ((instance >= 2U) || (s_adcScanSlots[instance] == 0U)) {
+        return false;
+    }
+    
+    base = ADC_GetBase(instance);
+    
+    return ((base->SC1[s_adcScanSlots[instance] - 1U] & ADC_SC1_COCO_MASK) != 0U);
+}
+
+/**
+ * @brief Read scan group results in slot order
+ */
+ADC_Status_t ADC_ReadScanGroup(ADC_Instance_t instance, uint16_t *results, uint8_t count)
+{
+    ADC_RegType *base;
+    uint32_t slot;
+    
+    if ((instance >= 2U) || (results == NULL) || (count > s_adcScanSlots[instance])) {
+        return ADC_STATUS_ERROR;
+    }
+    
+    base = ADC_GetBase(instance);
+    
+    for (slot = 0U; slot < count; slot++) {
+        results[slot] = (uint16_t)(base->R[slot] & ADC_R_D_MASK);
+    }
+    
+    return ADC_STATUS_SUCCESS;
+}
+
+/**
+ * @brief DMA major loop interrupt for scan group frames
+ */
+static void ADC_ScanDmaCallback(uint8_t channel, void *userData)
+{
+    adc_dma_stream_t *stream = (adc_dma_stream_t *)userData;
+    uint32_t daddr;
+    uint8_t frame;
+
+    if (!stream->active) {
+        return;
+    }
+
+    /* The channel already runs the next TCD: DADDR inside frame 1 means
+     * frame 0 is the one just completed */
+    daddr = DMA->TCD[channel].DADDR;
+    frame = (daddr >= (uint32_t)&stream->buffer[stream->halfSize]) ? 0U : 1U;
+
+    if (frame != stream->nextHalf) {
+        stream->overruns++;
+    }
+    stream->nextHalf = frame ^ 1U;
+
+    if (stream->callback != NULL) {
+        stream->callback(stream->instance, &stream->buffer[(uint32_t)frame * stream->halfSize],
+                         stream->halfSize, stream->userData);
+    }
+}
+
+/**
+ * @brief Collect scan group frames into a ping-pong frame buffer via eDMA
+ */
+ADC_Status_t ADC_StartScanGroupDma(ADC_Instance_t instance, uint8_t dmaChannel, uint16_t *frames,
+                                   ADC_DmaCallback_t callback, void *userData)
+{
+    ADC_RegType *base;
+    adc_dma_stream_t *stream;
+    dma_tcd_config_t stage[2];
+    uint32_t slots;
+    uint32_t i;
+
+    if ((instance >= 2U) || (frames == NULL) || (dmaChannel >= DMA_MAX_CHANNELS)) {
+        return ADC_STATUS_ERROR;
+    }
+
+    slots = s_adcScanSlots[instance];
+    if (slots == 0U) {
+        return ADC_STATUS_ERROR;
+    }
+
+    base = ADC_GetBase(instance);
+    stream = &s_adcDmaStream[instance];
+
+    if (stream->active || s_adcDualSync.active) {
+        return ADC_STATUS_BUSY;
+    }
+
+    if ((base->SC1[slots - 1U] & ADC_SC1_AIEN_MASK) != 0U) {
+        return ADC_STATUS_ERROR;
+    }
+
+    /* Source walks R[0..n-1] (32-bit registers) and rewinds, destination is
+     * one frame per stage */
+    for (i = 0U; i < 2U; i++) {
+        stage[i].transferSize = DMA_TRANSFER_SIZE_2B;
+        stage[i].sourceAddr = (uint32_t)&(base->R[0]);
+        stage[i].sourceOffset = (int16_t)sizeof(base->R[0]);
+        stage[i].sourceLastAddrAdjust = -(int32_t)(slots * sizeof(base->R[0]));
+        stage[i].destAddr = (uint32_t)&frames[i * slots];
+        stage[i].destOffset = (int16_t)sizeof(uint16_t);
+        stage[i].destLastAddrAdjust = 0;
+        stage[i].minorLoopBytes = 2U;
+        stage[i].majorLoopCount = (uint16_t)slots;
+        stage[i].enableInterrupt = true;
+        stage[i].enableHalfInterrupt = false;
+        stage[i].disableRequestAfterDone = false;
+        stage[i].enableMinorLink = false;
+        stage[i].minorLinkChannel = 0U;
+        stage[i].enableMajorLink = false;
+        stage[i].majorLinkChannel = 0U;
+    }
+
+    if (DMA_BuildTcdChain(s_adcScanTcd[instance], stage, 2U, true) != STATUS_SUCCESS) {
+        return ADC_STATUS_ERROR;
+    }
+
+    if (DMA_ConfigChannelTcd(dmaChannel,
+                             (instance == ADC_INSTANCE_0) ? DMAMUX_SRC_ADC0 : DMAMUX_SRC_ADC1,
+                             DMA_PRIORITY_HIGH, &s_adcScanTcd[instance][0]) != STATUS_SUCCESS) {
+        return ADC_STATUS_ERROR;
+    }
+
+    stream->instance = instance;
+    stream->channel = dmaChannel;
+    stream->nextHalf = 0U;
+    stream->buffer = frames;
+    stream->halfSize = (uint16_t)slots;
+    stream->stride = 1U;
+    stream->overruns = 0U;
+    stream->callback = callback;
+    stream->userData = userData;
+
+    if (DMA_InstallCallback(dmaChannel, ADC_ScanDmaCallback, stream) != STATUS_SUCCESS) {
+        return ADC_STATUS_ERROR;
+    }
+
+    stream->active = true;
+
+    if (DMA_StartChannel(dmaChannel) != STATUS_SUCCESS) {
+        stream->active = false;
+        return ADC_STATUS_ERROR;
+    }
+
+    base->SC2 |= ADC_SC2_DMAEN_MASK;
+
+    return ADC_STATUS_SUCCESS;
+}
+
+/*******************************************************************************
+ * Dual-ADC Synchronous Sampling Functions
+ ******************************************************************************/
+
+/**
+ * @brief Start synchronous dual-ADC sampling into an interleaved buffer
+ */
+ADC_Status_t ADC_StartDualSync(const ADC_DualSyncConfig_t *config)
+{
+    ADC_ScanGroupConfig_t group;
+    adc_dma_stream_t *stream = &s_adcDualSync;
+    uint16_t entries;
+
+    if ((config == NULL) || (config->buffer == NULL) || (config->pairsPerHalf == 0U) ||
+        (config->pairsPerHalf > ADC_DMA_STREAM_MAX_HALF) ||
+        (config->dmaChannel0 >= DMA_MAX_CHANNELS) || (config->dmaChannel1 >= DMA_MAX_CHANNELS) ||
+        (config->dmaChannel0 == config->dmaChannel1)) {
+        return ADC_STATUS_ERROR;
+    }
+
+    if (stream->active || s_adcDmaStream[0].active || s_adcDmaStream[1].active) {
+        return ADC_STATUS_BUSY;
+    }
+
+    /* One slot per ADC, identical PDB timing, started by the shared TRGMUX event */
+    group.channels[0] = &config->channel0;
+    group.channels[1] = &config->channel1;
+    group.numChannels[0] = 1U;
+    group.numChannels[1] = 1U;
+    group.prescaler = PDB_PRESCALER_1;
+    group.multFactor = PDB_MULT_1;
+    group.modulus = 0xFFFFU;
+    group.delay = config->delay;
+    group.triggerSource = PDB_TRIGGER_TRGMUX;
+    group.continuousMode = false;
+
+    if (ADC_ConfigScanGroup(&group) != ADC_STATUS_SUCCESS) {
+        return ADC_STATUS_ERROR;
+    }
+
+    stream->instance = ADC_INSTANCE_0;
+    stream->channel = config->dmaChannel1;
+    stream->nextHalf = 0U;
+    stream->buffer = config->buffer;
+    stream->halfSize = config->pairsPerHalf;
+    stream->stride = 2U;
+    stream->overruns = 0U;
+    stream->callback = config->callback;
+    stream->userData = config->userData;
+    s_adcDualSyncChannel0 = config->dmaChannel0;
+
+    /* ADC0 -> even entries, ADC1 -> odd entries; only the ADC1 channel interrupts */
+    entries = (uint16_t)(config->pairsPerHalf * 2U);
+    if ((ADC_ConfigResultDma(ADC_INSTANCE_0, config->dmaChannel0, &config->buffer[0],
+                             entries, 2U, false) != ADC_STATUS_SUCCESS) ||
+        (ADC_ConfigResultDma(ADC_INSTANCE_1, config->dmaChannel1, &config->buffer[1],
+                             entries, 2U, true) != ADC_STATUS_SUCCESS)) {
+        (void)ADC_StopScanGroup();
+        return ADC_STATUS_ERROR;
+    }
+
+    if (DMA_InstallCallback(config->dmaChannel1, ADC_DmaStreamCallback, stream) != STATUS_SUCCESS) {
+        (void)ADC_StopScanGroup();
+        return ADC_STATUS_ERROR;
+    }
+
+    stream->active = true;
+
+    if ((DMA_StartChannel(config->dmaChannel0) != STATUS_SUCCESS) ||
+        (DMA_StartChannel(config->dmaChannel1) != STATUS_SUCCESS)) {
+        (void)ADC_StopDualSync();
+        return ADC_STATUS_ERROR;
+    }
+
+    ADC0->SC2 |= ADC_SC2_DMAEN_MASK;
+    ADC1->SC2 |= ADC_SC2_DMAEN_MASK;
+
+    /* Route the trigger last, once everything downstream is armed */
+    if ((TRGMUX_SetSource(TRGMUX_TARGET_PDB0, 0U, config->triggerSource) != STATUS_SUCCESS) ||
+        (TRGMUX_SetSource(TRGMUX_TARGET_PDB1, 0U, config->triggerSource) != STATUS_SUCCESS)) {
+        (void)ADC_StopDualSync();
+        return ADC_STATUS_ERROR;
+    }
+
+    return ADC_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Stop synchronous dual-ADC sampling
+ */
+ADC_Status_t ADC_StopDualSync(void)
+{
+    adc_dma_stream_t *stream = &s_adcDualSync;
+
+    if (!stream->active) {
+        return ADC_STATUS_SUCCESS;
+    }
+
+    (void)TRGMUX_SetSource(TRGMUX_TARGET_PDB0, 0U, TRGMUX_SRC_DISABLED);
+    (void)TRGMUX_SetSource(TRGMUX_TARGET_PDB1, 0U, TRGMUX_SRC_DISABLED);
+
+    ADC0->SC2 &= ~ADC_SC2_DMAEN_MASK;
+    ADC1->SC2 &= ~ADC_SC2_DMAEN_MASK;
+    stream->active = false;
+
+    (void)DMA_StopChannel(s_adcDualSyncChannel0);
+    (void)DMA_StopChannel(stream->channel);
+
+    return ADC_StopScanGroup();
+}
+
+/**
+ * @brief Get number of blocks lost in dual-ADC mode
+ */
+uint32_t ADC_GetDualSyncOverruns(void)
+{
+    return s_adcDualSync.overruns;
+}
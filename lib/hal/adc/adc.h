@@ -27,6 +27,8 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "adc_reg.h"
+#include "pdb.h"
+#include "trgmux.h"
 
 /*******************************************************************************
  * Definitions
@@ -104,6 +106,8 @@ typedef enum {
     ADC_CHANNEL_AD13 = 13U,    /**< ADC channel 13 */
     ADC_CHANNEL_AD14 = 14U,    /**< ADC channel 14 */
     ADC_CHANNEL_AD15 = 15U,    /**< ADC channel 15 */
+    ADC_CHANNEL_TEMP_SENSOR = 26U, /**< Internal temperature sensor */
+    ADC_CHANNEL_BANDGAP = 27U, /**< Internal bandgap reference */
     ADC_CHANNEL_DISABLED = 31U /**< Channel disabled */
 } ADC_Channel_t;
 
@@ -138,6 +142,85 @@ typedef struct {
     ADC_AverageMode_t  averageMode;  /**< Hardware average mode */
 } ADC_AverageConfig_t;
 
+/**
+ * @brief ADC instances whose interrupt handler runs in fast mode (bit n = ADCn)
+ * @details Fast mode handler reads R[0] (which clears COCO) and calls the
+ *          callback, without the non-blocking calibration check and the SC1
+ *          COCO poll. Usable when the interrupt only comes from SC1[0]
+ *          conversions: calibrate with ADC_Calibrate(), or complete
+ *          ADC_StartCalibration() with ADC_PollCalibration() while the
+ *          conversion interrupt is disabled.
+ */
+#ifndef ADC_IRQ_FAST_MASK
+#define ADC_IRQ_FAST_MASK         (0U)
+#endif
+
+/** @brief Bandgap reference voltage (mV, datasheet typical) */
+#ifndef ADC_BANDGAP_MV
+#define ADC_BANDGAP_MV            (1000U)
+#endif
+
+/** @brief Temperature sensor voltage at 25 degC (uV, datasheet typical) */
+#ifndef ADC_TEMP_SENSOR_V25_UV
+#define ADC_TEMP_SENSOR_V25_UV    (740500U)
+#endif
+
+/** @brief Temperature sensor slope (uV / degC, voltage falls as temperature rises) */
+#ifndef ADC_TEMP_SENSOR_SLOPE_UV
+#define ADC_TEMP_SENSOR_SLOPE_UV  (1492U)
+#endif
+
+/** @brief Fraction bits of the scale factor from ADC_ComputeVrefScale() */
+#define ADC_VREF_SCALE_SHIFT      (16U)
+
+/** @brief Marker of a valid ADC_CalibrationData_t ("CAL1") */
+#define ADC_CALIBRATION_MAGIC     (0x43414C31UL)
+
+/**
+ * @brief Saved calibration result
+ * @details Filled by ADC_SaveCalibration(), typically kept in flash / EEPROM
+ *          and written back with ADC_RestoreCalibration() at boot.
+ */
+typedef struct {
+    uint32_t magic;       /**< ADC_CALIBRATION_MAGIC */
+    uint32_t cfg1;        /**< CFG1 at calibration time (clock / resolution) */
+    uint16_t clps;        /**< CLPS */
+    uint16_t clp3;        /**< CLP3 */
+    uint16_t clp2;        /**< CLP2 */
+    uint16_t clp1;        /**< CLP1 */
+    uint16_t clp0;        /**< CLP0 */
+    uint16_t clpx;        /**< CLPX */
+    uint16_t clp9;        /**< CLP9 */
+    uint16_t g;           /**< Gain G */
+    uint16_t ug;          /**< User gain UG */
+    uint16_t checksum;    /**< Checksum of the fields above */
+} ADC_CalibrationData_t;
+
+/**
+ * @brief ADC calibration complete callback type
+ * @param instance ADC instance
+ * @param status   ADC_STATUS_SUCCESS or ADC_STATUS_CALIBRATION_FAILED
+ * @param userData User data passed to ADC_StartCalibration()
+ */
+typedef void (*ADC_CalibrationCallback_t)(ADC_Instance_t instance, ADC_Status_t status, void *userData);
+
+/** @brief ADC compare function mode (COCO only set when the result matches) */
+typedef enum {
+    ADC_COMPARE_LESS_THAN        = 0U,    /**< result < threshold1 */
+    ADC_COMPARE_GREATER_OR_EQUAL = 1U,    /**< result >= threshold1 */
+    ADC_COMPARE_INSIDE_RANGE     = 2U,    /**< threshold1 <= result <= threshold2 */
+    ADC_COMPARE_OUTSIDE_RANGE    = 3U     /**< result < threshold1 or result > threshold2 */
+} ADC_CompareMode_t;
+
+/**
+ * @brief ADC compare function configuration structure
+ */
+typedef struct {
+    ADC_CompareMode_t mode;          /**< Compare mode */
+    uint16_t          threshold1;    /**< Threshold, or range low bound */
+    uint16_t          threshold2;    /**< Range high bound (range modes only) */
+} ADC_CompareConfig_t;
+
 /**
  * @brief ADC callback function type
  * @param instance ADC instance that triggered the callback
@@ -145,6 +228,60 @@ typedef struct {
  */
 typedef void (*ADC_Callback_t)(ADC_Instance_t instance, uint16_t result);
 
+/**
+ * @brief PDB back-to-back scan group configuration
+ * 
+ * One PDB trigger converts channels[i][0..n-1] into SC1[0..n-1] of ADCi,
+ * each slot starting on the conversion complete of the previous one.
+ * PDB0 drives ADC0 and PDB1 drives ADC1, both with the same timing.
+ */
+typedef struct {
+    const ADC_Channel_t *channels[2];    /**< Slot order per ADC instance (NULL = instance unused) */
+    uint8_t             numChannels[2];  /**< Slots per ADC instance (0-16) */
+    pdb_prescaler_t     prescaler;       /**< PDB counter prescaler */
+    pdb_mult_t          multFactor;      /**< PDB prescaler multiplier */
+    uint16_t            modulus;         /**< PDB period in PDB counts (continuous mode) */
+    uint16_t            delay;           /**< Delay from trigger to slot 0 in PDB counts */
+    pdb_trigger_t       triggerSource;   /**< Software or TRGMUX (phase-aligned start) */
+    bool                continuousMode;  /**< Restart the scan every modulus counts */
+} ADC_ScanGroupConfig_t;
+
+/** @brief Maximum samples per half buffer in DMA streaming (2 halves fit in CITER) */
+#define ADC_DMA_STREAM_MAX_HALF   (0x3FFFU)
+
+/**
+ * @brief ADC DMA stream block callback type
+ * @param instance ADC instance that produced the block
+ * @param block    Half buffer that has just been filled
+ * @param count    Number of samples in block (samplesPerHalf)
+ * @param userData User data passed to ADC_StartDmaStream()
+ *
+ * @note Called from the DMA channel interrupt. DMA keeps writing the other
+ *       half, so the block must be consumed before that half fills up.
+ */
+typedef void (*ADC_DmaCallback_t)(ADC_Instance_t instance, const uint16_t *block,
+                                  uint16_t count, void *userData);
+
+/**
+ * @brief Dual-ADC synchronous sampling configuration
+ * 
+ * Each event of triggerSource starts PDB0 and PDB1 together, ADC0 and ADC1
+ * sample channel0 / channel1 at the same instant and two DMA channels write
+ * the results interleaved: buffer = {ADC0, ADC1, ADC0, ADC1, ...}.
+ */
+typedef struct {
+    ADC_Channel_t     channel0;        /**< ADC0 channel (e.g. voltage) */
+    ADC_Channel_t     channel1;        /**< ADC1 channel (e.g. current) */
+    trgmux_source_t   triggerSource;   /**< Shared trigger routed to PDB0 and PDB1 (LPIT, FTM, ...) */
+    uint16_t          delay;           /**< Delay from trigger to sampling in PDB counts */
+    uint8_t           dmaChannel0;     /**< DMA channel for ADC0 results */
+    uint8_t           dmaChannel1;     /**< DMA channel for ADC1 results (block interrupts) */
+    uint16_t          *buffer;         /**< 4 * pairsPerHalf entries (2 halves of pairs) */
+    uint16_t          pairsPerHalf;    /**< Pairs per block (1 - ADC_DMA_STREAM_MAX_HALF) */
+    ADC_DmaCallback_t callback;        /**< Block callback: block = pairs, count = pairs */
+    void              *userData;       /**< Callback user data */
+} ADC_DualSyncConfig_t;
+
 /** @} */
 
 /*******************************************************************************
@@ -210,6 +347,69 @@ ADC_Status_t ADC_Init(ADC_Instance_t instance, const ADC_Config_t *config);
  */
 ADC_Status_t ADC_Calibrate(ADC_Instance_t instance);
 
+/**
+ * @brief Start ADC calibration without waiting
+ * 
+ * Starts the calibration sequence and returns immediately. Completion is
+ * reported to callback from ADCx_IRQHandler() (enable ADCx_IRQn in NVIC) or
+ * from ADC_PollCalibration() in the main loop, whichever sees it first.
+ * 
+ * @param[in] instance ADC instance (ADC0 or ADC1)
+ * @param[in] callback Completion callback, may be NULL when polling
+ * @param[in] userData User data passed to callback
+ * @return ADC_Status_t Status of the operation
+ * @retval ADC_STATUS_BUSY Calibration already running
+ * 
+ * @note Do not start conversions (write SC1[0]) until calibration completes,
+ *       that aborts the sequence
+ */
+ADC_Status_t ADC_StartCalibration(ADC_Instance_t instance, ADC_CalibrationCallback_t callback,
+                                  void *userData);
+
+/**
+ * @brief Check progress of ADC_StartCalibration()
+ * 
+ * @param[in] instance ADC instance (ADC0 or ADC1)
+ * @return ADC_Status_t Status of the calibration
+ * @retval ADC_STATUS_BUSY               Still running
+ * @retval ADC_STATUS_SUCCESS            Done (callback has been called)
+ * @retval ADC_STATUS_CALIBRATION_FAILED Done with CALF set
+ * @retval ADC_STATUS_ERROR              No calibration was started
+ */
+ADC_Status_t ADC_PollCalibration(ADC_Instance_t instance);
+
+/**
+ * @brief Save the current calibration registers
+ * 
+ * @param[in]  instance ADC instance (ADC0 or ADC1)
+ * @param[out] data     Calibration data, store it in non-volatile memory
+ * @return ADC_Status_t Status of the operation
+ */
+ADC_Status_t ADC_SaveCalibration(ADC_Instance_t instance, ADC_CalibrationData_t *data);
+
+/**
+ * @brief Restore calibration registers saved by ADC_SaveCalibration()
+ * 
+ * Replaces the 1-2 ms calibration at boot by a few register writes.
+ * 
+ * @param[in] instance ADC instance (ADC0 or ADC1)
+ * @param[in] data     Saved calibration data
+ * @return ADC_Status_t Status of the operation
+ * @retval ADC_STATUS_ERROR Bad magic / checksum (e.g. erased flash) or CFG1
+ *                          differs from the one used for calibration; run
+ *                          ADC_StartCalibration() instead
+ * 
+ * @par Example:
+ * @code
+ * extern const ADC_CalibrationData_t g_adcCal;   // placed in flash
+ * 
+ * if (ADC_RestoreCalibration(ADC_INSTANCE_0, &g_adcCal) != ADC_STATUS_SUCCESS) {
+ *     ADC_StartCalibration(ADC_INSTANCE_0, OnCalDone, NULL);   // save in OnCalDone
+ * }
+ * @endcode
+ */
+ADC_Status_t ADC_RestoreCalibration(ADC_Instance_t instance, const ADC_CalibrationData_t *data);
+
 /**
  * @brief Configure hardware averaging for ADC
  * 
@@ -231,6 +431,44 @@ ADC_Status_t ADC_Calibrate(ADC_Instance_t instance);
  */
 ADC_Status_t ADC_ConfigureAveraging(ADC_Instance_t instance, const ADC_AverageConfig_t *avgConfig);
 
+/**
+ * @brief Configure the hardware compare function
+ * 
+ * With the compare function enabled, a conversion whose result does not match
+ * is discarded: COCO stays clear, R[n] is not updated and no interrupt or DMA
+ * request is raised. Combined with continuous mode (or a hardware trigger),
+ * averaging and AIEN, a supply rail is monitored with zero CPU load until it
+ * leaves its window.
+ * 
+ * @param[in] instance ADC instance (ADC0 or ADC1)
+ * @param[in] compareConfig Pointer to compare configuration structure
+ * @return ADC_Status_t Status of the operation
+ * @retval ADC_STATUS_ERROR NULL config or threshold1 > threshold2 in a range mode
+ * 
+ * @note Thresholds are compared against the result in the configured
+ *       resolution (after averaging)
+ * 
+ * @par Example:
+ * @code
+ * // Interrupt only when the 5V rail (divided to ~2.5 V) leaves 2.3 V - 2.7 V
+ * ADC_CompareConfig_t cmp = {
+ *     .mode = ADC_COMPARE_OUTSIDE_RANGE,
+ *     .threshold1 = 1884U,   // 2.3 V at 12-bit, 5 V ref
+ *     .threshold2 = 2211U    // 2.7 V
+ * };
+ * ADC_ConfigureCompare(ADC_INSTANCE_0, &cmp);
+ * @endcode
+ */
+ADC_Status_t ADC_ConfigureCompare(ADC_Instance_t instance, const ADC_CompareConfig_t *compareConfig);
+
+/**
+ * @brief Disable the hardware compare function
+ * 
+ * @param[in] instance ADC instance (ADC0 or ADC1)
+ * @return ADC_Status_t Status of the operation
+ */
+ADC_Status_t ADC_DisableCompare(ADC_Instance_t instance);
+
 /**
  * @brief Start ADC conversion on specified channel
  * 
@@ -322,7 +560,7 @@ ADC_Status_t ADC_WaitForConversion(ADC_Instance_t instance, uint32_t timeout);
  * }
  * @endcode
  */
-uint16_t ADC_GetResult(ADC_Instance_t instance);
+HAL_RAMFUNC uint16_t ADC_GetResult(ADC_Instance_t instance);
 
 /**
  * @brief Perform blocking ADC conversion
@@ -363,15 +601,86 @@ ADC_Status_t ADC_ReadBlocking(ADC_Instance_t instance, ADC_Channel_t channel, ui
  */
 uint32_t ADC_ConvertToVoltage(uint16_t adcValue, ADC_Resolution_t resolution, uint32_t vrefMillivolts);
 
+/**
+ * @brief Compute the result-to-millivolt scale factor from a bandgap result
+ * 
+ * The bandgap is a fixed ADC_BANDGAP_MV, so its result measures the actual
+ * VREFH: mV = adcValue * ADC_BANDGAP_MV / bandgapResult. The quotient is
+ * computed once here, conversions with ADC_ApplyVrefScale() are a single
+ * multiply and shift.
+ * 
+ * @param[in] bandgapResult Result of ADC_CHANNEL_BANDGAP at the same resolution
+ *                          as the results it will scale
+ * @return uint32_t Scale factor (mV per LSB, ADC_VREF_SCALE_SHIFT fraction bits),
+ *         0 if bandgapResult is 0
+ * 
+ * @par Example:
+ * @code
+ * uint16_t bg;
+ * ADC_ReadBlocking(ADC_INSTANCE_0, ADC_CHANNEL_BANDGAP, &bg);
+ * uint32_t scale = ADC_ComputeVrefScale(bg);              // cache, refresh periodically
+ * uint32_t mv = ADC_ApplyVrefScale(ADC_GetResult(ADC_INSTANCE_0), scale);
+ * @endcode
+ */
+uint32_t ADC_ComputeVrefScale(uint16_t bandgapResult);
+
+/**
+ * @brief Fixed-point scale factor for a known reference voltage
+ * @param[in] vrefMillivolts VREFH in millivolts
+ * @param[in] resolution     ADC resolution mode
+ * @return uint32_t Scale factor for ADC_ApplyVrefScale()
+ */
+uint32_t ADC_ComputeNominalScale(uint32_t vrefMillivolts, ADC_Resolution_t resolution);
+
+/**
+ * @brief Actual VREFH measured through the bandgap
+ * @param[in] scale      Scale factor from ADC_ComputeVrefScale()
+ * @param[in] resolution ADC resolution mode of the bandgap result
+ * @return uint32_t VREFH in millivolts
+ */
+uint32_t ADC_GetVrefFromScale(uint32_t scale, ADC_Resolution_t resolution);
+
+/**
+ * @brief Convert a result to millivolts with a precomputed scale factor
+ * @param[in] adcValue Conversion result
+ * @param[in] scale    Scale factor from ADC_ComputeVrefScale() / ADC_ComputeNominalScale()
+ * @return uint32_t Voltage in millivolts
+ */
+static inline uint32_t ADC_ApplyVrefScale(uint32_t adcValue, uint32_t scale)
+{
+    /* UMULL + shift, 64-bit product: oversampled 16-bit results do not overflow */
+    return (uint32_t)(((uint64_t)adcValue * scale) >> ADC_VREF_SCALE_SHIFT);
+}
+
+/**
+ * @brief Convert a temperature sensor result to temperature
+ * 
+ * T = 25 - (Vtemp - ADC_TEMP_SENSOR_V25_UV) / ADC_TEMP_SENSOR_SLOPE_UV.
+ * 
+ * @param[in] tempResult Result of ADC_CHANNEL_TEMP_SENSOR
+ * @param[in] scale      Scale factor of the same resolution (ADC_ComputeVrefScale())
+ * @return int32_t Temperature in 0.1 degC
+ * 
+ * @note The typical V25 / slope give a few degC accuracy, override
+ *       ADC_TEMP_SENSOR_V25_UV / ADC_TEMP_SENSOR_SLOPE_UV with a one-point
+ *       calibration when needed
+ */
+int32_t ADC_ConvertToTemperature(uint16_t tempResult, uint32_t scale);
+
 /**
  * @brief Enable ADC peripheral clock
  * 
- * This function enables the clock for the specified ADC peripheral.
+ * This function takes a reference on the ADC peripheral clock
+ * (PCC_AcquirePeripheralClock()). ADC_ReadBlocking() holds its own
+ * reference during the conversion, so an application that calls
+ * ADC_DisableClock() after configuration only clocks the ADC during bursts.
  * 
  * @param[in] instance ADC instance (ADC0 or ADC1)
  * @return ADC_Status_t Status of the operation
  * 
  * @note This must be called before ADC_Init()
+ * @note Continuous, hardware-triggered and DMA conversions need the
+ *       application reference for as long as they run
  * 
  * @par Example:
  * @code
@@ -383,7 +692,8 @@ ADC_Status_t ADC_EnableClock(ADC_Instance_t instance);
 /**
  * @brief Disable ADC peripheral clock
  * 
- * This function disables the clock for the specified ADC peripheral.
+ * This function drops the reference taken by ADC_EnableClock(); the clock
+ * is gated when no other reference is held.
  * 
  * @param[in] instance ADC instance (ADC0 or ADC1)
  * @return ADC_Status_t Status of the operation
@@ -418,6 +728,73 @@ ADC_Status_t ADC_DisableClock(ADC_Instance_t instance);
  */
 ADC_Status_t ADC_RegisterCallback(ADC_Instance_t instance, ADC_Callback_t callback);
 
+/*******************************************************************************
+ * DMA Streaming Functions
+ ******************************************************************************/
+
+/**
+ * @brief Start streaming ADC results into a ping-pong buffer via eDMA
+ * 
+ * Every COCO raises a DMA request (SC2[DMAEN]) and the channel copies R[0]
+ * into buffer. The buffer is used as two halves of samplesPerHalf samples:
+ * the channel interrupts at half and full major loop and wraps back to the
+ * start, so the CPU is interrupted once per block instead of once per sample.
+ * 
+ * @param[in] instance       ADC instance (ADC0 or ADC1)
+ * @param[in] dmaChannel     DMA channel (0-15), DMA_Init() must have been called
+ * @param[in] buffer         Sample buffer of 2 * samplesPerHalf entries
+ * @param[in] samplesPerHalf Samples per block (1 - ADC_DMA_STREAM_MAX_HALF)
+ * @param[in] callback       Block callback (called from DMA ISR), may be NULL
+ * @param[in] userData       User data passed to callback
+ * @return ADC_Status_t Status of the operation
+ * @retval ADC_STATUS_BUSY  Stream already running on this instance
+ * @retval ADC_STATUS_ERROR Invalid parameter, AIEN set or DMA setup failed
+ * 
+ * @note
+ * - Conversions come from SC1[0]: continuous mode + ADC_StartConversion(),
+ *   or a hardware trigger (LPIT / PDB) configured before or after this call
+ * - ADC_Config_t.interruptEnable must be false, the ADC ISR reading R[0]
+ *   would clear COCO before the DMA request is served
+ * - Enable the DMA channel IRQ in NVIC and call DMA_IRQHandler() from it
+ * 
+ * @par Example:
+ * @code
+ * static uint16_t s_samples[2U * 256U];
+ * 
+ * void OnBlock(ADC_Instance_t instance, const uint16_t *block, uint16_t count, void *userData) {
+ *     // Process count samples, the other half is being filled
+ * }
+ * 
+ * ADC_StartDmaStream(ADC_INSTANCE_0, 0U, s_samples, 256U, OnBlock, NULL);
+ * ADC_StartConversion(ADC_INSTANCE_0, ADC_CHANNEL_AD4);  // continuousMode = true
+ * @endcode
+ */
+ADC_Status_t ADC_StartDmaStream(ADC_Instance_t instance, uint8_t dmaChannel,
+                                uint16_t *buffer, uint16_t samplesPerHalf,
+                                ADC_DmaCallback_t callback, void *userData);
+
+/**
+ * @brief Stop DMA streaming
+ * 
+ * Clears SC2[DMAEN], stops the DMA channel and removes its callback. The ADC
+ * keeps converting if it is in continuous / hardware trigger mode.
+ * 
+ * @param[in] instance ADC instance (ADC0 or ADC1)
+ * @return ADC_Status_t Status of the operation
+ */
+ADC_Status_t ADC_StopDmaStream(ADC_Instance_t instance);
+
+/**
+ * @brief Get number of blocks lost since ADC_StartDmaStream()
+ * 
+ * A block is lost when the DMA interrupt is serviced so late that both
+ * halves completed since the previous callback.
+ * 
+ * @param[in] instance ADC instance (ADC0 or ADC1)
+ * @return uint32_t Overrun count (0 for invalid instance)
+ */
+uint32_t ADC_GetDmaStreamOverruns(ADC_Instance_t instance);
+
 /*******************************************************************************
  * Hardware Trigger Functions (LPIT Trigger)
  ******************************************************************************/
@@ -644,6 +1021,163 @@ uint16_t ADC_GetPDBCounter(ADC_Instance_t instance);
  */
 ADC_Status_t ADC_TriggerPDBSoftware(ADC_Instance_t instance);
 
+/*******************************************************************************
+ * PDB Scan Group Functions
+ ******************************************************************************/
+
+/**
+ * @brief Configure a back-to-back scan group on ADC0 and / or ADC1
+ * 
+ * Programs up to 16 SC1 slots per ADC, enables hardware trigger and builds a
+ * PDB pre-trigger chain in back-to-back mode so a single PDB trigger walks all
+ * slots without CPU intervention. Both PDBs get identical timing, so with a
+ * shared trigger the two ADCs sample slot n at the same instant.
+ * 
+ * @param[in] config Scan group configuration
+ * @return ADC_Status_t Status of the operation
+ * @retval ADC_STATUS_ERROR Invalid configuration (no slots, > 16 slots, NULL channels)
+ * 
+ * @note
+ * - ADC_Init() and ADC_Calibrate() must be done first for every instance used
+ * - With PDB_TRIGGER_TRGMUX route one TRGMUX event to both PDBs for exact
+ *   phase alignment; ADC_StartScanGroup() triggers both PDBs by software
+ *   within a few bus cycles
+ * - Results stay in R[0..n-1] until the next scan, read them with
+ *   ADC_ReadScanGroup()
+ * 
+ * @par Example:
+ * @code
+ * static const ADC_Channel_t phases0[] = {ADC_CHANNEL_AD0, ADC_CHANNEL_AD1, ADC_CHANNEL_AD2};
+ * static const ADC_Channel_t phases1[] = {ADC_CHANNEL_AD3, ADC_CHANNEL_AD4, ADC_CHANNEL_AD5};
+ * ADC_ScanGroupConfig_t group = {
+ *     .channels = {phases0, phases1},
+ *     .numChannels = {3U, 3U},
+ *     .prescaler = PDB_PRESCALER_1,
+ *     .multFactor = PDB_MULT_1,
+ *     .modulus = 0xFFFFU,
+ *     .delay = 0U,
+ *     .triggerSource = PDB_TRIGGER_SOFTWARE,
+ *     .continuousMode = false
+ * };
+ * ADC_ConfigScanGroup(&group);
+ * ADC_StartScanGroup();
+ * while (!ADC_IsScanGroupComplete(ADC_INSTANCE_1)) {}
+ * @endcode
+ */
+ADC_Status_t ADC_ConfigScanGroup(const ADC_ScanGroupConfig_t *config);
+
+/**
+ * @brief Software-trigger the scan group on every configured instance
+ * @return ADC_Status_t ADC_STATUS_ERROR if no scan group is configured
+ */
+ADC_Status_t ADC_StartScanGroup(void);
+
+/**
+ * @brief Stop the scan group: disable PDBs, clear hardware trigger and slots
+ * @return ADC_Status_t Status of the operation
+ */
+ADC_Status_t ADC_StopScanGroup(void);
+
+/**
+ * @brief Check whether the last slot of the scan group has converted
+ * @param[in] instance ADC instance (ADC0 or ADC1)
+ * @return bool true when the last slot's COCO is set
+ */
+bool ADC_IsScanGroupComplete(ADC_Instance_t instance);
+
+/**
+ * @brief Read scan group results in slot order
+ * @param[in]  instance ADC instance (ADC0 or ADC1)
+ * @param[out] results  Buffer of at least numChannels[instance] entries
+ * @param[in]  count    Number of results to read (<= configured slots)
+ * @return ADC_Status_t Status of the operation
+ */
+ADC_Status_t ADC_ReadScanGroup(ADC_Instance_t instance, uint16_t *results, uint8_t count);
+
+/**
+ * @brief Collect every scan group frame into a ping-pong frame buffer via eDMA
+ * 
+ * Each slot's COCO raises an ADC DMA request; the channel reads R[0..n-1] in
+ * slot order and writes one frame (n results) per major loop. Two RAM TCDs
+ * linked by scatter/gather alternate between frame 0 and frame 1, so the CPU
+ * gets one interrupt per scan and reads a frame while the next one is written.
+ * 
+ * @param[in] instance   ADC instance with a configured scan group
+ * @param[in] dmaChannel DMA channel (0-15)
+ * @param[in] frames     Buffer of 2 * numChannels[instance] entries,
+ *                       frames[slot] / frames[n + slot]
+ * @param[in] callback   Frame callback (block = frame, count = n), may be NULL
+ * @param[in] userData   User data passed to callback
+ * @return ADC_Status_t Status of the operation
+ * @retval ADC_STATUS_BUSY  DMA stream or dual-ADC sampling already running
+ * @retval ADC_STATUS_ERROR No scan group on instance, AIEN set or DMA setup failed
+ * 
+ * @note
+ * - Call after ADC_ConfigScanGroup() and before ADC_StartScanGroup()
+ * - Stop with ADC_StopDmaStream(), lost frames are counted by
+ *   ADC_GetDmaStreamOverruns()
+ */
+ADC_Status_t ADC_StartScanGroupDma(ADC_Instance_t instance, uint8_t dmaChannel, uint16_t *frames,
+                                   ADC_DmaCallback_t callback, void *userData);
+
+/*******************************************************************************
+ * Dual-ADC Synchronous Sampling Functions
+ ******************************************************************************/
+
+/**
+ * @brief Start synchronous dual-ADC sampling into an interleaved buffer
+ * 
+ * Builds a one-slot scan group on each ADC with PDB_TRIGGER_TRGMUX, routes
+ * triggerSource to both PDBs through TRGMUX and streams R[0] of each ADC into
+ * alternate entries of buffer. The callback runs once per block of
+ * pairsPerHalf pairs with instance = ADC_INSTANCE_0.
+ * 
+ * @param[in] config Dual sampling configuration
+ * @return ADC_Status_t Status of the operation
+ * @retval ADC_STATUS_BUSY  Dual mode or a DMA stream already running
+ * @retval ADC_STATUS_ERROR Invalid parameter, TRGMUX locked or DMA setup failed
+ * 
+ * @note
+ * - ADC_Init() (interruptEnable = false) and ADC_Calibrate() on both ADCs first
+ * - The trigger source (e.g. LPIT channel) is started separately and sets the
+ *   sample rate
+ * - Enable the dmaChannel1 IRQ in NVIC and call DMA_IRQHandler() from it
+ * 
+ * @par Example:
+ * @code
+ * static uint16_t s_vi[4U * 128U];
+ * 
+ * void OnPairs(ADC_Instance_t instance, const uint16_t *block, uint16_t count, void *userData) {
+ *     for (uint16_t i = 0U; i < count; i++) {
+ *         power += (int32_t)block[2U * i] * (int32_t)block[(2U * i) + 1U];
+ *     }
+ * }
+ * 
+ * ADC_DualSyncConfig_t sync = {
+ *     .channel0 = ADC_CHANNEL_AD4, .channel1 = ADC_CHANNEL_AD5,
+ *     .triggerSource = TRGMUX_SRC_LPIT_CH0, .delay = 0U,
+ *     .dmaChannel0 = 0U, .dmaChannel1 = 1U,
+ *     .buffer = s_vi, .pairsPerHalf = 128U,
+ *     .callback = OnPairs, .userData = NULL
+ * };
+ * ADC_StartDualSync(&sync);
+ * LPIT_StartChannel(0U);
+ * @endcode
+ */
+ADC_Status_t ADC_StartDualSync(const ADC_DualSyncConfig_t *config);
+
+/**
+ * @brief Stop synchronous dual-ADC sampling
+ * @return ADC_Status_t Status of the operation
+ */
+ADC_Status_t ADC_StopDualSync(void);
+
+/**
+ * @brief Get number of blocks lost in dual-ADC mode
+ * @return uint32_t Overrun count
+ */
+uint32_t ADC_GetDualSyncOverruns(void);
+
 /** @} */
 
 #endif /* ADC_H */
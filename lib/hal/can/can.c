@@ -13,6 +13,10 @@
  ******************************************************************************/
 #include "can.h"
 #include "pcc.h"
+#include "clock_manager.h"
+#include "nvic.h"
+#include "dma_reg.h"
+#include "osal.h"
 #include <stddef.h>
 #include <string.h>
 
@@ -24,6 +28,90 @@
  * Private Definitions
  ******************************************************************************/
 
+/** @brief IFLAG1/IMASK1 bits used by RX FIFO (frame available, warning, overflow) */
+#define CAN_RX_FIFO_FLAGS_MASK  (CAN_IFLAG1_BUF5I_MASK | CAN_IFLAG1_BUF6I_MASK | CAN_IFLAG1_BUF7I_MASK)
+
+/** @brief Message Buffers occupied by RX FIFO engine and filter table (MB0-MB7) */
+#define CAN_RX_FIFO_MB_MASK     (0x000000FFU)
+
+/** @brief IFLAG1 bits served by each ORed MB interrupt vector */
+#define CAN_IRQ_MB0_15_MASK     (0x0000FFFFUL)
+#define CAN_IRQ_MB16_31_MASK    (0xFFFF0000UL)
+#define CAN_IRQ_MB_ALL_MASK     (0xFFFFFFFFUL)
+
+/**
+ * @brief TX queue entry
+ * @details key is the MB ID word (PRIO + ID), so ascending key follows the
+ *          internal arbitration order (lowest value transmitted first).
+ */
+typedef struct {
+    uint32_t key;               /**< Arbitration value written to MB ID word */
+    can_message_t message;      /**< Queued message */
+} can_tx_queue_entry_t;
+
+/**
+ * @brief Bit timing search limits for one phase (nominal or FD data)
+ * @details Segment values are in time quanta (not register encoding)
+ */
+typedef struct {
+    uint32_t tqMin;             /**< Minimum time quanta per bit */
+    uint32_t tqMax;             /**< Maximum time quanta per bit */
+    uint32_t propMin;           /**< Minimum propagation segment */
+    uint32_t propMax;           /**< Maximum propagation segment */
+    uint32_t seg1Max;           /**< Maximum phase segment 1 */
+    uint32_t seg2Max;           /**< Maximum phase segment 2 */
+    uint32_t rjwMax;            /**< Maximum resynchronization jump width */
+    uint32_t samplePoint;       /**< Target sample point in percent */
+} can_phase_limits_t;
+
+/** @brief Bit timing result for one phase, values in time quanta */
+typedef struct {
+    uint32_t preDiv;            /**< Prescaler (1-1024) */
+    uint32_t propSeg;           /**< Propagation segment */
+    uint32_t phaseSeg1;         /**< Phase segment 1 */
+    uint32_t phaseSeg2;         /**< Phase segment 2 */
+    uint32_t rJumpWidth;        /**< Resynchronization jump width */
+} can_phase_timing_t;
+
+/**
+ * @brief TX / RX callbacks of one message buffer
+ * @details One record per MB so the MB interrupt reads callback and user
+ *          data from the same 16 bytes; TX first, it is tested first.
+ */
+typedef struct {
+    can_callback_t txCallback;  /**< TX complete callback */
+    void *txUserData;           /**< TX callback user data */
+    can_callback_t rxCallback;  /**< RX callback */
+    void *rxUserData;           /**< RX callback user data */
+} can_mb_callback_t;
+
+/** @brief Message buffers of the instances enabled in hal_config.h (CAN0 32, CAN1 / CAN2 16) */
+#define CAN_MB_TOTAL_COUNT          ((32U * HAL_CAN0_ENABLE) + (16U * HAL_CAN1_ENABLE) + (16U * HAL_CAN2_ENABLE))
+
+/** @brief Maximum prescaler of CBT[EPRESDIV] and FDCBT[FPRESDIV] */
+#define CAN_FD_PRESDIV_MAX      (1024U)
+
+/** @brief Message Buffer RAM size in 32-bit words */
+#define CAN_MB_RAM_WORDS        (128U)
+
+/**
+ * @name Statistics hooks
+ * @brief Expand to nothing when CAN_STATISTICS_ENABLE is 0
+ * @{
+ */
+#if CAN_STATISTICS_ENABLE
+#define CAN_STATS_TX(inst, mb, msg)         CAN_StatsOnFrame((inst), (mb), (msg)->idType, (msg)->dataLength, true)
+#define CAN_STATS_RX(inst, mb, msg)         CAN_StatsOnFrame((inst), (mb), (msg)->idType, (msg)->dataLength, false)
+#define CAN_STATS_RX_OVERRUN(inst)          (s_canStats[(inst)].rxOverruns++)
+#define CAN_STATS_ESR1(inst, esr1)          CAN_StatsOnEsr1((inst), (esr1))
+#else
+#define CAN_STATS_TX(inst, mb, msg)         ((void)0)
+#define CAN_STATS_RX(inst, mb, msg)         ((void)0)
+#define CAN_STATS_RX_OVERRUN(inst)          ((void)0)
+#define CAN_STATS_ESR1(inst, esr1)          ((void)0)
+#endif
+/** @} */
+
 /** @brief Timeout for entering/exiting freeze mode */
 #define CAN_FREEZE_TIMEOUT      (10000U)
 
@@ -49,17 +137,38 @@ static bool s_canInitialized[CAN_INSTANCE_COUNT] = {false, false, false};
 /** @brief CAN clock frequency for each instance */
 static uint32_t s_canClockFreq[CAN_INSTANCE_COUNT] = {0U, 0U, 0U};
 
-/** @brief TX callback array */
-static can_callback_t s_txCallbacks[CAN_INSTANCE_COUNT][CAN_MB_COUNT];
+/** @brief Nominal baudrate for each instance (timer tick rate) */
+static uint32_t s_canBaudRate[CAN_INSTANCE_COUNT] = {0U, 0U, 0U};
+
+/** @brief Clock source of each instance (re-read after clock changes) */
+static can_clk_src_t s_canClockSource[CAN_INSTANCE_COUNT];
+
+/** @brief FD data phase bitrate, 0 = no bit rate switch */
+static uint32_t s_canFdDataRate[CAN_INSTANCE_COUNT];
+
+/** @brief Held in freeze mode by the clock notifier */
+static bool s_canClockFrozen[CAN_INSTANCE_COUNT];
+
+/** @brief Time source for extended RX timestamps */
+static can_time_source_t s_timeSource = NULL;
+
+/** @brief Message buffers implemented per instance (CAN0 32, CAN1 / CAN2 16, 0 = compiled out) */
+static const uint8_t s_canMbCount[CAN_INSTANCE_COUNT] = {
+    32U * HAL_CAN0_ENABLE, 16U * HAL_CAN1_ENABLE, 16U * HAL_CAN2_ENABLE
+};
 
-/** @brief RX callback array */
-static can_callback_t s_rxCallbacks[CAN_INSTANCE_COUNT][CAN_MB_COUNT];
+/** @brief Message Buffers enabled by MCR[MAXMB] (set by CAN_Init()) */
+static uint8_t s_canActiveMbCount[CAN_INSTANCE_COUNT] = {
+    32U * HAL_CAN0_ENABLE, 16U * HAL_CAN1_ENABLE, 16U * HAL_CAN2_ENABLE
+};
 
-/** @brief TX user data array */
-static void *s_txUserData[CAN_INSTANCE_COUNT][CAN_MB_COUNT];
+/** @brief First entry of each instance in s_mbCallbacks */
+static const uint8_t s_canMbCallbackBase[CAN_INSTANCE_COUNT] = {
+    0U, 32U * HAL_CAN0_ENABLE, (32U * HAL_CAN0_ENABLE) + (16U * HAL_CAN1_ENABLE)
+};
 
-/** @brief RX user data array */
-static void *s_rxUserData[CAN_INSTANCE_COUNT][CAN_MB_COUNT];
+/** @brief MB callbacks, sized by implemented MBs instead of CAN_MB_COUNT per instance */
+static can_mb_callback_t s_mbCallbacks[CAN_MB_TOTAL_COUNT];
 
 /** @brief Error callback array */
 static can_error_callback_t s_errorCallbacks[CAN_INSTANCE_COUNT];
@@ -67,6 +176,102 @@ static can_error_callback_t s_errorCallbacks[CAN_INSTANCE_COUNT];
 /** @brief Error callback user data */
 static void *s_errorUserData[CAN_INSTANCE_COUNT];
 
+/** @brief RX FIFO enabled flag */
+static bool s_canRxFifoEnabled[CAN_INSTANCE_COUNT] = {false, false, false};
+
+/** @brief RX FIFO callback array */
+static can_callback_t s_rxFifoCallbacks[CAN_INSTANCE_COUNT];
+
+/** @brief RX FIFO callback user data */
+static void *s_rxFifoUserData[CAN_INSTANCE_COUNT];
+
+/** @brief RX FIFO DMA capture running (MCR[DMA] = 1) */
+static bool s_canRxDmaEnabled[CAN_INSTANCE_COUNT] = {false, false, false};
+
+/** @brief RX FIFO DMA ring buffer, size, read index and eDMA channel */
+static can_rx_dma_entry_t *s_canRxDmaBuffer[CAN_INSTANCE_COUNT];
+static uint16_t s_canRxDmaCount[CAN_INSTANCE_COUNT];
+static uint16_t s_canRxDmaRead[CAN_INSTANCE_COUNT];
+static uint8_t s_canRxDmaChannel[CAN_INSTANCE_COUNT];
+
+/** @brief RX FIFO DMA ring overruns */
+static uint32_t s_canRxDmaOverruns[CAN_INSTANCE_COUNT];
+
+/** @brief Pretended Networking wakeup callbacks */
+static can_wakeup_callback_t s_wakeupCallbacks[CAN_INSTANCE_COUNT];
+
+/** @brief User data for wakeup callbacks */
+static void *s_wakeupUserData[CAN_INSTANCE_COUNT];
+
+/** @brief CAN FD enabled flag */
+static bool s_canFdEnabled[CAN_INSTANCE_COUNT] = {false, false, false};
+
+/** @brief CAN FD Message Buffer payload size */
+static can_fd_payload_size_t s_canFdPayload[CAN_INSTANCE_COUNT];
+
+/** @brief DLC to payload length mapping (ISO 11898-1) */
+static const uint8_t s_canDlcToLength[16] = {
+    0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 12U, 16U, 20U, 24U, 32U, 48U, 64U
+};
+
+/** @brief Nominal phase limits (CBT register) */
+static const can_phase_limits_t s_canNominalLimits = {
+    .tqMin = 8U, .tqMax = 129U, .propMin = 1U, .propMax = 64U,
+    .seg1Max = 32U, .seg2Max = 32U, .rjwMax = 32U, .samplePoint = 80U
+};
+
+/** @brief FD data phase limits (FDCBT register) */
+static const can_phase_limits_t s_canDataLimits = {
+    .tqMin = 5U, .tqMax = 48U, .propMin = 0U, .propMax = 31U,
+    .seg1Max = 8U, .seg2Max = 8U, .rjwMax = 8U, .samplePoint = 75U
+};
+
+#if CAN_STATISTICS_ENABLE
+/** @brief Driver statistics */
+static can_statistics_t s_canStats[CAN_INSTANCE_COUNT];
+
+/** @brief Bus load buckets (bits per bucket) */
+static uint32_t s_busLoadBits[CAN_INSTANCE_COUNT][CAN_STATS_BUSLOAD_BUCKETS];
+
+/** @brief Absolute index of the current bus load bucket */
+static uint32_t s_busLoadBucket[CAN_INSTANCE_COUNT];
+
+/** @brief Last error state seen, for transition counting */
+static can_error_state_t s_lastErrorState[CAN_INSTANCE_COUNT];
+#endif /* CAN_STATISTICS_ENABLE */
+
+/** @brief TX queue storage, sorted by descending key (next frame at the end) */
+static can_tx_queue_entry_t s_txQueue[CAN_INSTANCE_COUNT][CAN_TX_QUEUE_SIZE] FAST_DATA_SRAM_L;
+
+/** @brief Number of frames in TX queue */
+static volatile uint8_t s_txQueueCount[CAN_INSTANCE_COUNT];
+
+/** @brief Message Buffers owned by TX queue (bit n = MBn, 0 = queue not configured) */
+static uint32_t s_txQueuePoolMask[CAN_INSTANCE_COUNT];
+
+/** @brief Pool Message Buffers currently loaded with a frame */
+static volatile uint32_t s_txQueueBusyMask[CAN_INSTANCE_COUNT];
+
+/** @brief Local priority enabled flag */
+static bool s_txQueueLocalPrio[CAN_INSTANCE_COUNT];
+
+/** @brief Bus-off recovery mode */
+static can_busoff_recovery_t s_busOffRecovery[CAN_INSTANCE_COUNT];
+
+/** @brief TX queue policy on bus-off */
+static can_busoff_tx_policy_t s_busOffTxPolicy[CAN_INSTANCE_COUNT];
+
+#if OSAL_FREERTOS
+/** @brief Task sleeping in CAN_SendBlocking() / CAN_ReceiveBlocking() per MB */
+static osal_event_t s_canMbEvent[CAN_INSTANCE_COUNT][CAN_MB_COUNT];
+
+/** @brief MBs with a sleeping task: the ISR signals and leaves IFLAG1 set */
+static volatile uint32_t s_canOsalWaitMask[CAN_INSTANCE_COUNT];
+
+/** @brief IMASK1 bits that were already set before a blocking wait */
+static uint32_t s_canOsalImask[CAN_INSTANCE_COUNT];
+#endif
+
 /*******************************************************************************
  * Private Function Prototypes
  ******************************************************************************/
@@ -75,10 +280,39 @@ static status_t CAN_EnterFreezeMode(CAN_Type *base);
 static status_t CAN_ExitFreezeMode(CAN_Type *base);
 static status_t CAN_SoftReset(CAN_Type *base);
 static void CAN_EnableClock(uint8_t instance, can_clk_src_t clockSource);
-static void CAN_InitMessageBuffers(CAN_Type *base);
+static void CAN_InitMessageBuffers(CAN_Type *base, uint8_t mbCount);
 static uint32_t CAN_GetClockFrequency(can_clk_src_t clockSource);
 static status_t CAN_ConfigTxMailbox(uint8_t instance, uint8_t mbIndex);
 static status_t CAN_ConfigRxMailbox(uint8_t instance, uint8_t mbIndex, uint32_t id, can_id_type_t idType, uint32_t mask);
+static void CAN_ReadFrame(uint8_t instance, uint8_t mbIndex, can_message_t *message);
+HAL_RAMFUNC static void CAN_WriteTxFrame(CAN_Type *base, uint8_t mbIndex, const can_message_t *message, uint32_t idWord);
+HAL_RAMFUNC static void CAN_TxQueueLoad(uint8_t instance);
+static status_t CAN_CalcPhaseTiming(uint32_t canClockHz, uint32_t bitRate,
+                                    const can_phase_limits_t *limits, can_phase_timing_t *timing);
+static uint32_t CAN_GetFdMbOffset(uint8_t instance, uint8_t mbIndex);
+static status_t CAN_CalcFdTiming(uint32_t canClockHz, uint32_t nominalRate, uint32_t dataRate,
+                                 can_phase_timing_t *nominal, can_phase_timing_t *data);
+static uint32_t CAN_WriteFdTiming(CAN_Type *base, const can_phase_timing_t *nominal,
+                                  const can_phase_timing_t *data, bool enableBrs);
+static void CAN_ClockNotifier(clock_notify_event_t event, void *userData);
+#if CAN_STATISTICS_ENABLE
+static void CAN_StatsOnFrame(uint8_t instance, uint8_t mbIndex, can_id_type_t idType,
+                             uint8_t dataLength, bool isTx);
+static void CAN_StatsOnEsr1(uint8_t instance, uint32_t esr1);
+static void CAN_StatsAdvanceBuckets(uint8_t instance);
+#endif
+static uint32_t CAN_EncodeFifoFilter(uint32_t value, can_id_type_t idType);
+static uint32_t CAN_TimestampToUs(uint8_t instance, uint16_t timeStamp);
+static void CAN_RxDmaArm(uint8_t instance);
+static uint16_t CAN_RxDmaWriteIndex(uint8_t instance, uint32_t *cs);
+static void CAN_RxDmaResync(uint8_t instance);
+static void CAN_RxDmaRelease(uint8_t instance);
+static uint32_t CAN_EncodeMbMask(uint32_t mask, can_id_type_t idType);
+HAL_RAMFUNC static void CAN_DispatchMbIrq(uint8_t instance, uint32_t groupMask);
+#if OSAL_FREERTOS
+static bool CAN_OsalWaitMb(uint8_t instance, uint8_t mbIndex, uint32_t timeoutMs);
+static void CAN_OsalEndWait(uint8_t instance, uint8_t mbIndex);
+#endif
 
 /*******************************************************************************
  * Public Functions
@@ -93,6 +327,7 @@ status_t CAN_Init(const can_config_t *config)
     status_t status;
     can_timing_config_t timing;
     uint32_t canClockHz;
+    uint8_t mbCount;
     
     /* Validate parameters */
     if (config == NULL) {
@@ -103,6 +338,13 @@ status_t CAN_Init(const can_config_t *config)
         return STATUS_INVALID_PARAM;
     }
     
+    /* RX FIFO engine and filter table occupy MB0-7, MAXMB must lie above them */
+    mbCount = (config->activeMbCount != 0U) ? config->activeMbCount : s_canMbCount[config->instance];
+    if ((mbCount == 0U) || (mbCount > s_canMbCount[config->instance]) ||
+        (config->useRxFifo && (mbCount <= CAN_TX_MB_START))) {
+        return STATUS_INVALID_PARAM;
+    }
+    
     base = s_canBases[config->instance];
     
     /* Enable CAN clock */
@@ -111,6 +353,9 @@ status_t CAN_Init(const can_config_t *config)
     /* Get CAN clock frequency */
     canClockHz = CAN_GetClockFrequency(config->clockSource);
     s_canClockFreq[config->instance] = canClockHz;
+    s_canBaudRate[config->instance] = config->baudRate;
+    s_canClockSource[config->instance] = config->clockSource;
+    s_canClockFrozen[config->instance] = false;
     
     /* Enter freeze mode for configuration */
     status = CAN_EnterFreezeMode(base);
@@ -156,17 +401,20 @@ status_t CAN_Init(const can_config_t *config)
     } else {
         base->MCR &= ~CAN_MCR_RFEN_MASK;
     }
+    s_canRxFifoEnabled[config->instance] = config->useRxFifo;
+    CAN_RxDmaRelease(config->instance);   /* MCR[DMA] cleared by the soft reset */
     
-    /* Set maximum number of MBs */
-    base->MCR = (base->MCR & ~CAN_MCR_MAXMB_MASK) | 
-                ((CAN_MB_COUNT - 1U) << CAN_MCR_MAXMB_SHIFT);
+    /* Individual RX masking: each MB (and FIFO element 0-7) uses its own RXIMR */
+    base->MCR |= CAN_MCR_IRMQ_MASK;
     
-    /* Initialize all Message Buffers */
-    CAN_InitMessageBuffers(base);
+    /* Arbitration and matching scan MB0..MAXMB only */
+    base->MCR = (base->MCR & ~CAN_MCR_MAXMB_MASK) | CAN_MCR_MAXMB((uint32_t)mbCount - 1U);
+    s_canActiveMbCount[config->instance] = mbCount;
     
-    /* Initialize global mask to accept all messages */
-//    base->RXMGMASK = 0x00000000UL;
-
+    /* Initialize the active Message Buffers */
+    CAN_InitMessageBuffers(base, mbCount);
+    
+    /* Global mask, only used if individual masking is turned off */
     base->RXMGMASK = 0x1FFFFFFFUL;
     
     /* Clear error counters */
@@ -183,9 +431,20 @@ status_t CAN_Init(const can_config_t *config)
         return STATUS_ERROR;
     }
     
+    /* Soft reset cleared FDEN */
+    s_canFdEnabled[config->instance] = false;
+    s_canFdDataRate[config->instance] = 0U;
+    
+    /* Soft reset cleared BOFFREC: automatic recovery, no error interrupts */
+    s_busOffRecovery[config->instance] = CAN_BUSOFF_RECOVERY_AUTO;
+    s_busOffTxPolicy[config->instance] = CAN_BUSOFF_TX_RETAIN;
+    
     /* Mark as initialized */
     s_canInitialized[config->instance] = true;
     
+    /* Re-time the bit rate when the clock tree changes */
+    (void)ClockManager_RegisterNotifier(CAN_ClockNotifier, (void *)(uintptr_t)config->instance);
+    
     return STATUS_SUCCESS;
 }
 
@@ -203,6 +462,10 @@ status_t CAN_Deinit(uint8_t instance)
     
     base = s_canBases[instance];
     
+    ClockManager_UnregisterNotifier(CAN_ClockNotifier, (void *)(uintptr_t)instance);
+    
+    CAN_RxDmaRelease(instance);
+    
     /* Disable module */
     base->MCR |= CAN_MCR_MDIS_MASK;
     
@@ -221,11 +484,10 @@ status_t CAN_Deinit(uint8_t instance)
 status_t CAN_Send(uint8_t instance, uint8_t mbIndex, const can_message_t *message)
 {
     CAN_Type *base;
-    uint32_t mbOffset;
-    uint32_t cs, id;
+    uint32_t id;
     
     /* Validate parameters */
-    if (instance >= CAN_INSTANCE_COUNT || message == NULL) {
+    if (HAL_PARAM_INVALID(instance >= CAN_INSTANCE_COUNT || message == NULL)) {
         return STATUS_INVALID_PARAM;
     }
     
@@ -233,31 +495,17 @@ status_t CAN_Send(uint8_t instance, uint8_t mbIndex, const can_message_t *messag
         return STATUS_NOT_INITIALIZED;
     }
     
-    if (mbIndex < CAN_TX_MB_START ||
-        mbIndex >= (CAN_TX_MB_START + CAN_TX_MB_COUNT)) {
+    if (HAL_PARAM_INVALID(mbIndex < CAN_TX_MB_START ||
+                          mbIndex >= (CAN_TX_MB_START + CAN_TX_MB_COUNT) ||
+                          mbIndex >= s_canActiveMbCount[instance])) {
         return STATUS_INVALID_PARAM;
     }
     
-    if (message->dataLength > CAN_MAX_DATA_LENGTH) {
+    if (HAL_PARAM_INVALID(message->dataLength > CAN_MAX_DATA_LENGTH)) {
         return STATUS_INVALID_PARAM;
     }
     
     base = s_canBases[instance];
-    mbOffset = mbIndex * MSG_BUF_SIZE;
-    
-    /* Clear interrupt flag */
-    base->IFLAG1 = (1UL << mbIndex);
-    
-    /* Write data words */
-    base->RAMn[mbOffset + 2] = ((uint32_t)message->data[0] << 24) |
-                                ((uint32_t)message->data[1] << 16) |
-                                ((uint32_t)message->data[2] << 8) |
-                                ((uint32_t)message->data[3]);
-    
-    base->RAMn[mbOffset + 3] = ((uint32_t)message->data[4] << 24) |
-                                ((uint32_t)message->data[5] << 16) |
-                                ((uint32_t)message->data[6] << 8) |
-                                ((uint32_t)message->data[7]);
     
     /* Configure ID word */
     if (message->idType == CAN_ID_STD) {
@@ -265,25 +513,9 @@ status_t CAN_Send(uint8_t instance, uint8_t mbIndex, const can_message_t *messag
     } else {
         id = (message->id << CAN_ID_EXT_SHIFT) & CAN_ID_EXT_MASK;
     }
-    base->RAMn[mbOffset + 1] = id;
-    
-    /* Configure CS word and activate transmission */
-    cs = (CAN_CS_CODE_TX_DATA << CAN_CS_CODE_SHIFT) |
-         ((uint32_t)message->dataLength << CAN_WMBn_CS_DLC_SHIFT);
-    
-    if (message->idType == CAN_ID_EXT) {
-        cs |= CAN_WMBn_CS_IDE_MASK;
-    }
     
-    if (message->idType == CAN_ID_STD) {
-        cs |= CAN_WMBn_CS_SRR_MASK;  /* SRR=1 for standard ID transmission */
-    }
-    
-    if (message->frameType == CAN_FRAME_REMOTE) {
-        cs |= CAN_WMBn_CS_RTR_MASK;
-    }
-    
-    base->RAMn[mbOffset + 0] = cs;  /* Write CS to activate MB */
+    CAN_WriteTxFrame(base, mbIndex, message, id);
+    CAN_STATS_TX(instance, mbIndex, message);
     
     return STATUS_SUCCESS;
 }
@@ -308,6 +540,19 @@ status_t CAN_SendBlocking(uint8_t instance, uint8_t mbIndex,
     base = s_canBases[instance];
     mbMask = (1UL << mbIndex);
     
+#if OSAL_FREERTOS
+    /* Task context: sleep on the MB interrupt instead of polling */
+    if (OSAL_CanBlock()) {
+        if (CAN_OsalWaitMb(instance, mbIndex, timeoutMs)) {
+            base->IFLAG1 = mbMask;
+        } else {
+            status = STATUS_TIMEOUT;
+        }
+        CAN_OsalEndWait(instance, mbIndex);
+        return status;
+    }
+#endif
+    
     /* Wait for transmission complete */
     while (timeoutCount < (timeoutMs * 1000U)) {
         if (base->IFLAG1 & mbMask) {
@@ -327,14 +572,11 @@ status_t CAN_SendBlocking(uint8_t instance, uint8_t mbIndex,
 status_t CAN_Receive(uint8_t instance, uint8_t mbIndex, can_message_t *message)
 {
     CAN_Type *base;
-    uint32_t mbOffset;
-    uint32_t cs, id;
     uint32_t mbMask;
-    uint32_t data0, data1;
     uint32_t dummy;
     
     /* Validate parameters */
-    if (instance >= CAN_INSTANCE_COUNT || message == NULL) {
+    if (HAL_PARAM_INVALID(instance >= CAN_INSTANCE_COUNT || message == NULL)) {
         return STATUS_INVALID_PARAM;
     }
     
@@ -342,50 +584,26 @@ status_t CAN_Receive(uint8_t instance, uint8_t mbIndex, can_message_t *message)
         return STATUS_NOT_INITIALIZED;
     }
     
-    if (mbIndex < CAN_RX_MB_START || mbIndex >= CAN_MB_COUNT) {
+    if (HAL_PARAM_INVALID(mbIndex < CAN_RX_MB_START || mbIndex >= s_canActiveMbCount[instance])) {
         return STATUS_INVALID_PARAM;
     }
     
     base = s_canBases[instance];
     mbMask = (1UL << mbIndex);
-    mbOffset = mbIndex * MSG_BUF_SIZE;
     
     /* Check if message available */
     if ((base->IFLAG1 & mbMask) == 0U) {
         return STATUS_ERROR;
     }
     
-    /* Read CS word (locks the MB) */
-    cs = base->RAMn[mbOffset + 0];
-    
-    /* Read ID word */
-    id = base->RAMn[mbOffset + 1];
-    
-    /* Extract message information */
-    if (cs & CAN_WMBn_CS_IDE_MASK) {
-        message->idType = CAN_ID_EXT;
-        message->id = (id & CAN_ID_EXT_MASK) >> CAN_ID_EXT_SHIFT;
-    } else {
-        message->idType = CAN_ID_STD;
-        message->id = (id & CAN_ID_STD_MASK) >> CAN_ID_STD_SHIFT;
+    /* Read CS, ID and data words (reading CS locks the MB) */
+#if CAN_STATISTICS_ENABLE
+    if (((CAN_ReadMbCs(base, mbIndex) & CAN_CS_CODE_MASK) >> CAN_CS_CODE_SHIFT) == CAN_CS_CODE_RX_OVERRUN) {
+        CAN_STATS_RX_OVERRUN(instance);
     }
-    
-    message->frameType = (cs & CAN_WMBn_CS_RTR_MASK) ? CAN_FRAME_REMOTE : CAN_FRAME_DATA;
-    message->dataLength = (cs & CAN_WMBn_CS_DLC_MASK) >> CAN_WMBn_CS_DLC_SHIFT;
-    
-    /* Read data words */
-    data0 = base->RAMn[mbOffset + 2];
-    data1 = base->RAMn[mbOffset + 3];
-    
-    /* Extract bytes from data words (big-endian) */
-    message->data[0] = (uint8_t)((data0 >> 24) & 0xFFU);
-    message->data[1] = (uint8_t)((data0 >> 16) & 0xFFU);
-    message->data[2] = (uint8_t)((data0 >> 8) & 0xFFU);
-    message->data[3] = (uint8_t)(data0 & 0xFFU);
-    message->data[4] = (uint8_t)((data1 >> 24) & 0xFFU);
-    message->data[5] = (uint8_t)((data1 >> 16) & 0xFFU);
-    message->data[6] = (uint8_t)((data1 >> 8) & 0xFFU);
-    message->data[7] = (uint8_t)(data1 & 0xFFU);
+#endif
+    CAN_ReadFrame(instance, mbIndex, message);
+    CAN_STATS_RX(instance, mbIndex, message);
     
     /* Read TIMER to unlock message buffers */
     dummy = base->TIMER;
@@ -403,6 +621,80 @@ status_t CAN_Receive(uint8_t instance, uint8_t mbIndex, can_message_t *message)
     return STATUS_SUCCESS;
 }
 
+/**
+ * @brief Lock RX Message Buffer for zero-copy access
+ */
+status_t CAN_LockRxMb(uint8_t instance, uint8_t mbIndex, can_mb_view_t *view)
+{
+    CAN_Type *base;
+    uint32_t mbOffset;
+    uint32_t idWord;
+    uint8_t dlc;
+    
+    /* Validate parameters */
+    if (instance >= CAN_INSTANCE_COUNT || view == NULL) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    if (!s_canInitialized[instance]) {
+        return STATUS_NOT_INITIALIZED;
+    }
+    
+    if (mbIndex < CAN_RX_MB_START || mbIndex >= s_canActiveMbCount[instance]) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    base = s_canBases[instance];
+    mbOffset = mbIndex * MSG_BUF_SIZE;
+    
+    /* Check if message available */
+    if ((base->IFLAG1 & (1UL << mbIndex)) == 0U) {
+        return STATUS_ERROR;
+    }
+    
+    /* Read CS word (locks the MB) */
+    view->cs = base->RAMn[mbOffset + 0];
+    idWord = base->RAMn[mbOffset + 1];
+    
+    if (view->cs & CAN_WMBn_CS_IDE_MASK) {
+        view->idType = CAN_ID_EXT;
+        view->id = (idWord & CAN_ID_EXT_MASK) >> CAN_ID_EXT_SHIFT;
+    } else {
+        view->idType = CAN_ID_STD;
+        view->id = (idWord & CAN_ID_STD_MASK) >> CAN_ID_STD_SHIFT;
+    }
+    
+    dlc = (uint8_t)((view->cs & CAN_WMBn_CS_DLC_MASK) >> CAN_WMBn_CS_DLC_SHIFT);
+    view->dataLength = (dlc > CAN_MAX_DATA_LENGTH) ? CAN_MAX_DATA_LENGTH : dlc;
+    view->dataWords = &base->RAMn[mbOffset + 2];
+    CAN_STATS_RX(instance, mbIndex, view);
+    
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Release RX Message Buffer
+ */
+status_t CAN_ReleaseRxMb(uint8_t instance, uint8_t mbIndex)
+{
+    CAN_Type *base;
+    
+    if (instance >= CAN_INSTANCE_COUNT ||
+        mbIndex < CAN_RX_MB_START || mbIndex >= s_canActiveMbCount[instance]) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    base = s_canBases[instance];
+    
+    /* Read free running timer to unlock MB */
+    (void)base->TIMER;
+    
+    /* Clear interrupt flag */
+    base->IFLAG1 = (1UL << mbIndex);
+    
+    return STATUS_SUCCESS;
+}
+
 /**
  * @brief Receive CAN message with timeout
  */
@@ -412,6 +704,9 @@ status_t CAN_ReceiveBlocking(uint8_t instance, uint8_t mbIndex,
     CAN_Type *base;
     uint32_t timeoutCount = 0;
     uint32_t mbMask;
+#if OSAL_FREERTOS
+    status_t status;
+#endif
     
     /* Validate parameters */
     if (instance >= CAN_INSTANCE_COUNT || message == NULL) {
@@ -425,6 +720,15 @@ status_t CAN_ReceiveBlocking(uint8_t instance, uint8_t mbIndex,
     base = s_canBases[instance];
     mbMask = (1UL << mbIndex);
     
+#if OSAL_FREERTOS
+    if (OSAL_CanBlock() && (mbIndex < CAN_MB_COUNT)) {
+        status = CAN_OsalWaitMb(instance, mbIndex, timeoutMs) ?
+                 CAN_Receive(instance, mbIndex, message) : STATUS_TIMEOUT;
+        CAN_OsalEndWait(instance, mbIndex);
+        return status;
+    }
+#endif
+    
     /* Wait for message */
     while (timeoutCount < (timeoutMs * 1000U)) {
         if (base->IFLAG1 & mbMask) {
@@ -436,6 +740,14 @@ status_t CAN_ReceiveBlocking(uint8_t instance, uint8_t mbIndex,
     return STATUS_TIMEOUT;
 }
 
+/**
+ * @brief Install time source for extended RX timestamps
+ */
+void CAN_InstallTimeSource(can_time_source_t source)
+{
+    s_timeSource = source;
+}
+
 /**
  * @brief Configure RX filter
  */
@@ -455,13 +767,18 @@ status_t CAN_ConfigRxFilter(uint8_t instance, uint8_t mbIndex,
         return STATUS_NOT_INITIALIZED;
     }
     
-    if (mbIndex < CAN_RX_MB_START || mbIndex >= CAN_MB_COUNT) {
+    if (mbIndex < CAN_RX_MB_START || mbIndex >= s_canActiveMbCount[instance]) {
         return STATUS_INVALID_PARAM;
     }
     
     base = s_canBases[instance];
     mbOffset = mbIndex * MSG_BUF_SIZE;
     
+    /* RXIMR is only writable in freeze mode */
+    if (CAN_EnterFreezeMode(base) != STATUS_SUCCESS) {
+        return STATUS_TIMEOUT;
+    }
+    
     /* Configure ID word */
     if (filter->idType == CAN_ID_EXT) {
         id = (filter->id << CAN_ID_EXT_SHIFT) & CAN_ID_EXT_MASK;
@@ -480,7 +797,12 @@ status_t CAN_ConfigRxFilter(uint8_t instance, uint8_t mbIndex,
     base->RAMn[mbOffset + 0] = cs;
     
     /* Configure individual mask */
-    base->RXIMR[mbIndex] = filter->mask;
+    base->RXIMR[mbIndex] = CAN_EncodeMbMask(filter->mask, filter->idType);
+    
+    /* Exit freeze mode */
+    if (CAN_ExitFreezeMode(base) != STATUS_SUCCESS) {
+        return STATUS_TIMEOUT;
+    }
     
     return STATUS_SUCCESS;
 }
@@ -491,12 +813,19 @@ status_t CAN_ConfigRxFilter(uint8_t instance, uint8_t mbIndex,
 status_t CAN_InstallTxCallback(uint8_t instance, uint8_t mbIndex,
                                 can_callback_t callback, void *userData)
 {
-    if (instance >= CAN_INSTANCE_COUNT || mbIndex >= CAN_MB_COUNT) {
+    can_mb_callback_t *entry;
+    uint32_t basepri;
+    
+    if (instance >= CAN_INSTANCE_COUNT || mbIndex >= s_canMbCount[instance]) {
         return STATUS_INVALID_PARAM;
     }
     
-    s_txCallbacks[instance][mbIndex] = callback;
-    s_txUserData[instance][mbIndex] = userData;
+    /* Callback and user data change together for the MB interrupt */
+    entry = &s_mbCallbacks[s_canMbCallbackBase[instance] + mbIndex];
+    basepri = NVIC_EnterCritical();
+    entry->txCallback = callback;
+    entry->txUserData = userData;
+    NVIC_ExitCritical(basepri);
     
     /* Enable interrupt for this MB */
     if (callback != NULL) {
@@ -513,12 +842,18 @@ status_t CAN_InstallTxCallback(uint8_t instance, uint8_t mbIndex,
 status_t CAN_InstallRxCallback(uint8_t instance, uint8_t mbIndex,
                                 can_callback_t callback, void *userData)
 {
-    if (instance >= CAN_INSTANCE_COUNT || mbIndex >= CAN_MB_COUNT) {
+    can_mb_callback_t *entry;
+    uint32_t basepri;
+    
+    if (instance >= CAN_INSTANCE_COUNT || mbIndex >= s_canMbCount[instance]) {
         return STATUS_INVALID_PARAM;
     }
     
-    s_rxCallbacks[instance][mbIndex] = callback;
-    s_rxUserData[instance][mbIndex] = userData;
+    entry = &s_mbCallbacks[s_canMbCallbackBase[instance] + mbIndex];
+    basepri = NVIC_EnterCritical();
+    entry->rxCallback = callback;
+    entry->rxUserData = userData;
+    NVIC_ExitCritical(basepri);
     
     /* Enable interrupt for this MB */
   
@@ -551,6 +886,7 @@ status_t CAN_InstallErrorCallback(uint8_t instance,
 status_t CAN_GetErrorState(uint8_t instance, can_error_state_t *errorState)
 {
     CAN_Type *base;
+    uint32_t esr1;
     uint32_t fltConf;
     
     if (instance >= CAN_INSTANCE_COUNT || errorState == NULL) {
@@ -559,7 +895,11 @@ status_t CAN_GetErrorState(uint8_t instance, can_error_state_t *errorState)
     
     base = s_canBases[instance];
     
-    fltConf = (base->ESR1 & CAN_ESR1_FLTCONF_MASK) >> CAN_ESR1_FLTCONF_SHIFT;
+    /* ESR1 error bits clear on read: account them before they are lost */
+    esr1 = base->ESR1;
+    CAN_STATS_ESR1(instance, esr1);
+    
+    fltConf = (esr1 & CAN_ESR1_FLTCONF_MASK) >> CAN_ESR1_FLTCONF_SHIFT;
     
     if (fltConf == 0U) {
         *errorState = CAN_ERROR_ACTIVE;
@@ -569,6 +909,17 @@ status_t CAN_GetErrorState(uint8_t instance, can_error_state_t *errorState)
         *errorState = CAN_ERROR_BUS_OFF;
     }
     
+#if CAN_STATISTICS_ENABLE
+    if (*errorState != s_lastErrorState[instance]) {
+        if (*errorState == CAN_ERROR_PASSIVE) {
+            s_canStats[instance].errorPassiveCount++;
+        } else if (*errorState == CAN_ERROR_BUS_OFF) {
+            s_canStats[instance].busOffCount++;
+        }
+        s_lastErrorState[instance] = *errorState;
+    }
+#endif
+    
     return STATUS_SUCCESS;
 }
 
@@ -593,6 +944,89 @@ status_t CAN_GetErrorCounters(uint8_t instance,
     return STATUS_SUCCESS;
 }
 
+/**
+ * @brief Configure bus-off recovery and error interrupts
+ */
+status_t CAN_ConfigErrorHandling(uint8_t instance, const can_error_config_t *config)
+{
+    CAN_Type *base;
+    uint32_t ctrl1;
+    bool wrnEn;
+    
+    if (instance >= CAN_INSTANCE_COUNT || config == NULL) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    if (!s_canInitialized[instance]) {
+        return STATUS_NOT_INITIALIZED;
+    }
+    
+    base = s_canBases[instance];
+    
+    /* WRNEN is writable only in freeze mode: freeze only when it changes */
+    wrnEn = ((base->MCR & CAN_MCR_WRNEN_MASK) != 0U);
+    if (wrnEn != config->enableWarningInterrupt) {
+        if (CAN_EnterFreezeMode(base) != STATUS_SUCCESS) {
+            return STATUS_TIMEOUT;
+        }
+        if (config->enableWarningInterrupt) {
+            base->MCR |= CAN_MCR_WRNEN_MASK;
+        } else {
+            base->MCR &= ~CAN_MCR_WRNEN_MASK;
+        }
+        if (CAN_ExitFreezeMode(base) != STATUS_SUCCESS) {
+            return STATUS_TIMEOUT;
+        }
+    }
+    
+    s_busOffRecovery[instance] = config->recovery;
+    s_busOffTxPolicy[instance] = config->txPolicy;
+    
+    /* BOFFREC and the interrupt masks are writable outside freeze mode */
+    ctrl1 = base->CTRL1 & ~(CAN_CTRL1_BOFFREC_MASK | CAN_CTRL1_TWRNMSK_MASK |
+                            CAN_CTRL1_RWRNMSK_MASK | CAN_CTRL1_ERRMSK_MASK);
+    ctrl1 |= CAN_CTRL1_BOFFMSK_MASK;
+    if (config->recovery == CAN_BUSOFF_RECOVERY_MANUAL) {
+        ctrl1 |= CAN_CTRL1_BOFFREC_MASK;
+    }
+    if (config->enableWarningInterrupt) {
+        ctrl1 |= CAN_CTRL1_TWRNMSK_MASK | CAN_CTRL1_RWRNMSK_MASK;
+    }
+    if (config->enableErrorInterrupt) {
+        ctrl1 |= CAN_CTRL1_ERRMSK_MASK;
+    }
+    base->CTRL1 = ctrl1;
+    base->CTRL2 |= CAN_CTRL2_BOFFDONEMSK_MASK;
+    
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Start bus-off recovery (manual recovery mode)
+ */
+status_t CAN_RecoverFromBusOff(uint8_t instance)
+{
+    CAN_Type *base;
+    uint32_t fltConf;
+    
+    if (instance >= CAN_INSTANCE_COUNT ||
+        s_busOffRecovery[instance] != CAN_BUSOFF_RECOVERY_MANUAL) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    base = s_canBases[instance];
+    
+    /* Clearing BOFFREC outside bus off switches to auto recovery for the next one */
+    fltConf = (base->ESR1 & CAN_ESR1_FLTCONF_MASK) >> CAN_ESR1_FLTCONF_SHIFT;
+    if (fltConf < 2U) {
+        return STATUS_ERROR;
+    }
+    
+    base->CTRL1 &= ~CAN_CTRL1_BOFFREC_MASK;
+    
+    return STATUS_SUCCESS;
+}
+
 /**
  * @brief Abort transmission
  */
@@ -601,7 +1035,7 @@ status_t CAN_AbortTransmission(uint8_t instance, uint8_t mbIndex)
     CAN_Type *base;
     uint32_t mbOffset;
     
-    if (instance >= CAN_INSTANCE_COUNT || mbIndex >= CAN_MB_COUNT) {
+    if (instance >= CAN_INSTANCE_COUNT || mbIndex >= s_canActiveMbCount[instance]) {
         return STATUS_INVALID_PARAM;
     }
     
@@ -625,7 +1059,7 @@ status_t CAN_IsMbBusy(uint8_t instance, uint8_t mbIndex, bool *isBusy)
     uint32_t code;
     
     if (instance >= CAN_INSTANCE_COUNT || 
-        mbIndex >= CAN_MB_COUNT || isBusy == NULL) {
+        mbIndex >= s_canActiveMbCount[instance] || isBusy == NULL) {
         return STATUS_INVALID_PARAM;
     }
     
@@ -698,58 +1132,60 @@ status_t CAN_SetupRxMailbox(uint8_t instance, uint8_t mbIndex,
     return CAN_ConfigRxMailbox(instance, mbIndex, id, idType, mask);
 }
 
-/*******************************************************************************
- * Private Functions
- ******************************************************************************/
-
 /**
- * @brief Enter freeze mode
+ * @brief Configure RX FIFO and ID filter table
  */
-static status_t CAN_EnterFreezeMode(CAN_Type *base)
+status_t CAN_ConfigRxFifo(uint8_t instance, const can_rx_fifo_config_t *config)
 {
-    uint32_t timeout = CAN_FREEZE_TIMEOUT;
+    CAN_Type *base;
+    const can_rx_filter_t *filter;
+    uint32_t i;
     
-    /* Request freeze mode */
-    base->MCR |= (CAN_MCR_FRZ_MASK | CAN_MCR_HALT_MASK);
+    /* Validate parameters */
+    if (instance >= CAN_INSTANCE_COUNT || config == NULL || config->filterTable == NULL) {
+        return STATUS_INVALID_PARAM;
+    }
     
-    /* Wait for freeze mode acknowledge */
-    while ((timeout > 0U) && ((base->MCR & CAN_MCR_FRZACK_MASK) == 0U)) {
-        timeout--;
+    if (config->filterCount == 0U || config->filterCount > CAN_RX_FIFO_FILTER_COUNT) {
+        return STATUS_INVALID_PARAM;
     }
     
-    if (timeout == 0U) {
-        return STATUS_TIMEOUT;
+    if (!s_canInitialized[instance]) {
+        return STATUS_NOT_INITIALIZED;
     }
     
-    return STATUS_SUCCESS;
-}
-
-/**
- * @brief Exit freeze mode
- */
-static status_t CAN_ExitFreezeMode(CAN_Type *base)
-{
-    uint32_t timeout = CAN_FREEZE_TIMEOUT;
-    
-    /* Clear freeze and halt bits */
-    base->MCR &= ~(CAN_MCR_FRZ_MASK | CAN_MCR_HALT_MASK);
-    
-    /* Wait for module ready */
-    while ((timeout > 0U) && ((base->MCR & CAN_MCR_FRZACK_MASK) != 0U)) {
-        timeout--;
-    }
+    base = s_canBases[instance];
     
-    if (timeout == 0U) {
+    /* Enter freeze mode to configure */
+    if (CAN_EnterFreezeMode(base) != STATUS_SUCCESS) {
         return STATUS_TIMEOUT;
     }
     
-    /* Wait for module not ready flag to clear */
-    timeout = CAN_FREEZE_TIMEOUT;
-    while ((timeout > 0U) && ((base->MCR & CAN_MCR_NOTRDY_MASK) != 0U)) {
-        timeout--;
+    /* Enable RX FIFO with format A filter table, 8 elements (RFFN = 0) */
+    base->MCR |= CAN_MCR_RFEN_MASK;
+    base->MCR &= ~CAN_MCR_IDAM_MASK;
+    base->CTRL2 &= ~CAN_CTRL2_RFFN_MASK;
+    
+    /* Load filter table, repeating the last entry in unused elements */
+    for (i = 0U; i < CAN_RX_FIFO_FILTER_COUNT; i++) {
+        filter = &config->filterTable[(i < config->filterCount) ? i : (config->filterCount - 1U)];
+        
+        base->RAMn[CAN_RX_FIFO_FILTER_TABLE_OFFSET + i] = CAN_EncodeFifoFilter(filter->id, filter->idType);
+        base->RXIMR[i] = CAN_EncodeFifoFilter(filter->mask, filter->idType) |
+                         CAN_RX_FIFO_ID_A_RTR_MASK | CAN_RX_FIFO_ID_A_IDE_MASK;
     }
     
-    if (timeout == 0U) {
+    /* Shared mask, only used if individual masking is turned off (RTR and IDE always compared) */
+    base->RXFGMASK = CAN_EncodeFifoFilter(config->filterTable[0].mask, config->filterTable[0].idType) |
+                     CAN_RX_FIFO_ID_A_RTR_MASK | CAN_RX_FIFO_ID_A_IDE_MASK;
+    
+    /* Clear stale FIFO flags */
+    base->IFLAG1 = CAN_RX_FIFO_FLAGS_MASK;
+    
+    s_canRxFifoEnabled[instance] = true;
+    
+    /* Exit freeze mode */
+    if (CAN_ExitFreezeMode(base) != STATUS_SUCCESS) {
         return STATUS_TIMEOUT;
     }
     
@@ -757,120 +1193,156 @@ static status_t CAN_ExitFreezeMode(CAN_Type *base)
 }
 
 /**
- * @brief Soft reset CAN module
+ * @brief Read one frame from RX FIFO
  */
-static status_t CAN_SoftReset(CAN_Type *base)
+status_t CAN_ReadRxFifo(uint8_t instance, can_message_t *message)
 {
-    uint32_t timeout = CAN_FREEZE_TIMEOUT;
+    CAN_Type *base;
     
-    /* Request soft reset */
-    base->MCR |= CAN_MCR_SOFTRST_MASK;
+    /* Validate parameters */
+    if (HAL_PARAM_INVALID(instance >= CAN_INSTANCE_COUNT || message == NULL)) {
+        return STATUS_INVALID_PARAM;
+    }
     
-    /* Wait for reset to complete */
-    while ((timeout > 0U) && ((base->MCR & CAN_MCR_SOFTRST_MASK) != 0U)) {
-        timeout--;
+    if (!s_canInitialized[instance]) {
+        return STATUS_NOT_INITIALIZED;
     }
     
-    if (timeout == 0U) {
-        return STATUS_TIMEOUT;
+    /* DMA mode: the eDMA owns the FIFO output */
+    if (!s_canRxFifoEnabled[instance] || s_canRxDmaEnabled[instance]) {
+        return STATUS_ERROR;
+    }
+    
+    base = s_canBases[instance];
+    
+    /* Check if frame available */
+    if ((base->IFLAG1 & CAN_IFLAG1_BUF5I_MASK) == 0U) {
+        return STATUS_ERROR;
     }
     
+    /* FIFO output is mapped at MB0 */
+    CAN_ReadFrame(instance, 0U, message);
+    CAN_STATS_RX(instance, 0U, message);
+    
+    /* Clearing frame available flag pops the FIFO */
+    base->IFLAG1 = CAN_IFLAG1_BUF5I_MASK;
+    
     return STATUS_SUCCESS;
 }
 
 /**
- * @brief Enable CAN peripheral clock
- * @details Enables clock through PCC module and configures CAN clock source
+ * @brief Install RX FIFO callback
  */
-static void CAN_EnableClock(uint8_t instance, can_clk_src_t clockSource)
+status_t CAN_InstallRxFifoCallback(uint8_t instance,
+                                    can_callback_t callback, void *userData)
 {
     CAN_Type *base;
     
+    if (instance >= CAN_INSTANCE_COUNT) {
+        return STATUS_INVALID_PARAM;
+    }
+    
     base = s_canBases[instance];
     
-    /* Enable CAN clock through PCC module */
-    PCC_EnableCANClock(instance, clockSource);
-
-    /* MDIS=1: Disable module before selecting clock */
-    base->MCR |= CAN_MCR_MDIS_MASK; 
-
-    /* Select clock source in CTRL1 register */ 
-    if (clockSource == CAN_CLK_SRC_SOSCDIV2) {
-        base->CTRL1 &= ~CAN_CTRL1_CLKSRC_MASK; /* CLKSRC=0: Clock Source = oscillator */
+    s_rxFifoCallbacks[instance] = callback;
+    s_rxFifoUserData[instance] = userData;
+    
+    /* Enable or disable FIFO interrupts (frame available is a DMA request in DMA mode) */
+    if (callback != NULL) {
+        base->IMASK1 |= s_canRxDmaEnabled[instance] ? (CAN_IFLAG1_BUF6I_MASK | CAN_IFLAG1_BUF7I_MASK)
+                                                    : CAN_RX_FIFO_FLAGS_MASK;
     } else {
-        base->CTRL1 |= CAN_CTRL1_CLKSRC_MASK; /* CLKSRC=1: Clock Source = bus clock */
+        base->IMASK1 &= ~CAN_RX_FIFO_FLAGS_MASK;
     }
-
-    /* MDIS=0: Enable module config. (Sets FRZ, HALT) */
-    base->MCR &= ~CAN_MCR_MDIS_MASK;
+    
+    return STATUS_SUCCESS;
 }
 
 /**
- * @brief Initialize all Message Buffers to inactive
+ * @brief Start RX FIFO to RAM DMA capture
  */
-static void CAN_InitMessageBuffers(CAN_Type *base)
+status_t CAN_StartRxFifoDma(uint8_t instance, const can_rx_dma_config_t *config)
 {
-    uint32_t i;
+    CAN_Type *base;
     
-    /* Clear all 32 msg bufs x 4 words/msg buf = 128 words */
-    for (i = 0; i < 128; i++) {
-        base->RAMn[i] = 0;
+    /* Validate parameters */
+    if (instance >= CAN_INSTANCE_COUNT || config == NULL || config->buffer == NULL) {
+        return STATUS_INVALID_PARAM;
     }
     
-    /* In FRZ mode, init CAN 16 msg buf filters */
-    for (i = 0; i < 16; i++) {
-        /* Check all ID bits for incoming messages */
-        base->RXIMR[i] = 0xFFFFFFFFUL;
+    if (config->dmaChannel >= DMA_CHANNEL_COUNT ||
+        config->entryCount < 2U || config->entryCount > CAN_RX_DMA_MAX_ENTRIES) {
+        return STATUS_INVALID_PARAM;
     }
     
-    /* Clear all interrupt flags 
-        This reg is w1c*/
-    base->IFLAG1 = 0xFFFFFFFFUL;
+    if (!s_canInitialized[instance]) {
+        return STATUS_NOT_INITIALIZED;
+    }
+    
+    /* 16-byte eDMA transfers: ring entries must be 16-byte aligned */
+    if (!s_canRxFifoEnabled[instance] || s_canRxDmaEnabled[instance] ||
+        (((uintptr_t)config->buffer & 0xFU) != 0U)) {
+        return STATUS_ERROR;
+    }
+    
+    base = s_canBases[instance];
+    
+    if (CAN_EnterFreezeMode(base) != STATUS_SUCCESS) {
+        return STATUS_TIMEOUT;
+    }
+    
+    /* Frame available is no longer an interrupt: BUF5I becomes the DMA request */
+    base->IMASK1 &= ~CAN_IFLAG1_BUF5I_MASK;
+    base->MCR |= CAN_MCR_DMA_MASK;
+    
+    /* Freeze mode: writing 1 to BUF0I clears the whole FIFO */
+    base->IFLAG1 = CAN_IFLAG1_BUF0I_MASK | CAN_IFLAG1_BUF6I_MASK | CAN_IFLAG1_BUF7I_MASK;
+    
+    s_canRxDmaBuffer[instance] = config->buffer;
+    s_canRxDmaCount[instance] = config->entryCount;
+    s_canRxDmaChannel[instance] = config->dmaChannel;
+    s_canRxDmaOverruns[instance] = 0U;
+    
+    CAN_RxDmaArm(instance);
+    s_canRxDmaEnabled[instance] = true;
+    
+    if (CAN_ExitFreezeMode(base) != STATUS_SUCCESS) {
+        return STATUS_TIMEOUT;
+    }
+    
+    return STATUS_SUCCESS;
 }
 
 /**
- * @brief Set CAN operating mode
+ * @brief Stop RX FIFO DMA capture
  */
-status_t CAN_SetOperatingMode(uint8_t instance, can_mode_t mode)
+status_t CAN_StopRxFifoDma(uint8_t instance)
 {
     CAN_Type *base;
-    status_t status;
     
-    /* Validate parameters */
     if (instance >= CAN_INSTANCE_COUNT) {
         return STATUS_INVALID_PARAM;
     }
     
-    if (!s_canInitialized[instance]) {
-        return STATUS_NOT_INITIALIZED;
-    }
-    
-    if (mode > CAN_MODE_LISTEN_ONLY) {
-        return STATUS_INVALID_PARAM;
+    if (!s_canRxDmaEnabled[instance]) {
+        return STATUS_ERROR;
     }
     
     base = s_canBases[instance];
     
-    /* Enter freeze mode to change configuration */
-    status = CAN_EnterFreezeMode(base);
-    if (status != STATUS_SUCCESS) {
+    if (CAN_EnterFreezeMode(base) != STATUS_SUCCESS) {
         return STATUS_TIMEOUT;
     }
     
-    /* Clear existing mode bits */
-    base->CTRL1 &= ~(CAN_CTRL1_LPB_MASK | CAN_CTRL1_LOM_MASK);
+    base->MCR &= ~CAN_MCR_DMA_MASK;
+    CAN_RxDmaRelease(instance);
     
-    /* Set new operating mode */
-    if (mode == CAN_MODE_LOOPBACK) {
-        base->CTRL1 |= CAN_CTRL1_LPB_MASK;  /* Enable loopback mode */
-    } else if (mode == CAN_MODE_LISTEN_ONLY) {
-        base->CTRL1 |= CAN_CTRL1_LOM_MASK;  /* Enable listen-only mode */
+    /* Back to CPU FIFO reads, frame available interrupt if a callback is installed */
+    if (s_rxFifoCallbacks[instance] != NULL) {
+        base->IMASK1 |= CAN_IFLAG1_BUF5I_MASK;
     }
-    /* For CAN_MODE_NORMAL, both bits remain 0 */
     
-    /* Exit freeze mode */
-    status = CAN_ExitFreezeMode(base);
-    if (status != STATUS_SUCCESS) {
+    if (CAN_ExitFreezeMode(base) != STATUS_SUCCESS) {
         return STATUS_TIMEOUT;
     }
     
@@ -878,79 +1350,117 @@ status_t CAN_SetOperatingMode(uint8_t instance, can_mode_t mode)
 }
 
 /**
- * @brief Configure TX Mailbox
- * @param instance CAN instance number (0-2)
- * @param mbIndex Message Buffer index to configure for TX
- * @return STATUS_SUCCESS if successful, error code otherwise
+ * @brief Read the oldest frame of the RX FIFO DMA ring
  */
-static status_t CAN_ConfigTxMailbox(uint8_t instance, uint8_t mbIndex)
+status_t CAN_ReadRxFifoDma(uint8_t instance, can_message_t *message)
 {
-    CAN_Type *base;
-    uint32_t mbOffset;
+    can_rx_dma_entry_t *entry;
+    uint16_t count;
+    uint16_t read;
+    uint16_t write;
+    uint32_t cs;
+    uint32_t id;
+    uint32_t word;
+    uint8_t i;
     
-    /* Validate parameters */
-    if (instance >= CAN_INSTANCE_COUNT) {
+    if (instance >= CAN_INSTANCE_COUNT || message == NULL) {
         return STATUS_INVALID_PARAM;
     }
     
-    if (mbIndex >= CAN_MB_COUNT) {
-        return STATUS_INVALID_PARAM;
+    if (!s_canRxDmaEnabled[instance]) {
+        return STATUS_ERROR;
     }
     
-    if (!s_canInitialized[instance]) {
-        return STATUS_NOT_INITIALIZED;
+    count = s_canRxDmaCount[instance];
+    read = s_canRxDmaRead[instance];
+    write = CAN_RxDmaWriteIndex(instance, &cs);
+    
+    /*
+     * The entry the DMA writes next is only filled (from the previous lap)
+     * when the ring is full, i.e. write == read. Filled with write != read
+     * the DMA has passed the reader and overwritten unread entries.
+     */
+    if (cs == CAN_RX_DMA_ENTRY_EMPTY) {
+        if (write == read) {
+            return STATUS_ERROR;
+        }
+    } else if (write != read) {
+        CAN_RxDmaResync(instance);
+        return STATUS_ERROR;
+    } else {
+        /* Full: the oldest entry is read, the DMA overwrites it next */
     }
     
-    base = s_canBases[instance];
-    mbOffset = mbIndex * MSG_BUF_SIZE;
+    entry = &s_canRxDmaBuffer[instance][read];
+    cs = entry->cs;
+    id = entry->id;
     
-    /* Enter freeze mode to configure */
-    if (CAN_EnterFreezeMode(base) != STATUS_SUCCESS) {
-        return STATUS_TIMEOUT;
+    if (cs & CAN_WMBn_CS_IDE_MASK) {
+        message->idType = CAN_ID_EXT;
+        message->id = (id & CAN_ID_EXT_MASK) >> CAN_ID_EXT_SHIFT;
+    } else {
+        message->idType = CAN_ID_STD;
+        message->id = (id & CAN_ID_STD_MASK) >> CAN_ID_STD_SHIFT;
     }
     
-    /* Clear Message Buffer */
-    base->RAMn[mbOffset + 0] = 0U;  /* CS - set to INACTIVE */
-    base->RAMn[mbOffset + 1] = 0U;  /* ID */
-    base->RAMn[mbOffset + 2] = 0U;  /* DATA0 */
-    base->RAMn[mbOffset + 3] = 0U;  /* DATA1 */
+    message->frameType = (cs & CAN_WMBn_CS_RTR_MASK) ? CAN_FRAME_REMOTE : CAN_FRAME_DATA;
+    message->dataLength = (uint8_t)((cs & CAN_WMBn_CS_DLC_MASK) >> CAN_WMBn_CS_DLC_SHIFT);
+    if (message->dataLength > CAN_MAX_DATA_LENGTH) {
+        message->dataLength = CAN_MAX_DATA_LENGTH;
+    }
     
-    /* Set MB code to TX_INACTIVE */
-    base->RAMn[mbOffset + 0] = (CAN_CS_CODE_TX_INACTIVE << CAN_CS_CODE_SHIFT);
+    /* Data words big-endian: byte 0 in bits 31-24 */
+    for (i = 0U; i < message->dataLength; i++) {
+        word = entry->data[i >> 2U];
+        message->data[i] = (uint8_t)(word >> (24U - (8U * (i & 3U))));
+    }
     
-    /* Clear interrupt flag */
-    base->IFLAG1 = (1UL << mbIndex);
+    message->timeStamp = (uint16_t)((cs & CAN_CS_TIME_STAMP_MASK) >> CAN_CS_TIME_STAMP_SHIFT);
+    message->timestampUs = CAN_TimestampToUs(instance, message->timeStamp);
     
-    /* Exit freeze mode */
-    if (CAN_ExitFreezeMode(base) != STATUS_SUCCESS) {
-        return STATUS_TIMEOUT;
+    /* Full ring: a frame arriving meanwhile overwrote the entry being decoded */
+    if ((write == read) && (CAN_RxDmaWriteIndex(instance, &cs) != write)) {
+        CAN_RxDmaResync(instance);
+        return STATUS_ERROR;
     }
     
+    /* Hand the entry back to the DMA */
+    entry->cs = CAN_RX_DMA_ENTRY_EMPTY;
+    s_canRxDmaRead[instance] = (uint16_t)((read + 1U) % count);
+    
+    CAN_STATS_RX(instance, 0U, message);
+    
     return STATUS_SUCCESS;
 }
 
 /**
- * @brief Configure RX Mailbox
- * @param instance CAN instance number (0-2)
- * @param mbIndex Message Buffer index to configure for RX
- * @param id CAN ID to filter
- * @param idType Standard or Extended ID
- * @param mask Filter mask (1=care, 0=don't care)
- * @return STATUS_SUCCESS if successful, error code otherwise
+ * @brief Number of RX FIFO DMA ring overruns
  */
-static status_t CAN_ConfigRxMailbox(uint8_t instance, uint8_t mbIndex, 
-                                    uint32_t id, can_id_type_t idType, uint32_t mask)
+uint32_t CAN_GetRxFifoDmaOverruns(uint8_t instance)
+{
+    if (instance >= CAN_INSTANCE_COUNT) {
+        return 0U;
+    }
+    
+    return s_canRxDmaOverruns[instance];
+}
+
+/**
+ * @brief Configure software TX queue
+ */
+status_t CAN_ConfigTxQueue(uint8_t instance, const can_tx_queue_config_t *config)
 {
     CAN_Type *base;
-    uint32_t mbOffset;
-    uint32_t cs, idWord;
+    uint32_t poolMask;
+    uint8_t mbIdx;
     
     /* Validate parameters */
-    if (instance >= CAN_INSTANCE_COUNT) {
+    if (instance >= CAN_INSTANCE_COUNT || config == NULL) {
         return STATUS_INVALID_PARAM;
     }
     
-    if (mbIndex >= CAN_MB_COUNT) {
+    if (config->mbCount == 0U || config->firstMb < CAN_TX_MB_START ||
+        (config->firstMb + config->mbCount) > (CAN_TX_MB_START + CAN_TX_MB_COUNT)) {
         return STATUS_INVALID_PARAM;
     }
     
@@ -959,66 +1469,1967 @@ static status_t CAN_ConfigRxMailbox(uint8_t instance, uint8_t mbIndex,
     }
     
     base = s_canBases[instance];
-    mbOffset = mbIndex * MSG_BUF_SIZE;
+    poolMask = ((1UL << config->mbCount) - 1UL) << config->firstMb;
+    
+    /* Stop refilling while reconfiguring */
+    base->IMASK1 &= ~s_txQueuePoolMask[instance];
+    s_txQueuePoolMask[instance] = 0U;
+    s_txQueueBusyMask[instance] = 0U;
+    s_txQueueCount[instance] = 0U;
     
     /* Enter freeze mode to configure */
     if (CAN_EnterFreezeMode(base) != STATUS_SUCCESS) {
         return STATUS_TIMEOUT;
     }
     
-    /* Clear Message Buffer */
-    base->RAMn[mbOffset + 0] = 0U;  /* CS */
-    base->RAMn[mbOffset + 1] = 0U;  /* ID */
-    base->RAMn[mbOffset + 2] = 0U;  /* DATA0 */
-    base->RAMn[mbOffset + 3] = 0U;  /* DATA1 */
-    
-    /* Configure ID word */
-    if (idType == CAN_ID_EXT) {
-        idWord = (id << CAN_ID_EXT_SHIFT) & CAN_ID_EXT_MASK;
+    /* Lowest ID first, optionally including local priority */
+    base->CTRL1 &= ~CAN_CTRL1_LBUF_MASK;
+    if (config->enableLocalPriority) {
+        base->MCR |= CAN_MCR_LPRIOEN_MASK;
     } else {
-        idWord = (id << CAN_ID_STD_SHIFT) & CAN_ID_STD_MASK;
+        base->MCR &= ~CAN_MCR_LPRIOEN_MASK;
     }
-    base->RAMn[mbOffset + 1] = idWord;
-    
-    /* Configure individual mask */
-    base->RXIMR[mbIndex] = mask;
+    s_txQueueLocalPrio[instance] = config->enableLocalPriority;
     
-    /* Configure CS word as RX EMPTY */
-    cs = (CAN_CS_CODE_RX_EMPTY << CAN_CS_CODE_SHIFT);
-    if (idType == CAN_ID_EXT) {
-        cs |= CAN_WMBn_CS_IDE_MASK;
+    /* Set pool MBs to TX_INACTIVE */
+    for (mbIdx = config->firstMb; mbIdx < (config->firstMb + config->mbCount); mbIdx++) {
+        CAN_ClearMb(base, mbIdx);
+        CAN_WriteMbCs(base, mbIdx, (CAN_CS_CODE_TX_INACTIVE << CAN_CS_CODE_SHIFT));
     }
-    base->RAMn[mbOffset + 0] = cs;
-    
-    /* Clear interrupt flag */
-    base->IFLAG1 = (1UL << mbIndex);
+    base->IFLAG1 = poolMask;
     
     /* Exit freeze mode */
     if (CAN_ExitFreezeMode(base) != STATUS_SUCCESS) {
         return STATUS_TIMEOUT;
     }
     
+    s_txQueuePoolMask[instance] = poolMask;
+    base->IMASK1 |= poolMask;
+    
     return STATUS_SUCCESS;
 }
 
 /**
- * @brief Get clock frequency from clock source
+ * @brief Enqueue CAN message for transmission
  */
-static uint32_t CAN_GetClockFrequency(can_clk_src_t clockSource)
+status_t CAN_EnqueueTx(uint8_t instance, const can_message_t *message, uint8_t localPriority)
 {
-    uint32_t freq;
+    can_tx_queue_entry_t *queue;
+    uint32_t key;
+    uint32_t basepri;
+    uint8_t i;
+    status_t status = STATUS_SUCCESS;
     
-    switch (clockSource) {
-        case CAN_CLK_SRC_SOSCDIV2:
-            freq = 4000000U;    /* 8 MHz / 2 = 4 MHz typical */
-            break;
-        case CAN_CLK_SRC_BUSCLOCK:
-            freq = 40000000U;   /* 80 MHz / 2 = 40 MHz typical */
-            break;
-        default:
-            freq = CAN_DEFAULT_CLK_FREQ;
-            break;
+    /* Validate parameters */
+    if (instance >= CAN_INSTANCE_COUNT || message == NULL) {
+        return STATUS_INVALID_PARAM;
     }
     
-    return freq;
+    if (message->dataLength > CAN_MAX_DATA_LENGTH || localPriority > CAN_TX_LOCAL_PRIO_MAX) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    if (!s_canInitialized[instance] || s_txQueuePoolMask[instance] == 0U) {
+        return STATUS_NOT_INITIALIZED;
+    }
+    
+    queue = s_txQueue[instance];
+    
+    /* Arbitration value as written to the MB ID word */
+    if (message->idType == CAN_ID_STD) {
+        key = (message->id << CAN_ID_STD_SHIFT) & CAN_ID_STD_MASK;
+    } else {
+        key = (message->id << CAN_ID_EXT_SHIFT) & CAN_ID_EXT_MASK;
+    }
+    if (s_txQueueLocalPrio[instance]) {
+        key |= ((uint32_t)localPriority << CAN_ID_PRIO_SHIFT) & CAN_ID_PRIO_MASK;
+    }
+    
+    /* Queue is shared with CAN_IRQHandler() and CAN_ErrorIRQHandler() */
+    basepri = NVIC_EnterCritical();
+    
+    if (s_txQueueCount[instance] >= CAN_TX_QUEUE_SIZE) {
+        status = STATUS_BUSY;
+    } else {
+        /* Insert keeping descending order; equal keys stay FIFO */
+        i = s_txQueueCount[instance];
+        while ((i > 0U) && (queue[i - 1U].key <= key)) {
+            queue[i] = queue[i - 1U];
+            i--;
+        }
+        queue[i].key = key;
+        queue[i].message = *message;
+        s_txQueueCount[instance]++;
+        
+        /* Load immediately if a pool MB is free */
+        CAN_TxQueueLoad(instance);
+    }
+    
+    NVIC_ExitCritical(basepri);
+    
+    return status;
+}
+
+/**
+ * @brief Get number of frames waiting in TX queue
+ */
+status_t CAN_GetTxQueueCount(uint8_t instance, uint8_t *count)
+{
+    if (instance >= CAN_INSTANCE_COUNT || count == NULL) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    *count = s_txQueueCount[instance];
+    
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Configure CAN FD operation
+ */
+status_t CAN_ConfigFd(uint8_t instance, const can_fd_config_t *config)
+{
+    CAN_Type *base;
+    can_phase_timing_t nominal;
+    can_phase_timing_t data;
+    uint32_t fdctrl;
+    uint32_t i;
+    uint8_t mbCount;
+    
+    /* Validate parameters */
+    if (instance != CAN_FD_INSTANCE || config == NULL) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    if (config->payloadSize > CAN_FD_PAYLOAD_64) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    if (!s_canInitialized[instance]) {
+        return STATUS_NOT_INITIALIZED;
+    }
+    
+    /* Calculate nominal and data phase timing */
+    if (CAN_CalcFdTiming(s_canClockFreq[instance], config->nominalBaudRate,
+                         config->enableBrs ? config->dataBaudRate : 0U,
+                         &nominal, &data) != STATUS_SUCCESS) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    base = s_canBases[instance];
+    
+    /* Enter freeze mode to configure */
+    if (CAN_EnterFreezeMode(base) != STATUS_SUCCESS) {
+        return STATUS_TIMEOUT;
+    }
+    
+    /* CBT / FDCBT, then payload size, bit rate switch and delay compensation */
+    fdctrl = CAN_WriteFdTiming(base, &nominal, &data, config->enableBrs);
+    base->FDCTRL = fdctrl | CAN_FDCTRL_MBDSR0(config->payloadSize);
+    
+    if (config->enableIsoCrc) {
+        base->CTRL2 |= CAN_CTRL2_ISOCANFDEN_MASK;
+    } else {
+        base->CTRL2 &= ~CAN_CTRL2_ISOCANFDEN_MASK;
+    }
+    
+    /* Enable FD, RX FIFO (and its DMA mode) is not available in FD mode */
+    base->MCR &= ~(CAN_MCR_RFEN_MASK | CAN_MCR_DMA_MASK);
+    base->MCR |= CAN_MCR_FDEN_MASK;
+    s_canRxFifoEnabled[instance] = false;
+    CAN_RxDmaRelease(instance);
+    
+    /* MB layout changes: clear MB RAM and limit MAXMB */
+    for (i = 0U; i < CAN_MB_RAM_WORDS; i++) {
+        base->RAMn[i] = 0U;
+    }
+    mbCount = CAN_GetFdMbCount(config->payloadSize);
+    if (mbCount > s_canActiveMbCount[instance]) {
+        mbCount = s_canActiveMbCount[instance];
+    }
+    base->MCR = (base->MCR & ~CAN_MCR_MAXMB_MASK) | CAN_MCR_MAXMB((uint32_t)mbCount - 1U);
+    base->IFLAG1 = 0xFFFFFFFFUL;
+    
+    s_canFdPayload[instance] = config->payloadSize;
+    s_canBaudRate[instance] = config->nominalBaudRate;
+    s_canFdDataRate[instance] = config->enableBrs ? config->dataBaudRate : 0U;
+    s_canFdEnabled[instance] = true;
+    
+    /* Exit freeze mode */
+    if (CAN_ExitFreezeMode(base) != STATUS_SUCCESS) {
+        return STATUS_TIMEOUT;
+    }
+    
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Get number of Message Buffers available in FD mode
+ */
+uint8_t CAN_GetFdMbCount(can_fd_payload_size_t payloadSize)
+{
+    uint32_t mbWords = 2U + ((8UL << (uint32_t)payloadSize) / 4U);
+    uint32_t count = CAN_MB_RAM_WORDS / mbWords;
+    
+    return (count > CAN_MB_COUNT) ? (uint8_t)CAN_MB_COUNT : (uint8_t)count;
+}
+
+/**
+ * @brief Convert DLC code to payload length
+ */
+uint8_t CAN_DlcToLength(uint8_t dlc)
+{
+    return s_canDlcToLength[dlc & 0x0FU];
+}
+
+/**
+ * @brief Convert payload length to DLC code
+ */
+uint8_t CAN_LengthToDlc(uint8_t length)
+{
+    uint8_t dlc = 0U;
+    
+    while ((dlc < 15U) && (s_canDlcToLength[dlc] < length)) {
+        dlc++;
+    }
+    
+    return dlc;
+}
+
+/**
+ * @brief Send CAN FD message
+ */
+status_t CAN_SendFd(uint8_t instance, uint8_t mbIndex, const can_fd_message_t *message)
+{
+    CAN_Type *base;
+    uint32_t mbOffset;
+    uint32_t cs, id;
+    uint32_t word;
+    uint8_t dlc;
+    uint8_t frameLength;
+    uint8_t i, j;
+    
+    /* Validate parameters */
+    if (instance != CAN_FD_INSTANCE || message == NULL) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    if (!s_canInitialized[instance] || !s_canFdEnabled[instance]) {
+        return STATUS_NOT_INITIALIZED;
+    }
+    
+    if ((mbIndex >= CAN_GetFdMbCount(s_canFdPayload[instance])) ||
+        (mbIndex >= s_canActiveMbCount[instance])) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    if (message->dataLength > (8U << (uint32_t)s_canFdPayload[instance]) ||
+        message->dataLength > (message->isFd ? CAN_FD_MAX_DATA_LENGTH : CAN_MAX_DATA_LENGTH)) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    base = s_canBases[instance];
+    mbOffset = CAN_GetFdMbOffset(instance, mbIndex);
+    
+    dlc = CAN_LengthToDlc(message->dataLength);
+    frameLength = CAN_DlcToLength(dlc);
+    
+    /* Clear interrupt flag */
+    base->IFLAG1 = (1UL << mbIndex);
+    
+    /* Write data words (big-endian), pad up to the DLC length with zeros */
+    for (i = 0U; i < frameLength; i += 4U) {
+        word = 0U;
+        for (j = 0U; j < 4U; j++) {
+            if ((uint8_t)(i + j) < message->dataLength) {
+                word |= (uint32_t)message->data[i + j] << (24U - (j * 8U));
+            }
+        }
+        base->RAMn[mbOffset + 2U + (i / 4U)] = word;
+    }
+    
+    /* Configure ID word */
+    if (message->idType == CAN_ID_STD) {
+        id = (message->id << CAN_ID_STD_SHIFT) & CAN_ID_STD_MASK;
+    } else {
+        id = (message->id << CAN_ID_EXT_SHIFT) & CAN_ID_EXT_MASK;
+    }
+    base->RAMn[mbOffset + 1U] = id;
+    
+    /* Configure CS word and activate transmission */
+    cs = (CAN_CS_CODE_TX_DATA << CAN_CS_CODE_SHIFT) |
+         ((uint32_t)dlc << CAN_WMBn_CS_DLC_SHIFT);
+    
+    if (message->idType == CAN_ID_EXT) {
+        cs |= CAN_WMBn_CS_IDE_MASK;
+    } else {
+        cs |= CAN_WMBn_CS_SRR_MASK;
+    }
+    
+    if (message->isFd) {
+        cs |= CAN_CS_EDL_MASK;
+        if (message->brs) {
+            cs |= CAN_CS_BRS_MASK;
+        }
+    }
+    
+    base->RAMn[mbOffset + 0U] = cs;
+    CAN_STATS_TX(instance, mbIndex, message);
+    
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Receive CAN FD message
+ */
+status_t CAN_ReceiveFd(uint8_t instance, uint8_t mbIndex, can_fd_message_t *message)
+{
+    CAN_Type *base;
+    uint32_t mbOffset;
+    uint32_t mbMask;
+    uint32_t cs, id;
+    uint32_t word = 0U;
+    uint8_t maxLength;
+    uint8_t i;
+    
+    /* Validate parameters */
+    if (instance != CAN_FD_INSTANCE || message == NULL) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    if (!s_canInitialized[instance] || !s_canFdEnabled[instance]) {
+        return STATUS_NOT_INITIALIZED;
+    }
+    
+    if ((mbIndex >= CAN_GetFdMbCount(s_canFdPayload[instance])) ||
+        (mbIndex >= s_canActiveMbCount[instance])) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    base = s_canBases[instance];
+    mbMask = (1UL << mbIndex);
+    mbOffset = CAN_GetFdMbOffset(instance, mbIndex);
+    
+    /* Check if message available */
+    if ((base->IFLAG1 & mbMask) == 0U) {
+        return STATUS_ERROR;
+    }
+    
+    /* Read CS word (locks the MB) */
+    cs = base->RAMn[mbOffset + 0U];
+    id = base->RAMn[mbOffset + 1U];
+    
+    if (cs & CAN_WMBn_CS_IDE_MASK) {
+        message->idType = CAN_ID_EXT;
+        message->id = (id & CAN_ID_EXT_MASK) >> CAN_ID_EXT_SHIFT;
+    } else {
+        message->idType = CAN_ID_STD;
+        message->id = (id & CAN_ID_STD_MASK) >> CAN_ID_STD_SHIFT;
+    }
+    
+    message->isFd = ((cs & CAN_CS_EDL_MASK) != 0U);
+    message->brs = ((cs & CAN_CS_BRS_MASK) != 0U);
+    message->dataLength = CAN_DlcToLength((uint8_t)((cs & CAN_WMBn_CS_DLC_MASK) >> CAN_WMBn_CS_DLC_SHIFT));
+    
+    /* Classic frames carry at most 8 bytes, MB holds at most its payload size */
+    maxLength = message->isFd ? (uint8_t)(8U << (uint32_t)s_canFdPayload[instance]) : CAN_MAX_DATA_LENGTH;
+    if (message->dataLength > maxLength) {
+        message->dataLength = maxLength;
+    }
+    
+    /* Read data words (big-endian) */
+    for (i = 0U; i < message->dataLength; i++) {
+        if ((i % 4U) == 0U) {
+            word = base->RAMn[mbOffset + 2U + (i / 4U)];
+        }
+        message->data[i] = (uint8_t)(word >> (24U - ((i % 4U) * 8U)));
+    }
+    
+    /* Read free running timer to unlock MB */
+    (void)base->TIMER;
+    
+    /* Clear interrupt flag */
+    base->IFLAG1 = mbMask;
+    
+    CAN_STATS_RX(instance, mbIndex, message);
+    
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Setup RX Mailbox in FD layout
+ */
+status_t CAN_SetupFdRxMailbox(uint8_t instance, uint8_t mbIndex,
+                              uint32_t id, can_id_type_t idType, uint32_t mask)
+{
+    CAN_Type *base;
+    uint32_t mbOffset;
+    uint32_t mbWords;
+    uint32_t cs, idWord;
+    uint32_t i;
+    
+    /* Validate parameters */
+    if (instance != CAN_FD_INSTANCE) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    if (!s_canInitialized[instance] || !s_canFdEnabled[instance]) {
+        return STATUS_NOT_INITIALIZED;
+    }
+    
+    if ((mbIndex >= CAN_GetFdMbCount(s_canFdPayload[instance])) ||
+        (mbIndex >= s_canActiveMbCount[instance])) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    base = s_canBases[instance];
+    mbOffset = CAN_GetFdMbOffset(instance, mbIndex);
+    mbWords = 2U + ((8UL << (uint32_t)s_canFdPayload[instance]) / 4U);
+    
+    /* Enter freeze mode to configure */
+    if (CAN_EnterFreezeMode(base) != STATUS_SUCCESS) {
+        return STATUS_TIMEOUT;
+    }
+    
+    /* Clear Message Buffer */
+    for (i = 0U; i < mbWords; i++) {
+        base->RAMn[mbOffset + i] = 0U;
+    }
+    
+    /* Configure ID word and individual mask */
+    if (idType == CAN_ID_EXT) {
+        idWord = (id << CAN_ID_EXT_SHIFT) & CAN_ID_EXT_MASK;
+    } else {
+        idWord = (id << CAN_ID_STD_SHIFT) & CAN_ID_STD_MASK;
+    }
+    base->RXIMR[mbIndex] = CAN_EncodeMbMask(mask, idType);
+    base->RAMn[mbOffset + 1U] = idWord;
+    
+    /* Configure CS word as RX EMPTY */
+    cs = (CAN_CS_CODE_RX_EMPTY << CAN_CS_CODE_SHIFT);
+    if (idType == CAN_ID_EXT) {
+        cs |= CAN_WMBn_CS_IDE_MASK;
+    }
+    base->RAMn[mbOffset + 0U] = cs;
+    
+    /* Clear interrupt flag */
+    base->IFLAG1 = (1UL << mbIndex);
+    
+    /* Exit freeze mode */
+    if (CAN_ExitFreezeMode(base) != STATUS_SUCCESS) {
+        return STATUS_TIMEOUT;
+    }
+    
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Configure Pretended Networking filters
+ */
+status_t CAN_ConfigPretendedNetworking(uint8_t instance, const can_pn_config_t *config)
+{
+    CAN_Type *base;
+    status_t status;
+    uint32_t idShift;
+    uint32_t idMask;
+    uint32_t fltId;
+    uint32_t ctrl1Pn;
+    uint32_t words[2];
+    
+    /* Validate parameters */
+    if (instance != CAN_PN_INSTANCE || config == NULL) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    if (!s_canInitialized[instance]) {
+        return STATUS_NOT_INITIALIZED;
+    }
+    
+    if (config->dlcLow > config->dlcHigh || config->dlcHigh > CAN_MAX_DATA_LENGTH ||
+        config->combination > CAN_PN_MATCH_ID_PAYLOAD_N ||
+        config->idFilterMode > CAN_PN_FILTER_RANGE ||
+        config->payloadFilterMode > CAN_PN_FILTER_RANGE) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    base = s_canBases[instance];
+    
+    if (config->idType == CAN_ID_EXT) {
+        idShift = CAN_ID_EXT_SHIFT;
+        idMask = CAN_ID_EXT_MASK;
+    } else {
+        idShift = CAN_ID_STD_SHIFT;
+        idMask = CAN_ID_STD_MASK;
+    }
+    
+    /* Enter freeze mode to change configuration */
+    status = CAN_EnterFreezeMode(base);
+    if (status != STATUS_SUCCESS) {
+        return STATUS_TIMEOUT;
+    }
+    
+    ctrl1Pn = CAN_CTRL1_PN_FCS(config->combination) |
+              CAN_CTRL1_PN_IDFS(config->idFilterMode) |
+              CAN_CTRL1_PN_PLFS(config->payloadFilterMode) |
+              CAN_CTRL1_PN_NMATCH((config->matchCount != 0U) ? config->matchCount : 1U) |
+              CAN_CTRL1_PN_WUMF_MSK(config->enableMatchWakeup ? 1U : 0U) |
+              CAN_CTRL1_PN_WTOF_MSK(config->enableTimeoutWakeup ? 1U : 0U);
+    base->CTRL1_PN = ctrl1Pn;
+    base->CTRL2_PN = CAN_CTRL2_PN_MATCHTO(config->timeout);
+    
+    /* ID filter 1, IDE must match the configured frame format */
+    fltId = ((config->id << idShift) & idMask);
+    if (config->idType == CAN_ID_EXT) {
+        fltId |= CAN_FLT_ID1_FLT_IDE_MASK;
+    }
+    base->FLT_ID1 = fltId;
+    
+    /* ID filter 2: mask in EXACT mode (IDE/RTR compared), upper bound in RANGE */
+    fltId = ((config->idMaskOrUpper << idShift) & idMask);
+    if (config->idFilterMode == CAN_PN_FILTER_EXACT) {
+        fltId |= CAN_FLT_ID2_IDMASK_IDE_MSK_MASK | CAN_FLT_ID2_IDMASK_RTR_MSK_MASK;
+    } else if (config->idType == CAN_ID_EXT) {
+        fltId |= CAN_FLT_ID1_FLT_IDE_MASK;
+    }
+    base->FLT_ID2_IDMASK = fltId;
+    
+    /* DLC range and payload filters (byte 0 in the MSB, as in MB data words) */
+    base->FLT_DLC = CAN_FLT_DLC_FLT_DLC_HI(config->dlcHigh) |
+                    CAN_FLT_DLC_FLT_DLC_LO(config->dlcLow);
+    memcpy(words, config->payload, CAN_MAX_DATA_LENGTH);
+    base->PL1_LO = CAN_SwapBytes32(words[0]);
+    base->PL1_HI = CAN_SwapBytes32(words[1]);
+    memcpy(words, config->payloadMaskOrUpper, CAN_MAX_DATA_LENGTH);
+    base->PL2_PLMASK_LO = CAN_SwapBytes32(words[0]);
+    base->PL2_PLMASK_HI = CAN_SwapBytes32(words[1]);
+    
+    /* Exit freeze mode */
+    status = CAN_ExitFreezeMode(base);
+    if (status != STATUS_SUCCESS) {
+        return STATUS_TIMEOUT;
+    }
+    
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Arm Pretended Networking before low-power entry
+ */
+status_t CAN_EnterPretendedNetworking(uint8_t instance)
+{
+    CAN_Type *base;
+    status_t status;
+    
+    if (instance != CAN_PN_INSTANCE) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    if (!s_canInitialized[instance]) {
+        return STATUS_NOT_INITIALIZED;
+    }
+    
+    base = s_canBases[instance];
+    
+    /* Bus clock is gated in VLPS, PN needs the oscillator clock */
+    if ((base->CTRL1 & CAN_CTRL1_CLKSRC_MASK) != 0U) {
+        return STATUS_ERROR;
+    }
+    
+    /* Discard wakeup flags from a previous sleep */
+    base->WU_MTC = CAN_WU_MTC_WUMF_MASK | CAN_WU_MTC_WTOF_MASK;
+    
+    status = CAN_EnterFreezeMode(base);
+    if (status != STATUS_SUCCESS) {
+        return STATUS_TIMEOUT;
+    }
+    
+    base->MCR |= CAN_MCR_PNET_EN_MASK;
+    
+    status = CAN_ExitFreezeMode(base);
+    if (status != STATUS_SUCCESS) {
+        return STATUS_TIMEOUT;
+    }
+    
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Disarm Pretended Networking after wakeup
+ */
+status_t CAN_ExitPretendedNetworking(uint8_t instance)
+{
+    CAN_Type *base;
+    status_t status;
+    
+    if (instance != CAN_PN_INSTANCE) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    if (!s_canInitialized[instance]) {
+        return STATUS_NOT_INITIALIZED;
+    }
+    
+    base = s_canBases[instance];
+    
+    status = CAN_EnterFreezeMode(base);
+    if (status != STATUS_SUCCESS) {
+        return STATUS_TIMEOUT;
+    }
+    
+    base->MCR &= ~CAN_MCR_PNET_EN_MASK;
+    
+    status = CAN_ExitFreezeMode(base);
+    if (status != STATUS_SUCCESS) {
+        return STATUS_TIMEOUT;
+    }
+    
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Get Pretended Networking wakeup status
+ */
+status_t CAN_GetPnWakeupStatus(uint8_t instance, uint32_t *wakeupFlags, uint8_t *matchCount)
+{
+    uint32_t wuMtc;
+    
+    if (instance != CAN_PN_INSTANCE || wakeupFlags == NULL) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    wuMtc = s_canBases[instance]->WU_MTC;
+    
+    *wakeupFlags = wuMtc & (CAN_WU_MTC_WUMF_MASK | CAN_WU_MTC_WTOF_MASK);
+    if (matchCount != NULL) {
+        *matchCount = (uint8_t)((wuMtc & CAN_WU_MTC_MCOUNTER_MASK) >> CAN_WU_MTC_MCOUNTER_SHIFT);
+    }
+    
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Read a frame stored in a wakeup message buffer
+ */
+status_t CAN_ReadWakeupMessage(uint8_t instance, uint8_t wmbIndex, can_message_t *message)
+{
+    CAN_Type *base;
+    uint32_t cs;
+    uint32_t id;
+    uint32_t words[2];
+    uint8_t dlc;
+    
+    if (instance != CAN_PN_INSTANCE || wmbIndex >= CAN_PN_WMB_COUNT || message == NULL) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    base = s_canBases[instance];
+    
+    cs = base->WMB[wmbIndex].WMBn_CS;
+    id = base->WMB[wmbIndex].WMBn_ID;
+    
+    if ((cs & CAN_WMBn_CS_IDE_MASK) != 0U) {
+        message->idType = CAN_ID_EXT;
+        message->id = (id & CAN_ID_EXT_MASK) >> CAN_ID_EXT_SHIFT;
+    } else {
+        message->idType = CAN_ID_STD;
+        message->id = (id & CAN_ID_STD_MASK) >> CAN_ID_STD_SHIFT;
+    }
+    
+    message->frameType = ((cs & CAN_WMBn_CS_RTR_MASK) != 0U) ? CAN_FRAME_REMOTE : CAN_FRAME_DATA;
+    
+    dlc = (uint8_t)((cs & CAN_WMBn_CS_DLC_MASK) >> CAN_WMBn_CS_DLC_SHIFT);
+    message->dataLength = (dlc > CAN_MAX_DATA_LENGTH) ? CAN_MAX_DATA_LENGTH : dlc;
+    
+    words[0] = CAN_SwapBytes32(base->WMB[wmbIndex].WMBn_D03);
+    words[1] = CAN_SwapBytes32(base->WMB[wmbIndex].WMBn_D47);
+    memcpy(message->data, words, CAN_MAX_DATA_LENGTH);
+    
+    /* WMB frames carry no time stamp */
+    message->timeStamp = 0U;
+    message->timestampUs = 0U;
+    
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Install Pretended Networking wakeup callback
+ */
+status_t CAN_InstallWakeupCallback(uint8_t instance,
+                                   can_wakeup_callback_t callback, void *userData)
+{
+    if (instance != CAN_PN_INSTANCE) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    s_wakeupCallbacks[instance] = callback;
+    s_wakeupUserData[instance] = userData;
+    
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Handle CAN Pretended Networking wakeup interrupt
+ */
+void CAN_WakeupIRQHandler(uint8_t instance)
+{
+    CAN_Type *base;
+    uint32_t flags;
+    
+    if (instance != CAN_PN_INSTANCE) {
+        return;
+    }
+    
+    base = s_canBases[instance];
+    
+    flags = base->WU_MTC & (CAN_WU_MTC_WUMF_MASK | CAN_WU_MTC_WTOF_MASK);
+    base->WU_MTC = flags;
+    
+    if (flags != 0U && s_wakeupCallbacks[instance] != NULL) {
+        s_wakeupCallbacks[instance](instance, flags, s_wakeupUserData[instance]);
+    }
+}
+
+#if CAN_STATISTICS_ENABLE
+/**
+ * @brief Get driver statistics
+ */
+status_t CAN_GetStatistics(uint8_t instance, can_statistics_t *stats)
+{
+    can_error_state_t errorState;
+    uint32_t totalBits = 0U;
+    uint32_t windowBits;
+    uint32_t i;
+    
+    if (instance >= CAN_INSTANCE_COUNT || stats == NULL) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    /* Sample ESR1 and error state transitions */
+    (void)CAN_GetErrorState(instance, &errorState);
+    
+    /* Bus load over the bucket window */
+    if (s_timeSource != NULL && s_canBaudRate[instance] != 0U) {
+        CAN_StatsAdvanceBuckets(instance);
+        for (i = 0U; i < CAN_STATS_BUSLOAD_BUCKETS; i++) {
+            totalBits += s_busLoadBits[instance][i];
+        }
+        
+        /* Bits the bus can carry during the window */
+        windowBits = (s_canBaudRate[instance] / 1000U) *
+                     ((CAN_STATS_BUSLOAD_BUCKETS * CAN_STATS_BUSLOAD_BUCKET_US) / 1000U);
+        s_canStats[instance].busLoadPercent =
+            (uint8_t)((totalBits >= windowBits) ? 100U : ((uint64_t)totalBits * 100U) / windowBits);
+    }
+    
+    *stats = s_canStats[instance];
+    
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Reset driver statistics
+ */
+status_t CAN_ResetStatistics(uint8_t instance)
+{
+    if (instance >= CAN_INSTANCE_COUNT) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    memset(&s_canStats[instance], 0, sizeof(s_canStats[instance]));
+    memset(s_busLoadBits[instance], 0, sizeof(s_busLoadBits[instance]));
+    
+    return STATUS_SUCCESS;
+}
+#endif /* CAN_STATISTICS_ENABLE */
+
+/**
+ * @brief Handle CAN Message Buffer interrupt
+ */
+void CAN_IRQHandler(uint8_t instance)
+{
+    if (instance >= CAN_INSTANCE_COUNT) {
+        return;
+    }
+    
+    CAN_DispatchMbIrq(instance, CAN_IRQ_MB_ALL_MASK);
+}
+
+/**
+ * @brief Handle CAN Message Buffer 0-15 interrupt
+ */
+void CAN_IRQHandler_MB0_15(uint8_t instance)
+{
+    if (instance >= CAN_INSTANCE_COUNT) {
+        return;
+    }
+    
+    CAN_DispatchMbIrq(instance, CAN_IRQ_MB0_15_MASK);
+}
+
+/**
+ * @brief Handle CAN Message Buffer 16-31 interrupt
+ */
+void CAN_IRQHandler_MB16_31(uint8_t instance)
+{
+    if (instance >= CAN_INSTANCE_COUNT) {
+        return;
+    }
+    
+    CAN_DispatchMbIrq(instance, CAN_IRQ_MB16_31_MASK);
+}
+
+/**
+ * @brief Handle CAN bus-off / error interrupt
+ */
+void CAN_ErrorIRQHandler(uint8_t instance)
+{
+    CAN_Type *base;
+    uint32_t esr1;
+    uint32_t flags;
+    uint32_t busy;
+    uint32_t basepri;
+    uint8_t mbIdx;
+    
+    if (instance >= CAN_INSTANCE_COUNT) {
+        return;
+    }
+    
+    base = s_canBases[instance];
+    
+    /* Reading ESR1 clears the error bits: count statistics before they are lost */
+    esr1 = base->ESR1;
+    CAN_STATS_ESR1(instance, esr1);
+    
+    flags = esr1 & (CAN_ESR1_ERRINT_MASK | CAN_ESR1_BOFFINT_MASK |
+                    CAN_ESR1_RWRNINT_MASK | CAN_ESR1_TWRNINT_MASK |
+                    CAN_ESR1_BOFFDONEINT_MASK | CAN_ESR1_ERROVR_MASK);
+    base->ESR1 = flags;     /* W1C */
+    
+    if ((flags & (CAN_ESR1_BOFFINT_MASK | CAN_ESR1_BOFFDONEINT_MASK)) != 0U) {
+        /* The MB ISR (higher priority) also modifies the TX queue */
+        basepri = NVIC_EnterCritical();
+        
+        if ((flags & CAN_ESR1_BOFFINT_MASK) != 0U) {
+#if CAN_STATISTICS_ENABLE
+            if (s_lastErrorState[instance] != CAN_ERROR_BUS_OFF) {
+                s_canStats[instance].busOffCount++;
+                s_lastErrorState[instance] = CAN_ERROR_BUS_OFF;
+            }
+#endif
+            if (s_busOffTxPolicy[instance] == CAN_BUSOFF_TX_FLUSH) {
+                /* Deactivate pending MBs: no stale frames are sent after recovery */
+                busy = s_txQueueBusyMask[instance];
+                for (mbIdx = 0U; busy != 0U; mbIdx++) {
+                    if ((busy & (1UL << mbIdx)) != 0U) {
+                        CAN_WriteMbCs(base, mbIdx, (CAN_CS_CODE_TX_INACTIVE << CAN_CS_CODE_SHIFT));
+                        busy &= ~(1UL << mbIdx);
+                    }
+                }
+                base->IFLAG1 = s_txQueueBusyMask[instance];
+                s_txQueueBusyMask[instance] = 0U;
+                s_txQueueCount[instance] = 0U;
+            }
+        }
+        
+        if ((flags & CAN_ESR1_BOFFDONEINT_MASK) != 0U) {
+            /* Manual mode: the next bus off waits for CAN_RecoverFromBusOff() again */
+            if (s_busOffRecovery[instance] == CAN_BUSOFF_RECOVERY_MANUAL) {
+                base->CTRL1 |= CAN_CTRL1_BOFFREC_MASK;
+            }
+#if CAN_STATISTICS_ENABLE
+            s_lastErrorState[instance] = CAN_ERROR_ACTIVE;
+#endif
+            if (s_txQueuePoolMask[instance] != 0U) {
+                CAN_TxQueueLoad(instance);
+            }
+        }
+        
+        NVIC_ExitCritical(basepri);
+    }
+    
+    if (flags != 0U && s_errorCallbacks[instance] != NULL) {
+        s_errorCallbacks[instance](instance, flags, s_errorUserData[instance]);
+    }
+}
+
+/* Bus-off / error vectors: instance is a constant */
+static void CAN0_ErrorVector(void) { CAN_ErrorIRQHandler(0U); }
+static void CAN1_ErrorVector(void) { CAN_ErrorIRQHandler(1U); }
+static void CAN2_ErrorVector(void) { CAN_ErrorIRQHandler(2U); }
+
+/**
+ * @brief Install bus-off / error handlers in the RAM vector table
+ */
+status_t CAN_InstallErrorIrqHandlers(uint8_t instance)
+{
+    static const IRQn_Type oredIrq[CAN_INSTANCE_COUNT] = {
+        CAN0_ORed_IRQn, CAN1_ORed_IRQn, CAN2_ORed_IRQn
+    };
+    static const IRQn_Type errorIrq[CAN_INSTANCE_COUNT] = {
+        CAN0_Error_IRQn, CAN1_Error_IRQn, CAN2_Error_IRQn
+    };
+    static const nvic_handler_t vectors[CAN_INSTANCE_COUNT] = {
+        CAN0_ErrorVector, CAN1_ErrorVector, CAN2_ErrorVector
+    };
+    nvic_status_t status;
+    
+    if (instance >= CAN_INSTANCE_COUNT) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    status = NVIC_InstallHandler(oredIrq[instance], vectors[instance]);
+    if (status == NVIC_STATUS_SUCCESS) {
+        status = NVIC_InstallHandler(errorIrq[instance], vectors[instance]);
+    }
+    
+    return (status == NVIC_STATUS_SUCCESS) ? STATUS_SUCCESS : STATUS_ERROR;
+}
+
+/* Message Buffer vectors: instance and group are constants */
+HAL_RAMFUNC static void CAN0_Mb0_15Vector(void)  { CAN_DispatchMbIrq(0U, CAN_IRQ_MB0_15_MASK); }
+HAL_RAMFUNC static void CAN0_Mb16_31Vector(void) { CAN_DispatchMbIrq(0U, CAN_IRQ_MB16_31_MASK); }
+HAL_RAMFUNC static void CAN1_Mb0_15Vector(void)  { CAN_DispatchMbIrq(1U, CAN_IRQ_MB0_15_MASK); }
+HAL_RAMFUNC static void CAN2_Mb0_15Vector(void)  { CAN_DispatchMbIrq(2U, CAN_IRQ_MB0_15_MASK); }
+
+/**
+ * @brief Install Message Buffer handlers in the RAM vector table
+ */
+status_t CAN_InstallIrqHandlers(uint8_t instance)
+{
+    nvic_status_t status;
+    
+    switch (instance) {
+        case 0U:
+            status = NVIC_InstallHandler(CAN0_ORed_0_15_MB_IRQn, CAN0_Mb0_15Vector);
+            if (status == NVIC_STATUS_SUCCESS) {
+                status = NVIC_InstallHandler(CAN0_ORed_16_31_MB_IRQn, CAN0_Mb16_31Vector);
+            }
+            break;
+        case 1U:
+            status = NVIC_InstallHandler(CAN1_ORed_0_15_MB_IRQn, CAN1_Mb0_15Vector);
+            break;
+        case 2U:
+            status = NVIC_InstallHandler(CAN2_ORed_0_15_MB_IRQn, CAN2_Mb0_15Vector);
+            break;
+        default:
+            return STATUS_INVALID_PARAM;
+    }
+    
+    return (status == NVIC_STATUS_SUCCESS) ? STATUS_SUCCESS : STATUS_ERROR;
+}
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Enter freeze mode
+ */
+static status_t CAN_EnterFreezeMode(CAN_Type *base)
+{
+    uint32_t timeout = CAN_FREEZE_TIMEOUT;
+    
+    /* Request freeze mode */
+    base->MCR |= (CAN_MCR_FRZ_MASK | CAN_MCR_HALT_MASK);
+    
+    /* Wait for freeze mode acknowledge */
+    while ((timeout > 0U) && ((base->MCR & CAN_MCR_FRZACK_MASK) == 0U)) {
+        timeout--;
+    }
+    
+    if (timeout == 0U) {
+        return STATUS_TIMEOUT;
+    }
+    
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Exit freeze mode
+ */
+static status_t CAN_ExitFreezeMode(CAN_Type *base)
+{
+    uint32_t timeout = CAN_FREEZE_TIMEOUT;
+    
+    /* Clear freeze and halt bits */
+    base->MCR &= ~(CAN_MCR_FRZ_MASK | CAN_MCR_HALT_MASK);
+    
+    /* Wait for module ready */
+    while ((timeout > 0U) && ((base->MCR & CAN_MCR_FRZACK_MASK) != 0U)) {
+        timeout--;
+    }
+    
+    if (timeout == 0U) {
+        return STATUS_TIMEOUT;
+    }
+    
+    /* Wait for module not ready flag to clear */
+    timeout = CAN_FREEZE_TIMEOUT;
+    while ((timeout > 0U) && ((base->MCR & CAN_MCR_NOTRDY_MASK) != 0U)) {
+        timeout--;
+    }
+    
+    if (timeout == 0U) {
+        return STATUS_TIMEOUT;
+    }
+    
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Soft reset CAN module
+ */
+static status_t CAN_SoftReset(CAN_Type *base)
+{
+    uint32_t timeout = CAN_FREEZE_TIMEOUT;
+    
+    /* Request soft reset */
+    base->MCR |= CAN_MCR_SOFTRST_MASK;
+    
+    /* Wait for reset to complete */
+    while ((timeout > 0U) && ((base->MCR & CAN_MCR_SOFTRST_MASK) != 0U)) {
+        timeout--;
+    }
+    
+    if (timeout == 0U) {
+        return STATUS_TIMEOUT;
+    }
+    
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Enable CAN peripheral clock
+ * @details Enables clock through PCC module and configures CAN clock source
+ */
+static void CAN_EnableClock(uint8_t instance, can_clk_src_t clockSource)
+{
+    CAN_Type *base;
+    
+    base = s_canBases[instance];
+    
+    /* Enable CAN clock through PCC module */
+    PCC_EnableCANClock(instance, clockSource);
+
+    /* MDIS=1: Disable module before selecting clock */
+    base->MCR |= CAN_MCR_MDIS_MASK; 
+
+    /* Select clock source in CTRL1 register */ 
+    if (clockSource == CAN_CLK_SRC_SOSCDIV2) {
+        base->CTRL1 &= ~CAN_CTRL1_CLKSRC_MASK; /* CLKSRC=0: Clock Source = oscillator */
+    } else {
+        base->CTRL1 |= CAN_CTRL1_CLKSRC_MASK; /* CLKSRC=1: Clock Source = bus clock */
+    }
+
+    /* MDIS=0: Enable module config. (Sets FRZ, HALT) */
+    base->MCR &= ~CAN_MCR_MDIS_MASK;
+}
+
+/**
+ * @brief Initialize the active Message Buffers to inactive
+ * @note MBs above MAXMB are never scanned, their RAM is left as is
+ */
+static void CAN_InitMessageBuffers(CAN_Type *base, uint8_t mbCount)
+{
+    uint32_t i;
+    
+    /* Clear active msg bufs x 4 words/msg buf */
+    for (i = 0; i < ((uint32_t)mbCount * MSG_BUF_SIZE); i++) {
+        base->RAMn[i] = 0;
+    }
+    
+    /* In FRZ mode, init the individual masks of the active MBs (FIFO filters use RXIMR0-7) */
+    for (i = 0; i < mbCount; i++) {
+        /* Check all ID bits for incoming messages */
+        base->RXIMR[i] = 0xFFFFFFFFUL;
+    }
+    
+    /* Clear all interrupt flags 
+        This reg is w1c*/
+    base->IFLAG1 = 0xFFFFFFFFUL;
+}
+
+/**
+ * @brief Set CAN operating mode
+ */
+status_t CAN_SetOperatingMode(uint8_t instance, can_mode_t mode)
+{
+    CAN_Type *base;
+    status_t status;
+    
+    /* Validate parameters */
+    if (instance >= CAN_INSTANCE_COUNT) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    if (!s_canInitialized[instance]) {
+        return STATUS_NOT_INITIALIZED;
+    }
+    
+    if (mode > CAN_MODE_LISTEN_ONLY) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    base = s_canBases[instance];
+    
+    /* Enter freeze mode to change configuration */
+    status = CAN_EnterFreezeMode(base);
+    if (status != STATUS_SUCCESS) {
+        return STATUS_TIMEOUT;
+    }
+    
+    /* Clear existing mode bits */
+    base->CTRL1 &= ~(CAN_CTRL1_LPB_MASK | CAN_CTRL1_LOM_MASK);
+    
+    /* Set new operating mode */
+    if (mode == CAN_MODE_LOOPBACK) {
+        base->CTRL1 |= CAN_CTRL1_LPB_MASK;  /* Enable loopback mode */
+    } else if (mode == CAN_MODE_LISTEN_ONLY) {
+        base->CTRL1 |= CAN_CTRL1_LOM_MASK;  /* Enable listen-only mode */
+    }
+    /* For CAN_MODE_NORMAL, both bits remain 0 */
+    
+    /* Exit freeze mode */
+    status = CAN_ExitFreezeMode(base);
+    if (status != STATUS_SUCCESS) {
+        return STATUS_TIMEOUT;
+    }
+    
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Configure TX Mailbox
+ * @param instance CAN instance number (0-2)
+ * @param mbIndex Message Buffer index to configure for TX
+ * @return STATUS_SUCCESS if successful, error code otherwise
+ */
+static status_t CAN_ConfigTxMailbox(uint8_t instance, uint8_t mbIndex)
+{
+    CAN_Type *base;
+    uint32_t mbOffset;
+    
+    /* Validate parameters */
+    if (instance >= CAN_INSTANCE_COUNT) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    if (mbIndex >= s_canActiveMbCount[instance]) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    if (!s_canInitialized[instance]) {
+        return STATUS_NOT_INITIALIZED;
+    }
+    
+    base = s_canBases[instance];
+    mbOffset = mbIndex * MSG_BUF_SIZE;
+    
+    /* Enter freeze mode to configure */
+    if (CAN_EnterFreezeMode(base) != STATUS_SUCCESS) {
+        return STATUS_TIMEOUT;
+    }
+    
+    /* Clear Message Buffer */
+    base->RAMn[mbOffset + 0] = 0U;  /* CS - set to INACTIVE */
+    base->RAMn[mbOffset + 1] = 0U;  /* ID */
+    base->RAMn[mbOffset + 2] = 0U;  /* DATA0 */
+    base->RAMn[mbOffset + 3] = 0U;  /* DATA1 */
+    
+    /* Set MB code to TX_INACTIVE */
+    base->RAMn[mbOffset + 0] = (CAN_CS_CODE_TX_INACTIVE << CAN_CS_CODE_SHIFT);
+    
+    /* Clear interrupt flag */
+    base->IFLAG1 = (1UL << mbIndex);
+    
+    /* Exit freeze mode */
+    if (CAN_ExitFreezeMode(base) != STATUS_SUCCESS) {
+        return STATUS_TIMEOUT;
+    }
+    
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Configure RX Mailbox
+ * @param instance CAN instance number (0-2)
+ * @param mbIndex Message Buffer index to configure for RX
+ * @param id CAN ID to filter
+ * @param idType Standard or Extended ID
+ * @param mask Filter mask (1=care, 0=don't care)
+ * @return STATUS_SUCCESS if successful, error code otherwise
+ */
+static status_t CAN_ConfigRxMailbox(uint8_t instance, uint8_t mbIndex, 
+                                    uint32_t id, can_id_type_t idType, uint32_t mask)
+{
+    CAN_Type *base;
+    uint32_t mbOffset;
+    uint32_t cs, idWord;
+    
+    /* Validate parameters */
+    if (instance >= CAN_INSTANCE_COUNT) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    if (mbIndex >= s_canActiveMbCount[instance]) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    if (!s_canInitialized[instance]) {
+        return STATUS_NOT_INITIALIZED;
+    }
+    
+    base = s_canBases[instance];
+    mbOffset = mbIndex * MSG_BUF_SIZE;
+    
+    /* Enter freeze mode to configure */
+    if (CAN_EnterFreezeMode(base) != STATUS_SUCCESS) {
+        return STATUS_TIMEOUT;
+    }
+    
+    /* Clear Message Buffer */
+    base->RAMn[mbOffset + 0] = 0U;  /* CS */
+    base->RAMn[mbOffset + 1] = 0U;  /* ID */
+    base->RAMn[mbOffset + 2] = 0U;  /* DATA0 */
+    base->RAMn[mbOffset + 3] = 0U;  /* DATA1 */
+    
+    /* Configure ID word */
+    if (idType == CAN_ID_EXT) {
+        idWord = (id << CAN_ID_EXT_SHIFT) & CAN_ID_EXT_MASK;
+    } else {
+        idWord = (id << CAN_ID_STD_SHIFT) & CAN_ID_STD_MASK;
+    }
+    base->RAMn[mbOffset + 1] = idWord;
+    
+    /* Configure individual mask */
+    base->RXIMR[mbIndex] = CAN_EncodeMbMask(mask, idType);
+    
+    /* Configure CS word as RX EMPTY */
+    cs = (CAN_CS_CODE_RX_EMPTY << CAN_CS_CODE_SHIFT);
+    if (idType == CAN_ID_EXT) {
+        cs |= CAN_WMBn_CS_IDE_MASK;
+    }
+    base->RAMn[mbOffset + 0] = cs;
+    
+    /* Clear interrupt flag */
+    base->IFLAG1 = (1UL << mbIndex);
+    
+    /* Exit freeze mode */
+    if (CAN_ExitFreezeMode(base) != STATUS_SUCCESS) {
+        return STATUS_TIMEOUT;
+    }
+    
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Get clock frequency from clock source
+ */
+static uint32_t CAN_GetClockFrequency(can_clk_src_t clockSource)
+{
+    uint32_t freq;
+    
+    /* Live SCG values, typical values only while SCG reports nothing */
+    switch (clockSource) {
+        case CAN_CLK_SRC_SOSCDIV2:
+            freq = PCC_GetSoscDiv2Freq();
+            if (freq == 0U) {
+                freq = 4000000U;    /* 8 MHz / 2 = 4 MHz typical */
+            }
+            break;
+        case CAN_CLK_SRC_BUSCLOCK:
+            freq = ClockManager_GetBusFreq();
+            if (freq == 0U) {
+                freq = 40000000U;   /* 80 MHz / 2 = 40 MHz typical */
+            }
+            break;
+        default:
+            freq = CAN_DEFAULT_CLK_FREQ;
+            break;
+    }
+    
+    return freq;
+}
+
+/**
+ * @brief Calculate FD nominal and data phase timing
+ * @param dataRate Data phase bitrate, 0 = no bit rate switch (FDCBT unused)
+ */
+static status_t CAN_CalcFdTiming(uint32_t canClockHz, uint32_t nominalRate, uint32_t dataRate,
+                                 can_phase_timing_t *nominal, can_phase_timing_t *data)
+{
+    if (CAN_CalcPhaseTiming(canClockHz, nominalRate, &s_canNominalLimits, nominal) != STATUS_SUCCESS) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    if (dataRate != 0U) {
+        return CAN_CalcPhaseTiming(canClockHz, dataRate, &s_canDataLimits, data);
+    }
+    
+    /* No bit rate switch: data phase runs at nominal rate, FDCBT unused */
+    data->preDiv = 1U;
+    data->propSeg = 0U;
+    data->phaseSeg1 = 1U;
+    data->phaseSeg2 = 2U;
+    data->rJumpWidth = 1U;
+    
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Write CBT / FDCBT (freeze mode)
+ * @return FDCTRL bit rate switch and delay compensation bits
+ */
+static uint32_t CAN_WriteFdTiming(CAN_Type *base, const can_phase_timing_t *nominal,
+                                  const can_phase_timing_t *data, bool enableBrs)
+{
+    uint32_t fdctrl = 0U;
+    uint32_t tdcOffset;
+    
+    /* Nominal phase via CBT (overrides CTRL1 timing fields) */
+    base->CBT = CAN_CBT_BTF_MASK |
+                CAN_CBT_EPRESDIV(nominal->preDiv - 1U) |
+                CAN_CBT_ERJW(nominal->rJumpWidth - 1U) |
+                CAN_CBT_EPROPSEG(nominal->propSeg - 1U) |
+                CAN_CBT_EPSEG1(nominal->phaseSeg1 - 1U) |
+                CAN_CBT_EPSEG2(nominal->phaseSeg2 - 1U);
+    
+    /* Data phase via FDCBT */
+    base->FDCBT = CAN_FDCBT_FPRESDIV(data->preDiv - 1U) |
+                  CAN_FDCBT_FRJW(data->rJumpWidth - 1U) |
+                  CAN_FDCBT_FPROPSEG(data->propSeg) |
+                  CAN_FDCBT_FPSEG1(data->phaseSeg1 - 1U) |
+                  CAN_FDCBT_FPSEG2(data->phaseSeg2 - 1U);
+    
+    if (enableBrs) {
+        fdctrl |= CAN_FDCTRL_FDRATE_MASK;
+        
+        /* Secondary sample point at data phase sample point, if it fits TDCOFF */
+        tdcOffset = (data->propSeg + data->phaseSeg1 + 1U) * data->preDiv;
+        if (tdcOffset <= (CAN_FDCTRL_TDCOFF_MASK >> CAN_FDCTRL_TDCOFF_SHIFT)) {
+            fdctrl |= CAN_FDCTRL_TDCEN_MASK | CAN_FDCTRL_TDCOFF(tdcOffset);
+        }
+    }
+    
+    return fdctrl;
+}
+
+/**
+ * @brief Clock Manager notifier, keeps the bit rate across clock switches
+ * @details BEFORE: freeze the module (finishes the frame on the bus, then
+ *          stops participating). AFTER: if the CAN clock changed, recompute
+ *          CTRL1 (classic) or CBT / FDCBT (FD) for the stored bitrates and
+ *          leave freeze. If the new clock cannot produce the bitrate the
+ *          module stays frozen instead of disturbing the bus.
+ */
+static void CAN_ClockNotifier(clock_notify_event_t event, void *userData)
+{
+    uint8_t instance = (uint8_t)(uintptr_t)userData;
+    CAN_Type *base;
+    can_timing_config_t timing;
+    can_phase_timing_t nominal;
+    can_phase_timing_t data;
+    uint32_t canClockHz;
+    status_t status;
+    
+    if ((instance >= CAN_INSTANCE_COUNT) || !s_canInitialized[instance]) {
+        return;
+    }
+    
+    base = s_canBases[instance];
+    
+    if (event == CLOCK_NOTIFY_BEFORE) {
+        s_canClockFrozen[instance] = (CAN_EnterFreezeMode(base) == STATUS_SUCCESS);
+        return;
+    }
+    
+    canClockHz = CAN_GetClockFrequency(s_canClockSource[instance]);
+    if (canClockHz != s_canClockFreq[instance]) {
+        if (!s_canClockFrozen[instance] && (CAN_EnterFreezeMode(base) != STATUS_SUCCESS)) {
+            return;
+        }
+        s_canClockFrozen[instance] = true;
+        s_canClockFreq[instance] = canClockHz;
+        
+        if (s_canFdEnabled[instance]) {
+            status = CAN_CalcFdTiming(canClockHz, s_canBaudRate[instance],
+                                      s_canFdDataRate[instance], &nominal, &data);
+            if (status == STATUS_SUCCESS) {
+                base->FDCTRL = (base->FDCTRL & ~(CAN_FDCTRL_FDRATE_MASK | CAN_FDCTRL_TDCEN_MASK |
+                                                 CAN_FDCTRL_TDCOFF_MASK)) |
+                               CAN_WriteFdTiming(base, &nominal, &data, s_canFdDataRate[instance] != 0U);
+            }
+        } else {
+            status = CAN_CalculateTiming(canClockHz, s_canBaudRate[instance], &timing);
+            if (status == STATUS_SUCCESS) {
+                /* Timing fields only: LPB / LOM / SMP and interrupt enables stay */
+                base->CTRL1 = (base->CTRL1 & ~(CAN_CTRL1_PRESDIV_MASK | CAN_CTRL1_RJW_MASK |
+                                               CAN_CTRL1_PSEG1_MASK | CAN_CTRL1_PSEG2_MASK |
+                                               CAN_CTRL1_PROPSEG_MASK)) |
+                              ((uint32_t)timing.preDiv << CAN_CTRL1_PRESDIV_SHIFT) |
+                              ((uint32_t)timing.rJumpWidth << CAN_CTRL1_RJW_SHIFT) |
+                              ((uint32_t)timing.phaseSeg1 << CAN_CTRL1_PSEG1_SHIFT) |
+                              ((uint32_t)timing.phaseSeg2 << CAN_CTRL1_PSEG2_SHIFT) |
+                              ((uint32_t)timing.propSeg << CAN_CTRL1_PROPSEG_SHIFT);
+            }
+        }
+        
+        if (status != STATUS_SUCCESS) {
+            return;
+        }
+    }
+    
+    if (s_canClockFrozen[instance]) {
+        (void)CAN_ExitFreezeMode(base);
+        s_canClockFrozen[instance] = false;
+    }
+}
+
+/**
+ * @brief Read frame content from a Message Buffer
+ * @details Decodes CS, ID and data words of an MB (or the RX FIFO output at MB0)
+ *          into a message structure. Reading CS locks a regular RX MB.
+ */
+static void CAN_ReadFrame(uint8_t instance, uint8_t mbIndex, can_message_t *message)
+{
+    CAN_Type *base = s_canBases[instance];
+    uint32_t mbOffset = (uint32_t)mbIndex * MSG_BUF_SIZE;
+    uint32_t cs, id;
+    
+    /* Read CS and ID words */
+    cs = base->RAMn[mbOffset + 0];
+    id = base->RAMn[mbOffset + 1];
+    
+    /* Extract message information */
+    if (cs & CAN_WMBn_CS_IDE_MASK) {
+        message->idType = CAN_ID_EXT;
+        message->id = (id & CAN_ID_EXT_MASK) >> CAN_ID_EXT_SHIFT;
+    } else {
+        message->idType = CAN_ID_STD;
+        message->id = (id & CAN_ID_STD_MASK) >> CAN_ID_STD_SHIFT;
+    }
+    
+    message->frameType = (cs & CAN_WMBn_CS_RTR_MASK) ? CAN_FRAME_REMOTE : CAN_FRAME_DATA;
+    message->dataLength = (cs & CAN_WMBn_CS_DLC_MASK) >> CAN_WMBn_CS_DLC_SHIFT;
+    
+    /* Copy data words (big-endian, word-wise) */
+    CAN_CopyDataFromMb(base, mbIndex, message->data, message->dataLength);
+    
+    /* Hardware timestamp, extended onto the installed time base.
+       Done after the data copy: reading TIMER releases the MB lock. */
+    message->timeStamp = (uint16_t)((cs & CAN_CS_TIME_STAMP_MASK) >> CAN_CS_TIME_STAMP_SHIFT);
+    message->timestampUs = CAN_TimestampToUs(instance, message->timeStamp);
+}
+
+/**
+ * @brief Extend a 16-bit MB TIME_STAMP onto the installed time base
+ * @details The age of the frame is the distance to the free running TIMER,
+ *          so the result is only correct within one timer wrap.
+ * @return Receive time in microseconds, 0 if no time source is installed
+ */
+static uint32_t CAN_TimestampToUs(uint8_t instance, uint16_t timeStamp)
+{
+    uint16_t age;
+    
+    if ((s_timeSource == NULL) || (s_canBaudRate[instance] < 1000U)) {
+        return 0U;
+    }
+    
+    age = (uint16_t)((uint16_t)s_canBases[instance]->TIMER - timeStamp);
+    
+    return s_timeSource() - (((uint32_t)age * 1000U) / (s_canBaudRate[instance] / 1000U));
+}
+
+/**
+ * @brief Encode filter mask into RXIMR layout for a Message Buffer
+ * @details RXIMR bits line up with the MB ID word, so the mask is shifted the
+ *          same way as the ID (STD ID in bits 28-18, EXT ID in bits 28-0).
+ */
+static uint32_t CAN_EncodeMbMask(uint32_t mask, can_id_type_t idType)
+{
+    if (idType == CAN_ID_EXT) {
+        return (mask << CAN_ID_EXT_SHIFT) & CAN_ID_EXT_MASK;
+    }
+    
+    return (mask << CAN_ID_STD_SHIFT) & CAN_ID_STD_MASK;
+}
+
+/**
+ * @brief Program the RX FIFO DMA channel over the whole ring and start it
+ * @details One 16-byte transfer per FIFO request from the output (MB0), so
+ *          the source never moves; the destination wraps at the end of the
+ *          ring (DLAST) and the major loop never stops (no DREQ). Every entry
+ *          is marked empty first, the reader restarts at entry 0.
+ *          The TCD is written through dma_reg.h: dma.h shares the status_t
+ *          names of this driver.
+ */
+static void CAN_RxDmaArm(uint8_t instance)
+{
+    uint8_t channel = s_canRxDmaChannel[instance];
+    uint16_t count = s_canRxDmaCount[instance];
+    uint16_t i;
+    
+    DMA->CERQ = channel;
+    DMAMUX->CHCFG[channel] = 0U;
+    
+    for (i = 0U; i < count; i++) {
+        s_canRxDmaBuffer[instance][i].cs = CAN_RX_DMA_ENTRY_EMPTY;
+    }
+    s_canRxDmaRead[instance] = 0U;
+    
+    /* 16-byte burst (SSIZE = DSIZE = 4), no interrupt, no DREQ */
+    DMA->TCD[channel].SADDR = (uint32_t)(uintptr_t)&s_canBases[instance]->RAMn[0];
+    DMA->TCD[channel].SOFF = 0;
+    DMA->TCD[channel].ATTR = (uint16_t)((4U << DMA_TCD_ATTR_SSIZE_SHIFT) | (4U << DMA_TCD_ATTR_DSIZE_SHIFT));
+    DMA->TCD[channel].NBYTES_MLNO = sizeof(can_rx_dma_entry_t);
+    DMA->TCD[channel].SLAST = 0;
+    DMA->TCD[channel].DADDR = (uint32_t)(uintptr_t)s_canRxDmaBuffer[instance];
+    DMA->TCD[channel].DOFF = (int16_t)sizeof(can_rx_dma_entry_t);
+    DMA->TCD[channel].CITER_ELINKNO = count;
+    DMA->TCD[channel].DLAST_SGA = -(int32_t)((uint32_t)count * sizeof(can_rx_dma_entry_t));
+    DMA->TCD[channel].CSR = 0U;
+    DMA->TCD[channel].BITER_ELINKNO = count;
+    
+    DMA->CDNE = channel;
+    DMAMUX->CHCFG[channel] = (uint8_t)(DMAMUX_CHCFG_ENBL_MASK |
+                                       (((uint8_t)DMAMUX_SRC_FLEXCAN0 + instance) & DMAMUX_CHCFG_SOURCE_MASK));
+    DMA->SERQ = channel;
+}
+
+/**
+ * @brief Ring entry the RX FIFO DMA writes next
+ * @details Taken from the major loop counter, sampled again while a minor
+ *          loop is active or CITER moved, so the CS word belongs to that index.
+ * @param[out] cs CS word of that entry
+ */
+static uint16_t CAN_RxDmaWriteIndex(uint8_t instance, uint32_t *cs)
+{
+    DMA_TCD_Type *tcd = &DMA->TCD[s_canRxDmaChannel[instance]];
+    uint16_t count = s_canRxDmaCount[instance];
+    uint16_t citer;
+    uint16_t citerCheck;
+    uint16_t write;
+    bool active;
+    
+    do {
+        citer = tcd->CITER_ELINKNO;
+        write = (citer >= count) ? 0U : (uint16_t)(count - citer);
+        *cs = s_canRxDmaBuffer[instance][write].cs;
+        active = (tcd->CSR & DMA_TCD_CSR_ACTIVE_MASK) != 0U;
+        citerCheck = tcd->CITER_ELINKNO;
+    } while (active || (citer != citerCheck));
+    
+    return write;
+}
+
+/**
+ * @brief Ring overrun: count it, drop the unread entries and restart the ring
+ */
+static void CAN_RxDmaResync(uint8_t instance)
+{
+    s_canRxDmaOverruns[instance]++;
+    CAN_STATS_RX_OVERRUN(instance);
+    DMA->CERQ = s_canRxDmaChannel[instance];
+    while ((DMA->TCD[s_canRxDmaChannel[instance]].CSR & DMA_TCD_CSR_ACTIVE_MASK) != 0U) {
+    }
+    CAN_RxDmaArm(instance);
+}
+
+/**
+ * @brief Stop the RX FIFO DMA channel (MCR[DMA] is left to the caller)
+ */
+static void CAN_RxDmaRelease(uint8_t instance)
+{
+    uint8_t channel = s_canRxDmaChannel[instance];
+    
+    if (s_canRxDmaEnabled[instance]) {
+        DMA->CERQ = channel;
+        DMAMUX->CHCFG[channel] = 0U;
+        while ((DMA->TCD[channel].CSR & DMA_TCD_CSR_ACTIVE_MASK) != 0U) {
+        }
+        s_canRxDmaEnabled[instance] = false;
+    }
+}
+
+/**
+ * @brief Encode ID or mask into RX FIFO filter element format A
+ * @details Used for both the filter table elements and the FIFO masks
+ *          (RXIMR/RXFGMASK share the element layout). RTR is always 0 in
+ *          the element, so only data frames are accepted.
+ */
+static uint32_t CAN_EncodeFifoFilter(uint32_t value, can_id_type_t idType)
+{
+    uint32_t element;
+    
+    if (idType == CAN_ID_EXT) {
+        element = CAN_RX_FIFO_ID_A_IDE_MASK |
+                  ((value << CAN_RX_FIFO_ID_A_EXT_SHIFT) & CAN_RX_FIFO_ID_A_EXT_MASK);
+    } else {
+        element = (value << CAN_RX_FIFO_ID_A_STD_SHIFT) & CAN_RX_FIFO_ID_A_STD_MASK;
+    }
+    
+    return element;
+}
+
+/**
+ * @brief Write a frame into a TX Message Buffer and activate it
+ * @param base CAN peripheral base
+ * @param mbIndex TX Message Buffer index
+ * @param message Message to transmit
+ * @param idWord Pre-encoded ID word (ID and optional local priority)
+ */
+static void CAN_WriteTxFrame(CAN_Type *base, uint8_t mbIndex, const can_message_t *message, uint32_t idWord)
+{
+    uint32_t mbOffset = (uint32_t)mbIndex * MSG_BUF_SIZE;
+    uint32_t cs;
+    
+    /* Clear interrupt flag */
+    base->IFLAG1 = (1UL << mbIndex);
+    
+    /* Write data words (big-endian, word-wise) */
+    CAN_CopyDataToMb(base, mbIndex, message->data, CAN_MAX_DATA_LENGTH);
+    
+    /* Write ID word */
+    base->RAMn[mbOffset + 1] = idWord;
+    
+    /* Configure CS word and activate transmission */
+    cs = (CAN_CS_CODE_TX_DATA << CAN_CS_CODE_SHIFT) |
+         ((uint32_t)message->dataLength << CAN_WMBn_CS_DLC_SHIFT);
+    
+    if (message->idType == CAN_ID_EXT) {
+        cs |= CAN_WMBn_CS_IDE_MASK;
+    }
+    
+    if (message->idType == CAN_ID_STD) {
+        cs |= CAN_WMBn_CS_SRR_MASK;  /* SRR=1 for standard ID transmission */
+    }
+    
+    if (message->frameType == CAN_FRAME_REMOTE) {
+        cs |= CAN_WMBn_CS_RTR_MASK;
+    }
+    
+    base->RAMn[mbOffset + 0] = cs;  /* Write CS to activate MB */
+}
+
+/**
+ * @brief Load queued frames into free TX queue pool Message Buffers
+ * @details Called inside NVIC_EnterCritical() or from CAN_IRQHandler().
+ *          Lowest arbitration value is taken from the end of the queue.
+ */
+static void CAN_TxQueueLoad(uint8_t instance)
+{
+    CAN_Type *base = s_canBases[instance];
+    uint32_t freeMask;
+    uint8_t mbIdx;
+    uint8_t last;
+    
+    freeMask = s_txQueuePoolMask[instance] & ~s_txQueueBusyMask[instance];
+    
+    while ((freeMask != 0U) && (s_txQueueCount[instance] > 0U)) {
+        /* Lowest free pool MB */
+        mbIdx = 0U;
+        while ((freeMask & (1UL << mbIdx)) == 0U) {
+            mbIdx++;
+        }
+        
+        last = s_txQueueCount[instance] - 1U;
+        CAN_WriteTxFrame(base, mbIdx, &s_txQueue[instance][last].message,
+                         s_txQueue[instance][last].key);
+        CAN_STATS_TX(instance, mbIdx, &s_txQueue[instance][last].message);
+        s_txQueueCount[instance] = last;
+        
+        s_txQueueBusyMask[instance] |= (1UL << mbIdx);
+        freeMask &= ~(1UL << mbIdx);
+    }
+}
+
+/**
+ * @brief Calculate bit timing for one phase
+ * @details Searches the smallest prescaler that divides the CAN clock exactly
+ *          (most time quanta per bit), then places the sample point close to
+ *          limits->samplePoint.
+ * @return STATUS_SUCCESS if a valid timing exists, STATUS_INVALID_PARAM otherwise
+ */
+static status_t CAN_CalcPhaseTiming(uint32_t canClockHz, uint32_t bitRate,
+                                    const can_phase_limits_t *limits, can_phase_timing_t *timing)
+{
+    uint32_t preDiv;
+    uint32_t quantaClock;
+    uint32_t numTq;
+    uint32_t seg2;
+    uint32_t seg1;
+    uint32_t prop;
+    uint32_t rest;
+    
+    if (canClockHz == 0U || bitRate == 0U) {
+        return STATUS_INVALID_PARAM;
+    }
+    
+    for (preDiv = 1U; preDiv <= CAN_FD_PRESDIV_MAX; preDiv++) {
+        if ((canClockHz % preDiv) != 0U) {
+            continue;
+        }
+        
+        quantaClock = canClockHz / preDiv;
+        if ((quantaClock % bitRate) != 0U) {
+            continue;
+        }
+        
+        numTq = quantaClock / bitRate;
+        if (numTq > limits->tqMax) {
+            continue;
+        }
+        if (numTq < limits->tqMin) {
+            break;  /* Larger prescalers only give fewer quanta */
+        }
+        
+        /* Phase segment 2 from target sample point */
+        seg2 = numTq - ((numTq * limits->samplePoint + 50U) / 100U);
+        if (seg2 < 2U) {
+            seg2 = 2U;
+        }
+        if (seg2 > limits->seg2Max) {
+            seg2 = limits->seg2Max;
+        }
+        
+        /* Split remaining quanta (minus SYNC_SEG) between PSEG1 and PROPSEG */
+        rest = numTq - 1U - seg2;
+        seg1 = rest - limits->propMin;
+        if (seg1 > limits->seg1Max) {
+            seg1 = limits->seg1Max;
+        }
+        prop = rest - seg1;
+        
+        if (seg1 == 0U || prop > limits->propMax) {
+            continue;
+        }
+        
+        timing->preDiv = preDiv;
+        timing->propSeg = prop;
+        timing->phaseSeg1 = seg1;
+        timing->phaseSeg2 = seg2;
+        timing->rJumpWidth = (seg2 < limits->rjwMax) ? seg2 : limits->rjwMax;
+        
+        return STATUS_SUCCESS;
+    }
+    
+    return STATUS_INVALID_PARAM;
+}
+
+/**
+ * @brief Get RAMn word offset of a Message Buffer in FD layout
+ */
+static uint32_t CAN_GetFdMbOffset(uint8_t instance, uint8_t mbIndex)
+{
+    uint32_t mbWords = 2U + ((8UL << (uint32_t)s_canFdPayload[instance]) / 4U);
+    
+    return (uint32_t)mbIndex * mbWords;
+}
+
+#if CAN_STATISTICS_ENABLE
+/**
+ * @brief Account one frame in per-MB counters and bus load window
+ * @details Frame length uses worst-case bit stuffing and includes the
+ *          3-bit interframe space: STD 47 + 8n, EXT 67 + 8n data bits.
+ *          CAN FD frames are counted at the nominal bitrate, so load is
+ *          overestimated when BRS is used.
+ */
+static void CAN_StatsOnFrame(uint8_t instance, uint8_t mbIndex, can_id_type_t idType,
+                             uint8_t dataLength, bool isTx)
+{
+    uint32_t stuffable;
+    uint32_t bits;
+    
+    if (isTx) {
+        s_canStats[instance].txFrames[mbIndex]++;
+    } else {
+        s_canStats[instance].rxFrames[mbIndex]++;
+    }
+    
+    if (s_timeSource == NULL) {
+        return;
+    }
+    
+    /* SOF..CRC are stuffed (34 bits STD, 54 bits EXT, plus data) */
+    stuffable = ((idType == CAN_ID_EXT) ? 54U : 34U) + (8U * dataLength);
+    bits = ((idType == CAN_ID_EXT) ? 67U : 47U) + (8U * dataLength) + ((stuffable - 1U) / 4U);
+    
+    CAN_StatsAdvanceBuckets(instance);
+    s_busLoadBits[instance][s_busLoadBucket[instance] % CAN_STATS_BUSLOAD_BUCKETS] += bits;
+}
+
+/**
+ * @brief Account TX error flags read from ESR1
+ */
+static void CAN_StatsOnEsr1(uint8_t instance, uint32_t esr1)
+{
+    if ((esr1 & (CAN_ESR1_ACKERR_MASK | CAN_ESR1_BIT0ERR_MASK | CAN_ESR1_BIT1ERR_MASK)) != 0U) {
+        s_canStats[instance].txErrors++;
+    }
+}
+
+/**
+ * @brief Move bus load window to the current time, clearing expired buckets
+ */
+static void CAN_StatsAdvanceBuckets(uint8_t instance)
+{
+    uint32_t nowBucket = s_timeSource() / CAN_STATS_BUSLOAD_BUCKET_US;
+    uint32_t steps = nowBucket - s_busLoadBucket[instance];
+    
+    if (steps > CAN_STATS_BUSLOAD_BUCKETS) {
+        steps = CAN_STATS_BUSLOAD_BUCKETS;
+    }
+    
+    while (steps > 0U) {
+        s_busLoadBucket[instance]++;
+        s_busLoadBits[instance][s_busLoadBucket[instance] % CAN_STATS_BUSLOAD_BUCKETS] = 0U;
+        steps--;
+    }
+    
+    s_busLoadBucket[instance] = nowBucket;
+}
+#endif /* CAN_STATISTICS_ENABLE */
+
+#if OSAL_FREERTOS
+/**
+ * @brief Sleep until a Message Buffer flag sets (task context)
+ * @details The MB interrupt is unmasked for the wait; the ISR masks it again
+ *          and leaves IFLAG1 for the caller. Returns with the IMASK1 bit
+ *          cleared, CAN_OsalEndWait() restores it once the flag is handled.
+ * @param timeoutMs Timeout in ms, 0 = wait forever
+ * @return true if the MB flag is set
+ */
+static bool CAN_OsalWaitMb(uint8_t instance, uint8_t mbIndex, uint32_t timeoutMs)
+{
+    CAN_Type *base = s_canBases[instance];
+    osal_event_t *event = &s_canMbEvent[instance][mbIndex];
+    uint32_t mbMask = (1UL << mbIndex);
+    uint32_t basepri;
+    
+    OSAL_EventArm(event);
+    
+    basepri = NVIC_EnterCritical();
+    s_canOsalImask[instance] |= (base->IMASK1 & mbMask);
+    s_canOsalWaitMask[instance] |= mbMask;
+    base->IMASK1 |= mbMask;
+    NVIC_ExitCritical(basepri);
+    
+    /* A flag that was already set fires the interrupt at once */
+    (void)OSAL_EventWait(event, (timeoutMs == 0U) ? OSAL_WAIT_FOREVER : timeoutMs);
+    
+    basepri = NVIC_EnterCritical();
+    s_canOsalWaitMask[instance] &= ~mbMask;
+    base->IMASK1 &= ~mbMask;
+    NVIC_ExitCritical(basepri);
+    
+    return ((base->IFLAG1 & mbMask) != 0U);
+}
+
+/**
+ * @brief Restore the MB interrupt mask saved by CAN_OsalWaitMb()
+ */
+static void CAN_OsalEndWait(uint8_t instance, uint8_t mbIndex)
+{
+    uint32_t mbMask = (1UL << mbIndex);
+    uint32_t basepri;
+    
+    basepri = NVIC_EnterCritical();
+    if ((s_canOsalImask[instance] & mbMask) != 0U) {
+        s_canBases[instance]->IMASK1 |= mbMask;
+        s_canOsalImask[instance] &= ~mbMask;
+    }
+    NVIC_ExitCritical(basepri);
+}
+#endif /* OSAL_FREERTOS */
+
+/**
+ * @brief Dispatch pending Message Buffer interrupts of one vector group
+ * @details Pending flags are walked with count-trailing-zeros, so the cost
+ *          follows the number of set flags instead of the number of MBs.
+ *          Lower MB numbers are served first.
+ * @param instance CAN instance number
+ * @param groupMask MB flags served by the calling vector
+ */
+static void CAN_DispatchMbIrq(uint8_t instance, uint32_t groupMask)
+{
+    CAN_Type *base = s_canBases[instance];
+    const can_mb_callback_t *mbEntries = &s_mbCallbacks[s_canMbCallbackBase[instance]];
+    const can_mb_callback_t *entry;
+    uint32_t flags;
+    uint32_t mbMask;
+    uint8_t mbIdx;
+    
+    flags = base->IFLAG1 & base->IMASK1 & groupMask;
+    
+    /* RX FIFO events (MB5-MB7 flags, all in the 0-15 group) */
+    if (s_canRxFifoEnabled[instance] && ((flags & CAN_RX_FIFO_FLAGS_MASK) != 0U)) {
+        if ((flags & CAN_IFLAG1_BUF7I_MASK) != 0U) {
+            base->IFLAG1 = CAN_IFLAG1_BUF7I_MASK;
+            CAN_STATS_RX_OVERRUN(instance);
+            if (s_rxFifoCallbacks[instance] != NULL) {
+                s_rxFifoCallbacks[instance](instance, CAN_RX_FIFO_OVERFLOW_IDX,
+                                            s_rxFifoUserData[instance]);
+            }
+        }
+        
+        if ((flags & CAN_IFLAG1_BUF6I_MASK) != 0U) {
+            base->IFLAG1 = CAN_IFLAG1_BUF6I_MASK;
+            if (s_rxFifoCallbacks[instance] != NULL) {
+                s_rxFifoCallbacks[instance](instance, CAN_RX_FIFO_WARNING_IDX,
+                                            s_rxFifoUserData[instance]);
+            }
+        }
+        
+        if ((flags & CAN_IFLAG1_BUF5I_MASK) != 0U) {
+            if (s_rxFifoCallbacks[instance] != NULL) {
+                s_rxFifoCallbacks[instance](instance, CAN_RX_FIFO_FRAME_AVAILABLE_IDX,
+                                            s_rxFifoUserData[instance]);
+            }
+        }
+    }
+    
+    if (s_canRxFifoEnabled[instance]) {
+        flags &= ~CAN_RX_FIFO_MB_MASK;
+    }
+    
+    /* Individual Message Buffers */
+    while (flags != 0U) {
+        mbIdx = (uint8_t)__builtin_ctz(flags);
+        mbMask = (1UL << mbIdx);
+        flags &= ~mbMask;
+        
+#if OSAL_FREERTOS
+        if ((s_canOsalWaitMask[instance] & mbMask) != 0U) {
+            /* Blocking call in a task owns this MB: mask it, the task clears / reads it */
+            base->IMASK1 &= ~mbMask;
+            s_canOsalWaitMask[instance] &= ~mbMask;
+            OSAL_EventSignalFromIsr(&s_canMbEvent[instance][mbIdx]);
+            continue;
+        }
+#endif
+        
+        entry = &mbEntries[mbIdx];
+        
+        if ((s_txQueuePoolMask[instance] & mbMask) != 0U) {
+            /* TX queue pool MB completed: notify, then refill from queue */
+            base->IFLAG1 = mbMask;
+            s_txQueueBusyMask[instance] &= ~mbMask;
+            if (entry->txCallback != NULL) {
+                entry->txCallback(instance, mbIdx, entry->txUserData);
+            }
+            CAN_TxQueueLoad(instance);
+        } else if (entry->txCallback != NULL) {
+            base->IFLAG1 = mbMask;
+            entry->txCallback(instance, mbIdx, entry->txUserData);
+        } else if (entry->rxCallback != NULL) {
+            /* Callback reads the MB via CAN_Receive(), which clears the flag */
+            entry->rxCallback(instance, mbIdx, entry->rxUserData);
+        } else {
+            base->IFLAG1 = mbMask;
+            if (flags == 0U) {
+                /* Last flag and no callback: the clear must land before return */
+                NVIC_ISR_WRITE_FENCE(base->IFLAG1);
+            }
+        }
+    }
 }
@@ -62,6 +62,7 @@
 #include "pcc.h"
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 
 /*******************************************************************************
@@ -73,6 +74,11 @@
 #define CAN_CS_CODE_MASK                 (0x0F000000U)
 // #define CAN_CS_IDE_MASK                  (0x00200000U)
 #define CAN_CS_SRR_MASK                  (0x00400000U)
+#define CAN_CS_EDL_MASK                  (0x80000000U)    /* Extended Data Length: CAN FD frame */
+#define CAN_CS_BRS_MASK                  (0x40000000U)    /* Bit Rate Switch: data phase at FD rate */
+#define CAN_CS_ESI_MASK                  (0x20000000U)    /* Error State Indicator of FD transmitter */
+#define CAN_CS_TIME_STAMP_SHIFT          (0U)
+#define CAN_CS_TIME_STAMP_MASK           (0x0000FFFFU)    /* Free running timer value captured at SOF/EOF */
 // #define CAN_CS_RTR_MASK                  (0x00100000U)
 // #define CAN_CS_DLC_SHIFT                 (16U)
 // #define CAN_CS_DLC_MASK                  (0x000F0000U)
@@ -99,6 +105,16 @@
 #define CAN_ID_STD_MASK                  (0x1FFC0000U)
 #define CAN_ID_EXT_SHIFT                 (0U)
 #define CAN_ID_EXT_MASK                  (0x1FFFFFFFU)
+#define CAN_ID_PRIO_SHIFT                (29U)      /* Local priority, used when MCR[LPRIOEN] = 1 */
+#define CAN_ID_PRIO_MASK                 (0xE0000000U)
+
+/* RX FIFO ID filter table element, format A (one full ID per element) */
+#define CAN_RX_FIFO_ID_A_RTR_MASK        (0x80000000U)
+#define CAN_RX_FIFO_ID_A_IDE_MASK        (0x40000000U)
+#define CAN_RX_FIFO_ID_A_STD_SHIFT       (19U)
+#define CAN_RX_FIFO_ID_A_STD_MASK        (0x3FF80000U)
+#define CAN_RX_FIFO_ID_A_EXT_SHIFT       (1U)
+#define CAN_RX_FIFO_ID_A_EXT_MASK        (0x3FFFFFFEU)
 
 /** 
  * @brief Number of Message Buffers per CAN instance
@@ -193,8 +209,19 @@ static inline void CAN_WriteMbData(CAN_Type *base, uint8_t mbIdx, uint8_t wordId
     base->RAMn[CAN_GetMbOffset(mbIdx) + 2U + wordIdx] = data;
 }
 
+/**
+ * @brief Convert between MB data word (big-endian) and little-endian CPU word
+ * @note GCC emits a single REV instruction on Cortex-M4
+ */
+static inline uint32_t CAN_SwapBytes32(uint32_t value)
+{
+    return __builtin_bswap32(value);
+}
+
 /**
  * @brief Copy data to Message Buffer
+ * @details Full 8-byte payloads are copied as two 32-bit words (one REV each),
+ *          shorter payloads are packed byte by byte and zero padded.
  * @param base CAN peripheral base
  * @param mbIdx Message Buffer index
  * @param data Source data array
@@ -205,13 +232,20 @@ static inline void CAN_CopyDataToMb(CAN_Type *base, uint8_t mbIdx, const uint8_t
     uint32_t dataWord0 = 0U;
     uint32_t dataWord1 = 0U;
 
-    /* Pack bytes into 32-bit words (big-endian format) */
-    for (uint8_t i = 0; i < length && i < 4U; i++) {
-        dataWord0 |= ((uint32_t)data[i] << (24U - i * 8U));
-    }
-
-    for (uint8_t i = 4; i < length && i < 8U; i++) {
-        dataWord1 |= ((uint32_t)data[i] << (56U - i * 8U));
+    if (length >= 8U) {
+        memcpy(&dataWord0, &data[0], 4U);
+        memcpy(&dataWord1, &data[4], 4U);
+        dataWord0 = CAN_SwapBytes32(dataWord0);
+        dataWord1 = CAN_SwapBytes32(dataWord1);
+    } else {
+        /* Pack bytes into 32-bit words (big-endian format) */
+        for (uint8_t i = 0; i < length && i < 4U; i++) {
+            dataWord0 |= ((uint32_t)data[i] << (24U - i * 8U));
+        }
+
+        for (uint8_t i = 4; i < length && i < 8U; i++) {
+            dataWord1 |= ((uint32_t)data[i] << (56U - i * 8U));
+        }
     }
 
     CAN_WriteMbData(base, mbIdx, 0U, dataWord0);
@@ -220,24 +254,21 @@ static inline void CAN_CopyDataToMb(CAN_Type *base, uint8_t mbIdx, const uint8_t
 
 /**
  * @brief Copy data from Message Buffer
+ * @details Always copies both data words (8 bytes) with word-wise stores;
+ *          bytes beyond length are whatever the MB holds.
  * @param base CAN peripheral base
  * @param mbIdx Message Buffer index
- * @param data Destination data array
+ * @param data Destination data array (at least 8 bytes)
  * @param length Data length in bytes (max 8)
  */
 static inline void CAN_CopyDataFromMb(CAN_Type *base, uint8_t mbIdx, uint8_t *data, uint8_t length)
 {
-    uint32_t dataWord0 = CAN_ReadMbData(base, mbIdx, 0U);
-    uint32_t dataWord1 = CAN_ReadMbData(base, mbIdx, 1U);
+    uint32_t dataWord0 = CAN_SwapBytes32(CAN_ReadMbData(base, mbIdx, 0U));
+    uint32_t dataWord1 = CAN_SwapBytes32(CAN_ReadMbData(base, mbIdx, 1U));
 
-    /* Unpack 32-bit words into bytes (big-endian format) */
-    for (uint8_t i = 0; i < length && i < 4U; i++) {
-        data[i] = (uint8_t)(dataWord0 >> (24U - i * 8U));
-    }
-
-    for (uint8_t i = 4; i < length && i < 8U; i++) {
-        data[i] = (uint8_t)(dataWord1 >> (56U - i * 8U));
-    }
+    (void)length;
+    memcpy(&data[0], &dataWord0, 4U);
+    memcpy(&data[4], &dataWord1, 4U);
 }
 
 /**
@@ -276,6 +307,48 @@ typedef enum {
 /** @brief Maximum data length in bytes for a CAN message */
 #define CAN_MAX_DATA_LENGTH (8U)
 
+/** @brief Depth of the software TX queue per CAN instance */
+#ifndef CAN_TX_QUEUE_SIZE
+#define CAN_TX_QUEUE_SIZE   (16U)
+#endif
+
+/** @brief Maximum data length in bytes for a CAN FD message */
+#define CAN_FD_MAX_DATA_LENGTH (64U)
+
+/** @brief CAN instance supporting CAN FD on S32K144 (FlexCAN0 only) */
+#define CAN_FD_INSTANCE     (0U)
+
+/** @brief CAN instance supporting Pretended Networking on S32K144 (FlexCAN0 only) */
+#define CAN_PN_INSTANCE     (0U)
+
+/** @brief Number of Pretended Networking wakeup message buffers (WMB0-WMB3) */
+#define CAN_PN_WMB_COUNT    (4U)
+
+/**
+ * @name Pretended Networking wakeup flags
+ * @brief Values passed to can_wakeup_callback_t (same bits as WU_MTC)
+ * @{
+ */
+#define CAN_PN_WAKEUP_MATCH     (0x10000U)  /**< Wakeup by filter match (WUMF) */
+#define CAN_PN_WAKEUP_TIMEOUT   (0x20000U)  /**< Wakeup by timeout (WTOF) */
+/** @} */
+
+/**
+ * @brief Enable driver statistics (CAN_GetStatistics)
+ * @note Set to 1 in the build configuration to enable. When 0 the counters,
+ *       bus load accounting and the statistics API are compiled out.
+ */
+#ifndef CAN_STATISTICS_ENABLE
+#define CAN_STATISTICS_ENABLE   (0U)
+#endif
+
+/** @brief Bus load window: number of buckets and bucket length (1 s total) */
+#define CAN_STATS_BUSLOAD_BUCKETS   (8U)
+#define CAN_STATS_BUSLOAD_BUCKET_US (125000U)
+
+/** @brief Highest (numerically) local priority value, lower value wins arbitration */
+#define CAN_TX_LOCAL_PRIO_MAX (7U)
+
 /**
  * @name Message Buffer Allocation
  * @brief Default allocation scheme for TX and RX Message Buffers
@@ -290,6 +363,25 @@ typedef enum {
 #define CAN_RX_MB_COUNT     (16U)   /**< Total number of RX Message Buffers */
 /** @} */
 
+/**
+ * @name RX FIFO Layout
+ * @brief Legacy RX FIFO allocation (MCR[RFEN] = 1, CTRL2[RFFN] = 0)
+ * @details - MB0-MB5: FIFO engine, 6 frames deep, output read through MB0
+ *          - MB6-MB7: ID filter table, 8 elements in format A
+ *          The FIFO fits entirely in the reserved MB0-MB7 area, so the TX and
+ *          RX Message Buffer allocation above stays valid with FIFO enabled.
+ * @{
+ */
+#define CAN_RX_FIFO_DEPTH                   (6U)    /**< Frames buffered by the FIFO */
+#define CAN_RX_FIFO_FILTER_COUNT            (8U)    /**< Filter elements with RFFN = 0 */
+#define CAN_RX_FIFO_FILTER_TABLE_OFFSET     (24U)   /**< RAMn word index of filter table (MB6) */
+#define CAN_RX_FIFO_FRAME_AVAILABLE_IDX     (5U)    /**< IFLAG1 bit: frame available in FIFO */
+#define CAN_RX_FIFO_WARNING_IDX             (6U)    /**< IFLAG1 bit: FIFO almost full (5 frames) */
+#define CAN_RX_FIFO_OVERFLOW_IDX            (7U)    /**< IFLAG1 bit: FIFO full, frame lost */
+#define CAN_RX_DMA_MAX_ENTRIES              (0x7FFFU)   /**< Ring entries (eDMA CITER without channel linking) */
+#define CAN_RX_DMA_ENTRY_EMPTY              (0xFFFFFFFFU)   /**< CS of a free ring entry (EDL is never set in FIFO frames) */
+/** @} */
+
 /*******************************************************************************
  * Type Definitions
  ******************************************************************************/
@@ -344,8 +436,17 @@ typedef struct {
     can_frame_type_t frameType;         /**< Frame type (Data or Remote) */
     uint8_t dataLength;                 /**< Number of data bytes (0-8) */
     uint8_t data[CAN_MAX_DATA_LENGTH];  /**< Payload data bytes */
+    uint16_t timeStamp;                 /**< RX only: MB TIME_STAMP, free running timer in bit times */
+    uint32_t timestampUs;               /**< RX only: receive time in microseconds of the installed time source (0 if none) */
 } can_message_t;
 
+/**
+ * @brief Time source function type for extended RX timestamps
+ * @details Returns a free running microsecond counter (e.g. LPIT channel or
+ *          SysTick based). The 32-bit value may wrap.
+ */
+typedef uint32_t (*can_time_source_t)(void);
+
 /**
  * @brief CAN Bit Timing Configuration Structure
  * @details Configures the bit timing parameters to achieve desired baudrate.
@@ -390,6 +491,8 @@ typedef struct {
     can_mode_t mode;                /**< Operating mode (Normal/Loopback/Listen-Only) */
     bool enableSelfReception;       /**< Enable reception of own transmitted messages */
     bool useRxFifo;                 /**< Use RX FIFO mode instead of individual Message Buffers */
+    uint8_t activeMbCount;          /**< Message Buffers MB0..n-1 taking part in arbitration and
+                                         matching, MCR[MAXMB] = n - 1 (0 = all implemented) */
 } can_config_t;
 
 /**
@@ -403,6 +506,211 @@ typedef struct {
     can_id_type_t idType;   /**< ID type for this filter (Standard/Extended) */
 } can_rx_filter_t;
 
+/**
+ * @brief CAN RX FIFO Configuration Structure
+ * @details Describes the ID filter table loaded into MB6-MB7 when RX FIFO is used.
+ *          Each entry accepts one ID (format A). Unused table elements are filled
+ *          with the last entry so they never accept unwanted frames.
+ * 
+ * @note Individual masking (MCR[IRMQ]) is enabled by CAN_Init(), so every element
+ *       uses its own mask from RXIMR[0..7]. RXFGMASK is still loaded with the
+ *       mask of filterTable[0] for the case IRMQ is cleared at register level.
+ */
+typedef struct {
+    const can_rx_filter_t *filterTable; /**< ID filter table entries */
+    uint8_t filterCount;                /**< Number of entries (1 to CAN_RX_FIFO_FILTER_COUNT) */
+} can_rx_fifo_config_t;
+
+/**
+ * @brief RX FIFO DMA ring entry
+ * @details Raw copy of the FIFO output (MB0: CS, ID, 8 data bytes) written by
+ *          the eDMA. Decode with CAN_ReadRxFifoDma() or use the words directly
+ *          (data bytes are big-endian inside each word, byte 0 in bits 31-24).
+ */
+typedef struct {
+    volatile uint32_t cs;               /**< CS word: IDE, RTR, DLC, TIME_STAMP (CAN_RX_DMA_ENTRY_EMPTY = free) */
+    volatile uint32_t id;               /**< ID word */
+    volatile uint32_t data[2];          /**< Data words */
+} can_rx_dma_entry_t;
+
+/**
+ * @brief RX FIFO DMA Configuration Structure
+ */
+typedef struct {
+    uint8_t dmaChannel;                 /**< eDMA channel, owned by CAN while capturing (DMA_Init() done first for the clocks) */
+    can_rx_dma_entry_t *buffer;         /**< Circular frame buffer in RAM, 16-byte aligned */
+    uint16_t entryCount;                /**< Number of entries (2 to CAN_RX_DMA_MAX_ENTRIES), holds entryCount frames */
+} can_rx_dma_config_t;
+
+/**
+ * @brief CAN FD Message Buffer payload size
+ * @details Selects FDCTRL[MBDSR0]. S32K144 FlexCAN0 has a single 512-byte MB region,
+ *          so the payload size sets the number of usable Message Buffers:
+ *          8 bytes: 32 MBs, 16 bytes: 21 MBs, 32 bytes: 12 MBs, 64 bytes: 7 MBs
+ */
+typedef enum {
+    CAN_FD_PAYLOAD_8 = 0U,      /**< 8 bytes per MB */
+    CAN_FD_PAYLOAD_16 = 1U,     /**< 16 bytes per MB */
+    CAN_FD_PAYLOAD_32 = 2U,     /**< 32 bytes per MB */
+    CAN_FD_PAYLOAD_64 = 3U      /**< 64 bytes per MB */
+} can_fd_payload_size_t;
+
+/**
+ * @brief CAN FD Configuration Structure
+ * @details Nominal (arbitration) and data phase bitrates are programmed through
+ *          CBT and FDCBT. Timing is calculated from the clock selected in CAN_Init().
+ */
+typedef struct {
+    uint32_t nominalBaudRate;           /**< Arbitration phase bitrate in bps (e.g., 500000) */
+    uint32_t dataBaudRate;              /**< Data phase bitrate in bps when BRS is used (e.g., 2000000) */
+    can_fd_payload_size_t payloadSize;  /**< Payload size of every Message Buffer */
+    bool enableBrs;                     /**< Enable bit rate switching (FDCTRL[FDRATE]) */
+    bool enableIsoCrc;                  /**< ISO 11898-1:2015 CRC (CTRL2[ISOCANFDEN]) */
+} can_fd_config_t;
+
+/**
+ * @brief CAN FD Message Structure
+ * @details Frame with up to 64 payload bytes. dataLength must be a valid FD
+ *          length (0-8, 12, 16, 20, 24, 32, 48, 64); other values are rounded
+ *          up to the next valid length and padded with zeros on transmission.
+ */
+typedef struct {
+    uint32_t id;                            /**< CAN Identifier (11-bit for STD, 29-bit for EXT) */
+    can_id_type_t idType;                   /**< Identifier type (Standard or Extended) */
+    bool isFd;                              /**< true = FD frame (EDL), false = classic frame */
+    bool brs;                               /**< Bit rate switch for FD frame */
+    uint8_t dataLength;                     /**< Number of data bytes (0-64) */
+    uint8_t data[CAN_FD_MAX_DATA_LENGTH];   /**< Payload data bytes */
+} can_fd_message_t;
+
+/**
+ * @brief CAN TX Queue Configuration Structure
+ * @details Selects the pool of TX Message Buffers fed by the software TX queue.
+ *          Queued frames are kept sorted by arbitration value (local priority,
+ *          then CAN ID) and loaded into free pool MBs from the TX-complete
+ *          interrupt, so frames go out back-to-back without CPU polling.
+ */
+typedef struct {
+    uint8_t firstMb;                /**< First TX Message Buffer of the pool (within MB8-MB15) */
+    uint8_t mbCount;                /**< Number of TX Message Buffers in the pool */
+    bool enableLocalPriority;       /**< Enable MCR[LPRIOEN] so the PRIO field takes part in arbitration */
+} can_tx_queue_config_t;
+
+/**
+ * @brief Bus-off Recovery Mode (CTRL1[BOFFREC])
+ */
+typedef enum {
+    CAN_BUSOFF_RECOVERY_AUTO    = 0U,   /**< Rejoin after 128 x 11 recessive bits (ISO 11898-1) */
+    CAN_BUSOFF_RECOVERY_MANUAL  = 1U    /**< Stay bus off until CAN_RecoverFromBusOff() */
+} can_busoff_recovery_t;
+
+/**
+ * @brief TX Queue Policy on Bus-off
+ */
+typedef enum {
+    CAN_BUSOFF_TX_RETAIN    = 0U,   /**< Keep loaded and queued frames, sent after recovery */
+    CAN_BUSOFF_TX_FLUSH     = 1U    /**< Deactivate pool MBs and discard queued frames */
+} can_busoff_tx_policy_t;
+
+/**
+ * @brief CAN Error Handling Configuration Structure
+ * @details Bus-off entry (BOFFINT) and bus-off recovery complete (BOFFDONEINT)
+ *          interrupts are always enabled; the error callback receives the
+ *          ESR1 flags of every event handled by CAN_ErrorIRQHandler().
+ */
+typedef struct {
+    can_busoff_recovery_t recovery;     /**< Bus-off recovery mode */
+    can_busoff_tx_policy_t txPolicy;    /**< TX queue policy on bus-off entry */
+    bool enableWarningInterrupt;        /**< TWRNINT / RWRNINT when TEC / REC reaches 96 (MCR[WRNEN]) */
+    bool enableErrorInterrupt;          /**< ERRINT on every bus error (high rate on a faulty bus) */
+} can_error_config_t;
+
+/**
+ * @brief Pretended Networking Filter Combination (CTRL1_PN[FCS])
+ */
+typedef enum {
+    CAN_PN_MATCH_ID             = 0U,   /**< Wake on ID match */
+    CAN_PN_MATCH_ID_PAYLOAD     = 1U,   /**< Wake on ID and payload match */
+    CAN_PN_MATCH_ID_N           = 2U,   /**< Wake on matchCount ID matches */
+    CAN_PN_MATCH_ID_PAYLOAD_N   = 3U    /**< Wake on matchCount ID and payload matches */
+} can_pn_combination_t;
+
+/**
+ * @brief Pretended Networking ID / Payload Filter Mode (CTRL1_PN[IDFS/PLFS])
+ * @details EXACT uses the second value as mask (1 = must match), the other
+ *          modes use it as upper bound (RANGE) or ignore it.
+ */
+typedef enum {
+    CAN_PN_FILTER_EXACT     = 0U,   /**< value == filter (masked) */
+    CAN_PN_FILTER_GREATER   = 1U,   /**< value >= filter */
+    CAN_PN_FILTER_SMALLER   = 2U,   /**< value <= filter */
+    CAN_PN_FILTER_RANGE     = 3U    /**< filter <= value <= upper */
+} can_pn_filter_mode_t;
+
+/**
+ * @brief Pretended Networking Configuration Structure
+ * @details FlexCAN keeps filtering incoming frames while the MCU is in
+ *          STOP/VLPS and raises the wakeup interrupt only for frames that
+ *          match, or when no matching frame arrived within timeout.
+ */
+typedef struct {
+    can_pn_combination_t combination;       /**< Filter combination */
+    can_pn_filter_mode_t idFilterMode;      /**< ID filter mode */
+    can_pn_filter_mode_t payloadFilterMode; /**< Payload filter mode (ID+payload combinations) */
+    can_id_type_t idType;                   /**< Identifier type to match */
+    uint32_t id;                            /**< ID filter (lower bound for RANGE) */
+    uint32_t idMaskOrUpper;                 /**< ID mask for EXACT, upper bound for RANGE */
+    uint8_t dlcLow;                         /**< Lowest accepted DLC (payload filtering) */
+    uint8_t dlcHigh;                        /**< Highest accepted DLC (payload filtering) */
+    uint8_t payload[CAN_MAX_DATA_LENGTH];            /**< Payload filter (lower bound for RANGE) */
+    uint8_t payloadMaskOrUpper[CAN_MAX_DATA_LENGTH]; /**< Payload mask for EXACT, upper bound for RANGE */
+    uint8_t matchCount;                     /**< Number of matches for _N combinations (1-255) */
+    uint16_t timeout;                       /**< Timeout wakeup in units of 64 bit times (0 = disabled) */
+    bool enableMatchWakeup;                 /**< Enable wakeup interrupt on match */
+    bool enableTimeoutWakeup;               /**< Enable wakeup interrupt on timeout */
+} can_pn_config_t;
+
+#if CAN_STATISTICS_ENABLE
+/**
+ * @brief CAN Driver Statistics
+ * @details Counters are updated by the driver paths that touch the hardware;
+ *          frames handled directly at register level are not counted.
+ */
+typedef struct {
+    uint32_t txFrames[CAN_MB_COUNT];    /**< Frames loaded for transmission per MB */
+    uint32_t rxFrames[CAN_MB_COUNT];    /**< Frames read per MB (MB0 = RX FIFO output) */
+    uint32_t rxOverruns;                /**< MB CODE = OVERRUN seen on read, plus RX FIFO overflows */
+    uint32_t txErrors;                  /**< TX error flags (ACK/BIT0/BIT1) sampled from ESR1, each causes a retry */
+    uint32_t errorPassiveCount;         /**< Transitions into error passive seen by CAN_GetErrorState() */
+    uint32_t busOffCount;               /**< Transitions into bus off seen by CAN_GetErrorState() */
+    uint8_t busLoadPercent;             /**< Bus load over the last second (requires CAN_InstallTimeSource()) */
+} can_statistics_t;
+#endif /* CAN_STATISTICS_ENABLE */
+
+/**
+ * @brief Zero-copy view of a locked RX Message Buffer
+ * @details Filled by CAN_LockRxMb(). dataWords points straight into MB RAM
+ *          (big-endian words) and is valid until CAN_ReleaseRxMb().
+ */
+typedef struct {
+    uint32_t cs;                        /**< Raw CS word (CODE, IDE, RTR, DLC, TIME_STAMP) */
+    uint32_t id;                        /**< Decoded CAN identifier */
+    can_id_type_t idType;               /**< Identifier type */
+    uint8_t dataLength;                 /**< Number of data bytes (0-8) */
+    const volatile uint32_t *dataWords; /**< MB data words, byte 0 in bits 31-24 of word 0 */
+} can_mb_view_t;
+
+/**
+ * @brief Get one payload byte from a locked MB view
+ * @param view Locked Message Buffer view
+ * @param byteIdx Byte index (0-7)
+ * @return Payload byte
+ */
+static inline uint8_t CAN_GetMbViewByte(const can_mb_view_t *view, uint8_t byteIdx)
+{
+    return (uint8_t)(view->dataWords[byteIdx >> 2U] >> (24U - ((byteIdx & 3U) * 8U)));
+}
+
 /**
  * @brief CAN TX/RX Callback Function Type
  * @details Called when transmission completes or message is received
@@ -423,6 +731,15 @@ typedef void (*can_callback_t)(uint8_t instance, uint8_t mbIndex, void *userData
  */
 typedef void (*can_error_callback_t)(uint8_t instance, uint32_t errorFlags, void *userData);
 
+/**
+ * @brief CAN Pretended Networking Wakeup Callback Function Type
+ * 
+ * @param[in] instance CAN instance number (CAN_PN_INSTANCE)
+ * @param[in] wakeupFlags CAN_PN_WAKEUP_MATCH and/or CAN_PN_WAKEUP_TIMEOUT
+ * @param[in] userData User-defined data pointer passed during callback installation
+ */
+typedef void (*can_wakeup_callback_t)(uint8_t instance, uint32_t wakeupFlags, void *userData);
+
 /*******************************************************************************
  * API Functions
  ******************************************************************************/
@@ -449,6 +766,15 @@ typedef void (*can_error_callback_t)(uint8_t instance, uint32_t errorFlags, void
  *       5. Sets operating mode (Normal/Loopback/Listen-Only)
  *       6. Initializes Message Buffers (TX: MB8-15, RX: MB16-31)
  *       7. Enables the module
+ * @note activeMbCount limits MCR[MAXMB]: FlexCAN arbitration and RX matching
+ *       scan only MB0..activeMbCount-1, so a node using e.g. the RX FIFO and
+ *       two TX MBs (activeMbCount = 10) finishes both sooner. Only the active
+ *       MBs and their RXIMRs are cleared, and MB functions reject indices at
+ *       or above the count. With useRxFifo it must exceed 8 (MB0-7 hold the
+ *       FIFO). CAN_ConfigFd() keeps the limit if it is below the FD MB count.
+ * @note The instance registers a Clock Manager notifier: it is frozen around
+ *       ClockManager_NotifyBeforeChange() and its bit timing (CTRL1 or
+ *       CBT / FDCBT) is recomputed when the CAN clock frequency changed.
  * 
  * @warning Ensure pins are configured for CAN function before calling this function
  * 
@@ -541,6 +867,8 @@ status_t CAN_Send(uint8_t instance, uint8_t mbIndex, const can_message_t *messag
  * 
  * @note This function polls the transmission complete flag.
  *       For interrupt-driven operation, use CAN_Send() with callback.
+ *       With OSAL_FREERTOS = 1 and called from a task, the task sleeps on
+ *       the MB interrupt instead (MB group IRQ must be enabled in the NVIC).
  * 
  * @warning Long timeouts will block other operations. Consider using non-blocking CAN_Send().
  * 
@@ -611,6 +939,8 @@ status_t CAN_Receive(uint8_t instance, uint8_t mbIndex, can_message_t *message);
  * 
  * @note This function polls the receive complete flag.
  *       For interrupt-driven operation, use CAN_Receive() with callback.
+ *       With OSAL_FREERTOS = 1 and called from a task, the task sleeps on
+ *       the MB interrupt instead (MB group IRQ must be enabled in the NVIC).
  * 
  * @warning Long timeouts will block other operations. Consider using non-blocking CAN_Receive().
  * 
@@ -628,6 +958,74 @@ status_t CAN_Receive(uint8_t instance, uint8_t mbIndex, can_message_t *message);
 status_t CAN_ReceiveBlocking(uint8_t instance, uint8_t mbIndex, 
                              can_message_t *message, uint32_t timeoutMs);
 
+/**
+ * @brief Lock RX Message Buffer for zero-copy access
+ * @details Reads the CS word, which locks the MB against updates by the
+ *          FlexCAN engine, and returns a view of the frame without copying
+ *          the payload. The MB stays locked until CAN_ReleaseRxMb().
+ * 
+ * @param[in] instance CAN instance number (0-2)
+ * @param[in] mbIndex Message Buffer index (16-31)
+ * @param[out] view Pointer to store the MB view
+ * 
+ * @return status_t
+ *         - STATUS_SUCCESS: MB locked, view valid
+ *         - STATUS_ERROR: No message available in Message Buffer
+ *         - STATUS_INVALID_PARAM: Invalid parameter (NULL pointer, invalid instance/MB)
+ *         - STATUS_NOT_INITIALIZED: CAN module not initialized
+ * 
+ * @warning Keep the lock short: while locked, a new frame for this MB is
+ *          moved to another matching MB or lost. Only one MB can be locked
+ *          at a time; locking another MB releases the previous one.
+ * 
+ * @par Example:
+ * @code
+ * can_mb_view_t view;
+ * if (CAN_LockRxMb(0, 16, &view) == STATUS_SUCCESS) {
+ *     uint32_t speed = CAN_SwapBytes32(view.dataWords[0]);  // bytes 0-3 as LE word
+ *     CAN_ReleaseRxMb(0, 16);
+ * }
+ * @endcode
+ */
+status_t CAN_LockRxMb(uint8_t instance, uint8_t mbIndex, can_mb_view_t *view);
+
+/**
+ * @brief Release RX Message Buffer locked by CAN_LockRxMb()
+ * @details Reads the free running timer (global unlock) and clears the MB flag.
+ * 
+ * @param[in] instance CAN instance number (0-2)
+ * @param[in] mbIndex Message Buffer index (16-31)
+ * 
+ * @return status_t
+ *         - STATUS_SUCCESS: MB released
+ *         - STATUS_INVALID_PARAM: Invalid instance or MB index
+ */
+status_t CAN_ReleaseRxMb(uint8_t instance, uint8_t mbIndex);
+
+/**
+ * @brief Install time source for extended RX timestamps
+ * @details The 16-bit MB TIME_STAMP counts nominal bit times and wraps every
+ *          65536 bits (131 ms at 500 Kbps). When a frame is read, the driver
+ *          takes the frame age (TIMER - TIME_STAMP) and subtracts it from the
+ *          current time source value, giving can_message_t.timestampUs with
+ *          bit-time resolution on the application time base.
+ * 
+ * @param[in] source Time source function (or NULL to disable, timestampUs = 0)
+ * 
+ * @note The frame must be read within one timer wrap period for timestampUs to
+ *       be correct; read it from the RX callback or FIFO callback.
+ * 
+ * @par Example:
+ * @code
+ * static uint32_t App_GetMicros(void) {
+ *     return SYSTICK_GetTicks() * 1000U;  // 1 ms SysTick, coarse epoch
+ * }
+ * 
+ * CAN_InstallTimeSource(App_GetMicros);
+ * @endcode
+ */
+void CAN_InstallTimeSource(can_time_source_t source);
+
 /**
  * @brief Configure RX filter for Message Buffer
  * @details Sets up acceptance filtering to receive only messages matching specific criteria.
@@ -640,10 +1038,15 @@ status_t CAN_ReceiveBlocking(uint8_t instance, uint8_t mbIndex,
  * @return status_t
  *         - STATUS_SUCCESS: Filter configured successfully
  *         - STATUS_INVALID_PARAM: Invalid parameter (NULL pointer, invalid instance/MB)
+ *         - STATUS_TIMEOUT: Failed to enter/exit freeze mode
  * 
  * @note Mask bit interpretation:
  *       - Mask bit = 1: Corresponding ID bit must match
  *       - Mask bit = 0: Corresponding ID bit is "don't care"
+ * @note Each Message Buffer has its own mask (RXIMR, MCR[IRMQ] enabled by
+ *       CAN_Init()), so narrow filters on different MBs do not affect each other.
+ *       RXIMR can only be written in freeze mode: the module briefly leaves
+ *       the bus while the filter is written.
  * 
  * @par Examples:
  * @code
@@ -687,7 +1090,8 @@ status_t CAN_ConfigRxFilter(uint8_t instance, uint8_t mbIndex,
  * 
  * @return status_t
  *         - STATUS_SUCCESS: Callback installed successfully
- *         - STATUS_INVALID_PARAM: Invalid instance or MB index
+ *         - STATUS_INVALID_PARAM: Invalid instance or MB index (CAN1 / CAN2
+ *           implement MB0-MB15 only)
  * 
  * @note Callback is called from ISR context. Keep callback execution time short.
  * 
@@ -716,7 +1120,8 @@ status_t CAN_InstallTxCallback(uint8_t instance, uint8_t mbIndex,
  * 
  * @return status_t
  *         - STATUS_SUCCESS: Callback installed successfully
- *         - STATUS_INVALID_PARAM: Invalid instance or MB index
+ *         - STATUS_INVALID_PARAM: Invalid instance or MB index (CAN1 / CAN2
+ *           implement MB0-MB15 only)
  * 
  * @note Callback is called from ISR context. Keep callback execution time short.
  *       Read message data in callback using CAN_Receive().
@@ -833,6 +1238,56 @@ status_t CAN_GetErrorState(uint8_t instance, can_error_state_t *errorState);
 status_t CAN_GetErrorCounters(uint8_t instance, 
                                uint8_t *txErrorCount, uint8_t *rxErrorCount);
 
+/**
+ * @brief Configure bus-off recovery and error interrupts
+ * @details Selects automatic or manual bus-off recovery (CTRL1[BOFFREC]),
+ *          the TX queue policy on bus-off, and which error interrupts are
+ *          enabled. Bus-off and bus-off done interrupts are always enabled,
+ *          so queued traffic resumes without calling CAN_Init() again.
+ * 
+ * @param[in] instance CAN instance number (0-2)
+ * @param[in] config Pointer to error handling configuration
+ * 
+ * @return status_t
+ *         - STATUS_SUCCESS: Error handling configured
+ *         - STATUS_INVALID_PARAM: Invalid parameter (NULL pointer, invalid instance)
+ *         - STATUS_NOT_INITIALIZED: CAN not initialized
+ *         - STATUS_TIMEOUT: Freeze mode timeout (MCR[WRNEN] changed)
+ * 
+ * @note MCR[WRNEN] is writable in freeze mode only: the module is frozen
+ *       briefly when enableWarningInterrupt changes.
+ * @note Install the vectors with CAN_InstallErrorIrqHandlers().
+ * 
+ * @par Example:
+ * @code
+ * can_error_config_t errConfig = {
+ *     .recovery = CAN_BUSOFF_RECOVERY_AUTO,
+ *     .txPolicy = CAN_BUSOFF_TX_FLUSH,
+ *     .enableWarningInterrupt = true,
+ *     .enableErrorInterrupt = false
+ * };
+ * CAN_ConfigErrorHandling(0, &errConfig);
+ * CAN_InstallErrorCallback(0, ErrorCallback, NULL);
+ * CAN_InstallErrorIrqHandlers(0);
+ * @endcode
+ */
+status_t CAN_ConfigErrorHandling(uint8_t instance, const can_error_config_t *config);
+
+/**
+ * @brief Start bus-off recovery (manual recovery mode)
+ * @details Clears CTRL1[BOFFREC]: the node rejoins the bus after 128 x 11
+ *          recessive bits. CAN_ErrorIRQHandler() sets BOFFREC again on
+ *          BOFFDONEINT so the next bus-off also waits for the application.
+ * 
+ * @param[in] instance CAN instance number (0-2)
+ * 
+ * @return status_t
+ *         - STATUS_SUCCESS: Recovery started
+ *         - STATUS_INVALID_PARAM: Invalid instance or automatic recovery mode
+ *         - STATUS_ERROR: Node is not bus off
+ */
+status_t CAN_RecoverFromBusOff(uint8_t instance);
+
 /**
  * @brief Abort pending transmission
  * @details Cancels a transmission that is queued but not yet sent.
@@ -1046,4 +1501,633 @@ status_t CAN_SetupRxMailbox(uint8_t instance, uint8_t mbIndex,
  */
 status_t CAN_SetOperatingMode(uint8_t instance, can_mode_t mode);
 
+/**
+ * @brief Configure RX FIFO and ID filter table
+ * @details Enables the legacy RX FIFO (MCR[RFEN]) and loads the ID filter table.
+ *          Incoming frames matching any table element are stored in a 6-deep
+ *          hardware FIFO, so bursts of frames are absorbed without the losses
+ *          seen when several frames target the same RX Message Buffer.
+ * 
+ * @param[in] instance CAN instance number (0-2)
+ * @param[in] config Pointer to RX FIFO configuration (filter table)
+ * 
+ * @return status_t
+ *         - STATUS_SUCCESS: RX FIFO configured successfully
+ *         - STATUS_INVALID_PARAM: Invalid parameter (NULL pointer, invalid instance, filter count)
+ *         - STATUS_NOT_INITIALIZED: CAN not initialized
+ *         - STATUS_TIMEOUT: Failed to enter/exit freeze mode
+ * 
+ * @note - MB0-MB7 are owned by the FIFO once enabled (see RX FIFO Layout)
+ *       - Filter table uses format A (MCR[IDAM] = 0) with 8 elements (CTRL2[RFFN] = 0)
+ *       - Only data frames are accepted by the filter table
+ * 
+ * @par Example:
+ * @code
+ * static const can_rx_filter_t fifoFilters[] = {
+ *     { .id = 0x100, .mask = 0x7F0, .idType = CAN_ID_STD },  // 0x100-0x10F
+ *     { .id = 0x18DAF110, .mask = 0x1FFFFFFF, .idType = CAN_ID_EXT }
+ * };
+ * can_rx_fifo_config_t fifoConfig = {
+ *     .filterTable = fifoFilters,
+ *     .filterCount = 2
+ * };
+ * CAN_ConfigRxFifo(0, &fifoConfig);
+ * @endcode
+ */
+status_t CAN_ConfigRxFifo(uint8_t instance, const can_rx_fifo_config_t *config);
+
+/**
+ * @brief Read one frame from RX FIFO (non-blocking)
+ * @details Copies the frame at the FIFO output (MB0 region) and releases it so
+ *          the next buffered frame moves to the output.
+ * 
+ * @param[in] instance CAN instance number (0-2)
+ * @param[out] message Pointer to store received message data
+ * 
+ * @return status_t
+ *         - STATUS_SUCCESS: Message read from FIFO
+ *         - STATUS_ERROR: FIFO empty or RX FIFO not enabled
+ *         - STATUS_INVALID_PARAM: Invalid parameter (NULL pointer, invalid instance)
+ *         - STATUS_NOT_INITIALIZED: CAN not initialized
+ * 
+ * @note Call repeatedly until STATUS_ERROR to drain all buffered frames.
+ * 
+ * @par Example:
+ * @code
+ * can_message_t rxMsg;
+ * while (CAN_ReadRxFifo(0, &rxMsg) == STATUS_SUCCESS) {
+ *     ProcessMessage(&rxMsg);
+ * }
+ * @endcode
+ */
+status_t CAN_ReadRxFifo(uint8_t instance, can_message_t *message);
+
+/**
+ * @brief Install RX FIFO callback
+ * @details Registers a callback invoked from CAN_IRQHandler() on RX FIFO events
+ *          and enables the FIFO interrupts (IMASK1 bits 5-7).
+ *          The mbIndex argument of the callback identifies the event:
+ *          - CAN_RX_FIFO_FRAME_AVAILABLE_IDX: at least one frame is available
+ *          - CAN_RX_FIFO_WARNING_IDX: FIFO holds 5 frames
+ *          - CAN_RX_FIFO_OVERFLOW_IDX: FIFO was full and a frame was lost
+ * 
+ * @param[in] instance CAN instance number (0-2)
+ * @param[in] callback Callback function pointer (or NULL to uninstall)
+ * @param[in] userData User-defined data passed to callback (can be NULL)
+ * 
+ * @return status_t
+ *         - STATUS_SUCCESS: Callback installed successfully
+ *         - STATUS_INVALID_PARAM: Invalid instance number
+ * 
+ * @note Callback is called from ISR context. On frame available the callback must
+ *       drain the FIFO with CAN_ReadRxFifo(), otherwise the interrupt stays pending.
+ * 
+ * @par Example:
+ * @code
+ * void RxFifoCallback(uint8_t inst, uint8_t event, void *userData) {
+ *     can_message_t msg;
+ *     if (event == CAN_RX_FIFO_FRAME_AVAILABLE_IDX) {
+ *         while (CAN_ReadRxFifo(inst, &msg) == STATUS_SUCCESS) {
+ *             ProcessMessage(&msg);
+ *         }
+ *     }
+ * }
+ * 
+ * CAN_InstallRxFifoCallback(0, RxFifoCallback, NULL);
+ * @endcode
+ */
+status_t CAN_InstallRxFifoCallback(uint8_t instance,
+                                    can_callback_t callback, void *userData);
+
+/**
+ * @brief Start RX FIFO to RAM DMA capture
+ * @details Sets MCR[DMA]: every frame reaching the FIFO output is copied by
+ *          the eDMA into the next ring entry (one 16-byte transfer from MB0)
+ *          and popped by the DMA read, with no CPU interrupt. The channel runs
+ *          a circular major loop over the ring; the application drains it
+ *          periodically with CAN_ReadRxFifoDma().
+ * 
+ * @param[in] instance CAN instance number (0-2)
+ * @param[in] config   DMA channel and ring buffer
+ * 
+ * @return status_t
+ *         - STATUS_SUCCESS: Capture running
+ *         - STATUS_ERROR: RX FIFO not enabled, capture already running or
+ *           buffer not 16-byte aligned
+ *         - STATUS_INVALID_PARAM: Invalid parameter
+ *         - STATUS_NOT_INITIALIZED: CAN not initialized
+ *         - STATUS_TIMEOUT: Freeze mode entry / exit failed
+ * 
+ * @note - CAN_ConfigRxFifo() must be called first; frames already in the FIFO
+ *         are discarded
+ *       - The frame available interrupt and CAN_ReadRxFifo() are not used in
+ *         DMA mode; warning / overflow events still reach the FIFO callback
+ *       - ID filter hit (RXFIR) is not captured
+ * 
+ * @par Example:
+ * @code
+ * static can_rx_dma_entry_t s_canLog[256] __attribute__((aligned(16)));
+ * 
+ * can_rx_dma_config_t dmaConfig = {
+ *     .dmaChannel = 4U,
+ *     .buffer = s_canLog,
+ *     .entryCount = 256U
+ * };
+ * CAN_ConfigRxFifo(0, &fifoConfig);
+ * CAN_StartRxFifoDma(0, &dmaConfig);
+ * 
+ * // Every 10 ms: 256 entries hold ~28 ms of 8-byte frames at 1 Mbit/s, 100 % load
+ * can_message_t msg;
+ * while (CAN_ReadRxFifoDma(0, &msg) == STATUS_SUCCESS) {
+ *     LogFrame(&msg);
+ * }
+ * @endcode
+ */
+status_t CAN_StartRxFifoDma(uint8_t instance, const can_rx_dma_config_t *config);
+
+/**
+ * @brief Stop RX FIFO DMA capture and return to CPU FIFO reads
+ * 
+ * @param[in] instance CAN instance number (0-2)
+ * 
+ * @return status_t
+ *         - STATUS_SUCCESS: DMA capture stopped (unread ring entries are dropped)
+ *         - STATUS_ERROR: DMA capture not running
+ *         - STATUS_INVALID_PARAM: Invalid instance number
+ *         - STATUS_TIMEOUT: Freeze mode entry / exit failed
+ */
+status_t CAN_StopRxFifoDma(uint8_t instance);
+
+/**
+ * @brief Read the oldest frame of the RX FIFO DMA ring (non-blocking)
+ * @details The write position is taken from the DMA major loop counter and
+ *          compared with the read position. A full ring (entryCount frames)
+ *          is still read normally. If the DMA has passed the reader (ring
+ *          overrun, unread entries overwritten) the unread entries are
+ *          dropped, the ring restarts empty and the overrun is counted. An
+ *          overrun of an exact multiple of entryCount frames is not detected.
+ * 
+ * @param[in] instance CAN instance number (0-2)
+ * @param[out] message Decoded frame
+ * 
+ * @return status_t
+ *         - STATUS_SUCCESS: Frame read, entry released
+ *         - STATUS_ERROR: Ring empty (or just resynchronized after an overrun)
+ *           or DMA capture not running
+ *         - STATUS_INVALID_PARAM: Invalid parameter
+ * 
+ * @note - Single reader: call from one context only
+ *       - timestampUs is correct only if the frame is read within one
+ *         wrap of the 16-bit CAN timer (65536 bit times)
+ */
+status_t CAN_ReadRxFifoDma(uint8_t instance, can_message_t *message);
+
+/**
+ * @brief Number of RX FIFO DMA ring overruns since CAN_StartRxFifoDma()
+ * 
+ * @param[in] instance CAN instance number (0-2)
+ * 
+ * @return uint32_t Overrun count (0 for an invalid instance)
+ */
+uint32_t CAN_GetRxFifoDmaOverruns(uint8_t instance);
+
+/**
+ * @brief Configure software TX queue
+ * @details Reserves a pool of TX Message Buffers for the TX queue, sets them to
+ *          TX_INACTIVE and enables their interrupts. Internal arbitration is set
+ *          to lowest ID first (CTRL1[LBUF] = 0), optionally including the local
+ *          priority field (MCR[LPRIOEN]).
+ * 
+ * @param[in] instance CAN instance number (0-2)
+ * @param[in] config Pointer to TX queue configuration
+ * 
+ * @return status_t
+ *         - STATUS_SUCCESS: TX queue configured successfully
+ *         - STATUS_INVALID_PARAM: Invalid parameter (NULL pointer, pool outside MB8-MB15)
+ *         - STATUS_NOT_INITIALIZED: CAN not initialized
+ *         - STATUS_TIMEOUT: Failed to enter/exit freeze mode
+ * 
+ * @note - Pool MBs are owned by the queue; do not use CAN_Send() on them
+ *       - TX callbacks installed on pool MBs are still called on completion
+ *       - Any frames still queued are discarded
+ * 
+ * @par Example:
+ * @code
+ * can_tx_queue_config_t queueConfig = {
+ *     .firstMb = 8,
+ *     .mbCount = 4,
+ *     .enableLocalPriority = false
+ * };
+ * CAN_ConfigTxQueue(0, &queueConfig);
+ * @endcode
+ */
+status_t CAN_ConfigTxQueue(uint8_t instance, const can_tx_queue_config_t *config);
+
+/**
+ * @brief Enqueue CAN message for transmission (non-blocking)
+ * @details Inserts the message into the software TX queue ordered by arbitration
+ *          value and loads it immediately if a pool Message Buffer is free.
+ *          Remaining frames are loaded from CAN_IRQHandler() as pool MBs complete.
+ * 
+ * @param[in] instance CAN instance number (0-2)
+ * @param[in] message Pointer to message structure
+ * @param[in] localPriority Local priority 0 (highest) to CAN_TX_LOCAL_PRIO_MAX,
+ *                          ignored unless enableLocalPriority was configured
+ * 
+ * @return status_t
+ *         - STATUS_SUCCESS: Message queued or loaded into a Message Buffer
+ *         - STATUS_BUSY: TX queue is full
+ *         - STATUS_INVALID_PARAM: Invalid parameter (NULL pointer, data length > 8, priority)
+ *         - STATUS_NOT_INITIALIZED: CAN or TX queue not initialized
+ * 
+ * @note Frames already loaded into MBs are not preempted, so a new low-ID frame
+ *       waits for the next free pool MB.
+ * 
+ * @par Example:
+ * @code
+ * if (CAN_EnqueueTx(0, &msg, 0) == STATUS_BUSY) {
+ *     // Queue full, retry later
+ * }
+ * @endcode
+ */
+status_t CAN_EnqueueTx(uint8_t instance, const can_message_t *message, uint8_t localPriority);
+
+/**
+ * @brief Get number of frames waiting in software TX queue
+ * @details Frames already loaded into Message Buffers are not counted.
+ * 
+ * @param[in] instance CAN instance number (0-2)
+ * @param[out] count Pointer to store number of queued frames
+ * 
+ * @return status_t
+ *         - STATUS_SUCCESS: Count retrieved successfully
+ *         - STATUS_INVALID_PARAM: Invalid parameter (NULL pointer, invalid instance)
+ */
+status_t CAN_GetTxQueueCount(uint8_t instance, uint8_t *count);
+
+/**
+ * @brief Configure CAN FD operation
+ * @details Enables FD mode (MCR[FDEN]) on FlexCAN0, programs nominal bit timing
+ *          through CBT and data phase timing through FDCBT, selects the MB payload
+ *          size and optional bit rate switching with transceiver delay compensation.
+ * 
+ * @param[in] instance CAN instance number (CAN_FD_INSTANCE only)
+ * @param[in] config Pointer to FD configuration
+ * 
+ * @return status_t
+ *         - STATUS_SUCCESS: FD configured successfully
+ *         - STATUS_INVALID_PARAM: Invalid parameter or bitrate not reachable with CAN clock
+ *         - STATUS_NOT_INITIALIZED: CAN not initialized
+ *         - STATUS_TIMEOUT: Failed to enter/exit freeze mode
+ * 
+ * @note - All Message Buffers are cleared; MAXMB is set to the MB count of the payload size
+ *       - RX FIFO cannot be used together with FD and is disabled
+ *       - Use the FD API (CAN_SendFd/CAN_ReceiveFd/CAN_SetupFdRxMailbox) afterwards,
+ *         the classic API assumes the 8-byte MB layout
+ * 
+ * @par Example:
+ * @code
+ * can_fd_config_t fdConfig = {
+ *     .nominalBaudRate = 500000,
+ *     .dataBaudRate = 2000000,
+ *     .payloadSize = CAN_FD_PAYLOAD_64,
+ *     .enableBrs = true,
+ *     .enableIsoCrc = true
+ * };
+ * CAN_ConfigFd(0, &fdConfig);
+ * @endcode
+ */
+status_t CAN_ConfigFd(uint8_t instance, const can_fd_config_t *config);
+
+/**
+ * @brief Get number of Message Buffers available in FD mode
+ * @param[in] payloadSize MB payload size
+ * @return Number of MBs (32, 21, 12 or 7)
+ */
+uint8_t CAN_GetFdMbCount(can_fd_payload_size_t payloadSize);
+
+/**
+ * @brief Convert DLC code to payload length
+ * @param[in] dlc DLC code (0-15)
+ * @return Payload length in bytes (0-8, 12, 16, 20, 24, 32, 48, 64)
+ */
+uint8_t CAN_DlcToLength(uint8_t dlc);
+
+/**
+ * @brief Convert payload length to DLC code
+ * @param[in] length Payload length in bytes (0-64)
+ * @return Smallest DLC code whose length covers the requested length
+ */
+uint8_t CAN_LengthToDlc(uint8_t length);
+
+/**
+ * @brief Send CAN FD message (non-blocking)
+ * @details Writes the frame into an FD-layout Message Buffer and activates it.
+ * 
+ * @param[in] instance CAN instance number (CAN_FD_INSTANCE only)
+ * @param[in] mbIndex Message Buffer index (below CAN_GetFdMbCount())
+ * @param[in] message Pointer to FD message
+ * 
+ * @return status_t
+ *         - STATUS_SUCCESS: Message queued for transmission
+ *         - STATUS_INVALID_PARAM: Invalid parameter (NULL pointer, MB index, length exceeds payload size)
+ *         - STATUS_NOT_INITIALIZED: CAN FD not configured
+ * 
+ * @par Example:
+ * @code
+ * can_fd_message_t msg = { .id = 0x7E0, .idType = CAN_ID_STD,
+ *                          .isFd = true, .brs = true, .dataLength = 64 };
+ * CAN_SendFd(0, 1, &msg);
+ * @endcode
+ */
+status_t CAN_SendFd(uint8_t instance, uint8_t mbIndex, const can_fd_message_t *message);
+
+/**
+ * @brief Receive CAN FD message (non-blocking)
+ * 
+ * @param[in] instance CAN instance number (CAN_FD_INSTANCE only)
+ * @param[in] mbIndex Message Buffer index (below CAN_GetFdMbCount())
+ * @param[out] message Pointer to store received message
+ * 
+ * @return status_t
+ *         - STATUS_SUCCESS: Message received
+ *         - STATUS_ERROR: No message available in Message Buffer
+ *         - STATUS_INVALID_PARAM: Invalid parameter (NULL pointer, MB index)
+ *         - STATUS_NOT_INITIALIZED: CAN FD not configured
+ */
+status_t CAN_ReceiveFd(uint8_t instance, uint8_t mbIndex, can_fd_message_t *message);
+
+/**
+ * @brief Setup RX Mailbox in FD layout
+ * @details Same as CAN_SetupRxMailbox() but uses the FD Message Buffer layout.
+ * 
+ * @param[in] instance CAN instance number (CAN_FD_INSTANCE only)
+ * @param[in] mbIndex Message Buffer index (below CAN_GetFdMbCount())
+ * @param[in] id CAN identifier to filter
+ * @param[in] idType CAN_ID_STD or CAN_ID_EXT
+ * @param[in] mask Filter mask (1=must match, 0=don't care)
+ * 
+ * @return status_t
+ *         - STATUS_SUCCESS: RX mailbox configured successfully
+ *         - STATUS_INVALID_PARAM: Invalid parameters
+ *         - STATUS_NOT_INITIALIZED: CAN FD not configured
+ *         - STATUS_TIMEOUT: Failed to enter/exit freeze mode
+ */
+status_t CAN_SetupFdRxMailbox(uint8_t instance, uint8_t mbIndex,
+                              uint32_t id, can_id_type_t idType, uint32_t mask);
+
+/**
+ * @brief Configure Pretended Networking filters
+ * @details Writes the wakeup filters, match count and timeout. Pretended
+ *          Networking itself is armed by CAN_EnterPretendedNetworking().
+ * 
+ * @param[in] instance CAN instance number (CAN_PN_INSTANCE only)
+ * @param[in] config Pointer to Pretended Networking configuration
+ * 
+ * @return status_t
+ *         - STATUS_SUCCESS: Configuration written
+ *         - STATUS_INVALID_PARAM: Invalid parameter (NULL pointer, instance, DLC range)
+ *         - STATUS_NOT_INITIALIZED: CAN not initialized
+ *         - STATUS_TIMEOUT: Failed to enter/exit freeze mode
+ * 
+ * @par Example:
+ * @code
+ * can_pn_config_t pn = {
+ *     .combination = CAN_PN_MATCH_ID_PAYLOAD,
+ *     .idFilterMode = CAN_PN_FILTER_EXACT,
+ *     .payloadFilterMode = CAN_PN_FILTER_EXACT,
+ *     .idType = CAN_ID_STD,
+ *     .id = 0x500U,
+ *     .idMaskOrUpper = 0x7FFU,
+ *     .dlcLow = 1U, .dlcHigh = 8U,
+ *     .payload = {0x01U},
+ *     .payloadMaskOrUpper = {0xFFU},
+ *     .timeout = 0U,
+ *     .enableMatchWakeup = true
+ * };
+ * CAN_ConfigPretendedNetworking(0, &pn);
+ * @endcode
+ */
+status_t CAN_ConfigPretendedNetworking(uint8_t instance, const can_pn_config_t *config);
+
+/**
+ * @brief Arm Pretended Networking before low-power entry
+ * @details Clears old wakeup flags and sets MCR[PNET_EN]. When the MCU then
+ *          enters STOP/VLPS (SMC_EnterStopMode()), FlexCAN switches to
+ *          Pretended Networking instead of stopping and keeps filtering.
+ * 
+ * @param[in] instance CAN instance number (CAN_PN_INSTANCE only)
+ * 
+ * @return status_t
+ *         - STATUS_SUCCESS: Pretended Networking armed
+ *         - STATUS_ERROR: CAN clock source is not the oscillator (CTRL1[CLKSRC] = 1),
+ *                         the bus clock stops in VLPS
+ *         - STATUS_INVALID_PARAM: Invalid instance
+ *         - STATUS_NOT_INITIALIZED: CAN not initialized
+ *         - STATUS_TIMEOUT: Failed to enter/exit freeze mode
+ * 
+ * @note SOSC must stay enabled in stop modes (SCG SOSCCSR[SOSCLPEN]).
+ */
+status_t CAN_EnterPretendedNetworking(uint8_t instance);
+
+/**
+ * @brief Disarm Pretended Networking after wakeup
+ * @details Clears MCR[PNET_EN] so the next stop entry is a normal FlexCAN stop.
+ * 
+ * @param[in] instance CAN instance number (CAN_PN_INSTANCE only)
+ * 
+ * @return status_t
+ *         - STATUS_SUCCESS: Pretended Networking disabled
+ *         - STATUS_INVALID_PARAM: Invalid instance
+ *         - STATUS_NOT_INITIALIZED: CAN not initialized
+ *         - STATUS_TIMEOUT: Failed to enter/exit freeze mode
+ */
+status_t CAN_ExitPretendedNetworking(uint8_t instance);
+
+/**
+ * @brief Get Pretended Networking wakeup status
+ * 
+ * @param[in] instance CAN instance number (CAN_PN_INSTANCE only)
+ * @param[out] wakeupFlags CAN_PN_WAKEUP_MATCH and/or CAN_PN_WAKEUP_TIMEOUT
+ * @param[out] matchCount Number of stored wakeup messages (may be NULL)
+ * 
+ * @return status_t
+ *         - STATUS_SUCCESS: Status read
+ *         - STATUS_INVALID_PARAM: Invalid parameter
+ */
+status_t CAN_GetPnWakeupStatus(uint8_t instance, uint32_t *wakeupFlags, uint8_t *matchCount);
+
+/**
+ * @brief Read a frame stored in a wakeup message buffer
+ * @details WMB0-WMB3 keep the frames that matched the filters while in
+ *          Pretended Networking, so the wake frame is not lost.
+ * 
+ * @param[in] instance CAN instance number (CAN_PN_INSTANCE only)
+ * @param[in] wmbIndex Wakeup message buffer index (0 to CAN_PN_WMB_COUNT-1)
+ * @param[out] message Pointer to store the frame
+ * 
+ * @return status_t
+ *         - STATUS_SUCCESS: Frame read
+ *         - STATUS_INVALID_PARAM: Invalid parameter
+ */
+status_t CAN_ReadWakeupMessage(uint8_t instance, uint8_t wmbIndex, can_message_t *message);
+
+/**
+ * @brief Install Pretended Networking wakeup callback
+ * 
+ * @param[in] instance CAN instance number (CAN_PN_INSTANCE only)
+ * @param[in] callback Callback function (NULL to uninstall)
+ * @param[in] userData User data passed to callback
+ * 
+ * @return status_t
+ *         - STATUS_SUCCESS: Callback installed
+ *         - STATUS_INVALID_PARAM: Invalid instance
+ */
+status_t CAN_InstallWakeupCallback(uint8_t instance,
+                                   can_wakeup_callback_t callback, void *userData);
+
+/**
+ * @brief Handle CAN Pretended Networking wakeup interrupt (called from ISR)
+ * @details Clears WU_MTC[WUMF/WTOF] and calls the wakeup callback.
+ * 
+ * @param[in] instance CAN instance number (CAN_PN_INSTANCE only)
+ * 
+ * @note User should call this from CAN0_Wake_Up_IRQHandler.
+ */
+void CAN_WakeupIRQHandler(uint8_t instance);
+
+#if CAN_STATISTICS_ENABLE
+/**
+ * @brief Get driver statistics
+ * @details Samples ESR1 and error state, then returns a snapshot of the counters.
+ *          Bus load is the estimated number of bits (worst-case stuffing,
+ *          including interframe space) of TX and RX frames over the last
+ *          CAN_STATS_BUSLOAD_BUCKETS x CAN_STATS_BUSLOAD_BUCKET_US window,
+ *          relative to the nominal bitrate.
+ * 
+ * @param[in] instance CAN instance number (0-2)
+ * @param[out] stats Pointer to store statistics snapshot
+ * 
+ * @return status_t
+ *         - STATUS_SUCCESS: Statistics retrieved successfully
+ *         - STATUS_INVALID_PARAM: Invalid parameter (NULL pointer, invalid instance)
+ * 
+ * @note Only available when CAN_STATISTICS_ENABLE is 1.
+ * 
+ * @par Example:
+ * @code
+ * can_statistics_t stats;
+ * CAN_GetStatistics(0, &stats);
+ * if (stats.busLoadPercent > 70U) {
+ *     ReducePeriodicTraffic();
+ * }
+ * @endcode
+ */
+status_t CAN_GetStatistics(uint8_t instance, can_statistics_t *stats);
+
+/**
+ * @brief Reset driver statistics
+ * @param[in] instance CAN instance number (0-2)
+ * @return status_t
+ *         - STATUS_SUCCESS: Statistics cleared
+ *         - STATUS_INVALID_PARAM: Invalid instance number
+ */
+status_t CAN_ResetStatistics(uint8_t instance);
+#endif /* CAN_STATISTICS_ENABLE */
+
+/**
+ * @brief Handle CAN Message Buffer interrupt (called from ISR)
+ * @details Dispatches pending, enabled Message Buffer flags to the installed
+ *          callbacks. RX FIFO events are dispatched to the RX FIFO callback,
+ *          completed TX queue pool MBs are refilled from the TX queue,
+ *          TX flags are cleared before the TX callback runs and RX callbacks
+ *          are expected to read the MB with CAN_Receive(), which clears the flag.
+ *          Pending flags are found by bit-scan, so each call costs one step per
+ *          set flag. Serves MB0-MB31; prefer the per-vector handlers below.
+ * 
+ * @param[in] instance CAN instance number (0-2)
+ * 
+ * @code
+ * void CAN0_ORed_0_15_MB_IRQHandler(void) {
+ *     CAN_IRQHandler_MB0_15(0);
+ * }
+ * 
+ * void CAN0_ORed_16_31_MB_IRQHandler(void) {
+ *     CAN_IRQHandler_MB16_31(0);
+ * }
+ * @endcode
+ */
+HAL_RAMFUNC void CAN_IRQHandler(uint8_t instance);
+
+/**
+ * @brief Handle CAN Message Buffer 0-15 interrupt (called from ISR)
+ * @details Same dispatch as CAN_IRQHandler() limited to MB0-MB15, including
+ *          RX FIFO events. User should call this from CANx_ORed_0_15_MB_IRQHandler.
+ * 
+ * @param[in] instance CAN instance number (0-2)
+ */
+HAL_RAMFUNC void CAN_IRQHandler_MB0_15(uint8_t instance);
+
+/**
+ * @brief Handle CAN Message Buffer 16-31 interrupt (called from ISR)
+ * @details Same dispatch as CAN_IRQHandler() limited to MB16-MB31.
+ *          User should call this from CANx_ORed_16_31_MB_IRQHandler.
+ * 
+ * @param[in] instance CAN instance number (0-2)
+ */
+HAL_RAMFUNC void CAN_IRQHandler_MB16_31(uint8_t instance);
+
+/**
+ * @brief Install the Message Buffer ISRs directly in the RAM vector table
+ * @details CANx_ORed_0_15_MB (and CAN0_ORed_16_31_MB) vectors then enter
+ *          the MB dispatch with instance and group baked in, without the
+ *          CANx_ORed_*_MB_IRQHandler wrappers. CAN1 / CAN2 have 16 MBs and
+ *          a single MB vector.
+ * 
+ * @param[in] instance CAN instance number (0-2)
+ * @return STATUS_SUCCESS if installed (NVIC enable is left to the caller)
+ * @return STATUS_INVALID_PARAM if instance invalid
+ * @return STATUS_ERROR if there is no RAM vector table
+ * 
+ * @code
+ * CAN_InstallIrqHandlers(0);
+ * NVIC_EnableIRQ(CAN0_ORed_0_15_MB_IRQn);
+ * NVIC_EnableIRQ(CAN0_ORed_16_31_MB_IRQn);
+ * @endcode
+ */
+status_t CAN_InstallIrqHandlers(uint8_t instance);
+
+/**
+ * @brief Handle CAN bus-off / error interrupt (called from ISR)
+ * @details Reads and clears the ESR1 interrupt flags, then:
+ *          - Bus-off entry with CAN_BUSOFF_TX_FLUSH: deactivates the busy TX
+ *            queue pool MBs and discards all queued frames
+ *          - Bus-off done in manual mode: sets CTRL1[BOFFREC] again
+ *          - Bus-off done: reloads free pool MBs from the TX queue
+ *          and calls the error callback with the ESR1 flags.
+ *          User should call this from CANx_ORed_IRQHandler and
+ *          CANx_Error_IRQHandler.
+ * 
+ * @param[in] instance CAN instance number (0-2)
+ */
+void CAN_ErrorIRQHandler(uint8_t instance);
+
+/**
+ * @brief Install the bus-off / error ISRs directly in the RAM vector table
+ * @details CANx_ORed (bus-off, warnings) and CANx_Error vectors enter
+ *          CAN_ErrorIRQHandler() with the instance baked in.
+ * 
+ * @param[in] instance CAN instance number (0-2)
+ * @return STATUS_SUCCESS if installed (NVIC enable is left to the caller)
+ * @return STATUS_INVALID_PARAM if instance invalid
+ * @return STATUS_ERROR if there is no RAM vector table
+ * 
+ * @code
+ * CAN_InstallErrorIrqHandlers(0);
+ * NVIC_EnableIRQ(CAN0_ORed_IRQn);
+ * NVIC_EnableIRQ(CAN0_Error_IRQn);
+ * @endcode
+ */
+status_t CAN_InstallErrorIrqHandlers(uint8_t instance);
+
 #endif /* CAN_H */
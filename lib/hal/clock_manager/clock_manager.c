@@ -3,11 +3,34 @@
 #include "scg.h"
 #include "pcc.h"
 
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+/** @brief Cortex-M4 DWT cycle counter (ARMv7-M debug registers) */
+#define CLOCK_DEMCR                 (*(volatile uint32_t *)0xE000EDFCUL)
+#define CLOCK_DEMCR_TRCENA          (0x01000000UL)
+#define CLOCK_DWT_CTRL              (*(volatile uint32_t *)0xE0001000UL)
+#define CLOCK_DWT_CTRL_CYCCNTENA    (0x00000001UL)
+#define CLOCK_DWT_CYCCNT            (*(volatile uint32_t *)0xE0001004UL)
+
+/** @brief Longest single wait, keeps us * cyclesPerUs inside 32 bits */
+#define CLOCK_DELAY_CHUNK_US        (1000000U)
+
 /*******************************************************************************
  * Private Variables
  ******************************************************************************/
 static uint32_t s_clockFrequencies[CLOCK_NAME_COUNT] = {0};
 static bool s_clockCacheValid = false;
+static uint32_t s_coreCyclesPerUs = 1U;
+
+/** @brief Registered clock change notifiers */
+static struct {
+    clock_notify_callback_t callback;
+    void *userData;
+} s_clockNotifiers[CLOCK_MANAGER_MAX_NOTIFIERS];
+
+/** @brief BEFORE sent, AFTER still owed */
+static bool s_clockChangePending = false;
 
 /*******************************************************************************
  * Private Functions
@@ -60,9 +83,30 @@ static void ClockManager_RefreshCache(void)
 {
     ClockManager_UpdateScgFrequencies();
     ClockManager_UpdatePeripheralFrequencies();
+
+    s_coreCyclesPerUs = s_clockFrequencies[CLOCK_NAME_CORE] / 1000000U;
+    if (s_coreCyclesPerUs == 0U) {
+        s_coreCyclesPerUs = 1U;
+    }
+
+    /* Free-running reference for the delay helpers */
+    CLOCK_DEMCR |= CLOCK_DEMCR_TRCENA;
+    CLOCK_DWT_CTRL |= CLOCK_DWT_CTRL_CYCCNTENA;
+
     s_clockCacheValid = true;
 }
 
+static void ClockManager_Notify(clock_notify_event_t event)
+{
+    uint32_t i;
+
+    for (i = 0U; i < CLOCK_MANAGER_MAX_NOTIFIERS; i++) {
+        if (s_clockNotifiers[i].callback != NULL) {
+            s_clockNotifiers[i].callback(event, s_clockNotifiers[i].userData);
+        }
+    }
+}
+
 /*******************************************************************************
  * Public Functions
  ******************************************************************************/
@@ -74,7 +118,66 @@ void ClockManager_Init(void)
 
 void ClockManager_Update(void)
 {
+    uint32_t previous[CLOCK_NAME_COUNT];
+    bool wasValid = s_clockCacheValid;
+
+    memcpy(previous, s_clockFrequencies, sizeof(previous));
+    PCC_InvalidateClockCache();
     ClockManager_RefreshCache();
+
+    /* First refresh after reset is not a change; an announced change always is */
+    if (s_clockChangePending ||
+        (wasValid && (memcmp(previous, s_clockFrequencies, sizeof(previous)) != 0))) {
+        s_clockChangePending = false;
+        ClockManager_Notify(CLOCK_NOTIFY_AFTER);
+    }
+}
+
+bool ClockManager_RegisterNotifier(clock_notify_callback_t callback, void *userData)
+{
+    uint32_t i;
+    uint32_t freeSlot = CLOCK_MANAGER_MAX_NOTIFIERS;
+
+    if (callback == NULL) {
+        return false;
+    }
+
+    for (i = 0U; i < CLOCK_MANAGER_MAX_NOTIFIERS; i++) {
+        if ((s_clockNotifiers[i].callback == callback) &&
+            (s_clockNotifiers[i].userData == userData)) {
+            return true;
+        }
+        if ((s_clockNotifiers[i].callback == NULL) && (freeSlot == CLOCK_MANAGER_MAX_NOTIFIERS)) {
+            freeSlot = i;
+        }
+    }
+
+    if (freeSlot == CLOCK_MANAGER_MAX_NOTIFIERS) {
+        return false;
+    }
+
+    s_clockNotifiers[freeSlot].userData = userData;
+    s_clockNotifiers[freeSlot].callback = callback;
+    return true;
+}
+
+void ClockManager_UnregisterNotifier(clock_notify_callback_t callback, void *userData)
+{
+    uint32_t i;
+
+    for (i = 0U; i < CLOCK_MANAGER_MAX_NOTIFIERS; i++) {
+        if ((s_clockNotifiers[i].callback == callback) &&
+            (s_clockNotifiers[i].userData == userData)) {
+            s_clockNotifiers[i].callback = NULL;
+            s_clockNotifiers[i].userData = NULL;
+        }
+    }
+}
+
+void ClockManager_NotifyBeforeChange(void)
+{
+    s_clockChangePending = true;
+    ClockManager_Notify(CLOCK_NOTIFY_BEFORE);
 }
 
 uint32_t ClockManager_GetFrequency(clock_name_t clockName)
@@ -100,6 +203,46 @@ uint32_t ClockManager_GetBusFreq(void)
     return ClockManager_GetFrequency(CLOCK_NAME_BUS);
 }
 
+uint32_t ClockManager_GetCoreCyclesPerUs(void)
+{
+    if (!s_clockCacheValid) {
+        ClockManager_RefreshCache();
+    }
+
+    return s_coreCyclesPerUs;
+}
+
+void ClockManager_DelayCycles(uint32_t cycles)
+{
+    uint32_t start = CLOCK_DWT_CYCCNT;
+
+    /* Unsigned difference stays correct across CYCCNT wrap */
+    while ((CLOCK_DWT_CYCCNT - start) < cycles) {
+    }
+}
+
+void ClockManager_DelayUs(uint32_t us)
+{
+    uint32_t start = CLOCK_DWT_CYCCNT;
+    uint32_t cyclesPerUs;
+
+    if (!s_clockCacheValid) {
+        ClockManager_RefreshCache();
+        start = CLOCK_DWT_CYCCNT;
+    }
+    cyclesPerUs = s_coreCyclesPerUs;
+
+    while (us > CLOCK_DELAY_CHUNK_US) {
+        while ((CLOCK_DWT_CYCCNT - start) < (CLOCK_DELAY_CHUNK_US * cyclesPerUs)) {
+        }
+        start += CLOCK_DELAY_CHUNK_US * cyclesPerUs;
+        us -= CLOCK_DELAY_CHUNK_US;
+    }
+
+    while ((CLOCK_DWT_CYCCNT - start) < (us * cyclesPerUs)) {
+    }
+}
+
 uint32_t ClockManager_CalcUartDivider(clock_name_t clockSource,
                                        uint32_t desiredBaudrate,
                                        uint8_t osr,
@@ -41,6 +41,32 @@ typedef enum {
     CLOCK_NAME_COUNT
 } clock_name_t;
 
+/*******************************************************************************
+ * Clock Change Notification
+ ******************************************************************************/
+
+/** @brief Maximum number of registered clock change notifiers */
+#ifndef CLOCK_MANAGER_MAX_NOTIFIERS
+#define CLOCK_MANAGER_MAX_NOTIFIERS     (8U)
+#endif
+
+/**
+ * @brief Clock change notification events
+ */
+typedef enum {
+    CLOCK_NOTIFY_BEFORE = 0,    /* SCG/PCC about to change: finish or pause traffic */
+    CLOCK_NOTIFY_AFTER          /* Cache refreshed: reprogram dividers from new frequencies */
+} clock_notify_event_t;
+
+/**
+ * @brief Clock change notifier
+ * @param event    CLOCK_NOTIFY_BEFORE or CLOCK_NOTIFY_AFTER
+ * @param userData User data given at registration
+ * @note Called in the context of the code changing the clocks, in
+ *       registration order. Must not register / unregister notifiers.
+ */
+typedef void (*clock_notify_callback_t)(clock_notify_event_t event, void *userData);
+
 /*******************************************************************************
  * API Functions
  ******************************************************************************/
@@ -73,9 +99,72 @@ uint32_t ClockManager_GetBusFreq(void);
 
 /**
  * @brief Update cached clock frequencies after SCG/PCC configuration changes
+ * @details Also invalidates the PCC DIV2 cache (PCC_InvalidateClockCache()),
+ *          so the live PCC queries used by driver init see the new values.
+ *          Sends CLOCK_NOTIFY_AFTER to every notifier when a cached frequency
+ *          changed or ClockManager_NotifyBeforeChange() was called before.
  */
 void ClockManager_Update(void);
 
+/**
+ * @brief Register a clock change notifier
+ * @param callback Notifier function
+ * @param userData User data passed back to the notifier
+ * @return true if registered (or already registered), false if the table is full
+ */
+bool ClockManager_RegisterNotifier(clock_notify_callback_t callback, void *userData);
+
+/**
+ * @brief Unregister a clock change notifier (callback and userData must match)
+ * @param callback Notifier function
+ * @param userData User data given at registration
+ */
+void ClockManager_UnregisterNotifier(clock_notify_callback_t callback, void *userData);
+
+/**
+ * @brief Announce an upcoming SCG/PCC clock change
+ * @details Sends CLOCK_NOTIFY_BEFORE to every notifier. Call it before
+ *          touching SCG/PCC and ClockManager_Update() once the new clocks
+ *          are stable; the AFTER notification is then always delivered.
+ *
+ * @code
+ * ClockManager_NotifyBeforeChange();
+ * SCG_SetSystemClockConfig(SCG_SYSTEM_CLOCK_MODE_RUN, &runCfg);
+ * ClockManager_Update();
+ * @endcode
+ */
+void ClockManager_NotifyBeforeChange(void);
+
+/*******************************************************************************
+ * Delay Helpers
+ ******************************************************************************/
+
+/**
+ * @brief Get cached core clock cycles per microsecond
+ * @return Cycles per microsecond (refreshed by ClockManager_Update())
+ */
+uint32_t ClockManager_GetCoreCyclesPerUs(void);
+
+/**
+ * @brief Busy-wait for a number of core clock cycles
+ * @param cycles Number of core cycles to wait
+ * @note Uses the free-running DWT cycle counter, enabled when the cache is
+ *       refreshed. No timer channel is touched, so other LPIT / SysTick users
+ *       are not disturbed and the call is safe from any context.
+ */
+void ClockManager_DelayCycles(uint32_t cycles);
+
+/**
+ * @brief Busy-wait for a number of microseconds
+ * @param us Delay in microseconds
+ * @note Elapsed cycles are compared against the cached cycles-per-us value, so
+ *       the per-call overhead is a few cycles instead of reconfiguring a timer
+ *       as LPIT_DelayUs() / SYSTICK_DelayUs() do. Call ClockManager_Update()
+ *       after changing the core clock.
+ * @note Interrupts taking longer than the delay only extend it.
+ */
+void ClockManager_DelayUs(uint32_t us);
+
 /*******************************************************************************
  * Baudrate Calculation Helpers
  ******************************************************************************/
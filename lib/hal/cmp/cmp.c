@@ -0,0 +1,300 @@
+/**
+ * @file    cmp.c
+ * @brief   CMP Driver Implementation for S32K144
+ * @details Implementation of the CMP0 input / DAC / mode configuration,
+ *          edge flags and interrupt.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "cmp.h"
+#include "pcc.h"
+#include "nvic.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+
+/** @brief Edge callback */
+static cmp_callback_t s_cmpCallback = NULL;
+static void *s_cmpUserData = NULL;
+
+static bool s_cmpInitialized = false;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Edge bitmask -> C0 flag / enable bits (CFR / IER rising, CFF / IEF falling)
+ */
+static uint32_t CMP_EdgesToFlags(cmp_edge_t edges)
+{
+    uint32_t flags = 0U;
+
+    if (((uint32_t)edges & (uint32_t)CMP_EDGE_RISING) != 0U) {
+        flags |= CMP_C0_CFR_MASK;
+    }
+    if (((uint32_t)edges & (uint32_t)CMP_EDGE_FALLING) != 0U) {
+        flags |= CMP_C0_CFF_MASK;
+    }
+
+    return flags;
+}
+
+/**
+ * @brief C0 flag bits -> edge bitmask
+ */
+static cmp_edge_t CMP_FlagsToEdges(uint32_t c0)
+{
+    uint32_t edges = 0U;
+
+    if ((c0 & CMP_C0_CFR_MASK) != 0U) {
+        edges |= (uint32_t)CMP_EDGE_RISING;
+    }
+    if ((c0 & CMP_C0_CFF_MASK) != 0U) {
+        edges |= (uint32_t)CMP_EDGE_FALLING;
+    }
+
+    return (cmp_edge_t)edges;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+status_t CMP_Init(const cmp_config_t *config)
+{
+    bool filtered;
+    uint32_t c0;
+    uint32_t c1;
+
+    if ((config == NULL) || (config->plusInput == config->minusInput) ||
+        ((uint32_t)config->plusInput > (uint32_t)CMP_INPUT_DAC) ||
+        ((uint32_t)config->minusInput > (uint32_t)CMP_INPUT_DAC) ||
+        ((uint32_t)config->mode > (uint32_t)CMP_MODE_WINDOWED_FILTERED) ||
+        ((uint32_t)config->hysteresis > (uint32_t)CMP_HYSTERESIS_LEVEL3) ||
+        ((uint32_t)config->interruptEdges > (uint32_t)CMP_EDGE_BOTH)) {
+        return STATUS_ERROR;
+    }
+
+    filtered = (config->mode == CMP_MODE_FILTERED) || (config->mode == CMP_MODE_WINDOWED_FILTERED);
+    if (filtered && ((config->filterCount == 0U) || (config->filterCount > CMP_MAX_FILTER_COUNT) ||
+                     (config->filterPeriod == 0U))) {
+        return STATUS_ERROR;
+    }
+
+    /* STOP / VLPS: no bus clock for filter / sample, no DMA */
+    if (config->wakeupFromStop &&
+        ((config->mode != CMP_MODE_CONTINUOUS) || config->dmaEnable ||
+         (config->interruptEdges == CMP_EDGE_NONE))) {
+        return STATUS_ERROR;
+    }
+
+    if (!s_cmpInitialized) {
+        if (!PCC_AcquirePeripheralClock(PCC_CMP0_INDEX)) {
+            return STATUS_ERROR;
+        }
+    }
+
+    /* Disable before changing mode / inputs, clear stale flags */
+    CMP0->C0 = CMP_C0_FLAGS_MASK;
+    CMP0->C2 = CMP_C2_CHF_MASK;
+
+    /* DAC enabled when either input is the DAC */
+    c1 = 0U;
+    if (config->plusInput == CMP_INPUT_DAC) {
+        c1 |= CMP_C1_INPSEL(0U);
+    } else {
+        c1 |= CMP_C1_INPSEL(1U) | CMP_C1_PSEL(config->plusInput);
+    }
+    if (config->minusInput == CMP_INPUT_DAC) {
+        c1 |= CMP_C1_INNSEL(0U);
+    } else {
+        c1 |= CMP_C1_INNSEL(1U) | CMP_C1_MSEL(config->minusInput);
+    }
+    if ((config->plusInput == CMP_INPUT_DAC) || (config->minusInput == CMP_INPUT_DAC)) {
+        c1 |= CMP_C1_DACEN_MASK | CMP_C1_VOSEL(config->dacLevel);
+        if (config->dacRef == CMP_DAC_REF_VIN2) {
+            c1 |= CMP_C1_VRSEL_MASK;
+        }
+    }
+    CMP0->C1 = c1;
+
+    c0 = CMP_C0_HYSTCTR(config->hysteresis);
+    switch (config->mode) {
+        case CMP_MODE_SAMPLED:
+            /* Filter clock = sample signal from TRGMUX, 1 sample */
+            c0 |= CMP_C0_SE_MASK | CMP_C0_FILTER_CNT(1U);
+            break;
+        case CMP_MODE_FILTERED:
+            c0 |= CMP_C0_FILTER_CNT(config->filterCount) | CMP_C0_FPR(config->filterPeriod);
+            break;
+        case CMP_MODE_WINDOWED:
+            c0 |= CMP_C0_WE_MASK;
+            break;
+        case CMP_MODE_WINDOWED_FILTERED:
+            c0 |= CMP_C0_WE_MASK | CMP_C0_FILTER_CNT(config->filterCount) |
+                  CMP_C0_FPR(config->filterPeriod);
+            break;
+        default:
+            /* Continuous: FILTER_CNT = 0, FPR = 0 */
+            break;
+    }
+    if (config->highSpeed) {
+        c0 |= CMP_C0_PMODE_MASK;
+    }
+    if (config->invert) {
+        c0 |= CMP_C0_INVT_MASK;
+    }
+    if (config->unfilteredOutput) {
+        c0 |= CMP_C0_COS_MASK;
+    }
+    if (config->outputPinEnable) {
+        c0 |= CMP_C0_OPE_MASK;
+    }
+
+    /* IER / IEF select the edge for both the interrupt and the DMA request */
+    if (((uint32_t)config->interruptEdges & (uint32_t)CMP_EDGE_RISING) != 0U) {
+        c0 |= CMP_C0_IER_MASK;
+    }
+    if (((uint32_t)config->interruptEdges & (uint32_t)CMP_EDGE_FALLING) != 0U) {
+        c0 |= CMP_C0_IEF_MASK;
+    }
+    if (config->dmaEnable) {
+        c0 |= CMP_C0_DMAEN_MASK;
+    }
+
+    /* Configure first, EN last; flags from input settling are cleared */
+    CMP0->C0 = c0 | CMP_C0_FLAGS_MASK;
+    CMP0->C0 = c0 | CMP_C0_EN_MASK | CMP_C0_FLAGS_MASK;
+
+    s_cmpInitialized = true;
+
+    return STATUS_SUCCESS;
+}
+
+status_t CMP_Deinit(void)
+{
+    if (s_cmpInitialized) {
+        CMP0->C0 = CMP_C0_FLAGS_MASK;
+        CMP0->C1 = 0U;
+        (void)PCC_ReleasePeripheralClock(PCC_CMP0_INDEX);
+    }
+
+    s_cmpCallback = NULL;
+    s_cmpUserData = NULL;
+    s_cmpInitialized = false;
+
+    return STATUS_SUCCESS;
+}
+
+status_t CMP_SetDacLevel(uint8_t level)
+{
+    if (!s_cmpInitialized) {
+        return STATUS_ERROR;
+    }
+
+    CMP0->C1 = (CMP0->C1 & ~CMP_C1_VOSEL_MASK) | CMP_C1_VOSEL(level);
+
+    return STATUS_SUCCESS;
+}
+
+uint8_t CMP_MillivoltsToDacLevel(uint32_t millivolts, uint32_t vinMillivolts)
+{
+    uint32_t level;
+
+    if ((vinMillivolts == 0U) || (millivolts == 0U)) {
+        return 0U;
+    }
+
+    /* Vout = Vin * (level + 1) / 256, rounded to the nearest level */
+    level = (((millivolts * CMP_DAC_LEVELS) + (vinMillivolts / 2U)) / vinMillivolts);
+    if (level == 0U) {
+        return 0U;
+    }
+    if (level > CMP_DAC_LEVELS) {
+        level = CMP_DAC_LEVELS;
+    }
+
+    return (uint8_t)(level - 1U);
+}
+
+bool CMP_GetOutput(void)
+{
+    if (!s_cmpInitialized) {
+        return false;
+    }
+
+    return (CMP0->C0 & CMP_C0_COUT_MASK) != 0U;
+}
+
+cmp_edge_t CMP_GetFlags(void)
+{
+    if (!s_cmpInitialized) {
+        return CMP_EDGE_NONE;
+    }
+
+    return CMP_FlagsToEdges(CMP0->C0);
+}
+
+void CMP_ClearFlags(cmp_edge_t edges)
+{
+    uint32_t c0;
+
+    if (!s_cmpInitialized) {
+        return;
+    }
+
+    /* W1C: write 1 only to the requested flags */
+    c0 = CMP0->C0 & ~CMP_C0_FLAGS_MASK;
+    CMP0->C0 = c0 | CMP_EdgesToFlags(edges);
+}
+
+status_t CMP_SetSampleSource(trgmux_source_t source)
+{
+    return TRGMUX_SetSource(TRGMUX_TARGET_CMP0, 0U, source);
+}
+
+status_t CMP_InstallCallback(cmp_callback_t callback, void *userData)
+{
+    uint32_t basepri = NVIC_EnterCritical();
+
+    s_cmpCallback = callback;
+    s_cmpUserData = userData;
+
+    NVIC_ExitCritical(basepri);
+
+    return STATUS_SUCCESS;
+}
+
+status_t CMP_InstallIrqHandler(void)
+{
+    if (NVIC_InstallHandler(CMP0_IRQn, CMP_IRQHandler) != NVIC_STATUS_SUCCESS) {
+        return STATUS_ERROR;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+void CMP_IRQHandler(void)
+{
+    uint32_t c0 = CMP0->C0;
+    cmp_edge_t edges = CMP_FlagsToEdges(c0);
+
+    if (edges == CMP_EDGE_NONE) {
+        return;
+    }
+
+    CMP0->C0 = (c0 & ~CMP_C0_FLAGS_MASK) | CMP_EdgesToFlags(edges);
+
+    if (s_cmpCallback != NULL) {
+        s_cmpCallback(edges, (c0 & CMP_C0_COUT_MASK) != 0U, s_cmpUserData);
+    }
+}
@@ -0,0 +1,242 @@
+/**
+ * @file    cmp.h
+ * @brief   CMP (Analog Comparator) driver for S32K144
+ * @details
+ * CMP driver provides the following APIs:
+ * - Plus / minus input from the 8-to-1 analog mux or the internal 8-bit DAC
+ *   (threshold in millivolts via CMP_MillivoltsToDacLevel())
+ * - Continuous, sampled, filtered and windowed modes, hysteresis and
+ *   high-speed / low-speed mode
+ * - Interrupt or DMA request on rising / falling output edges, output to the
+ *   CMP0_OUT pin and to TRGMUX (TRGMUX_SRC_CMP0_OUT: FTM fault, PDB, LPIT...)
+ * - Wakeup from STOP / VLPS on a threshold crossing (continuous mode)
+ *
+ * Overcurrent / threshold detection runs in the comparator, no ADC
+ * conversion and no CPU polling until the edge.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ *
+ * @note
+ * - DAC output Vout = Vin * (dacLevel + 1) / 256, Vin = VREFH or VDD
+ * - Sampled / windowed modes take the sample / window signal from TRGMUX
+ *   (TRGMUX_TARGET_CMP0 input 0, CMP_SetSampleSource())
+ * - With dmaEnable the enabled edges raise DMAMUX_SRC_CMP0 requests instead
+ *   of interrupts
+ *
+ * @par Change Log:
+ * - Version 1.0 (14/10/2026): Initial CMP driver
+ */
+
+#ifndef CMP_H
+#define CMP_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "cmp_reg.h"
+#include "trgmux.h"
+#include "status.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @defgroup CMP_Definitions CMP Definitions
+ * @{
+ */
+
+/** @brief Number of DAC levels */
+#define CMP_DAC_LEVELS          (256U)
+
+/** @brief Maximum filter sample count */
+#define CMP_MAX_FILTER_COUNT    (7U)
+
+/**
+ * @brief Comparator input
+ */
+typedef enum {
+    CMP_INPUT_IN0 = 0U,                 /**< Analog mux input 0 */
+    CMP_INPUT_IN1 = 1U,                 /**< Analog mux input 1 */
+    CMP_INPUT_IN2 = 2U,                 /**< Analog mux input 2 */
+    CMP_INPUT_IN3 = 3U,                 /**< Analog mux input 3 */
+    CMP_INPUT_IN4 = 4U,                 /**< Analog mux input 4 */
+    CMP_INPUT_IN5 = 5U,                 /**< Analog mux input 5 */
+    CMP_INPUT_IN6 = 6U,                 /**< Analog mux input 6 */
+    CMP_INPUT_IN7 = 7U,                 /**< Analog mux input 7 */
+    CMP_INPUT_DAC = 8U                  /**< Internal 8-bit DAC */
+} cmp_input_t;
+
+/**
+ * @brief DAC supply reference (C1[VRSEL])
+ */
+typedef enum {
+    CMP_DAC_REF_VIN1 = 0U,              /**< VIN1 = VREFH */
+    CMP_DAC_REF_VIN2 = 1U               /**< VIN2 = VDD */
+} cmp_dac_ref_t;
+
+/**
+ * @brief Operating mode
+ */
+typedef enum {
+    CMP_MODE_CONTINUOUS         = 0U,   /**< Output follows the inputs, works in STOP / VLPS */
+    CMP_MODE_SAMPLED            = 1U,   /**< Output latched on the TRGMUX sample signal */
+    CMP_MODE_FILTERED           = 2U,   /**< filterCount equal samples every filterPeriod bus clocks */
+    CMP_MODE_WINDOWED           = 3U,   /**< Output updates only while the TRGMUX window is high */
+    CMP_MODE_WINDOWED_FILTERED  = 4U    /**< Windowed + internal filter */
+} cmp_mode_t;
+
+/**
+ * @brief Hysteresis level (C0[HYSTCTR], see datasheet for mV)
+ */
+typedef enum {
+    CMP_HYSTERESIS_LEVEL0 = 0U,         /**< Lowest */
+    CMP_HYSTERESIS_LEVEL1 = 1U,
+    CMP_HYSTERESIS_LEVEL2 = 2U,
+    CMP_HYSTERESIS_LEVEL3 = 3U          /**< Highest */
+} cmp_hysteresis_t;
+
+/**
+ * @brief Output edge bitmask
+ */
+typedef enum {
+    CMP_EDGE_NONE    = 0U,              /**< No edge */
+    CMP_EDGE_RISING  = 1U,              /**< Output went 0 -> 1 (CFR) */
+    CMP_EDGE_FALLING = 2U,              /**< Output went 1 -> 0 (CFF) */
+    CMP_EDGE_BOTH    = 3U               /**< Both edges */
+} cmp_edge_t;
+
+/**
+ * @brief CMP configuration
+ */
+typedef struct {
+    cmp_input_t plusInput;              /**< Plus input */
+    cmp_input_t minusInput;             /**< Minus input (different from plusInput) */
+    cmp_dac_ref_t dacRef;               /**< DAC supply (used when an input is CMP_INPUT_DAC) */
+    uint8_t dacLevel;                   /**< DAC level, Vout = Vin * (dacLevel + 1) / 256 */
+    cmp_mode_t mode;                    /**< Operating mode */
+    uint8_t filterCount;                /**< Filtered modes: 1 - CMP_MAX_FILTER_COUNT samples */
+    uint8_t filterPeriod;               /**< Filtered modes: sample period in bus clocks (>= 1) */
+    cmp_hysteresis_t hysteresis;        /**< Hysteresis */
+    bool highSpeed;                     /**< High-speed mode (more current, shorter delay) */
+    bool invert;                        /**< Invert the output */
+    bool unfilteredOutput;              /**< Pin / TRGMUX output is COUTA (before the filter) */
+    bool outputPinEnable;               /**< Drive CMP0_OUT (pin mux configured separately) */
+    cmp_edge_t interruptEdges;          /**< Edges raising the interrupt (or DMA request) */
+    bool dmaEnable;                     /**< Enabled edges raise DMA requests instead of interrupts */
+    bool wakeupFromStop;                /**< Keep working in STOP / VLPS (CMP_MODE_CONTINUOUS only) */
+} cmp_config_t;
+
+/**
+ * @brief Edge callback (interrupt context)
+ * @param edges    Edges that were flagged (flags already cleared)
+ * @param output   Comparator output when the interrupt was served
+ * @param userData Pointer to user data
+ */
+typedef void (*cmp_callback_t)(cmp_edge_t edges, bool output, void *userData);
+
+/** @} */ /* End of CMP_Definitions */
+
+/*******************************************************************************
+ * API Function Prototypes
+ ******************************************************************************/
+
+/**
+ * @defgroup CMP_Functions CMP Functions
+ * @{
+ */
+
+/**
+ * @brief Enable the CMP0 clock and configure and enable the comparator
+ *
+ * @param[in] config CMP configuration
+ *
+ * @return STATUS_SUCCESS,
+ *         STATUS_ERROR on invalid parameters (same input on both sides,
+ *         filter out of range, wakeupFromStop with a mode that needs the bus
+ *         clock, wakeupFromStop with DMA or without interrupt edge)
+ *
+ * @code
+ * // Overcurrent: shunt amplifier on CMP0_IN2 above 2.0 V (VREFH = 5 V)
+ * cmp_config_t cfg = {
+ *     .plusInput = CMP_INPUT_IN2, .minusInput = CMP_INPUT_DAC,
+ *     .dacRef = CMP_DAC_REF_VIN1, .dacLevel = CMP_MillivoltsToDacLevel(2000U, 5000U),
+ *     .mode = CMP_MODE_FILTERED, .filterCount = 4U, .filterPeriod = 10U,
+ *     .hysteresis = CMP_HYSTERESIS_LEVEL1, .highSpeed = true,
+ *     .interruptEdges = CMP_EDGE_RISING
+ * };
+ * CMP_Init(&cfg);
+ * CMP_InstallCallback(OnOvercurrent, NULL);
+ * CMP_InstallIrqHandler();
+ * NVIC_EnableIRQ(CMP0_IRQn);
+ * @endcode
+ */
+status_t CMP_Init(const cmp_config_t *config);
+
+/**
+ * @brief Disable the comparator and DAC, release the CMP0 clock
+ * @return STATUS_SUCCESS
+ */
+status_t CMP_Deinit(void);
+
+/**
+ * @brief Change the DAC threshold while the comparator runs
+ * @param[in] level DAC level
+ * @return STATUS_ERROR if not initialized
+ */
+status_t CMP_SetDacLevel(uint8_t level);
+
+/**
+ * @brief DAC level closest to a threshold voltage
+ * @param[in] millivolts Threshold (mV)
+ * @param[in] vinMillivolts DAC supply voltage (VREFH or VDD, mV)
+ * @return uint8_t DAC level, clamped to 0 - 255
+ */
+uint8_t CMP_MillivoltsToDacLevel(uint32_t millivolts, uint32_t vinMillivolts);
+
+/**
+ * @brief Read the comparator output (C0[COUT], after filter / invert)
+ */
+bool CMP_GetOutput(void);
+
+/**
+ * @brief Edges flagged since the last clear
+ */
+cmp_edge_t CMP_GetFlags(void);
+
+/**
+ * @brief Clear edge flags
+ * @param[in] edges Flags to clear
+ */
+void CMP_ClearFlags(cmp_edge_t edges);
+
+/**
+ * @brief Route a TRGMUX source to the CMP0 sample / window input
+ * @param[in] source Trigger source (e.g. TRGMUX_SRC_PDB0_CH0_TRIG, FTM init trigger)
+ * @return STATUS_ERROR if the TRGMUX register is locked
+ */
+status_t CMP_SetSampleSource(trgmux_source_t source);
+
+/**
+ * @brief Install the edge callback (NULL to remove)
+ */
+status_t CMP_InstallCallback(cmp_callback_t callback, void *userData);
+
+/**
+ * @brief Install CMP_IRQHandler() in the RAM vector table
+ * @return STATUS_ERROR if the vector cannot be installed
+ */
+status_t CMP_InstallIrqHandler(void);
+
+/**
+ * @brief CMP0 interrupt handler: clears CFR / CFF, calls the callback
+ */
+void CMP_IRQHandler(void);
+
+/** @} */ /* End of CMP_Functions */
+
+#endif /* CMP_H */
@@ -0,0 +1,224 @@
+/**
+ * @file    cmp_reg.h
+ * @brief   CMP (Analog Comparator) Register Definitions for S32K144
+ * @details
+ * Defines CMP0 registers and bitfields.
+ * CMP compares two analog inputs (8-to-1 pin mux or the internal 8-bit DAC)
+ * and raises interrupt / DMA / TRGMUX events on output edges without any
+ * ADC conversion or CPU polling.
+ *
+ * S32K144 CMP features:
+ * - 1 instance (CMP0), plus / minus input from the 8-to-1 mux or the DAC
+ * - 8-bit DAC reference (VIN1 = VREFH or VIN2 = VDD), 256 levels
+ * - Programmable hysteresis, high-speed or low-speed mode
+ * - Sampled, filtered (1-7 consecutive samples) and windowed modes
+ * - Interrupt / DMA request on rising / falling edge, output to pin and TRGMUX
+ * - Runs in STOP / VLPS (continuous mode) and wakes the MCU
+ * - Round-robin scan of the mux channels against a fixed input
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ *
+ * @note    Refer to S32K1xx Reference Manual Chapter 41 (CMP)
+ * @warning Must enable the CMP0 clock gate (PCC) before register access
+ *
+ * @par Change Log:
+ * - Version 1.0 (14/10/2026): Initial CMP register definitions
+ */
+
+#ifndef CMP_REG_H
+#define CMP_REG_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "def_reg.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief CMP0 module base address */
+#define CMP0_BASE           (0x40073000UL)
+
+/*******************************************************************************
+ * CMP Register Structure
+ ******************************************************************************/
+
+/**
+ * @brief CMP Module Structure
+ */
+typedef struct {
+    __IO uint32_t C0;               /**< 0x0000: Control Register 0 (mode, filter, flags) */
+    __IO uint32_t C1;               /**< 0x0004: Control Register 1 (DAC, input mux) */
+    __IO uint32_t C2;               /**< 0x0008: Control Register 2 (round robin) */
+} CMP_Type;
+
+/*******************************************************************************
+ * Register Access Macros
+ ******************************************************************************/
+
+/** @brief CMP0 module pointer */
+#define CMP0                ((CMP_Type *)CMP0_BASE)
+
+/*******************************************************************************
+ * Control Register 0 (C0) Bit Definitions
+ ******************************************************************************/
+
+/** @brief Hysteresis level (0 - 3) */
+#define CMP_C0_HYSTCTR_MASK     (0x00000003UL)
+#define CMP_C0_HYSTCTR_SHIFT    (0U)
+#define CMP_C0_HYSTCTR(x)       (((uint32_t)(x) << CMP_C0_HYSTCTR_SHIFT) & CMP_C0_HYSTCTR_MASK)
+
+/** @brief Comparator hard block offset */
+#define CMP_C0_OFFSET_MASK      (0x00000004UL)
+#define CMP_C0_OFFSET_SHIFT     (2U)
+
+/** @brief Filter sample count - consecutive samples that must agree (0 = bypass) */
+#define CMP_C0_FILTER_CNT_MASK  (0x00000070UL)
+#define CMP_C0_FILTER_CNT_SHIFT (4U)
+#define CMP_C0_FILTER_CNT(x)    (((uint32_t)(x) << CMP_C0_FILTER_CNT_SHIFT) & CMP_C0_FILTER_CNT_MASK)
+
+/** @brief Comparator module enable */
+#define CMP_C0_EN_MASK          (0x00000100UL)
+#define CMP_C0_EN_SHIFT         (8U)
+
+/** @brief Comparator output pin enable (CMP0_OUT) */
+#define CMP_C0_OPE_MASK         (0x00000200UL)
+#define CMP_C0_OPE_SHIFT        (9U)
+
+/** @brief Comparator output select - 0 filtered COUT, 1 unfiltered COUTA */
+#define CMP_C0_COS_MASK         (0x00000400UL)
+#define CMP_C0_COS_SHIFT        (10U)
+
+/** @brief Comparator invert */
+#define CMP_C0_INVT_MASK        (0x00000800UL)
+#define CMP_C0_INVT_SHIFT       (11U)
+
+/** @brief Power mode select - 1 high speed, 0 low speed */
+#define CMP_C0_PMODE_MASK       (0x00001000UL)
+#define CMP_C0_PMODE_SHIFT      (12U)
+
+/** @brief Windowing enable - COUT only updates while the window signal is high */
+#define CMP_C0_WE_MASK          (0x00004000UL)
+#define CMP_C0_WE_SHIFT         (14U)
+
+/** @brief Sample enable - filter clock from the external sample signal (TRGMUX) */
+#define CMP_C0_SE_MASK          (0x00008000UL)
+#define CMP_C0_SE_SHIFT         (15U)
+
+/** @brief Filter sample period in bus clocks (SE = 0, 0 = filter off) */
+#define CMP_C0_FPR_MASK         (0x00FF0000UL)
+#define CMP_C0_FPR_SHIFT        (16U)
+#define CMP_C0_FPR(x)           (((uint32_t)(x) << CMP_C0_FPR_SHIFT) & CMP_C0_FPR_MASK)
+
+/** @brief Analog comparator output (read only) */
+#define CMP_C0_COUT_MASK        (0x01000000UL)
+#define CMP_C0_COUT_SHIFT       (24U)
+
+/** @brief Analog comparator flag falling (write 1 to clear) */
+#define CMP_C0_CFF_MASK         (0x02000000UL)
+#define CMP_C0_CFF_SHIFT        (25U)
+
+/** @brief Analog comparator flag rising (write 1 to clear) */
+#define CMP_C0_CFR_MASK         (0x04000000UL)
+#define CMP_C0_CFR_SHIFT        (26U)
+
+/** @brief Comparator interrupt enable falling */
+#define CMP_C0_IEF_MASK         (0x08000000UL)
+#define CMP_C0_IEF_SHIFT        (27U)
+
+/** @brief Comparator interrupt enable rising */
+#define CMP_C0_IER_MASK         (0x10000000UL)
+#define CMP_C0_IER_SHIFT        (28U)
+
+/** @brief DMA request enable (on enabled CFR / CFF) */
+#define CMP_C0_DMAEN_MASK       (0x40000000UL)
+#define CMP_C0_DMAEN_SHIFT      (30U)
+
+/** @brief Write 1 to clear flags of C0 */
+#define CMP_C0_FLAGS_MASK       (CMP_C0_CFF_MASK | CMP_C0_CFR_MASK)
+
+/*******************************************************************************
+ * Control Register 1 (C1) Bit Definitions
+ ******************************************************************************/
+
+/** @brief DAC output voltage select - Vout = Vin * (VOSEL + 1) / 256 */
+#define CMP_C1_VOSEL_MASK       (0x000000FFUL)
+#define CMP_C1_VOSEL_SHIFT      (0U)
+#define CMP_C1_VOSEL(x)         (((uint32_t)(x) << CMP_C1_VOSEL_SHIFT) & CMP_C1_VOSEL_MASK)
+
+/** @brief Minus input mux channel (INNSEL = 1) */
+#define CMP_C1_MSEL_MASK        (0x00000700UL)
+#define CMP_C1_MSEL_SHIFT       (8U)
+#define CMP_C1_MSEL(x)          (((uint32_t)(x) << CMP_C1_MSEL_SHIFT) & CMP_C1_MSEL_MASK)
+
+/** @brief Plus input mux channel (INPSEL = 1) */
+#define CMP_C1_PSEL_MASK        (0x00003800UL)
+#define CMP_C1_PSEL_SHIFT       (11U)
+#define CMP_C1_PSEL(x)          (((uint32_t)(x) << CMP_C1_PSEL_SHIFT) & CMP_C1_PSEL_MASK)
+
+/** @brief DAC supply voltage reference - 0 VIN1 (VREFH), 1 VIN2 (VDD) */
+#define CMP_C1_VRSEL_MASK       (0x00004000UL)
+#define CMP_C1_VRSEL_SHIFT      (14U)
+
+/** @brief DAC enable */
+#define CMP_C1_DACEN_MASK       (0x00008000UL)
+#define CMP_C1_DACEN_SHIFT      (15U)
+
+/** @brief Round-robin channel enable CHN0..CHN7 */
+#define CMP_C1_CHN_MASK         (0x00FF0000UL)
+#define CMP_C1_CHN_SHIFT        (16U)
+#define CMP_C1_CHN(x)           (((uint32_t)(x) << CMP_C1_CHN_SHIFT) & CMP_C1_CHN_MASK)
+
+/** @brief Minus input select - 0 DAC, 1 analog mux */
+#define CMP_C1_INNSEL_MASK      (0x03000000UL)
+#define CMP_C1_INNSEL_SHIFT     (24U)
+#define CMP_C1_INNSEL(x)        (((uint32_t)(x) << CMP_C1_INNSEL_SHIFT) & CMP_C1_INNSEL_MASK)
+
+/** @brief Plus input select - 0 DAC, 1 analog mux */
+#define CMP_C1_INPSEL_MASK      (0x18000000UL)
+#define CMP_C1_INPSEL_SHIFT     (27U)
+#define CMP_C1_INPSEL(x)        (((uint32_t)(x) << CMP_C1_INPSEL_SHIFT) & CMP_C1_INPSEL_MASK)
+
+/*******************************************************************************
+ * Control Register 2 (C2) Bit Definitions
+ ******************************************************************************/
+
+/** @brief Pre-set / last comparison result of the round-robin channels */
+#define CMP_C2_ACON_MASK        (0x000000FFUL)
+#define CMP_C2_ACON_SHIFT       (0U)
+
+/** @brief Round-robin initialization delay (round-robin clock cycles) */
+#define CMP_C2_INITMOD_MASK     (0x00003F00UL)
+#define CMP_C2_INITMOD_SHIFT    (8U)
+#define CMP_C2_INITMOD(x)       (((uint32_t)(x) << CMP_C2_INITMOD_SHIFT) & CMP_C2_INITMOD_MASK)
+
+/** @brief Round-robin sample clocks per channel */
+#define CMP_C2_NSAM_MASK        (0x0000C000UL)
+#define CMP_C2_NSAM_SHIFT       (14U)
+#define CMP_C2_NSAM(x)          (((uint32_t)(x) << CMP_C2_NSAM_SHIFT) & CMP_C2_NSAM_MASK)
+
+/** @brief Round-robin channel flags CH0F..CH7F (write 1 to clear) */
+#define CMP_C2_CHF_MASK         (0x00FF0000UL)
+#define CMP_C2_CHF_SHIFT        (16U)
+
+/** @brief Round-robin fixed mux channel */
+#define CMP_C2_FXMXCH_MASK      (0x0E000000UL)
+#define CMP_C2_FXMXCH_SHIFT     (25U)
+#define CMP_C2_FXMXCH(x)        (((uint32_t)(x) << CMP_C2_FXMXCH_SHIFT) & CMP_C2_FXMXCH_MASK)
+
+/** @brief Round-robin fixed mux port - 0 plus, 1 minus */
+#define CMP_C2_FXMP_MASK        (0x20000000UL)
+#define CMP_C2_FXMP_SHIFT       (29U)
+
+/** @brief Round-robin interrupt enable */
+#define CMP_C2_RRIE_MASK        (0x40000000UL)
+#define CMP_C2_RRIE_SHIFT       (30U)
+
+/** @brief Round-robin enable */
+#define CMP_C2_RRE_MASK         (0x80000000UL)
+#define CMP_C2_RRE_SHIFT        (31U)
+
+#endif /* CMP_REG_H */
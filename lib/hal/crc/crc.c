@@ -0,0 +1,348 @@
+/**
+ * @file    crc.c
+ * @brief   CRC driver implementation for S32K144
+ * @details The seed is loaded with TOT = 0 so it is the raw register value
+ *          whatever the input reflection. CPU writes feed byte-swapped
+ *          words (value high byte first); DMA writes memory words as they
+ *          are, with byte transposition added to TOT for the duration of
+ *          the transfer. CTRL writes with WAS = 0 keep the running checksum.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ *
+ * @par Change Log:
+ * - Version 1.0 (Oct 14, 2026): Initial version
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "crc.h"
+#include "dma.h"
+#include "pcc.h"
+#include "nvic.h"
+#include <stddef.h>
+#include <string.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+
+/** @brief TOT / TOTR encodings */
+#define CRC_TRANSPOSE_NONE              (0U)
+#define CRC_TRANSPOSE_BITS              (1U)
+#define CRC_TRANSPOSE_BITS_AND_BYTES    (2U)
+#define CRC_TRANSPOSE_BYTES             (3U)
+
+/*******************************************************************************
+ * Private Types
+ ******************************************************************************/
+
+/**
+ * @brief DMA computation state (shared with DMA_IRQHandler())
+ */
+typedef struct {
+    uint8_t channel;                /**< DMA channel */
+    const uint8_t *next;            /**< Start of the next DMA chunk */
+    uint32_t words;                 /**< Body words not yet handed to the DMA */
+    const uint8_t *tail;            /**< Bytes after the body */
+    uint32_t tailLength;
+    crc_callback_t callback;
+    void *userData;
+} crc_dma_state_t;
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static bool s_initialized = false;
+static volatile bool s_busy = false;
+static uint32_t s_ctrl = 0U;                /* CTRL of the running computation */
+static crc_width_t s_width = CRC_WIDTH_32;
+static bool s_reflectOut = false;
+static crc_dma_state_t s_dma;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Start the next DMA chunk of at most CRC_DMA_CHUNK_WORDS words
+ * @return STATUS_SUCCESS if the channel was started
+ */
+static status_t CRC_DmaStartChunk(void)
+{
+    dma_channel_config_t config;
+    uint32_t words = (s_dma.words < CRC_DMA_CHUNK_WORDS) ? s_dma.words : CRC_DMA_CHUNK_WORDS;
+
+    config.channel = s_dma.channel;
+    config.source = DMAMUX_SRC_ALWAYS_ON_61;
+    config.transferType = DMA_TRANSFER_MEM_TO_PERIPH;
+    config.transferSize = DMA_TRANSFER_SIZE_4B;
+    config.priority = DMA_PRIORITY_LOW;
+
+    config.sourceAddr = (uint32_t)s_dma.next;
+    config.sourceOffset = 4;
+    config.sourceLastAddrAdjust = 0;
+
+    config.destAddr = (uint32_t)&CRC->DATAu.DATA;
+    config.destOffset = 0;
+    config.destLastAddrAdjust = 0;
+
+    config.minorLoopBytes = 4U;
+    config.majorLoopCount = (uint16_t)words;
+
+    config.enableInterrupt = true;
+    config.disableRequestAfterDone = true;
+    config.enablePeriodicTrigger = false;
+
+    s_dma.next += words * 4U;
+    s_dma.words -= words;
+
+    if (DMA_ConfigChannel(&config) != STATUS_SUCCESS) {
+        return STATUS_ERROR;
+    }
+
+    return DMA_StartChannel(s_dma.channel);
+}
+
+/**
+ * @brief Feed the tail, release the engine and report the result
+ */
+static void CRC_DmaFinish(status_t status)
+{
+    crc_callback_t callback = s_dma.callback;
+    void *userData = s_dma.userData;
+    uint32_t result = 0U;
+
+    CRC->CTRL = s_ctrl;
+    if (status == STATUS_SUCCESS) {
+        CRC_FeedBuffer(s_dma.tail, s_dma.tailLength);
+        result = CRC_GetResult();
+    }
+    CRC_End();
+
+    if (callback != NULL) {
+        callback(status, result, userData);
+    }
+}
+
+/**
+ * @brief Major loop complete: next chunk, or finish
+ */
+static void CRC_DmaCallback(uint8_t channel, void *userData)
+{
+    (void)channel;
+    (void)userData;
+
+    if (s_dma.words == 0U) {
+        CRC_DmaFinish(STATUS_SUCCESS);
+    } else if (CRC_DmaStartChunk() != STATUS_SUCCESS) {
+        CRC_DmaFinish(STATUS_ERROR);
+    }
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+/**
+ * @brief Enable the CRC clock
+ */
+status_t CRC_Init(void)
+{
+    if (!PCC_EnablePeripheralClock(PCC_CRC_INDEX)) {
+        return STATUS_ERROR;
+    }
+
+    s_busy = false;
+    s_initialized = true;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Claim and configure the engine
+ */
+status_t CRC_Begin(const crc_config_t *config)
+{
+    uint32_t primask;
+    uint32_t tcrc;
+
+    if ((config == NULL) || !s_initialized) {
+        return STATUS_ERROR;
+    }
+
+    primask = NVIC_DisableGlobalIRQ();
+    if (s_busy) {
+        NVIC_EnableGlobalIRQ(primask);
+        return STATUS_BUSY;
+    }
+    s_busy = true;
+    NVIC_EnableGlobalIRQ(primask);
+
+    tcrc = (config->width == CRC_WIDTH_32) ? CRC_CTRL_TCRC_MASK : 0U;
+
+    s_width = config->width;
+    s_reflectOut = config->reflectOut;
+    s_ctrl = tcrc |
+             CRC_CTRL_TOT(config->reflectIn ? CRC_TRANSPOSE_BITS : CRC_TRANSPOSE_NONE) |
+             CRC_CTRL_TOTR(config->reflectOut ? CRC_TRANSPOSE_BITS_AND_BYTES : CRC_TRANSPOSE_NONE) |
+             (config->complementOut ? CRC_CTRL_FXOR_MASK : 0U);
+
+    if (config->width == CRC_WIDTH_32) {
+        CRC->GPOLY = config->polynomial;
+    } else {
+        CRC->GPOLY = config->polynomial & CRC_GPOLY_LOW_MASK;
+    }
+
+    /* Seed untransposed: it is the register value, not input data */
+    CRC->CTRL = tcrc | CRC_CTRL_WAS_MASK;
+    CRC->DATAu.DATA = (config->width == CRC_WIDTH_32) ? config->seed : (config->seed & 0xFFFFU);
+    CRC->CTRL = s_ctrl;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Feed a byte buffer
+ */
+void CRC_FeedBuffer(const uint8_t *data, uint32_t length)
+{
+    uint32_t word;
+
+    if (data == NULL) {
+        return;
+    }
+
+    while ((length > 0U) && (((uint32_t)data & 3U) != 0U)) {
+        CRC_Feed8(*data);
+        data++;
+        length--;
+    }
+
+    /* One REV per word: data[0] ends up in the byte processed first */
+    while (length >= 4U) {
+        memcpy(&word, data, 4U);
+        CRC_Feed32(__builtin_bswap32(word));
+        data += 4U;
+        length -= 4U;
+    }
+
+    while (length > 0U) {
+        CRC_Feed8(*data);
+        data++;
+        length--;
+    }
+}
+
+/**
+ * @brief Read the checksum
+ */
+uint32_t CRC_GetResult(void)
+{
+    uint32_t value = CRC->DATAu.DATA;
+
+    if (s_width == CRC_WIDTH_32) {
+        return value;
+    }
+
+    /* Full transposition moves the 16-bit result to DATA[31:16] */
+    return s_reflectOut ? (value >> 16U) : (value & 0xFFFFU);
+}
+
+/**
+ * @brief Release the engine
+ */
+void CRC_End(void)
+{
+    s_busy = false;
+}
+
+/**
+ * @brief One-shot checksum
+ */
+status_t CRC_Compute(const crc_config_t *config, const void *data, uint32_t length, uint32_t *result)
+{
+    status_t status;
+
+    if ((result == NULL) || ((data == NULL) && (length != 0U))) {
+        return STATUS_ERROR;
+    }
+
+    status = CRC_Begin(config);
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+
+    CRC_FeedBuffer((const uint8_t *)data, length);
+    *result = CRC_GetResult();
+    CRC_End();
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief DMA-fed checksum
+ */
+status_t CRC_ComputeDmaAsync(const crc_config_t *config, uint8_t channel, const void *data,
+                             uint32_t length, crc_callback_t callback, void *userData)
+{
+    const uint8_t *bytes = (const uint8_t *)data;
+    uint32_t head;
+    uint32_t transpose;
+    status_t status;
+
+    if ((callback == NULL) || (channel >= DMA_MAX_CHANNELS) || ((data == NULL) && (length != 0U))) {
+        return STATUS_ERROR;
+    }
+
+    if (DMA_IsChannelActive(channel)) {
+        return STATUS_BUSY;
+    }
+
+    status = CRC_Begin(config);
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+
+    head = (4U - ((uint32_t)bytes & 3U)) & 3U;
+    if (head > length) {
+        head = length;
+    }
+    CRC_FeedBuffer(bytes, head);
+
+    s_dma.channel = channel;
+    s_dma.next = &bytes[head];
+    s_dma.words = (length - head) / 4U;
+    s_dma.tail = &bytes[head + (s_dma.words * 4U)];
+    s_dma.tailLength = (length - head) & 3U;
+    s_dma.callback = callback;
+    s_dma.userData = userData;
+
+    if (s_dma.words == 0U) {
+        CRC_DmaFinish(STATUS_SUCCESS);
+        return STATUS_SUCCESS;
+    }
+
+    /* DMA writes memory words unswapped: add byte transposition */
+    transpose = config->reflectIn ? CRC_TRANSPOSE_BITS_AND_BYTES : CRC_TRANSPOSE_BYTES;
+    CRC->CTRL = (s_ctrl & ~CRC_CTRL_TOT_MASK) | CRC_CTRL_TOT(transpose);
+
+    if ((DMA_InstallCallback(channel, CRC_DmaCallback, NULL) != STATUS_SUCCESS) ||
+        (CRC_DmaStartChunk() != STATUS_SUCCESS)) {
+        CRC->CTRL = s_ctrl;
+        CRC_End();
+        return STATUS_ERROR;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Engine ownership
+ */
+bool CRC_IsBusy(void)
+{
+    return s_busy;
+}
@@ -0,0 +1,215 @@
+/**
+ * @file    crc.h
+ * @brief   CRC driver for S32K144
+ * @details
+ * CRC driver provides the following APIs for the 16 / 32-bit hardware CRC
+ * engine (programmable polynomial, seed, transposition and final XOR):
+ * - One-shot checksum of a buffer (CRC_Compute)
+ * - Streaming feed with 8, 16 and 32-bit writes between CRC_Begin() / CRC_End()
+ * - DMA-fed mode for large buffers, result delivered from DMA_IRQHandler()
+ * - Presets for CRC-32 (Ethernet / zlib) and CRC-16/CCITT-FALSE
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ *
+ * @note
+ * - The configuration uses the usual parametrisation (width, poly, init,
+ *   reflect in / out, xor out), the driver derives TOT / TOTR / FXOR
+ * - There is one engine: CRC_Begin() claims it, other callers get
+ *   STATUS_BUSY until CRC_End() (or the end of a DMA computation).
+ *   Callers that may run while another context owns the engine (ISRs)
+ *   need a fallback or must retry later.
+ * - Buffers are fed one 32-bit write per 4 bytes; unaligned head and tail
+ *   bytes use 8-bit writes
+ *
+ * @par Change Log:
+ * - Version 1.0 (14/10/2026): Initial CRC driver (streaming, one-shot, DMA)
+ */
+
+#ifndef CRC_H
+#define CRC_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "crc_reg.h"
+#include "status.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @defgroup CRC_Definitions CRC Definitions
+ * @{
+ */
+
+/**
+ * @brief Words per DMA major loop (CITER limit 32767)
+ * @details Larger buffers are split, the next chunk is started from the
+ *          DMA interrupt.
+ */
+#ifndef CRC_DMA_CHUNK_WORDS
+#define CRC_DMA_CHUNK_WORDS     (32767U)
+#endif
+
+/**
+ * @brief CRC width
+ */
+typedef enum {
+    CRC_WIDTH_16 = 0U,              /**< 16-bit CRC, GPOLY[15:0] */
+    CRC_WIDTH_32 = 1U               /**< 32-bit CRC */
+} crc_width_t;
+
+/**
+ * @brief CRC algorithm parameters
+ */
+typedef struct {
+    crc_width_t width;              /**< CRC width */
+    uint32_t polynomial;            /**< Normal (MSB-first) polynomial, e.g. 0x04C11DB7 */
+    uint32_t seed;                  /**< Initial register value */
+    bool reflectIn;                 /**< Each input byte processed LSB first */
+    bool reflectOut;                /**< Result bit reversed */
+    bool complementOut;             /**< Result XORed with all ones */
+} crc_config_t;
+
+/** @brief CRC-32 (Ethernet, zlib, PNG): check("123456789") = 0xCBF43926 */
+#define CRC_CONFIG_CRC32                { CRC_WIDTH_32, 0x04C11DB7UL, 0xFFFFFFFFUL, true, true, true }
+
+/** @brief CRC-16/CCITT-FALSE: check("123456789") = 0x29B1 */
+#define CRC_CONFIG_CRC16_CCITT_FALSE    { CRC_WIDTH_16, 0x1021UL, 0xFFFFUL, false, false, false }
+
+/**
+ * @brief DMA computation callback (called from DMA_IRQHandler())
+ * @param status   STATUS_SUCCESS, or STATUS_ERROR if a DMA chunk could not be started
+ * @param result   Checksum (valid on success)
+ * @param userData Pointer to user data
+ */
+typedef void (*crc_callback_t)(status_t status, uint32_t result, void *userData);
+
+/** @} */ /* End of CRC_Definitions */
+
+/*******************************************************************************
+ * Inline Functions
+ ******************************************************************************/
+
+/**
+ * @defgroup CRC_Feed CRC Streaming Feed
+ * @brief Register writes between CRC_Begin() and CRC_End()
+ * @details Values are fed most significant byte first (network order),
+ *          each byte LSB first when reflectIn is set.
+ * @{
+ */
+
+/** @brief Feed one byte */
+static inline void CRC_Feed8(uint8_t data)
+{
+    CRC->DATAu.DATA_8.LL = data;
+}
+
+/** @brief Feed a 16-bit value (high byte first) */
+static inline void CRC_Feed16(uint16_t data)
+{
+    CRC->DATAu.DATA_16.L = data;
+}
+
+/** @brief Feed a 32-bit value (high byte first) */
+static inline void CRC_Feed32(uint32_t data)
+{
+    CRC->DATAu.DATA = data;
+}
+
+/** @} */ /* End of CRC_Feed */
+
+/*******************************************************************************
+ * API Function Prototypes
+ ******************************************************************************/
+
+/**
+ * @defgroup CRC_Functions CRC Functions
+ * @{
+ */
+
+/**
+ * @brief Enable the CRC clock (PCC) and release the engine
+ * @return STATUS_SUCCESS, STATUS_ERROR if the clock cannot be enabled
+ */
+status_t CRC_Init(void);
+
+/**
+ * @brief Claim the engine and load configuration and seed
+ * @param[in] config Algorithm parameters
+ * @return STATUS_SUCCESS if the engine is now owned by the caller
+ * @return STATUS_BUSY if another context owns it
+ * @return STATUS_ERROR if config is NULL or CRC_Init() was not called
+ */
+status_t CRC_Begin(const crc_config_t *config);
+
+/**
+ * @brief Feed a byte buffer (32-bit writes for the aligned body)
+ * @param[in] data   Data
+ * @param[in] length Bytes
+ */
+void CRC_FeedBuffer(const uint8_t *data, uint32_t length);
+
+/**
+ * @brief Read the checksum of the data fed so far
+ * @details Reflection and final XOR applied, 16-bit results in bits 15:0.
+ *          Feeding may continue afterwards.
+ * @return uint32_t Checksum
+ */
+uint32_t CRC_GetResult(void);
+
+/**
+ * @brief Release the engine claimed by CRC_Begin()
+ */
+void CRC_End(void);
+
+/**
+ * @brief Checksum of a buffer in one call (Begin, FeedBuffer, GetResult, End)
+ * @param[in]  config Algorithm parameters
+ * @param[in]  data   Data
+ * @param[in]  length Bytes
+ * @param[out] result Checksum
+ * @return STATUS_SUCCESS, STATUS_BUSY if the engine is owned, STATUS_ERROR on invalid parameters
+ *
+ * @code
+ * static const crc_config_t s_crc32 = CRC_CONFIG_CRC32;
+ * uint32_t crc;
+ *
+ * CRC_Init();
+ * if (CRC_Compute(&s_crc32, image, imageSize, &crc) == STATUS_SUCCESS) { ... }
+ * @endcode
+ */
+status_t CRC_Compute(const crc_config_t *config, const void *data, uint32_t length, uint32_t *result);
+
+/**
+ * @brief Checksum of a large buffer fed by DMA (non-blocking)
+ * @details The engine stays claimed until the callback. The aligned body
+ *          is written to CRC DATA by the DMA channel in chunks of up to
+ *          CRC_DMA_CHUNK_WORDS words; head and tail bytes are fed by the CPU.
+ * @param[in] config   Algorithm parameters
+ * @param[in] channel  DMA channel (DMA_Init() done, channel IRQ enabled in the NVIC)
+ * @param[in] data     Data (flash or SRAM), must stay valid until the callback
+ * @param[in] length   Bytes
+ * @param[in] callback Completion callback (DMA interrupt context)
+ * @param[in] userData Pointer passed back to the callback
+ * @return STATUS_SUCCESS if started (short buffers complete before returning)
+ * @return STATUS_BUSY if the engine or the channel is in use
+ * @return STATUS_ERROR on invalid parameters
+ */
+status_t CRC_ComputeDmaAsync(const crc_config_t *config, uint8_t channel, const void *data,
+                             uint32_t length, crc_callback_t callback, void *userData);
+
+/**
+ * @brief Check whether the engine is claimed (streaming or DMA)
+ * @return bool true if owned
+ */
+bool CRC_IsBusy(void);
+
+/** @} */ /* End of CRC_Functions */
+
+#endif /* CRC_H */
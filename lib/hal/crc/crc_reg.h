@@ -0,0 +1,81 @@
+/**
+ * @file    crc_reg.h
+ * @brief   CRC Register Definitions for S32K144
+ * @details This file contains low-level Cyclic Redundancy Check register
+ *          definitions (16 / 32-bit programmable polynomial engine).
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ *
+ * @note    These are raw register definitions for CRC peripheral
+ * @warning Direct register access - use with caution
+ *
+ * @par Change Log:
+ * - Version 1.0 (Oct 14, 2026): Initial version
+ *
+ */
+
+#ifndef CRC_REG_H
+#define CRC_REG_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include "def_reg.h"
+
+/*******************************************************************************
+ * CRC Register Structure
+ ******************************************************************************/
+
+/**
+ * @brief CRC Register Layout
+ * @details DATA accepts 8, 16 and 32-bit writes; each write feeds that many
+ *          bits into the engine.
+ */
+typedef struct {
+    union {
+        __IO uint32_t DATA;     /**< CRC Data register, offset: 0x00 */
+        struct {
+            __IO uint16_t L;    /**< DATA[15:0], offset: 0x00 */
+            __IO uint16_t H;    /**< DATA[31:16], offset: 0x02 */
+        } DATA_16;
+        struct {
+            __IO uint8_t LL;    /**< DATA[7:0], offset: 0x00 */
+            __IO uint8_t LU;    /**< DATA[15:8], offset: 0x01 */
+            __IO uint8_t HL;    /**< DATA[23:16], offset: 0x02 */
+            __IO uint8_t HU;    /**< DATA[31:24], offset: 0x03 */
+        } DATA_8;
+    } DATAu;
+    __IO uint32_t GPOLY;        /**< CRC Polynomial register, offset: 0x04 */
+    __IO uint32_t CTRL;         /**< CRC Control register, offset: 0x08 */
+} CRC_RegType;
+
+/** @brief CRC base address */
+#define CRC_BASE_ADDR           (0x40032000UL)
+
+/** @brief CRC base pointer */
+#define CRC                     ((CRC_RegType *)CRC_BASE_ADDR)
+
+/*******************************************************************************
+ * GPOLY - Polynomial Register
+ ******************************************************************************/
+#define CRC_GPOLY_LOW_MASK      (0x0000FFFFUL)  /**< 16-bit polynomial */
+#define CRC_GPOLY_HIGH_MASK     (0xFFFF0000UL)  /**< Upper half of 32-bit polynomial */
+
+/*******************************************************************************
+ * CTRL - Control Register
+ ******************************************************************************/
+#define CRC_CTRL_TCRC_MASK      (0x01000000UL)  /**< 1 = 32-bit CRC, 0 = 16-bit */
+#define CRC_CTRL_WAS_MASK       (0x02000000UL)  /**< Writes to DATA load the seed */
+#define CRC_CTRL_FXOR_MASK      (0x04000000UL)  /**< Complement the read checksum */
+#define CRC_CTRL_TOTR_SHIFT     (28U)           /**< Transpose of read data */
+#define CRC_CTRL_TOTR_MASK      (0x30000000UL)
+#define CRC_CTRL_TOT_SHIFT      (30U)           /**< Transpose of written data */
+#define CRC_CTRL_TOT_MASK       (0xC0000000UL)
+
+#define CRC_CTRL_TOTR(x)        (((uint32_t)(x) << CRC_CTRL_TOTR_SHIFT) & CRC_CTRL_TOTR_MASK)
+#define CRC_CTRL_TOT(x)         (((uint32_t)(x) << CRC_CTRL_TOT_SHIFT) & CRC_CTRL_TOT_MASK)
+
+#endif /* CRC_REG_H */
@@ -0,0 +1,677 @@
+/**
+ * @file    csec.c
+ * @brief   CSEc driver implementation for S32K144
+ * @details Commands longer than the 7 data pages of CSE_PRAM run as a
+ *          sequence (CALL_SEQ first / subsequent). Each step is loaded with
+ *          32-bit PRAM writes; the next step is launched either by the
+ *          blocking wait loop or by CSEC_IRQHandler() on CCIF.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ *
+ * @par Change Log:
+ * - Version 1.0 (Oct 14, 2026): Initial version
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "csec.h"
+#include "ftfc.h"
+#include "nvic.h"
+#include <stddef.h>
+#include <string.h>
+
+/*******************************************************************************
+ * Private Types
+ ******************************************************************************/
+
+/**
+ * @brief Command sequence state (shared with CSEC_IRQHandler())
+ */
+typedef struct {
+    volatile bool active;           /**< Sequence in progress */
+    volatile status_t lastStatus;   /**< Result of the last sequence */
+    bool async;                     /**< Steps driven by the CCIF interrupt */
+    uint8_t cmd;                    /**< CSEC_CMD_x */
+    uint8_t keyId;
+    uint8_t seq;                    /**< CSEC_SEQ_x of the next step */
+    const uint8_t *input;
+    uint8_t *output;
+    uint32_t length;                /**< Total bytes */
+    uint32_t index;                 /**< Bytes completed */
+    uint32_t chunk;                 /**< Bytes in the running step */
+    const uint8_t *iv;              /**< CBC */
+    const uint8_t *mac;             /**< Verify: expected MAC */
+    uint16_t macBits;               /**< Verify: compared bits */
+    bool macLoaded;                 /**< Verify: MAC written to PRAM */
+    bool *verified;                 /**< Verify: result */
+    csec_callback_t callback;
+    void *userData;
+} csec_state_t;
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static csec_state_t s_csec;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Copy bytes into PRAM words (big-endian, zero padded)
+ */
+static void CSEC_WriteBytes(uint32_t word, const uint8_t *data, uint32_t length)
+{
+    uint32_t value;
+    uint32_t i;
+
+    while (length >= 4U) {
+        memcpy(&value, data, 4U);
+        CSEC->RAMn[word] = __builtin_bswap32(value);
+        word++;
+        data += 4U;
+        length -= 4U;
+    }
+
+    if (length > 0U) {
+        value = 0U;
+        for (i = 0U; i < 4U; i++) {
+            value <<= 8U;
+            if (i < length) {
+                value |= data[i];
+            }
+        }
+        CSEC->RAMn[word] = value;
+    }
+}
+
+/**
+ * @brief Copy PRAM words out as bytes
+ */
+static void CSEC_ReadBytes(uint32_t word, uint8_t *data, uint32_t length)
+{
+    uint32_t value;
+    uint32_t i;
+
+    while (length >= 4U) {
+        value = __builtin_bswap32(CSEC->RAMn[word]);
+        memcpy(data, &value, 4U);
+        word++;
+        data += 4U;
+        length -= 4U;
+    }
+
+    if (length > 0U) {
+        value = CSEC->RAMn[word];
+        for (i = 0U; i < length; i++) {
+            data[i] = (uint8_t)(value >> (24U - (i * 8U)));
+        }
+    }
+}
+
+/**
+ * @brief Map CSEc error bits to status_t
+ */
+static status_t CSEC_StatusFromErc(void)
+{
+    uint32_t erc = CSEC->RAMn[CSEC_WORD_ERROR] >> CSEC_HALF_HIGH_SHIFT;
+
+    switch (erc) {
+        case CSEC_ERC_NO_ERROR:
+            return STATUS_SUCCESS;
+        case CSEC_ERC_SEQUENCE_ERROR:
+            return STATUS_SEC_SEQUENCE_ERROR;
+        case CSEC_ERC_KEY_NOT_AVAILABLE:
+            return STATUS_SEC_KEY_NOT_AVAILABLE;
+        case CSEC_ERC_KEY_INVALID:
+            return STATUS_SEC_KEY_INVALID;
+        case CSEC_ERC_KEY_EMPTY:
+            return STATUS_SEC_KEY_EMPTY;
+        case CSEC_ERC_NO_SECURE_BOOT:
+            return STATUS_SEC_NO_SECURE_BOOT;
+        case CSEC_ERC_KEY_WRITE_PROTECTED:
+            return STATUS_SEC_KEY_WRITE_PROTECTED;
+        case CSEC_ERC_KEY_UPDATE_ERROR:
+            return STATUS_SEC_KEY_UPDATE_ERROR;
+        case CSEC_ERC_RNG_SEED:
+            return STATUS_SEC_RNG_SEED;
+        case CSEC_ERC_NO_DEBUGGING:
+            return STATUS_SEC_NO_DEBUGGING;
+        case CSEC_ERC_MEMORY_FAILURE:
+            return STATUS_SEC_MEMORY_FAILURE;
+        default:
+            return STATUS_ERROR;
+    }
+}
+
+/**
+ * @brief Claim the command interface: no CSEc sequence, no flash command
+ */
+static status_t CSEC_Claim(void)
+{
+    uint32_t primask;
+
+    primask = NVIC_DisableGlobalIRQ();
+    if (s_csec.active || FTFC_IsBusy() || !FTFC_IsIdle()) {
+        NVIC_EnableGlobalIRQ(primask);
+        return STATUS_BUSY;
+    }
+    s_csec.active = true;
+    NVIC_EnableGlobalIRQ(primask);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Run a single-step command already loaded in PRAM (blocking)
+ */
+static status_t CSEC_RunSingle(uint8_t cmd, uint8_t keyId)
+{
+    CSEC->RAMn[CSEC_WORD_HEADER] = CSEC_HEADER(cmd, CSEC_FORMAT_COPY, CSEC_SEQ_FIRST, keyId);
+
+    while (!FTFC_IsIdle()) {
+    }
+
+    return CSEC_StatusFromErc();
+}
+
+/**
+ * @brief End the sequence and report
+ */
+static void CSEC_Finish(status_t status)
+{
+    csec_callback_t callback = s_csec.callback;
+
+    if (s_csec.async) {
+        FTFC->FCNFG &= (uint8_t)~FTFC_FCNFG_CCIE_MASK;
+    }
+
+    s_csec.lastStatus = status;
+    s_csec.active = false;
+
+    if (s_csec.async && (callback != NULL)) {
+        callback(status, s_csec.userData);
+    }
+}
+
+/**
+ * @brief Load the next step into PRAM and launch it
+ */
+static void CSEC_LaunchStep(void)
+{
+    uint32_t left = s_csec.length - s_csec.index;
+    const uint8_t *data = &s_csec.input[s_csec.index];
+    uint32_t chunk = (left < CSEC_DATA_BYTES) ? left : CSEC_DATA_BYTES;
+    uint32_t macPage;
+
+    switch (s_csec.cmd) {
+        case CSEC_CMD_ENC_ECB:
+        case CSEC_CMD_DEC_ECB:
+            /* Every ECB step is independent */
+            CSEC_WriteBytes(CSEC_PAGE(1U), data, chunk);
+            CSEC->RAMn[CSEC_WORD_PAGE_LENGTH] = chunk / CSEC_PAGE_SIZE;
+            s_csec.seq = CSEC_SEQ_FIRST;
+            break;
+
+        case CSEC_CMD_ENC_CBC:
+        case CSEC_CMD_DEC_CBC:
+            if (s_csec.seq == CSEC_SEQ_FIRST) {
+                /* IV in page 1, total page count, data from page 2 */
+                if (chunk > (CSEC_DATA_BYTES - CSEC_PAGE_SIZE)) {
+                    chunk = CSEC_DATA_BYTES - CSEC_PAGE_SIZE;
+                }
+                CSEC_WriteBytes(CSEC_PAGE(1U), s_csec.iv, CSEC_BLOCK_SIZE);
+                CSEC_WriteBytes(CSEC_PAGE(2U), data, chunk);
+                CSEC->RAMn[CSEC_WORD_PAGE_LENGTH] = s_csec.length / CSEC_PAGE_SIZE;
+            } else {
+                CSEC_WriteBytes(CSEC_PAGE(1U), data, chunk);
+            }
+            break;
+
+        case CSEC_CMD_GENERATE_MAC:
+            CSEC_WriteBytes(CSEC_PAGE(1U), data, chunk);
+            if (s_csec.seq == CSEC_SEQ_FIRST) {
+                CSEC->RAMn[CSEC_WORD_MSG_LENGTH] = s_csec.length * 8U;
+            }
+            break;
+
+        default: /* CSEC_CMD_VERIFY_MAC */
+            CSEC_WriteBytes(CSEC_PAGE(1U), data, chunk);
+            if (s_csec.seq == CSEC_SEQ_FIRST) {
+                CSEC->RAMn[CSEC_WORD_MAC_LENGTH] = (uint32_t)s_csec.macBits << CSEC_HALF_HIGH_SHIFT;
+                CSEC->RAMn[CSEC_WORD_MSG_LENGTH] = s_csec.length * 8U;
+            }
+            /* MAC goes in the page after the last message byte, next step if full */
+            macPage = 1U + ((chunk + CSEC_PAGE_SIZE - 1U) / CSEC_PAGE_SIZE);
+            if ((chunk == left) && (macPage <= CSEC_DATA_PAGES)) {
+                CSEC_WriteBytes(CSEC_PAGE(macPage), s_csec.mac, CSEC_BLOCK_SIZE);
+                s_csec.macLoaded = true;
+            }
+            break;
+    }
+
+    s_csec.chunk = chunk;
+    CSEC->RAMn[CSEC_WORD_HEADER] = CSEC_HEADER(s_csec.cmd, CSEC_FORMAT_COPY, s_csec.seq, s_csec.keyId);
+
+    /* CCIE is level sensitive on CCIF: enable after the launch cleared it */
+    if (s_csec.async) {
+        FTFC->FCNFG |= FTFC_FCNFG_CCIE_MASK;
+    }
+}
+
+/**
+ * @brief Collect the output of the completed step, launch the next one
+ * @return true when the sequence has ended
+ */
+static bool CSEC_StepDone(void)
+{
+    status_t status = CSEC_StatusFromErc();
+    bool last = ((s_csec.index + s_csec.chunk) == s_csec.length);
+
+    if (status != STATUS_SUCCESS) {
+        CSEC_Finish(status);
+        return true;
+    }
+
+    switch (s_csec.cmd) {
+        case CSEC_CMD_ENC_ECB:
+        case CSEC_CMD_DEC_ECB:
+            CSEC_ReadBytes(CSEC_PAGE(1U), &s_csec.output[s_csec.index], s_csec.chunk);
+            break;
+
+        case CSEC_CMD_ENC_CBC:
+        case CSEC_CMD_DEC_CBC:
+            CSEC_ReadBytes((s_csec.seq == CSEC_SEQ_FIRST) ? CSEC_PAGE(2U) : CSEC_PAGE(1U),
+                           &s_csec.output[s_csec.index], s_csec.chunk);
+            break;
+
+        case CSEC_CMD_GENERATE_MAC:
+            if (last) {
+                CSEC_ReadBytes(CSEC_PAGE(2U), s_csec.output, CSEC_BLOCK_SIZE);
+            }
+            break;
+
+        default: /* CSEC_CMD_VERIFY_MAC */
+            if (s_csec.macLoaded) {
+                *s_csec.verified = ((CSEC->RAMn[CSEC_WORD_VERIFY] >> CSEC_HALF_HIGH_SHIFT) == 0U);
+            }
+            break;
+    }
+
+    s_csec.index += s_csec.chunk;
+    s_csec.seq = CSEC_SEQ_SUBSEQUENT;
+
+    if ((s_csec.index == s_csec.length) &&
+        ((s_csec.cmd != CSEC_CMD_VERIFY_MAC) || s_csec.macLoaded)) {
+        CSEC_Finish(STATUS_SUCCESS);
+        return true;
+    }
+
+    CSEC_LaunchStep();
+    return false;
+}
+
+/**
+ * @brief Claim the interface and set up a sequence
+ */
+static status_t CSEC_Begin(uint8_t cmd, csec_key_id_t keyId, const uint8_t *input,
+                           uint32_t length, uint8_t *output)
+{
+    status_t status;
+
+    status = CSEC_Claim();
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+
+    s_csec.lastStatus = STATUS_BUSY;
+    s_csec.async = false;
+    s_csec.cmd = cmd;
+    s_csec.keyId = (uint8_t)keyId;
+    s_csec.seq = CSEC_SEQ_FIRST;
+    s_csec.input = input;
+    s_csec.output = output;
+    s_csec.length = length;
+    s_csec.index = 0U;
+    s_csec.chunk = 0U;
+    s_csec.iv = NULL;
+    s_csec.mac = NULL;
+    s_csec.macBits = 0U;
+    s_csec.macLoaded = false;
+    s_csec.verified = NULL;
+    s_csec.callback = NULL;
+    s_csec.userData = NULL;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Run the sequence set up by CSEC_Begin()
+ */
+static status_t CSEC_Run(bool async, csec_callback_t callback, void *userData)
+{
+    if (async) {
+        s_csec.async = true;
+        s_csec.callback = callback;
+        s_csec.userData = userData;
+        CSEC_LaunchStep();
+        return STATUS_SUCCESS;
+    }
+
+    CSEC_LaunchStep();
+    do {
+        while (!FTFC_IsIdle()) {
+        }
+    } while (!CSEC_StepDone());
+
+    return s_csec.lastStatus;
+}
+
+static bool CSEC_BlockArgsValid(const uint8_t *input, uint32_t length, const uint8_t *output)
+{
+    return ((input != NULL) && (output != NULL) && (length != 0U) &&
+            ((length % CSEC_BLOCK_SIZE) == 0U));
+}
+
+static status_t CSEC_Ecb(uint8_t cmd, csec_key_id_t keyId, const uint8_t *input, uint32_t length,
+                         uint8_t *output, bool async, csec_callback_t callback, void *userData)
+{
+    status_t status;
+
+    if (!CSEC_BlockArgsValid(input, length, output)) {
+        return STATUS_ERROR;
+    }
+
+    status = CSEC_Begin(cmd, keyId, input, length, output);
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+
+    return CSEC_Run(async, callback, userData);
+}
+
+static status_t CSEC_Cbc(uint8_t cmd, csec_key_id_t keyId, const uint8_t *iv, const uint8_t *input,
+                         uint32_t length, uint8_t *output, bool async, csec_callback_t callback,
+                         void *userData)
+{
+    status_t status;
+
+    if ((iv == NULL) || !CSEC_BlockArgsValid(input, length, output)) {
+        return STATUS_ERROR;
+    }
+
+    status = CSEC_Begin(cmd, keyId, input, length, output);
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+    s_csec.iv = iv;
+
+    return CSEC_Run(async, callback, userData);
+}
+
+static status_t CSEC_Generate(csec_key_id_t keyId, const uint8_t *msg, uint32_t length, uint8_t *mac,
+                              bool async, csec_callback_t callback, void *userData)
+{
+    status_t status;
+
+    if ((mac == NULL) || ((msg == NULL) && (length != 0U))) {
+        return STATUS_ERROR;
+    }
+
+    status = CSEC_Begin(CSEC_CMD_GENERATE_MAC, keyId, msg, length, mac);
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+
+    return CSEC_Run(async, callback, userData);
+}
+
+static status_t CSEC_Verify(csec_key_id_t keyId, const uint8_t *msg, uint32_t length, const uint8_t *mac,
+                            uint16_t macBits, bool *verified, bool async, csec_callback_t callback,
+                            void *userData)
+{
+    status_t status;
+
+    if ((mac == NULL) || (verified == NULL) || ((msg == NULL) && (length != 0U)) ||
+        (macBits == 0U) || (macBits > (CSEC_BLOCK_SIZE * 8U))) {
+        return STATUS_ERROR;
+    }
+
+    status = CSEC_Begin(CSEC_CMD_VERIFY_MAC, keyId, msg, length, NULL);
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+    *verified = false;
+    s_csec.mac = mac;
+    s_csec.macBits = macBits;
+    s_csec.verified = verified;
+
+    return CSEC_Run(async, callback, userData);
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+/**
+ * @brief Initialize CSEc driver
+ */
+status_t CSEC_Init(void)
+{
+    while (!FTFC_IsIdle()) {
+    }
+
+    s_csec.active = false;
+    s_csec.lastStatus = STATUS_SUCCESS;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Load plain RAM key
+ */
+status_t CSEC_LoadPlainKey(const uint8_t *key)
+{
+    status_t status;
+
+    if (key == NULL) {
+        return STATUS_ERROR;
+    }
+
+    status = CSEC_Claim();
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+
+    CSEC_WriteBytes(CSEC_PAGE(1U), key, CSEC_BLOCK_SIZE);
+    status = CSEC_RunSingle(CSEC_CMD_LOAD_PLAIN_KEY, CSEC_RAM_KEY);
+
+    s_csec.active = false;
+    return status;
+}
+
+/**
+ * @brief Protected key update
+ */
+status_t CSEC_LoadKey(csec_key_id_t keyId, const uint8_t *m1, const uint8_t *m2, const uint8_t *m3,
+                      uint8_t *m4, uint8_t *m5)
+{
+    status_t status;
+
+    if ((m1 == NULL) || (m2 == NULL) || (m3 == NULL)) {
+        return STATUS_ERROR;
+    }
+
+    status = CSEC_Claim();
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+
+    CSEC_WriteBytes(CSEC_PAGE(1U), m1, CSEC_BLOCK_SIZE);
+    CSEC_WriteBytes(CSEC_PAGE(2U), m2, 2U * CSEC_BLOCK_SIZE);
+    CSEC_WriteBytes(CSEC_PAGE(4U), m3, CSEC_BLOCK_SIZE);
+    status = CSEC_RunSingle(CSEC_CMD_LOAD_KEY, (uint8_t)keyId);
+
+    if (status == STATUS_SUCCESS) {
+        if (m4 != NULL) {
+            CSEC_ReadBytes(CSEC_PAGE(5U), m4, 2U * CSEC_BLOCK_SIZE);
+        }
+        if (m5 != NULL) {
+            CSEC_ReadBytes(CSEC_PAGE(7U), m5, CSEC_BLOCK_SIZE);
+        }
+    }
+
+    s_csec.active = false;
+    return status;
+}
+
+status_t CSEC_EncryptEcb(csec_key_id_t keyId, const uint8_t *input, uint32_t length, uint8_t *output)
+{
+    return CSEC_Ecb(CSEC_CMD_ENC_ECB, keyId, input, length, output, false, NULL, NULL);
+}
+
+status_t CSEC_DecryptEcb(csec_key_id_t keyId, const uint8_t *input, uint32_t length, uint8_t *output)
+{
+    return CSEC_Ecb(CSEC_CMD_DEC_ECB, keyId, input, length, output, false, NULL, NULL);
+}
+
+status_t CSEC_EncryptCbc(csec_key_id_t keyId, const uint8_t *iv, const uint8_t *input,
+                         uint32_t length, uint8_t *output)
+{
+    return CSEC_Cbc(CSEC_CMD_ENC_CBC, keyId, iv, input, length, output, false, NULL, NULL);
+}
+
+status_t CSEC_DecryptCbc(csec_key_id_t keyId, const uint8_t *iv, const uint8_t *input,
+                         uint32_t length, uint8_t *output)
+{
+    return CSEC_Cbc(CSEC_CMD_DEC_CBC, keyId, iv, input, length, output, false, NULL, NULL);
+}
+
+status_t CSEC_GenerateMac(csec_key_id_t keyId, const uint8_t *msg, uint32_t length, uint8_t *mac)
+{
+    return CSEC_Generate(keyId, msg, length, mac, false, NULL, NULL);
+}
+
+status_t CSEC_VerifyMac(csec_key_id_t keyId, const uint8_t *msg, uint32_t length,
+                        const uint8_t *mac, uint16_t macBits, bool *verified)
+{
+    return CSEC_Verify(keyId, msg, length, mac, macBits, verified, false, NULL, NULL);
+}
+
+/**
+ * @brief Initialize RNG
+ */
+status_t CSEC_InitRng(void)
+{
+    status_t status;
+
+    status = CSEC_Claim();
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+
+    status = CSEC_RunSingle(CSEC_CMD_INIT_RNG, 0U);
+
+    s_csec.active = false;
+    return status;
+}
+
+/**
+ * @brief Random number
+ */
+status_t CSEC_GenerateRnd(uint8_t *rnd)
+{
+    status_t status;
+
+    if (rnd == NULL) {
+        return STATUS_ERROR;
+    }
+
+    status = CSEC_Claim();
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+
+    status = CSEC_RunSingle(CSEC_CMD_RND, 0U);
+    if (status == STATUS_SUCCESS) {
+        CSEC_ReadBytes(CSEC_PAGE(1U), rnd, CSEC_BLOCK_SIZE);
+    }
+
+    s_csec.active = false;
+    return status;
+}
+
+status_t CSEC_EncryptEcbAsync(csec_key_id_t keyId, const uint8_t *input, uint32_t length, uint8_t *output,
+                              csec_callback_t callback, void *userData)
+{
+    return CSEC_Ecb(CSEC_CMD_ENC_ECB, keyId, input, length, output, true, callback, userData);
+}
+
+status_t CSEC_DecryptEcbAsync(csec_key_id_t keyId, const uint8_t *input, uint32_t length, uint8_t *output,
+                              csec_callback_t callback, void *userData)
+{
+    return CSEC_Ecb(CSEC_CMD_DEC_ECB, keyId, input, length, output, true, callback, userData);
+}
+
+status_t CSEC_EncryptCbcAsync(csec_key_id_t keyId, const uint8_t *iv, const uint8_t *input, uint32_t length,
+                              uint8_t *output, csec_callback_t callback, void *userData)
+{
+    return CSEC_Cbc(CSEC_CMD_ENC_CBC, keyId, iv, input, length, output, true, callback, userData);
+}
+
+status_t CSEC_DecryptCbcAsync(csec_key_id_t keyId, const uint8_t *iv, const uint8_t *input, uint32_t length,
+                              uint8_t *output, csec_callback_t callback, void *userData)
+{
+    return CSEC_Cbc(CSEC_CMD_DEC_CBC, keyId, iv, input, length, output, true, callback, userData);
+}
+
+status_t CSEC_GenerateMacAsync(csec_key_id_t keyId, const uint8_t *msg, uint32_t length, uint8_t *mac,
+                               csec_callback_t callback, void *userData)
+{
+    return CSEC_Generate(keyId, msg, length, mac, true, callback, userData);
+}
+
+status_t CSEC_VerifyMacAsync(csec_key_id_t keyId, const uint8_t *msg, uint32_t length,
+                             const uint8_t *mac, uint16_t macBits, bool *verified,
+                             csec_callback_t callback, void *userData)
+{
+    return CSEC_Verify(keyId, msg, length, mac, macBits, verified, true, callback, userData);
+}
+
+/**
+ * @brief Sequence in progress
+ */
+bool CSEC_IsBusy(void)
+{
+    return s_csec.active;
+}
+
+/**
+ * @brief Install CSEc handler in the RAM vector table
+ */
+status_t CSEC_InstallIrqHandler(void)
+{
+    if (NVIC_InstallHandler(FTFC_IRQn, CSEC_IRQHandler) != NVIC_STATUS_SUCCESS) {
+        return STATUS_ERROR;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief FTFC command complete interrupt handler
+ */
+void CSEC_IRQHandler(void)
+{
+    if (s_csec.active && s_csec.async) {
+        if (FTFC_IsIdle()) {
+            (void)CSEC_StepDone();
+        }
+        return;
+    }
+
+    FTFC_IRQHandler();
+}
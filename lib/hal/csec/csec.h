@@ -0,0 +1,237 @@
+/**
+ * @file    csec.h
+ * @brief   CSEc (Cryptographic Services Engine) driver for S32K144
+ * @details
+ * CSEc driver provides the following APIs for the SHE-compatible AES-128
+ * engine inside FTFC:
+ * - Key load: plain RAM key, protected key update (M1-M3 -> M4-M5)
+ * - AES-128 ECB / CBC encrypt and decrypt
+ * - AES-CMAC generate and verify (truncated MACs down to 1 bit)
+ * - Random numbers (CMD_INIT_RNG / CMD_RND)
+ * - Blocking calls, or async calls completed from the FTFC command
+ *   complete interrupt with a callback (data longer than 7 pages is
+ *   chained there without CPU polling)
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ *
+ * @note
+ * - CSEc shares the FTFC command interface: no flash command may run
+ *   during a CSEc command and vice versa, calls return STATUS_BUSY then
+ * - Keys live in EEERAM: FlexNVM must be partitioned with CSEc key slots
+ *   (FTFC_CSEC_KEY_SIZE) and FlexRAM in EEE mode before non-RAM keys exist
+ * - Lengths are in bytes, ECB / CBC lengths a multiple of 16
+ *
+ * @par Change Log:
+ * - Version 1.0 (14/10/2026): Initial CSEc driver (keys, ECB, CBC, CMAC, RNG, async)
+ */
+
+#ifndef CSEC_H
+#define CSEC_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "csec_reg.h"
+#include "status.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @defgroup CSEC_Definitions CSEc Definitions
+ * @{
+ */
+
+/** @brief AES block / key / CMAC size in bytes */
+#define CSEC_BLOCK_SIZE         (16U)
+
+/**
+ * @brief Key slots
+ */
+typedef enum {
+    CSEC_SECRET_KEY     = 0x00U,    /**< Device secret key (not usable for crypto) */
+    CSEC_MASTER_ECU_KEY = 0x01U,    /**< Authorises key updates */
+    CSEC_BOOT_MAC_KEY   = 0x02U,    /**< Secure boot CMAC key */
+    CSEC_BOOT_MAC       = 0x03U,    /**< Secure boot reference CMAC */
+    CSEC_KEY_1          = 0x04U,
+    CSEC_KEY_2          = 0x05U,
+    CSEC_KEY_3          = 0x06U,
+    CSEC_KEY_4          = 0x07U,
+    CSEC_KEY_5          = 0x08U,
+    CSEC_KEY_6          = 0x09U,
+    CSEC_KEY_7          = 0x0AU,
+    CSEC_KEY_8          = 0x0BU,
+    CSEC_KEY_9          = 0x0CU,
+    CSEC_KEY_10         = 0x0DU,
+    CSEC_RAM_KEY        = 0x0FU,    /**< Volatile key (CSEC_LoadPlainKey) */
+    CSEC_KEY_11         = 0x14U,    /**< Keys 11-17: second bank (KBS = 1) */
+    CSEC_KEY_12         = 0x15U,
+    CSEC_KEY_13         = 0x16U,
+    CSEC_KEY_14         = 0x17U,
+    CSEC_KEY_15         = 0x18U,
+    CSEC_KEY_16         = 0x19U,
+    CSEC_KEY_17         = 0x1AU
+} csec_key_id_t;
+
+/**
+ * @brief Async command callback (called from CSEC_IRQHandler())
+ * @param status   STATUS_SUCCESS or the CSEc error (STATUS_SEC_x)
+ * @param userData Pointer to user data
+ */
+typedef void (*csec_callback_t)(status_t status, void *userData);
+
+/** @} */ /* End of CSEC_Definitions */
+
+/*******************************************************************************
+ * API Function Prototypes
+ ******************************************************************************/
+
+/**
+ * @defgroup CSEC_Functions CSEc Functions
+ * @{
+ */
+
+/**
+ * @brief Initialize the driver state
+ * @details Waits for a command left running (e.g. by a bootloader). FTFC_Init()
+ *          is not required for CSEc commands alone.
+ * @return STATUS_SUCCESS
+ */
+status_t CSEC_Init(void);
+
+/**
+ * @brief Load a plain key into the RAM key slot
+ * @param[in] key 16-byte AES key
+ * @return STATUS_SUCCESS, STATUS_BUSY, or the CSEc error
+ */
+status_t CSEC_LoadPlainKey(const uint8_t *key);
+
+/**
+ * @brief Update a non-volatile key with the SHE memory update protocol
+ * @param[in]  keyId Key slot
+ * @param[in]  m1    16 bytes (UID, key id, auth id)
+ * @param[in]  m2    32 bytes (encrypted counter, flags, key)
+ * @param[in]  m3    16 bytes (CMAC over M1 | M2)
+ * @param[out] m4    32 bytes verification message (NULL if not needed)
+ * @param[out] m5    16 bytes verification CMAC (NULL if not needed)
+ * @return STATUS_SUCCESS, STATUS_BUSY, or the CSEc error
+ */
+status_t CSEC_LoadKey(csec_key_id_t keyId, const uint8_t *m1, const uint8_t *m2, const uint8_t *m3,
+                      uint8_t *m4, uint8_t *m5);
+
+/**
+ * @brief AES-128 ECB encryption
+ * @param[in]  keyId  Key slot
+ * @param[in]  input  Plain text
+ * @param[in]  length Bytes (multiple of 16)
+ * @param[out] output Cipher text (may equal input)
+ * @return STATUS_SUCCESS, STATUS_BUSY, STATUS_ERROR on invalid parameters, or the CSEc error
+ */
+status_t CSEC_EncryptEcb(csec_key_id_t keyId, const uint8_t *input, uint32_t length, uint8_t *output);
+
+/** @brief AES-128 ECB decryption (see CSEC_EncryptEcb()) */
+status_t CSEC_DecryptEcb(csec_key_id_t keyId, const uint8_t *input, uint32_t length, uint8_t *output);
+
+/**
+ * @brief AES-128 CBC encryption
+ * @param[in]  keyId  Key slot
+ * @param[in]  iv     16-byte initialisation vector
+ * @param[in]  input  Plain text
+ * @param[in]  length Bytes (multiple of 16)
+ * @param[out] output Cipher text (may equal input)
+ * @return STATUS_SUCCESS, STATUS_BUSY, STATUS_ERROR on invalid parameters, or the CSEc error
+ */
+status_t CSEC_EncryptCbc(csec_key_id_t keyId, const uint8_t *iv, const uint8_t *input,
+                         uint32_t length, uint8_t *output);
+
+/** @brief AES-128 CBC decryption (see CSEC_EncryptCbc()) */
+status_t CSEC_DecryptCbc(csec_key_id_t keyId, const uint8_t *iv, const uint8_t *input,
+                         uint32_t length, uint8_t *output);
+
+/**
+ * @brief AES-CMAC of a message
+ * @param[in]  keyId  Key slot
+ * @param[in]  msg    Message
+ * @param[in]  length Bytes
+ * @param[out] mac    16-byte CMAC
+ * @return STATUS_SUCCESS, STATUS_BUSY, STATUS_ERROR on invalid parameters, or the CSEc error
+ */
+status_t CSEC_GenerateMac(csec_key_id_t keyId, const uint8_t *msg, uint32_t length, uint8_t *mac);
+
+/**
+ * @brief Verify an AES-CMAC, possibly truncated
+ * @param[in]  keyId    Key slot
+ * @param[in]  msg      Message
+ * @param[in]  length   Bytes
+ * @param[in]  mac      Expected MAC, most significant bits first
+ * @param[in]  macBits  Number of MAC bits compared (1-128)
+ * @param[out] verified true if the MAC matches
+ * @return STATUS_SUCCESS when the verification ran (check verified), STATUS_BUSY,
+ *         STATUS_ERROR on invalid parameters, or the CSEc error
+ */
+status_t CSEC_VerifyMac(csec_key_id_t keyId, const uint8_t *msg, uint32_t length,
+                        const uint8_t *mac, uint16_t macBits, bool *verified);
+
+/**
+ * @brief Initialize the random number generator (once after reset)
+ * @return STATUS_SUCCESS, STATUS_BUSY, or the CSEc error
+ */
+status_t CSEC_InitRng(void);
+
+/**
+ * @brief Generate a 16-byte random number
+ * @param[out] rnd 16 bytes
+ * @return STATUS_SUCCESS, STATUS_BUSY, STATUS_SEC_RNG_SEED without CSEC_InitRng()
+ */
+status_t CSEC_GenerateRnd(uint8_t *rnd);
+
+/**
+ * @defgroup CSEC_Async CSEc Async Functions
+ * @brief Non-blocking variants, completion from CSEC_IRQHandler()
+ * @details Buffers must stay valid until the callback. The FTFC vector must
+ *          run CSEC_IRQHandler() (CSEC_InstallIrqHandler()) and FTFC_IRQn be
+ *          enabled in the NVIC. Parameters as for the blocking function.
+ * @{
+ */
+status_t CSEC_EncryptEcbAsync(csec_key_id_t keyId, const uint8_t *input, uint32_t length, uint8_t *output,
+                              csec_callback_t callback, void *userData);
+status_t CSEC_DecryptEcbAsync(csec_key_id_t keyId, const uint8_t *input, uint32_t length, uint8_t *output,
+                              csec_callback_t callback, void *userData);
+status_t CSEC_EncryptCbcAsync(csec_key_id_t keyId, const uint8_t *iv, const uint8_t *input, uint32_t length,
+                              uint8_t *output, csec_callback_t callback, void *userData);
+status_t CSEC_DecryptCbcAsync(csec_key_id_t keyId, const uint8_t *iv, const uint8_t *input, uint32_t length,
+                              uint8_t *output, csec_callback_t callback, void *userData);
+status_t CSEC_GenerateMacAsync(csec_key_id_t keyId, const uint8_t *msg, uint32_t length, uint8_t *mac,
+                               csec_callback_t callback, void *userData);
+status_t CSEC_VerifyMacAsync(csec_key_id_t keyId, const uint8_t *msg, uint32_t length,
+                             const uint8_t *mac, uint16_t macBits, bool *verified,
+                             csec_callback_t callback, void *userData);
+/** @} */ /* End of CSEC_Async */
+
+/**
+ * @brief Check whether a CSEc command sequence is running
+ * @return bool true if busy
+ */
+bool CSEC_IsBusy(void);
+
+/**
+ * @brief Install CSEC_IRQHandler() on the FTFC vector of the RAM vector table
+ * @return STATUS_SUCCESS if installed, STATUS_ERROR if there is no RAM vector table
+ */
+status_t CSEC_InstallIrqHandler(void);
+
+/**
+ * @brief FTFC command complete interrupt handler with CSEc support (vector FTFC_IRQn)
+ * @details Steps the running async CSEc command; any other completion is
+ *          forwarded to FTFC_IRQHandler(), so async flash operations keep working.
+ */
+HAL_RAMFUNC void CSEC_IRQHandler(void);
+
+/** @} */ /* End of CSEC_Functions */
+
+#endif /* CSEC_H */
@@ -0,0 +1,120 @@
+/**
+ * @file    csec_reg.h
+ * @brief   CSEc Register Definitions for S32K144
+ * @details This file contains the CSE_PRAM command interface layout of the
+ *          Cryptographic Services Engine (CSEc, part of FTFC), command
+ *          codes, key ids and error bits.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ *
+ * @note    These are raw register definitions for CSEc peripheral
+ * @warning Direct register access - use with caution
+ *
+ * @par Change Log:
+ * - Version 1.0 (Oct 14, 2026): Initial version
+ *
+ */
+
+#ifndef CSEC_REG_H
+#define CSEC_REG_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include "def_reg.h"
+
+/*******************************************************************************
+ * CSE_PRAM Register Structure
+ ******************************************************************************/
+
+/**
+ * @brief CSE_PRAM Layout
+ * @details 8 pages of 16 bytes. Page 0 holds the command header and length
+ *          fields, pages 1-7 the data. Multi-byte fields are big-endian:
+ *          byte offset 0 of a word is bits 31:24. Writing word 0 (header)
+ *          launches the command and clears FTFC FSTAT[CCIF].
+ */
+typedef struct {
+    __IO uint32_t RAMn[32];     /**< CSE PRAM words, offset: 0x00 */
+} CSEC_RegType;
+
+/** @brief CSE_PRAM base address */
+#define CSEC_PRAM_BASE_ADDR     (0x14001000UL)
+
+/** @brief CSE_PRAM base pointer */
+#define CSEC                    ((CSEC_RegType *)CSEC_PRAM_BASE_ADDR)
+
+/*******************************************************************************
+ * Page / field layout
+ ******************************************************************************/
+#define CSEC_PAGE_SIZE          (16U)           /**< Bytes per page */
+#define CSEC_PAGE_WORDS         (4U)
+#define CSEC_DATA_PAGES         (7U)            /**< Pages 1-7 */
+#define CSEC_DATA_BYTES         (CSEC_DATA_PAGES * CSEC_PAGE_SIZE)
+
+/** @brief Word index of page n */
+#define CSEC_PAGE(n)            ((n) * CSEC_PAGE_WORDS)
+
+#define CSEC_WORD_HEADER        (0U)            /**< FuncId | FuncFormat | CallSeq | KeyId */
+#define CSEC_WORD_ERROR         (1U)            /**< Error bits [31:16] (offset 0x04) */
+#define CSEC_WORD_MAC_LENGTH    (2U)            /**< MAC length in bits [31:16] (offset 0x08) */
+#define CSEC_WORD_MSG_LENGTH    (3U)            /**< Message length in bits (offset 0x0C) */
+#define CSEC_WORD_PAGE_LENGTH   (3U)            /**< Page count [15:0] (offset 0x0E) */
+#define CSEC_WORD_VERIFY        (5U)            /**< Verification status [31:16] (offset 0x14) */
+
+#define CSEC_HALF_HIGH_SHIFT    (16U)
+
+/** @brief Command header word */
+#define CSEC_HEADER(cmd, format, seq, keyId) \
+    (((uint32_t)(cmd) << 24U) | ((uint32_t)(format) << 16U) | \
+     ((uint32_t)(seq) << 8U) | (uint32_t)(keyId))
+
+/*******************************************************************************
+ * Command codes (FuncId)
+ ******************************************************************************/
+#define CSEC_CMD_ENC_ECB        (0x01U)
+#define CSEC_CMD_ENC_CBC        (0x02U)
+#define CSEC_CMD_DEC_ECB        (0x03U)
+#define CSEC_CMD_DEC_CBC        (0x04U)
+#define CSEC_CMD_GENERATE_MAC   (0x05U)
+#define CSEC_CMD_VERIFY_MAC     (0x06U)
+#define CSEC_CMD_LOAD_KEY       (0x07U)
+#define CSEC_CMD_LOAD_PLAIN_KEY (0x08U)
+#define CSEC_CMD_EXPORT_RAM_KEY (0x09U)
+#define CSEC_CMD_INIT_RNG       (0x0AU)
+#define CSEC_CMD_EXTEND_SEED    (0x0BU)
+#define CSEC_CMD_RND            (0x0CU)
+#define CSEC_CMD_BOOT_FAILURE   (0x0EU)
+#define CSEC_CMD_BOOT_OK        (0x0FU)
+#define CSEC_CMD_GET_ID         (0x10U)
+#define CSEC_CMD_BOOT_DEFINE    (0x11U)
+#define CSEC_CMD_DBG_CHAL       (0x12U)
+#define CSEC_CMD_DBG_AUTH       (0x13U)
+#define CSEC_CMD_MP_COMPRESS    (0x16U)
+
+#define CSEC_FORMAT_COPY        (0x00U)         /**< Data copied into CSE_PRAM */
+#define CSEC_FORMAT_POINTER     (0x01U)         /**< Data read from flash by address */
+
+#define CSEC_SEQ_FIRST          (0x00U)
+#define CSEC_SEQ_SUBSEQUENT     (0x01U)
+
+/*******************************************************************************
+ * Error bits (word 1 [31:16])
+ ******************************************************************************/
+#define CSEC_ERC_NO_ERROR           (0x0001U)
+#define CSEC_ERC_SEQUENCE_ERROR     (0x0002U)
+#define CSEC_ERC_KEY_NOT_AVAILABLE  (0x0004U)
+#define CSEC_ERC_KEY_INVALID        (0x0008U)
+#define CSEC_ERC_KEY_EMPTY          (0x0010U)
+#define CSEC_ERC_NO_SECURE_BOOT     (0x0020U)
+#define CSEC_ERC_KEY_WRITE_PROTECTED (0x0040U)
+#define CSEC_ERC_KEY_UPDATE_ERROR   (0x0080U)
+#define CSEC_ERC_RNG_SEED           (0x0100U)
+#define CSEC_ERC_NO_DEBUGGING       (0x0200U)
+#define CSEC_ERC_MEMORY_FAILURE     (0x0400U)
+#define CSEC_ERC_GENERAL_ERROR      (0x0800U)
+
+#endif /* CSEC_REG_H */
@@ -28,6 +28,7 @@
  ******************************************************************************/
 #include "dma.h"
 #include "pcc.h"
+#include "nvic.h"
 #include <stddef.h>
 
 /*******************************************************************************
@@ -43,6 +44,20 @@
 /** @brief SIM->PLATCGC DMA clock gate mask */
 #define SIM_PLATCGC_CGCDMA_MASK (0x4UL)
 
+#if DMA_STATS_ENABLE
+/** @brief Cortex-M4 DWT cycle counter (ARMv7-M debug registers) */
+#define DMA_DEMCR               (*(volatile uint32_t *)0xE000EDFCUL)
+#define DMA_DEMCR_TRCENA        (0x01000000UL)
+#define DMA_DWT_CTRL            (*(volatile uint32_t *)0xE0001000UL)
+#define DMA_DWT_CTRL_CYCCNTENA  (0x00000001UL)
+#define DMA_DWT_CYCCNT          (*(volatile uint32_t *)0xE0001004UL)
+#endif
+
+#if ((DMA_HIGH_CLASS_CHANNELS + DMA_LOW_CLASS_CHANNELS) >= DMA_MAX_CHANNELS) || \
+    (DMA_HIGH_CLASS_CHANNELS == 0U) || (DMA_LOW_CLASS_CHANNELS == 0U)
+#error "DMA class ranges must leave at least one channel for each class"
+#endif
+
 /*******************************************************************************
  * Private Variables
  ******************************************************************************/
@@ -53,6 +68,20 @@ static dma_callback_t s_dmaCallbacks[DMA_MAX_CHANNELS] = {NULL};
 /** @brief User data pointers for each DMA channel */
 static void *s_dmaUserData[DMA_MAX_CHANNELS] = {NULL};
 
+/** @brief Channel owners from the allocator (NULL = free) */
+static const void *s_dmaOwners[DMA_MAX_CHANNELS] = {NULL};
+
+#if DMA_STATS_ENABLE
+/** @brief Per-channel statistics */
+static dma_channel_stats_t s_dmaStats[DMA_MAX_CHANNELS];
+
+/** @brief CYCCNT when the running transfer started */
+static uint32_t s_dmaStartCycles[DMA_MAX_CHANNELS];
+
+/** @brief Size of the running transfer (NBYTES x BITER) */
+static uint32_t s_dmaPendingBytes[DMA_MAX_CHANNELS];
+#endif
+
 /** @brief Flag indicating DMA has been initialized */
 static bool s_dmaInitialized = false;
 
@@ -89,6 +118,24 @@ static void DMA_ResetTCD(uint8_t channel);
  */
 static uint32_t DMA_GetTransferBytes(dma_transfer_size_t size);
 
+/**
+ * @brief Program DCHPRI for an allocated channel
+ */
+static void DMA_ApplyClassPriority(uint8_t channel, dma_priority_class_t priorityClass);
+
+#if DMA_STATS_ENABLE
+/**
+ * @brief Bytes moved by the TCD currently loaded in a channel
+ */
+HAL_RAMFUNC static uint32_t DMA_GetTcdBytes(uint8_t channel);
+#endif
+
+/**
+ * @brief Select the widest copy unit allowed by src/dest alignment
+ */
+static dma_transfer_size_t DMA_SelectCopySize(uint32_t src, uint32_t dest, uint32_t size,
+                                              uint32_t *headBytes);
+
 /*******************************************************************************
  * Private Functions
  ******************************************************************************/
@@ -168,6 +215,71 @@ static uint32_t DMA_GetTransferBytes(dma_transfer_size_t size)
     }
 }
 
+/**
+ * @brief Program DCHPRI for an allocated channel
+ */
+static void DMA_ApplyClassPriority(uint8_t channel, dma_priority_class_t priorityClass)
+{
+    uint8_t dchpri = (uint8_t)(channel & DMA_DCHPRI_CHPRI_MASK);
+
+    switch (priorityClass) {
+        case DMA_CLASS_HIGH:
+            /* Never suspended, may suspend others */
+            break;
+        case DMA_CLASS_NORMAL:
+            dchpri |= DMA_DCHPRI_ECP_MASK;
+            break;
+        default:
+            dchpri |= DMA_DCHPRI_ECP_MASK | DMA_DCHPRI_DPA_MASK;
+            break;
+    }
+
+    DMA->DCHPRI[DMA_DCHPRI_INDEX(channel)] = dchpri;
+}
+
+#if DMA_STATS_ENABLE
+/**
+ * @brief Bytes moved by the TCD currently loaded in a channel
+ */
+static uint32_t DMA_GetTcdBytes(uint8_t channel)
+{
+    uint16_t biter = DMA->TCD[channel].BITER_ELINKNO;
+
+    biter &= ((biter & DMA_TCD_ITER_ELINK_MASK) != 0U) ? DMA_TCD_ITER_ELINKYES_MASK : DMA_TCD_ITER_ELINKNO_MASK;
+
+    return DMA->TCD[channel].NBYTES_MLNO * (uint32_t)biter;
+}
+#endif
+
+/**
+ * @brief Select the widest copy unit allowed by src/dest alignment
+ */
+static dma_transfer_size_t DMA_SelectCopySize(uint32_t src, uint32_t dest, uint32_t size,
+                                              uint32_t *headBytes)
+{
+    uint32_t head;
+
+    /* Both addresses must reach the same boundary after the same head bytes */
+    if (((src ^ dest) & 0xFU) == 0U) {
+        head = (16U - (src & 0xFU)) & 0xFU;
+        if (size >= (head + 16U)) {
+            *headBytes = head;
+            return DMA_TRANSFER_SIZE_16B;
+        }
+    }
+
+    if (((src ^ dest) & 0x3U) == 0U) {
+        head = (4U - (src & 0x3U)) & 0x3U;
+        if (size >= (head + 4U)) {
+            *headBytes = head;
+            return DMA_TRANSFER_SIZE_4B;
+        }
+    }
+
+    *headBytes = 0U;
+    return DMA_TRANSFER_SIZE_1B;
+}
+
 /*******************************************************************************
  * Public Functions
  ******************************************************************************/
@@ -213,14 +325,23 @@ status_t DMA_Init(void)
         /* Disable DMAMUX channel */
         DMAMUX->CHCFG[i] = 0U;
         
-        /* Clear callback */
+        /* Clear callback and ownership */
         s_dmaCallbacks[i] = NULL;
         s_dmaUserData[i] = NULL;
+        s_dmaOwners[i] = NULL;
+#if DMA_STATS_ENABLE
+        (void)DMA_ResetChannelStats(i);
+#endif
         
         /* Disable DMA request for this channel */
-        REG_WRITE32(DMA_BASE + 0x001A, i); /* Clear Enable Request */
+        DMA->CERQ = i; /* Clear Enable Request */
     }
     
+#if DMA_STATS_ENABLE
+    DMA_DEMCR |= DMA_DEMCR_TRCENA;
+    DMA_DWT_CTRL |= DMA_DWT_CTRL_CYCCNTENA;
+#endif
+    
     s_dmaInitialized = true;
     
     return STATUS_SUCCESS;
@@ -291,6 +412,10 @@ status_t DMA_ConfigChannel(const dma_channel_config_t *config)
         return STATUS_ERROR;
     }
     
+    if (config->enablePeriodicTrigger && (channel >= DMA_PERIODIC_TRIGGER_CHANNELS)) {
+        return STATUS_ERROR;
+    }
+    
     /* Disable channel before configuring */
     DMA_StopChannel(channel);
     
@@ -343,28 +468,232 @@ status_t DMA_ConfigChannel(const dma_channel_config_t *config)
     
     DMA->TCD[channel].CSR = csr;
     
-    /* Configure Channel Priority */
-    DMA_SetChannelPriority(channel, (uint8_t)config->priority);
+    /* Configure Channel Priority (allocated channels keep their class setting) */
+    if (s_dmaOwners[channel] == NULL) {
+        DMA_SetChannelPriority(channel, (uint8_t)config->priority);
+    }
     
     /* Configure DMAMUX */
     /* Disable channel before */
     DMAMUX->CHCFG[channel] = 0U;
     
-    /* Enable channel with source */
+    /* Enable channel with source, TRIG is written together with ENBL */
     DMAMUX->CHCFG[channel] = (uint8_t)(
         DMAMUX_CHCFG_ENBL_MASK |  /* Enable channel */
+        (config->enablePeriodicTrigger ? DMAMUX_CHCFG_TRIG_MASK : 0U) |  /* Periodic trigger */
         ((uint8_t)config->source & DMAMUX_CHCFG_SOURCE_MASK)  /* Set source */
     );
     
     return STATUS_SUCCESS;
 }
 
+/**
+ * @brief Fill a RAM TCD from a stage description
+ */
+status_t DMA_BuildTcd(DMA_TCD_Type *tcd, const dma_tcd_config_t *config)
+{
+    uint32_t transferBytes;
+    uint16_t iter;
+    uint16_t csr;
+
+    if ((tcd == NULL) || (config == NULL)) {
+        return STATUS_ERROR;
+    }
+
+    transferBytes = DMA_GetTransferBytes(config->transferSize);
+    if ((transferBytes == 0U) ||
+        (config->minorLoopBytes == 0U) ||
+        ((config->minorLoopBytes % transferBytes) != 0U) ||
+        (config->majorLoopCount == 0U)) {
+        return STATUS_ERROR;
+    }
+
+    if (((config->sourceAddr % transferBytes) != 0U) ||
+        ((config->destAddr % transferBytes) != 0U)) {
+        return STATUS_ERROR;
+    }
+
+    /* Minor link steals CITER bits 15:9, leaving 9 bits of count */
+    if (config->enableMinorLink) {
+        if (!DMA_IsValidChannel(config->minorLinkChannel) ||
+            (config->majorLoopCount > DMA_TCD_ITER_ELINKYES_MASK)) {
+            return STATUS_ERROR;
+        }
+        iter = (uint16_t)(DMA_TCD_ITER_ELINK_MASK |
+                          (((uint16_t)config->minorLinkChannel << DMA_TCD_ITER_LINKCH_SHIFT) & DMA_TCD_ITER_LINKCH_MASK) |
+                          config->majorLoopCount);
+    } else {
+        if (config->majorLoopCount > DMA_TCD_ITER_ELINKNO_MASK) {
+            return STATUS_ERROR;
+        }
+        iter = config->majorLoopCount;
+    }
+
+    csr = 0U;
+    if (config->enableInterrupt) {
+        csr |= DMA_TCD_CSR_INTMAJOR_MASK;
+    }
+    if (config->enableHalfInterrupt) {
+        csr |= DMA_TCD_CSR_INTHALF_MASK;
+    }
+    if (config->disableRequestAfterDone) {
+        csr |= DMA_TCD_CSR_DREQ_MASK;
+    }
+    if (config->enableMajorLink) {
+        if (!DMA_IsValidChannel(config->majorLinkChannel)) {
+            return STATUS_ERROR;
+        }
+        csr |= DMA_TCD_CSR_MAJORELINK_MASK |
+               (((uint16_t)config->majorLinkChannel << DMA_TCD_CSR_MAJORLINKCH_SHIFT) & DMA_TCD_CSR_MAJORLINKCH_MASK);
+    }
+
+    tcd->SADDR = config->sourceAddr;
+    tcd->SOFF = (uint16_t)config->sourceOffset;
+    tcd->ATTR = (uint16_t)((((uint16_t)config->transferSize << DMA_TCD_ATTR_SSIZE_SHIFT) & DMA_TCD_ATTR_SSIZE_MASK) |
+                           (((uint16_t)config->transferSize << DMA_TCD_ATTR_DSIZE_SHIFT) & DMA_TCD_ATTR_DSIZE_MASK));
+    tcd->NBYTES_MLNO = config->minorLoopBytes;
+    tcd->SLAST = (uint32_t)config->sourceLastAddrAdjust;
+    tcd->DADDR = config->destAddr;
+    tcd->DOFF = (uint16_t)config->destOffset;
+    tcd->CITER_ELINKNO = iter;
+    tcd->DLAST_SGA = (uint32_t)config->destLastAddrAdjust;
+    tcd->CSR = csr;
+    tcd->BITER_ELINKNO = iter;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Link a RAM TCD to the next one
+ */
+status_t DMA_LinkTcd(DMA_TCD_Type *tcd, const DMA_TCD_Type *next)
+{
+    if (tcd == NULL) {
+        return STATUS_ERROR;
+    }
+
+    if (next == NULL) {
+        tcd->CSR &= ~DMA_TCD_CSR_ESG_MASK;
+        tcd->DLAST_SGA = 0U;
+        return STATUS_SUCCESS;
+    }
+
+    /* Misaligned DLAST_SGA raises a scatter/gather configuration error */
+    if (((uint32_t)next % DMA_TCD_ALIGNMENT) != 0U) {
+        return STATUS_ERROR;
+    }
+
+    tcd->DLAST_SGA = (uint32_t)next;
+    tcd->CSR = (uint16_t)((tcd->CSR & ~DMA_TCD_CSR_DREQ_MASK) | DMA_TCD_CSR_ESG_MASK);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Build and link a chain of TCDs
+ */
+status_t DMA_BuildTcdChain(DMA_TCD_Type *pool, const dma_tcd_config_t *configs,
+                           uint8_t count, bool loop)
+{
+    uint8_t i;
+
+    if ((pool == NULL) || (configs == NULL) || (count == 0U)) {
+        return STATUS_ERROR;
+    }
+
+    for (i = 0U; i < count; i++) {
+        if (DMA_BuildTcd(&pool[i], &configs[i]) != STATUS_SUCCESS) {
+            return STATUS_ERROR;
+        }
+    }
+
+    for (i = 0U; (i + 1U) < count; i++) {
+        if (DMA_LinkTcd(&pool[i], &pool[i + 1U]) != STATUS_SUCCESS) {
+            return STATUS_ERROR;
+        }
+    }
+
+    if (loop) {
+        return DMA_LinkTcd(&pool[count - 1U], &pool[0]);
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Load a RAM TCD into a channel
+ */
+status_t DMA_ConfigChannelTcd(uint8_t channel, dmamux_source_t source,
+                              dma_channel_priority_t priority, const DMA_TCD_Type *tcd)
+{
+    if (!DMA_IsValidChannel(channel) || (tcd == NULL)) {
+        return STATUS_ERROR;
+    }
+
+    if (!s_dmaInitialized) {
+        return STATUS_ERROR;
+    }
+
+    DMA_StopChannel(channel);
+    DMA_ResetTCD(channel);
+
+    /* ESG is only accepted by CSR while DONE is clear */
+    DMA_ClearDone(channel);
+
+    DMA->TCD[channel].SADDR = tcd->SADDR;
+    DMA->TCD[channel].SOFF = tcd->SOFF;
+    DMA->TCD[channel].ATTR = tcd->ATTR;
+    DMA->TCD[channel].NBYTES_MLNO = tcd->NBYTES_MLNO;
+    DMA->TCD[channel].SLAST = tcd->SLAST;
+    DMA->TCD[channel].DADDR = tcd->DADDR;
+    DMA->TCD[channel].DOFF = tcd->DOFF;
+    DMA->TCD[channel].CITER_ELINKNO = tcd->CITER_ELINKNO;
+    DMA->TCD[channel].DLAST_SGA = tcd->DLAST_SGA;
+    DMA->TCD[channel].BITER_ELINKNO = tcd->BITER_ELINKNO;
+    DMA->TCD[channel].CSR = (uint16_t)(tcd->CSR & ~(DMA_TCD_CSR_START_MASK | DMA_TCD_CSR_DONE_MASK));
+
+    if (s_dmaOwners[channel] == NULL) {
+        DMA_SetChannelPriority(channel, (uint8_t)priority);
+    }
+
+    DMAMUX->CHCFG[channel] = 0U;
+    DMAMUX->CHCFG[channel] = (uint8_t)(DMAMUX_CHCFG_ENBL_MASK |
+                                       ((uint8_t)source & DMAMUX_CHCFG_SOURCE_MASK));
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Gate the DMAMUX request of a channel with its periodic trigger
+ */
+status_t DMA_SetPeriodicTrigger(uint8_t channel, bool enable)
+{
+    uint8_t chcfg;
+
+    if (channel >= DMA_PERIODIC_TRIGGER_CHANNELS) {
+        return STATUS_ERROR;
+    }
+
+    chcfg = DMAMUX->CHCFG[channel];
+    if (enable) {
+        chcfg |= DMAMUX_CHCFG_TRIG_MASK;
+    } else {
+        chcfg &= (uint8_t)~DMAMUX_CHCFG_TRIG_MASK;
+    }
+
+    /* TRIG may only change while the DMAMUX channel is disabled */
+    DMAMUX->CHCFG[channel] = 0U;
+    DMAMUX->CHCFG[channel] = chcfg;
+
+    return STATUS_SUCCESS;
+}
+
 /**
  * @brief Start DMA transfer for one channel
  */
 status_t DMA_StartChannel(uint8_t channel)
 {
-    if (!DMA_IsValidChannel(channel)) {
+    if (HAL_PARAM_INVALID(!DMA_IsValidChannel(channel))) {
         return STATUS_ERROR;
     }
     
@@ -375,8 +704,14 @@ status_t DMA_StartChannel(uint8_t channel)
     /* Clear DONE flag if any */
     DMA_ClearDone(channel);
     
+#if DMA_STATS_ENABLE
+    s_dmaPendingBytes[channel] = DMA_GetTcdBytes(channel);
+    s_dmaStartCycles[channel] = DMA_DWT_CYCCNT;
+    DMA->SEEI = channel; /* Count errors of this channel */
+#endif
+    
     /* Enable DMA request for this channel */
-    REG_WRITE32(DMA_BASE + 0x001B, channel); /* Set Enable Request */
+    DMA->SERQ = channel; /* Set Enable Request */
     
     /* If software trigger (ALWAYS_ON source), start by setting START bit */
     if ((DMAMUX->CHCFG[channel] & DMAMUX_CHCFG_SOURCE_MASK) >= 60U) {
@@ -391,7 +726,7 @@ status_t DMA_StartChannel(uint8_t channel)
  */
 status_t DMA_StopChannel(uint8_t channel)
 {
-    if (!DMA_IsValidChannel(channel)) {
+    if (HAL_PARAM_INVALID(!DMA_IsValidChannel(channel))) {
         return STATUS_ERROR;
     }
     
@@ -400,7 +735,7 @@ status_t DMA_StopChannel(uint8_t channel)
     }
     
     /* Disable DMA request for this channel */
-    REG_WRITE32(DMA_BASE + 0x001A, channel); /* Clear Enable Request */
+    DMA->CERQ = channel; /* Clear Enable Request */
     
     /* Disable DMAMUX channel */
     DMAMUX->CHCFG[channel] &= ~DMAMUX_CHCFG_ENBL_MASK;
@@ -413,7 +748,7 @@ status_t DMA_StopChannel(uint8_t channel)
  */
 bool DMA_IsChannelActive(uint8_t channel)
 {
-    if (!DMA_IsValidChannel(channel)) {
+    if (HAL_PARAM_INVALID(!DMA_IsValidChannel(channel))) {
         return false;
     }
     
@@ -425,7 +760,7 @@ bool DMA_IsChannelActive(uint8_t channel)
  */
 bool DMA_IsChannelDone(uint8_t channel)
 {
-    if (!DMA_IsValidChannel(channel)) {
+    if (HAL_PARAM_INVALID(!DMA_IsValidChannel(channel))) {
         return false;
     }
     
@@ -437,12 +772,12 @@ bool DMA_IsChannelDone(uint8_t channel)
  */
 status_t DMA_ClearDone(uint8_t channel)
 {
-    if (!DMA_IsValidChannel(channel)) {
+    if (HAL_PARAM_INVALID(!DMA_IsValidChannel(channel))) {
         return STATUS_ERROR;
     }
     
     /* Write to CDNE register to clear DONE bit */
-    REG_WRITE32(DMA_BASE + 0x001C, channel);
+    DMA->CDNE = channel;
     
     return STATUS_SUCCESS;
 }
@@ -476,11 +811,156 @@ status_t DMA_SetChannelPriority(uint8_t channel, uint8_t priority)
     }
     
     /* DCHPRI register: bits 3-0 are priority (0=low, 15=high) */
-    DMA->DCHPRI[channel] = (priority & 0x0FU);
+    DMA->DCHPRI[DMA_DCHPRI_INDEX(channel)] = (priority & DMA_DCHPRI_CHPRI_MASK);
     
     return STATUS_SUCCESS;
 }
 
+/**
+ * @brief Select channel arbitration mode
+ */
+status_t DMA_SetArbitrationMode(dma_arbitration_t mode)
+{
+    uint8_t i;
+
+    if (!s_dmaInitialized) {
+        return STATUS_ERROR;
+    }
+
+    if (mode == DMA_ARBITRATION_FIXED) {
+        /* Duplicate priorities are a configuration error in fixed mode */
+        for (i = 0U; i < DMA_MAX_CHANNELS; i++) {
+            if (s_dmaOwners[i] == NULL) {
+                DMA->DCHPRI[DMA_DCHPRI_INDEX(i)] = i;
+            }
+        }
+        REG_BIT_CLEAR32(DMA_BASE + 0x0000, DMA_CR_ERCA_MASK);
+    } else {
+        REG_BIT_SET32(DMA_BASE + 0x0000, DMA_CR_ERCA_MASK);
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Allocate a free channel from a priority class
+ */
+status_t DMA_RequestChannel(dma_priority_class_t priorityClass, const void *owner, uint8_t *channel)
+{
+    status_t status = STATUS_BUSY;
+    uint32_t primask;
+    uint8_t first;
+    uint8_t last;
+    uint8_t i;
+
+    if ((owner == NULL) || (channel == NULL) || !s_dmaInitialized) {
+        return STATUS_ERROR;
+    }
+
+    /* Class ranges: LOW [0, L), NORMAL [L, 16 - H), HIGH [16 - H, 16) */
+    switch (priorityClass) {
+        case DMA_CLASS_HIGH:
+            first = (uint8_t)(DMA_MAX_CHANNELS - DMA_HIGH_CLASS_CHANNELS);
+            last = (uint8_t)(DMA_MAX_CHANNELS - 1U);
+            break;
+        case DMA_CLASS_NORMAL:
+            first = (uint8_t)DMA_LOW_CLASS_CHANNELS;
+            last = (uint8_t)(DMA_MAX_CHANNELS - DMA_HIGH_CLASS_CHANNELS - 1U);
+            break;
+        case DMA_CLASS_LOW:
+            first = 0U;
+            last = (uint8_t)(DMA_LOW_CLASS_CHANNELS - 1U);
+            break;
+        default:
+            return STATUS_ERROR;
+    }
+
+    primask = NVIC_DisableGlobalIRQ();
+
+    /* Highest free channel of the class first */
+    for (i = (uint8_t)(last + 1U); i > first; i--) {
+        if (s_dmaOwners[i - 1U] == NULL) {
+            s_dmaOwners[i - 1U] = owner;
+            *channel = (uint8_t)(i - 1U);
+            status = STATUS_SUCCESS;
+            break;
+        }
+    }
+
+    NVIC_EnableGlobalIRQ(primask);
+
+    if (status == STATUS_SUCCESS) {
+        DMA_ApplyClassPriority(*channel, priorityClass);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Claim a specific channel
+ */
+status_t DMA_ReserveChannel(uint8_t channel, dma_priority_class_t priorityClass, const void *owner)
+{
+    status_t status = STATUS_SUCCESS;
+    uint32_t primask;
+
+    if (!DMA_IsValidChannel(channel) || (owner == NULL) || !s_dmaInitialized) {
+        return STATUS_ERROR;
+    }
+
+    primask = NVIC_DisableGlobalIRQ();
+
+    if (s_dmaOwners[channel] == NULL) {
+        s_dmaOwners[channel] = owner;
+    } else if (s_dmaOwners[channel] != owner) {
+        status = STATUS_BUSY;
+    } else {
+        /* Already ours */
+    }
+
+    NVIC_EnableGlobalIRQ(primask);
+
+    if (status == STATUS_SUCCESS) {
+        DMA_ApplyClassPriority(channel, priorityClass);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Release an allocated channel
+ */
+status_t DMA_ReleaseChannel(uint8_t channel, const void *owner)
+{
+    if (!DMA_IsValidChannel(channel) || (owner == NULL) || (s_dmaOwners[channel] != owner)) {
+        return STATUS_ERROR;
+    }
+
+    (void)DMA_StopChannel(channel);
+    (void)DMA_DisableChannelInterrupt(channel);
+
+    s_dmaCallbacks[channel] = NULL;
+    s_dmaUserData[channel] = NULL;
+
+    /* Back to the reset priority, still unique for fixed mode */
+    DMA->DCHPRI[DMA_DCHPRI_INDEX(channel)] = channel;
+    s_dmaOwners[channel] = NULL;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Get the owner of a channel
+ */
+const void *DMA_GetChannelOwner(uint8_t channel)
+{
+    if (!DMA_IsValidChannel(channel)) {
+        return NULL;
+    }
+
+    return s_dmaOwners[channel];
+}
+
 /**
  * @brief Get remaining number of major loops
  */
@@ -526,27 +1006,195 @@ status_t DMA_DisableChannelInterrupt(uint8_t channel)
     return STATUS_SUCCESS;
 }
 
+/**
+ * @brief Service one channel interrupt (channel already validated)
+ */
+static inline void DMA_ServiceChannel(uint8_t channel)
+{
+    dma_callback_t callback;
+    
+    NVIC_TRACE_ISR_ENTRY((IRQn_Type)((uint32_t)DMA0_IRQn + channel));
+    
+    /* Clear interrupt flag first: a half / major event during the callback
+     * pends the interrupt again instead of being lost */
+    DMA->CINT = channel; /* Clear Interrupt Request */
+    
+    if ((DMA_IRQ_FAST_MASK & (1UL << channel)) == 0U) {
+#if DMA_STATS_ENABLE
+        dma_channel_stats_t *stats = &s_dmaStats[channel];
+        uint32_t now = DMA_DWT_CYCCNT;
+        uint32_t cycles = now - s_dmaStartCycles[channel];
+
+        /* Half-major interrupts are not a completed transfer, CITER is reloaded at the end */
+        if (((DMA->TCD[channel].CSR & DMA_TCD_CSR_DONE_MASK) != 0U) ||
+            (DMA->TCD[channel].CITER_ELINKNO == DMA->TCD[channel].BITER_ELINKNO)) {
+            stats->transfers++;
+            stats->bytes += s_dmaPendingBytes[channel];
+            stats->lastCycles = cycles;
+            stats->totalCycles += cycles;
+            if (cycles < stats->minCycles) {
+                stats->minCycles = cycles;
+            }
+            if (cycles > stats->maxCycles) {
+                stats->maxCycles = cycles;
+            }
+
+            /* Circular / scatter-gather: next transfer starts now */
+            s_dmaPendingBytes[channel] = DMA_GetTcdBytes(channel);
+            s_dmaStartCycles[channel] = now;
+        }
+#endif
+        
+        /* Clear DONE flag */
+        DMA_ClearDone(channel);
+    }
+    
+    callback = s_dmaCallbacks[channel];
+    if (callback != NULL) {
+        callback(channel, s_dmaUserData[channel]);
+    } else {
+        /* Nothing else touches the eDMA before return: make the clear land */
+        NVIC_ISR_WRITE_FENCE(DMA->INT);
+    }
+}
+
 /**
  * @brief Handle DMA interrupt (called from ISR)
  */
 void DMA_IRQHandler(uint8_t channel)
 {
-    if (!DMA_IsValidChannel(channel)) {
+    if (HAL_PARAM_INVALID(!DMA_IsValidChannel(channel))) {
         return;
     }
     
-    /* Clear interrupt flag */
-    REG_WRITE32(DMA_BASE + 0x001F, channel); /* Clear Interrupt Request */
+    DMA_ServiceChannel(channel);
+}
+
+/* Per-channel vectors: channel is a constant, DMA_ServiceChannel() is inlined.
+ * Vectors above DMA_MAX_CHANNELS are never installed and compile to a return. */
+#define DMA_CHANNEL_VECTOR(n) \
+    HAL_RAMFUNC static void DMA_Ch##n##Vector(void) { \
+        if (n##U < DMA_MAX_CHANNELS) { DMA_ServiceChannel(n##U); } }
+
+DMA_CHANNEL_VECTOR(0)
+DMA_CHANNEL_VECTOR(1)
+DMA_CHANNEL_VECTOR(2)
+DMA_CHANNEL_VECTOR(3)
+DMA_CHANNEL_VECTOR(4)
+DMA_CHANNEL_VECTOR(5)
+DMA_CHANNEL_VECTOR(6)
+DMA_CHANNEL_VECTOR(7)
+DMA_CHANNEL_VECTOR(8)
+DMA_CHANNEL_VECTOR(9)
+DMA_CHANNEL_VECTOR(10)
+DMA_CHANNEL_VECTOR(11)
+DMA_CHANNEL_VECTOR(12)
+DMA_CHANNEL_VECTOR(13)
+DMA_CHANNEL_VECTOR(14)
+DMA_CHANNEL_VECTOR(15)
+
+static const nvic_handler_t s_dmaVectors[DMA_CHANNEL_COUNT] = {
+    DMA_Ch0Vector,  DMA_Ch1Vector,  DMA_Ch2Vector,  DMA_Ch3Vector,
+    DMA_Ch4Vector,  DMA_Ch5Vector,  DMA_Ch6Vector,  DMA_Ch7Vector,
+    DMA_Ch8Vector,  DMA_Ch9Vector,  DMA_Ch10Vector, DMA_Ch11Vector,
+    DMA_Ch12Vector, DMA_Ch13Vector, DMA_Ch14Vector, DMA_Ch15Vector
+};
+
+/**
+ * @brief Install the channel handler in the RAM vector table
+ */
+status_t DMA_InstallIrqHandler(uint8_t channel)
+{
+    if (!DMA_IsValidChannel(channel)) {
+        return STATUS_ERROR;
+    }
     
-    /* Clear DONE flag */
-    DMA_ClearDone(channel);
+    if (NVIC_InstallHandler((IRQn_Type)((uint32_t)DMA0_IRQn + channel),
+                            s_dmaVectors[channel]) != NVIC_STATUS_SUCCESS) {
+        return STATUS_ERROR;
+    }
     
-    /* Call callback if available */
-    if (s_dmaCallbacks[channel] != NULL) {
-        s_dmaCallbacks[channel](channel, s_dmaUserData[channel]);
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Handle DMA error interrupt (called from ISR)
+ */
+void DMA_ErrorIRQHandler(void)
+{
+    uint32_t err = DMA->ERR;
+    uint8_t i;
+
+#if DMA_STATS_ENABLE
+    uint32_t es = DMA->ES;
+#endif
+
+    for (i = 0U; i < DMA_MAX_CHANNELS; i++) {
+        if ((err & (1UL << i)) != 0U) {
+#if DMA_STATS_ENABLE
+            s_dmaStats[i].errors++;
+            s_dmaStats[i].lastErrorStatus = es;
+#endif
+            DMA->CERR = i;
+        }
     }
 }
 
+/**
+ * @brief Read the statistics of a channel
+ */
+status_t DMA_GetChannelStats(uint8_t channel, dma_channel_stats_t *stats)
+{
+#if DMA_STATS_ENABLE
+    uint32_t primask;
+
+    if (!DMA_IsValidChannel(channel) || (stats == NULL)) {
+        return STATUS_ERROR;
+    }
+
+    /* Consistent snapshot against DMA_IRQHandler() */
+    primask = NVIC_DisableGlobalIRQ();
+    *stats = s_dmaStats[channel];
+    NVIC_EnableGlobalIRQ(primask);
+
+    return STATUS_SUCCESS;
+#else
+    (void)channel;
+    (void)stats;
+    return STATUS_UNSUPPORTED;
+#endif
+}
+
+/**
+ * @brief Reset the statistics of a channel
+ */
+status_t DMA_ResetChannelStats(uint8_t channel)
+{
+#if DMA_STATS_ENABLE
+    uint32_t primask;
+
+    if (!DMA_IsValidChannel(channel)) {
+        return STATUS_ERROR;
+    }
+
+    primask = NVIC_DisableGlobalIRQ();
+    s_dmaStats[channel].transfers = 0U;
+    s_dmaStats[channel].bytes = 0U;
+    s_dmaStats[channel].errors = 0U;
+    s_dmaStats[channel].lastErrorStatus = 0U;
+    s_dmaStats[channel].lastCycles = 0U;
+    s_dmaStats[channel].minCycles = 0xFFFFFFFFU;
+    s_dmaStats[channel].maxCycles = 0U;
+    s_dmaStats[channel].totalCycles = 0U;
+    NVIC_EnableGlobalIRQ(primask);
+
+    return STATUS_SUCCESS;
+#else
+    (void)channel;
+    return STATUS_UNSUPPORTED;
+#endif
+}
+
 /**
  * @brief Copy data using DMA (blocking)
  */
@@ -618,3 +1266,84 @@ status_t DMA_MemCopy(uint8_t channel, const void *src, void *dest, uint32_t size
     
     return STATUS_SUCCESS;
 }
+
+/**
+ * @brief Copy data using DMA (non-blocking)
+ */
+status_t DMA_MemCopyAsync(uint8_t channel, const void *src, void *dest, uint32_t size,
+                          dma_callback_t callback, void *userData)
+{
+    dma_channel_config_t config;
+    const uint8_t *srcBytes = (const uint8_t *)src;
+    uint8_t *destBytes = (uint8_t *)dest;
+    dma_transfer_size_t unitSize;
+    uint32_t unitBytes;
+    uint32_t head;
+    uint32_t body;
+    uint32_t i;
+
+    if (!DMA_IsValidChannel(channel) || !s_dmaInitialized) {
+        return STATUS_ERROR;
+    }
+
+    if ((src == NULL) || (dest == NULL) || (size == 0U)) {
+        return STATUS_ERROR;
+    }
+
+    if ((DMA->ERQ & (1UL << channel)) != 0U) {
+        return STATUS_BUSY;
+    }
+
+    unitSize = DMA_SelectCopySize((uint32_t)src, (uint32_t)dest, size, &head);
+    unitBytes = DMA_GetTransferBytes(unitSize);
+    body = ((size - head) / unitBytes) * unitBytes;
+
+    if ((body / unitBytes) > DMA_TCD_ITER_ELINKNO_MASK) {
+        return STATUS_ERROR;
+    }
+
+    /* Head and tail are shorter than one unit, cheaper on the CPU */
+    for (i = 0U; i < head; i++) {
+        destBytes[i] = srcBytes[i];
+    }
+    for (i = head + body; i < size; i++) {
+        destBytes[i] = srcBytes[i];
+    }
+
+    if (body == 0U) {
+        if (callback != NULL) {
+            callback(channel, userData);
+        }
+        return STATUS_SUCCESS;
+    }
+
+    config.channel = channel;
+    config.source = DMAMUX_SRC_ALWAYS_ON_60;
+    config.transferType = DMA_TRANSFER_MEM_TO_MEM;
+    config.transferSize = unitSize;
+    config.priority = DMA_PRIORITY_NORMAL;
+
+    config.sourceAddr = (uint32_t)&srcBytes[head];
+    config.sourceOffset = (int16_t)unitBytes;
+    config.sourceLastAddrAdjust = 0;
+
+    config.destAddr = (uint32_t)&destBytes[head];
+    config.destOffset = (int16_t)unitBytes;
+    config.destLastAddrAdjust = 0;
+
+    config.minorLoopBytes = unitBytes;
+    config.majorLoopCount = (uint16_t)(body / unitBytes);
+
+    config.enableInterrupt = (callback != NULL);
+    config.disableRequestAfterDone = true;
+
+    if (DMA_ConfigChannel(&config) != STATUS_SUCCESS) {
+        return STATUS_ERROR;
+    }
+
+    if (callback != NULL) {
+        (void)DMA_InstallCallback(channel, callback, userData);
+    }
+
+    return DMA_StartChannel(channel);
+}
@@ -37,8 +37,13 @@
  * @{
  */
 
-/** @brief Number of DMA channels available on S32K144 */
-#define DMA_MAX_CHANNELS    (16U)
+/**
+ * @brief Number of DMA channels managed by the driver (channels 0 to n-1)
+ * @details All 16 S32K144 channels unless HAL_DMA_CHANNEL_COUNT (hal_config.h)
+ *          is lowered; the per-channel callback / owner / statistics tables
+ *          are sized by it and higher channels are rejected.
+ */
+#define DMA_MAX_CHANNELS    (HAL_DMA_CHANNEL_COUNT)
 
 /**
  * @brief DMA Transfer Size
@@ -73,6 +78,53 @@ typedef enum {
     DMA_PRIORITY_HIGH   = 15U       /**< High priority */
 } dma_channel_priority_t;
 
+/** @brief Per-channel transfer statistics (DWT cycle counter timestamps) */
+#ifndef DMA_STATS_ENABLE
+#define DMA_STATS_ENABLE            (0U)
+#endif
+
+/**
+ * @brief Channels serviced in fast mode (bit n = channel n)
+ * @details Fast mode channel handler clears the interrupt request and calls
+ *          the callback, without the DONE clear and the DMA_STATS_ENABLE
+ *          accounting. For streams whose callback handles DONE itself (ADC
+ *          DMA streams) or that never restart on DONE (circular TCDs).
+ *          The per-channel vectors of DMA_InstallIrqHandler() fold the
+ *          mode at compile time, DMA_IRQHandler() tests it at runtime.
+ */
+#ifndef DMA_IRQ_FAST_MASK
+#define DMA_IRQ_FAST_MASK           (0x0000U)
+#endif
+
+/** @brief Channels reserved for DMA_CLASS_HIGH (top of the priority range) */
+#ifndef DMA_HIGH_CLASS_CHANNELS
+#define DMA_HIGH_CLASS_CHANNELS     (4U)
+#endif
+
+/** @brief Channels reserved for DMA_CLASS_LOW (bottom of the priority range) */
+#ifndef DMA_LOW_CLASS_CHANNELS
+#define DMA_LOW_CLASS_CHANNELS      (4U)
+#endif
+
+/**
+ * @brief DMA Channel Priority Class
+ * @details Used by DMA_RequestChannel(). With fixed-priority arbitration the
+ *          channel number is its priority, so each class owns a channel range.
+ */
+typedef enum {
+    DMA_CLASS_LOW = 0U,             /**< Bulk copies: preemptible, never preempts */
+    DMA_CLASS_NORMAL,               /**< Peripheral streams: preemptible, may preempt LOW */
+    DMA_CLASS_HIGH                  /**< Latency-critical: not preemptible, preempts others */
+} dma_priority_class_t;
+
+/**
+ * @brief DMA Channel Arbitration Mode
+ */
+typedef enum {
+    DMA_ARBITRATION_ROUND_ROBIN = 0U, /**< Channels served in turn, DCHPRI ignored (DMA_Init() default) */
+    DMA_ARBITRATION_FIXED             /**< Highest DCHPRI first, preemption enabled */
+} dma_arbitration_t;
+
 /**
  * @brief DMA Interrupt Flags
  * @details DMA interrupt flags
@@ -107,9 +159,67 @@ typedef struct {
     
     bool enableInterrupt;               /**< Enable interrupt when major loop completes */
     bool disableRequestAfterDone;       /**< Disable DMA request after completion */
+    bool enablePeriodicTrigger;         /**< Gate the request with the TRGMUX_DMAMUX0 trigger
+                                             (channels 0 to DMA_PERIODIC_TRIGGER_CHANNELS-1) */
     
 } dma_channel_config_t;
 
+/** @brief DMAMUX channels with a periodic trigger input (TRGMUX_DMAMUX0 SEL0-3) */
+#define DMA_PERIODIC_TRIGGER_CHANNELS   (4U)
+
+/** @brief Alignment required for TCDs loaded by scatter/gather (DLAST_SGA) */
+#define DMA_TCD_ALIGNMENT   (32U)
+
+/** @brief Attribute for RAM TCD pools, e.g. static DMA_TCD_Type pool[4] DMA_TCD_ALIGN; */
+#define DMA_TCD_ALIGN       __attribute__((aligned(DMA_TCD_ALIGNMENT)))
+
+/**
+ * @brief TCD Configuration Structure
+ * @details Describes one stage of a scatter/gather chain built in RAM. Same
+ *          fields as dma_channel_config_t minus the channel-level settings
+ *          (DMAMUX source, priority), plus channel linking.
+ */
+typedef struct {
+    dma_transfer_size_t transferSize;   /**< Transfer size */
+
+    uint32_t sourceAddr;                /**< Source address */
+    int16_t sourceOffset;               /**< Source offset after each transfer */
+    int32_t sourceLastAddrAdjust;       /**< Source address adjustment after major loop */
+
+    uint32_t destAddr;                  /**< Destination address */
+    int16_t destOffset;                 /**< Destination offset after each transfer */
+    int32_t destLastAddrAdjust;         /**< Destination adjustment after major loop (ignored when linked to a next TCD) */
+
+    uint32_t minorLoopBytes;            /**< Number of bytes to transfer in each minor loop */
+    uint16_t majorLoopCount;            /**< Major loop iterations (max 511 with minor link) */
+
+    bool enableInterrupt;               /**< Interrupt when this TCD's major loop completes */
+    bool enableHalfInterrupt;           /**< Interrupt at half of this TCD's major loop */
+    bool disableRequestAfterDone;       /**< Clear ERQ when this TCD completes (end of chain) */
+
+    bool enableMinorLink;               /**< Trigger minorLinkChannel after each minor loop */
+    uint8_t minorLinkChannel;           /**< Channel started by minor loop link */
+    bool enableMajorLink;               /**< Trigger majorLinkChannel when the major loop completes */
+    uint8_t majorLinkChannel;           /**< Channel started by major loop link */
+} dma_tcd_config_t;
+
+/**
+ * @brief DMA Channel Statistics
+ * @details Filled when DMA_STATS_ENABLE = 1. A transfer is measured from
+ *          DMA_StartChannel() (or the previous major loop completion for
+ *          circular / scatter-gather chains) to DMA_IRQHandler().
+ */
+typedef struct {
+    uint32_t transfers;                 /**< Major loops completed */
+    uint32_t bytes;                     /**< Bytes moved by completed major loops */
+    uint32_t errors;                    /**< Errors seen by DMA_ErrorIRQHandler() */
+    uint32_t lastErrorStatus;           /**< DMA ES register at the last error */
+    uint32_t lastCycles;                /**< Duration of the last transfer (core cycles) */
+    uint32_t minCycles;                 /**< Shortest transfer (core cycles) */
+    uint32_t maxCycles;                 /**< Longest transfer (core cycles) */
+    uint64_t totalCycles;               /**< Sum of all transfer durations */
+} dma_channel_stats_t;
+
 /**
  * @brief DMA Callback Function Type
  * @details Function pointer for callback when DMA completes or encounters error
@@ -195,7 +305,7 @@ bool DMA_IsChannelDone(uint8_t channel);
  * @retval STATUS_SUCCESS Flag cleared successfully.
  * @retval STATUS_ERROR   Channel invalid.
  */
-status_t DMA_ClearDone(uint8_t channel);
+HAL_RAMFUNC status_t DMA_ClearDone(uint8_t channel);
 
 /**
  * @brief Register a callback for a channel.
@@ -216,6 +326,67 @@ status_t DMA_InstallCallback(uint8_t channel, dma_callback_t callback, void *use
  */
 status_t DMA_SetChannelPriority(uint8_t channel, uint8_t priority);
 
+/**
+ * @brief Select channel arbitration mode.
+ * @details Fixed mode requires unique priorities: every channel not owned
+ *          through the allocator is reset to DCHPRI = channel number first.
+ * @param[in] mode Arbitration mode.
+ * @retval STATUS_SUCCESS Mode applied.
+ * @retval STATUS_ERROR   Driver not initialized.
+ */
+status_t DMA_SetArbitrationMode(dma_arbitration_t mode);
+
+/**
+ * @brief Allocate a free channel from a priority class.
+ * @details The channel gets DCHPRI = channel number plus the class
+ *          preemption settings (ECP/DPA), and keeps them across
+ *          DMA_ConfigChannel() calls until released.
+ * @param[in]  priorityClass Requested class.
+ * @param[in]  owner         Owner tag (e.g. peripheral base address), not NULL.
+ * @param[out] channel       Allocated channel.
+ * @retval STATUS_SUCCESS Channel allocated.
+ * @retval STATUS_BUSY    No free channel left in the class.
+ * @retval STATUS_ERROR   Invalid parameters or driver not initialized.
+ * @note Class guarantees only hold in DMA_ARBITRATION_FIXED mode.
+ *
+ * @code
+ * uint8_t ch;
+ * DMA_SetArbitrationMode(DMA_ARBITRATION_FIXED);
+ * if (DMA_RequestChannel(DMA_CLASS_HIGH, LPUART1, &ch) == STATUS_SUCCESS) {
+ *     UART_StartCircularRxDMA(LPUART1, ch, s_rxRing, sizeof(s_rxRing), OnRx, NULL);
+ * }
+ * @endcode
+ */
+status_t DMA_RequestChannel(dma_priority_class_t priorityClass, const void *owner, uint8_t *channel);
+
+/**
+ * @brief Claim a specific channel (for drivers with a fixed channel number).
+ * @param[in] channel       DMA channel index (0-15).
+ * @param[in] priorityClass Preemption settings to apply.
+ * @param[in] owner         Owner tag, not NULL.
+ * @retval STATUS_SUCCESS Channel claimed (or already owned by @p owner).
+ * @retval STATUS_BUSY    Channel owned by someone else.
+ * @retval STATUS_ERROR   Invalid parameters or driver not initialized.
+ */
+status_t DMA_ReserveChannel(uint8_t channel, dma_priority_class_t priorityClass, const void *owner);
+
+/**
+ * @brief Release an allocated channel.
+ * @details Stops the channel and removes its callback.
+ * @param[in] channel DMA channel index (0-15).
+ * @param[in] owner   Owner tag used when allocating.
+ * @retval STATUS_SUCCESS Channel released.
+ * @retval STATUS_ERROR   Channel invalid or not owned by @p owner.
+ */
+status_t DMA_ReleaseChannel(uint8_t channel, const void *owner);
+
+/**
+ * @brief Get the owner of a channel.
+ * @param[in] channel DMA channel index (0-15).
+ * @return Owner tag, NULL if the channel is free or invalid.
+ */
+const void *DMA_GetChannelOwner(uint8_t channel);
+
 /**
  * @brief Read the remaining major loop count.
  * @param[in]  channel DMA channel index (0-15).
@@ -246,7 +417,56 @@ status_t DMA_DisableChannelInterrupt(uint8_t channel);
  * @param[in] channel DMA channel index serviced by the ISR.
  * @note Clears the interrupt/DONE flags before invoking the callback.
  */
-void DMA_IRQHandler(uint8_t channel);
+HAL_RAMFUNC void DMA_IRQHandler(uint8_t channel);
+
+/**
+ * @brief Install the channel ISR directly in the RAM vector table.
+ * @details The DMAn vector then enters the driver with the channel number
+ *          baked in: no DMAn_IRQHandler wrapper, no DMA_IRQHandler() call.
+ * @param[in] channel DMA channel index (0-15).
+ * @retval STATUS_SUCCESS Handler installed (NVIC enable is left to the caller).
+ * @retval STATUS_ERROR   Channel invalid or no RAM vector table.
+ *
+ * @code
+ * DMA_InstallIrqHandler(0U);
+ * NVIC_EnableIRQ(DMA0_IRQn);
+ * @endcode
+ */
+status_t DMA_InstallIrqHandler(uint8_t channel);
+
+/**
+ * @brief Common DMA error ISR handler helper.
+ * @details Clears the error flag of every failing channel and, with
+ *          DMA_STATS_ENABLE, records the ES register in its statistics.
+ * @note Call from DMA_Error_IRQHandler. With DMA_STATS_ENABLE the error
+ *       interrupt of a channel is enabled by DMA_StartChannel().
+ */
+void DMA_ErrorIRQHandler(void);
+
+/**
+ * @brief Read the statistics of a channel.
+ * @param[in]  channel DMA channel index (0-15).
+ * @param[out] stats   Copy of the counters.
+ * @retval STATUS_SUCCESS      Statistics returned.
+ * @retval STATUS_ERROR        Channel invalid or stats NULL.
+ * @retval STATUS_UNSUPPORTED  Built with DMA_STATS_ENABLE = 0.
+ *
+ * @code
+ * dma_channel_stats_t st;
+ * DMA_GetChannelStats(rxCh, &st);
+ * uint32_t avgUs = (uint32_t)(st.totalCycles / st.transfers) / (SystemCoreClock / 1000000U);
+ * @endcode
+ */
+status_t DMA_GetChannelStats(uint8_t channel, dma_channel_stats_t *stats);
+
+/**
+ * @brief Reset the statistics of a channel.
+ * @param[in] channel DMA channel index (0-15).
+ * @retval STATUS_SUCCESS      Counters cleared.
+ * @retval STATUS_ERROR        Channel invalid.
+ * @retval STATUS_UNSUPPORTED  Built with DMA_STATS_ENABLE = 0.
+ */
+status_t DMA_ResetChannelStats(uint8_t channel);
 
 /**
  * @brief Perform a blocking memory-to-memory copy using DMA.
@@ -260,6 +480,109 @@ void DMA_IRQHandler(uint8_t channel);
  */
 status_t DMA_MemCopy(uint8_t channel, const void *src, void *dest, uint32_t size);
 
+/**
+ * @brief Start a non-blocking memory-to-memory copy using DMA.
+ * @details Picks the widest transfer size the buffers allow: 16-byte bursts
+ *          when src and dest share the same 16-byte alignment, 32-bit words
+ *          when they share 4-byte alignment, bytes otherwise. The unaligned
+ *          head and the tail remainder (at most 15 bytes each) are copied by
+ *          the CPU before the DMA starts, the aligned body is moved by DMA.
+ * @param[in]  channel  DMA channel index (0-15), dedicated to the copy.
+ * @param[in]  src      Source buffer.
+ * @param[out] dest     Destination buffer (must not overlap src).
+ * @param[in]  size     Number of bytes (any value > 0; the DMA body is
+ *                      limited to 32767 transfers of the selected size).
+ * @param[in]  callback Called from DMA_IRQHandler() on completion (NULL to
+ *                      poll with DMA_IsChannelDone()).
+ * @param[in]  userData Pointer passed back to the callback.
+ * @retval STATUS_SUCCESS Copy started (or already finished by the CPU for
+ *                        copies shorter than one DMA unit; the callback is
+ *                        then called before returning).
+ * @retval STATUS_BUSY    Channel still has its request enabled.
+ * @retval STATUS_ERROR   Invalid parameters or driver not initialized.
+ * @note The channel interrupt must be enabled in the NVIC for the callback.
+ */
+status_t DMA_MemCopyAsync(uint8_t channel, const void *src, void *dest, uint32_t size,
+                          dma_callback_t callback, void *userData);
+
+/**
+ * @brief Fill a RAM TCD from a stage description.
+ * @param[out] tcd    TCD to fill (DMA_TCD_ALIGNMENT aligned if it will be
+ *                    loaded by scatter/gather).
+ * @param[in]  config Stage description.
+ * @retval STATUS_SUCCESS TCD built; it terminates the chain (no ESG).
+ * @retval STATUS_ERROR   Invalid sizes, alignment, loop count or link channel.
+ */
+status_t DMA_BuildTcd(DMA_TCD_Type *tcd, const dma_tcd_config_t *config);
+
+/**
+ * @brief Link a RAM TCD to the next one (ESG + DLAST_SGA).
+ * @param[in,out] tcd  TCD whose major loop end loads @p next.
+ * @param[in]     next Next TCD (32-byte aligned), NULL to end the chain.
+ * @retval STATUS_SUCCESS Link updated.
+ * @retval STATUS_ERROR   tcd NULL or next misaligned.
+ * @note Linking replaces destLastAddrAdjust, the hardware uses DLAST_SGA as
+ *       the next TCD address when ESG is set.
+ */
+status_t DMA_LinkTcd(DMA_TCD_Type *tcd, const DMA_TCD_Type *next);
+
+/**
+ * @brief Build and link a chain of TCDs in one call.
+ * @param[out] pool    TCD storage, at least @p count entries, DMA_TCD_ALIGN.
+ * @param[in]  configs One description per stage.
+ * @param[in]  count   Number of stages (>= 1).
+ * @param[in]  loop    true: last TCD links back to pool[0] (runs until
+ *                     stopped), false: chain ends after the last stage.
+ * @retval STATUS_SUCCESS Chain built.
+ * @retval STATUS_ERROR   Invalid parameter in any stage.
+ */
+status_t DMA_BuildTcdChain(DMA_TCD_Type *pool, const dma_tcd_config_t *configs,
+                           uint8_t count, bool loop);
+
+/**
+ * @brief Load a RAM TCD (usually the head of a chain) into a channel.
+ * @details Stops the channel, copies the TCD into the channel registers
+ *          (CSR last, after DONE is cleared so ESG is accepted), sets the
+ *          priority and routes the DMAMUX source. Start with DMA_StartChannel().
+ * @param[in] channel  DMA channel index (0-15).
+ * @param[in] source   DMAMUX request source (DMAMUX_SRC_ALWAYS_ON_xx for
+ *                     software start, or a channel only started by links).
+ * @param[in] priority Channel priority.
+ * @param[in] tcd      First TCD of the transfer.
+ * @retval STATUS_SUCCESS Channel loaded.
+ * @retval STATUS_ERROR   Invalid parameters or driver not initialized.
+ *
+ * @code
+ * // ch0: ADC0 results -> block A / block B (2-stage loop)
+ * // ch1: started by ch0 major link, copies the finished block to the
+ * //      UART frame buffer in one minor loop; its ERQ stays off
+ * static DMA_TCD_Type s_adcTcd[2] DMA_TCD_ALIGN;
+ * static DMA_TCD_Type s_copyTcd DMA_TCD_ALIGN;
+ * dma_tcd_config_t stage[2] = { ... };   // .enableMajorLink = true, .majorLinkChannel = 1U
+ * DMA_BuildTcdChain(s_adcTcd, stage, 2U, true);
+ * DMA_BuildTcd(&s_copyTcd, &copy);
+ * DMA_ConfigChannelTcd(1U, DMAMUX_SRC_ALWAYS_ON_60, DMA_PRIORITY_NORMAL, &s_copyTcd);
+ * DMA_ConfigChannelTcd(0U, DMAMUX_SRC_ADC0, DMA_PRIORITY_HIGH, &s_adcTcd[0]);
+ * DMA_StartChannel(0U);
+ * @endcode
+ */
+status_t DMA_ConfigChannelTcd(uint8_t channel, dmamux_source_t source,
+                              dma_channel_priority_t priority, const DMA_TCD_Type *tcd);
+
+/**
+ * @brief Gate the DMAMUX request of a channel with its periodic trigger.
+ * @details With TRIG set an always-on source issues one request per trigger
+ *          edge (TRGMUX_DMAMUX0 SELn for channel n), so a timer paces the
+ *          transfer without CPU involvement. Call after the channel is
+ *          configured with DMA_ConfigChannelTcd(), which clears TRIG;
+ *          DMA_ConfigChannel() takes it from enablePeriodicTrigger instead.
+ * @param[in] channel DMA channel index (0-3, periodic trigger channels).
+ * @param[in] enable  true to enable trigger gating.
+ * @retval STATUS_SUCCESS Trigger mode updated.
+ * @retval STATUS_ERROR   Channel has no periodic trigger.
+ */
+status_t DMA_SetPeriodicTrigger(uint8_t channel, bool enable);
+
 /** @} */ /* End of DMA_Functions */
 
 #endif /* DMA_H */
@@ -213,6 +213,45 @@ typedef struct {
 #define DMA_CR_EMLM_MASK    (0x00000080UL)
 #define DMA_CR_EMLM_SHIFT   (7U)
 
+/** @brief Error Cancel Transfer */
+#define DMA_CR_ECX_MASK     (0x00010000UL)
+#define DMA_CR_ECX_SHIFT    (16U)
+
+/** @brief Cancel Transfer */
+#define DMA_CR_CX_MASK      (0x00020000UL)
+#define DMA_CR_CX_SHIFT     (17U)
+
+/*******************************************************************************
+ * DMA Error Status Register (ES) Bit Definitions
+ ******************************************************************************/
+
+/** @brief Error Channel Number of the last recorded error */
+#define DMA_ES_ERRCHN_MASK  (0x00000F00UL)
+#define DMA_ES_ERRCHN_SHIFT (8U)
+
+/** @brief Logical OR of all ERR status bits */
+#define DMA_ES_VLD_MASK     (0x80000000UL)
+#define DMA_ES_VLD_SHIFT    (31U)
+
+/*******************************************************************************
+ * DMA Channel Priority Register (DCHPRI) Bit Definitions
+ ******************************************************************************/
+
+/** @brief Channel Arbitration Priority (must be unique in fixed-priority mode) */
+#define DMA_DCHPRI_CHPRI_MASK   (0x0FU)
+#define DMA_DCHPRI_CHPRI_SHIFT  (0U)
+
+/** @brief Disable Preempt Ability - channel cannot suspend a lower priority channel */
+#define DMA_DCHPRI_DPA_MASK     (0x40U)
+#define DMA_DCHPRI_DPA_SHIFT    (6U)
+
+/** @brief Enable Channel Preemption - channel can be suspended by a higher priority channel */
+#define DMA_DCHPRI_ECP_MASK     (0x80U)
+#define DMA_DCHPRI_ECP_SHIFT    (7U)
+
+/** @brief DCHPRI[] byte index of a channel (registers are byte-swapped per 32-bit word) */
+#define DMA_DCHPRI_INDEX(ch)    ((uint8_t)((ch) ^ 0x3U))
+
 /*******************************************************************************
  * TCD Register Bit Definitions
  ******************************************************************************/
@@ -241,6 +280,13 @@ typedef struct {
 #define DMA_TCD_CSR_BWC_SHIFT       (14U)     /**< Bandwidth Control */
 #define DMA_TCD_CSR_BWC_MASK        (0xC000U)
 
+/** @brief TCD CITER/BITER with minor loop channel linking (ELINK = 1) */
+#define DMA_TCD_ITER_ELINK_MASK     (0x8000U) /**< Enable channel-to-channel linking on minor loop complete */
+#define DMA_TCD_ITER_LINKCH_SHIFT   (9U)      /**< Minor loop link channel number */
+#define DMA_TCD_ITER_LINKCH_MASK    (0x1E00U)
+#define DMA_TCD_ITER_ELINKYES_MASK  (0x01FFU) /**< Major loop count when ELINK = 1 (max 511) */
+#define DMA_TCD_ITER_ELINKNO_MASK   (0x7FFFU) /**< Major loop count when ELINK = 0 (max 32767) */
+
 /*******************************************************************************
  * DMAMUX Register Bit Definitions
  ******************************************************************************/
@@ -0,0 +1,1074 @@
+/**
+ * @file    flexio.c
+ * @brief   FlexIO Driver Implementation for S32K144
+ * @details Implementation of the UART, SPI master and I2C master channels:
+ *          shifter / timer setup, polled transfers, eDMA transfers (UART,
+ *          SPI) and the interrupt-driven I2C engine.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "flexio.h"
+#include "pcc.h"
+#include "dma.h"
+#include "nvic.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Resources of channel n: shifter / timer 2n (TX, SCK, SCL) and 2n + 1 (RX, CS, bit count) */
+#define FLEXIO_TX_SHIFTER(ch)   ((uint32_t)(ch) * 2U)
+#define FLEXIO_RX_SHIFTER(ch)   (((uint32_t)(ch) * 2U) + 1U)
+#define FLEXIO_CLK_TIMER(ch)    ((uint32_t)(ch) * 2U)
+#define FLEXIO_AUX_TIMER(ch)    (((uint32_t)(ch) * 2U) + 1U)
+
+#define FLEXIO_SHIFTER_BITS(ch) ((1UL << FLEXIO_TX_SHIFTER(ch)) | (1UL << FLEXIO_RX_SHIFTER(ch)))
+#define FLEXIO_TIMER_BITS(ch)   ((1UL << FLEXIO_CLK_TIMER(ch)) | (1UL << FLEXIO_AUX_TIMER(ch)))
+
+/* Dual 8-bit baud mode: TIMCMP[15:8] = edges - 1, TIMCMP[7:0] = half period - 1 */
+#define FLEXIO_BAUD_CMP(edges, div)     ((((uint32_t)(edges) - 1U) << 8U) | (uint32_t)(div))
+
+/* 8-bit frame: 16 edges */
+#define FLEXIO_FRAME_EDGES      (16U)
+
+/* I2C: 9 bits (data + ACK) per byte, 2 edges per bit, + 1 bit for STOP */
+#define FLEXIO_I2C_EDGES(bytes) ((((uint32_t)(bytes) * 18U) + 2U))
+
+/*******************************************************************************
+ * Private Types
+ ******************************************************************************/
+
+/**
+ * @brief Channel protocol
+ */
+typedef enum {
+    FLEXIO_MODE_NONE = 0U,
+    FLEXIO_MODE_UART,
+    FLEXIO_MODE_SPI,
+    FLEXIO_MODE_I2C
+} flexio_mode_t;
+
+/**
+ * @brief Per-channel driver state
+ */
+typedef struct {
+    flexio_mode_t mode;                 /**< Protocol configured on the channel */
+    volatile bool busy;                 /**< DMA / interrupt transfer in progress */
+    uint8_t channel;                    /**< Channel number (callback context) */
+    uint8_t divider;                    /**< Baud timer half-period - 1 */
+    bool txDma;                         /**< TX DMA channel in use */
+    bool rxDma;                         /**< RX DMA channel in use */
+    uint8_t txChannel;                  /**< DMA TX channel */
+    uint8_t rxChannel;                  /**< DMA RX channel */
+    flexio_callback_t callback;
+    void *userData;
+
+    /* I2C transfer */
+    uint8_t *data;
+    uint8_t address;
+    uint8_t size;
+    bool read;
+    bool async;
+    bool nack;
+    uint8_t txCount;                    /**< Words written after the address (data + STOP) */
+    uint8_t rxCount;                    /**< Words read back (address + data) */
+} flexio_state_t;
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+
+/** @brief Driver state */
+static flexio_state_t s_flexioState[FLEXIO_CHANNEL_COUNT];
+
+/** @brief Module clock gate enabled by FLEXIO_Init() */
+static bool s_flexioInitialized = false;
+
+/** @brief Dummy bytes for NULL SPI buffers */
+static const uint8_t s_dummyTx = 0U;
+static volatile uint8_t s_dummyRx;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static inline bool FLEXIO_IsValidChannel(uint8_t channel)
+{
+    return s_flexioInitialized && (channel < FLEXIO_CHANNEL_COUNT);
+}
+
+static inline bool FLEXIO_IsValidPin(uint8_t pin)
+{
+    return (pin < FLEXIO_PIN_COUNT);
+}
+
+/* Bit clock half period - 1, rounded to the nearest value */
+static bool FLEXIO_CalcDivider(uint32_t baudRate, uint8_t *divider)
+{
+    uint32_t clock = PCC_GetPeripheralClockFreq(PCC_FlexIO_INDEX);
+    uint32_t half;
+
+    if ((baudRate == 0U) || (clock == 0U)) {
+        return false;
+    }
+
+    half = (clock + baudRate) / (2U * baudRate);
+    if ((half == 0U) || (half > 256U)) {
+        return false;
+    }
+
+    *divider = (uint8_t)(half - 1U);
+
+    return true;
+}
+
+static inline dmamux_source_t FLEXIO_DmaSource(uint32_t shifter)
+{
+    return (dmamux_source_t)((uint32_t)DMAMUX_SRC_FLEXIO_SHFT0 + shifter);
+}
+
+/* Disable the channel shifters / timers, clear flags and interrupt / DMA enables */
+static void FLEXIO_ResetChannel(uint8_t channel)
+{
+    FLEXIO_Type *base = FLEXIO;
+
+    base->SHIFTSIEN &= ~FLEXIO_SHIFTER_BITS(channel);
+    base->SHIFTEIEN &= ~FLEXIO_SHIFTER_BITS(channel);
+    base->SHIFTSDEN &= ~FLEXIO_SHIFTER_BITS(channel);
+    base->TIMIEN &= ~FLEXIO_TIMER_BITS(channel);
+
+    base->SHIFTCTL[FLEXIO_TX_SHIFTER(channel)] = 0U;
+    base->SHIFTCTL[FLEXIO_RX_SHIFTER(channel)] = 0U;
+    base->SHIFTCFG[FLEXIO_TX_SHIFTER(channel)] = 0U;
+    base->SHIFTCFG[FLEXIO_RX_SHIFTER(channel)] = 0U;
+    base->TIMCTL[FLEXIO_CLK_TIMER(channel)] = 0U;
+    base->TIMCTL[FLEXIO_AUX_TIMER(channel)] = 0U;
+    base->TIMCFG[FLEXIO_CLK_TIMER(channel)] = 0U;
+    base->TIMCFG[FLEXIO_AUX_TIMER(channel)] = 0U;
+
+    base->SHIFTSTAT = FLEXIO_SHIFTER_BITS(channel);
+    base->SHIFTERR = FLEXIO_SHIFTER_BITS(channel);
+    base->TIMSTAT = FLEXIO_TIMER_BITS(channel);
+}
+
+/* Wait for a flag in a register (SHIFTSTAT / TIMSTAT), false on timeout */
+static bool FLEXIO_WaitFlag(const volatile uint32_t *reg, uint32_t mask)
+{
+    uint32_t timeout = FLEXIO_TIMEOUT_COUNT;
+
+    while ((*reg & mask) == 0U) {
+        if (--timeout == 0U) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* Lock the channel for a DMA / interrupt transfer */
+static status_t FLEXIO_Claim(flexio_state_t *state, flexio_mode_t mode)
+{
+    uint32_t primask;
+
+    if (state->mode != mode) {
+        return STATUS_ERROR;
+    }
+
+    primask = NVIC_DisableGlobalIRQ();
+    if (state->busy) {
+        NVIC_EnableGlobalIRQ(primask);
+        return STATUS_BUSY;
+    }
+    state->busy = true;
+    NVIC_EnableGlobalIRQ(primask);
+
+    return STATUS_SUCCESS;
+}
+
+static void FLEXIO_Complete(flexio_state_t *state, status_t status)
+{
+    state->busy = false;
+
+    if (state->callback != NULL) {
+        state->callback(state->channel, status, state->userData);
+    }
+}
+
+/* Major loop done (last channel of the transfer): disable the shifter DMA requests */
+static void FLEXIO_DmaComplete(uint8_t dmaChannel, void *userData)
+{
+    flexio_state_t *state = (flexio_state_t *)userData;
+
+    (void)dmaChannel;
+
+    FLEXIO->SHIFTSDEN &= ~FLEXIO_SHIFTER_BITS(state->channel);
+    state->txDma = false;
+    state->rxDma = false;
+
+    FLEXIO_Complete(state, STATUS_SUCCESS);
+}
+
+static void FLEXIO_DmaBaseConfig(dma_channel_config_t *config, uint8_t channel, dmamux_source_t source,
+                                 uint16_t size)
+{
+    config->channel = channel;
+    config->source = source;
+    config->transferSize = DMA_TRANSFER_SIZE_1B;
+    config->sourceOffset = 0;
+    config->sourceLastAddrAdjust = 0;
+    config->destOffset = 0;
+    config->destLastAddrAdjust = 0;
+    config->minorLoopBytes = 1U;
+    config->majorLoopCount = size;
+    config->enableInterrupt = false;
+    config->disableRequestAfterDone = true;
+    config->enablePeriodicTrigger = false;
+}
+
+/*******************************************************************************
+ * I2C Engine
+ ******************************************************************************/
+
+static void FLEXIO_I2cStop(const flexio_state_t *state)
+{
+    FLEXIO_Type *base = FLEXIO;
+    uint8_t ch = state->channel;
+
+    base->SHIFTSIEN &= ~FLEXIO_SHIFTER_BITS(ch);
+    base->TIMIEN &= ~FLEXIO_TIMER_BITS(ch);
+
+    base->SHIFTCTL[FLEXIO_TX_SHIFTER(ch)] &= ~FLEXIO_SHIFTCTL_SMOD_MASK;
+    base->SHIFTCTL[FLEXIO_RX_SHIFTER(ch)] &= ~FLEXIO_SHIFTCTL_SMOD_MASK;
+    base->TIMCTL[FLEXIO_CLK_TIMER(ch)] &= ~FLEXIO_TIMCTL_TIMOD_MASK;
+    base->TIMCTL[FLEXIO_AUX_TIMER(ch)] &= ~FLEXIO_TIMCTL_TIMOD_MASK;
+
+    base->SHIFTERR = FLEXIO_SHIFTER_BITS(ch);
+    base->TIMSTAT = FLEXIO_TIMER_BITS(ch);
+}
+
+static void FLEXIO_I2cStart(flexio_state_t *state)
+{
+    FLEXIO_Type *base = FLEXIO;
+    uint8_t ch = state->channel;
+    uint32_t tx = FLEXIO_TX_SHIFTER(ch);
+    uint32_t rx = FLEXIO_RX_SHIFTER(ch);
+    uint8_t addrByte = (uint8_t)((uint8_t)(state->address << 1U) | (state->read ? 1U : 0U));
+
+    state->nack = false;
+    state->txCount = 0U;
+    state->rxCount = 0U;
+
+    /* The SCL timer counts the whole transfer: address + data, then STOP */
+    base->TIMCMP[FLEXIO_CLK_TIMER(ch)] = FLEXIO_BAUD_CMP(FLEXIO_I2C_EDGES((uint32_t)state->size + 1U),
+                                                         state->divider);
+
+    /* Address: stop bit 1 = release SDA for the slave ACK */
+    base->SHIFTCFG[tx] = (base->SHIFTCFG[tx] & ~FLEXIO_SHIFTCFG_SSTOP_MASK) |
+                         FLEXIO_SHIFTCFG_SSTOP(FLEXIO_SHIFTER_STOP_1);
+
+    (void)base->SHIFTBUF[rx];
+    base->SHIFTERR = FLEXIO_SHIFTER_BITS(ch);
+    base->TIMSTAT = FLEXIO_TIMER_BITS(ch);
+
+    base->SHIFTCTL[tx] |= FLEXIO_SHIFTCTL_SMOD(FLEXIO_SHIFTER_MODE_TRANSMIT);
+    base->SHIFTCTL[rx] |= FLEXIO_SHIFTCTL_SMOD(FLEXIO_SHIFTER_MODE_RECEIVE);
+    base->TIMCTL[FLEXIO_AUX_TIMER(ch)] |= FLEXIO_TIMCTL_TIMOD(FLEXIO_TIMER_MODE_16BIT);
+    base->TIMCTL[FLEXIO_CLK_TIMER(ch)] |= FLEXIO_TIMCTL_TIMOD(FLEXIO_TIMER_MODE_8BIT_BAUD);
+
+    /* SDA is open drain with inverted pin polarity, so shifter data is inverted too. Writing the address = START */
+    base->SHIFTBUFBIS[tx] = ~((uint32_t)addrByte << 24U);
+}
+
+/*
+ * One step of the I2C engine (polling or from FLEXIO_IRQHandler).
+ * Returns true once the STOP is done.
+ */
+static bool FLEXIO_I2cStep(flexio_state_t *state)
+{
+    FLEXIO_Type *base = FLEXIO;
+    uint8_t ch = state->channel;
+    uint32_t tx = FLEXIO_TX_SHIFTER(ch);
+    uint32_t rx = FLEXIO_RX_SHIFTER(ch);
+    uint32_t words = (uint32_t)state->size + 1U;
+    uint32_t shifting;
+    uint32_t stop;
+    uint8_t byte;
+    uint8_t value;
+
+    /* RX: readback of every byte on the bus (address + data), stop bit = ACK */
+    while ((state->rxCount < words) && ((base->SHIFTSTAT & (1UL << rx)) != 0U)) {
+        if ((base->SHIFTERR & (1UL << rx)) != 0U) {
+            base->SHIFTERR = 1UL << rx;
+            /* A master NACK on the last read byte is expected */
+            if (!state->read || (state->rxCount != state->size)) {
+                state->nack = true;
+            }
+        }
+
+        value = (uint8_t)(base->SHIFTBUFBIS[rx] & 0xFFU);
+        if (state->read && (state->rxCount != 0U)) {
+            state->data[state->rxCount - 1U] = value;
+        }
+        state->rxCount++;
+    }
+
+    /* TX: word j is written just as word j - 1 enters the shifter, so SSTOP here is the ACK of word j - 1 */
+    if ((state->txCount < words) && ((base->SHIFTSTAT & (1UL << tx)) != 0U)) {
+        shifting = state->txCount;
+        stop = (state->read && (shifting != 0U) && (shifting < state->size)) ?
+               FLEXIO_SHIFTER_STOP_0 : FLEXIO_SHIFTER_STOP_1;
+        base->SHIFTCFG[tx] = (base->SHIFTCFG[tx] & ~FLEXIO_SHIFTCFG_SSTOP_MASK) |
+                             FLEXIO_SHIFTCFG_SSTOP(stop);
+
+        if (state->txCount == state->size) {
+            byte = 0x00U;                           /* STOP */
+        } else if (state->read || state->nack) {
+            byte = 0xFFU;                           /* Release SDA */
+        } else {
+            byte = state->data[state->txCount];
+        }
+        base->SHIFTBUFBIS[tx] = ~((uint32_t)byte << 24U);
+        state->txCount++;
+
+        if (state->async && (state->txCount == words)) {
+            base->SHIFTSIEN &= ~(1UL << tx);
+        }
+    }
+
+    if (state->rxCount < words) {
+        return false;
+    }
+
+    if (state->async && ((base->SHIFTSIEN & (1UL << rx)) != 0U)) {
+        /* Wait for STOP: SCL timer compare */
+        base->SHIFTSIEN &= ~(1UL << rx);
+        base->TIMIEN |= 1UL << FLEXIO_CLK_TIMER(ch);
+    }
+
+    return (base->TIMSTAT & (1UL << FLEXIO_CLK_TIMER(ch))) != 0U;
+}
+
+static status_t FLEXIO_I2cPrepare(uint8_t channel, uint8_t address, uint8_t *data, uint8_t size, bool read)
+{
+    flexio_state_t *state;
+
+    if (!FLEXIO_IsValidChannel(channel) || (address > 0x7FU) || (data == NULL) ||
+        (size == 0U) || (size > FLEXIO_I2C_MAX_SIZE)) {
+        return STATUS_ERROR;
+    }
+
+    state = &s_flexioState[channel];
+    state->address = address;
+    state->data = data;
+    state->size = size;
+    state->read = read;
+
+    return STATUS_SUCCESS;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+status_t FLEXIO_Init(void)
+{
+    FLEXIO_Type *base = FLEXIO;
+    uint8_t ch;
+
+    PCC->PCCn[PCC_FlexIO_INDEX] |= PCC_PCCn_CGC_MASK;
+
+    if (PCC_GetPeripheralClockFreq(PCC_FlexIO_INDEX) == 0U) {
+        return STATUS_ERROR;
+    }
+
+    /* Software reset: every shifter / timer disabled */
+    base->CTRL = FLEXIO_CTRL_SWRST_MASK;
+    base->CTRL = 0U;
+    base->CTRL = FLEXIO_CTRL_FLEXEN_MASK | FLEXIO_CTRL_DBGE_MASK;
+
+    for (ch = 0U; ch < FLEXIO_CHANNEL_COUNT; ch++) {
+        s_flexioState[ch].mode = FLEXIO_MODE_NONE;
+        s_flexioState[ch].busy = false;
+        s_flexioState[ch].channel = ch;
+        s_flexioState[ch].txDma = false;
+        s_flexioState[ch].rxDma = false;
+        s_flexioState[ch].callback = NULL;
+        s_flexioState[ch].userData = NULL;
+    }
+
+    s_flexioInitialized = true;
+
+    return STATUS_SUCCESS;
+}
+
+status_t FLEXIO_Deinit(void)
+{
+    uint8_t ch;
+
+    for (ch = 0U; ch < FLEXIO_CHANNEL_COUNT; ch++) {
+        if (s_flexioState[ch].busy) {
+            return STATUS_BUSY;
+        }
+    }
+
+    if (s_flexioInitialized) {
+        FLEXIO->CTRL = 0U;
+    }
+
+    PCC->PCCn[PCC_FlexIO_INDEX] &= ~PCC_PCCn_CGC_MASK;
+
+    s_flexioInitialized = false;
+
+    return STATUS_SUCCESS;
+}
+
+status_t FLEXIO_InstallIrqHandler(void)
+{
+    if (NVIC_InstallHandler(FLEXIO_IRQn, FLEXIO_IRQHandler) != NVIC_STATUS_SUCCESS) {
+        return STATUS_ERROR;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+void FLEXIO_IRQHandler(void)
+{
+    flexio_state_t *state;
+    uint8_t ch;
+
+    for (ch = 0U; ch < FLEXIO_CHANNEL_COUNT; ch++) {
+        state = &s_flexioState[ch];
+
+        if ((state->mode == FLEXIO_MODE_I2C) && state->busy && state->async) {
+            if (FLEXIO_I2cStep(state)) {
+                FLEXIO_I2cStop(state);
+                FLEXIO_Complete(state, state->nack ? STATUS_ERROR : STATUS_SUCCESS);
+            }
+        }
+    }
+}
+
+bool FLEXIO_IsBusy(uint8_t channel)
+{
+    if (!FLEXIO_IsValidChannel(channel)) {
+        return false;
+    }
+
+    return s_flexioState[channel].busy;
+}
+
+status_t FLEXIO_Abort(uint8_t channel)
+{
+    flexio_state_t *state;
+
+    if (!FLEXIO_IsValidChannel(channel)) {
+        return STATUS_ERROR;
+    }
+
+    state = &s_flexioState[channel];
+    if (!state->busy) {
+        return STATUS_SUCCESS;
+    }
+
+    FLEXIO->SHIFTSDEN &= ~FLEXIO_SHIFTER_BITS(channel);
+    if (state->txDma) {
+        (void)DMA_StopChannel(state->txChannel);
+    }
+    if (state->rxDma) {
+        (void)DMA_StopChannel(state->rxChannel);
+    }
+    if (state->mode == FLEXIO_MODE_I2C) {
+        FLEXIO_I2cStop(state);
+    }
+
+    state->txDma = false;
+    state->rxDma = false;
+    state->busy = false;
+
+    return STATUS_SUCCESS;
+}
+
+/*******************************************************************************
+ * UART
+ ******************************************************************************/
+
+status_t FLEXIO_UartInit(uint8_t channel, const flexio_uart_config_t *config)
+{
+    FLEXIO_Type *base = FLEXIO;
+    flexio_state_t *state;
+    uint32_t tx = FLEXIO_TX_SHIFTER(channel);
+    uint32_t rx = FLEXIO_RX_SHIFTER(channel);
+    uint32_t txTimer = FLEXIO_CLK_TIMER(channel);
+    uint32_t rxTimer = FLEXIO_AUX_TIMER(channel);
+    uint8_t divider;
+
+    if (!FLEXIO_IsValidChannel(channel) || (config == NULL) ||
+        ((config->txPin != FLEXIO_PIN_NONE) && !FLEXIO_IsValidPin(config->txPin)) ||
+        ((config->rxPin != FLEXIO_PIN_NONE) && !FLEXIO_IsValidPin(config->rxPin)) ||
+        !FLEXIO_CalcDivider(config->baudRate, &divider)) {
+        return STATUS_ERROR;
+    }
+
+    state = &s_flexioState[channel];
+    if (state->busy) {
+        return STATUS_BUSY;
+    }
+
+    FLEXIO_ResetChannel(channel);
+
+    if (config->txPin != FLEXIO_PIN_NONE) {
+        /* TX shifter: start bit 0, stop bit 1, shift on the timer rising edge */
+        base->SHIFTCFG[tx] = FLEXIO_SHIFTCFG_SSTART(FLEXIO_SHIFTER_START_0) |
+                             FLEXIO_SHIFTCFG_SSTOP(FLEXIO_SHIFTER_STOP_1);
+        base->SHIFTCTL[tx] = FLEXIO_SHIFTCTL_TIMSEL(txTimer) |
+                             FLEXIO_SHIFTCTL_PINCFG(FLEXIO_PIN_CONFIG_OUTPUT) |
+                             FLEXIO_SHIFTCTL_PINSEL(config->txPin) |
+                             FLEXIO_SHIFTCTL_SMOD(FLEXIO_SHIFTER_MODE_TRANSMIT);
+
+        /* TX timer: runs while the shifter has data (SSF = 0), stops after 8 bits + stop bit */
+        base->TIMCMP[txTimer] = FLEXIO_BAUD_CMP(FLEXIO_FRAME_EDGES, divider);
+        base->TIMCFG[txTimer] = FLEXIO_TIMCFG_TSTART(1U) |
+                                FLEXIO_TIMCFG_TSTOP(FLEXIO_TIMER_STOP_DISABLE) |
+                                FLEXIO_TIMCFG_TIMENA(FLEXIO_TIMER_ENABLE_TRIGGER_HIGH) |
+                                FLEXIO_TIMCFG_TIMDIS(FLEXIO_TIMER_DISABLE_COMPARE) |
+                                FLEXIO_TIMCFG_TIMOUT(FLEXIO_TIMER_OUT_ONE);
+        base->TIMCTL[txTimer] = FLEXIO_TIMCTL_TRGSEL(FLEXIO_TRIGGER_SHIFTER(tx)) |
+                                FLEXIO_TIMCTL_TRGPOL(1U) | FLEXIO_TIMCTL_TRGSRC(1U) |
+                                FLEXIO_TIMCTL_PINSEL(config->txPin) |
+                                FLEXIO_TIMCTL_TIMOD(FLEXIO_TIMER_MODE_8BIT_BAUD);
+    }
+
+    if (config->rxPin != FLEXIO_PIN_NONE) {
+        /* RX shifter: checks start / stop bits, samples on the falling edge (mid bit) */
+        base->SHIFTCFG[rx] = FLEXIO_SHIFTCFG_SSTART(FLEXIO_SHIFTER_START_0) |
+                             FLEXIO_SHIFTCFG_SSTOP(FLEXIO_SHIFTER_STOP_1);
+        base->SHIFTCTL[rx] = FLEXIO_SHIFTCTL_TIMSEL(rxTimer) | FLEXIO_SHIFTCTL_TIMPOL(1U) |
+                             FLEXIO_SHIFTCTL_PINSEL(config->rxPin) |
+                             FLEXIO_SHIFTCTL_SMOD(FLEXIO_SHIFTER_MODE_RECEIVE);
+
+        /* RX timer: the start bit (pin active low) enables and resyncs the timer */
+        base->TIMCMP[rxTimer] = FLEXIO_BAUD_CMP(FLEXIO_FRAME_EDGES, divider);
+        base->TIMCFG[rxTimer] = FLEXIO_TIMCFG_TSTART(1U) |
+                                FLEXIO_TIMCFG_TSTOP(FLEXIO_TIMER_STOP_DISABLE) |
+                                FLEXIO_TIMCFG_TIMENA(FLEXIO_TIMER_ENABLE_PIN_RISING) |
+                                FLEXIO_TIMCFG_TIMDIS(FLEXIO_TIMER_DISABLE_COMPARE) |
+                                FLEXIO_TIMCFG_TIMRST(FLEXIO_TIMER_RESET_PIN_RISING) |
+                                FLEXIO_TIMCFG_TIMOUT(FLEXIO_TIMER_OUT_ONE_RESET);
+        base->TIMCTL[rxTimer] = FLEXIO_TIMCTL_PINSEL(config->rxPin) | FLEXIO_TIMCTL_PINPOL(1U) |
+                                FLEXIO_TIMCTL_TIMOD(FLEXIO_TIMER_MODE_8BIT_BAUD);
+    }
+
+    state->divider = divider;
+    state->mode = FLEXIO_MODE_UART;
+
+    return STATUS_SUCCESS;
+}
+
+status_t FLEXIO_UartSendBlocking(uint8_t channel, const uint8_t *data, uint32_t size)
+{
+    FLEXIO_Type *base = FLEXIO;
+    uint32_t tx = FLEXIO_TX_SHIFTER(channel);
+    uint32_t i;
+
+    if (!FLEXIO_IsValidChannel(channel) || (data == NULL) ||
+        (s_flexioState[channel].mode != FLEXIO_MODE_UART)) {
+        return STATUS_ERROR;
+    }
+
+    if (s_flexioState[channel].busy) {
+        return STATUS_BUSY;
+    }
+
+    for (i = 0U; i < size; i++) {
+        if (!FLEXIO_WaitFlag(&base->SHIFTSTAT, 1UL << tx)) {
+            return STATUS_TIMEOUT;
+        }
+        base->SHIFTBUF[tx] = data[i];
+    }
+
+    /* Last byte is in the shifter: wait for the timer compare (stop bit done) */
+    if (!FLEXIO_WaitFlag(&base->SHIFTSTAT, 1UL << tx)) {
+        return STATUS_TIMEOUT;
+    }
+    base->TIMSTAT = 1UL << FLEXIO_CLK_TIMER(channel);
+    if (!FLEXIO_WaitFlag(&base->TIMSTAT, 1UL << FLEXIO_CLK_TIMER(channel))) {
+        return STATUS_TIMEOUT;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+status_t FLEXIO_UartReceiveBlocking(uint8_t channel, uint8_t *data, uint32_t size)
+{
+    FLEXIO_Type *base = FLEXIO;
+    uint32_t rx = FLEXIO_RX_SHIFTER(channel);
+    uint32_t timeout;
+    uint32_t i;
+
+    if (!FLEXIO_IsValidChannel(channel) || (data == NULL) ||
+        (s_flexioState[channel].mode != FLEXIO_MODE_UART)) {
+        return STATUS_ERROR;
+    }
+
+    if (s_flexioState[channel].busy) {
+        return STATUS_BUSY;
+    }
+
+    for (i = 0U; i < size; i++) {
+        timeout = FLEXIO_TIMEOUT_COUNT;
+        while ((base->SHIFTSTAT & (1UL << rx)) == 0U) {
+            if (--timeout == 0U) {
+                return STATUS_TIMEOUT;
+            }
+        }
+
+        /* SHIFTERR: bad stop bit (framing) or overrun */
+        if ((base->SHIFTERR & (1UL << rx)) != 0U) {
+            base->SHIFTERR = 1UL << rx;
+            (void)base->SHIFTBUF[rx];
+            return STATUS_ERROR;
+        }
+
+        /* The 8 data bits are in SHIFTBUF[31:24] */
+        data[i] = (uint8_t)(base->SHIFTBUF[rx] >> 24U);
+    }
+
+    return STATUS_SUCCESS;
+}
+
+status_t FLEXIO_UartSendDma(uint8_t channel, const uint8_t *data, uint16_t size,
+                            const flexio_dma_config_t *dma)
+{
+    FLEXIO_Type *base = FLEXIO;
+    flexio_state_t *state;
+    dma_channel_config_t config;
+    uint32_t tx = FLEXIO_TX_SHIFTER(channel);
+    status_t status;
+
+    if (!FLEXIO_IsValidChannel(channel) || (data == NULL) || (dma == NULL) ||
+        (size == 0U) || (size > FLEXIO_DMA_MAX_SIZE)) {
+        return STATUS_ERROR;
+    }
+
+    state = &s_flexioState[channel];
+    status = FLEXIO_Claim(state, FLEXIO_MODE_UART);
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+
+    state->txChannel = dma->txChannel;
+    state->callback = dma->callback;
+    state->userData = dma->userData;
+
+    FLEXIO_DmaBaseConfig(&config, dma->txChannel, FLEXIO_DmaSource(tx), size);
+    config.transferType = DMA_TRANSFER_MEM_TO_PERIPH;
+    config.priority = DMA_PRIORITY_NORMAL;
+    config.sourceAddr = (uint32_t)data;
+    config.sourceOffset = 1;
+    config.destAddr = (uint32_t)&base->SHIFTBUF[tx];
+    config.enableInterrupt = true;
+
+    if ((DMA_ConfigChannel(&config) != STATUS_SUCCESS) ||
+        (DMA_InstallCallback(dma->txChannel, FLEXIO_DmaComplete, state) != STATUS_SUCCESS) ||
+        (DMA_StartChannel(dma->txChannel) != STATUS_SUCCESS)) {
+        (void)DMA_StopChannel(dma->txChannel);
+        state->busy = false;
+        return STATUS_ERROR;
+    }
+
+    state->txDma = true;
+    base->SHIFTSDEN |= 1UL << tx;
+
+    return STATUS_SUCCESS;
+}
+
+status_t FLEXIO_UartReceiveDma(uint8_t channel, uint8_t *data, uint16_t size,
+                               const flexio_dma_config_t *dma)
+{
+    FLEXIO_Type *base = FLEXIO;
+    flexio_state_t *state;
+    dma_channel_config_t config;
+    uint32_t rx = FLEXIO_RX_SHIFTER(channel);
+    status_t status;
+
+    if (!FLEXIO_IsValidChannel(channel) || (data == NULL) || (dma == NULL) ||
+        (size == 0U) || (size > FLEXIO_DMA_MAX_SIZE)) {
+        return STATUS_ERROR;
+    }
+
+    state = &s_flexioState[channel];
+    status = FLEXIO_Claim(state, FLEXIO_MODE_UART);
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+
+    state->rxChannel = dma->rxChannel;
+    state->callback = dma->callback;
+    state->userData = dma->userData;
+
+    /* High byte of SHIFTBUF: 8 data bits */
+    FLEXIO_DmaBaseConfig(&config, dma->rxChannel, FLEXIO_DmaSource(rx), size);
+    config.transferType = DMA_TRANSFER_PERIPH_TO_MEM;
+    config.priority = DMA_PRIORITY_HIGH;
+    config.sourceAddr = (uint32_t)&base->SHIFTBUF[rx] + 3U;
+    config.destAddr = (uint32_t)data;
+    config.destOffset = 1;
+    config.enableInterrupt = true;
+
+    if ((DMA_ConfigChannel(&config) != STATUS_SUCCESS) ||
+        (DMA_InstallCallback(dma->rxChannel, FLEXIO_DmaComplete, state) != STATUS_SUCCESS) ||
+        (DMA_StartChannel(dma->rxChannel) != STATUS_SUCCESS)) {
+        (void)DMA_StopChannel(dma->rxChannel);
+        state->busy = false;
+        return STATUS_ERROR;
+    }
+
+    base->SHIFTERR = 1UL << rx;
+    state->rxDma = true;
+    base->SHIFTSDEN |= 1UL << rx;
+
+    return STATUS_SUCCESS;
+}
+
+/*******************************************************************************
+ * SPI Master
+ ******************************************************************************/
+
+status_t FLEXIO_SpiMasterInit(uint8_t channel, const flexio_spi_config_t *config)
+{
+    FLEXIO_Type *base = FLEXIO;
+    flexio_state_t *state;
+    uint32_t tx = FLEXIO_TX_SHIFTER(channel);
+    uint32_t rx = FLEXIO_RX_SHIFTER(channel);
+    uint32_t sckTimer = FLEXIO_CLK_TIMER(channel);
+    uint32_t csTimer = FLEXIO_AUX_TIMER(channel);
+    uint8_t divider;
+
+    if (!FLEXIO_IsValidChannel(channel) || (config == NULL) ||
+        !FLEXIO_IsValidPin(config->mosiPin) || !FLEXIO_IsValidPin(config->misoPin) ||
+        !FLEXIO_IsValidPin(config->sckPin) ||
+        ((config->csPin != FLEXIO_PIN_NONE) && !FLEXIO_IsValidPin(config->csPin)) ||
+        !FLEXIO_CalcDivider(config->baudRate, &divider)) {
+        return STATUS_ERROR;
+    }
+
+    state = &s_flexioState[channel];
+    if (state->busy) {
+        return STATUS_BUSY;
+    }
+
+    FLEXIO_ResetChannel(channel);
+
+    /*
+     * CPHA = 0: data out on the second edge (falling when CPOL = 0), sampled on the first,
+     *           the first bit is ready when the timer is enabled.
+     * CPHA = 1: data out on the first edge, sampled on the second.
+     */
+    base->SHIFTCFG[tx] = FLEXIO_SHIFTCFG_SSTART(config->cpha ? FLEXIO_SHIFTER_START_NONE_SHIFT :
+                                                               FLEXIO_SHIFTER_START_NONE);
+    base->SHIFTCTL[tx] = FLEXIO_SHIFTCTL_TIMSEL(sckTimer) |
+                         FLEXIO_SHIFTCTL_TIMPOL(config->cpha ? 0U : 1U) |
+                         FLEXIO_SHIFTCTL_PINCFG(FLEXIO_PIN_CONFIG_OUTPUT) |
+                         FLEXIO_SHIFTCTL_PINSEL(config->mosiPin) |
+                         FLEXIO_SHIFTCTL_SMOD(FLEXIO_SHIFTER_MODE_TRANSMIT);
+
+    base->SHIFTCFG[rx] = 0U;
+    base->SHIFTCTL[rx] = FLEXIO_SHIFTCTL_TIMSEL(sckTimer) |
+                         FLEXIO_SHIFTCTL_TIMPOL(config->cpha ? 1U : 0U) |
+                         FLEXIO_SHIFTCTL_PINSEL(config->misoPin) |
+                         FLEXIO_SHIFTCTL_SMOD(FLEXIO_SHIFTER_MODE_RECEIVE);
+
+    /* SCK timer: 8 bits each time the TX shifter has data, pin polarity = CPOL */
+    base->TIMCMP[sckTimer] = FLEXIO_BAUD_CMP(FLEXIO_FRAME_EDGES, divider);
+    base->TIMCFG[sckTimer] = FLEXIO_TIMCFG_TSTART(1U) |
+                             FLEXIO_TIMCFG_TSTOP(config->cpha ? FLEXIO_TIMER_STOP_NONE :
+                                                                FLEXIO_TIMER_STOP_DISABLE) |
+                             FLEXIO_TIMCFG_TIMENA(FLEXIO_TIMER_ENABLE_TRIGGER_HIGH) |
+                             FLEXIO_TIMCFG_TIMDIS(FLEXIO_TIMER_DISABLE_COMPARE) |
+                             FLEXIO_TIMCFG_TIMOUT(FLEXIO_TIMER_OUT_ZERO);
+    base->TIMCTL[sckTimer] = FLEXIO_TIMCTL_TRGSEL(FLEXIO_TRIGGER_SHIFTER(tx)) |
+                             FLEXIO_TIMCTL_TRGPOL(1U) | FLEXIO_TIMCTL_TRGSRC(1U) |
+                             FLEXIO_TIMCTL_PINCFG(FLEXIO_PIN_CONFIG_OUTPUT) |
+                             FLEXIO_TIMCTL_PINSEL(config->sckPin) |
+                             FLEXIO_TIMCTL_PINPOL(config->cpol ? 1U : 0U) |
+                             FLEXIO_TIMCTL_TIMOD(FLEXIO_TIMER_MODE_8BIT_BAUD);
+
+    if (config->csPin != FLEXIO_PIN_NONE) {
+        /* CS timer: active low while the SCK timer (timer N - 1) runs */
+        base->TIMCMP[csTimer] = 0xFFFFU;
+        base->TIMCFG[csTimer] = FLEXIO_TIMCFG_TIMENA(FLEXIO_TIMER_ENABLE_PREV_TIMER) |
+                                FLEXIO_TIMCFG_TIMDIS(FLEXIO_TIMER_DISABLE_PREV_TIMER) |
+                                FLEXIO_TIMCFG_TIMOUT(FLEXIO_TIMER_OUT_ONE);
+        base->TIMCTL[csTimer] = FLEXIO_TIMCTL_PINCFG(FLEXIO_PIN_CONFIG_OUTPUT) |
+                                FLEXIO_TIMCTL_PINSEL(config->csPin) | FLEXIO_TIMCTL_PINPOL(1U) |
+                                FLEXIO_TIMCTL_TIMOD(FLEXIO_TIMER_MODE_16BIT);
+    }
+
+    state->divider = divider;
+    state->mode = FLEXIO_MODE_SPI;
+
+    return STATUS_SUCCESS;
+}
+
+status_t FLEXIO_SpiTransferBlocking(uint8_t channel, const uint8_t *txData, uint8_t *rxData, uint32_t size)
+{
+    FLEXIO_Type *base = FLEXIO;
+    uint32_t tx = FLEXIO_TX_SHIFTER(channel);
+    uint32_t rx = FLEXIO_RX_SHIFTER(channel);
+    uint32_t i;
+    uint8_t value;
+
+    if (!FLEXIO_IsValidChannel(channel) || (s_flexioState[channel].mode != FLEXIO_MODE_SPI)) {
+        return STATUS_ERROR;
+    }
+
+    if (s_flexioState[channel].busy) {
+        return STATUS_BUSY;
+    }
+
+    if (size == 0U) {
+        return STATUS_SUCCESS;
+    }
+
+    (void)base->SHIFTBUF[rx];
+    base->SHIFTERR = FLEXIO_SHIFTER_BITS(channel);
+
+    /* MSB first: write through the bit-swapped view, byte in [31:24] */
+    base->SHIFTBUFBIS[tx] = (uint32_t)((txData != NULL) ? txData[0] : 0U) << 24U;
+
+    /* At most 2 frames in flight (buffer + shifter): RX never overruns */
+    for (i = 0U; i < size; i++) {
+        if ((i + 1U) < size) {
+            if (!FLEXIO_WaitFlag(&base->SHIFTSTAT, 1UL << tx)) {
+                return STATUS_TIMEOUT;
+            }
+            base->SHIFTBUFBIS[tx] = (uint32_t)((txData != NULL) ? txData[i + 1U] : 0U) << 24U;
+        }
+
+        if (!FLEXIO_WaitFlag(&base->SHIFTSTAT, 1UL << rx)) {
+            return STATUS_TIMEOUT;
+        }
+        value = (uint8_t)(base->SHIFTBUFBIS[rx] & 0xFFU);
+        if (rxData != NULL) {
+            rxData[i] = value;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+status_t FLEXIO_SpiTransferDma(uint8_t channel, const uint8_t *txData, uint8_t *rxData, uint16_t size,
+                               const flexio_dma_config_t *dma)
+{
+    FLEXIO_Type *base = FLEXIO;
+    flexio_state_t *state;
+    dma_channel_config_t txConfig;
+    dma_channel_config_t rxConfig;
+    uint32_t tx = FLEXIO_TX_SHIFTER(channel);
+    uint32_t rx = FLEXIO_RX_SHIFTER(channel);
+    status_t status;
+
+    if (!FLEXIO_IsValidChannel(channel) || (dma == NULL) || (size == 0U) ||
+        (size > FLEXIO_DMA_MAX_SIZE) || (dma->txChannel == dma->rxChannel)) {
+        return STATUS_ERROR;
+    }
+
+    state = &s_flexioState[channel];
+    status = FLEXIO_Claim(state, FLEXIO_MODE_SPI);
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+
+    state->txChannel = dma->txChannel;
+    state->rxChannel = dma->rxChannel;
+    state->callback = dma->callback;
+    state->userData = dma->userData;
+
+    /* Byte written to SHIFTBUFBIS[31:24]: MSB first */
+    FLEXIO_DmaBaseConfig(&txConfig, dma->txChannel, FLEXIO_DmaSource(tx), size);
+    txConfig.transferType = DMA_TRANSFER_MEM_TO_PERIPH;
+    txConfig.priority = DMA_PRIORITY_NORMAL;
+    txConfig.sourceAddr = (txData != NULL) ? (uint32_t)txData : (uint32_t)&s_dummyTx;
+    txConfig.sourceOffset = (txData != NULL) ? 1 : 0;
+    txConfig.destAddr = (uint32_t)&base->SHIFTBUFBIS[tx] + 3U;
+
+    /* RX has priority over TX, completion comes from the RX channel */
+    FLEXIO_DmaBaseConfig(&rxConfig, dma->rxChannel, FLEXIO_DmaSource(rx), size);
+    rxConfig.transferType = DMA_TRANSFER_PERIPH_TO_MEM;
+    rxConfig.priority = DMA_PRIORITY_HIGH;
+    rxConfig.sourceAddr = (uint32_t)&base->SHIFTBUFBIS[rx];
+    rxConfig.destAddr = (rxData != NULL) ? (uint32_t)rxData : (uint32_t)&s_dummyRx;
+    rxConfig.destOffset = (rxData != NULL) ? 1 : 0;
+    rxConfig.enableInterrupt = true;
+
+    if ((DMA_ConfigChannel(&txConfig) != STATUS_SUCCESS) ||
+        (DMA_ConfigChannel(&rxConfig) != STATUS_SUCCESS) ||
+        (DMA_InstallCallback(dma->rxChannel, FLEXIO_DmaComplete, state) != STATUS_SUCCESS) ||
+        (DMA_StartChannel(dma->rxChannel) != STATUS_SUCCESS) ||
+        (DMA_StartChannel(dma->txChannel) != STATUS_SUCCESS)) {
+        (void)DMA_StopChannel(dma->txChannel);
+        (void)DMA_StopChannel(dma->rxChannel);
+        state->busy = false;
+        return STATUS_ERROR;
+    }
+
+    (void)base->SHIFTBUF[rx];
+    base->SHIFTERR = FLEXIO_SHIFTER_BITS(channel);
+
+    state->txDma = true;
+    state->rxDma = true;
+    base->SHIFTSDEN |= FLEXIO_SHIFTER_BITS(channel);
+
+    return STATUS_SUCCESS;
+}
+
+/*******************************************************************************
+ * I2C Master
+ ******************************************************************************/
+
+status_t FLEXIO_I2cMasterInit(uint8_t channel, const flexio_i2c_config_t *config)
+{
+    FLEXIO_Type *base = FLEXIO;
+    flexio_state_t *state;
+    uint32_t tx = FLEXIO_TX_SHIFTER(channel);
+    uint32_t rx = FLEXIO_RX_SHIFTER(channel);
+    uint32_t sclTimer = FLEXIO_CLK_TIMER(channel);
+    uint32_t bitTimer = FLEXIO_AUX_TIMER(channel);
+    uint8_t divider;
+
+    if (!FLEXIO_IsValidChannel(channel) || (config == NULL) ||
+        !FLEXIO_IsValidPin(config->sdaPin) || !FLEXIO_IsValidPin(config->sclPin) ||
+        (config->sdaPin == config->sclPin) || !FLEXIO_CalcDivider(config->baudRate, &divider)) {
+        return STATUS_ERROR;
+    }
+
+    state = &s_flexioState[channel];
+    if (state->busy) {
+        return STATUS_BUSY;
+    }
+
+    FLEXIO_ResetChannel(channel);
+
+    /* Shifters and timers stay disabled until FLEXIO_I2cStart() */
+
+    /* TX shifter: START (start bit 0), SDA open drain, shift theo bit-count timer */
+    base->SHIFTCFG[tx] = FLEXIO_SHIFTCFG_SSTART(FLEXIO_SHIFTER_START_0) |
+                         FLEXIO_SHIFTCFG_SSTOP(FLEXIO_SHIFTER_STOP_1);
+    base->SHIFTCTL[tx] = FLEXIO_SHIFTCTL_TIMSEL(bitTimer) |
+                         FLEXIO_SHIFTCTL_PINCFG(FLEXIO_PIN_CONFIG_OPEN_DRAIN) |
+                         FLEXIO_SHIFTCTL_PINSEL(config->sdaPin) | FLEXIO_SHIFTCTL_PINPOL(1U);
+
+    /* RX shifter: reads SDA back, stop bit 0 = ACK (NACK -> SHIFTERR) */
+    base->SHIFTCFG[rx] = FLEXIO_SHIFTCFG_SSTOP(FLEXIO_SHIFTER_STOP_0);
+    base->SHIFTCTL[rx] = FLEXIO_SHIFTCTL_TIMSEL(bitTimer) | FLEXIO_SHIFTCTL_TIMPOL(1U) |
+                         FLEXIO_SHIFTCTL_PINSEL(config->sdaPin);
+
+    /* SCL timer: open drain, reset when the pin differs from the output (slave clock stretching) */
+    base->TIMCMP[sclTimer] = divider;
+    base->TIMCFG[sclTimer] = FLEXIO_TIMCFG_TSTART(1U) |
+                             FLEXIO_TIMCFG_TSTOP(FLEXIO_TIMER_STOP_DISABLE) |
+                             FLEXIO_TIMCFG_TIMENA(FLEXIO_TIMER_ENABLE_TRIGGER_HIGH) |
+                             FLEXIO_TIMCFG_TIMDIS(FLEXIO_TIMER_DISABLE_COMPARE) |
+                             FLEXIO_TIMCFG_TIMRST(FLEXIO_TIMER_RESET_PIN_EQ_OUTPUT) |
+                             FLEXIO_TIMCFG_TIMOUT(FLEXIO_TIMER_OUT_ZERO);
+    base->TIMCTL[sclTimer] = FLEXIO_TIMCTL_TRGSEL(FLEXIO_TRIGGER_SHIFTER(tx)) |
+                             FLEXIO_TIMCTL_TRGPOL(1U) | FLEXIO_TIMCTL_TRGSRC(1U) |
+                             FLEXIO_TIMCTL_PINCFG(FLEXIO_PIN_CONFIG_OPEN_DRAIN) |
+                             FLEXIO_TIMCTL_PINSEL(config->sclPin);
+
+    /* Bit-count timer: counts edges on the SCL pin, 9 bits per frame, shift clock for both shifters */
+    base->TIMCMP[bitTimer] = 0x000FU;
+    base->TIMCFG[bitTimer] = FLEXIO_TIMCFG_TSTART(1U) |
+                             FLEXIO_TIMCFG_TSTOP(FLEXIO_TIMER_STOP_COMPARE) |
+                             FLEXIO_TIMCFG_TIMENA(FLEXIO_TIMER_ENABLE_PREV_TIMER) |
+                             FLEXIO_TIMCFG_TIMDIS(FLEXIO_TIMER_DISABLE_PREV_TIMER) |
+                             FLEXIO_TIMCFG_TIMDEC(FLEXIO_TIMER_DEC_PIN) |
+                             FLEXIO_TIMCFG_TIMOUT(FLEXIO_TIMER_OUT_ONE);
+    base->TIMCTL[bitTimer] = FLEXIO_TIMCTL_PINSEL(config->sclPin) | FLEXIO_TIMCTL_PINPOL(1U);
+
+    state->divider = divider;
+    state->mode = FLEXIO_MODE_I2C;
+
+    return STATUS_SUCCESS;
+}
+
+status_t FLEXIO_I2cMasterTransferBlocking(uint8_t channel, uint8_t address, uint8_t *data,
+                                          uint8_t size, bool read)
+{
+    flexio_state_t *state;
+    uint32_t timeout = FLEXIO_TIMEOUT_COUNT;
+    uint8_t txCount;
+    uint8_t rxCount;
+    status_t status;
+
+    status = FLEXIO_I2cPrepare(channel, address, data, size, read);
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+
+    state = &s_flexioState[channel];
+    status = FLEXIO_Claim(state, FLEXIO_MODE_I2C);
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+
+    state->async = false;
+    FLEXIO_I2cStart(state);
+
+    for (;;) {
+        txCount = state->txCount;
+        rxCount = state->rxCount;
+
+        if (FLEXIO_I2cStep(state)) {
+            break;
+        }
+
+        if ((txCount != state->txCount) || (rxCount != state->rxCount)) {
+            timeout = FLEXIO_TIMEOUT_COUNT;
+        } else if (--timeout == 0U) {
+            /* SCL held low */
+            FLEXIO_I2cStop(state);
+            state->busy = false;
+            return STATUS_TIMEOUT;
+        }
+    }
+
+    FLEXIO_I2cStop(state);
+    state->busy = false;
+
+    return state->nack ? STATUS_ERROR : STATUS_SUCCESS;
+}
+
+status_t FLEXIO_I2cMasterTransfer(uint8_t channel, uint8_t address, uint8_t *data, uint8_t size,
+                                  bool read, flexio_callback_t callback, void *userData)
+{
+    flexio_state_t *state;
+    status_t status;
+
+    status = FLEXIO_I2cPrepare(channel, address, data, size, read);
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+
+    state = &s_flexioState[channel];
+    status = FLEXIO_Claim(state, FLEXIO_MODE_I2C);
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+
+    state->async = true;
+    state->callback = callback;
+    state->userData = userData;
+
+    FLEXIO_I2cStart(state);
+    FLEXIO->SHIFTSIEN |= FLEXIO_SHIFTER_BITS(channel);
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,281 @@
+/**
+ * @file    flexio.h
+ * @brief   FlexIO serial channel driver (UART, SPI master, I2C master) for S32K144
+ * @details
+ * FlexIO driver provides the following APIs:
+ * - Up to 2 extra serial channels on top of LPUART / LPSPI / LPI2C, timed by
+ *   FlexIO shifters and timers instead of bit-banged GPIO
+ * - UART: 8N1 TX / RX, blocking or eDMA
+ * - SPI master: 8-bit frames, MSB first, CPOL / CPHA, optional CS pin,
+ *   blocking or full-duplex eDMA
+ * - I2C master: 7-bit address, up to FLEXIO_I2C_MAX_SIZE bytes per transfer,
+ *   ACK / NACK check, clock stretching, blocking or interrupt driven
+ *
+ * Each channel owns one pair of shifters and one pair of timers:
+ * @verbatim
+ *   Channel  Shifters  Timers   UART        SPI           I2C
+ *   0        0, 1      0, 1     TX / RX     TX / RX,      TX / RX,
+ *   1        2, 3      2, 3     (+ timers)  SCK / CS      SCL / bit count
+ * @endverbatim
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ *
+ * @note
+ * - Select the FlexIO functional clock (PCC PCS) before FLEXIO_Init(); the
+ *   bit clock is derived with an 8-bit divider: baud >= clock / 512
+ * - Pins are FlexIO pins (FXIO_D0..D7), mux them with PORT first
+ * - One transfer at a time per channel
+ *
+ * @par Change Log:
+ * - Version 1.0 (14/10/2026): Initial FlexIO UART / SPI / I2C driver
+ */
+
+#ifndef FLEXIO_H
+#define FLEXIO_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "flexio_reg.h"
+#include "status.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @defgroup FLEXIO_Definitions FlexIO Definitions
+ * @{
+ */
+
+/** @brief Number of serial channels (2 shifters + 2 timers each) */
+#define FLEXIO_CHANNEL_COUNT    (2U)
+
+/** @brief No pin (SPI CS not driven by FlexIO) */
+#define FLEXIO_PIN_NONE         (0xFFU)
+
+/** @brief Maximum I2C payload per transfer (SCL edge count is 8 bits) */
+#define FLEXIO_I2C_MAX_SIZE     (13U)
+
+/** @brief Maximum bytes per DMA transfer (CITER without channel linking) */
+#define FLEXIO_DMA_MAX_SIZE     (0x7FFFU)
+
+/** @brief Blocking transfer timeout (in loop iterations without progress) */
+#define FLEXIO_TIMEOUT_COUNT    (100000UL)
+
+/**
+ * @brief Transfer completion callback (DMA or interrupt context)
+ * @param channel  FlexIO channel
+ * @param status   STATUS_SUCCESS, STATUS_ERROR (I2C NACK / bus error)
+ * @param userData Pointer to user data
+ */
+typedef void (*flexio_callback_t)(uint8_t channel, status_t status, void *userData);
+
+/**
+ * @brief UART channel configuration (8N1)
+ */
+typedef struct {
+    uint32_t baudRate;                  /**< Bit rate in Hz */
+    uint8_t txPin;                      /**< FlexIO pin of TX, FLEXIO_PIN_NONE = RX only */
+    uint8_t rxPin;                      /**< FlexIO pin of RX, FLEXIO_PIN_NONE = TX only */
+} flexio_uart_config_t;
+
+/**
+ * @brief SPI master channel configuration (8-bit frames, MSB first)
+ */
+typedef struct {
+    uint32_t baudRate;                  /**< SCK frequency in Hz */
+    bool cpol;                          /**< SCK idle high */
+    bool cpha;                          /**< Sample on the second SCK edge */
+    uint8_t mosiPin;                    /**< FlexIO pin of MOSI */
+    uint8_t misoPin;                    /**< FlexIO pin of MISO */
+    uint8_t sckPin;                     /**< FlexIO pin of SCK */
+    uint8_t csPin;                      /**< FlexIO pin of CS (active low, per frame), FLEXIO_PIN_NONE = GPIO CS */
+} flexio_spi_config_t;
+
+/**
+ * @brief I2C master channel configuration
+ */
+typedef struct {
+    uint32_t baudRate;                  /**< SCL frequency in Hz (100 / 400 kHz) */
+    uint8_t sdaPin;                     /**< FlexIO pin of SDA (external pull-up) */
+    uint8_t sclPin;                     /**< FlexIO pin of SCL (external pull-up) */
+} flexio_i2c_config_t;
+
+/**
+ * @brief eDMA channels of a transfer
+ */
+typedef struct {
+    uint8_t txChannel;                  /**< eDMA channel feeding the TX shifter */
+    uint8_t rxChannel;                  /**< eDMA channel draining the RX shifter */
+    flexio_callback_t callback;         /**< Called when the transfer completes (NULL = none) */
+    void *userData;                     /**< Passed to callback */
+} flexio_dma_config_t;
+
+/** @} */ /* End of FLEXIO_Definitions */
+
+/*******************************************************************************
+ * API Function Prototypes
+ ******************************************************************************/
+
+/**
+ * @defgroup FLEXIO_Functions FlexIO Functions
+ * @{
+ */
+
+/**
+ * @brief Enable the FlexIO clock gate and reset the module
+ * @return STATUS_SUCCESS, STATUS_ERROR if the functional clock is off
+ */
+status_t FLEXIO_Init(void);
+
+/**
+ * @brief Disable the module and gate its clock
+ * @return STATUS_BUSY if a channel has a transfer in progress
+ */
+status_t FLEXIO_Deinit(void);
+
+/**
+ * @brief Install FLEXIO_IRQHandler() in the RAM vector table
+ * @return STATUS_SUCCESS, STATUS_ERROR if the vector cannot be installed
+ */
+status_t FLEXIO_InstallIrqHandler(void);
+
+/**
+ * @brief FlexIO interrupt handler (I2C interrupt-driven transfers)
+ */
+void FLEXIO_IRQHandler(void);
+
+/**
+ * @brief Check whether a channel has a DMA / interrupt transfer in progress
+ * @param[in] channel FlexIO channel
+ * @return true if busy
+ */
+bool FLEXIO_IsBusy(uint8_t channel);
+
+/**
+ * @brief Abort the DMA / interrupt transfer of a channel
+ * @param[in] channel FlexIO channel
+ * @return STATUS_SUCCESS, STATUS_ERROR on invalid channel
+ */
+status_t FLEXIO_Abort(uint8_t channel);
+
+/**
+ * @brief Configure a channel as UART (8N1, LSB first)
+ *
+ * @param[in] channel FlexIO channel
+ * @param[in] config  UART configuration
+ *
+ * @return STATUS_ERROR if parameters are invalid or the baud rate is out of
+ *         the divider range, STATUS_BUSY if a transfer is in progress
+ *
+ * @code
+ * // FlexIO clock SIRCDIV2 = 8 MHz, 115200 bit/s on FXIO_D0 (TX) / D1 (RX)
+ * flexio_uart_config_t uart = { 115200U, 0U, 1U };
+ * FLEXIO_UartInit(0U, &uart);
+ * @endcode
+ */
+status_t FLEXIO_UartInit(uint8_t channel, const flexio_uart_config_t *config);
+
+/**
+ * @brief Send bytes, return when the last stop bit is on the line
+ * @return STATUS_TIMEOUT if the shifter stalls
+ */
+status_t FLEXIO_UartSendBlocking(uint8_t channel, const uint8_t *data, uint32_t size);
+
+/**
+ * @brief Receive bytes (polling)
+ * @return STATUS_ERROR on framing error / overrun, STATUS_TIMEOUT if nothing arrives
+ */
+status_t FLEXIO_UartReceiveBlocking(uint8_t channel, uint8_t *data, uint32_t size);
+
+/**
+ * @brief Send bytes with eDMA (dma->txChannel); callback when the last byte
+ *        has been loaded into the shifter
+ * @return STATUS_BUSY if a transfer is in progress
+ * @note DMA_Init() must have been called; data must stay valid until completion
+ */
+status_t FLEXIO_UartSendDma(uint8_t channel, const uint8_t *data, uint16_t size,
+                            const flexio_dma_config_t *dma);
+
+/**
+ * @brief Receive bytes with eDMA (dma->rxChannel); callback after size bytes
+ * @return STATUS_BUSY if a transfer is in progress
+ */
+status_t FLEXIO_UartReceiveDma(uint8_t channel, uint8_t *data, uint16_t size,
+                               const flexio_dma_config_t *dma);
+
+/**
+ * @brief Configure a channel as SPI master
+ *
+ * @param[in] channel FlexIO channel
+ * @param[in] config  SPI configuration
+ *
+ * @return STATUS_ERROR if parameters are invalid or the SCK rate is out of
+ *         the divider range, STATUS_BUSY if a transfer is in progress
+ */
+status_t FLEXIO_SpiMasterInit(uint8_t channel, const flexio_spi_config_t *config);
+
+/**
+ * @brief Full-duplex blocking transfer
+ * @param[in]  txData Bytes to send, NULL = send 0x00
+ * @param[out] rxData Received bytes, NULL = discard
+ * @return STATUS_TIMEOUT if the shifters stall
+ */
+status_t FLEXIO_SpiTransferBlocking(uint8_t channel, const uint8_t *txData, uint8_t *rxData, uint32_t size);
+
+/**
+ * @brief Full-duplex eDMA transfer; callback from the RX DMA interrupt
+ * @return STATUS_BUSY if a transfer is in progress
+ * @note DMA_Init() must have been called; buffers must stay valid until completion
+ *
+ * @code
+ * flexio_dma_config_t dma = { 2U, 3U, OnSpiDone, NULL };
+ * FLEXIO_SpiTransferDma(1U, s_tx, s_rx, sizeof(s_rx), &dma);
+ * @endcode
+ */
+status_t FLEXIO_SpiTransferDma(uint8_t channel, const uint8_t *txData, uint8_t *rxData, uint16_t size,
+                               const flexio_dma_config_t *dma);
+
+/**
+ * @brief Configure a channel as I2C master
+ *
+ * @param[in] channel FlexIO channel
+ * @param[in] config  I2C configuration
+ *
+ * @return STATUS_ERROR if parameters are invalid or the SCL rate is out of
+ *         the divider range, STATUS_BUSY if a transfer is in progress
+ */
+status_t FLEXIO_I2cMasterInit(uint8_t channel, const flexio_i2c_config_t *config);
+
+/**
+ * @brief START, address, size bytes, STOP (polling)
+ *
+ * @param[in]     channel FlexIO channel
+ * @param[in]     address 7-bit slave address
+ * @param[in,out] data    Bytes to write / buffer for the bytes read
+ * @param[in]     size    1 - FLEXIO_I2C_MAX_SIZE
+ * @param[in]     read    true = read transfer
+ *
+ * @return STATUS_ERROR on NACK (the STOP is still sent), STATUS_TIMEOUT if the
+ *         bus is held low
+ */
+status_t FLEXIO_I2cMasterTransferBlocking(uint8_t channel, uint8_t address, uint8_t *data,
+                                          uint8_t size, bool read);
+
+/**
+ * @brief Interrupt-driven version of FLEXIO_I2cMasterTransferBlocking()
+ * @details Needs FLEXIO_IRQHandler() installed and FLEXIO_IRQn enabled; the
+ *          callback runs from the FlexIO interrupt after the STOP.
+ * @return STATUS_BUSY if a transfer is in progress
+ */
+status_t FLEXIO_I2cMasterTransfer(uint8_t channel, uint8_t address, uint8_t *data, uint8_t size,
+                                  bool read, flexio_callback_t callback, void *userData);
+
+/** @} */ /* End of FLEXIO_Functions */
+
+#endif /* FLEXIO_H */
@@ -0,0 +1,305 @@
+/*
+** ###################################################################
+**     Processor:           S32K144
+**     Reference manual:    S32K1XXRM Rev. 12.1, 02/2020
+**     Version:             rev. 1.0, 2026-10-14
+**
+**     Abstract:
+**         FlexIO (Flexible I/O) Register Definitions
+**
+**     Copyright (c) 2026
+**     All rights reserved.
+**
+** ###################################################################
+*/
+
+/**
+ * @file    flexio_reg.h
+ * @brief   FlexIO Register Definitions for S32K144
+ * @details This file contains register definitions and bit field macros for the FlexIO module.
+ *          FlexIO has 4 shifters, 4 timers and 8 pins that are combined to emulate serial
+ *          protocols (UART, SPI, I2C) in hardware.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ *
+ * @note    Refer to S32K1xx Reference Manual Chapter 46 (FlexIO) for detailed information
+ * @warning Clock must be enabled via PCC before using FlexIO module
+ *
+ * @par Change Log:
+ * - Version 1.0 (Oct 14, 2026): Initial FlexIO register definitions
+ */
+
+#ifndef FLEXIO_REG_H
+#define FLEXIO_REG_H
+
+#include <stdint.h>
+#include "def_reg.h"
+/*******************************************************************************
+ * FLEXIO - Register Layout Typedef
+ ******************************************************************************/
+
+/** Number of shifters / timers / pins */
+#define FLEXIO_SHIFTER_COUNT                     (4u)
+#define FLEXIO_TIMER_COUNT                       (4u)
+#define FLEXIO_PIN_COUNT                         (8u)
+
+/**
+ * @brief FlexIO Module Register Structure
+ * @details Complete register map for FlexIO module including:
+ *          - CTRL / PIN: module enable, software reset, pin input state
+ *          - SHIFTSTAT / SHIFTERR / TIMSTAT: W1C status flags
+ *          - SHIFTSIEN / SHIFTEIEN / TIMIEN / SHIFTSDEN: interrupt and DMA enables
+ *          - SHIFTCTL / SHIFTCFG: shifter mode, pin, timer select, start / stop bits
+ *          - SHIFTBUF (normal, bit / byte / bit-byte swapped views)
+ *          - TIMCTL / TIMCFG / TIMCMP: timer mode, trigger, pin, enable / disable conditions
+ */
+typedef struct {
+    __I  uint32_t VERID;                             /**< Version ID Register, offset: 0x0 */
+    __I  uint32_t PARAM;                             /**< Parameter Register, offset: 0x4 */
+    __IO uint32_t CTRL;                              /**< FlexIO Control Register, offset: 0x8 */
+    __I  uint32_t PIN;                               /**< Pin State Register, offset: 0xC */
+    __IO uint32_t SHIFTSTAT;                         /**< Shifter Status Register, offset: 0x10 */
+    __IO uint32_t SHIFTERR;                          /**< Shifter Error Register, offset: 0x14 */
+    __IO uint32_t TIMSTAT;                           /**< Timer Status Register, offset: 0x18 */
+         uint8_t RESERVED_0[4];
+    __IO uint32_t SHIFTSIEN;                         /**< Shifter Status Interrupt Enable, offset: 0x20 */
+    __IO uint32_t SHIFTEIEN;                         /**< Shifter Error Interrupt Enable, offset: 0x24 */
+    __IO uint32_t TIMIEN;                            /**< Timer Interrupt Enable Register, offset: 0x28 */
+         uint8_t RESERVED_1[4];
+    __IO uint32_t SHIFTSDEN;                         /**< Shifter Status DMA Enable, offset: 0x30 */
+         uint8_t RESERVED_2[76];
+    __IO uint32_t SHIFTCTL[FLEXIO_SHIFTER_COUNT];    /**< Shifter Control N Register, offset: 0x80 */
+         uint8_t RESERVED_3[112];
+    __IO uint32_t SHIFTCFG[FLEXIO_SHIFTER_COUNT];    /**< Shifter Configuration N Register, offset: 0x100 */
+         uint8_t RESERVED_4[240];
+    __IO uint32_t SHIFTBUF[FLEXIO_SHIFTER_COUNT];    /**< Shifter Buffer N Register, offset: 0x200 */
+         uint8_t RESERVED_5[112];
+    __IO uint32_t SHIFTBUFBIS[FLEXIO_SHIFTER_COUNT]; /**< Shifter Buffer N Bit Swapped Register, offset: 0x280 */
+         uint8_t RESERVED_6[112];
+    __IO uint32_t SHIFTBUFBYS[FLEXIO_SHIFTER_COUNT]; /**< Shifter Buffer N Byte Swapped Register, offset: 0x300 */
+         uint8_t RESERVED_7[112];
+    __IO uint32_t SHIFTBUFBBS[FLEXIO_SHIFTER_COUNT]; /**< Shifter Buffer N Bit Byte Swapped Register, offset: 0x380 */
+         uint8_t RESERVED_8[112];
+    __IO uint32_t TIMCTL[FLEXIO_TIMER_COUNT];        /**< Timer Control N Register, offset: 0x400 */
+         uint8_t RESERVED_9[112];
+    __IO uint32_t TIMCFG[FLEXIO_TIMER_COUNT];        /**< Timer Configuration N Register, offset: 0x480 */
+         uint8_t RESERVED_10[112];
+    __IO uint32_t TIMCMP[FLEXIO_TIMER_COUNT];        /**< Timer Compare N Register, offset: 0x500 */
+} FLEXIO_Type;
+
+/*******************************************************************************
+ * FLEXIO - Peripheral Instance Base Address
+ ******************************************************************************/
+/** Peripheral FLEXIO base address */
+#define FLEXIO_BASE                              (0x4005A000u)
+/** Peripheral FLEXIO base pointer */
+#define FLEXIO                                   ((FLEXIO_Type *)FLEXIO_BASE)
+
+/*******************************************************************************
+ * FLEXIO_CTRL - Bit Fields
+ ******************************************************************************/
+#define FLEXIO_CTRL_FLEXEN_MASK                  0x1u
+#define FLEXIO_CTRL_FLEXEN_SHIFT                 0u
+#define FLEXIO_CTRL_FLEXEN_WIDTH                 1u
+#define FLEXIO_CTRL_FLEXEN(x)                    (((uint32_t)(((uint32_t)(x))<<FLEXIO_CTRL_FLEXEN_SHIFT))&FLEXIO_CTRL_FLEXEN_MASK)
+#define FLEXIO_CTRL_SWRST_MASK                   0x2u
+#define FLEXIO_CTRL_SWRST_SHIFT                  1u
+#define FLEXIO_CTRL_SWRST_WIDTH                  1u
+#define FLEXIO_CTRL_SWRST(x)                     (((uint32_t)(((uint32_t)(x))<<FLEXIO_CTRL_SWRST_SHIFT))&FLEXIO_CTRL_SWRST_MASK)
+#define FLEXIO_CTRL_FASTACC_MASK                 0x4u
+#define FLEXIO_CTRL_FASTACC_SHIFT                2u
+#define FLEXIO_CTRL_FASTACC_WIDTH                1u
+#define FLEXIO_CTRL_FASTACC(x)                   (((uint32_t)(((uint32_t)(x))<<FLEXIO_CTRL_FASTACC_SHIFT))&FLEXIO_CTRL_FASTACC_MASK)
+#define FLEXIO_CTRL_DBGE_MASK                    0x40000000u
+#define FLEXIO_CTRL_DBGE_SHIFT                   30u
+#define FLEXIO_CTRL_DBGE_WIDTH                   1u
+#define FLEXIO_CTRL_DBGE(x)                      (((uint32_t)(((uint32_t)(x))<<FLEXIO_CTRL_DBGE_SHIFT))&FLEXIO_CTRL_DBGE_MASK)
+#define FLEXIO_CTRL_DOZEN_MASK                   0x80000000u
+#define FLEXIO_CTRL_DOZEN_SHIFT                  31u
+#define FLEXIO_CTRL_DOZEN_WIDTH                  1u
+#define FLEXIO_CTRL_DOZEN(x)                     (((uint32_t)(((uint32_t)(x))<<FLEXIO_CTRL_DOZEN_SHIFT))&FLEXIO_CTRL_DOZEN_MASK)
+
+/*******************************************************************************
+ * FLEXIO_SHIFTCTL - Bit Fields
+ ******************************************************************************/
+#define FLEXIO_SHIFTCTL_SMOD_MASK                0x7u
+#define FLEXIO_SHIFTCTL_SMOD_SHIFT               0u
+#define FLEXIO_SHIFTCTL_SMOD_WIDTH               3u
+#define FLEXIO_SHIFTCTL_SMOD(x)                  (((uint32_t)(((uint32_t)(x))<<FLEXIO_SHIFTCTL_SMOD_SHIFT))&FLEXIO_SHIFTCTL_SMOD_MASK)
+#define FLEXIO_SHIFTCTL_PINPOL_MASK              0x80u
+#define FLEXIO_SHIFTCTL_PINPOL_SHIFT             7u
+#define FLEXIO_SHIFTCTL_PINPOL_WIDTH             1u
+#define FLEXIO_SHIFTCTL_PINPOL(x)                (((uint32_t)(((uint32_t)(x))<<FLEXIO_SHIFTCTL_PINPOL_SHIFT))&FLEXIO_SHIFTCTL_PINPOL_MASK)
+#define FLEXIO_SHIFTCTL_PINSEL_MASK              0x700u
+#define FLEXIO_SHIFTCTL_PINSEL_SHIFT             8u
+#define FLEXIO_SHIFTCTL_PINSEL_WIDTH             3u
+#define FLEXIO_SHIFTCTL_PINSEL(x)                (((uint32_t)(((uint32_t)(x))<<FLEXIO_SHIFTCTL_PINSEL_SHIFT))&FLEXIO_SHIFTCTL_PINSEL_MASK)
+#define FLEXIO_SHIFTCTL_PINCFG_MASK              0x30000u
+#define FLEXIO_SHIFTCTL_PINCFG_SHIFT             16u
+#define FLEXIO_SHIFTCTL_PINCFG_WIDTH             2u
+#define FLEXIO_SHIFTCTL_PINCFG(x)                (((uint32_t)(((uint32_t)(x))<<FLEXIO_SHIFTCTL_PINCFG_SHIFT))&FLEXIO_SHIFTCTL_PINCFG_MASK)
+#define FLEXIO_SHIFTCTL_TIMPOL_MASK              0x800000u
+#define FLEXIO_SHIFTCTL_TIMPOL_SHIFT             23u
+#define FLEXIO_SHIFTCTL_TIMPOL_WIDTH             1u
+#define FLEXIO_SHIFTCTL_TIMPOL(x)                (((uint32_t)(((uint32_t)(x))<<FLEXIO_SHIFTCTL_TIMPOL_SHIFT))&FLEXIO_SHIFTCTL_TIMPOL_MASK)
+#define FLEXIO_SHIFTCTL_TIMSEL_MASK              0x3000000u
+#define FLEXIO_SHIFTCTL_TIMSEL_SHIFT             24u
+#define FLEXIO_SHIFTCTL_TIMSEL_WIDTH             2u
+#define FLEXIO_SHIFTCTL_TIMSEL(x)                (((uint32_t)(((uint32_t)(x))<<FLEXIO_SHIFTCTL_TIMSEL_SHIFT))&FLEXIO_SHIFTCTL_TIMSEL_MASK)
+
+/*******************************************************************************
+ * FLEXIO_SHIFTCFG - Bit Fields
+ ******************************************************************************/
+#define FLEXIO_SHIFTCFG_SSTART_MASK              0x3u
+#define FLEXIO_SHIFTCFG_SSTART_SHIFT             0u
+#define FLEXIO_SHIFTCFG_SSTART_WIDTH             2u
+#define FLEXIO_SHIFTCFG_SSTART(x)                (((uint32_t)(((uint32_t)(x))<<FLEXIO_SHIFTCFG_SSTART_SHIFT))&FLEXIO_SHIFTCFG_SSTART_MASK)
+#define FLEXIO_SHIFTCFG_SSTOP_MASK               0x30u
+#define FLEXIO_SHIFTCFG_SSTOP_SHIFT              4u
+#define FLEXIO_SHIFTCFG_SSTOP_WIDTH              2u
+#define FLEXIO_SHIFTCFG_SSTOP(x)                 (((uint32_t)(((uint32_t)(x))<<FLEXIO_SHIFTCFG_SSTOP_SHIFT))&FLEXIO_SHIFTCFG_SSTOP_MASK)
+#define FLEXIO_SHIFTCFG_INSRC_MASK               0x100u
+#define FLEXIO_SHIFTCFG_INSRC_SHIFT              8u
+#define FLEXIO_SHIFTCFG_INSRC_WIDTH              1u
+#define FLEXIO_SHIFTCFG_INSRC(x)                 (((uint32_t)(((uint32_t)(x))<<FLEXIO_SHIFTCFG_INSRC_SHIFT))&FLEXIO_SHIFTCFG_INSRC_MASK)
+
+/*******************************************************************************
+ * FLEXIO_TIMCTL - Bit Fields
+ ******************************************************************************/
+#define FLEXIO_TIMCTL_TIMOD_MASK                 0x3u
+#define FLEXIO_TIMCTL_TIMOD_SHIFT                0u
+#define FLEXIO_TIMCTL_TIMOD_WIDTH                2u
+#define FLEXIO_TIMCTL_TIMOD(x)                   (((uint32_t)(((uint32_t)(x))<<FLEXIO_TIMCTL_TIMOD_SHIFT))&FLEXIO_TIMCTL_TIMOD_MASK)
+#define FLEXIO_TIMCTL_PINPOL_MASK                0x80u
+#define FLEXIO_TIMCTL_PINPOL_SHIFT               7u
+#define FLEXIO_TIMCTL_PINPOL_WIDTH               1u
+#define FLEXIO_TIMCTL_PINPOL(x)                  (((uint32_t)(((uint32_t)(x))<<FLEXIO_TIMCTL_PINPOL_SHIFT))&FLEXIO_TIMCTL_PINPOL_MASK)
+#define FLEXIO_TIMCTL_PINSEL_MASK                0x700u
+#define FLEXIO_TIMCTL_PINSEL_SHIFT               8u
+#define FLEXIO_TIMCTL_PINSEL_WIDTH               3u
+#define FLEXIO_TIMCTL_PINSEL(x)                  (((uint32_t)(((uint32_t)(x))<<FLEXIO_TIMCTL_PINSEL_SHIFT))&FLEXIO_TIMCTL_PINSEL_MASK)
+#define FLEXIO_TIMCTL_PINCFG_MASK                0x30000u
+#define FLEXIO_TIMCTL_PINCFG_SHIFT               16u
+#define FLEXIO_TIMCTL_PINCFG_WIDTH               2u
+#define FLEXIO_TIMCTL_PINCFG(x)                  (((uint32_t)(((uint32_t)(x))<<FLEXIO_TIMCTL_PINCFG_SHIFT))&FLEXIO_TIMCTL_PINCFG_MASK)
+#define FLEXIO_TIMCTL_TRGSRC_MASK                0x400000u
+#define FLEXIO_TIMCTL_TRGSRC_SHIFT               22u
+#define FLEXIO_TIMCTL_TRGSRC_WIDTH               1u
+#define FLEXIO_TIMCTL_TRGSRC(x)                  (((uint32_t)(((uint32_t)(x))<<FLEXIO_TIMCTL_TRGSRC_SHIFT))&FLEXIO_TIMCTL_TRGSRC_MASK)
+#define FLEXIO_TIMCTL_TRGPOL_MASK                0x800000u
+#define FLEXIO_TIMCTL_TRGPOL_SHIFT               23u
+#define FLEXIO_TIMCTL_TRGPOL_WIDTH               1u
+#define FLEXIO_TIMCTL_TRGPOL(x)                  (((uint32_t)(((uint32_t)(x))<<FLEXIO_TIMCTL_TRGPOL_SHIFT))&FLEXIO_TIMCTL_TRGPOL_MASK)
+#define FLEXIO_TIMCTL_TRGSEL_MASK                0xF000000u
+#define FLEXIO_TIMCTL_TRGSEL_SHIFT               24u
+#define FLEXIO_TIMCTL_TRGSEL_WIDTH               4u
+#define FLEXIO_TIMCTL_TRGSEL(x)                  (((uint32_t)(((uint32_t)(x))<<FLEXIO_TIMCTL_TRGSEL_SHIFT))&FLEXIO_TIMCTL_TRGSEL_MASK)
+
+/*******************************************************************************
+ * FLEXIO_TIMCFG - Bit Fields
+ ******************************************************************************/
+#define FLEXIO_TIMCFG_TSTART_MASK                0x2u
+#define FLEXIO_TIMCFG_TSTART_SHIFT               1u
+#define FLEXIO_TIMCFG_TSTART_WIDTH               1u
+#define FLEXIO_TIMCFG_TSTART(x)                  (((uint32_t)(((uint32_t)(x))<<FLEXIO_TIMCFG_TSTART_SHIFT))&FLEXIO_TIMCFG_TSTART_MASK)
+#define FLEXIO_TIMCFG_TSTOP_MASK                 0x30u
+#define FLEXIO_TIMCFG_TSTOP_SHIFT                4u
+#define FLEXIO_TIMCFG_TSTOP_WIDTH                2u
+#define FLEXIO_TIMCFG_TSTOP(x)                   (((uint32_t)(((uint32_t)(x))<<FLEXIO_TIMCFG_TSTOP_SHIFT))&FLEXIO_TIMCFG_TSTOP_MASK)
+#define FLEXIO_TIMCFG_TIMENA_MASK                0x700u
+#define FLEXIO_TIMCFG_TIMENA_SHIFT               8u
+#define FLEXIO_TIMCFG_TIMENA_WIDTH               3u
+#define FLEXIO_TIMCFG_TIMENA(x)                  (((uint32_t)(((uint32_t)(x))<<FLEXIO_TIMCFG_TIMENA_SHIFT))&FLEXIO_TIMCFG_TIMENA_MASK)
+#define FLEXIO_TIMCFG_TIMDIS_MASK                0x7000u
+#define FLEXIO_TIMCFG_TIMDIS_SHIFT               12u
+#define FLEXIO_TIMCFG_TIMDIS_WIDTH               3u
+#define FLEXIO_TIMCFG_TIMDIS(x)                  (((uint32_t)(((uint32_t)(x))<<FLEXIO_TIMCFG_TIMDIS_SHIFT))&FLEXIO_TIMCFG_TIMDIS_MASK)
+#define FLEXIO_TIMCFG_TIMRST_MASK                0x70000u
+#define FLEXIO_TIMCFG_TIMRST_SHIFT               16u
+#define FLEXIO_TIMCFG_TIMRST_WIDTH               3u
+#define FLEXIO_TIMCFG_TIMRST(x)                  (((uint32_t)(((uint32_t)(x))<<FLEXIO_TIMCFG_TIMRST_SHIFT))&FLEXIO_TIMCFG_TIMRST_MASK)
+#define FLEXIO_TIMCFG_TIMDEC_MASK                0x300000u
+#define FLEXIO_TIMCFG_TIMDEC_SHIFT               20u
+#define FLEXIO_TIMCFG_TIMDEC_WIDTH               2u
+#define FLEXIO_TIMCFG_TIMDEC(x)                  (((uint32_t)(((uint32_t)(x))<<FLEXIO_TIMCFG_TIMDEC_SHIFT))&FLEXIO_TIMCFG_TIMDEC_MASK)
+#define FLEXIO_TIMCFG_TIMOUT_MASK                0x3000000u
+#define FLEXIO_TIMCFG_TIMOUT_SHIFT               24u
+#define FLEXIO_TIMCFG_TIMOUT_WIDTH               2u
+#define FLEXIO_TIMCFG_TIMOUT(x)                  (((uint32_t)(((uint32_t)(x))<<FLEXIO_TIMCFG_TIMOUT_SHIFT))&FLEXIO_TIMCFG_TIMOUT_MASK)
+
+/*******************************************************************************
+ * FLEXIO_TIMCMP - Bit Fields
+ ******************************************************************************/
+#define FLEXIO_TIMCMP_CMP_MASK                   0xFFFFu
+#define FLEXIO_TIMCMP_CMP_SHIFT                  0u
+#define FLEXIO_TIMCMP_CMP_WIDTH                  16u
+#define FLEXIO_TIMCMP_CMP(x)                     (((uint32_t)(((uint32_t)(x))<<FLEXIO_TIMCMP_CMP_SHIFT))&FLEXIO_TIMCMP_CMP_MASK)
+/*******************************************************************************
+ * FLEXIO - Field Values
+ ******************************************************************************/
+/* SHIFTCTL[SMOD] */
+#define FLEXIO_SHIFTER_MODE_DISABLED             0u
+#define FLEXIO_SHIFTER_MODE_RECEIVE              1u
+#define FLEXIO_SHIFTER_MODE_TRANSMIT             2u
+
+/* SHIFTCTL[PINCFG] / TIMCTL[PINCFG] */
+#define FLEXIO_PIN_CONFIG_DISABLED               0u
+#define FLEXIO_PIN_CONFIG_OPEN_DRAIN             1u
+#define FLEXIO_PIN_CONFIG_BIDIR                  2u
+#define FLEXIO_PIN_CONFIG_OUTPUT                 3u
+
+/* SHIFTCFG[SSTART] */
+#define FLEXIO_SHIFTER_START_NONE                0u  /* No start bit, load on enable */
+#define FLEXIO_SHIFTER_START_NONE_SHIFT          1u  /* No start bit, load on first shift */
+#define FLEXIO_SHIFTER_START_0                   2u
+#define FLEXIO_SHIFTER_START_1                   3u
+
+/* SHIFTCFG[SSTOP] */
+#define FLEXIO_SHIFTER_STOP_NONE                 0u
+#define FLEXIO_SHIFTER_STOP_0                    2u
+#define FLEXIO_SHIFTER_STOP_1                    3u
+
+/* TIMCTL[TIMOD] */
+#define FLEXIO_TIMER_MODE_DISABLED               0u
+#define FLEXIO_TIMER_MODE_8BIT_BAUD              1u
+#define FLEXIO_TIMER_MODE_8BIT_PWM               2u
+#define FLEXIO_TIMER_MODE_16BIT                  3u
+
+/* TIMCTL[TRGSEL] internal sources */
+#define FLEXIO_TRIGGER_PIN(n)                    ((uint32_t)(n) << 1u)
+#define FLEXIO_TRIGGER_SHIFTER(n)                (((uint32_t)(n) << 2u) + 1u)
+#define FLEXIO_TRIGGER_TIMER(n)                  (((uint32_t)(n) << 2u) + 3u)
+
+/* TIMCFG[TSTOP] */
+#define FLEXIO_TIMER_STOP_NONE                   0u
+#define FLEXIO_TIMER_STOP_COMPARE                1u
+#define FLEXIO_TIMER_STOP_DISABLE                2u
+
+/* TIMCFG[TIMENA] */
+#define FLEXIO_TIMER_ENABLE_ALWAYS               0u
+#define FLEXIO_TIMER_ENABLE_PREV_TIMER           1u
+#define FLEXIO_TIMER_ENABLE_TRIGGER_HIGH         2u
+#define FLEXIO_TIMER_ENABLE_PIN_RISING           4u
+
+/* TIMCFG[TIMDIS] */
+#define FLEXIO_TIMER_DISABLE_NEVER               0u
+#define FLEXIO_TIMER_DISABLE_PREV_TIMER          1u
+#define FLEXIO_TIMER_DISABLE_COMPARE             2u
+
+/* TIMCFG[TIMRST] */
+#define FLEXIO_TIMER_RESET_NEVER                 0u
+#define FLEXIO_TIMER_RESET_PIN_EQ_OUTPUT         2u
+#define FLEXIO_TIMER_RESET_PIN_RISING            4u
+
+/* TIMCFG[TIMDEC] */
+#define FLEXIO_TIMER_DEC_CLOCK                   0u  /* FlexIO clock, shift clock = timer output */
+#define FLEXIO_TIMER_DEC_PIN                     2u  /* Pin both edges, shift clock = pin */
+
+/* TIMCFG[TIMOUT] */
+#define FLEXIO_TIMER_OUT_ONE                     0u
+#define FLEXIO_TIMER_OUT_ZERO                    1u
+#define FLEXIO_TIMER_OUT_ONE_RESET               2u
+
+#endif /* FLEXIO_REG_H */
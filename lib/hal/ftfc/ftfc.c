@@ -0,0 +1,599 @@
+/**
+ * @file    ftfc.c
+ * @brief   FTFC flash driver implementation for S32K144
+ * @details Every command goes through the same sequence: wait CCIF, clear
+ *          error flags, load FCCOB, launch. The launch and the wait for
+ *          CCIF run from SRAM so no instruction is fetched from a flash
+ *          block while it is being modified.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.2
+ *
+ * @par Change Log:
+ * - Version 1.0 (Oct 14, 2026): Initial version
+ * - Version 1.1 (Oct 14, 2026): Partition, FlexRAM function
+ * - Version 1.2 (Oct 14, 2026): CSEc key size in Program Partition
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "ftfc.h"
+#include "nvic.h"
+#include "lmem.h"
+#include "smc_reg.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Types
+ ******************************************************************************/
+
+/**
+ * @brief Async operation state (shared with FTFC_IRQHandler())
+ */
+typedef struct {
+    volatile bool active;           /**< Operation in progress */
+    volatile status_t lastStatus;   /**< Result of the last async operation */
+    uint32_t cpuAddress;            /**< Start address (cache invalidation) */
+    uint32_t cmdAddress;            /**< Next FTFC address */
+    const uint8_t *data;            /**< Next phrase (program only) */
+    uint32_t remaining;             /**< Bytes left to launch after the running phrase */
+    uint32_t size;                  /**< Total size (cache invalidation) */
+    ftfc_callback_t callback;
+    void *userData;
+} ftfc_async_state_t;
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+
+/**
+ * @brief Placement of the async entry points
+ * @details With P-Flash async enabled the caller runs from SRAM, and the
+ *          code executed after the launch must be in SRAM as well.
+ */
+#if FTFC_ASYNC_PFLASH_ENABLE
+#define FTFC_ASYNC_RAMFUNC  HAL_RAMFUNC
+#else
+#define FTFC_ASYNC_RAMFUNC
+#endif
+
+static ftfc_async_state_t s_ftfcAsync = { false, STATUS_SUCCESS, 0U, 0U, NULL, 0U, 0U, NULL, NULL };
+
+/*******************************************************************************
+ * Private Function Prototypes
+ ******************************************************************************/
+
+HAL_RAMFUNC static uint8_t FTFC_LaunchAndWait(void);
+static bool FTFC_ToCommandAddress(uint32_t address, uint32_t size, uint32_t *cmdAddress, bool *pflash);
+static void FTFC_PrepareCommand(uint8_t command, uint32_t cmdAddress);
+static void FTFC_LoadPhrase(const uint8_t *data);
+static status_t FTFC_RunBlocking(void);
+static status_t FTFC_StatusFromFstat(uint8_t fstat);
+static status_t FTFC_CheckReady(void);
+FTFC_ASYNC_RAMFUNC static status_t FTFC_StartAsync(uint8_t command, uint32_t address, const uint8_t *data,
+                                                   uint32_t size, ftfc_callback_t callback, void *userData);
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Launch the loaded command and wait for CCIF (runs from SRAM)
+ * @return uint8_t FSTAT at completion
+ */
+static uint8_t FTFC_LaunchAndWait(void)
+{
+    FTFC->FSTAT = FTFC_FSTAT_CCIF_MASK;
+    
+    /* Flash is unreadable until CCIF sets: stay in this loop, no timeout */
+    while ((FTFC->FSTAT & FTFC_FSTAT_CCIF_MASK) == 0U) {
+    }
+    
+    return FTFC->FSTAT;
+}
+
+/**
+ * @brief Translate a CPU address range to the FTFC command address
+ */
+static bool FTFC_ToCommandAddress(uint32_t address, uint32_t size, uint32_t *cmdAddress, bool *pflash)
+{
+    if ((address < (FTFC_PFLASH_BASE + FTFC_PFLASH_SIZE)) &&
+        (size <= ((FTFC_PFLASH_BASE + FTFC_PFLASH_SIZE) - address))) {
+        *cmdAddress = address - FTFC_PFLASH_BASE;
+        *pflash = true;
+        return true;
+    }
+    
+    if ((address >= FTFC_DFLASH_BASE) && (address < (FTFC_DFLASH_BASE + FTFC_DFLASH_SIZE)) &&
+        (size <= ((FTFC_DFLASH_BASE + FTFC_DFLASH_SIZE) - address))) {
+        *cmdAddress = FTFC_DFLASH_CMD_BASE + (address - FTFC_DFLASH_BASE);
+        *pflash = false;
+        return true;
+    }
+    
+    return false;
+}
+
+/**
+ * @brief Clear errors and load command code and address
+ */
+static void FTFC_PrepareCommand(uint8_t command, uint32_t cmdAddress)
+{
+    FTFC->FSTAT = FTFC_FSTAT_ERROR_MASK;
+    
+    FTFC->FCCOB[FTFC_FCCOB0] = command;
+    FTFC->FCCOB[FTFC_FCCOB1] = (uint8_t)(cmdAddress >> 16U);
+    FTFC->FCCOB[FTFC_FCCOB2] = (uint8_t)(cmdAddress >> 8U);
+    FTFC->FCCOB[FTFC_FCCOB3] = (uint8_t)cmdAddress;
+}
+
+/**
+ * @brief Load the 8 data bytes of a Program Phrase command
+ */
+static void FTFC_LoadPhrase(const uint8_t *data)
+{
+    uint8_t i;
+    
+    for (i = 0U; i < FTFC_PHRASE_SIZE; i++) {
+        FTFC->FCCOB[FTFC_FCCOB_PHRASE_DATA(i)] = data[i];
+    }
+}
+
+/**
+ * @brief Map FSTAT error flags to status_t
+ */
+static status_t FTFC_StatusFromFstat(uint8_t fstat)
+{
+    if ((fstat & (FTFC_FSTAT_ACCERR_MASK | FTFC_FSTAT_FPVIOL_MASK | FTFC_FSTAT_MGSTAT0_MASK)) != 0U) {
+        return STATUS_ERROR;
+    }
+    
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Common preconditions: no async operation, RUN mode, FTFC idle
+ */
+static status_t FTFC_CheckReady(void)
+{
+    if (s_ftfcAsync.active || ((FTFC->FSTAT & FTFC_FSTAT_CCIF_MASK) == 0U)) {
+        return STATUS_BUSY;
+    }
+    
+    /* Program / erase is not allowed in HSRUN and VLPR */
+    if ((SMC->PMSTAT & SMC_PMSTAT_PMSTAT_MASK) != SMC_PMSTAT_RUN) {
+        return STATUS_ERROR;
+    }
+    
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Run the loaded command to completion
+ */
+static status_t FTFC_RunBlocking(void)
+{
+    uint8_t fstat;
+    bool cacheEnabled;
+#if FTFC_BLOCKING_MASK_IRQ
+    uint32_t primask;
+#endif
+    
+    /* No line fill from the block being modified */
+    cacheEnabled = LMEM_FlashOperationBegin();
+    
+#if FTFC_BLOCKING_MASK_IRQ
+    primask = NVIC_DisableGlobalIRQ();
+#endif
+    
+    fstat = FTFC_LaunchAndWait();
+    
+#if FTFC_BLOCKING_MASK_IRQ
+    NVIC_EnableGlobalIRQ(primask);
+#endif
+    
+    LMEM_FlashOperationEnd(cacheEnabled);
+    
+    return FTFC_StatusFromFstat(fstat);
+}
+
+/**
+ * @brief Validate, load and launch the first command of an async operation
+ */
+static status_t FTFC_StartAsync(uint8_t command, uint32_t address, const uint8_t *data,
+                                uint32_t size, ftfc_callback_t callback, void *userData)
+{
+    uint32_t cmdAddress;
+    bool pflash;
+    status_t status;
+    uint32_t primask;
+    
+    if (!FTFC_ToCommandAddress(address, size, &cmdAddress, &pflash)) {
+        return STATUS_ERROR;
+    }
+    
+#if (FTFC_ASYNC_PFLASH_ENABLE == 0U)
+    if (pflash) {
+        return STATUS_UNSUPPORTED;
+    }
+#endif
+    
+    primask = NVIC_DisableGlobalIRQ();
+    
+    status = FTFC_CheckReady();
+    if (status != STATUS_SUCCESS) {
+        NVIC_EnableGlobalIRQ(primask);
+        return status;
+    }
+    
+    s_ftfcAsync.active = true;
+    s_ftfcAsync.lastStatus = STATUS_BUSY;
+    s_ftfcAsync.cpuAddress = address;
+    s_ftfcAsync.size = size;
+    s_ftfcAsync.callback = callback;
+    s_ftfcAsync.userData = userData;
+    
+    FTFC_PrepareCommand(command, cmdAddress);
+    
+    if (command == FTFC_CMD_PROGRAM_PHRASE) {
+        FTFC_LoadPhrase(data);
+        s_ftfcAsync.cmdAddress = cmdAddress + FTFC_PHRASE_SIZE;
+        s_ftfcAsync.data = data + FTFC_PHRASE_SIZE;
+        s_ftfcAsync.remaining = size - FTFC_PHRASE_SIZE;
+    } else {
+        s_ftfcAsync.data = NULL;
+        s_ftfcAsync.remaining = 0U;
+    }
+    
+    /* CCIE is level sensitive on CCIF: enable after the launch cleared it */
+    FTFC->FSTAT = FTFC_FSTAT_CCIF_MASK;
+    FTFC->FCNFG |= FTFC_FCNFG_CCIE_MASK;
+    
+    /* Inline PRIMASK restore: no call into flash after the launch */
+    __asm volatile ("msr primask, %0" :: "r" (primask) : "memory");
+    
+    return STATUS_SUCCESS;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+/**
+ * @brief Initialize FTFC driver
+ */
+status_t FTFC_Init(void)
+{
+    while ((FTFC->FSTAT & FTFC_FSTAT_CCIF_MASK) == 0U) {
+    }
+    
+    FTFC->FCNFG &= (uint8_t)~(FTFC_FCNFG_CCIE_MASK | FTFC_FCNFG_RDCOLLIE_MASK);
+    FTFC->FSTAT = FTFC_FSTAT_ERROR_MASK;
+    
+    s_ftfcAsync.active = false;
+    s_ftfcAsync.lastStatus = STATUS_SUCCESS;
+    
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Erase sector (blocking)
+ */
+status_t FTFC_EraseSector(uint32_t address)
+{
+    uint32_t cmdAddress;
+    bool pflash;
+    status_t status;
+    
+    if (!FTFC_ToCommandAddress(address, 1U, &cmdAddress, &pflash)) {
+        return STATUS_ERROR;
+    }
+    
+    status = FTFC_CheckReady();
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+    
+    /* Any address in the sector selects it; keep it phrase aligned */
+    FTFC_PrepareCommand(FTFC_CMD_ERASE_SECTOR, cmdAddress & ~(FTFC_PHRASE_SIZE - 1U));
+    
+    return FTFC_RunBlocking();
+}
+
+/**
+ * @brief Program phrases (blocking)
+ */
+status_t FTFC_Program(uint32_t address, const void *data, uint32_t size)
+{
+    const uint8_t *src = (const uint8_t *)data;
+    uint32_t cmdAddress;
+    bool pflash;
+    status_t status;
+    
+    if ((data == NULL) || (size == 0U) ||
+        ((address & (FTFC_PHRASE_SIZE - 1U)) != 0U) || ((size & (FTFC_PHRASE_SIZE - 1U)) != 0U)) {
+        return STATUS_ERROR;
+    }
+    
+    if (!FTFC_ToCommandAddress(address, size, &cmdAddress, &pflash)) {
+        return STATUS_ERROR;
+    }
+    
+    while (size > 0U) {
+        status = FTFC_CheckReady();
+        if (status != STATUS_SUCCESS) {
+            return status;
+        }
+        
+        FTFC_PrepareCommand(FTFC_CMD_PROGRAM_PHRASE, cmdAddress);
+        FTFC_LoadPhrase(src);
+        
+        status = FTFC_RunBlocking();
+        if (status != STATUS_SUCCESS) {
+            return status;
+        }
+        
+        cmdAddress += FTFC_PHRASE_SIZE;
+        src += FTFC_PHRASE_SIZE;
+        size -= FTFC_PHRASE_SIZE;
+    }
+    
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Program check (blocking)
+ */
+status_t FTFC_ProgramCheck(uint32_t address, const void *expected, ftfc_margin_t margin)
+{
+    const uint8_t *bytes = (const uint8_t *)expected;
+    uint32_t cmdAddress;
+    bool pflash;
+    status_t status;
+    uint8_t i;
+    
+    if ((expected == NULL) || (margin == FTFC_MARGIN_NORMAL) ||
+        ((address & (FTFC_WORD_SIZE - 1U)) != 0U)) {
+        return STATUS_ERROR;
+    }
+    
+    if (!FTFC_ToCommandAddress(address, FTFC_WORD_SIZE, &cmdAddress, &pflash)) {
+        return STATUS_ERROR;
+    }
+    
+    status = FTFC_CheckReady();
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+    
+    FTFC_PrepareCommand(FTFC_CMD_PROGRAM_CHECK, cmdAddress);
+    FTFC->FCCOB[FTFC_FCCOB4] = (uint8_t)margin;
+    for (i = 0U; i < FTFC_WORD_SIZE; i++) {
+        FTFC->FCCOB[FTFC_FCCOB_CHECK_DATA(i)] = bytes[i];
+    }
+    
+    return FTFC_RunBlocking();
+}
+
+/**
+ * @brief Verify a range is erased (blocking)
+ */
+status_t FTFC_VerifyErased(uint32_t address, uint32_t size, ftfc_margin_t margin)
+{
+    uint32_t cmdAddress;
+    uint32_t units;
+    bool pflash;
+    status_t status;
+    
+    units = size / FTFC_SECTION_UNIT;
+    
+    if ((units == 0U) || (units > 0xFFFFU) ||
+        ((address & (FTFC_SECTION_UNIT - 1U)) != 0U) || ((size & (FTFC_SECTION_UNIT - 1U)) != 0U)) {
+        return STATUS_ERROR;
+    }
+    
+    if (!FTFC_ToCommandAddress(address, size, &cmdAddress, &pflash)) {
+        return STATUS_ERROR;
+    }
+    
+    status = FTFC_CheckReady();
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+    
+    FTFC_PrepareCommand(FTFC_CMD_READ_1S_SECTION, cmdAddress);
+    FTFC->FCCOB[FTFC_FCCOB4] = (uint8_t)(units >> 8U);
+    FTFC->FCCOB[FTFC_FCCOB5] = (uint8_t)units;
+    FTFC->FCCOB[FTFC_FCCOB6] = (uint8_t)margin;
+    
+    return FTFC_RunBlocking();
+}
+
+/**
+ * @brief Start async sector erase
+ */
+FTFC_ASYNC_RAMFUNC status_t FTFC_EraseSectorAsync(uint32_t address, ftfc_callback_t callback, void *userData)
+{
+    uint32_t sectorSize = (address >= FTFC_DFLASH_BASE) ? FTFC_DFLASH_SECTOR_SIZE : FTFC_PFLASH_SECTOR_SIZE;
+    
+    /* Sector start: the whole sector is invalidated in the cache at completion */
+    address &= ~(sectorSize - 1U);
+    
+    return FTFC_StartAsync(FTFC_CMD_ERASE_SECTOR, address, NULL, sectorSize, callback, userData);
+}
+
+/**
+ * @brief Start async program
+ */
+FTFC_ASYNC_RAMFUNC status_t FTFC_ProgramAsync(uint32_t address, const void *data, uint32_t size,
+                           ftfc_callback_t callback, void *userData)
+{
+    if ((data == NULL) || (size == 0U) ||
+        ((address & (FTFC_PHRASE_SIZE - 1U)) != 0U) || ((size & (FTFC_PHRASE_SIZE - 1U)) != 0U)) {
+        return STATUS_ERROR;
+    }
+    
+    return FTFC_StartAsync(FTFC_CMD_PROGRAM_PHRASE, address, (const uint8_t *)data,
+                           size, callback, userData);
+}
+
+/**
+ * @brief Check async busy state
+ */
+bool FTFC_IsBusy(void)
+{
+    return s_ftfcAsync.active;
+}
+
+/**
+ * @brief Last async status
+ */
+status_t FTFC_GetAsyncStatus(void)
+{
+    return s_ftfcAsync.lastStatus;
+}
+
+/**
+ * @brief Program FlexNVM partition
+ */
+status_t FTFC_ProgramPartition(uint8_t eeeSizeCode, uint8_t departCode, bool loadFlexRamOnReset)
+{
+    status_t status;
+    
+    status = FTFC_CheckReady();
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+    
+    /* FCCOB1 = CSEc key size, FCCOB2 = SFE (off), FCCOB3 bit 0 = 1: skip FlexRAM load */
+    FTFC_PrepareCommand(FTFC_CMD_PROGRAM_PARTITION,
+                        ((uint32_t)FTFC_CSEC_KEY_SIZE << 16U) | (loadFlexRamOnReset ? 0x000000UL : 0x000001UL));
+    FTFC->FCCOB[FTFC_FCCOB4] = eeeSizeCode;
+    FTFC->FCCOB[FTFC_FCCOB5] = departCode;
+    
+    return FTFC_RunBlocking();
+}
+
+/**
+ * @brief Read FlexNVM partition
+ */
+status_t FTFC_GetPartition(uint8_t *eeeSizeCode, uint8_t *departCode)
+{
+    uint32_t fcfg1 = FTFC_SIM_FCFG1;
+    
+    if ((eeeSizeCode == NULL) || (departCode == NULL)) {
+        return STATUS_ERROR;
+    }
+    
+    *eeeSizeCode = (uint8_t)((fcfg1 & FTFC_SIM_FCFG1_EEERAMSIZE_MASK) >> FTFC_SIM_FCFG1_EEERAMSIZE_SHIFT);
+    *departCode = (uint8_t)((fcfg1 & FTFC_SIM_FCFG1_DEPART_MASK) >> FTFC_SIM_FCFG1_DEPART_SHIFT);
+    
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Set FlexRAM function
+ */
+status_t FTFC_SetFlexRamFunction(uint8_t function)
+{
+    uint8_t readyMask = (function == FTFC_FLEXRAM_EEE) ? FTFC_FCNFG_EEERDY_MASK : FTFC_FCNFG_RAMRDY_MASK;
+    status_t status;
+    
+    if ((function != FTFC_FLEXRAM_EEE) && (function != FTFC_FLEXRAM_RAM)) {
+        return STATUS_ERROR;
+    }
+    
+    status = FTFC_CheckReady();
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+    
+    /* FlexRAM function code sits in FCCOB1 (address byte 2 of the common layout) */
+    FTFC_PrepareCommand(FTFC_CMD_SET_FLEXRAM, (uint32_t)function << 16U);
+    
+    status = FTFC_RunBlocking();
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+    
+    return ((FTFC->FCNFG & readyMask) != 0U) ? STATUS_SUCCESS : STATUS_ERROR;
+}
+
+/**
+ * @brief EEE ready state
+ */
+bool FTFC_IsEeeReady(void)
+{
+    return ((FTFC->FCNFG & FTFC_FCNFG_EEERDY_MASK) != 0U);
+}
+
+/**
+ * @brief FTFC idle state
+ */
+bool FTFC_IsIdle(void)
+{
+    return ((FTFC->FSTAT & FTFC_FSTAT_CCIF_MASK) != 0U);
+}
+
+/**
+ * @brief Install FTFC handler in the RAM vector table
+ */
+status_t FTFC_InstallIrqHandler(void)
+{
+    if (NVIC_InstallHandler(FTFC_IRQn, FTFC_IRQHandler) != NVIC_STATUS_SUCCESS) {
+        return STATUS_ERROR;
+    }
+    
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief FTFC command complete interrupt handler
+ */
+void FTFC_IRQHandler(void)
+{
+    uint8_t fstat = FTFC->FSTAT;
+    uint8_t i;
+    status_t status;
+    ftfc_callback_t callback;
+    
+    NVIC_TRACE_ISR_ENTRY(FTFC_IRQn);
+    
+    if (!s_ftfcAsync.active || ((fstat & FTFC_FSTAT_CCIF_MASK) == 0U)) {
+        return;
+    }
+    
+    status = FTFC_StatusFromFstat(fstat);
+    
+    if ((status == STATUS_SUCCESS) && (s_ftfcAsync.remaining > 0U)) {
+        /* Next phrase: only address and data change */
+        FTFC->FCCOB[FTFC_FCCOB1] = (uint8_t)(s_ftfcAsync.cmdAddress >> 16U);
+        FTFC->FCCOB[FTFC_FCCOB2] = (uint8_t)(s_ftfcAsync.cmdAddress >> 8U);
+        FTFC->FCCOB[FTFC_FCCOB3] = (uint8_t)s_ftfcAsync.cmdAddress;
+        for (i = 0U; i < FTFC_PHRASE_SIZE; i++) {
+            FTFC->FCCOB[FTFC_FCCOB_PHRASE_DATA(i)] = s_ftfcAsync.data[i];
+        }
+        
+        s_ftfcAsync.cmdAddress += FTFC_PHRASE_SIZE;
+        s_ftfcAsync.data += FTFC_PHRASE_SIZE;
+        s_ftfcAsync.remaining -= FTFC_PHRASE_SIZE;
+        
+        FTFC->FSTAT = FTFC_FSTAT_CCIF_MASK;
+        return;
+    }
+    
+    FTFC->FCNFG &= (uint8_t)~FTFC_FCNFG_CCIE_MASK;
+    
+    /* Flash is readable again: drop stale lines of the modified range */
+    LMEM_InvalidateCodeCacheLines(s_ftfcAsync.cpuAddress, s_ftfcAsync.size);
+    
+    callback = s_ftfcAsync.callback;
+    s_ftfcAsync.lastStatus = status;
+    s_ftfcAsync.active = false;
+    
+    if (callback != NULL) {
+        callback(status, s_ftfcAsync.userData);
+    }
+}
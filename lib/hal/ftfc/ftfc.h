@@ -0,0 +1,263 @@
+/**
+ * @file    ftfc.h
+ * @brief   FTFC flash driver for S32K144
+ * @details
+ * FTFC driver provides the following APIs for program flash (512 KB,
+ * 4 KB sectors) and FlexNVM data flash (64 KB, 2 KB sectors):
+ * - Sector erase, phrase program (8 bytes), program check, erased check
+ * - Blocking mode: command launch / wait loop runs from SRAM
+ * - Async mode: erase / multi-phrase program driven by the CCIF
+ *   interrupt, completion callback from FTFC_IRQHandler()
+ * - FlexNVM partitioning and FlexRAM function (EEPROM emulation)
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.2
+ *
+ * @note
+ * - Addresses are CPU addresses: 0x00000000 (P-Flash) or 0x10000000 (FlexNVM)
+ * - Commands are only accepted in RUN mode (not HSRUN / VLPR)
+ * - S32K144 P-Flash is a single block: while a P-Flash command runs, no
+ *   code or constant may be read from P-Flash. FlexNVM commands can run
+ *   while the application executes from P-Flash (read-while-write).
+ * - The LMEM code cache is kept coherent by the driver
+ *
+ * @par Change Log:
+ * - Version 1.0 (14/10/2026): Initial FTFC driver (erase, program, check, async)
+ * - Version 1.1 (14/10/2026): Program Partition, Set FlexRAM Function, EEE status
+ * - Version 1.2 (14/10/2026): CSEc key storage in Program Partition
+ */
+
+#ifndef FTFC_H
+#define FTFC_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "ftfc_reg.h"
+#include "status.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @defgroup FTFC_Definitions FTFC Definitions
+ * @{
+ */
+
+/**
+ * @brief Mask interrupts while a blocking command runs
+ * @details Required unless every enabled ISR, its callees and the vector
+ *          table are in SRAM (HAL_RAMFUNC, NVIC_InitRamVectorTable()).
+ *          A P-Flash sector erase keeps interrupts masked for milliseconds.
+ */
+#ifndef FTFC_BLOCKING_MASK_IRQ
+#define FTFC_BLOCKING_MASK_IRQ      (1U)
+#endif
+
+/**
+ * @brief Allow async commands on P-Flash (0 = FlexNVM only)
+ * @details Set to 1 only when the code running during the operation
+ *          (main loop and ISRs) executes from SRAM, e.g. a bootloader.
+ *          FTFC_EraseSectorAsync() / FTFC_ProgramAsync() are then placed
+ *          in SRAM as well.
+ */
+#ifndef FTFC_ASYNC_PFLASH_ENABLE
+#define FTFC_ASYNC_PFLASH_ENABLE    (0U)
+#endif
+
+/**
+ * @brief CSEc key storage reserved by FTFC_ProgramPartition() (FTFC_CSEC_KEYS_x)
+ * @details Taken from the top of the EEPROM data set: EEERAM usable by the
+ *          application shrinks by 128 / 256 / 512 bytes.
+ */
+#ifndef FTFC_CSEC_KEY_SIZE
+#define FTFC_CSEC_KEY_SIZE          (FTFC_CSEC_KEYS_NONE)
+#endif
+
+/**
+ * @brief Read margin level
+ */
+typedef enum {
+    FTFC_MARGIN_NORMAL  = 0x00U,    /**< Normal read level (not valid for program check) */
+    FTFC_MARGIN_USER    = 0x01U,    /**< User margin */
+    FTFC_MARGIN_FACTORY = 0x02U     /**< Factory margin */
+} ftfc_margin_t;
+
+/**
+ * @brief Async operation completion callback (called from FTFC_IRQHandler())
+ * @param status   STATUS_SUCCESS, or STATUS_ERROR on access / protection / verify error
+ * @param userData Pointer to user data
+ */
+typedef void (*ftfc_callback_t)(status_t status, void *userData);
+
+/** @} */ /* End of FTFC_Definitions */
+
+/*******************************************************************************
+ * API Function Prototypes
+ ******************************************************************************/
+
+/**
+ * @defgroup FTFC_Functions FTFC Functions
+ * @{
+ */
+
+/**
+ * @brief Initialize the driver
+ * @details Waits for a command left running (e.g. by a bootloader), clears
+ *          the error flags and disables the command complete interrupt.
+ * @return STATUS_SUCCESS
+ */
+status_t FTFC_Init(void);
+
+/**
+ * @brief Erase one sector (blocking)
+ * @param[in] address Any address inside the sector
+ * @return STATUS_SUCCESS if erased
+ * @return STATUS_BUSY if an async operation is in progress
+ * @return STATUS_ERROR if the address is invalid, protected or not in RUN mode
+ */
+status_t FTFC_EraseSector(uint32_t address);
+
+/**
+ * @brief Program phrases (blocking)
+ * @param[in] address Start address, 8-byte aligned, erased
+ * @param[in] data    Data to program
+ * @param[in] size    Size in bytes, multiple of FTFC_PHRASE_SIZE
+ * @return STATUS_SUCCESS if programmed
+ * @return STATUS_BUSY if an async operation is in progress
+ * @return STATUS_ERROR on invalid parameters or a command error
+ *
+ * @code
+ * static const uint8_t s_cal[16] = { ... };
+ * FTFC_EraseSector(0x10000000UL);
+ * FTFC_Program(0x10000000UL, s_cal, sizeof(s_cal));
+ * @endcode
+ */
+status_t FTFC_Program(uint32_t address, const void *data, uint32_t size);
+
+/**
+ * @brief Check a programmed word at a read margin (blocking)
+ * @param[in] address  Word address, 4-byte aligned
+ * @param[in] expected Expected 4 bytes (address order)
+ * @param[in] margin   FTFC_MARGIN_USER or FTFC_MARGIN_FACTORY
+ * @return STATUS_SUCCESS if the word reads back correctly at the margin
+ * @return STATUS_ERROR if it does not, or on invalid parameters
+ */
+status_t FTFC_ProgramCheck(uint32_t address, const void *expected, ftfc_margin_t margin);
+
+/**
+ * @brief Check that a range is erased (Read 1s Section, blocking)
+ * @param[in] address Start address, 16-byte aligned
+ * @param[in] size    Size in bytes, multiple of FTFC_SECTION_UNIT
+ * @param[in] margin  Read margin
+ * @return STATUS_SUCCESS if every bit is 1
+ * @return STATUS_ERROR otherwise, or on invalid parameters
+ */
+status_t FTFC_VerifyErased(uint32_t address, uint32_t size, ftfc_margin_t margin);
+
+/**
+ * @brief Start a sector erase, completion through the CCIF interrupt
+ * @param[in] address  Any address inside the sector
+ * @param[in] callback Completion callback (NULL = poll FTFC_IsBusy())
+ * @param[in] userData Passed to callback
+ * @return STATUS_SUCCESS if the erase started
+ * @return STATUS_BUSY if an operation is in progress
+ * @return STATUS_UNSUPPORTED for P-Flash with FTFC_ASYNC_PFLASH_ENABLE = 0
+ * @return STATUS_ERROR on invalid parameters or not in RUN mode
+ *
+ * @note FTFC_IRQn must be enabled and routed to FTFC_IRQHandler()
+ */
+status_t FTFC_EraseSectorAsync(uint32_t address, ftfc_callback_t callback, void *userData);
+
+/**
+ * @brief Start programming phrases, next phrase launched from the CCIF interrupt
+ * @param[in] address  Start address, 8-byte aligned, erased
+ * @param[in] data     Data to program (must stay valid until completion)
+ * @param[in] size     Size in bytes, multiple of FTFC_PHRASE_SIZE
+ * @param[in] callback Completion callback (NULL = poll FTFC_IsBusy())
+ * @param[in] userData Passed to callback
+ * @return Same as FTFC_EraseSectorAsync()
+ *
+ * @code
+ * // FlexNVM log append while CAN keeps running
+ * NVIC_EnableIRQ(FTFC_IRQn);
+ * FTFC_ProgramAsync(0x10000800UL, s_record, sizeof(s_record), OnLogWritten, NULL);
+ * @endcode
+ */
+status_t FTFC_ProgramAsync(uint32_t address, const void *data, uint32_t size,
+                           ftfc_callback_t callback, void *userData);
+
+/**
+ * @brief Check whether an async operation is in progress
+ * @return bool true while busy
+ */
+bool FTFC_IsBusy(void);
+
+/**
+ * @brief Status of the last completed async operation
+ * @return status_t STATUS_BUSY while an operation is in progress
+ */
+status_t FTFC_GetAsyncStatus(void);
+
+/**
+ * @brief Partition FlexNVM into data flash and EEPROM backup
+ * @details One-time operation: only accepted while FlexNVM is unpartitioned
+ *          (erased device or after Erase All Blocks). CSEc key slots are
+ *          reserved according to FTFC_CSEC_KEY_SIZE.
+ * @param[in] eeeSizeCode       EEPROM data set size (FTFC_EEESIZE_x)
+ * @param[in] departCode        FlexNVM partition code (FTFC_DEPART_x)
+ * @param[in] loadFlexRamOnReset true: FlexRAM loaded with EEPROM data at reset
+ * @return STATUS_SUCCESS if partitioned
+ * @return STATUS_BUSY if an async operation is in progress
+ * @return STATUS_ERROR if already partitioned or the command failed
+ */
+status_t FTFC_ProgramPartition(uint8_t eeeSizeCode, uint8_t departCode, bool loadFlexRamOnReset);
+
+/**
+ * @brief Read back the FlexNVM partition (SIM FCFG1)
+ * @param[out] eeeSizeCode EEPROM data set size code (FTFC_EEESIZE_NONE if none)
+ * @param[out] departCode  FlexNVM partition code (FTFC_DEPART_NONE if unpartitioned)
+ * @return STATUS_SUCCESS, STATUS_ERROR if a pointer is NULL
+ */
+status_t FTFC_GetPartition(uint8_t *eeeSizeCode, uint8_t *departCode);
+
+/**
+ * @brief Select the FlexRAM function and wait until it is ready
+ * @param[in] function FTFC_FLEXRAM_EEE or FTFC_FLEXRAM_RAM
+ * @return STATUS_SUCCESS if FCNFG[EEERDY] / [RAMRDY] is set
+ * @return STATUS_BUSY if an async operation is in progress
+ * @return STATUS_ERROR if the command failed (e.g. no EEPROM partition)
+ */
+status_t FTFC_SetFlexRamFunction(uint8_t function);
+
+/**
+ * @brief Check whether FlexRAM is in EEPROM emulation mode
+ * @return bool true if FCNFG[EEERDY] is set
+ */
+bool FTFC_IsEeeReady(void);
+
+/**
+ * @brief Check whether the FTFC accepts a new command or EEE write
+ * @return bool true if FSTAT[CCIF] is set
+ */
+bool FTFC_IsIdle(void);
+
+/**
+ * @brief Install FTFC_IRQHandler() in the RAM vector table
+ * @return STATUS_SUCCESS if installed, STATUS_ERROR if there is no RAM vector table
+ */
+status_t FTFC_InstallIrqHandler(void);
+
+/**
+ * @brief FTFC command complete interrupt handler (vector FTFC_IRQn)
+ * @details Runs from SRAM: it launches the next phrase of an async program.
+ */
+HAL_RAMFUNC void FTFC_IRQHandler(void);
+
+/** @} */ /* End of FTFC_Functions */
+
+#endif /* FTFC_H */
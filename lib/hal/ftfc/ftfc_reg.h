@@ -0,0 +1,170 @@
+/**
+ * @file    ftfc_reg.h
+ * @brief   FTFC Register Definitions for S32K144
+ * @details This file contains low-level Flash Memory Module register
+ *          definitions, FCCOB byte indices and command codes.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.2
+ *
+ * @note    These are raw register definitions for FTFC peripheral
+ * @warning Direct register access - use with caution
+ *
+ * @par Change Log:
+ * - Version 1.0 (Oct 14, 2026): Initial version
+ * - Version 1.1 (Oct 14, 2026): Partition / FlexRAM codes, SIM FCFG1 readback
+ * - Version 1.2 (Oct 14, 2026): CSEc key size codes
+ *
+ */
+
+#ifndef FTFC_REG_H
+#define FTFC_REG_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include "def_reg.h"
+
+/*******************************************************************************
+ * FTFC Register Structure
+ ******************************************************************************/
+
+/**
+ * @brief FTFC Register Layout
+ */
+typedef struct {
+    __IO uint8_t FSTAT;         /**< Flash Status Register, offset: 0x00 */
+    __IO uint8_t FCNFG;         /**< Flash Configuration Register, offset: 0x01 */
+    __I  uint8_t FSEC;          /**< Flash Security Register, offset: 0x02 */
+    __I  uint8_t FOPT;          /**< Flash Option Register, offset: 0x03 */
+    __IO uint8_t FCCOB[12];     /**< Flash Common Command Object, offset: 0x04 (see FTFC_FCCOBn) */
+    __IO uint8_t FPROT[4];      /**< Program Flash Protection, offset: 0x10 */
+    uint8_t RESERVED_0[2];
+    __IO uint8_t FEPROT;        /**< EEPROM Protection Register, offset: 0x16 */
+    __IO uint8_t FDPROT;        /**< Data Flash Protection Register, offset: 0x17 */
+    uint8_t RESERVED_1[20];
+    __I  uint8_t FCSESTAT;      /**< Flash CSEc Status Register, offset: 0x2C */
+    uint8_t RESERVED_2[1];
+    __IO uint8_t FERSTAT;       /**< Flash Error Status Register, offset: 0x2E */
+    __IO uint8_t FERCNFG;       /**< Flash Error Configuration Register, offset: 0x2F */
+} FTFC_RegType;
+
+/** @brief FTFC base address */
+#define FTFC_BASE_ADDR          (0x40020000UL)
+
+/** @brief FTFC base pointer */
+#define FTFC                    ((FTFC_RegType *)FTFC_BASE_ADDR)
+
+/*******************************************************************************
+ * FSTAT - Flash Status Register (w1c except MGSTAT0)
+ ******************************************************************************/
+#define FTFC_FSTAT_MGSTAT0_MASK     (0x01U)     /**< Command completion error detected during run */
+#define FTFC_FSTAT_FPVIOL_MASK      (0x10U)     /**< Protection violation */
+#define FTFC_FSTAT_ACCERR_MASK      (0x20U)     /**< Access error (bad command / parameter) */
+#define FTFC_FSTAT_RDCOLERR_MASK    (0x40U)     /**< Read collision with a running command */
+#define FTFC_FSTAT_CCIF_MASK        (0x80U)     /**< Command complete, write 1 to launch */
+
+/** @brief Error flags cleared before each launch */
+#define FTFC_FSTAT_ERROR_MASK       (FTFC_FSTAT_FPVIOL_MASK | FTFC_FSTAT_ACCERR_MASK | \
+                                     FTFC_FSTAT_RDCOLERR_MASK)
+
+/*******************************************************************************
+ * FCNFG - Flash Configuration Register
+ ******************************************************************************/
+#define FTFC_FCNFG_EEERDY_MASK      (0x01U)     /**< FlexRAM ready for EEPROM emulation */
+#define FTFC_FCNFG_RAMRDY_MASK      (0x02U)     /**< FlexRAM ready as traditional RAM */
+#define FTFC_FCNFG_ERSSUSP_MASK     (0x10U)     /**< Suspend a running sector erase */
+#define FTFC_FCNFG_ERSAREQ_MASK     (0x20U)     /**< Erase all request (read only) */
+#define FTFC_FCNFG_RDCOLLIE_MASK    (0x40U)     /**< Read collision interrupt enable */
+#define FTFC_FCNFG_CCIE_MASK        (0x80U)     /**< Command complete interrupt enable */
+
+/*******************************************************************************
+ * FCCOB - byte indices into FCCOB[] (registers are big-endian within a word)
+ ******************************************************************************/
+#define FTFC_FCCOB0                 (3U)        /**< Command code */
+#define FTFC_FCCOB1                 (2U)        /**< Address [23:16] */
+#define FTFC_FCCOB2                 (1U)        /**< Address [15:8] */
+#define FTFC_FCCOB3                 (0U)        /**< Address [7:0] */
+#define FTFC_FCCOB4                 (7U)
+#define FTFC_FCCOB5                 (6U)
+#define FTFC_FCCOB6                 (5U)
+#define FTFC_FCCOB7                 (4U)
+#define FTFC_FCCOB8                 (11U)
+#define FTFC_FCCOB9                 (10U)
+#define FTFC_FCCOBA                 (9U)
+#define FTFC_FCCOBB                 (8U)
+
+/** @brief Phrase data byte n (address order) for Program Phrase */
+#define FTFC_FCCOB_PHRASE_DATA(n)   (4U + (n))
+
+/** @brief Expected data byte n (address order) for Program Check */
+#define FTFC_FCCOB_CHECK_DATA(n)    (8U + (n))
+
+/*******************************************************************************
+ * FTFC command codes (FCCOB0)
+ ******************************************************************************/
+#define FTFC_CMD_READ_1S_BLOCK      (0x00U)
+#define FTFC_CMD_READ_1S_SECTION    (0x01U)
+#define FTFC_CMD_PROGRAM_CHECK      (0x02U)
+#define FTFC_CMD_READ_RESOURCE      (0x03U)
+#define FTFC_CMD_PROGRAM_PHRASE     (0x07U)
+#define FTFC_CMD_ERASE_BLOCK        (0x08U)
+#define FTFC_CMD_ERASE_SECTOR       (0x09U)
+#define FTFC_CMD_PROGRAM_SECTION    (0x0BU)
+#define FTFC_CMD_READ_1S_ALL_BLOCKS (0x40U)
+#define FTFC_CMD_READ_ONCE          (0x41U)
+#define FTFC_CMD_PROGRAM_ONCE       (0x43U)
+#define FTFC_CMD_ERASE_ALL_BLOCKS   (0x44U)
+#define FTFC_CMD_PROGRAM_PARTITION  (0x80U)
+#define FTFC_CMD_SET_FLEXRAM        (0x81U)
+
+/*******************************************************************************
+ * S32K144 flash memory map
+ ******************************************************************************/
+#define FTFC_PFLASH_BASE            (0x00000000UL)  /**< Program flash */
+#define FTFC_PFLASH_SIZE            (0x00080000UL)  /**< 512 KB */
+#define FTFC_PFLASH_SECTOR_SIZE     (4096U)
+#define FTFC_DFLASH_BASE            (0x10000000UL)  /**< FlexNVM (data flash) */
+#define FTFC_DFLASH_SIZE            (0x00010000UL)  /**< 64 KB */
+#define FTFC_DFLASH_SECTOR_SIZE     (2048U)
+#define FTFC_DFLASH_CMD_BASE        (0x00800000UL)  /**< FlexNVM address seen by FTFC commands */
+#define FTFC_FLEXRAM_BASE           (0x14000000UL)  /**< FlexRAM / EEPROM emulation window */
+#define FTFC_FLEXRAM_SIZE           (0x00001000UL)  /**< 4 KB */
+
+/*******************************************************************************
+ * Program Partition / Set FlexRAM Function codes
+ ******************************************************************************/
+#define FTFC_EEESIZE_4KB            (0x02U)     /**< EEPROM data set size code: 4 KB */
+#define FTFC_EEESIZE_2KB            (0x03U)
+#define FTFC_EEESIZE_1KB            (0x04U)
+#define FTFC_EEESIZE_NONE           (0x0FU)     /**< No EEPROM (also the unpartitioned readback) */
+
+#define FTFC_DEPART_DF64_EE0        (0x00U)     /**< 64 KB data flash, no EEPROM backup */
+#define FTFC_DEPART_DF32_EE32       (0x03U)     /**< 32 KB data flash, 32 KB EEPROM backup */
+#define FTFC_DEPART_DF0_EE64        (0x08U)     /**< No data flash, 64 KB EEPROM backup */
+#define FTFC_DEPART_NONE            (0x0FU)     /**< Unpartitioned readback */
+
+#define FTFC_CSEC_KEYS_NONE         (0x00U)     /**< No CSEc key storage */
+#define FTFC_CSEC_KEYS_5            (0x01U)     /**< 1-5 keys, 128 bytes of EEERAM */
+#define FTFC_CSEC_KEYS_10           (0x02U)     /**< 1-10 keys, 256 bytes of EEERAM */
+#define FTFC_CSEC_KEYS_20           (0x03U)     /**< 1-20 keys, 512 bytes of EEERAM */
+
+#define FTFC_FLEXRAM_EEE            (0x00U)     /**< FlexRAM used for EEPROM emulation */
+#define FTFC_FLEXRAM_RAM            (0xFFU)     /**< FlexRAM used as traditional RAM */
+
+/*******************************************************************************
+ * SIM FCFG1 - partition readback (SIM is not otherwise used by the HAL)
+ ******************************************************************************/
+#define FTFC_SIM_FCFG1              (*(__I uint32_t *)0x4004804CUL)
+#define FTFC_SIM_FCFG1_DEPART_MASK      (0x0000F000UL)
+#define FTFC_SIM_FCFG1_DEPART_SHIFT     (12U)
+#define FTFC_SIM_FCFG1_EEERAMSIZE_MASK  (0x000F0000UL)
+#define FTFC_SIM_FCFG1_EEERAMSIZE_SHIFT (16U)
+
+#define FTFC_PHRASE_SIZE            (8U)        /**< Program Phrase unit */
+#define FTFC_WORD_SIZE              (4U)        /**< Program Check unit */
+#define FTFC_SECTION_UNIT           (16U)       /**< Read 1s Section unit */
+
+#endif /* FTFC_REG_H */
@@ -0,0 +1,856 @@
+/**
+ * @file    ftm.c
+ * @brief   FTM Driver Implementation for S32K144
+ * @details Implementation of counter control, quadrature decoder, input
+ *          capture (interrupt / eDMA), overflow extension and PWM.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.1
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "ftm.h"
+#include "pcc.h"
+#include "clock_manager.h"
+#include "nvic.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief No eDMA channel attached */
+#define FTM_NO_DMA_CHANNEL      (0xFFU)
+
+/** @brief Bits per channel in FILTER */
+#define FTM_FILTER_FIELD_WIDTH  (4U)
+
+/** @brief Bits per channel pair in COMBINE */
+#define FTM_COMBINE_PAIR_WIDTH  (8U)
+
+/** @brief Maximum deadtime value (DEADTIME[DTVAL]) */
+#define FTM_MAX_DEADTIME        (63U)
+
+/** @brief SC[PWMENn] of every channel */
+#define FTM_SC_PWMEN_ALL_MASK   (0xFFUL << FTM_SC_PWMEN0_SHIFT)
+
+/*******************************************************************************
+ * Private Types
+ ******************************************************************************/
+
+/**
+ * @brief Per-instance driver state
+ */
+typedef struct {
+    bool initialized;                                   /**< FTM_Init() done */
+    bool quadrature;                                    /**< Quadrature decoder enabled */
+    bool pwm;                                           /**< FTM_PwmInit() done */
+    ftm_pwm_align_t alignment;                          /**< PWM alignment */
+    ftm_clock_source_t clockSource;                     /**< Clock applied by FTM_Start() */
+    ftm_prescaler_t prescaler;                          /**< Prescaler */
+    volatile int32_t overflows;                         /**< Overflow extension (signed in QD mode) */
+    uint8_t dmaMask;                                    /**< Channels serviced by eDMA */
+    uint8_t dmaChannel[FTM_MAX_CHANNELS];               /**< eDMA channel per FTM channel */
+    ftm_channel_callback_t channelCallback[FTM_MAX_CHANNELS];
+    void *channelUserData[FTM_MAX_CHANNELS];
+    ftm_overflow_callback_t overflowCallback;
+    void *overflowUserData;
+} ftm_state_t;
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+
+/** @brief Array of FTM base addresses */
+static FTM_Type * const s_ftmBases[FTM_INSTANCE_COUNT] = FTM_BASE_PTRS;
+
+/** @brief PCC index per instance */
+static const uint8_t s_ftmPccIndex[FTM_INSTANCE_COUNT] = {
+    PCC_FTM0_INDEX, PCC_FTM1_INDEX, PCC_FTM2_INDEX, PCC_FTM3_INDEX
+};
+
+/** @brief DMAMUX source of channel 0 per instance (channels are consecutive) */
+static const dmamux_source_t s_ftmDmaSource[FTM_INSTANCE_COUNT] = {
+    DMAMUX_SRC_FTM0_CH0, DMAMUX_SRC_FTM1_CH0, DMAMUX_SRC_FTM2_CH0, DMAMUX_SRC_FTM3_CH0
+};
+
+/** @brief Channels with a DMAMUX request per instance */
+static const uint8_t s_ftmDmaChannels[FTM_INSTANCE_COUNT] = { 8U, 2U, 2U, 8U };
+
+/** @brief Driver state */
+static ftm_state_t s_ftmState[FTM_INSTANCE_COUNT];
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Check FTM instance number
+ */
+static inline bool FTM_IsValidInstance(uint8_t instance)
+{
+    return (instance < FTM_INSTANCE_COUNT);
+}
+
+/**
+ * @brief Overflow step of the last TOF: -1 on quadrature underflow, +1 otherwise
+ */
+static inline int32_t FTM_OverflowDirection(const FTM_Type *base, const ftm_state_t *state)
+{
+    if (state->quadrature && ((base->QDCTRL & FTM_QDCTRL_TOFDIR_MASK) == 0U)) {
+        return -1;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Program the input filter of channel 0-3
+ * @note FILTER is only written while the counter is stopped
+ */
+static void FTM_SetFilter(FTM_Type *base, uint8_t channel, uint8_t value)
+{
+    uint32_t shift = (uint32_t)channel * FTM_FILTER_FIELD_WIDTH;
+
+    base->FILTER = (base->FILTER & ~(FTM_FILTER_CH0FVAL_MASK << shift)) |
+                   ((uint32_t)value << shift);
+}
+
+/**
+ * @brief Start an eDMA channel paced by the requests of an FTM channel
+ * @details DMA + CHIE: the channel event raises a DMA request instead of an interrupt, the DMA clears CHF
+ */
+static status_t FTM_AttachDma(uint8_t instance, uint8_t channel,
+                              dma_channel_config_t *dmaConfig,
+                              dma_callback_t callback, void *userData)
+{
+    ftm_state_t *state = &s_ftmState[instance];
+
+    dmaConfig->source = (dmamux_source_t)((uint32_t)s_ftmDmaSource[instance] + channel);
+    dmaConfig->priority = DMA_PRIORITY_HIGH;
+    dmaConfig->enableInterrupt = (callback != NULL);
+
+    if (DMA_ConfigChannel(dmaConfig) != STATUS_SUCCESS) {
+        return STATUS_ERROR;
+    }
+
+    if ((callback != NULL) &&
+        (DMA_InstallCallback(dmaConfig->channel, callback, userData) != STATUS_SUCCESS)) {
+        return STATUS_ERROR;
+    }
+
+    state->dmaChannel[channel] = dmaConfig->channel;
+    state->dmaMask |= (uint8_t)(1U << channel);
+
+    if (DMA_StartChannel(dmaConfig->channel) != STATUS_SUCCESS) {
+        state->dmaChannel[channel] = FTM_NO_DMA_CHANNEL;
+        state->dmaMask &= (uint8_t)~(1U << channel);
+        return STATUS_ERROR;
+    }
+
+    /* Requests only start once the DMA channel is armed */
+    s_ftmBases[instance]->CONTROLS[channel].CnSC |= FTM_CnSC_DMA_MASK | FTM_CnSC_CHIE_MASK;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Stop the eDMA channel attached to an FTM channel
+ */
+static void FTM_DetachDma(uint8_t instance, uint8_t channel)
+{
+    ftm_state_t *state = &s_ftmState[instance];
+
+    if (state->dmaChannel[channel] == FTM_NO_DMA_CHANNEL) {
+        return;
+    }
+
+    s_ftmBases[instance]->CONTROLS[channel].CnSC &= ~(FTM_CnSC_DMA_MASK | FTM_CnSC_CHIE_MASK);
+    (void)DMA_StopChannel(state->dmaChannel[channel]);
+
+    state->dmaChannel[channel] = FTM_NO_DMA_CHANNEL;
+    state->dmaMask &= (uint8_t)~(1U << channel);
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+/**
+ * @brief Initialize an FTM instance
+ */
+status_t FTM_Init(uint8_t instance, const ftm_config_t *config)
+{
+    FTM_Type *base;
+    ftm_state_t *state;
+    uint8_t ch;
+
+    if (!FTM_IsValidInstance(instance) || (config == NULL) ||
+        (config->clockSource == FTM_CLOCK_SOURCE_NONE)) {
+        return STATUS_ERROR;
+    }
+
+    base = s_ftmBases[instance];
+    state = &s_ftmState[instance];
+
+    PCC->PCCn[s_ftmPccIndex[instance]] |= PCC_PCCn_CGC_MASK;
+
+    /* Counter stopped: MOD / CNTIN / FILTER writes take effect immediately */
+    base->SC = 0U;
+    base->MODE = FTM_MODE_WPDIS_MASK | FTM_MODE_FTMEN_MASK;
+    base->QDCTRL = 0U;
+    base->COMBINE = 0U;
+    base->PWMLOAD = 0U;
+    for (ch = 0U; ch < FTM_MAX_CHANNELS; ch++) {
+        base->CONTROLS[ch].CnSC = 0U;
+        state->dmaChannel[ch] = FTM_NO_DMA_CHANNEL;
+    }
+    base->STATUS = 0U;
+
+    base->CNTIN = 0U;
+    base->MOD = config->modulo;
+    base->CNT = 0U;
+
+    state->clockSource = config->clockSource;
+    state->prescaler = config->prescaler;
+    state->quadrature = false;
+    state->pwm = false;
+    state->overflows = 0;
+    state->dmaMask = 0U;
+    state->initialized = true;
+
+    base->SC = FTM_SC_PS(config->prescaler) |
+               FTM_SC_TOIE(config->enableOverflowExtension ? 1U : 0U);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Deinitialize an FTM instance
+ */
+status_t FTM_Deinit(uint8_t instance)
+{
+    FTM_Type *base;
+    ftm_state_t *state;
+    uint8_t ch;
+
+    if (!FTM_IsValidInstance(instance)) {
+        return STATUS_ERROR;
+    }
+
+    base = s_ftmBases[instance];
+    state = &s_ftmState[instance];
+
+    if (state->initialized) {
+        base->SC = 0U;
+        base->QDCTRL = 0U;
+        base->PWMLOAD = 0U;
+        for (ch = 0U; ch < FTM_MAX_CHANNELS; ch++) {
+            FTM_DetachDma(instance, ch);
+            base->CONTROLS[ch].CnSC = 0U;
+        }
+    }
+
+    state->initialized = false;
+    state->pwm = false;
+
+    PCC->PCCn[s_ftmPccIndex[instance]] &= ~PCC_PCCn_CGC_MASK;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Start the counter
+ */
+status_t FTM_Start(uint8_t instance)
+{
+    FTM_Type *base;
+
+    if (!FTM_IsValidInstance(instance) || !s_ftmState[instance].initialized) {
+        return STATUS_ERROR;
+    }
+
+    base = s_ftmBases[instance];
+    base->SC = (base->SC & ~FTM_SC_CLKS_MASK) | FTM_SC_CLKS(s_ftmState[instance].clockSource);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Stop the counter
+ */
+status_t FTM_Stop(uint8_t instance)
+{
+    FTM_Type *base;
+
+    if (!FTM_IsValidInstance(instance)) {
+        return STATUS_ERROR;
+    }
+
+    base = s_ftmBases[instance];
+    base->SC &= ~FTM_SC_CLKS_MASK;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Counter tick frequency
+ */
+uint32_t FTM_GetCounterFreq(uint8_t instance)
+{
+    const ftm_state_t *state;
+    uint32_t freq;
+
+    if (!FTM_IsValidInstance(instance) || !s_ftmState[instance].initialized) {
+        return 0U;
+    }
+
+    state = &s_ftmState[instance];
+    freq = (state->clockSource == FTM_CLOCK_SOURCE_SYSTEM) ?
+           ClockManager_GetCoreFreq() : PCC_GetFtmClockFreq(instance);
+
+    return freq >> (uint32_t)state->prescaler;
+}
+
+/**
+ * @brief Read the 16-bit counter
+ */
+uint16_t FTM_GetCounter(uint8_t instance)
+{
+    if (!FTM_IsValidInstance(instance)) {
+        return 0U;
+    }
+
+    return (uint16_t)(s_ftmBases[instance]->CNT & FTM_CNT_COUNT_MASK);
+}
+
+/**
+ * @brief Read the overflow-extended counter
+ */
+int32_t FTM_GetExtendedCounter(uint8_t instance)
+{
+    FTM_Type *base;
+    const ftm_state_t *state;
+    uint32_t primask;
+    uint32_t cnt;
+    int32_t overflows;
+
+    if (!FTM_IsValidInstance(instance)) {
+        return 0;
+    }
+
+    base = s_ftmBases[instance];
+    state = &s_ftmState[instance];
+
+    if ((base->SC & FTM_SC_TOIE_MASK) == 0U) {
+        return 0;
+    }
+
+    primask = NVIC_DisableGlobalIRQ();
+    cnt = base->CNT & FTM_CNT_COUNT_MASK;
+    overflows = state->overflows;
+    if ((base->SC & FTM_SC_TOF_MASK) != 0U) {
+        /* TOF not yet handled by the ISR: CNT read after TOF belongs to the new period */
+        cnt = base->CNT & FTM_CNT_COUNT_MASK;
+        overflows += FTM_OverflowDirection(base, state);
+    }
+    NVIC_EnableGlobalIRQ(primask);
+
+    return (overflows * (int32_t)((base->MOD & FTM_MOD_MOD_MASK) + 1U)) + (int32_t)cnt;
+}
+
+/**
+ * @brief Reset CNT and the overflow extension
+ */
+status_t FTM_ResetCounter(uint8_t instance)
+{
+    FTM_Type *base;
+    uint32_t primask;
+
+    if (!FTM_IsValidInstance(instance)) {
+        return STATUS_ERROR;
+    }
+
+    base = s_ftmBases[instance];
+
+    primask = NVIC_DisableGlobalIRQ();
+    base->CNT = 0U;
+    if ((base->SC & FTM_SC_TOF_MASK) != 0U) {
+        base->SC &= ~FTM_SC_TOF_MASK;
+    }
+    s_ftmState[instance].overflows = 0;
+    NVIC_EnableGlobalIRQ(primask);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Configure quadrature decoder mode
+ */
+status_t FTM_QuadDecoderInit(uint8_t instance, const ftm_qd_config_t *config)
+{
+    FTM_Type *base;
+
+    /* The quadrature decoder exists only on FTM1 and FTM2 */
+    if (((instance != 1U) && (instance != 2U)) || (config == NULL) ||
+        !s_ftmState[instance].initialized ||
+        (config->phaseAFilter > FTM_MAX_FILTER) || (config->phaseBFilter > FTM_MAX_FILTER)) {
+        return STATUS_ERROR;
+    }
+
+    base = s_ftmBases[instance];
+
+    base->QDCTRL = 0U;
+    base->CONTROLS[0].CnSC = 0U;
+    base->CONTROLS[1].CnSC = 0U;
+    FTM_SetFilter(base, 0U, config->phaseAFilter);
+    FTM_SetFilter(base, 1U, config->phaseBFilter);
+
+    base->QDCTRL = FTM_QDCTRL_QUADEN_MASK |
+                   FTM_QDCTRL_QUADMODE(config->mode) |
+                   FTM_QDCTRL_PHAPOL(config->invertPhaseA ? 1U : 0U) |
+                   FTM_QDCTRL_PHBPOL(config->invertPhaseB ? 1U : 0U) |
+                   FTM_QDCTRL_PHAFLTREN((config->phaseAFilter != 0U) ? 1U : 0U) |
+                   FTM_QDCTRL_PHBFLTREN((config->phaseBFilter != 0U) ? 1U : 0U);
+
+    s_ftmState[instance].quadrature = true;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Direction of the last quadrature count
+ */
+bool FTM_QuadDecoderIsCountingUp(uint8_t instance)
+{
+    if (!FTM_IsValidInstance(instance)) {
+        return false;
+    }
+
+    return ((s_ftmBases[instance]->QDCTRL & FTM_QDCTRL_QUADIR_MASK) != 0U);
+}
+
+/**
+ * @brief Configure a channel for input capture
+ */
+status_t FTM_InputCaptureInit(uint8_t instance, const ftm_ic_config_t *config)
+{
+    FTM_Type *base;
+    uint32_t pairShift;
+
+    if (!FTM_IsValidInstance(instance) || (config == NULL) ||
+        !s_ftmState[instance].initialized || (config->channel >= FTM_MAX_CHANNELS) ||
+        (config->edge < FTM_IC_EDGE_RISING) || (config->edge > FTM_IC_EDGE_BOTH) ||
+        (config->filter > FTM_MAX_FILTER) ||
+        ((config->filter != 0U) && (config->channel >= FTM_FILTER_CHANNELS))) {
+        return STATUS_ERROR;
+    }
+
+    base = s_ftmBases[instance];
+
+    /* Input capture needs a pair without combine / dual edge */
+    pairShift = ((uint32_t)config->channel >> 1U) * 8U;
+    base->COMBINE &= ~(0xFFUL << pairShift);
+
+    if (config->channel < FTM_FILTER_CHANNELS) {
+        FTM_SetFilter(base, config->channel, config->filter);
+    }
+
+    /* MSB:MSA = 00, ELSB:ELSA = edge */
+    base->CONTROLS[config->channel].CnSC = ((uint32_t)config->edge << FTM_CnSC_ELSA_SHIFT) |
+                                           FTM_CnSC_CHIE(config->enableInterrupt ? 1U : 0U);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Read the last captured value
+ */
+uint16_t FTM_GetCaptureValue(uint8_t instance, uint8_t channel)
+{
+    if (!FTM_IsValidInstance(instance) || (channel >= FTM_MAX_CHANNELS)) {
+        return 0U;
+    }
+
+    return (uint16_t)(s_ftmBases[instance]->CONTROLS[channel].CnV & FTM_CnV_VAL_MASK);
+}
+
+/**
+ * @brief Stream captures into memory via eDMA
+ */
+status_t FTM_InputCaptureStartDma(uint8_t instance, uint8_t channel,
+                                  const ftm_ic_dma_config_t *config)
+{
+    FTM_Type *base;
+    dma_channel_config_t dmaConfig;
+
+    if (!FTM_IsValidInstance(instance) || (config == NULL) || (config->buffer == NULL) ||
+        (config->count == 0U) || !s_ftmState[instance].initialized ||
+        (channel >= s_ftmDmaChannels[instance])) {
+        return STATUS_ERROR;
+    }
+
+    base = s_ftmBases[instance];
+
+    /* Source: CnV (16-bit), destination wraps via DLAST when circular */
+    dmaConfig.channel = config->dmaChannel;
+    dmaConfig.transferType = DMA_TRANSFER_PERIPH_TO_MEM;
+    dmaConfig.transferSize = DMA_TRANSFER_SIZE_2B;
+    dmaConfig.sourceAddr = (uint32_t)&(base->CONTROLS[channel].CnV);
+    dmaConfig.sourceOffset = 0;
+    dmaConfig.sourceLastAddrAdjust = 0;
+    dmaConfig.destAddr = (uint32_t)config->buffer;
+    dmaConfig.destOffset = 2;
+    dmaConfig.destLastAddrAdjust = config->circular ? -((int32_t)config->count * 2) : 0;
+    dmaConfig.minorLoopBytes = 2U;
+    dmaConfig.majorLoopCount = config->count;
+    dmaConfig.disableRequestAfterDone = !config->circular;
+    dmaConfig.enablePeriodicTrigger = false;
+
+    return FTM_AttachDma(instance, channel, &dmaConfig, config->callback, config->userData);
+}
+
+/**
+ * @brief Stop capture DMA of a channel
+ */
+status_t FTM_InputCaptureStopDma(uint8_t instance, uint8_t channel)
+{
+    if (!FTM_IsValidInstance(instance) || (channel >= FTM_MAX_CHANNELS)) {
+        return STATUS_ERROR;
+    }
+
+    FTM_DetachDma(instance, channel);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Install a channel event callback
+ */
+status_t FTM_InstallChannelCallback(uint8_t instance, uint8_t channel,
+                                    ftm_channel_callback_t callback, void *userData)
+{
+    ftm_state_t *state;
+
+    if (!FTM_IsValidInstance(instance) || (channel >= FTM_MAX_CHANNELS)) {
+        return STATUS_ERROR;
+    }
+
+    state = &s_ftmState[instance];
+    state->channelCallback[channel] = callback;
+    state->channelUserData[channel] = userData;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Install the counter overflow callback
+ */
+status_t FTM_InstallOverflowCallback(uint8_t instance, ftm_overflow_callback_t callback,
+                                     void *userData)
+{
+    if (!FTM_IsValidInstance(instance)) {
+        return STATUS_ERROR;
+    }
+
+    s_ftmState[instance].overflowCallback = callback;
+    s_ftmState[instance].overflowUserData = userData;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Channel interrupt handler
+ */
+void FTM_ChannelIRQHandler(uint8_t instance)
+{
+    FTM_Type *base;
+    ftm_state_t *state;
+    uint32_t flags;
+    uint8_t ch;
+
+    if (!FTM_IsValidInstance(instance)) {
+        return;
+    }
+
+    base = s_ftmBases[instance];
+    state = &s_ftmState[instance];
+
+    /* Flags of DMA channels are cleared by the DMA, leave them alone */
+    flags = base->STATUS & 0xFFU & ~(uint32_t)state->dmaMask;
+    if (flags == 0U) {
+        return;
+    }
+
+    /* Write-0-to-clear: only bits read as 1 and written as 0 are cleared */
+    base->STATUS = ~flags & 0xFFU;
+
+    while (flags != 0U) {
+        ch = (uint8_t)(31U - (uint32_t)__builtin_clz(flags));
+        flags &= ~(1UL << ch);
+
+        if (state->channelCallback[ch] != NULL) {
+            state->channelCallback[ch](instance, ch, state->channelUserData[ch]);
+        }
+    }
+}
+
+/**
+ * @brief Counter overflow interrupt handler
+ */
+void FTM_OverflowIRQHandler(uint8_t instance)
+{
+    FTM_Type *base;
+    ftm_state_t *state;
+    uint32_t sc;
+
+    if (!FTM_IsValidInstance(instance)) {
+        return;
+    }
+
+    base = s_ftmBases[instance];
+    state = &s_ftmState[instance];
+
+    sc = base->SC;
+    if ((sc & FTM_SC_TOF_MASK) == 0U) {
+        return;
+    }
+
+    /* Read SC, then write 0 to TOF */
+    base->SC = sc & ~FTM_SC_TOF_MASK;
+    state->overflows += FTM_OverflowDirection(base, state);
+
+    if (state->overflowCallback != NULL) {
+        state->overflowCallback(instance, state->overflowUserData);
+    }
+}
+
+/**
+ * @brief Configure PWM generation
+ */
+status_t FTM_PwmInit(uint8_t instance, const ftm_pwm_config_t *config)
+{
+    FTM_Type *base;
+    ftm_state_t *state;
+    const ftm_pwm_channel_config_t *chCfg;
+    uint32_t cnsc;
+    uint32_t combine = 0U;
+    uint32_t pwmen = 0U;
+    uint32_t pairShift;
+    uint8_t i;
+
+    if (!FTM_IsValidInstance(instance) || (config == NULL) || !s_ftmState[instance].initialized ||
+        (config->period < 2U) || (config->deadtimeTicks > FTM_MAX_DEADTIME) ||
+        ((config->channels == NULL) && (config->channelCount != 0U)) ||
+        ((config->alignment == FTM_PWM_CENTER_ALIGNED) && ((config->period & 1U) != 0U))) {
+        return STATUS_ERROR;
+    }
+
+    base = s_ftmBases[instance];
+    state = &s_ftmState[instance];
+
+    if ((base->SC & FTM_SC_CLKS_MASK) != 0U) {
+        return STATUS_BUSY;
+    }
+
+    /* Validate every channel before writing any register */
+    for (i = 0U; i < config->channelCount; i++) {
+        chCfg = &config->channels[i];
+        if ((chCfg->channel >= FTM_MAX_CHANNELS) || (chCfg->duty > config->period) ||
+            ((chCfg->polarity != FTM_PWM_HIGH_TRUE) && (chCfg->polarity != FTM_PWM_LOW_TRUE)) ||
+            (chCfg->complementary && ((chCfg->channel & 1U) != 0U))) {
+            return STATUS_ERROR;
+        }
+    }
+
+    state->alignment = config->alignment;
+
+    /* Counter stopped: MOD / CnV are written directly, not through the buffers */
+    base->SC &= ~(FTM_SC_CPWMS_MASK | FTM_SC_PWMEN_ALL_MASK);
+    if (config->alignment == FTM_PWM_CENTER_ALIGNED) {
+        base->SC |= FTM_SC_CPWMS_MASK;
+        base->MOD = (uint32_t)config->period / 2U;
+    } else {
+        base->MOD = (uint32_t)config->period - 1U;
+    }
+    base->CNTIN = 0U;
+    base->CNT = 0U;
+
+    base->DEADTIME = FTM_DEADTIME_DTPS(config->deadtimePrescaler) |
+                     FTM_DEADTIME_DTVAL(config->deadtimeTicks);
+
+    for (i = 0U; i < config->channelCount; i++) {
+        chCfg = &config->channels[i];
+        pairShift = ((uint32_t)chCfg->channel >> 1U) * FTM_COMBINE_PAIR_WIDTH;
+
+        /* MSB:MSA = 10, ELSB:ELSA = polarity */
+        cnsc = FTM_CnSC_MSB_MASK | ((uint32_t)chCfg->polarity << FTM_CnSC_ELSA_SHIFT);
+        base->CONTROLS[chCfg->channel].CnSC = cnsc;
+        base->CONTROLS[chCfg->channel].CnV = FTM_PwmDutyToValue(instance, chCfg->duty);
+        pwmen |= 1UL << chCfg->channel;
+        combine |= FTM_COMBINE_SYNCEN0_MASK << pairShift;
+
+        if (chCfg->complementary) {
+            /* Channel n + 1 = complement of channel n, with deadtime inserted */
+            base->CONTROLS[chCfg->channel + 1U].CnSC = cnsc;
+            pwmen |= 1UL << (chCfg->channel + 1U);
+            combine |= (FTM_COMBINE_COMP0_MASK | FTM_COMBINE_DTEN0_MASK) << pairShift;
+        }
+    }
+    base->COMBINE = combine;
+
+    /* Enhanced sync: a software trigger loads MOD / CnV at the reload point */
+    base->SYNCONF = FTM_SYNCONF_SYNCMODE_MASK | FTM_SYNCONF_SWWRBUF_MASK;
+    base->SYNC = (config->alignment == FTM_PWM_CENTER_ALIGNED) ?
+                 FTM_SYNC_CNTMIN_MASK : FTM_SYNC_CNTMAX_MASK;
+    base->PWMLOAD = 0U;
+
+    base->SC |= pwmen << FTM_SC_PWMEN0_SHIFT;
+    state->pwm = true;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Convert a duty in counter ticks to a CnV value
+ */
+uint16_t FTM_PwmDutyToValue(uint8_t instance, uint16_t duty)
+{
+    if (FTM_IsValidInstance(instance) &&
+        (s_ftmState[instance].alignment == FTM_PWM_CENTER_ALIGNED)) {
+        return (uint16_t)(duty / 2U);
+    }
+
+    return duty;
+}
+
+/**
+ * @brief Write a new duty into the CnV buffer
+ */
+status_t FTM_PwmSetDuty(uint8_t instance, uint8_t channel, uint16_t duty)
+{
+    if (!FTM_IsValidInstance(instance) || (channel >= FTM_MAX_CHANNELS) ||
+        !s_ftmState[instance].pwm) {
+        return STATUS_ERROR;
+    }
+
+    s_ftmBases[instance]->CONTROLS[channel].CnV = FTM_PwmDutyToValue(instance, duty);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Write a new period into the MOD buffer
+ */
+status_t FTM_PwmSetPeriod(uint8_t instance, uint16_t period)
+{
+    if (!FTM_IsValidInstance(instance) || !s_ftmState[instance].pwm || (period < 2U)) {
+        return STATUS_ERROR;
+    }
+
+    if (s_ftmState[instance].alignment == FTM_PWM_CENTER_ALIGNED) {
+        if ((period & 1U) != 0U) {
+            return STATUS_ERROR;
+        }
+        s_ftmBases[instance]->MOD = (uint32_t)period / 2U;
+    } else {
+        s_ftmBases[instance]->MOD = (uint32_t)period - 1U;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Apply buffered MOD / CnV writes at the next reload point
+ */
+status_t FTM_PwmUpdate(uint8_t instance)
+{
+    if (!FTM_IsValidInstance(instance) || !s_ftmState[instance].pwm) {
+        return STATUS_ERROR;
+    }
+
+    s_ftmBases[instance]->SYNC |= FTM_SYNC_SWSYNC_MASK;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Check whether the last FTM_PwmUpdate() has been loaded
+ */
+bool FTM_PwmIsUpdateDone(uint8_t instance)
+{
+    if (!FTM_IsValidInstance(instance)) {
+        return false;
+    }
+
+    return ((s_ftmBases[instance]->SYNC & FTM_SYNC_SWSYNC_MASK) == 0U);
+}
+
+/**
+ * @brief Feed the duty of a channel from a waveform table via eDMA
+ */
+status_t FTM_PwmStartDma(uint8_t instance, uint8_t channel, const ftm_pwm_dma_config_t *config)
+{
+    FTM_Type *base;
+    dma_channel_config_t dmaConfig;
+    status_t status;
+
+    if (!FTM_IsValidInstance(instance) || (config == NULL) || (config->table == NULL) ||
+        (config->count == 0U) || !s_ftmState[instance].pwm ||
+        (channel >= s_ftmDmaChannels[instance])) {
+        return STATUS_ERROR;
+    }
+
+    base = s_ftmBases[instance];
+
+    /* Source: table (wraps via SLAST when circular), destination: CnV buffer */
+    dmaConfig.channel = config->dmaChannel;
+    dmaConfig.transferType = DMA_TRANSFER_MEM_TO_PERIPH;
+    dmaConfig.transferSize = DMA_TRANSFER_SIZE_2B;
+    dmaConfig.sourceAddr = (uint32_t)config->table;
+    dmaConfig.sourceOffset = 2;
+    dmaConfig.sourceLastAddrAdjust = config->circular ? -((int32_t)config->count * 2) : 0;
+    dmaConfig.destAddr = (uint32_t)&(base->CONTROLS[channel].CnV);
+    dmaConfig.destOffset = 0;
+    dmaConfig.destLastAddrAdjust = 0;
+    dmaConfig.minorLoopBytes = 2U;
+    dmaConfig.majorLoopCount = config->count;
+    dmaConfig.disableRequestAfterDone = !config->circular;
+    dmaConfig.enablePeriodicTrigger = false;
+
+    /* LDOK + CHnSEL: the CnV buffer loads at every reload point, no SWSYNC needed */
+    base->PWMLOAD |= FTM_PWMLOAD_LDOK_MASK | (FTM_PWMLOAD_CH0SEL_MASK << channel);
+
+    status = FTM_AttachDma(instance, channel, &dmaConfig, config->callback, config->userData);
+    if (status != STATUS_SUCCESS) {
+        base->PWMLOAD &= ~(FTM_PWMLOAD_CH0SEL_MASK << channel);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Stop the duty DMA of a channel
+ */
+status_t FTM_PwmStopDma(uint8_t instance, uint8_t channel)
+{
+    FTM_Type *base;
+
+    if (!FTM_IsValidInstance(instance) || (channel >= FTM_MAX_CHANNELS)) {
+        return STATUS_ERROR;
+    }
+
+    base = s_ftmBases[instance];
+
+    FTM_DetachDma(instance, channel);
+
+    base->PWMLOAD &= ~(FTM_PWMLOAD_CH0SEL_MASK << channel);
+    if ((base->PWMLOAD & 0xFFU) == 0U) {
+        base->PWMLOAD &= ~FTM_PWMLOAD_LDOK_MASK;
+    }
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,537 @@
+/**
+ * @file    ftm.h
+ * @brief   FTM (FlexTimer Module) driver for S32K144
+ * @details
+ * FTM driver provides the following APIs:
+ * - Counter setup (clock source, prescaler, modulo) and start / stop
+ * - Quadrature decoder mode (FTM1 / FTM2): phase A / B on CH0 / CH1,
+ *   edge counting and direction entirely in hardware
+ * - Input capture with optional eDMA transfer of CnV into a buffer,
+ *   so edge timestamps are collected without one interrupt per edge
+ * - Counter overflow extension: TOF interrupt extends the 16-bit counter
+ *   to 32 bits (up / down in quadrature mode)
+ * - PWM: edge / center-aligned, complementary pairs with deadtime,
+ *   glitch-free updates through software sync (SYNC) or PWMLOAD, and an
+ *   eDMA path that feeds CnV from a waveform table every period
+ *
+ * Interrupt handling follows LPIT / DMA: the application defines the vector
+ * and calls the driver handler.
+ *
+ * @code
+ * void FTM1_Ovf_Reload_IRQHandler(void) {
+ *     FTM_OverflowIRQHandler(1U);
+ * }
+ * void FTM1_Ch0_Ch1_IRQHandler(void) {
+ *     FTM_ChannelIRQHandler(1U);
+ * }
+ * @endcode
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.1
+ *
+ * @note
+ * - Pins must be muxed to the FTM function via PORT before use
+ * - The counter is 16-bit, use the extended APIs for longer ranges
+ *
+ * @par Change Log:
+ * - Version 1.0 (14/10/2026): Initial FTM driver (quadrature decoder, input capture, overflow extension)
+ * - Version 1.1 (14/10/2026): PWM generation, deadtime, synchronized reload and DMA duty updates
+ */
+
+#ifndef FTM_H
+#define FTM_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "ftm_reg.h"
+#include "dma.h"
+#include "status.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @defgroup FTM_Definitions FTM Definitions
+ * @{
+ */
+
+/** @brief Channels per FTM instance */
+#define FTM_MAX_CHANNELS        (8U)
+
+/** @brief Channels with an input filter (CH0-CH3) */
+#define FTM_FILTER_CHANNELS     (4U)
+
+/** @brief Maximum input filter value (x4 FTM clocks) */
+#define FTM_MAX_FILTER          (15U)
+
+/**
+ * @brief FTM counter clock source (SC[CLKS])
+ */
+typedef enum {
+    FTM_CLOCK_SOURCE_NONE       = 0U,   /**< Counter stopped */
+    FTM_CLOCK_SOURCE_SYSTEM     = 1U,   /**< System clock (core clock) */
+    FTM_CLOCK_SOURCE_EXTERNAL   = 3U    /**< PCC functional clock (PCC PCS) */
+} ftm_clock_source_t;
+
+/**
+ * @brief FTM prescaler (SC[PS])
+ */
+typedef enum {
+    FTM_PRESCALER_1     = 0U,
+    FTM_PRESCALER_2     = 1U,
+    FTM_PRESCALER_4     = 2U,
+    FTM_PRESCALER_8     = 3U,
+    FTM_PRESCALER_16    = 4U,
+    FTM_PRESCALER_32    = 5U,
+    FTM_PRESCALER_64    = 6U,
+    FTM_PRESCALER_128   = 7U
+} ftm_prescaler_t;
+
+/**
+ * @brief FTM counter configuration
+ */
+typedef struct {
+    ftm_clock_source_t clockSource;     /**< Counter clock, applied by FTM_Start() */
+    ftm_prescaler_t prescaler;          /**< Clock prescaler */
+    uint16_t modulo;                    /**< MOD: counter wraps after modulo (CNTIN = 0) */
+    bool enableOverflowExtension;       /**< TOF interrupt extends the counter to 32 bits */
+} ftm_config_t;
+
+/**
+ * @brief Quadrature decoder encoding (QDCTRL[QUADMODE])
+ */
+typedef enum {
+    FTM_QD_MODE_PHASE_AB        = 0U,   /**< Phase A / phase B encoder (x4 counting) */
+    FTM_QD_MODE_COUNT_DIRECTION = 1U    /**< Phase A = count, phase B = direction */
+} ftm_qd_mode_t;
+
+/**
+ * @brief Quadrature decoder configuration
+ */
+typedef struct {
+    ftm_qd_mode_t mode;                 /**< Encoding */
+    bool invertPhaseA;                  /**< Phase A polarity inverted */
+    bool invertPhaseB;                  /**< Phase B polarity inverted */
+    uint8_t phaseAFilter;               /**< Phase A filter (0 = off, 1-15 x4 FTM clocks) */
+    uint8_t phaseBFilter;               /**< Phase B filter (0 = off, 1-15 x4 FTM clocks) */
+} ftm_qd_config_t;
+
+/**
+ * @brief Input capture edge (CnSC[ELSB:ELSA])
+ */
+typedef enum {
+    FTM_IC_EDGE_RISING      = 1U,       /**< Capture on rising edge */
+    FTM_IC_EDGE_FALLING     = 2U,       /**< Capture on falling edge */
+    FTM_IC_EDGE_BOTH        = 3U        /**< Capture on both edges */
+} ftm_ic_edge_t;
+
+/**
+ * @brief Input capture channel configuration
+ */
+typedef struct {
+    uint8_t channel;                    /**< FTM channel (0-7) */
+    ftm_ic_edge_t edge;                 /**< Capture edge */
+    uint8_t filter;                     /**< Input filter (CH0-CH3 only, 0 = off) */
+    bool enableInterrupt;               /**< Channel interrupt (callback) on each capture */
+} ftm_ic_config_t;
+
+/**
+ * @brief Input capture DMA configuration
+ * @details Each capture moves CnV (16-bit) into buffer; the DMA read clears CHF.
+ */
+typedef struct {
+    uint8_t dmaChannel;                 /**< eDMA channel (0-15) */
+    uint16_t *buffer;                   /**< Capture buffer */
+    uint16_t count;                     /**< Captures per major loop */
+    bool circular;                      /**< true: wrap forever, false: stop after count */
+    dma_callback_t callback;            /**< Major loop complete callback (NULL = none) */
+    void *userData;                     /**< Passed to callback */
+} ftm_ic_dma_config_t;
+
+/**
+ * @brief FTM channel event callback
+ * @param instance FTM instance
+ * @param channel  Channel that captured / matched
+ * @param userData Pointer to user data
+ */
+typedef void (*ftm_channel_callback_t)(uint8_t instance, uint8_t channel, void *userData);
+
+/**
+ * @brief FTM overflow callback
+ * @param instance FTM instance
+ * @param userData Pointer to user data
+ */
+typedef void (*ftm_overflow_callback_t)(uint8_t instance, void *userData);
+
+/**
+ * @brief PWM alignment
+ */
+typedef enum {
+    FTM_PWM_EDGE_ALIGNED    = 0U,       /**< Up counting, MOD = period - 1 */
+    FTM_PWM_CENTER_ALIGNED  = 1U        /**< Up / down counting (CPWMS), MOD = period / 2 */
+} ftm_pwm_align_t;
+
+/**
+ * @brief PWM output polarity (CnSC[ELSB:ELSA])
+ */
+typedef enum {
+    FTM_PWM_HIGH_TRUE       = 2U,       /**< Output high during the duty cycle */
+    FTM_PWM_LOW_TRUE        = 1U        /**< Output low during the duty cycle */
+} ftm_pwm_polarity_t;
+
+/**
+ * @brief Deadtime prescaler (DEADTIME[DTPS])
+ */
+typedef enum {
+    FTM_DEADTIME_PRESCALER_1    = 0U,   /**< Deadtime counted in FTM clocks */
+    FTM_DEADTIME_PRESCALER_4    = 2U,   /**< Deadtime counted in FTM clocks / 4 */
+    FTM_DEADTIME_PRESCALER_16   = 3U    /**< Deadtime counted in FTM clocks / 16 */
+} ftm_deadtime_prescaler_t;
+
+/**
+ * @brief PWM channel configuration
+ */
+typedef struct {
+    uint8_t channel;                    /**< FTM channel (0-7), even when complementary */
+    ftm_pwm_polarity_t polarity;        /**< Output polarity */
+    uint16_t duty;                      /**< Initial duty in counter ticks (0 - period) */
+    bool complementary;                 /**< Drive channel + 1 with the complement and deadtime */
+} ftm_pwm_channel_config_t;
+
+/**
+ * @brief PWM configuration
+ */
+typedef struct {
+    ftm_pwm_align_t alignment;          /**< Edge or center aligned */
+    uint16_t period;                    /**< Period in counter ticks (2-65535, center: even) */
+    ftm_deadtime_prescaler_t deadtimePrescaler; /**< Deadtime clock */
+    uint8_t deadtimeTicks;              /**< Deadtime for complementary pairs (0-63) */
+    const ftm_pwm_channel_config_t *channels; /**< Channel list */
+    uint8_t channelCount;               /**< Entries in channels */
+} ftm_pwm_config_t;
+
+/**
+ * @brief PWM duty DMA configuration
+ * @details On every match of the channel the DMA writes the next table entry
+ *          into the CnV buffer, PWMLOAD loads it at the next reload point.
+ */
+typedef struct {
+    uint8_t dmaChannel;                 /**< eDMA channel (0-15) */
+    const uint16_t *table;              /**< CnV values (see FTM_PwmDutyToValue()), 1..MOD */
+    uint16_t count;                     /**< Table entries */
+    bool circular;                      /**< true: repeat the table forever */
+    dma_callback_t callback;            /**< Major loop complete callback (NULL = none) */
+    void *userData;                     /**< Passed to callback */
+} ftm_pwm_dma_config_t;
+
+/** @} */ /* End of FTM_Definitions */
+
+/*******************************************************************************
+ * API Function Prototypes
+ ******************************************************************************/
+
+/**
+ * @defgroup FTM_Functions FTM Functions
+ * @{
+ */
+
+/**
+ * @brief Initialize an FTM instance
+ * @details Enables the PCC clock gate, stops the counter, disables write
+ *          protection, enables the FTM feature set (FTMEN) and programs
+ *          CNTIN = 0, MOD and the prescaler. The counter stays stopped until
+ *          FTM_Start().
+ *
+ * @param[in] instance FTM instance (0-3)
+ * @param[in] config   Counter configuration
+ *
+ * @return STATUS_SUCCESS if successful
+ * @return STATUS_ERROR if parameters are invalid
+ *
+ * @note With FTM_CLOCK_SOURCE_EXTERNAL the PCC PCS must be selected
+ *       beforehand (PCC_GetFtmClockFreq() != 0)
+ */
+status_t FTM_Init(uint8_t instance, const ftm_config_t *config);
+
+/**
+ * @brief Stop the counter, disable every channel and gate the clock
+ * @param[in] instance FTM instance (0-3)
+ * @return STATUS_SUCCESS if successful, STATUS_ERROR if instance invalid
+ */
+status_t FTM_Deinit(uint8_t instance);
+
+/**
+ * @brief Start the counter with the configured clock source
+ * @param[in] instance FTM instance (0-3)
+ * @return STATUS_SUCCESS if successful, STATUS_ERROR if not initialized
+ */
+status_t FTM_Start(uint8_t instance);
+
+/**
+ * @brief Stop the counter (CLKS = 0), CNT keeps its value
+ * @param[in] instance FTM instance (0-3)
+ * @return STATUS_SUCCESS if successful, STATUS_ERROR if instance invalid
+ */
+status_t FTM_Stop(uint8_t instance);
+
+/**
+ * @brief Counter tick frequency (source clock / prescaler)
+ * @param[in] instance FTM instance (0-3)
+ * @return uint32_t Frequency in Hz, 0 if not initialized
+ */
+uint32_t FTM_GetCounterFreq(uint8_t instance);
+
+/**
+ * @brief Read the 16-bit counter
+ * @param[in] instance FTM instance (0-3)
+ * @return uint16_t CNT, 0 if instance invalid
+ */
+uint16_t FTM_GetCounter(uint8_t instance);
+
+/**
+ * @brief Read the overflow-extended counter
+ * @details (overflows * (MOD + 1)) + CNT, consistent even if TOF is pending
+ *          and not yet serviced. In quadrature mode overflows count down on
+ *          underflow, so the result is a signed position.
+ *
+ * @param[in] instance FTM instance (0-3)
+ * @return int32_t Extended counter, 0 if extension not enabled
+ *
+ * @note Requires enableOverflowExtension and FTM_OverflowIRQHandler()
+ *       hooked to FTMx_Ovf_Reload_IRQHandler
+ */
+int32_t FTM_GetExtendedCounter(uint8_t instance);
+
+/**
+ * @brief Reset CNT to CNTIN and clear the overflow extension
+ * @param[in] instance FTM instance (0-3)
+ * @return STATUS_SUCCESS if successful, STATUS_ERROR if instance invalid
+ */
+status_t FTM_ResetCounter(uint8_t instance);
+
+/**
+ * @brief Configure quadrature decoder mode
+ * @details Phase A / B are the CH0 / CH1 inputs. The counter runs from 0 to
+ *          MOD and counts up / down with the encoder; combine with
+ *          enableOverflowExtension for a 32-bit position. Call after
+ *          FTM_Init() and before FTM_Start() (the FTM clock is still needed
+ *          for input synchronization and filtering).
+ *
+ * @param[in] instance FTM instance (1 or 2, quadrature decoder instances)
+ * @param[in] config   Decoder configuration
+ *
+ * @return STATUS_SUCCESS if successful
+ * @return STATUS_ERROR if instance has no decoder or parameters are invalid
+ *
+ * @code
+ * ftm_config_t cnt = { FTM_CLOCK_SOURCE_SYSTEM, FTM_PRESCALER_1, 0xFFFFU, true };
+ * ftm_qd_config_t qd = { FTM_QD_MODE_PHASE_AB, false, false, 2U, 2U };
+ * FTM_Init(1U, &cnt);
+ * FTM_QuadDecoderInit(1U, &qd);
+ * FTM_Start(1U);
+ * int32_t position = FTM_GetExtendedCounter(1U);
+ * @endcode
+ */
+status_t FTM_QuadDecoderInit(uint8_t instance, const ftm_qd_config_t *config);
+
+/**
+ * @brief Direction of the last count in quadrature mode (QDCTRL[QUADIR])
+ * @param[in] instance FTM instance (1 or 2)
+ * @return bool true = counting up
+ */
+bool FTM_QuadDecoderIsCountingUp(uint8_t instance);
+
+/**
+ * @brief Configure a channel for input capture
+ * @details The counter should be free-running (modulo 0xFFFF) so capture
+ *          differences wrap naturally.
+ *
+ * @param[in] instance FTM instance (0-3)
+ * @param[in] config   Channel configuration
+ *
+ * @return STATUS_SUCCESS if successful
+ * @return STATUS_ERROR if parameters are invalid
+ */
+status_t FTM_InputCaptureInit(uint8_t instance, const ftm_ic_config_t *config);
+
+/**
+ * @brief Read the last captured value of a channel
+ * @param[in] instance FTM instance (0-3)
+ * @param[in] channel  FTM channel (0-7)
+ * @return uint16_t CnV, 0 if parameters are invalid
+ */
+uint16_t FTM_GetCaptureValue(uint8_t instance, uint8_t channel);
+
+/**
+ * @brief Stream captures of a channel into memory via eDMA
+ * @details Sets CnSC[DMA] + CHIE so each capture raises a DMA request
+ *          instead of an interrupt. The channel callback is not called
+ *          while DMA is active.
+ *
+ * @param[in] instance FTM instance (0-3)
+ * @param[in] channel  FTM channel with a DMAMUX request (FTM0 / FTM3: 0-7, FTM1 / FTM2: 0-1)
+ * @param[in] config   DMA configuration
+ *
+ * @return STATUS_SUCCESS if successful
+ * @return STATUS_ERROR if the channel has no DMA request or DMA setup failed
+ *
+ * @note DMA_Init() must have been called
+ */
+status_t FTM_InputCaptureStartDma(uint8_t instance, uint8_t channel,
+                                  const ftm_ic_dma_config_t *config);
+
+/**
+ * @brief Stop capture DMA of a channel (capture itself stays enabled)
+ * @param[in] instance FTM instance (0-3)
+ * @param[in] channel  FTM channel (0-7)
+ * @return STATUS_SUCCESS if successful, STATUS_ERROR if parameters are invalid
+ */
+status_t FTM_InputCaptureStopDma(uint8_t instance, uint8_t channel);
+
+/**
+ * @brief Install a channel event callback
+ * @param[in] instance FTM instance (0-3)
+ * @param[in] channel  FTM channel (0-7)
+ * @param[in] callback Callback (NULL to remove)
+ * @param[in] userData Passed to callback
+ * @return STATUS_SUCCESS if successful, STATUS_ERROR if parameters are invalid
+ */
+status_t FTM_InstallChannelCallback(uint8_t instance, uint8_t channel,
+                                    ftm_channel_callback_t callback, void *userData);
+
+/**
+ * @brief Install the counter overflow callback
+ * @param[in] instance FTM instance (0-3)
+ * @param[in] callback Callback (NULL to remove), called after the extension update
+ * @param[in] userData Passed to callback
+ * @return STATUS_SUCCESS if successful, STATUS_ERROR if instance invalid
+ */
+status_t FTM_InstallOverflowCallback(uint8_t instance, ftm_overflow_callback_t callback,
+                                     void *userData);
+
+/**
+ * @brief Channel interrupt handler
+ * @details Reads STATUS once, clears the captured flags with one write and
+ *          dispatches callbacks of the non-DMA channels.
+ * @param[in] instance FTM instance (0-3)
+ * @note Call from every FTMx_ChN_ChM_IRQHandler of the instance
+ */
+void FTM_ChannelIRQHandler(uint8_t instance);
+
+/**
+ * @brief Counter overflow interrupt handler
+ * @param[in] instance FTM instance (0-3)
+ * @note Call from FTMx_Ovf_Reload_IRQHandler
+ */
+void FTM_OverflowIRQHandler(uint8_t instance);
+
+/**
+ * @brief Configure PWM generation
+ * @details Programs MOD from the period, the channel modes / polarities,
+ *          complementary pairs with deadtime and enhanced synchronization
+ *          (reload at counter max for edge-aligned, at counter min for
+ *          center-aligned). Channel outputs are enabled (SC[PWMENn]).
+ *          Call after FTM_Init() with the counter stopped, then FTM_Start().
+ *
+ * @param[in] instance FTM instance (0-3)
+ * @param[in] config   PWM configuration
+ *
+ * @return STATUS_SUCCESS if successful
+ * @return STATUS_BUSY if the counter is running
+ * @return STATUS_ERROR if parameters are invalid
+ *
+ * @code
+ * // 3-phase inverter on FTM0: 20 kHz center-aligned @ 80 MHz, 500 ns deadtime
+ * static const ftm_pwm_channel_config_t phases[3] = {
+ *     { 0U, FTM_PWM_HIGH_TRUE, 2000U, true },     // U: CH0 / CH1
+ *     { 2U, FTM_PWM_HIGH_TRUE, 2000U, true },     // V: CH2 / CH3
+ *     { 4U, FTM_PWM_HIGH_TRUE, 2000U, true }      // W: CH4 / CH5
+ * };
+ * ftm_pwm_config_t pwm = { FTM_PWM_CENTER_ALIGNED, 4000U,
+ *                          FTM_DEADTIME_PRESCALER_1, 40U, phases, 3U };
+ * FTM_PwmInit(0U, &pwm);
+ * FTM_Start(0U);
+ * FTM_PwmSetDuty(0U, 0U, 1000U);
+ * FTM_PwmSetDuty(0U, 2U, 3000U);
+ * FTM_PwmUpdate(0U);                              // both phases change in the same period
+ * @endcode
+ */
+status_t FTM_PwmInit(uint8_t instance, const ftm_pwm_config_t *config);
+
+/**
+ * @brief Convert a duty in counter ticks to a CnV value
+ * @param[in] instance FTM instance (0-3)
+ * @param[in] duty     Duty in counter ticks (0 - period)
+ * @return uint16_t CnV (edge: duty, center: duty / 2)
+ */
+uint16_t FTM_PwmDutyToValue(uint8_t instance, uint16_t duty);
+
+/**
+ * @brief Write a new duty into the CnV buffer
+ * @details Takes effect at the reload point after FTM_PwmUpdate() (or
+ *          automatically when PWMLOAD is enabled for the channel).
+ * @param[in] instance FTM instance (0-3)
+ * @param[in] channel  FTM channel (0-7, even channel of a complementary pair)
+ * @param[in] duty     Duty in counter ticks (0 - period)
+ * @return STATUS_SUCCESS if successful, STATUS_ERROR if parameters are invalid
+ */
+status_t FTM_PwmSetDuty(uint8_t instance, uint8_t channel, uint16_t duty);
+
+/**
+ * @brief Write a new period into the MOD buffer
+ * @param[in] instance FTM instance (0-3)
+ * @param[in] period   Period in counter ticks
+ * @return STATUS_SUCCESS if successful, STATUS_ERROR if parameters are invalid
+ * @note Duties are not rescaled, update them before FTM_PwmUpdate()
+ */
+status_t FTM_PwmSetPeriod(uint8_t instance, uint16_t period);
+
+/**
+ * @brief Apply buffered MOD / CnV writes at the next reload point
+ * @details Software trigger (SYNC[SWSYNC]); hardware clears it once the
+ *          registers are loaded, so all channels switch in the same period.
+ * @param[in] instance FTM instance (0-3)
+ * @return STATUS_SUCCESS if successful, STATUS_ERROR if PWM not configured
+ */
+status_t FTM_PwmUpdate(uint8_t instance);
+
+/**
+ * @brief Check whether the last FTM_PwmUpdate() has been loaded
+ * @param[in] instance FTM instance (0-3)
+ * @return bool true when SWSYNC has been cleared by hardware
+ */
+bool FTM_PwmIsUpdateDone(uint8_t instance);
+
+/**
+ * @brief Feed the duty of a channel from a waveform table via eDMA
+ * @details Selects the channel in PWMLOAD (LDOK) so the CnV buffer written
+ *          by DMA on each channel match is loaded at every reload point.
+ *          Three phases use three DMA channels, each paced by its own match.
+ *
+ * @param[in] instance FTM instance (0-3)
+ * @param[in] channel  FTM channel with a DMAMUX request (FTM0 / FTM3: 0-7, FTM1 / FTM2: 0-1)
+ * @param[in] config   DMA configuration
+ *
+ * @return STATUS_SUCCESS if successful
+ * @return STATUS_ERROR if PWM not configured, no DMA request or DMA setup failed
+ *
+ * @note Table values must stay in 1..MOD, a channel without match stops the stream
+ */
+status_t FTM_PwmStartDma(uint8_t instance, uint8_t channel, const ftm_pwm_dma_config_t *config);
+
+/**
+ * @brief Stop the duty DMA of a channel (last duty is kept)
+ * @param[in] instance FTM instance (0-3)
+ * @param[in] channel  FTM channel (0-7)
+ * @return STATUS_SUCCESS if successful, STATUS_ERROR if parameters are invalid
+ */
+status_t FTM_PwmStopDma(uint8_t instance, uint8_t channel);
+
+/** @} */ /* End of FTM_Functions */
+
+#endif /* FTM_H */
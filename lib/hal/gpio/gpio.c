@@ -123,6 +123,65 @@ void GPIO_SetPinDirection(gpio_port_t port, uint8_t pin, gpio_direction_t direct
     }
 }
 
+void GPIO_WritePortMasked(gpio_port_t port, uint32_t mask, uint32_t value)
+{
+    GPIO_Type *base = GPIO_GetBase(port);
+
+    base->PSOR = value & mask;
+    base->PCOR = ~value & mask;
+}
+
+uint32_t GPIO_ReadPort(gpio_port_t port)
+{
+    GPIO_Type *base = GPIO_GetBase(port);
+
+    return base->PDIR;
+}
+
+void GPIO_SetPortDirection(gpio_port_t port, uint32_t mask, gpio_direction_t direction)
+{
+    GPIO_Type *base = GPIO_GetBase(port);
+
+    if (direction == GPIO_DIR_OUTPUT) {
+        base->PDDR |= mask;
+    } else {
+        base->PDDR &= ~mask;
+    }
+}
+
+bool GPIO_BusInit(gpio_bus_t *bus, gpio_port_t port, uint8_t firstPin,
+                  uint8_t width, gpio_direction_t direction)
+{
+    uint8_t pin;
+
+    if ((bus == NULL) || (width == 0U) || (((uint32_t)firstPin + width) > 32U)) {
+        return false;
+    }
+
+    bus->port = port;
+    bus->firstPin = firstPin;
+    bus->width = width;
+    bus->mask = ((width == 32U) ? 0xFFFFFFFFU : ((1U << width) - 1U)) << firstPin;
+
+    PORT_EnableClock((port_name_t)port);
+    for (pin = firstPin; pin < (uint8_t)(firstPin + width); pin++) {
+        PORT_SetPinMux((port_name_t)port, pin, PORT_MUX_GPIO);
+    }
+    GPIO_SetPortDirection(port, bus->mask, direction);
+
+    return true;
+}
+
+void GPIO_BusWrite(const gpio_bus_t *bus, uint32_t value)
+{
+    GPIO_WritePortMasked(bus->port, bus->mask, value << bus->firstPin);
+}
+
+uint32_t GPIO_BusRead(const gpio_bus_t *bus)
+{
+    return (GPIO_ReadPort(bus->port) & bus->mask) >> bus->firstPin;
+}
+
 /*******************************************************************************
  * EOF
  ******************************************************************************/
\ No newline at end of file
@@ -57,6 +57,45 @@ typedef enum {
     GPIO_LEVEL_HIGH = 1U     /**< Logic level high */
 } gpio_level_t;
 
+/**
+ * @brief Parallel bus descriptor (contiguous pins of one port)
+ * @details Filled by GPIO_BusInit(). A bus write updates all pins with one
+ *          PSOR / PCOR pair instead of one register write per pin.
+ */
+typedef struct {
+    gpio_port_t port;        /**< GPIO port */
+    uint8_t firstPin;        /**< Lowest pin, bus bit 0 */
+    uint8_t width;           /**< Number of pins (1-32) */
+    uint32_t mask;           /**< Port mask of the bus pins */
+} gpio_bus_t;
+
+/**
+ * @brief GPIO register block of a port, constant when port is constant
+ * @param port GPIO port (gpio_port_t)
+ */
+#define GPIO_PORT_BASE(port)    ((GPIO_Type *)(PTA_BASE_ADDR + ((uint32_t)(port) * 0x40UL)))
+
+/**
+ * @brief Pin descriptor resolved at compile time
+ * @details Holds the register block and the pin mask, so the inline
+ *          GPIO_Pin* accessors compile to a single store to PSOR / PCOR /
+ *          PTOR (or one PDIR load) with no table lookup or shift.
+ */
+typedef struct {
+    GPIO_Type *base;         /**< GPIO register block */
+    uint32_t mask;           /**< Pin mask */
+} gpio_pin_t;
+
+/**
+ * @brief Pin descriptor initializer
+ * @par Example:
+ * @code
+ * static const gpio_pin_t s_ledGreen = GPIO_PIN_DEF(GPIO_PORT_D, 16U);
+ * GPIO_PinToggle(s_ledGreen);
+ * @endcode
+ */
+#define GPIO_PIN_DEF(port, pin) { GPIO_PORT_BASE(port), GPIO_PIN(pin) }
+
 /** @} */ /* End of GPIO_Definitions */
 
 /*******************************************************************************
@@ -194,8 +233,127 @@ void GPIO_TogglePin(gpio_port_t port, uint8_t pin);
  */
 void GPIO_SetPinDirection(gpio_port_t port, uint8_t pin, gpio_direction_t direction);
 
+/**
+ * @brief Write several pins of a port
+ * @details Pins in mask are driven to the matching bit of value with one
+ *          PSOR and one PCOR write; pins outside mask are not touched.
+ * @param[in] port GPIO port (GPIO_PORT_A to GPIO_PORT_E)
+ * @param[in] mask Pins to update
+ * @param[in] value New levels (bit n = pin n)
+ * @return None
+ * @note Set bits are written before cleared bits, so for one bus clock the
+ *       port shows the OR of old and new value. Latch data with a separate
+ *       strobe pin when the receiver must never see that state.
+ * @par Example:
+ * @code
+ * GPIO_WritePortMasked(GPIO_PORT_D, 0x000000FFU, 0x5AU);  // PTD0-7 = 0x5A
+ * @endcode
+ */
+void GPIO_WritePortMasked(gpio_port_t port, uint32_t mask, uint32_t value);
+
+/**
+ * @brief Read all input levels of a port
+ * @param[in] port GPIO port (GPIO_PORT_A to GPIO_PORT_E)
+ * @return uint32_t PDIR (bit n = pin n)
+ */
+uint32_t GPIO_ReadPort(gpio_port_t port);
+
+/**
+ * @brief Set direction of several pins of a port
+ * @param[in] port GPIO port (GPIO_PORT_A to GPIO_PORT_E)
+ * @param[in] mask Pins to update
+ * @param[in] direction Direction for every pin in mask
+ * @return None
+ */
+void GPIO_SetPortDirection(gpio_port_t port, uint32_t mask, gpio_direction_t direction);
+
+/**
+ * @brief Initialize a parallel bus of contiguous pins
+ * @details Configures every pin as GPIO with the given direction and fills
+ *          the descriptor.
+ * @param[out] bus Bus descriptor
+ * @param[in] port GPIO port (GPIO_PORT_A to GPIO_PORT_E)
+ * @param[in] firstPin Lowest pin (bus bit 0)
+ * @param[in] width Number of pins (1-32, firstPin + width <= 32)
+ * @param[in] direction Bus direction
+ * @return bool false on invalid parameters
+ * @par Example:
+ * @code
+ * gpio_bus_t lcdData;
+ * GPIO_BusInit(&lcdData, GPIO_PORT_D, 0U, 8U, GPIO_DIR_OUTPUT);
+ * GPIO_BusWrite(&lcdData, 0xA5U);
+ * @endcode
+ */
+bool GPIO_BusInit(gpio_bus_t *bus, gpio_port_t port, uint8_t firstPin,
+                  uint8_t width, gpio_direction_t direction);
+
+/**
+ * @brief Write a value to a bus (one PSOR / PCOR pair)
+ * @param[in] bus Bus descriptor
+ * @param[in] value Bus value, bit 0 on firstPin
+ * @return None
+ */
+void GPIO_BusWrite(const gpio_bus_t *bus, uint32_t value);
+
+/**
+ * @brief Read a bus
+ * @param[in] bus Bus descriptor
+ * @return uint32_t Bus value, bit 0 from firstPin
+ */
+uint32_t GPIO_BusRead(const gpio_bus_t *bus);
+
 /** @} */ /* End of GPIO_Functions */
 
+/*******************************************************************************
+ * Inline Pin Access
+ ******************************************************************************/
+
+/**
+ * @defgroup GPIO_Inline GPIO Inline Pin Access
+ * @brief Single-store accessors for compile-time pin descriptors
+ * @details With a const descriptor the compiler folds base and mask into
+ *          immediates: a set / clear / toggle is one STR (1-2 cycles on the
+ *          M4 at zero wait state), suitable for bit-banged protocols.
+ * @note Pin must be muxed as GPIO with the right direction (GPIO_Init()).
+ * @{
+ */
+
+/** @brief Drive pin high */
+static inline void GPIO_PinSet(const gpio_pin_t pin)
+{
+    pin.base->PSOR = pin.mask;
+}
+
+/** @brief Drive pin low */
+static inline void GPIO_PinClear(const gpio_pin_t pin)
+{
+    pin.base->PCOR = pin.mask;
+}
+
+/** @brief Invert pin output */
+static inline void GPIO_PinToggle(const gpio_pin_t pin)
+{
+    pin.base->PTOR = pin.mask;
+}
+
+/** @brief Drive pin to level (true = high) */
+static inline void GPIO_PinWrite(const gpio_pin_t pin, bool high)
+{
+    if (high) {
+        pin.base->PSOR = pin.mask;
+    } else {
+        pin.base->PCOR = pin.mask;
+    }
+}
+
+/** @brief Read pin input level */
+static inline bool GPIO_PinRead(const gpio_pin_t pin)
+{
+    return ((pin.base->PDIR & pin.mask) != 0U);
+}
+
+/** @} */ /* End of GPIO_Inline */
+
 #endif /* GPIO_H */
 
 /*******************************************************************************
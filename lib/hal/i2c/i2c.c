@@ -14,6 +14,10 @@
 #include "i2c.h"
 #include "i2c_reg.h"
 #include "pcc_reg.h"
+#include "pcc.h"
+#include "nvic.h"
+#include "dma.h"
+#include "osal.h"
 
 /*******************************************************************************
  * Private Definitions
@@ -23,10 +27,150 @@
 #define I2C_TIMEOUT_COUNT       (10000U)
 
 /* I2C commands for master transmit data register */
-#define I2C_CMD_START           (0x400U)    /* Generate START condition */
-#define I2C_CMD_STOP            (0x200U)    /* Generate STOP condition */
-#define I2C_CMD_TRANSMIT        (0x000U)    /* Transmit data */
-#define I2C_CMD_RECEIVE         (0x100U)    /* Receive data */
+#define I2C_CMD_START           (LPI2C_MTDR_CMD(LPI2C_CMD_START))       /* Generate START condition */
+#define I2C_CMD_STOP            (LPI2C_MTDR_CMD(LPI2C_CMD_STOP))        /* Generate STOP condition */
+#define I2C_CMD_TRANSMIT        (LPI2C_MTDR_CMD(LPI2C_CMD_TRANSMIT))    /* Transmit data */
+#define I2C_CMD_RECEIVE         (LPI2C_MTDR_CMD(LPI2C_CMD_RECEIVE))     /* Receive data */
+#define I2C_CMD_START_HS        (LPI2C_MTDR_CMD(LPI2C_CMD_START_HS))    /* START in high-speed mode */
+#define I2C_CMD_MASTER_CODE     (LPI2C_MTDR_CMD(LPI2C_CMD_START_EXPECT_NACK) | LPI2C_HS_MASTER_CODE)
+
+/* One receive command reads up to DATA + 1 = 256 bytes */
+#define I2C_RX_CMD_MAX          (256U)
+
+/* Master error flags */
+#define I2C_MSR_ERROR_MASK      (LPI2C_MSR_NDF_MASK | LPI2C_MSR_ALF_MASK | LPI2C_MSR_FEF_MASK)
+
+/* Timing field limits (6-bit MCCRn fields) */
+#define I2C_CCR_FIELD_MAX       (63U)
+#define I2C_CLKLO_MIN           (3U)
+#define I2C_CLKHI_MIN           (1U)
+#define I2C_SETHOLD_MIN         (2U)
+#define I2C_DATAVD_MIN          (1U)
+#define I2C_PRESCALE_MAX        (7U)
+
+/* Master code phase of HS mode runs at Fm */
+#define I2C_HS_MASTER_CODE_BAUD (400000U)
+
+/* Slave W1C flags and interrupts of the event-driven slave */
+#define I2C_SSR_W1C_MASK        (LPI2C_SSR_RSF_MASK | LPI2C_SSR_SDF_MASK | LPI2C_SSR_BEF_MASK | LPI2C_SSR_FEF_MASK)
+#define I2C_SSR_ERROR_MASK      (LPI2C_SSR_BEF_MASK | LPI2C_SSR_FEF_MASK)
+#define I2C_SIER_ASYNC_MASK     (LPI2C_SIER_TDIE_MASK | LPI2C_SIER_RDIE_MASK | LPI2C_SIER_AVIE_MASK | \
+                                 LPI2C_SIER_RSIE_MASK | LPI2C_SIER_SDIE_MASK | LPI2C_SIER_BEIE_MASK | \
+                                 LPI2C_SIER_FEIE_MASK)
+
+/* Major loop count limit of one slave DMA transfer (CITER without channel link) */
+#define I2C_SLAVE_DMA_MAX       (32767U)
+
+/*******************************************************************************
+ * Private Types and Variables
+ ******************************************************************************/
+
+/** @brief Command generation phase of the running transfer */
+typedef enum {
+    I2C_ASYNC_ADDRESS = 0U,     /**< START + address not yet queued */
+    I2C_ASYNC_REGISTER,         /**< Queuing register address bytes */
+    I2C_ASYNC_RESTART,          /**< Repeated START + address (read) not yet queued */
+    I2C_ASYNC_DATA,             /**< Queuing transmit / receive commands */
+    I2C_ASYNC_STOP,             /**< STOP not yet queued */
+    I2C_ASYNC_WAIT              /**< All commands queued, waiting for RX bytes / STOP */
+} i2c_async_phase_t;
+
+/** @brief UM10204 limits for one bus mode, in ns */
+typedef struct {
+    uint16_t tLowMin;           /**< SCL low period */
+    uint16_t tHighMin;          /**< SCL high period */
+    uint16_t tSuStaMin;         /**< (Repeated) START setup / hold, STOP setup */
+    uint16_t tVdDatMax;         /**< Data valid time */
+} i2c_mode_limits_t;
+
+static const i2c_mode_limits_t s_i2cModeLimits[] = {
+    { 4700U, 4000U, 4700U, 3450U },     /* Sm */
+    { 1300U,  600U,  600U,  900U },     /* Fm */
+    {  500U,  260U,  260U,  450U },     /* Fm+ */
+    {  160U,   60U,  160U,   70U }      /* HS, Cb = 100 pF */
+};
+
+/** @brief Driver state per instance (asynchronous engine + bus mode) */
+typedef struct {
+    bool highSpeed;             /**< HS mode: master code + START_HS commands */
+    bool busHeld;               /**< HS master code sent, bus not released yet */
+    bool enabled;               /**< I2C_MasterEnableAsync() done */
+    bool clockHeld;             /**< PCC clock reference held while the queue is busy */
+    uint8_t txFifoSize;         /**< Command FIFO depth in words */
+    i2c_async_phase_t phase;    /**< Phase of the head transfer */
+    uint8_t regIndex;           /**< Register bytes written */
+    uint32_t cmdIndex;          /**< Bytes written (TX) or requested (RX) */
+    uint32_t rxIndex;           /**< Bytes received */
+    I2C_Transfer_t *head;       /**< Running transfer */
+    I2C_Transfer_t *tail;       /**< Last queued transfer */
+    osal_mutex_t busLock;       /**< I2C_MasterLockBus() */
+#if OSAL_FREERTOS
+    osal_event_t done;          /**< Signalled when waitTransfer completes */
+    I2C_Transfer_t *volatile waitTransfer;  /**< Descriptor a task sleeps on */
+#endif
+} i2c_async_state_t;
+
+static i2c_async_state_t s_i2cAsync[LPI2C_INSTANCE_COUNT];
+
+/** @brief Event-driven slave state per instance */
+typedef struct {
+    LPI2C_RegType *base;        /**< Peripheral (DMA callback context) */
+    bool enabled;               /**< I2C_SlaveEnableAsync() done */
+    bool active;                /**< Address matched, phase not ended yet */
+    bool useDma;                /**< Data phase moved by eDMA */
+    bool dmaRunning;            /**< DMA owns the data register */
+    bool overflow;              /**< Buffer ran out in this phase (fill / drop) */
+    bool lastWasData;           /**< Last STDR write was data, not a fill byte */
+    bool pointerNext;           /**< Register map: next received byte is the pointer */
+    bool writeValid;            /**< Register map: a write phase has been seen */
+    uint8_t rxDmaChannel;       /**< Slave receive DMA channel */
+    uint8_t txDmaChannel;       /**< Slave transmit DMA channel */
+    I2C_Direction_t direction;  /**< Direction of the phase (master view) */
+    I2C_SlaveCallback_t callback; /**< Event callback */
+    void *userData;             /**< Callback user data */
+    const uint8_t *txBuff;      /**< Transmit data of the phase */
+    uint32_t txSize;            /**< Bytes in txBuff */
+    uint32_t txIndex;           /**< Next byte of txBuff */
+    uint8_t *rxBuff;            /**< Receive buffer of the phase */
+    uint32_t rxSize;            /**< Bytes in rxBuff */
+    uint32_t rxIndex;           /**< Next byte of rxBuff */
+    const uint8_t *appTxBuff;   /**< Buffer mode: I2C_SlaveSetTxBuffer() */
+    uint32_t appTxSize;
+    uint8_t *appRxBuff;         /**< Buffer mode: I2C_SlaveSetRxBuffer() */
+    uint32_t appRxSize;
+    uint32_t count;             /**< Data bytes of the phase */
+    uint32_t dmaSize;           /**< Major loops of the running DMA transfer */
+    uint8_t *regMap;            /**< Register map, NULL in buffer mode */
+    uint32_t regMapSize;        /**< Register map bytes */
+    uint32_t regPointer;        /**< Register pointer */
+    uint8_t writeFirst;         /**< Last write phase: pointer sent by the master */
+    uint32_t writeCount;        /**< Last write phase: bytes stored */
+} i2c_slave_state_t;
+
+static i2c_slave_state_t s_i2cSlave[LPI2C_INSTANCE_COUNT];
+
+/*******************************************************************************
+ * Private Function Prototypes
+ ******************************************************************************/
+static i2c_async_state_t *I2C_GetAsyncState(LPI2C_RegType *base);
+static uint32_t I2C_NsToCycles(uint32_t ns, uint32_t srcClock, uint32_t prescale);
+static I2C_Status_t I2C_CalculateTimingAt(uint32_t srcClock, I2C_BusMode_t mode, uint32_t baudRate,
+                                          uint32_t riseCycles, uint8_t filtScl, uint32_t prescale,
+                                          bool allowSlower, I2C_Timing_t *timing);
+static void I2C_AsyncComplete(LPI2C_RegType *base, i2c_async_state_t *state, I2C_Status_t status);
+static void I2C_AsyncPump(LPI2C_RegType *base, i2c_async_state_t *state);
+static bool I2C_AsyncNextCommand(i2c_async_state_t *state, uint32_t *command);
+static I2C_Status_t I2C_AsyncCheckTransfer(const I2C_Transfer_t *transfer);
+static void I2C_AsyncEnqueue(i2c_async_state_t *state, I2C_Transfer_t *transfer);
+static i2c_slave_state_t *I2C_GetSlaveState(LPI2C_RegType *base);
+static void I2C_SlaveNotify(i2c_slave_state_t *state, I2C_SlaveEvent_t event);
+static void I2C_SlaveStartDma(i2c_slave_state_t *state);
+static void I2C_SlaveStopDma(i2c_slave_state_t *state);
+static void I2C_SlaveDmaCallback(uint8_t channel, void *userData);
+static void I2C_SlaveStartPhase(i2c_slave_state_t *state, uint32_t sasr);
+static void I2C_SlaveEndPhase(i2c_slave_state_t *state);
+static void I2C_SlaveReceiveByte(i2c_slave_state_t *state, uint8_t data);
+static void I2C_SlaveTransmitByte(i2c_slave_state_t *state);
 
 /*******************************************************************************
  * Master Mode Functions
@@ -40,6 +184,7 @@ I2C_Status_t I2C_MasterInit(LPI2C_RegType *base, const I2C_MasterConfig_t *confi
     uint32_t prescaler;
     uint32_t clkLo, clkHi, setHold, dataVd;
     uint32_t baudRateHz;
+    i2c_async_state_t *state;
 
     if ((base == NULL) || (config == NULL)) {
         return I2C_STATUS_ERROR;
@@ -78,6 +223,15 @@ I2C_Status_t I2C_MasterInit(LPI2C_RegType *base, const I2C_MasterConfig_t *confi
                   LPI2C_MCCR0_SETHOLD(setHold) |
                   LPI2C_MCCR0_DATAVD(dataVd);
 
+    /* Back to single-speed START commands until I2C_MasterConfigBusSpeed() */
+    state = I2C_GetAsyncState(base);
+    if (state != NULL) {
+        state->highSpeed = false;
+        if (OSAL_MutexInit(&state->busLock) != OSAL_STATUS_SUCCESS) {
+            return I2C_STATUS_ERROR;
+        }
+    }
+
     /* Configure debug mode */
     if (config->enableDebug) {
         base->MCR |= LPI2C_MCR_DBGEN_MASK;
@@ -112,6 +266,7 @@ I2C_Status_t I2C_MasterStart(LPI2C_RegType *base, uint8_t slaveAddress, I2C_Dire
 {
     uint32_t timeout = I2C_TIMEOUT_COUNT;
     uint16_t cmdData;
+    i2c_async_state_t *state;
 
     if (base == NULL) {
         return I2C_STATUS_ERROR;
@@ -137,6 +292,13 @@ I2C_Status_t I2C_MasterStart(LPI2C_RegType *base, uint8_t slaveAddress, I2C_Dire
         return I2C_STATUS_TIMEOUT;
     }
 
+    /* HS mode: master code at Fm timing, then START with MCCR1 timing */
+    state = I2C_GetAsyncState(base);
+    if ((state != NULL) && state->highSpeed) {
+        LPI2C_WRITE_DATA(base, I2C_CMD_MASTER_CODE);
+        cmdData = I2C_CMD_START_HS | ((uint16_t)slaveAddress << 1) | (uint16_t)direction;
+    }
+
     /* Send START + Address + R/W */
     LPI2C_WRITE_DATA(base, cmdData);
 
@@ -328,6 +490,727 @@ void I2C_MasterClearStatus(LPI2C_RegType *base, uint32_t flags)
     }
 }
 
+/*******************************************************************************
+ * Master Timing Functions
+ ******************************************************************************/
+
+/**
+ * @brief Convert ns to prescaled functional clock cycles (rounded up)
+ */
+static uint32_t I2C_NsToCycles(uint32_t ns, uint32_t srcClock, uint32_t prescale)
+{
+    uint64_t divisor = 1000000000ULL << prescale;
+
+    return (uint32_t)((((uint64_t)ns * srcClock) + divisor - 1U) / divisor);
+}
+
+/**
+ * @brief Calculate timing for one prescaler value
+ * 
+ * @param[in] allowSlower  Clamp CLKLO / CLKHI when the period does not fit
+ *                         (lower SCL rate) instead of failing
+ */
+static I2C_Status_t I2C_CalculateTimingAt(uint32_t srcClock, I2C_BusMode_t mode, uint32_t baudRate,
+                                          uint32_t riseCycles, uint8_t filtScl, uint32_t prescale,
+                                          bool allowSlower, I2C_Timing_t *timing)
+{
+    const i2c_mode_limits_t *limits = &s_i2cModeLimits[mode];
+    uint32_t latency;
+    uint32_t period;
+    uint32_t sum;
+    uint32_t minLo;
+    uint32_t minHi;
+    uint32_t clkLo;
+    uint32_t clkHi;
+    uint32_t setHold;
+    uint32_t dataVd;
+    uint32_t maxVd;
+
+    /* SCL_LATENCY: sync + glitch filter + rise time before CLKHI starts counting */
+    latency = (2U + (uint32_t)filtScl + riseCycles) >> prescale;
+
+    /* Round the period up so SCL never exceeds baudRate */
+    period = (uint32_t)(((uint64_t)srcClock + ((uint64_t)baudRate << prescale) - 1U) /
+                        ((uint64_t)baudRate << prescale));
+    if (period < (latency + 2U + I2C_CLKLO_MIN + I2C_CLKHI_MIN)) {
+        return I2C_STATUS_ERROR;
+    }
+
+    sum = period - 2U - latency;
+    if (sum > (2U * I2C_CCR_FIELD_MAX)) {
+        if (!allowSlower) {
+            return I2C_STATUS_ERROR;
+        }
+        sum = 2U * I2C_CCR_FIELD_MAX;
+    }
+
+    /* Low period = CLKLO + 1, high period = CLKHI + 1 + SCL_LATENCY */
+    minLo = I2C_NsToCycles(limits->tLowMin, srcClock, prescale);
+    minLo = (minLo > (I2C_CLKLO_MIN + 1U)) ? (minLo - 1U) : I2C_CLKLO_MIN;
+    minHi = I2C_NsToCycles(limits->tHighMin, srcClock, prescale);
+    minHi = (minHi > (latency + 1U + I2C_CLKHI_MIN)) ? (minHi - latency - 1U) : I2C_CLKHI_MIN;
+
+    /* Split in the ratio of the spec minimums, then enforce them */
+    clkLo = (sum * limits->tLowMin) / ((uint32_t)limits->tLowMin + limits->tHighMin);
+    if (clkLo < minLo) {
+        clkLo = minLo;
+    }
+    if (clkLo > I2C_CCR_FIELD_MAX) {
+        clkLo = I2C_CCR_FIELD_MAX;
+    }
+    if (clkLo >= sum) {
+        return I2C_STATUS_ERROR;
+    }
+    clkHi = sum - clkLo;
+    if (clkHi > I2C_CCR_FIELD_MAX) {
+        clkHi = I2C_CCR_FIELD_MAX;
+        clkLo = sum - clkHi;
+    }
+    if ((clkLo < minLo) || (clkHi < minHi) || (clkLo > I2C_CCR_FIELD_MAX)) {
+        return I2C_STATUS_ERROR;
+    }
+
+    setHold = I2C_NsToCycles(limits->tSuStaMin, srcClock, prescale);
+    setHold = (setHold > (I2C_SETHOLD_MIN + 1U)) ? (setHold - 1U) : I2C_SETHOLD_MIN;
+    if (setHold > I2C_CCR_FIELD_MAX) {
+        return I2C_STATUS_ERROR;
+    }
+
+    /* Data change early in the low phase, but within tVD;DAT */
+    maxVd = (uint32_t)(((uint64_t)limits->tVdDatMax * srcClock) / (1000000000ULL << prescale));
+    dataVd = clkLo / 4U;
+    if ((maxVd > I2C_DATAVD_MIN) && (dataVd > (maxVd - 1U))) {
+        dataVd = maxVd - 1U;
+    }
+    if (dataVd < I2C_DATAVD_MIN) {
+        dataVd = I2C_DATAVD_MIN;
+    }
+
+    timing->prescale = (uint8_t)prescale;
+    timing->clkLo = (uint8_t)clkLo;
+    timing->clkHi = (uint8_t)clkHi;
+    timing->setHold = (uint8_t)setHold;
+    timing->dataVd = (uint8_t)dataVd;
+    timing->actualBaudRate = (srcClock >> prescale) / (clkLo + clkHi + 2U + latency);
+
+    return I2C_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Calculate LPI2C master timing for a bus mode and baud rate
+ */
+I2C_Status_t I2C_CalculateTiming(uint32_t srcClock, I2C_BusMode_t mode, uint32_t baudRate,
+                                 uint32_t riseTimeNs, uint8_t filtScl, I2C_Timing_t *timing)
+{
+    uint32_t riseCycles;
+    uint32_t prescale;
+
+    if ((timing == NULL) || (srcClock == 0U) || (baudRate == 0U) ||
+        (mode > I2C_BUS_MODE_HIGH_SPEED)) {
+        return I2C_STATUS_ERROR;
+    }
+
+    riseCycles = I2C_NsToCycles(riseTimeNs, srcClock, 0U);
+
+    /* Smallest prescaler = finest CLKLO / CLKHI resolution */
+    for (prescale = 0U; prescale <= I2C_PRESCALE_MAX; prescale++) {
+        if (I2C_CalculateTimingAt(srcClock, mode, baudRate, riseCycles, filtScl,
+                                  prescale, false, timing) == I2C_STATUS_SUCCESS) {
+            return I2C_STATUS_SUCCESS;
+        }
+    }
+
+    return I2C_STATUS_ERROR;
+}
+
+/**
+ * @brief Configure master bus speed from the current LPI2C clock
+ */
+I2C_Status_t I2C_MasterConfigBusSpeed(LPI2C_RegType *base, I2C_BusMode_t mode, uint32_t baudRate,
+                                      uint32_t riseTimeNs, I2C_Timing_t *timing)
+{
+    i2c_async_state_t *state = I2C_GetAsyncState(base);
+    I2C_Timing_t busTiming;
+    I2C_Timing_t masterCode;
+    uint32_t srcClock;
+    uint8_t filtScl;
+    bool wasEnabled;
+
+    if (state == NULL) {
+        return I2C_STATUS_ERROR;
+    }
+
+    if (LPI2C_IS_MASTER_BUSY(base) || (state->head != NULL)) {
+        return I2C_STATUS_BUSY;
+    }
+
+    srcClock = PCC_GetLpi2cClockFreq(0U);
+    filtScl = (uint8_t)((base->MCFGR2 & LPI2C_MCFGR2_FILTSCL_MASK) >> LPI2C_MCFGR2_FILTSCL_SHIFT);
+
+    if (I2C_CalculateTiming(srcClock, mode, baudRate, riseTimeNs, filtScl, &busTiming) != I2C_STATUS_SUCCESS) {
+        return I2C_STATUS_ERROR;
+    }
+
+    /* PRESCALE is shared: the Fm master code phase uses the HS prescaler */
+    if (mode == I2C_BUS_MODE_HIGH_SPEED) {
+        if (I2C_CalculateTimingAt(srcClock, I2C_BUS_MODE_FAST, I2C_HS_MASTER_CODE_BAUD,
+                                  I2C_NsToCycles(riseTimeNs, srcClock, 0U), filtScl,
+                                  busTiming.prescale, true, &masterCode) != I2C_STATUS_SUCCESS) {
+            return I2C_STATUS_ERROR;
+        }
+    }
+
+    /* Clock configuration must be written with the master disabled */
+    wasEnabled = ((base->MCR & LPI2C_MCR_MEN_MASK) != 0U);
+    LPI2C_DISABLE_MASTER(base);
+
+    base->MCFGR1 = (base->MCFGR1 & ~LPI2C_MCFGR1_PRESCALE_MASK) | LPI2C_MCFGR1_PRESCALE(busTiming.prescale);
+
+    if (mode == I2C_BUS_MODE_HIGH_SPEED) {
+        base->MCCR0 = LPI2C_MCCR0_CLKLO(masterCode.clkLo) |
+                      LPI2C_MCCR0_CLKHI(masterCode.clkHi) |
+                      LPI2C_MCCR0_SETHOLD(masterCode.setHold) |
+                      LPI2C_MCCR0_DATAVD(masterCode.dataVd);
+        base->MCCR1 = LPI2C_MCCR1_CLKLO(busTiming.clkLo) |
+                      LPI2C_MCCR1_CLKHI(busTiming.clkHi) |
+                      LPI2C_MCCR1_SETHOLD(busTiming.setHold) |
+                      LPI2C_MCCR1_DATAVD(busTiming.dataVd);
+    } else {
+        base->MCCR0 = LPI2C_MCCR0_CLKLO(busTiming.clkLo) |
+                      LPI2C_MCCR0_CLKHI(busTiming.clkHi) |
+                      LPI2C_MCCR0_SETHOLD(busTiming.setHold) |
+                      LPI2C_MCCR0_DATAVD(busTiming.dataVd);
+    }
+
+    state->highSpeed = (mode == I2C_BUS_MODE_HIGH_SPEED);
+    state->busHeld = false;
+
+    if (wasEnabled) {
+        LPI2C_ENABLE_MASTER(base);
+    }
+
+    if (timing != NULL) {
+        *timing = busTiming;
+    }
+
+    return I2C_STATUS_SUCCESS;
+}
+
+/*******************************************************************************
+ * Asynchronous Master Transfer Functions
+ ******************************************************************************/
+
+/**
+ * @brief Get asynchronous engine state for an instance
+ */
+static i2c_async_state_t *I2C_GetAsyncState(LPI2C_RegType *base)
+{
+    return (base == LPI2C0) ? &s_i2cAsync[0] : NULL;
+}
+
+/**
+ * @brief Produce the next command word of the head transfer
+ * 
+ * @return false when every command of the transfer has been produced
+ */
+static bool I2C_AsyncNextCommand(i2c_async_state_t *state, uint32_t *command)
+{
+    I2C_Transfer_t *xfer = state->head;
+    uint32_t startCmd = state->highSpeed ? I2C_CMD_START_HS : I2C_CMD_START;
+    uint32_t count;
+
+    switch (state->phase) {
+        case I2C_ASYNC_ADDRESS:
+            /* HS: acquire the bus with the master code (Fm timing) first */
+            if (state->highSpeed && !state->busHeld) {
+                *command = I2C_CMD_MASTER_CODE;
+                state->busHeld = true;
+                return true;
+            }
+            /* (Repeated) START, address and R/W bit; register bytes are always written */
+            if (xfer->regSize > 0U) {
+                *command = startCmd | ((uint32_t)xfer->slaveAddress << 1) | (uint32_t)I2C_WRITE;
+                state->phase = I2C_ASYNC_REGISTER;
+            } else {
+                *command = startCmd | ((uint32_t)xfer->slaveAddress << 1) | (uint32_t)xfer->direction;
+                state->phase = I2C_ASYNC_DATA;
+            }
+            return true;
+
+        case I2C_ASYNC_REGISTER:
+            *command = I2C_CMD_TRANSMIT | xfer->regBuff[state->regIndex];
+            state->regIndex++;
+            if (state->regIndex >= xfer->regSize) {
+                state->phase = (xfer->direction == I2C_READ) ? I2C_ASYNC_RESTART : I2C_ASYNC_DATA;
+            }
+            return true;
+
+        case I2C_ASYNC_RESTART:
+            *command = startCmd | ((uint32_t)xfer->slaveAddress << 1) | (uint32_t)I2C_READ;
+            state->phase = I2C_ASYNC_DATA;
+            return true;
+
+        case I2C_ASYNC_DATA:
+            if (xfer->direction == I2C_WRITE) {
+                *command = I2C_CMD_TRANSMIT | xfer->txBuff[state->cmdIndex];
+                state->cmdIndex++;
+            } else {
+                count = xfer->size - state->cmdIndex;
+                if (count > I2C_RX_CMD_MAX) {
+                    count = I2C_RX_CMD_MAX;
+                }
+                *command = I2C_CMD_RECEIVE | (count - 1U);
+                state->cmdIndex += count;
+            }
+            if (state->cmdIndex >= xfer->size) {
+                state->phase = xfer->sendStop ? I2C_ASYNC_STOP : I2C_ASYNC_WAIT;
+            }
+            return true;
+
+        case I2C_ASYNC_STOP:
+            *command = I2C_CMD_STOP;
+            state->phase = I2C_ASYNC_WAIT;
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Finish the head transfer and start the next one
+ */
+static void I2C_AsyncComplete(LPI2C_RegType *base, i2c_async_state_t *state, I2C_Status_t status)
+{
+    I2C_Transfer_t *xfer = state->head;
+
+    state->head = xfer->next;
+    if (state->head == NULL) {
+        state->tail = NULL;
+    }
+    state->phase = I2C_ASYNC_ADDRESS;
+    state->regIndex = 0U;
+    state->cmdIndex = 0U;
+    state->rxIndex = 0U;
+
+    /* STOP (or an error) releases the bus, HS must send the master code again */
+    if ((status != I2C_STATUS_SUCCESS) || xfer->sendStop) {
+        state->busHeld = false;
+    }
+
+    xfer->next = NULL;
+    xfer->status = status;
+
+    if (xfer->callback != NULL) {
+        xfer->callback(base, xfer, xfer->userData);
+    }
+
+#if OSAL_FREERTOS
+    if (state->waitTransfer == xfer) {
+        state->waitTransfer = NULL;
+        OSAL_EventSignalFromIsr(&state->done);
+    }
+#endif
+}
+
+/**
+ * @brief Move data between the FIFOs and the queue head
+ * @details Called from the ISR and, with interrupts masked, from Submit.
+ */
+static void I2C_AsyncPump(LPI2C_RegType *base, i2c_async_state_t *state)
+{
+    I2C_Transfer_t *xfer;
+    uint32_t command;
+    bool stopped = false;
+    bool done;
+
+    while ((xfer = state->head) != NULL) {
+        /* Drain received bytes */
+        if (xfer->direction == I2C_READ) {
+            while ((state->rxIndex < xfer->size) &&
+                   ((base->MFSR & LPI2C_MFSR_RXCOUNT_MASK) != 0U)) {
+                xfer->rxBuff[state->rxIndex] = (uint8_t)LPI2C_READ_DATA(base);
+                state->rxIndex++;
+            }
+        }
+
+        /* Fill the command FIFO */
+        while ((state->phase != I2C_ASYNC_WAIT) &&
+               ((base->MFSR & LPI2C_MFSR_TXCOUNT_MASK) < state->txFifoSize)) {
+            if (I2C_AsyncNextCommand(state, &command)) {
+                LPI2C_WRITE_DATA(base, command);
+            }
+        }
+
+        if (state->phase != I2C_ASYNC_WAIT) {
+            break;
+        }
+
+        done = (xfer->direction == I2C_WRITE) || (state->rxIndex >= xfer->size);
+        if (done && xfer->sendStop) {
+            done = ((base->MSR & LPI2C_MSR_SDF_MASK) != 0U);
+            if (done) {
+                base->MSR = LPI2C_MSR_SDF_MASK;
+                stopped = true;
+            }
+        }
+
+        if (!done) {
+            break;
+        }
+
+        /* Next transfer (if any) continues with its START in the same loop */
+        I2C_AsyncComplete(base, state, I2C_STATUS_SUCCESS);
+    }
+
+    /* TDF stays set while the FIFO has room: only listen when commands wait */
+    if ((state->head != NULL) && (state->phase != I2C_ASYNC_WAIT)) {
+        base->MIER |= LPI2C_MIER_TDIE_MASK;
+    } else {
+        base->MIER &= ~LPI2C_MIER_TDIE_MASK;
+    }
+
+    if ((state->head != NULL) && (state->head->direction == I2C_READ)) {
+        base->MIER |= LPI2C_MIER_RDIE_MASK;
+    } else {
+        base->MIER &= ~LPI2C_MIER_RDIE_MASK;
+    }
+
+    /*
+     * Queue drained: return the clock (gated if nobody else holds it) once the
+     * bus is released. A STOP seen on this pass counts even if MBF still
+     * reads set; otherwise the release is retried on the SDF interrupt
+     * (SDIE stays enabled) when a pending STOP completes.
+     */
+    if (state->head == NULL) {
+        if ((base->MSR & LPI2C_MSR_SDF_MASK) != 0U) {
+            base->MSR = LPI2C_MSR_SDF_MASK;
+            stopped = true;
+        }
+
+        if (state->clockHeld && !state->busHeld && (stopped || !LPI2C_IS_MASTER_BUSY(base))) {
+            state->clockHeld = false;
+            (void)PCC_ReleasePeripheralClock(PCC_LPI2C0_INDEX);
+        }
+    }
+}
+
+/**
+ * @brief Enable the interrupt-driven master transfer engine
+ */
+I2C_Status_t I2C_MasterEnableAsync(LPI2C_RegType *base)
+{
+    i2c_async_state_t *state = I2C_GetAsyncState(base);
+
+    if (state == NULL) {
+        return I2C_STATUS_ERROR;
+    }
+
+    base->MIER = 0U;
+    LPI2C_RESET_TX_FIFO(base);
+    LPI2C_RESET_RX_FIFO(base);
+    LPI2C_CLEAR_STATUS(base);
+
+    state->txFifoSize = (uint8_t)(1U << ((base->PARAM & LPI2C_PARAM_MTXFIFO_MASK) >> LPI2C_PARAM_MTXFIFO_SHIFT));
+    state->busHeld = false;
+    state->phase = I2C_ASYNC_ADDRESS;
+    state->regIndex = 0U;
+    state->cmdIndex = 0U;
+    state->rxIndex = 0U;
+    state->head = NULL;
+    state->tail = NULL;
+    if (state->clockHeld) {
+        state->clockHeld = false;
+        (void)PCC_ReleasePeripheralClock(PCC_LPI2C0_INDEX);
+    }
+
+    /* TDF when at most one command is left, RDF on every received byte */
+    base->MFCR = LPI2C_MFCR_TXWATER(1U) | LPI2C_MFCR_RXWATER(0U);
+    base->MIER = LPI2C_MIER_SDIE_MASK | LPI2C_MIER_NDIE_MASK |
+                 LPI2C_MIER_ALIE_MASK | LPI2C_MIER_FEIE_MASK;
+
+    state->enabled = true;
+
+    return I2C_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Disable the asynchronous engine
+ */
+void I2C_MasterDisableAsync(LPI2C_RegType *base)
+{
+    i2c_async_state_t *state = I2C_GetAsyncState(base);
+    uint32_t primask;
+
+    if (state == NULL) {
+        return;
+    }
+
+    primask = NVIC_DisableGlobalIRQ();
+    base->MIER = 0U;
+    state->enabled = false;
+    LPI2C_RESET_TX_FIFO(base);
+    LPI2C_RESET_RX_FIFO(base);
+    if (LPI2C_IS_MASTER_BUSY(base)) {
+        LPI2C_WRITE_DATA(base, I2C_CMD_STOP);
+    }
+    NVIC_EnableGlobalIRQ(primask);
+
+    while (state->head != NULL) {
+        I2C_AsyncComplete(base, state, I2C_STATUS_ERROR);
+    }
+
+    if (state->clockHeld) {
+        state->clockHeld = false;
+        (void)PCC_ReleasePeripheralClock(PCC_LPI2C0_INDEX);
+    }
+}
+
+/**
+ * @brief Validate a descriptor before queuing
+ */
+static I2C_Status_t I2C_AsyncCheckTransfer(const I2C_Transfer_t *transfer)
+{
+    if ((transfer == NULL) || (transfer->size == 0U) || (transfer->regSize > I2C_MAX_REGISTER_SIZE)) {
+        return I2C_STATUS_ERROR;
+    }
+
+    if (((transfer->direction == I2C_WRITE) && (transfer->txBuff == NULL)) ||
+        ((transfer->direction == I2C_READ) && (transfer->rxBuff == NULL)) ||
+        ((transfer->regSize > 0U) && (transfer->regBuff == NULL))) {
+        return I2C_STATUS_ERROR;
+    }
+
+    if (transfer->status == I2C_STATUS_BUSY) {
+        return I2C_STATUS_BUSY;
+    }
+
+    return I2C_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Append a checked descriptor to the queue (interrupts masked)
+ */
+static void I2C_AsyncEnqueue(i2c_async_state_t *state, I2C_Transfer_t *transfer)
+{
+    transfer->status = I2C_STATUS_BUSY;
+    transfer->next = NULL;
+
+    if (state->tail == NULL) {
+        state->head = transfer;
+        state->tail = transfer;
+        state->phase = I2C_ASYNC_ADDRESS;
+        state->regIndex = 0U;
+        state->cmdIndex = 0U;
+        state->rxIndex = 0U;
+    } else {
+        state->tail->next = transfer;
+        state->tail = transfer;
+    }
+}
+
+/**
+ * @brief Queue a transfer (non-blocking)
+ */
+I2C_Status_t I2C_MasterSubmit(LPI2C_RegType *base, I2C_Transfer_t *transfer)
+{
+    return I2C_MasterSubmitBatch(base, &transfer, 1U);
+}
+
+/**
+ * @brief Queue several transfers back-to-back (non-blocking)
+ */
+I2C_Status_t I2C_MasterSubmitBatch(LPI2C_RegType *base, I2C_Transfer_t *const *transfers, uint32_t count)
+{
+    i2c_async_state_t *state = I2C_GetAsyncState(base);
+    I2C_Status_t status;
+    uint32_t primask;
+    uint32_t i;
+
+    if ((state == NULL) || !state->enabled || (transfers == NULL) || (count == 0U)) {
+        return I2C_STATUS_ERROR;
+    }
+
+    for (i = 0U; i < count; i++) {
+        status = I2C_AsyncCheckTransfer(transfers[i]);
+        if (status != I2C_STATUS_SUCCESS) {
+            return status;
+        }
+    }
+
+    primask = NVIC_DisableGlobalIRQ();
+    /* Hold the function clock until the queue is empty (the ISR returns it) */
+    if (!state->clockHeld) {
+        state->clockHeld = PCC_AcquirePeripheralClock(PCC_LPI2C0_INDEX);
+    }
+    for (i = 0U; i < count; i++) {
+        I2C_AsyncEnqueue(state, transfers[i]);
+    }
+    /* Start an idle queue, or let a head waiting without STOP chain on */
+    I2C_AsyncPump(base, state);
+    NVIC_EnableGlobalIRQ(primask);
+
+    return I2C_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Fill a descriptor for a register read
+ */
+void I2C_MasterPrepareRegisterRead(I2C_Transfer_t *transfer, uint8_t slaveAddress,
+                                   const uint8_t *regBuff, uint8_t regSize,
+                                   uint8_t *rxBuff, uint32_t size)
+{
+    if (transfer == NULL) {
+        return;
+    }
+
+    transfer->slaveAddress = slaveAddress;
+    transfer->direction = I2C_READ;
+    transfer->regBuff = regBuff;
+    transfer->regSize = regSize;
+    transfer->txBuff = NULL;
+    transfer->rxBuff = rxBuff;
+    transfer->size = size;
+    transfer->sendStop = true;
+    transfer->callback = NULL;
+    transfer->userData = NULL;
+    transfer->status = I2C_STATUS_SUCCESS;
+    transfer->next = NULL;
+}
+
+/**
+ * @brief Check whether the asynchronous queue is empty
+ */
+bool I2C_MasterIsAsyncIdle(LPI2C_RegType *base)
+{
+    i2c_async_state_t *state = I2C_GetAsyncState(base);
+
+    return (state == NULL) || (state->head == NULL);
+}
+
+/**
+ * @brief Take the master bus for a multi-call sequence
+ */
+I2C_Status_t I2C_MasterLockBus(LPI2C_RegType *base, uint32_t timeoutMs)
+{
+    i2c_async_state_t *state = I2C_GetAsyncState(base);
+
+    if (state == NULL) {
+        return I2C_STATUS_ERROR;
+    }
+
+    switch (OSAL_MutexLock(&state->busLock, timeoutMs)) {
+        case OSAL_STATUS_SUCCESS:
+            return I2C_STATUS_SUCCESS;
+        case OSAL_STATUS_TIMEOUT:
+            return I2C_STATUS_BUSY;
+        default:
+            return I2C_STATUS_ERROR;
+    }
+}
+
+/**
+ * @brief Release the master bus taken with I2C_MasterLockBus()
+ */
+void I2C_MasterUnlockBus(LPI2C_RegType *base)
+{
+    i2c_async_state_t *state = I2C_GetAsyncState(base);
+
+    if (state != NULL) {
+        OSAL_MutexUnlock(&state->busLock);
+    }
+}
+
+/**
+ * @brief Run one descriptor on the asynchronous engine and wait for it
+ */
+I2C_Status_t I2C_MasterTransferBlocking(LPI2C_RegType *base, I2C_Transfer_t *transfer, uint32_t timeoutMs)
+{
+    i2c_async_state_t *state = I2C_GetAsyncState(base);
+    I2C_Status_t status;
+    uint32_t loops = timeoutMs * OSAL_BM_LOOPS_PER_MS;
+
+    if ((state == NULL) || (transfer == NULL)) {
+        return I2C_STATUS_ERROR;
+    }
+
+    status = I2C_MasterLockBus(base, timeoutMs);
+    if (status != I2C_STATUS_SUCCESS) {
+        return status;
+    }
+
+#if OSAL_FREERTOS
+    if (OSAL_CanBlock()) {
+        OSAL_EventArm(&state->done);
+        state->waitTransfer = transfer;
+        status = I2C_MasterSubmit(base, transfer);
+        if (status == I2C_STATUS_SUCCESS) {
+            /* Completion may already have run inside Submit: the event is then pending */
+            (void)OSAL_EventWait(&state->done, timeoutMs);
+        }
+        state->waitTransfer = NULL;
+    } else
+#endif
+    {
+        /* Bare-metal, or before the scheduler starts: poll the descriptor */
+        status = I2C_MasterSubmit(base, transfer);
+        while ((status == I2C_STATUS_SUCCESS) && (transfer->status == I2C_STATUS_BUSY) &&
+               ((timeoutMs == OSAL_WAIT_FOREVER) || (loops > 0U))) {
+            loops--;
+        }
+    }
+
+    I2C_MasterUnlockBus(base);
+
+    if (status != I2C_STATUS_SUCCESS) {
+        return status;
+    }
+
+    /* Still queued: the descriptor stays owned by the driver */
+    return (transfer->status == I2C_STATUS_BUSY) ? I2C_STATUS_TIMEOUT : transfer->status;
+}
+
+/**
+ * @brief Master interrupt handler for the asynchronous engine
+ */
+void I2C_MasterIRQHandler(LPI2C_RegType *base)
+{
+    i2c_async_state_t *state = I2C_GetAsyncState(base);
+    uint32_t msr;
+    I2C_Status_t status;
+
+    if ((state == NULL) || !state->enabled) {
+        return;
+    }
+
+    msr = base->MSR;
+
+    if ((msr & I2C_MSR_ERROR_MASK) != 0U) {
+        if ((msr & LPI2C_MSR_ALF_MASK) != 0U) {
+            status = I2C_STATUS_ARBITRATION_LOST;
+        } else if ((msr & LPI2C_MSR_NDF_MASK) != 0U) {
+            status = I2C_STATUS_NACK;
+        } else {
+            status = I2C_STATUS_ERROR;
+        }
+
+        /* Drop the rest of the failed transfer and release the bus */
+        LPI2C_RESET_TX_FIFO(base);
+        LPI2C_RESET_RX_FIFO(base);
+        base->MSR = I2C_MSR_ERROR_MASK | LPI2C_MSR_SDF_MASK | LPI2C_MSR_EPF_MASK;
+        if (((msr & LPI2C_MSR_ALF_MASK) == 0U) && LPI2C_IS_MASTER_BUSY(base)) {
+            LPI2C_WRITE_DATA(base, I2C_CMD_STOP);
+        }
+
+        if (state->head != NULL) {
+            I2C_AsyncComplete(base, state, status);
+        }
+    }
+
+    /* SDF with an empty queue is cleared there, releasing the clock */
+    I2C_AsyncPump(base, state);
+}
+
 /*******************************************************************************
  * Slave Mode Functions
  ******************************************************************************/
@@ -342,14 +1225,18 @@ I2C_Status_t I2C_SlaveInit(LPI2C_RegType *base, const I2C_SlaveConfig_t *config)
     }
 
     /* Disable slave before configuration */
-    base->SCR &= ~(1U << 0);  /* Clear SEN bit */
+    base->SCR &= ~LPI2C_SCR_SEN_MASK;
 
-    /* Configure slave address */
-    base->SAMR = (config->slaveAddress & 0x3FFU);
+    /* Configure slave address (ADDR0 starts at bit 1) */
+    base->SCFGR1 = config->enable10BitAddress ? LPI2C_SCFGR1_ADDRCFG(1U) : LPI2C_SCFGR1_ADDRCFG(0U);
+    if (config->enableGeneralCall) {
+        base->SCFGR1 |= LPI2C_SCFGR1_GCEN_MASK;
+    }
+    base->SAMR = LPI2C_SAMR_ADDR0(config->slaveAddress);
 
     /* Enable slave if requested */
     if (config->enableSlave) {
-        base->SCR |= (1U << 0);  /* Set SEN bit */
+        base->SCR |= LPI2C_SCR_SEN_MASK;
     }
 
     return I2C_STATUS_SUCCESS;
@@ -362,7 +1249,7 @@ void I2C_SlaveDeinit(LPI2C_RegType *base)
 {
     if (base != NULL) {
         /* Disable slave */
-        base->SCR &= ~(1U << 0);
+        base->SCR &= ~LPI2C_SCR_SEN_MASK;
     }
 }
 
@@ -382,7 +1269,7 @@ I2C_Status_t I2C_SlaveSend(LPI2C_RegType *base, const uint8_t *txBuff, uint32_t
         timeout = I2C_TIMEOUT_COUNT;
 
         /* Wait for transmit ready */
-        while (((base->SSR & (1U << 0)) == 0U) && (timeout > 0U)) {
+        while (((base->SSR & LPI2C_SSR_TDF_MASK) == 0U) && (timeout > 0U)) {
             timeout--;
         }
 
@@ -413,7 +1300,7 @@ I2C_Status_t I2C_SlaveReceive(LPI2C_RegType *base, uint8_t *rxBuff, uint32_t rxS
         timeout = I2C_TIMEOUT_COUNT;
 
         /* Wait for receive ready */
-        while (((base->SSR & (1U << 1)) == 0U) && (timeout > 0U)) {
+        while (((base->SSR & LPI2C_SSR_RDF_MASK) == 0U) && (timeout > 0U)) {
             timeout--;
         }
 
@@ -422,12 +1309,518 @@ I2C_Status_t I2C_SlaveReceive(LPI2C_RegType *base, uint8_t *rxBuff, uint32_t rxS
         }
 
         /* Read data */
-        rxBuff[i] = (uint8_t)(base->SRDR & 0xFFU);
+        rxBuff[i] = (uint8_t)(base->SRDR & LPI2C_SRDR_DATA_MASK);
     }
 
     return I2C_STATUS_SUCCESS;
 }
 
+/*******************************************************************************
+ * Event-Driven Slave Functions
+ ******************************************************************************/
+
+/**
+ * @brief Get event-driven slave state for an instance
+ */
+static i2c_slave_state_t *I2C_GetSlaveState(LPI2C_RegType *base)
+{
+    return (base == LPI2C0) ? &s_i2cSlave[0] : NULL;
+}
+
+/**
+ * @brief Call the user callback
+ */
+static void I2C_SlaveNotify(i2c_slave_state_t *state, I2C_SlaveEvent_t event)
+{
+    if (state->callback != NULL) {
+        state->callback(state->base, event, state->direction, state->userData);
+    }
+}
+
+/**
+ * @brief Hand the rest of the phase buffer to eDMA
+ * @details Called from the slave ISR. On failure the bytes stay on the
+ *          interrupt path.
+ */
+static void I2C_SlaveStartDma(i2c_slave_state_t *state)
+{
+    LPI2C_RegType *base = state->base;
+    dma_channel_config_t dmaConfig;
+    bool transmit = (state->direction == I2C_READ);
+    uint32_t size;
+
+    size = transmit ? (state->txSize - state->txIndex) : (state->rxSize - state->rxIndex);
+    if (!state->useDma || (size == 0U)) {
+        return;
+    }
+    if (size > I2C_SLAVE_DMA_MAX) {
+        size = I2C_SLAVE_DMA_MAX;
+    }
+
+    dmaConfig.transferSize = DMA_TRANSFER_SIZE_1B;
+    dmaConfig.priority = DMA_PRIORITY_NORMAL;
+    dmaConfig.sourceLastAddrAdjust = 0;
+    dmaConfig.destLastAddrAdjust = 0;
+    dmaConfig.minorLoopBytes = 1U;
+    dmaConfig.majorLoopCount = (uint16_t)size;
+    dmaConfig.enableInterrupt = true;           /* End of buffer: back to the ISR */
+    dmaConfig.disableRequestAfterDone = true;
+    dmaConfig.enablePeriodicTrigger = false;
+
+    if (transmit) {
+        dmaConfig.channel = state->txDmaChannel;
+        dmaConfig.source = DMAMUX_SRC_LPI2C0_TX;
+        dmaConfig.transferType = DMA_TRANSFER_MEM_TO_PERIPH;
+        dmaConfig.sourceAddr = (uint32_t)&state->txBuff[state->txIndex];
+        dmaConfig.sourceOffset = 1;
+        dmaConfig.destAddr = (uint32_t)&base->STDR;
+        dmaConfig.destOffset = 0;
+    } else {
+        dmaConfig.channel = state->rxDmaChannel;
+        dmaConfig.source = DMAMUX_SRC_LPI2C0_RX;
+        dmaConfig.transferType = DMA_TRANSFER_PERIPH_TO_MEM;
+        dmaConfig.sourceAddr = (uint32_t)&base->SRDR;
+        dmaConfig.sourceOffset = 0;
+        dmaConfig.destAddr = (uint32_t)&state->rxBuff[state->rxIndex];
+        dmaConfig.destOffset = 1;
+    }
+
+    if ((DMA_ConfigChannel(&dmaConfig) != STATUS_SUCCESS) ||
+        (DMA_InstallCallback(dmaConfig.channel, I2C_SlaveDmaCallback, state) != STATUS_SUCCESS)) {
+        return;
+    }
+
+    state->dmaSize = size;
+    state->dmaRunning = true;
+
+    /* DMA request instead of the data flag interrupt */
+    if (transmit) {
+        base->SIER &= ~LPI2C_SIER_TDIE_MASK;
+        base->SDER = LPI2C_SDER_TDDE_MASK;
+    } else {
+        base->SIER &= ~LPI2C_SIER_RDIE_MASK;
+        base->SDER = LPI2C_SDER_RDDE_MASK;
+    }
+
+    if (DMA_StartChannel(dmaConfig.channel) != STATUS_SUCCESS) {
+        I2C_SlaveStopDma(state);
+    }
+}
+
+/**
+ * @brief Stop the slave DMA transfer and account the bytes it moved
+ * @details Runs from the DMA callback or, with interrupts masked, from the
+ *          slave ISR. Data flag interrupts take over afterwards.
+ */
+static void I2C_SlaveStopDma(i2c_slave_state_t *state)
+{
+    LPI2C_RegType *base = state->base;
+    bool transmit = (state->direction == I2C_READ);
+    uint8_t channel = transmit ? state->txDmaChannel : state->rxDmaChannel;
+    uint16_t remaining = 0U;
+    uint32_t moved;
+
+    if (!state->dmaRunning) {
+        return;
+    }
+
+    base->SDER = 0U;
+    (void)DMA_StopChannel(channel);
+
+    /* CITER reloads from BITER when the major loop ends: DONE means the whole buffer */
+    if (DMA_IsChannelDone(channel)) {
+        moved = state->dmaSize;
+        (void)DMA_ClearDone(channel);
+    } else {
+        (void)DMA_GetRemainingMajorLoops(channel, &remaining);
+        moved = state->dmaSize - (uint32_t)remaining;
+    }
+
+    if (transmit) {
+        state->txIndex += moved;
+        if (moved > 0U) {
+            state->lastWasData = true;
+        }
+    } else {
+        state->rxIndex += moved;
+    }
+    state->count += moved;
+    state->dmaRunning = false;
+
+    base->SIER |= transmit ? LPI2C_SIER_TDIE_MASK : LPI2C_SIER_RDIE_MASK;
+}
+
+/**
+ * @brief DMA major loop complete: rest of the phase goes through the ISR
+ */
+static void I2C_SlaveDmaCallback(uint8_t channel, void *userData)
+{
+    i2c_slave_state_t *state = (i2c_slave_state_t *)userData;
+
+    (void)channel;
+    I2C_SlaveStopDma(state);
+}
+
+/**
+ * @brief Address match: set up the data phase
+ */
+static void I2C_SlaveStartPhase(i2c_slave_state_t *state, uint32_t sasr)
+{
+    state->active = true;
+    state->direction = ((sasr & LPI2C_SASR_RW_MASK) != 0U) ? I2C_READ : I2C_WRITE;
+    state->overflow = false;
+    state->lastWasData = false;
+    state->count = 0U;
+    state->txIndex = 0U;
+    state->rxIndex = 0U;
+
+    if (state->regMap != NULL) {
+        /* Read: send from the register pointer; write: the first byte is the pointer */
+        if (state->direction == I2C_READ) {
+            state->txBuff = (state->regPointer < state->regMapSize) ? &state->regMap[state->regPointer] : NULL;
+            state->txSize = (state->regPointer < state->regMapSize) ? (state->regMapSize - state->regPointer) : 0U;
+        } else {
+            state->pointerNext = true;
+            state->rxBuff = NULL;
+            state->rxSize = 0U;
+        }
+    } else {
+        state->txBuff = state->appTxBuff;
+        state->txSize = state->appTxSize;
+        state->rxBuff = state->appRxBuff;
+        state->rxSize = state->appRxSize;
+    }
+
+    /* Buffer mode: the callback may replace the buffer for this phase */
+    I2C_SlaveNotify(state, I2C_SLAVE_EVENT_ADDRESS_MATCH);
+
+    if ((state->regMap == NULL) || (state->direction == I2C_READ)) {
+        I2C_SlaveStartDma(state);
+    }
+}
+
+/**
+ * @brief Repeated START / STOP: close the data phase
+ */
+static void I2C_SlaveEndPhase(i2c_slave_state_t *state)
+{
+    LPI2C_RegType *base = state->base;
+    uint32_t basepri;
+
+    /* The DMA callback (higher priority) may run concurrently */
+    basepri = NVIC_EnterCritical();
+    I2C_SlaveStopDma(state);
+    NVIC_ExitCritical(basepri);
+
+    if (state->direction == I2C_READ) {
+        /* Byte preloaded for a NACKed read never went out: drop it from STDR and the count */
+        if (state->lastWasData && (state->count > 0U)) {
+            state->count--;
+        }
+        base->SCR |= LPI2C_SCR_RTF_MASK;
+        if (state->regMap != NULL) {
+            state->regPointer += state->count;
+        }
+    } else if ((state->regMap != NULL) && !state->pointerNext) {
+        state->writeFirst = (uint8_t)state->regPointer;
+        state->writeCount = state->count;
+        state->writeValid = true;
+        state->regPointer += state->count;
+    } else {
+        /* Buffer mode, or a write without a pointer */
+    }
+
+    state->pointerNext = false;
+    state->active = false;
+}
+
+/**
+ * @brief Store one received byte (interrupt path)
+ */
+static void I2C_SlaveReceiveByte(i2c_slave_state_t *state, uint8_t data)
+{
+    if (state->pointerNext) {
+        state->pointerNext = false;
+        state->regPointer = data;
+        state->rxBuff = (data < state->regMapSize) ? &state->regMap[data] : NULL;
+        state->rxSize = (data < state->regMapSize) ? (state->regMapSize - data) : 0U;
+        state->rxIndex = 0U;
+        I2C_SlaveStartDma(state);
+        return;
+    }
+
+    if ((state->rxIndex >= state->rxSize) && !state->overflow && (state->regMap == NULL)) {
+        I2C_SlaveNotify(state, I2C_SLAVE_EVENT_RX_FULL);
+    }
+
+    if (state->rxIndex < state->rxSize) {
+        state->rxBuff[state->rxIndex] = data;
+        state->rxIndex++;
+        state->count++;
+    } else {
+        /* Still ACKed, the byte is dropped */
+        state->overflow = true;
+    }
+}
+
+/**
+ * @brief Load the next transmit byte (interrupt path)
+ */
+static void I2C_SlaveTransmitByte(i2c_slave_state_t *state)
+{
+    LPI2C_RegType *base = state->base;
+
+    if ((state->txIndex >= state->txSize) && !state->overflow && (state->regMap == NULL)) {
+        I2C_SlaveNotify(state, I2C_SLAVE_EVENT_TX_EMPTY);
+    }
+
+    if (state->txIndex < state->txSize) {
+        base->STDR = state->txBuff[state->txIndex];
+        state->txIndex++;
+        state->count++;
+        state->lastWasData = true;
+    } else {
+        base->STDR = I2C_SLAVE_FILL_BYTE;
+        state->overflow = true;
+        state->lastWasData = false;
+    }
+}
+
+/**
+ * @brief Enable the interrupt / DMA driven slave
+ */
+I2C_Status_t I2C_SlaveEnableAsync(LPI2C_RegType *base, const I2C_SlaveAsyncConfig_t *config)
+{
+    i2c_slave_state_t *state = I2C_GetSlaveState(base);
+    uint32_t cfgr1;
+
+    if ((state == NULL) || (config == NULL) ||
+        (config->slaveAddress > (config->enable10BitAddress ? 0x3FFU : 0x7FU)) ||
+        (config->clockHold > 15U) || (config->dataValid > 63U) ||
+        ((config->registerMap != NULL) &&
+         ((config->registerMapSize == 0U) || (config->registerMapSize > I2C_SLAVE_MAX_REGISTER_MAP))) ||
+        (config->useDma && (config->rxDmaChannel == config->txDmaChannel))) {
+        return I2C_STATUS_ERROR;
+    }
+
+    I2C_SlaveDisableAsync(base);
+
+    /* Hold the function clock for as long as the slave is enabled */
+    if (!PCC_AcquirePeripheralClock(PCC_LPI2C0_INDEX)) {
+        return I2C_STATUS_ERROR;
+    }
+
+    /* SCFGR1 is writable only while SEN = 0 */
+    base->SCR = LPI2C_SCR_RST_MASK;
+    base->SCR = 0U;
+
+    cfgr1 = config->enable10BitAddress ? LPI2C_SCFGR1_ADDRCFG(1U) : LPI2C_SCFGR1_ADDRCFG(0U);
+    if (config->enableGeneralCall) {
+        cfgr1 |= LPI2C_SCFGR1_GCEN_MASK;
+    }
+    if (config->stretchAddress) {
+        cfgr1 |= LPI2C_SCFGR1_ADRSTALL_MASK;
+    }
+    if (config->stretchRx) {
+        cfgr1 |= LPI2C_SCFGR1_RXSTALL_MASK;
+    }
+    if (config->stretchTx) {
+        cfgr1 |= LPI2C_SCFGR1_TXDSTALL_MASK;
+    }
+    base->SCFGR1 = cfgr1;
+    base->SCFGR2 = LPI2C_SCFGR2_CLKHOLD(config->clockHold) | LPI2C_SCFGR2_DATAVD(config->dataValid);
+    base->SAMR = LPI2C_SAMR_ADDR0(config->slaveAddress);
+    base->SDER = 0U;
+    base->SSR = I2C_SSR_W1C_MASK;
+
+    state->base = base;
+    state->active = false;
+    state->useDma = config->useDma;
+    state->dmaRunning = false;
+    state->pointerNext = false;
+    state->writeValid = false;
+    state->rxDmaChannel = config->rxDmaChannel;
+    state->txDmaChannel = config->txDmaChannel;
+    state->callback = config->callback;
+    state->userData = config->userData;
+    state->regMap = config->registerMap;
+    state->regMapSize = (config->registerMap != NULL) ? config->registerMapSize : 0U;
+    state->regPointer = 0U;
+    state->count = 0U;
+    state->enabled = true;
+
+    base->SIER = I2C_SIER_ASYNC_MASK;
+    base->SCR = LPI2C_SCR_SEN_MASK;
+
+    return I2C_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Disable the event-driven slave
+ */
+void I2C_SlaveDisableAsync(LPI2C_RegType *base)
+{
+    i2c_slave_state_t *state = I2C_GetSlaveState(base);
+    uint32_t basepri;
+
+    if ((state == NULL) || !state->enabled) {
+        return;
+    }
+
+    basepri = NVIC_EnterCritical();
+    base->SIER = 0U;
+    I2C_SlaveStopDma(state);
+    base->SCR &= ~LPI2C_SCR_SEN_MASK;
+    state->active = false;
+    state->enabled = false;
+    NVIC_ExitCritical(basepri);
+
+    (void)PCC_ReleasePeripheralClock(PCC_LPI2C0_INDEX);
+}
+
+/**
+ * @brief Set the data sent when the master reads (buffer mode)
+ */
+I2C_Status_t I2C_SlaveSetTxBuffer(LPI2C_RegType *base, const uint8_t *txBuff, uint32_t txSize)
+{
+    i2c_slave_state_t *state = I2C_GetSlaveState(base);
+    uint32_t basepri;
+
+    if ((state == NULL) || (state->regMap != NULL)) {
+        return I2C_STATUS_ERROR;
+    }
+
+    if (txBuff == NULL) {
+        txSize = 0U;
+    }
+
+    basepri = NVIC_EnterCritical();
+    state->appTxBuff = txBuff;
+    state->appTxSize = txSize;
+    /* Inside a read phase (callback): continue from the new buffer */
+    if (state->active && (state->direction == I2C_READ) && !state->dmaRunning) {
+        state->txBuff = txBuff;
+        state->txSize = txSize;
+        state->txIndex = 0U;
+        state->overflow = false;
+    }
+    NVIC_ExitCritical(basepri);
+
+    return I2C_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Set the buffer filled when the master writes (buffer mode)
+ */
+I2C_Status_t I2C_SlaveSetRxBuffer(LPI2C_RegType *base, uint8_t *rxBuff, uint32_t rxSize)
+{
+    i2c_slave_state_t *state = I2C_GetSlaveState(base);
+    uint32_t basepri;
+
+    if ((state == NULL) || (state->regMap != NULL)) {
+        return I2C_STATUS_ERROR;
+    }
+
+    if (rxBuff == NULL) {
+        rxSize = 0U;
+    }
+
+    basepri = NVIC_EnterCritical();
+    state->appRxBuff = rxBuff;
+    state->appRxSize = rxSize;
+    if (state->active && (state->direction == I2C_WRITE) && !state->dmaRunning) {
+        state->rxBuff = rxBuff;
+        state->rxSize = rxSize;
+        state->rxIndex = 0U;
+        state->overflow = false;
+    }
+    NVIC_ExitCritical(basepri);
+
+    return I2C_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Data bytes of the running / last phase
+ */
+uint32_t I2C_SlaveGetTransferCount(LPI2C_RegType *base)
+{
+    i2c_slave_state_t *state = I2C_GetSlaveState(base);
+
+    return (state != NULL) ? state->count : 0U;
+}
+
+/**
+ * @brief Register range written by the last write phase
+ */
+I2C_Status_t I2C_SlaveGetRegisterWrite(LPI2C_RegType *base, uint8_t *firstReg, uint32_t *count)
+{
+    i2c_slave_state_t *state = I2C_GetSlaveState(base);
+    uint32_t basepri;
+
+    if ((state == NULL) || (state->regMap == NULL) || !state->writeValid ||
+        (firstReg == NULL) || (count == NULL)) {
+        return I2C_STATUS_ERROR;
+    }
+
+    basepri = NVIC_EnterCritical();
+    *firstReg = state->writeFirst;
+    *count = state->writeCount;
+    NVIC_ExitCritical(basepri);
+
+    return I2C_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Slave interrupt handler for the event-driven slave
+ */
+void I2C_SlaveIRQHandler(LPI2C_RegType *base)
+{
+    i2c_slave_state_t *state = I2C_GetSlaveState(base);
+    uint32_t ssr;
+    bool wasActive;
+
+    if ((state == NULL) || !state->enabled) {
+        return;
+    }
+
+    ssr = base->SSR;
+
+    if ((ssr & I2C_SSR_ERROR_MASK) != 0U) {
+        base->SSR = ssr & I2C_SSR_ERROR_MASK;
+        I2C_SlaveNotify(state, I2C_SLAVE_EVENT_ERROR);
+    }
+
+    /* Last byte of the current phase before Sr / STOP / a new address */
+    if (((ssr & LPI2C_SSR_RDF_MASK) != 0U) && !state->dmaRunning) {
+        I2C_SlaveReceiveByte(state, (uint8_t)(base->SRDR & LPI2C_SRDR_DATA_MASK));
+    }
+
+    if ((ssr & (LPI2C_SSR_RSF_MASK | LPI2C_SSR_SDF_MASK)) != 0U) {
+        base->SSR = ssr & (LPI2C_SSR_RSF_MASK | LPI2C_SSR_SDF_MASK);
+        wasActive = state->active;
+        if (wasActive) {
+            I2C_SlaveEndPhase(state);
+            I2C_SlaveNotify(state, ((ssr & LPI2C_SSR_SDF_MASK) != 0U) ?
+                                   I2C_SLAVE_EVENT_STOP : I2C_SLAVE_EVENT_REPEATED_START);
+        }
+    }
+
+    if ((ssr & LPI2C_SSR_AVF_MASK) != 0U) {
+        /* Previous phase still open (missed Sr): close it silently */
+        if (state->active) {
+            I2C_SlaveEndPhase(state);
+        }
+        /* Reading SASR clears AVF and releases ADRSTALL */
+        I2C_SlaveStartPhase(state, base->SASR);
+    }
+
+    /* Re-read TDF: it is set only after the address is ACKed */
+    if (state->active && (state->direction == I2C_READ) && !state->dmaRunning &&
+        ((base->SSR & LPI2C_SSR_TDF_MASK) != 0U)) {
+        I2C_SlaveTransmitByte(state);
+    }
+}
+
 /*******************************************************************************
  * Utility Functions
  ******************************************************************************/
@@ -446,8 +1839,8 @@ bool I2C_IsBusBusy(LPI2C_RegType *base)
 void I2C_EnableClock(uint8_t instance)
 {
     if (instance == 0U) {
-        /* Enable LPI2C0 clock via PCC */
-        PCC->PCCn[PCC_LPI2C0_INDEX] |= PCC_PCCn_CGC_MASK;
+        /* Reference counted: the async engine holds its own reference */
+        (void)PCC_AcquirePeripheralClock(PCC_LPI2C0_INDEX);
     }
 }
 
@@ -457,7 +1850,7 @@ void I2C_EnableClock(uint8_t instance)
 void I2C_DisableClock(uint8_t instance)
 {
     if (instance == 0U) {
-        /* Disable LPI2C0 clock via PCC */
-        PCC->PCCn[PCC_LPI2C0_INDEX] &= ~PCC_PCCn_CGC_MASK;
+        /* Gated only when no transfer is queued */
+        (void)PCC_ReleasePeripheralClock(PCC_LPI2C0_INDEX);
     }
 }
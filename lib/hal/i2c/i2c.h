@@ -43,6 +43,28 @@ typedef struct {
     bool     enableDebug;           /**< Enable debug mode */
 } I2C_MasterConfig_t;
 
+/**
+ * @brief I2C bus speed mode (selects the UM10204 minimum timing table)
+ */
+typedef enum {
+    I2C_BUS_MODE_STANDARD = 0U,     /**< Sm, up to 100 kHz */
+    I2C_BUS_MODE_FAST,              /**< Fm, up to 400 kHz */
+    I2C_BUS_MODE_FAST_PLUS,         /**< Fm+, up to 1 MHz */
+    I2C_BUS_MODE_HIGH_SPEED         /**< HS, up to 3.4 MHz (MCCR1, master code at Fm) */
+} I2C_BusMode_t;
+
+/**
+ * @brief Calculated LPI2C master timing (MCFGR1.PRESCALE + MCCR0/MCCR1 fields)
+ */
+typedef struct {
+    uint8_t  prescale;              /**< MCFGR1.PRESCALE, divide by 2^prescale */
+    uint8_t  clkLo;                 /**< CLKLO (low period - 1) */
+    uint8_t  clkHi;                 /**< CLKHI (high period - 1, excl. SCL latency) */
+    uint8_t  setHold;               /**< SETHOLD (START/STOP setup and hold - 1) */
+    uint8_t  dataVd;                /**< DATAVD (data valid delay - 1) */
+    uint32_t actualBaudRate;        /**< Resulting SCL frequency in Hz (<= requested) */
+} I2C_Timing_t;
+
 /**
  * @brief I2C slave configuration structure
  */
@@ -65,6 +87,109 @@ typedef enum {
     I2C_STATUS_ERROR                /**< General error */
 } I2C_Status_t;
 
+/** @brief Maximum register address bytes in a combined transfer */
+#define I2C_MAX_REGISTER_SIZE           (4U)
+
+/**
+ * @brief Asynchronous master transfer descriptor
+ * @details Owned by the caller and must stay valid until the callback (or
+ *          until status is no longer I2C_STATUS_BUSY). The driver links
+ *          queued descriptors through @c next, no memory is allocated.
+ * 
+ *          With regSize > 0 the descriptor is a combined transfer: START +
+ *          address (write), the register bytes, then for I2C_READ a repeated
+ *          START + address (read) and the data phase, all queued as one
+ *          command sequence. For I2C_WRITE the data follows the register
+ *          bytes without a repeated START.
+ */
+typedef struct I2C_Transfer I2C_Transfer_t;
+
+/**
+ * @brief Transfer completion callback (called from I2C_MasterIRQHandler())
+ * 
+ * @param[in] base      I2C peripheral that ran the transfer
+ * @param[in] transfer  Completed descriptor, status holds the result
+ * @param[in] userData  User data from the descriptor
+ */
+typedef void (*I2C_TransferCallback_t)(LPI2C_RegType *base, I2C_Transfer_t *transfer, void *userData);
+
+struct I2C_Transfer {
+    uint8_t                 slaveAddress;   /**< 7-bit slave address */
+    I2C_Direction_t         direction;      /**< Write txBuff or read into rxBuff */
+    const uint8_t          *regBuff;        /**< Register address bytes, MSB first (regSize > 0) */
+    uint8_t                 regSize;        /**< Register bytes (0 to I2C_MAX_REGISTER_SIZE) */
+    const uint8_t          *txBuff;         /**< Data to write (I2C_WRITE) */
+    uint8_t                *rxBuff;         /**< Receive buffer (I2C_READ) */
+    uint32_t                size;           /**< Bytes to transfer (> 0) */
+    bool                    sendStop;       /**< false: next queued transfer starts with repeated START */
+    I2C_TransferCallback_t  callback;       /**< Completion callback, may be NULL */
+    void                   *userData;       /**< Callback user data */
+
+    volatile I2C_Status_t   status;         /**< I2C_STATUS_BUSY while queued / running, then the result */
+    I2C_Transfer_t         *next;           /**< Queue link (driver use) */
+};
+
+/** @brief Byte the slave sends once its transmit data has run out */
+#ifndef I2C_SLAVE_FILL_BYTE
+#define I2C_SLAVE_FILL_BYTE             (0xFFU)
+#endif
+
+/** @brief Largest register map of the slave (8-bit register pointer) */
+#define I2C_SLAVE_MAX_REGISTER_MAP      (256U)
+
+/**
+ * @brief Event-driven slave notifications (called from I2C_SlaveIRQHandler())
+ */
+typedef enum {
+    I2C_SLAVE_EVENT_ADDRESS_MATCH = 0U,  /**< Own address received, data phase about to start */
+    I2C_SLAVE_EVENT_REPEATED_START,      /**< Repeated START ended the current phase */
+    I2C_SLAVE_EVENT_STOP,                /**< STOP ended the transfer */
+    I2C_SLAVE_EVENT_TX_EMPTY,            /**< Master reads past the transmit buffer (buffer mode) */
+    I2C_SLAVE_EVENT_RX_FULL,             /**< Master writes past the receive buffer (buffer mode) */
+    I2C_SLAVE_EVENT_ERROR                /**< Bit error or FIFO over/underrun (BEF / FEF) */
+} I2C_SlaveEvent_t;
+
+/**
+ * @brief Slave event callback
+ * 
+ * @param[in] base       I2C peripheral
+ * @param[in] event      Event
+ * @param[in] direction  Phase direction seen from the master: I2C_READ = the
+ *                       slave transmits, I2C_WRITE = the slave receives
+ * @param[in] userData   User data from the configuration
+ * 
+ * @note ADDRESS_MATCH / TX_EMPTY / RX_FULL may call I2C_SlaveSetTxBuffer()
+ *       or I2C_SlaveSetRxBuffer() to supply the data of this phase.
+ */
+typedef void (*I2C_SlaveCallback_t)(LPI2C_RegType *base, I2C_SlaveEvent_t event,
+                                    I2C_Direction_t direction, void *userData);
+
+/**
+ * @brief Event-driven slave configuration
+ * @details With registerMap != NULL the slave emulates a register device:
+ *          the first byte of a write phase sets the register pointer, the
+ *          following bytes are stored at map[pointer++]; a read phase sends
+ *          map[pointer++]. Without a map the slave works on the buffers
+ *          given with I2C_SlaveSetTxBuffer() / I2C_SlaveSetRxBuffer().
+ */
+typedef struct {
+    uint16_t            slaveAddress;       /**< 7-bit or 10-bit slave address */
+    bool                enable10BitAddress; /**< Enable 10-bit addressing */
+    bool                enableGeneralCall;  /**< Also answer the general call address */
+    bool                stretchAddress;     /**< Hold SCL after the address until the ISR ran (ADRSTALL) */
+    bool                stretchRx;          /**< Hold SCL while a received byte is unread (RXSTALL) */
+    bool                stretchTx;          /**< Hold SCL while no transmit byte is ready (TXDSTALL) */
+    uint8_t             clockHold;          /**< SCFGR2.CLKHOLD, minimum SCL low after stretching (0-15) */
+    uint8_t             dataValid;          /**< SCFGR2.DATAVD, SDA data valid delay (0-63) */
+    uint8_t            *registerMap;        /**< RAM register map, NULL for buffer mode */
+    uint16_t            registerMapSize;    /**< Register map bytes (1 to I2C_SLAVE_MAX_REGISTER_MAP) */
+    bool                useDma;             /**< Move the data phase with eDMA */
+    uint8_t             rxDmaChannel;       /**< DMA channel for slave receive (useDma) */
+    uint8_t             txDmaChannel;       /**< DMA channel for slave transmit (useDma) */
+    I2C_SlaveCallback_t callback;           /**< Event callback, may be NULL */
+    void               *userData;           /**< Callback user data */
+} I2C_SlaveAsyncConfig_t;
+
 /*******************************************************************************
  * Function Prototypes - Master Mode
  ******************************************************************************/
@@ -148,6 +273,238 @@ uint32_t I2C_MasterGetStatus(LPI2C_RegType *base);
  */
 void I2C_MasterClearStatus(LPI2C_RegType *base, uint32_t flags);
 
+/**
+ * @brief Calculate LPI2C master timing for a bus mode and baud rate
+ * @details SCL period = (CLKLO + CLKHI + 2 + SCL_LATENCY) * 2^PRESCALE / srcClock
+ *          with SCL_LATENCY = (2 + FILTSCL + riseTime * srcClock) >> PRESCALE.
+ *          The smallest prescaler that meets the mode's tLOW / tHIGH /
+ *          tSU;STA minimums and tVD;DAT maximum is chosen, so the SCL
+ *          frequency never exceeds baudRate. Pure calculation, no register
+ *          access.
+ * 
+ * @param[in]  srcClock    LPI2C functional clock in Hz (PCC_GetLpi2cClockFreq())
+ * @param[in]  mode        Bus speed mode
+ * @param[in]  baudRate    Requested SCL frequency in Hz
+ * @param[in]  riseTimeNs  Measured SCL rise time (30% - 70%) in ns
+ * @param[in]  filtScl     MCFGR2.FILTSCL glitch filter cycles
+ * @param[out] timing      Result
+ * 
+ * @return I2C_STATUS_SUCCESS, I2C_STATUS_ERROR if the baud rate cannot be
+ *         reached with this clock (e.g. 1 MHz needs srcClock >= 24 MHz
+ *         with ~100 ns rise time)
+ */
+I2C_Status_t I2C_CalculateTiming(uint32_t srcClock, I2C_BusMode_t mode, uint32_t baudRate,
+                                 uint32_t riseTimeNs, uint8_t filtScl, I2C_Timing_t *timing);
+
+/**
+ * @brief Configure master bus speed from the current LPI2C clock
+ * @details Reads the functional clock with PCC_GetLpi2cClockFreq() and
+ *          FILTSCL from MCFGR2, then programs PRESCALE and MCCR0. For
+ *          I2C_BUS_MODE_HIGH_SPEED MCCR1 gets the HS timing and MCCR0 an Fm
+ *          timing (<= 400 kHz, same prescaler) for the master code; START
+ *          commands then use the HS variants and each bus acquisition is
+ *          preceded by the master code. The master is disabled while the
+ *          clock registers are written and re-enabled if it was on.
+ * 
+ * @param[in]  base        Pointer to I2C peripheral base address
+ * @param[in]  mode        Bus speed mode
+ * @param[in]  baudRate    SCL frequency in Hz (HS phase for I2C_BUS_MODE_HIGH_SPEED)
+ * @param[in]  riseTimeNs  Measured SCL rise time in ns (scope, 30% - 70%)
+ * @param[out] timing      Applied timing (main phase), may be NULL
+ * 
+ * @return I2C_STATUS_SUCCESS, I2C_STATUS_BUSY if the master is busy,
+ *         I2C_STATUS_ERROR if the rate cannot be reached
+ * 
+ * @note Fm+ / HS need pull-ups strong enough for the rise time; measure it
+ *       and pass the real value, SCL_LATENCY grows with it.
+ * 
+ * @code
+ * I2C_MasterInit(LPI2C0, &config, PCC_GetLpi2cClockFreq(0U));
+ * I2C_MasterConfigBusSpeed(LPI2C0, I2C_BUS_MODE_FAST_PLUS, 1000000U, 120U, NULL);
+ * @endcode
+ */
+I2C_Status_t I2C_MasterConfigBusSpeed(LPI2C_RegType *base, I2C_BusMode_t mode, uint32_t baudRate,
+                                      uint32_t riseTimeNs, I2C_Timing_t *timing);
+
+/*******************************************************************************
+ * Function Prototypes - Asynchronous Master Transfers
+ ******************************************************************************/
+
+/**
+ * @brief Enable the interrupt-driven master transfer engine
+ * @details Transfers are turned into LPI2C command words (START + address,
+ *          transmit, receive N bytes, STOP) and fed to the command FIFO from
+ *          the master interrupt; received bytes are drained from MRDR.
+ *          Descriptors are executed in submission order.
+ * 
+ * @param[in] base  Pointer to I2C peripheral base address
+ * 
+ * @return I2C_STATUS_SUCCESS, I2C_STATUS_ERROR for an invalid base
+ * 
+ * @note Call after I2C_MasterInit(). Enable LPI2Cx_Master_IRQn in the NVIC
+ *       and call I2C_MasterIRQHandler() from LPI2Cx_Master_IRQHandler.
+ *       Do not mix with the blocking I2C_Master* transfer functions while
+ *       transfers are queued.
+ * 
+ * @code
+ * static uint8_t s_temp[2];
+ * static I2C_Transfer_t s_read = {
+ *     .slaveAddress = 0x48U, .direction = I2C_READ,
+ *     .rxBuff = s_temp, .size = 2U, .sendStop = true,
+ *     .callback = OnTemperature
+ * };
+ * 
+ * I2C_MasterEnableAsync(LPI2C0);
+ * NVIC_EnableIRQ(LPI2C0_Master_IRQn);
+ * I2C_MasterSubmit(LPI2C0, &s_read);      // returns at once
+ * 
+ * void LPI2C0_Master_IRQHandler(void) {
+ *     I2C_MasterIRQHandler(LPI2C0);
+ * }
+ * @endcode
+ */
+I2C_Status_t I2C_MasterEnableAsync(LPI2C_RegType *base);
+
+/**
+ * @brief Disable the asynchronous engine
+ * @details Masks the master interrupts, flushes the FIFOs and completes
+ *          every queued descriptor with I2C_STATUS_ERROR.
+ * 
+ * @param[in] base  Pointer to I2C peripheral base address
+ */
+void I2C_MasterDisableAsync(LPI2C_RegType *base);
+
+/**
+ * @brief Queue a transfer (non-blocking)
+ * 
+ * @param[in] base      Pointer to I2C peripheral base address
+ * @param[in] transfer  Descriptor, status is set to I2C_STATUS_BUSY
+ * 
+ * @return I2C_STATUS_SUCCESS if queued, I2C_STATUS_BUSY if the descriptor
+ *         is already queued, I2C_STATUS_ERROR for invalid parameters or
+ *         engine not enabled
+ * 
+ * @note A transfer with sendStop = false completes when its last command
+ *       has been queued to the FIFO (write) or its last byte received
+ *       (read); the bus stays owned until the next transfer's repeated START.
+ */
+I2C_Status_t I2C_MasterSubmit(LPI2C_RegType *base, I2C_Transfer_t *transfer);
+
+/**
+ * @brief Queue several transfers back-to-back (non-blocking)
+ * @details All descriptors are linked in one critical section, so the
+ *          command FIFO runs them without a gap for the CPU, e.g. one
+ *          register read per sensor per control frame. Descriptors are
+ *          checked first; nothing is queued if one is invalid or busy.
+ * 
+ * @param[in] base       Pointer to I2C peripheral base address
+ * @param[in] transfers  Array of descriptor pointers
+ * @param[in] count      Number of descriptors
+ * 
+ * @return Same codes as I2C_MasterSubmit()
+ * 
+ * @code
+ * static const uint8_t s_accelReg = 0x28U | 0x80U;   // OUT_X_L, auto-increment
+ * static const uint8_t s_gyroReg  = 0x22U;
+ * static uint8_t s_accel[6], s_gyro[6];
+ * static I2C_Transfer_t s_accelRead, s_gyroRead;
+ * static I2C_Transfer_t *const s_frame[] = { &s_accelRead, &s_gyroRead };
+ * 
+ * I2C_MasterPrepareRegisterRead(&s_accelRead, 0x19U, &s_accelReg, 1U, s_accel, 6U);
+ * I2C_MasterPrepareRegisterRead(&s_gyroRead, 0x6AU, &s_gyroReg, 1U, s_gyro, 6U);
+ * s_gyroRead.callback = OnFrameDone;
+ * 
+ * I2C_MasterSubmitBatch(LPI2C0, s_frame, 2U);          // every control tick
+ * @endcode
+ */
+I2C_Status_t I2C_MasterSubmitBatch(LPI2C_RegType *base, I2C_Transfer_t *const *transfers, uint32_t count);
+
+/**
+ * @brief Fill a descriptor for a register read (write reg, repeated START, read)
+ * @details Sets sendStop = true, callback / userData = NULL; set those
+ *          afterwards when needed.
+ * 
+ * @param[out] transfer      Descriptor to fill
+ * @param[in]  slaveAddress  7-bit slave address
+ * @param[in]  regBuff       Register address bytes, MSB first
+ * @param[in]  regSize       Register bytes (1 to I2C_MAX_REGISTER_SIZE)
+ * @param[out] rxBuff        Receive buffer
+ * @param[in]  size          Bytes to read
+ */
+void I2C_MasterPrepareRegisterRead(I2C_Transfer_t *transfer, uint8_t slaveAddress,
+                                   const uint8_t *regBuff, uint8_t regSize,
+                                   uint8_t *rxBuff, uint32_t size);
+
+/**
+ * @brief Check whether the asynchronous queue is empty
+ * 
+ * @param[in] base  Pointer to I2C peripheral base address
+ * 
+ * @return true when no transfer is queued or running
+ */
+bool I2C_MasterIsAsyncIdle(LPI2C_RegType *base);
+
+/**
+ * @brief Take the master bus for a multi-call sequence
+ * @details Recursive lock shared with I2C_MasterTransferBlocking(), so a
+ *          START / Send / Receive / STOP sequence of one task is not
+ *          interleaved with another task's transfer. In bare-metal builds
+ *          (OSAL_FREERTOS = 0) and before the scheduler starts it always
+ *          succeeds at once.
+ * 
+ * @param[in] base       Pointer to I2C peripheral base address
+ * @param[in] timeoutMs  Wait limit in ms, OSAL_WAIT_FOREVER to wait forever
+ * 
+ * @return I2C_STATUS_SUCCESS, I2C_STATUS_BUSY if another task kept the bus
+ *         for timeoutMs, I2C_STATUS_ERROR before I2C_MasterInit()
+ * 
+ * @code
+ * if (I2C_MasterLockBus(LPI2C0, 10U) == I2C_STATUS_SUCCESS) {
+ *     I2C_MasterStart(LPI2C0, 0x50U, I2C_WRITE);
+ *     I2C_MasterSend(LPI2C0, page, sizeof(page), true);
+ *     I2C_MasterUnlockBus(LPI2C0);
+ * }
+ * @endcode
+ */
+I2C_Status_t I2C_MasterLockBus(LPI2C_RegType *base, uint32_t timeoutMs);
+
+/**
+ * @brief Release the master bus taken with I2C_MasterLockBus()
+ * 
+ * @param[in] base  Pointer to I2C peripheral base address
+ */
+void I2C_MasterUnlockBus(LPI2C_RegType *base);
+
+/**
+ * @brief Run one descriptor on the asynchronous engine and wait for it
+ * @details Takes the bus lock, submits the descriptor and, with
+ *          OSAL_FREERTOS = 1 in a task, sleeps until the ISR completes it;
+ *          otherwise polls transfer->status. The descriptor callback (if
+ *          any) still runs from the ISR first.
+ * 
+ * @param[in] base       Pointer to I2C peripheral base address
+ * @param[in] transfer   Descriptor (needs I2C_MasterEnableAsync() and the
+ *                       master IRQ enabled)
+ * @param[in] timeoutMs  Wait limit in ms for the lock and the transfer
+ * 
+ * @return Result of the transfer, I2C_STATUS_BUSY if the lock timed out,
+ *         I2C_STATUS_TIMEOUT if the transfer did not complete in time
+ * 
+ * @note After I2C_STATUS_TIMEOUT the descriptor is still queued; it must
+ *       stay valid until transfer->status leaves I2C_STATUS_BUSY (or
+ *       I2C_MasterDisableAsync() flushes it).
+ */
+I2C_Status_t I2C_MasterTransferBlocking(LPI2C_RegType *base, I2C_Transfer_t *transfer, uint32_t timeoutMs);
+
+/**
+ * @brief Master interrupt handler for the asynchronous engine
+ * 
+ * @param[in] base  Pointer to I2C peripheral base address
+ * 
+ * @note User should call this from LPI2Cx_Master_IRQHandler.
+ */
+void I2C_MasterIRQHandler(LPI2C_RegType *base);
+
 /*******************************************************************************
  * Function Prototypes - Slave Mode
  ******************************************************************************/
@@ -171,6 +528,8 @@ void I2C_SlaveDeinit(LPI2C_RegType *base);
 
 /**
  * @brief Send data in slave mode
+ * @details Polls SSR, the CPU is blocked for the whole transfer. Prefer
+ *          I2C_SlaveEnableAsync().
  * 
  * @param[in] base      Pointer to I2C peripheral base address
  * @param[in] txBuff    Pointer to transmit buffer
@@ -182,6 +541,8 @@ I2C_Status_t I2C_SlaveSend(LPI2C_RegType *base, const uint8_t *txBuff, uint32_t
 
 /**
  * @brief Receive data in slave mode
+ * @details Polls SSR, the CPU is blocked for the whole transfer. Prefer
+ *          I2C_SlaveEnableAsync().
  * 
  * @param[in]  base    Pointer to I2C peripheral base address
  * @param[out] rxBuff  Pointer to receive buffer
@@ -191,6 +552,122 @@ I2C_Status_t I2C_SlaveSend(LPI2C_RegType *base, const uint8_t *txBuff, uint32_t
  */
 I2C_Status_t I2C_SlaveReceive(LPI2C_RegType *base, uint8_t *rxBuff, uint32_t rxSize);
 
+/*******************************************************************************
+ * Function Prototypes - Event-Driven Slave
+ ******************************************************************************/
+
+/**
+ * @brief Enable the interrupt / DMA driven slave
+ * @details Resets the slave logic, programs address match, clock stretching
+ *          and hold / data valid timing, then enables address valid,
+ *          receive, transmit, repeated START, STOP and error interrupts.
+ *          Each phase (address match up to repeated START or STOP) is
+ *          serviced by I2C_SlaveIRQHandler(); with useDma the data bytes are
+ *          moved by eDMA (DMAMUX_SRC_LPI2C0_RX / _TX) and the ISR only sees
+ *          the phase boundaries. Takes a PCC clock reference until
+ *          I2C_SlaveDisableAsync().
+ * 
+ * @param[in] base    Pointer to I2C peripheral base address
+ * @param[in] config  Slave configuration
+ * 
+ * @return I2C_STATUS_SUCCESS, I2C_STATUS_ERROR for invalid parameters
+ * 
+ * @note Enable LPI2Cx_Slave_IRQn in the NVIC and call I2C_SlaveIRQHandler()
+ *       from LPI2Cx_Slave_IRQHandler. With useDma also route the two DMA
+ *       channel IRQs to DMA_IRQHandler (end of the buffer falls back to the
+ *       ISR). Without stretchRx / stretchTx a late ISR shows up as
+ *       I2C_SLAVE_EVENT_ERROR (FIFO error) instead of a held bus.
+ * 
+ * @code
+ * static uint8_t s_regs[32];                     // emulated sensor registers
+ * static const I2C_SlaveAsyncConfig_t s_slaveCfg = {
+ *     .slaveAddress = 0x42U,
+ *     .stretchAddress = true, .stretchRx = true, .stretchTx = true,
+ *     .registerMap = s_regs, .registerMapSize = sizeof(s_regs),
+ *     .callback = OnSlaveEvent                   // STOP: check what was written
+ * };
+ * 
+ * I2C_EnableClock(0U);
+ * I2C_SlaveEnableAsync(LPI2C0, &s_slaveCfg);
+ * NVIC_EnableIRQ(LPI2C0_Slave_IRQn);
+ * 
+ * void LPI2C0_Slave_IRQHandler(void) {
+ *     I2C_SlaveIRQHandler(LPI2C0);
+ * }
+ * @endcode
+ */
+I2C_Status_t I2C_SlaveEnableAsync(LPI2C_RegType *base, const I2C_SlaveAsyncConfig_t *config);
+
+/**
+ * @brief Disable the event-driven slave
+ * @details Masks the slave interrupts and DMA requests, stops a running
+ *          DMA transfer, disables the slave and drops the clock reference.
+ * 
+ * @param[in] base  Pointer to I2C peripheral base address
+ */
+void I2C_SlaveDisableAsync(LPI2C_RegType *base);
+
+/**
+ * @brief Set the data sent when the master reads (buffer mode)
+ * @details Every read phase starts again at txBuff[0]; call from the
+ *          ADDRESS_MATCH callback to give per-transfer data, or from
+ *          TX_EMPTY to continue with more. Past the end the slave sends
+ *          I2C_SLAVE_FILL_BYTE.
+ * 
+ * @param[in] base    Pointer to I2C peripheral base address
+ * @param[in] txBuff  Data to send (must stay valid), NULL for none
+ * @param[in] txSize  Bytes in txBuff
+ * 
+ * @return I2C_STATUS_SUCCESS, I2C_STATUS_ERROR in register map mode
+ */
+I2C_Status_t I2C_SlaveSetTxBuffer(LPI2C_RegType *base, const uint8_t *txBuff, uint32_t txSize);
+
+/**
+ * @brief Set the buffer filled when the master writes (buffer mode)
+ * @details Every write phase starts again at rxBuff[0]; bytes past the end
+ *          are acknowledged and dropped.
+ * 
+ * @param[in] base    Pointer to I2C peripheral base address
+ * @param[in] rxBuff  Receive buffer (must stay valid), NULL for none
+ * @param[in] rxSize  Bytes in rxBuff
+ * 
+ * @return I2C_STATUS_SUCCESS, I2C_STATUS_ERROR in register map mode
+ */
+I2C_Status_t I2C_SlaveSetRxBuffer(LPI2C_RegType *base, uint8_t *rxBuff, uint32_t rxSize);
+
+/**
+ * @brief Data bytes of the running / last phase
+ * @details Received bytes stored, or transmitted bytes the master clocked
+ *          out (the byte preloaded for a read the master NACKed is not
+ *          counted). Fill bytes and the register pointer are not counted.
+ * 
+ * @param[in] base  Pointer to I2C peripheral base address
+ * 
+ * @return Byte count, 0 for an invalid base
+ */
+uint32_t I2C_SlaveGetTransferCount(LPI2C_RegType *base);
+
+/**
+ * @brief Register range written by the last write phase (register map mode)
+ * 
+ * @param[in]  base       Pointer to I2C peripheral base address
+ * @param[out] firstReg   Register pointer sent by the master
+ * @param[out] count      Bytes stored from firstReg on (0 for a pointer-only write)
+ * 
+ * @return I2C_STATUS_SUCCESS, I2C_STATUS_ERROR without a register map or
+ *         before the first write
+ */
+I2C_Status_t I2C_SlaveGetRegisterWrite(LPI2C_RegType *base, uint8_t *firstReg, uint32_t *count);
+
+/**
+ * @brief Slave interrupt handler for the event-driven slave
+ * 
+ * @param[in] base  Pointer to I2C peripheral base address
+ * 
+ * @note User should call this from LPI2Cx_Slave_IRQHandler.
+ */
+void I2C_SlaveIRQHandler(LPI2C_RegType *base);
+
 /*******************************************************************************
  * Function Prototypes - Utility
  ******************************************************************************/
@@ -206,13 +683,22 @@ bool I2C_IsBusBusy(LPI2C_RegType *base);
 
 /**
  * @brief Enable I2C clock
+ * @details Takes a PCC clock reference (PCC_AcquirePeripheralClock()).
+ *          The asynchronous engine holds its own reference from
+ *          I2C_MasterSubmit() until the queue is empty and the bus is
+ *          released, so calling I2C_DisableClock() after init gates the
+ *          LPI2C function clock between transfer bursts automatically.
  * 
  * @param[in] instance  I2C instance number (0, 1, 2...)
+ * 
+ * @note Blocking master / slave functions need the application reference.
  */
 void I2C_EnableClock(uint8_t instance);
 
 /**
  * @brief Disable I2C clock
+ * @details Drops the reference taken by I2C_EnableClock(); the clock stops
+ *          when no other reference (async transfer) is held.
  * 
  * @param[in] instance  I2C instance number (0, 1, 2...)
  */
@@ -212,6 +212,15 @@ typedef struct {
 #define LPI2C_MCCR0_DATAVD_WIDTH        (6U)
 #define LPI2C_MCCR0_DATAVD(x)           (((uint32_t)(x) << LPI2C_MCCR0_DATAVD_SHIFT) & LPI2C_MCCR0_DATAVD_MASK)
 
+/*******************************************************************************
+ * LPI2C Master Clock Configuration Register 1 (MCCR1) Bit Definitions
+ * Same layout as MCCR0, used for the high-speed (HS) mode phase
+ ******************************************************************************/
+#define LPI2C_MCCR1_CLKLO(x)            LPI2C_MCCR0_CLKLO(x)
+#define LPI2C_MCCR1_CLKHI(x)            LPI2C_MCCR0_CLKHI(x)
+#define LPI2C_MCCR1_SETHOLD(x)          LPI2C_MCCR0_SETHOLD(x)
+#define LPI2C_MCCR1_DATAVD(x)           LPI2C_MCCR0_DATAVD(x)
+
 /*******************************************************************************
  * LPI2C Master Configuration Register 1 (MCFGR1) Bit Definitions
  ******************************************************************************/
@@ -246,6 +255,223 @@ typedef struct {
 #define LPI2C_MCFGR1_PINCFG_WIDTH       (3U)
 #define LPI2C_MCFGR1_PINCFG(x)          (((uint32_t)(x) << LPI2C_MCFGR1_PINCFG_SHIFT) & LPI2C_MCFGR1_PINCFG_MASK)
 
+/*******************************************************************************
+ * LPI2C Master Configuration Register 2 (MCFGR2) Bit Definitions
+ ******************************************************************************/
+
+/* Bus Idle Timeout (BUSIDLE) */
+#define LPI2C_MCFGR2_BUSIDLE_SHIFT      (0U)
+#define LPI2C_MCFGR2_BUSIDLE_MASK       (0x00000FFFUL)
+#define LPI2C_MCFGR2_BUSIDLE_WIDTH      (12U)
+#define LPI2C_MCFGR2_BUSIDLE(x)         (((uint32_t)(x) << LPI2C_MCFGR2_BUSIDLE_SHIFT) & LPI2C_MCFGR2_BUSIDLE_MASK)
+
+/* Glitch Filter SCL (FILTSCL), in functional clock cycles */
+#define LPI2C_MCFGR2_FILTSCL_SHIFT      (16U)
+#define LPI2C_MCFGR2_FILTSCL_MASK       (0x000F0000UL)
+#define LPI2C_MCFGR2_FILTSCL_WIDTH      (4U)
+#define LPI2C_MCFGR2_FILTSCL(x)         (((uint32_t)(x) << LPI2C_MCFGR2_FILTSCL_SHIFT) & LPI2C_MCFGR2_FILTSCL_MASK)
+
+/* Glitch Filter SDA (FILTSDA), in functional clock cycles */
+#define LPI2C_MCFGR2_FILTSDA_SHIFT      (24U)
+#define LPI2C_MCFGR2_FILTSDA_MASK       (0x0F000000UL)
+#define LPI2C_MCFGR2_FILTSDA_WIDTH      (4U)
+#define LPI2C_MCFGR2_FILTSDA(x)         (((uint32_t)(x) << LPI2C_MCFGR2_FILTSDA_SHIFT) & LPI2C_MCFGR2_FILTSDA_MASK)
+
+/*******************************************************************************
+ * LPI2C Parameter Register (PARAM) Bit Definitions
+ ******************************************************************************/
+
+/* Master Transmit FIFO Size, 2^MTXFIFO words (MTXFIFO) */
+#define LPI2C_PARAM_MTXFIFO_SHIFT       (0U)
+#define LPI2C_PARAM_MTXFIFO_MASK        (0x0000000FUL)
+#define LPI2C_PARAM_MTXFIFO_WIDTH       (4U)
+
+/* Master Receive FIFO Size, 2^MRXFIFO words (MRXFIFO) */
+#define LPI2C_PARAM_MRXFIFO_SHIFT       (8U)
+#define LPI2C_PARAM_MRXFIFO_MASK        (0x00000F00UL)
+#define LPI2C_PARAM_MRXFIFO_WIDTH       (4U)
+
+/*******************************************************************************
+ * LPI2C Master Interrupt Enable Register (MIER) Bit Definitions
+ ******************************************************************************/
+
+/* Transmit Data Interrupt Enable (TDIE) */
+#define LPI2C_MIER_TDIE_MASK            (0x00000001UL)
+
+/* Receive Data Interrupt Enable (RDIE) */
+#define LPI2C_MIER_RDIE_MASK            (0x00000002UL)
+
+/* End Packet Interrupt Enable (EPIE) */
+#define LPI2C_MIER_EPIE_MASK            (0x00000100UL)
+
+/* STOP Detect Interrupt Enable (SDIE) */
+#define LPI2C_MIER_SDIE_MASK            (0x00000200UL)
+
+/* NACK Detect Interrupt Enable (NDIE) */
+#define LPI2C_MIER_NDIE_MASK            (0x00000400UL)
+
+/* Arbitration Lost Interrupt Enable (ALIE) */
+#define LPI2C_MIER_ALIE_MASK            (0x00000800UL)
+
+/* FIFO Error Interrupt Enable (FEIE) */
+#define LPI2C_MIER_FEIE_MASK            (0x00001000UL)
+
+/*******************************************************************************
+ * LPI2C Master FIFO Control / Status Register (MFCR / MFSR) Bit Definitions
+ ******************************************************************************/
+
+/* Transmit FIFO Watermark (TXWATER) */
+#define LPI2C_MFCR_TXWATER_SHIFT        (0U)
+#define LPI2C_MFCR_TXWATER_MASK         (0x00000003UL)
+#define LPI2C_MFCR_TXWATER(x)           (((uint32_t)(x) << LPI2C_MFCR_TXWATER_SHIFT) & LPI2C_MFCR_TXWATER_MASK)
+
+/* Receive FIFO Watermark (RXWATER) */
+#define LPI2C_MFCR_RXWATER_SHIFT        (16U)
+#define LPI2C_MFCR_RXWATER_MASK         (0x00030000UL)
+#define LPI2C_MFCR_RXWATER(x)           (((uint32_t)(x) << LPI2C_MFCR_RXWATER_SHIFT) & LPI2C_MFCR_RXWATER_MASK)
+
+/* Transmit FIFO Count (TXCOUNT) */
+#define LPI2C_MFSR_TXCOUNT_SHIFT        (0U)
+#define LPI2C_MFSR_TXCOUNT_MASK         (0x00000007UL)
+
+/* Receive FIFO Count (RXCOUNT) */
+#define LPI2C_MFSR_RXCOUNT_SHIFT        (16U)
+#define LPI2C_MFSR_RXCOUNT_MASK         (0x00070000UL)
+
+/*******************************************************************************
+ * LPI2C Master Transmit Data Register (MTDR) Command Definitions
+ ******************************************************************************/
+
+/* Command (CMD), DATA field holds the byte / receive count */
+#define LPI2C_MTDR_CMD_SHIFT            (8U)
+#define LPI2C_MTDR_CMD_MASK             (0x00000700UL)
+#define LPI2C_MTDR_CMD(x)               (((uint32_t)(x) << LPI2C_MTDR_CMD_SHIFT) & LPI2C_MTDR_CMD_MASK)
+#define LPI2C_MTDR_DATA_MASK            (0x000000FFUL)
+
+#define LPI2C_CMD_TRANSMIT              (0U)    /* Transmit DATA */
+#define LPI2C_CMD_RECEIVE               (1U)    /* Receive DATA + 1 bytes */
+#define LPI2C_CMD_STOP                  (2U)    /* Generate STOP */
+#define LPI2C_CMD_RECEIVE_DISCARD       (3U)    /* Receive and discard DATA + 1 bytes */
+#define LPI2C_CMD_START                 (4U)    /* (Repeated) START + transmit DATA as address */
+#define LPI2C_CMD_START_EXPECT_NACK     (5U)    /* START, expect NACK */
+#define LPI2C_CMD_START_HS              (6U)    /* (Repeated) START + address, high-speed timing (MCCR1) */
+#define LPI2C_CMD_START_HS_EXPECT_NACK  (7U)    /* High-speed START, expect NACK */
+
+/* HS master code 0000 1xxx, sent at Fm timing and always NACKed */
+#define LPI2C_HS_MASTER_CODE            (0x08U)
+
+/*******************************************************************************
+ * LPI2C Slave Control / Status / Interrupt Register Bit Definitions
+ ******************************************************************************/
+
+/* Slave Enable (SEN) */
+#define LPI2C_SCR_SEN_MASK              (0x00000001UL)
+
+/* Slave Software Reset (RST) */
+#define LPI2C_SCR_RST_MASK              (0x00000002UL)
+
+/* Reset Transmit Data Register (RTF) */
+#define LPI2C_SCR_RTF_MASK              (0x00000100UL)
+
+/* Reset Receive Data Register (RRF) */
+#define LPI2C_SCR_RRF_MASK              (0x00000200UL)
+
+/* Transmit Data Flag (TDF) - STDR empty during a slave-transmit transfer */
+#define LPI2C_SSR_TDF_MASK              (0x00000001UL)
+
+/* Receive Data Flag (RDF) */
+#define LPI2C_SSR_RDF_MASK              (0x00000002UL)
+
+/* Address Valid Flag (AVF) - cleared by reading SASR */
+#define LPI2C_SSR_AVF_MASK              (0x00000004UL)
+
+/* Transmit ACK Flag (TAF) */
+#define LPI2C_SSR_TAF_MASK              (0x00000008UL)
+
+/* Repeated START Flag (RSF), write 1 to clear */
+#define LPI2C_SSR_RSF_MASK              (0x00000100UL)
+
+/* STOP Detect Flag (SDF), write 1 to clear */
+#define LPI2C_SSR_SDF_MASK              (0x00000200UL)
+
+/* Bit Error Flag (BEF), write 1 to clear */
+#define LPI2C_SSR_BEF_MASK              (0x00000400UL)
+
+/* FIFO Error Flag (FEF) - overrun / underrun with stretching disabled, write 1 to clear */
+#define LPI2C_SSR_FEF_MASK              (0x00000800UL)
+
+/* General Call Flag (GCF) */
+#define LPI2C_SSR_GCF_MASK              (0x00004000UL)
+
+/* Slave Busy Flag (SBF) */
+#define LPI2C_SSR_SBF_MASK              (0x01000000UL)
+
+/* Slave interrupt enables, same bit positions as the SSR flags */
+#define LPI2C_SIER_TDIE_MASK            (0x00000001UL)
+#define LPI2C_SIER_RDIE_MASK            (0x00000002UL)
+#define LPI2C_SIER_AVIE_MASK            (0x00000004UL)
+#define LPI2C_SIER_RSIE_MASK            (0x00000100UL)
+#define LPI2C_SIER_SDIE_MASK            (0x00000200UL)
+#define LPI2C_SIER_BEIE_MASK            (0x00000400UL)
+#define LPI2C_SIER_FEIE_MASK            (0x00000800UL)
+
+/* Slave DMA enables: Transmit Data (TDDE), Receive Data (RDDE) */
+#define LPI2C_SDER_TDDE_MASK            (0x00000001UL)
+#define LPI2C_SDER_RDDE_MASK            (0x00000002UL)
+
+/*******************************************************************************
+ * LPI2C Slave Configuration Register (SCFGR1 / SCFGR2) Bit Definitions
+ ******************************************************************************/
+
+/* Stretch SCL after the address byte until SASR is read (ADRSTALL) */
+#define LPI2C_SCFGR1_ADRSTALL_MASK      (0x00000001UL)
+
+/* Stretch SCL while SRDR is full (RXSTALL) */
+#define LPI2C_SCFGR1_RXSTALL_MASK       (0x00000002UL)
+
+/* Stretch SCL while STDR is empty in slave-transmit (TXDSTALL) */
+#define LPI2C_SCFGR1_TXDSTALL_MASK      (0x00000004UL)
+
+/* Stretch SCL until STAR is written (ACKSTALL) */
+#define LPI2C_SCFGR1_ACKSTALL_MASK      (0x00000008UL)
+
+/* General Call Enable (GCEN) */
+#define LPI2C_SCFGR1_GCEN_MASK          (0x00000100UL)
+
+/* Address Configuration (ADDRCFG): 0 = 7-bit ADDR0, 1 = 10-bit ADDR0 */
+#define LPI2C_SCFGR1_ADDRCFG_SHIFT      (16U)
+#define LPI2C_SCFGR1_ADDRCFG_MASK       (0x00070000UL)
+#define LPI2C_SCFGR1_ADDRCFG(x)         (((uint32_t)(x) << LPI2C_SCFGR1_ADDRCFG_SHIFT) & LPI2C_SCFGR1_ADDRCFG_MASK)
+
+/* Clock Hold Time (CLKHOLD), minimum SCL low after clock stretching */
+#define LPI2C_SCFGR2_CLKHOLD_SHIFT      (0U)
+#define LPI2C_SCFGR2_CLKHOLD_MASK       (0x0000000FUL)
+#define LPI2C_SCFGR2_CLKHOLD(x)         (((uint32_t)(x) << LPI2C_SCFGR2_CLKHOLD_SHIFT) & LPI2C_SCFGR2_CLKHOLD_MASK)
+
+/* Data Valid Delay (DATAVD) */
+#define LPI2C_SCFGR2_DATAVD_SHIFT       (8U)
+#define LPI2C_SCFGR2_DATAVD_MASK        (0x00003F00UL)
+#define LPI2C_SCFGR2_DATAVD(x)          (((uint32_t)(x) << LPI2C_SCFGR2_DATAVD_SHIFT) & LPI2C_SCFGR2_DATAVD_MASK)
+
+/*******************************************************************************
+ * LPI2C Slave Address Match / Status / Data Register Bit Definitions
+ ******************************************************************************/
+
+/* Address 0 (ADDR0), 7-bit address in bits [7:1], 10-bit in [10:1] */
+#define LPI2C_SAMR_ADDR0_SHIFT          (1U)
+#define LPI2C_SAMR_ADDR0_MASK           (0x000007FEUL)
+#define LPI2C_SAMR_ADDR0(x)             (((uint32_t)(x) << LPI2C_SAMR_ADDR0_SHIFT) & LPI2C_SAMR_ADDR0_MASK)
+
+/* Received Address (RADDR), bit 0 = R/W of the master */
+#define LPI2C_SASR_RADDR_MASK           (0x000007FFUL)
+#define LPI2C_SASR_RW_MASK              (0x00000001UL)
+
+/* Address Not Valid (ANV) */
+#define LPI2C_SASR_ANV_MASK             (0x00004000UL)
+
+/* Receive data (DATA) */
+#define LPI2C_SRDR_DATA_MASK            (0x000000FFUL)
+
 /*******************************************************************************
  * LPI2C Helper Macros
  ******************************************************************************/
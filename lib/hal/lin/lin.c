@@ -0,0 +1,536 @@
+/**
+ * @file    lin.c
+ * @brief   LIN 2.x master / slave driver implementation for S32K144
+ * @details
+ * One state machine per LPUART instance, stepped from the LPUART interrupt:
+ * - LBKDIF: a break was seen on the bus (the master's own break included),
+ *   any frame in progress is closed, the master writes the sync byte
+ * - RDRF: sync, PID, then the response bytes. Bytes written by this node
+ *   come back on RX and are compared before the next one is written, so
+ *   each transfer is paced by its own readback
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ *
+ * @par Change Log:
+ * - Version 1.0 (14/10/2026): Initial LIN master / slave driver
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "lin.h"
+#include "uart.h"
+#include "nvic.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+
+/* STAT configuration bits kept on every flag-clear write (the rest are w1c) */
+#define LIN_STAT_CONFIG_MASK    (LPUART_STAT_LBKDE_MASK | LPUART_STAT_BRK13_MASK)
+
+#define LIN_STAT_ERROR_MASK     (LPUART_STAT_FE_MASK | LPUART_STAT_NF_MASK | LPUART_STAT_OR_MASK)
+
+#define LIN_CTRL_INT_MASK       (LPUART_CTRL_RIE_MASK | LPUART_CTRL_FEIE_MASK | \
+                                 LPUART_CTRL_NEIE_MASK | LPUART_CTRL_ORIE_MASK)
+
+/**
+ * @brief Frame phase
+ */
+typedef enum {
+    LIN_PHASE_IDLE = 0U,            /**< Waiting for a break */
+    LIN_PHASE_BREAK,                /**< Master: break queued, waiting for its readback */
+    LIN_PHASE_SYNC,                 /**< Waiting for the sync byte */
+    LIN_PHASE_PID,                  /**< Waiting for the protected identifier */
+    LIN_PHASE_RX,                   /**< Receiving the response */
+    LIN_PHASE_TX                    /**< Sending the response */
+} lin_phase_t;
+
+/**
+ * @brief Per-instance state
+ */
+typedef struct {
+    bool                        initialized;
+    lin_node_t                  node;
+    const lin_frame_t          *frames;
+    uint8_t                     frameCount;
+    lin_callback_t              callback;
+    void                       *userData;
+
+    /* Master schedule */
+    const lin_schedule_entry_t *schedule;
+    uint8_t                     scheduleCount;
+    uint8_t                     scheduleIndex;
+    uint16_t                    slotLeft;
+
+    /* Frame in progress */
+    volatile lin_phase_t        phase;
+    const lin_frame_t          *frame;      /* NULL: header only */
+    uint8_t                     id;
+    uint8_t                     pid;
+    uint8_t                     index;      /* Response bytes done */
+    uint8_t                     lastTx;     /* Byte waiting for its readback */
+    uint16_t                    sum;
+    uint8_t                     buffer[LIN_MAX_DATA_LENGTH];
+} lin_state_t;
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static lin_state_t s_linState[LPUART_INSTANCE_COUNT];
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static lin_state_t *LIN_GetState(const LPUART_RegType *base)
+{
+    if (base == LPUART0) {
+        return &s_linState[0];
+    }
+    if (base == LPUART1) {
+        return &s_linState[1];
+    }
+    if (base == LPUART2) {
+        return &s_linState[2];
+    }
+
+    return NULL;
+}
+
+static inline void LIN_ClearFlags(LPUART_RegType *base, uint32_t flags)
+{
+    base->STAT = (base->STAT & LIN_STAT_CONFIG_MASK) | flags;
+}
+
+static inline uint16_t LIN_SumAdd(uint16_t sum, uint8_t byte)
+{
+    sum += byte;
+    if (sum > 0xFFU) {
+        sum -= 0xFFU;
+    }
+
+    return sum;
+}
+
+static lin_checksum_t LIN_FrameChecksum(const lin_frame_t *frame)
+{
+    if ((frame->id == LIN_ID_MASTER_REQUEST) || (frame->id == LIN_ID_SLAVE_RESPONSE)) {
+        return LIN_CHECKSUM_CLASSIC;
+    }
+
+    return frame->checksum;
+}
+
+static const lin_frame_t *LIN_FindFrame(const lin_state_t *state, uint8_t id)
+{
+    uint8_t i;
+
+    for (i = 0U; i < state->frameCount; i++) {
+        if (state->frames[i].id == id) {
+            return &state->frames[i];
+        }
+    }
+
+    return NULL;
+}
+
+static void LIN_Notify(LPUART_RegType *base, lin_state_t *state, lin_event_t event)
+{
+    if (state->callback != NULL) {
+        state->callback(base, state->id, event, state->userData);
+    }
+}
+
+/* Close the frame in progress: a response that did not finish is reported */
+static void LIN_EndFrame(LPUART_RegType *base, lin_state_t *state)
+{
+    if ((state->phase == LIN_PHASE_RX) || (state->phase == LIN_PHASE_TX)) {
+        LIN_Notify(base, state, LIN_EVENT_NO_RESPONSE);
+    }
+
+    state->phase = LIN_PHASE_IDLE;
+}
+
+static void LIN_Abort(LPUART_RegType *base, lin_state_t *state, lin_event_t event)
+{
+    state->phase = LIN_PHASE_IDLE;
+    LIN_Notify(base, state, event);
+}
+
+static inline void LIN_Write(LPUART_RegType *base, lin_state_t *state, uint8_t byte)
+{
+    state->lastTx = byte;
+    LPUART_WRITE_DATA(base, byte);
+}
+
+/* Break: 13 bit times with BRK13, queued by writing SBK 1 then 0 */
+static void LIN_SendBreak(LPUART_RegType *base, lin_state_t *state, uint8_t id)
+{
+    state->id = id & LIN_MAX_ID;
+    state->pid = LIN_CalcPid(state->id);
+    state->frame = NULL;
+    state->phase = LIN_PHASE_BREAK;
+
+    base->CTRL |= LPUART_CTRL_SBK_MASK;
+    base->CTRL &= ~LPUART_CTRL_SBK_MASK;
+}
+
+static void LIN_StartResponse(LPUART_RegType *base, lin_state_t *state)
+{
+    const lin_frame_t *frame = LIN_FindFrame(state, state->id);
+    uint8_t i;
+
+    state->frame = frame;
+    if (frame == NULL) {
+        /* Not ours: wait for the next break */
+        state->phase = LIN_PHASE_IDLE;
+        return;
+    }
+
+    state->index = 0U;
+    state->sum = (LIN_FrameChecksum(frame) == LIN_CHECKSUM_ENHANCED) ? state->pid : 0U;
+
+    if (frame->dir == LIN_DIR_PUBLISH) {
+        /* Snapshot: the application may update frame->data meanwhile */
+        for (i = 0U; i < frame->length; i++) {
+            state->buffer[i] = frame->data[i];
+        }
+        state->phase = LIN_PHASE_TX;
+        LIN_Write(base, state, state->buffer[0]);
+    } else {
+        state->phase = LIN_PHASE_RX;
+    }
+}
+
+static void LIN_RxByte(LPUART_RegType *base, lin_state_t *state, uint8_t byte)
+{
+    const lin_frame_t *frame = state->frame;
+    uint8_t i;
+
+    switch (state->phase) {
+    case LIN_PHASE_SYNC:
+        if (byte != LIN_SYNC_BYTE) {
+            LIN_Abort(base, state, LIN_EVENT_HEADER_ERROR);
+        } else {
+            state->phase = LIN_PHASE_PID;
+            if (state->node == LIN_NODE_MASTER) {
+                LIN_Write(base, state, state->pid);
+            }
+        }
+        break;
+
+    case LIN_PHASE_PID:
+        if (state->node == LIN_NODE_MASTER) {
+            if (byte != state->pid) {
+                LIN_Abort(base, state, LIN_EVENT_READBACK_ERROR);
+                break;
+            }
+        } else {
+            state->id = byte & LIN_MAX_ID;
+            state->pid = byte;
+            if (LIN_CalcPid(state->id) != byte) {
+                LIN_Abort(base, state, LIN_EVENT_HEADER_ERROR);
+                break;
+            }
+        }
+        LIN_StartResponse(base, state);
+        break;
+
+    case LIN_PHASE_TX:
+        if (byte != state->lastTx) {
+            LIN_Abort(base, state, LIN_EVENT_READBACK_ERROR);
+        } else if (state->index < frame->length) {
+            state->sum = LIN_SumAdd(state->sum, byte);
+            state->index++;
+            if (state->index < frame->length) {
+                LIN_Write(base, state, state->buffer[state->index]);
+            } else {
+                LIN_Write(base, state, (uint8_t)~state->sum);
+            }
+        } else {
+            LIN_Abort(base, state, LIN_EVENT_TX_DONE);
+        }
+        break;
+
+    case LIN_PHASE_RX:
+        if (state->index < frame->length) {
+            state->buffer[state->index] = byte;
+            state->sum = LIN_SumAdd(state->sum, byte);
+            state->index++;
+        } else if (byte == (uint8_t)~state->sum) {
+            for (i = 0U; i < frame->length; i++) {
+                frame->data[i] = state->buffer[i];
+            }
+            LIN_Abort(base, state, LIN_EVENT_RX_DONE);
+        } else {
+            LIN_Abort(base, state, LIN_EVENT_CHECKSUM_ERROR);
+        }
+        break;
+
+    default:
+        /* IDLE / BREAK: stray byte, ignored */
+        break;
+    }
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+status_t LIN_Init(LPUART_RegType *base, const lin_config_t *config, uint32_t srcClock)
+{
+    lin_state_t *state = LIN_GetState(base);
+    UART_Config_t uartConfig;
+    uint8_t i;
+
+    if ((state == NULL) || (config == NULL) || ((config->frames == NULL) && (config->frameCount != 0U))) {
+        return STATUS_ERROR;
+    }
+
+    for (i = 0U; i < config->frameCount; i++) {
+        if ((config->frames[i].id > LIN_MAX_ID) || (config->frames[i].data == NULL) ||
+            (config->frames[i].length == 0U) || (config->frames[i].length > LIN_MAX_DATA_LENGTH)) {
+            return STATUS_ERROR;
+        }
+    }
+
+    state->initialized = false;
+
+    UART_GetDefaultConfig(&uartConfig);
+    uartConfig.baudRate = config->baudRate;
+    uartConfig.parity = UART_PARITY_DISABLED;
+    uartConfig.stopBits = UART_ONE_STOP_BIT;
+    uartConfig.dataBits = UART_8_DATA_BITS;
+    uartConfig.enableTx = true;
+    uartConfig.enableRx = true;
+    uartConfig.enableFifo = false;
+    if (UART_Init(base, &uartConfig, srcClock) != UART_STATUS_SUCCESS) {
+        return STATUS_ERROR;
+    }
+
+    state->node = config->node;
+    state->frames = config->frames;
+    state->frameCount = config->frameCount;
+    state->callback = config->callback;
+    state->userData = config->userData;
+    state->schedule = NULL;
+    state->scheduleCount = 0U;
+    state->scheduleIndex = 0U;
+    state->slotLeft = 0U;
+    state->frame = NULL;
+    state->phase = LIN_PHASE_IDLE;
+
+    /* 13-bit break out, 11-bit break detection in (break not stored in DATA) */
+    base->STAT = LPUART_STAT_LBKDE_MASK | LPUART_STAT_BRK13_MASK | LPUART_STAT_LBKDIF_MASK |
+                 LIN_STAT_ERROR_MASK;
+    base->BAUD |= LPUART_BAUD_LBKDIE_MASK;
+    base->CTRL |= LIN_CTRL_INT_MASK;
+
+    (void)NVIC_SetPriority((IRQn_Type)((uint32_t)LPUART0_RxTx_IRQn + (2U * (uint32_t)(state - s_linState))),
+                           NVIC_PRIO_UART);
+
+    state->initialized = true;
+
+    return STATUS_SUCCESS;
+}
+
+status_t LIN_Deinit(LPUART_RegType *base)
+{
+    lin_state_t *state = LIN_GetState(base);
+
+    if ((state == NULL) || !state->initialized) {
+        return STATUS_ERROR;
+    }
+
+    base->CTRL &= ~LIN_CTRL_INT_MASK;
+    base->BAUD &= ~LPUART_BAUD_LBKDIE_MASK;
+    state->initialized = false;
+    state->phase = LIN_PHASE_IDLE;
+    UART_Deinit(base);
+
+    return STATUS_SUCCESS;
+}
+
+/* Per-instance vectors: base is a constant */
+static void LIN_Lpuart0Vector(void) { LIN_IRQHandler(LPUART0); }
+static void LIN_Lpuart1Vector(void) { LIN_IRQHandler(LPUART1); }
+static void LIN_Lpuart2Vector(void) { LIN_IRQHandler(LPUART2); }
+
+static const nvic_handler_t s_linVectors[LPUART_INSTANCE_COUNT] = {
+    LIN_Lpuart0Vector, LIN_Lpuart1Vector, LIN_Lpuart2Vector
+};
+
+status_t LIN_InstallIrqHandler(LPUART_RegType *base)
+{
+    lin_state_t *state = LIN_GetState(base);
+    uint32_t instance;
+
+    if (state == NULL) {
+        return STATUS_ERROR;
+    }
+
+    instance = (uint32_t)(state - s_linState);
+    if (NVIC_InstallHandler((IRQn_Type)((uint32_t)LPUART0_RxTx_IRQn + (2U * instance)),
+                            s_linVectors[instance]) != NVIC_STATUS_SUCCESS) {
+        return STATUS_ERROR;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+status_t LIN_MasterSetSchedule(LPUART_RegType *base, const lin_schedule_entry_t *table, uint8_t count)
+{
+    lin_state_t *state = LIN_GetState(base);
+    uint32_t basepri;
+    uint8_t i;
+
+    if ((state == NULL) || !state->initialized || (state->node != LIN_NODE_MASTER) ||
+        ((table == NULL) && (count != 0U))) {
+        return STATUS_ERROR;
+    }
+
+    for (i = 0U; i < count; i++) {
+        if ((table[i].id > LIN_MAX_ID) || (table[i].slotTicks == 0U)) {
+            return STATUS_ERROR;
+        }
+    }
+
+    /* LIN_MasterTick() may run in a timer interrupt */
+    basepri = NVIC_EnterCritical();
+    state->schedule = table;
+    state->scheduleCount = count;
+    state->scheduleIndex = (count != 0U) ? (uint8_t)(count - 1U) : 0U;
+    state->slotLeft = 1U;
+    NVIC_ExitCritical(basepri);
+
+    return STATUS_SUCCESS;
+}
+
+void LIN_MasterTick(LPUART_RegType *base)
+{
+    lin_state_t *state = LIN_GetState(base);
+    const lin_schedule_entry_t *entry;
+    uint32_t basepri;
+
+    if ((state == NULL) || !state->initialized || (state->node != LIN_NODE_MASTER)) {
+        return;
+    }
+
+    /* Timer and LPUART interrupts may preempt each other */
+    basepri = NVIC_EnterCritical();
+
+    if ((state->scheduleCount != 0U) && (--state->slotLeft == 0U)) {
+        state->scheduleIndex++;
+        if (state->scheduleIndex >= state->scheduleCount) {
+            state->scheduleIndex = 0U;
+        }
+        entry = &state->schedule[state->scheduleIndex];
+        state->slotLeft = entry->slotTicks;
+
+        LIN_EndFrame(base, state);
+        LIN_SendBreak(base, state, entry->id);
+    }
+
+    NVIC_ExitCritical(basepri);
+}
+
+status_t LIN_MasterSendHeader(LPUART_RegType *base, uint8_t id)
+{
+    lin_state_t *state = LIN_GetState(base);
+    status_t status = STATUS_SUCCESS;
+    uint32_t basepri;
+
+    if ((state == NULL) || !state->initialized || (state->node != LIN_NODE_MASTER) || (id > LIN_MAX_ID)) {
+        return STATUS_ERROR;
+    }
+
+    basepri = NVIC_EnterCritical();
+    if (state->phase != LIN_PHASE_IDLE) {
+        status = STATUS_BUSY;
+    } else {
+        LIN_SendBreak(base, state, id);
+    }
+    NVIC_ExitCritical(basepri);
+
+    return status;
+}
+
+bool LIN_IsBusy(LPUART_RegType *base)
+{
+    const lin_state_t *state = LIN_GetState(base);
+
+    return (state != NULL) && (state->phase != LIN_PHASE_IDLE);
+}
+
+void LIN_IRQHandler(LPUART_RegType *base)
+{
+    lin_state_t *state = LIN_GetState(base);
+    uint32_t stat;
+
+    if ((state == NULL) || !state->initialized) {
+        return;
+    }
+
+    stat = base->STAT;
+
+    if ((stat & LPUART_STAT_LBKDIF_MASK) != 0U) {
+        LIN_ClearFlags(base, LPUART_STAT_LBKDIF_MASK);
+
+        /* Master: readback of its own break. Slave: start of any frame */
+        if (state->node == LIN_NODE_MASTER) {
+            if (state->phase == LIN_PHASE_BREAK) {
+                state->phase = LIN_PHASE_SYNC;
+                LIN_Write(base, state, LIN_SYNC_BYTE);
+            }
+        } else {
+            LIN_EndFrame(base, state);
+            state->phase = LIN_PHASE_SYNC;
+        }
+    }
+
+    if ((stat & LIN_STAT_ERROR_MASK) != 0U) {
+        (void)LPUART_READ_DATA(base);
+        LIN_ClearFlags(base, stat & LIN_STAT_ERROR_MASK);
+        if ((state->phase != LIN_PHASE_IDLE) && (state->phase != LIN_PHASE_BREAK)) {
+            LIN_Abort(base, state, LIN_EVENT_FRAME_ERROR);
+        }
+        return;
+    }
+
+    if ((stat & LPUART_STAT_RDRF_MASK) != 0U) {
+        LIN_RxByte(base, state, (uint8_t)LPUART_READ_DATA(base));
+    }
+}
+
+uint8_t LIN_CalcPid(uint8_t id)
+{
+    uint8_t p0;
+    uint8_t p1;
+
+    id &= LIN_MAX_ID;
+    p0 = (uint8_t)((id ^ (id >> 1U) ^ (id >> 2U) ^ (id >> 4U)) & 0x01U);
+    p1 = (uint8_t)(~((id >> 1U) ^ (id >> 3U) ^ (id >> 4U) ^ (id >> 5U)) & 0x01U);
+
+    return (uint8_t)(id | (uint8_t)(p0 << 6U) | (uint8_t)(p1 << 7U));
+}
+
+uint8_t LIN_CalcChecksum(uint8_t pid, const uint8_t *data, uint8_t length, lin_checksum_t checksum)
+{
+    uint8_t id = pid & LIN_MAX_ID;
+    uint16_t sum = 0U;
+    uint8_t i;
+
+    if ((checksum == LIN_CHECKSUM_ENHANCED) && (id != LIN_ID_MASTER_REQUEST) && (id != LIN_ID_SLAVE_RESPONSE)) {
+        sum = pid;
+    }
+
+    for (i = 0U; (data != NULL) && (i < length); i++) {
+        sum = LIN_SumAdd(sum, data[i]);
+    }
+
+    return (uint8_t)~sum;
+}
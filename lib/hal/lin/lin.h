@@ -0,0 +1,266 @@
+/**
+ * @file    lin.h
+ * @brief   LIN 2.x master / slave driver over LPUART for S32K144
+ * @details
+ * LIN driver provides the following APIs:
+ * - Master and slave node on any LPUART instance (8N1, 1-20 kbit/s)
+ * - Break generation (13 bit times, STAT[BRK13] + CTRL[SBK]) and break
+ *   detection (STAT[LBKDE], BAUD[LBKDIE]) in hardware
+ * - Header (break, sync 0x55, protected identifier) and response (1-8 data
+ *   bytes + checksum) handled byte by byte in the LPUART interrupt
+ * - Classic (LIN 1.x, diagnostic frames) and enhanced (LIN 2.x) checksum
+ * - Readback check of every transmitted byte (LIN bit error)
+ * - Master schedule table stepped by LIN_MasterTick() from a timer
+ *
+ * Frame flow (every byte the node sends is read back on RX: the bus is a
+ * single wire):
+ * @verbatim
+ *   Master  : BREAK --> LBKDIF --> 0x55 --> PID --> [data.. checksum]
+ *   Slave   :           LBKDIF --> 0x55 --> PID --> publish / subscribe
+ * @endverbatim
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ *
+ * @note
+ * - The LPUART vector of the LIN instance must call LIN_IRQHandler()
+ *   (LIN_InstallIrqHandler() puts it in the RAM vector table); do not use
+ *   the UART async / callback APIs on the same instance
+ * - The hardware FIFO is not used: one interrupt per byte (about 20 per
+ *   frame, 500 us apart at 20 kbit/s)
+ * - No auto-baud: slaves rely on the clock tolerance (FIRC / SOSC well
+ *   within the +/-1.5 % LIN budget for nodes without resynchronisation)
+ *
+ * @par Change Log:
+ * - Version 1.0 (14/10/2026): Initial LIN master / slave driver
+ */
+
+#ifndef LIN_H
+#define LIN_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "uart_reg.h"
+#include "status.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @defgroup LIN_Definitions LIN Definitions
+ * @{
+ */
+
+/** @brief Maximum response length in bytes */
+#define LIN_MAX_DATA_LENGTH         (8U)
+
+/** @brief Highest frame identifier */
+#define LIN_MAX_ID                  (0x3FU)
+
+/** @brief Sync byte of the header */
+#define LIN_SYNC_BYTE               (0x55U)
+
+/** @brief Diagnostic frames (always classic checksum) */
+#define LIN_ID_MASTER_REQUEST       (0x3CU)
+#define LIN_ID_SLAVE_RESPONSE       (0x3DU)
+
+/**
+ * @brief Node role
+ */
+typedef enum {
+    LIN_NODE_MASTER = 0U,           /**< Sends headers from the schedule table */
+    LIN_NODE_SLAVE  = 1U            /**< Answers headers sent by the master */
+} lin_node_t;
+
+/**
+ * @brief Response direction, seen from this node
+ */
+typedef enum {
+    LIN_DIR_PUBLISH   = 0U,         /**< This node sends the response */
+    LIN_DIR_SUBSCRIBE = 1U          /**< This node receives the response */
+} lin_dir_t;
+
+/**
+ * @brief Checksum model
+ */
+typedef enum {
+    LIN_CHECKSUM_CLASSIC  = 0U,     /**< Data bytes only (LIN 1.x) */
+    LIN_CHECKSUM_ENHANCED = 1U      /**< PID + data bytes (LIN 2.x) */
+} lin_checksum_t;
+
+/**
+ * @brief Frame events reported to the callback
+ */
+typedef enum {
+    LIN_EVENT_TX_DONE        = 0U,  /**< Response published and read back */
+    LIN_EVENT_RX_DONE        = 1U,  /**< Response received, checksum ok, data copied */
+    LIN_EVENT_CHECKSUM_ERROR = 2U,  /**< Response received, checksum wrong (data not copied) */
+    LIN_EVENT_READBACK_ERROR = 3U,  /**< Byte read back differs from the byte sent (bit error) */
+    LIN_EVENT_NO_RESPONSE    = 4U,  /**< Response missing or incomplete at the next header */
+    LIN_EVENT_HEADER_ERROR   = 5U,  /**< Bad sync byte or PID parity */
+    LIN_EVENT_FRAME_ERROR    = 6U   /**< LPUART framing / noise / overrun error */
+} lin_event_t;
+
+/** @} */
+
+/*******************************************************************************
+ * Type Definitions
+ ******************************************************************************/
+
+/**
+ * @brief Frame handled by this node
+ * @details Identifiers not listed in the frame table are ignored by a slave
+ *          and sent header-only by the master (slave-to-slave frames).
+ */
+typedef struct {
+    uint8_t         id;             /**< Frame identifier (0..LIN_MAX_ID) */
+    lin_dir_t       dir;            /**< Publish or subscribe */
+    lin_checksum_t  checksum;       /**< Forced to classic for 0x3C / 0x3D */
+    uint8_t         length;         /**< Response length (1..LIN_MAX_DATA_LENGTH) */
+    uint8_t        *data;           /**< Response buffer (length bytes) */
+} lin_frame_t;
+
+/**
+ * @brief Master schedule table entry
+ */
+typedef struct {
+    uint8_t         id;             /**< Frame identifier of the header */
+    uint16_t        slotTicks;      /**< Slot length in LIN_MasterTick() calls (>= 1) */
+} lin_schedule_entry_t;
+
+/**
+ * @brief Frame event callback (called from the LPUART interrupt)
+ *
+ * @param[in] base      LPUART instance
+ * @param[in] id        Frame identifier
+ * @param[in] event     Frame event
+ * @param[in] userData  User data from the configuration
+ */
+typedef void (*lin_callback_t)(LPUART_RegType *base, uint8_t id, lin_event_t event, void *userData);
+
+/**
+ * @brief LIN node configuration
+ */
+typedef struct {
+    lin_node_t          node;       /**< Master or slave */
+    uint32_t            baudRate;   /**< Bit rate (19200, 10417, 9600, ...) */
+    const lin_frame_t  *frames;     /**< Frames published / subscribed by this node */
+    uint8_t             frameCount; /**< Number of entries in frames[] */
+    lin_callback_t      callback;   /**< Frame event callback, NULL = none */
+    void               *userData;   /**< Passed to the callback */
+} lin_config_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/**
+ * @brief Initialise an LPUART instance as a LIN node
+ * @details Configures the LPUART (8N1, no FIFO) through UART_Init(), then
+ *          enables 13-bit break generation, break detection and the RX /
+ *          break / error interrupts. The NVIC line is not enabled here.
+ *
+ * @param[in] base      LPUART instance
+ * @param[in] config    Node configuration (frames[] must stay valid)
+ * @param[in] srcClock  LPUART clock in Hz, 0 = read from PCC / SCG
+ *
+ * @return STATUS_SUCCESS, STATUS_ERROR on invalid parameters
+ */
+status_t LIN_Init(LPUART_RegType *base, const lin_config_t *config, uint32_t srcClock);
+
+/**
+ * @brief Stop the node and disable its interrupts
+ *
+ * @param[in] base  LPUART instance
+ *
+ * @return STATUS_SUCCESS, STATUS_ERROR if the instance is not a LIN node
+ */
+status_t LIN_Deinit(LPUART_RegType *base);
+
+/**
+ * @brief Install LIN_IRQHandler() for the instance in the RAM vector table
+ *
+ * @param[in] base  LPUART instance
+ *
+ * @return STATUS_SUCCESS, STATUS_ERROR if the vector cannot be installed
+ */
+status_t LIN_InstallIrqHandler(LPUART_RegType *base);
+
+/**
+ * @brief Select the master schedule table
+ * @details The first entry starts on the next LIN_MasterTick(). NULL / 0
+ *          stops the schedule after the running frame.
+ *
+ * @param[in] base   LPUART instance (master node)
+ * @param[in] table  Schedule entries (must stay valid)
+ * @param[in] count  Number of entries
+ *
+ * @return STATUS_SUCCESS, STATUS_ERROR if not a master or an entry is invalid
+ */
+status_t LIN_MasterSetSchedule(LPUART_RegType *base, const lin_schedule_entry_t *table, uint8_t count);
+
+/**
+ * @brief Schedule time base
+ * @details Call periodically (typically every 1 ms or 5 ms, e.g. from an
+ *          LPIT callback). At the start of each slot it reports a missing
+ *          response of the previous frame and sends the next header.
+ *
+ * @param[in] base  LPUART instance (master node)
+ */
+void LIN_MasterTick(LPUART_RegType *base);
+
+/**
+ * @brief Send one header now, outside the schedule (sporadic / diagnostic)
+ *
+ * @param[in] base  LPUART instance (master node)
+ * @param[in] id    Frame identifier
+ *
+ * @return STATUS_SUCCESS, STATUS_BUSY if a frame is in progress
+ */
+status_t LIN_MasterSendHeader(LPUART_RegType *base, uint8_t id);
+
+/**
+ * @brief Check if a header / response is in progress
+ *
+ * @param[in] base  LPUART instance
+ *
+ * @return true between break and end of response
+ */
+bool LIN_IsBusy(LPUART_RegType *base);
+
+/**
+ * @brief LPUART interrupt handler of a LIN node
+ *
+ * @param[in] base  LPUART instance
+ */
+void LIN_IRQHandler(LPUART_RegType *base);
+
+/**
+ * @brief Protected identifier of a frame identifier
+ *
+ * @param[in] id  Frame identifier (0..LIN_MAX_ID)
+ *
+ * @return id | P0 << 6 | P1 << 7
+ */
+uint8_t LIN_CalcPid(uint8_t id);
+
+/**
+ * @brief Response checksum
+ * @details Inverted 8-bit sum with carry. Classic sums the data only,
+ *          enhanced also sums the PID (diagnostic frames always classic).
+ *
+ * @param[in] pid       Protected identifier
+ * @param[in] data      Response data
+ * @param[in] length    Number of data bytes
+ * @param[in] checksum  Checksum model
+ *
+ * @return Checksum byte
+ */
+uint8_t LIN_CalcChecksum(uint8_t pid, const uint8_t *data, uint8_t length, lin_checksum_t checksum);
+
+#endif /* LIN_H */
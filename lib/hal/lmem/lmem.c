@@ -0,0 +1,150 @@
+/**
+ * @file    lmem.c
+ * @brief   LMEM code cache driver implementation for S32K144
+ * @details Whole-cache commands go through PCCCR[GO], single lines through
+ *          PCCLCR / PCCSAR with physical addresses.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ *
+ * @par Change Log:
+ * - Version 1.0 (Oct 14, 2026): Initial version
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "lmem.h"
+#include "lmem_reg.h"
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Run a whole-cache command and wait for PCCCR[GO] to clear
+ * @param[in] commandMask INVWn / PUSHWn bits
+ */
+static void LMEM_RunCacheCommand(uint32_t commandMask)
+{
+    uint32_t pcccr = LMEM->PCCCR & LMEM_PCCCR_ENCACHE_MASK;
+
+    LMEM->PCCCR = pcccr | commandMask | LMEM_PCCCR_GO_MASK;
+
+    /* GO self-clears when both ways are done (a few hundred cycles) */
+    while ((LMEM->PCCCR & LMEM_PCCCR_GO_MASK) != 0U) {
+    }
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+/**
+ * @brief Enable code cache
+ */
+void LMEM_EnableCodeCache(void)
+{
+    /* Invalidate first: lines are undefined after reset */
+    LMEM_RunCacheCommand(LMEM_PCCCR_INVW0_MASK | LMEM_PCCCR_INVW1_MASK);
+    LMEM->PCCCR |= LMEM_PCCCR_ENCACHE_MASK;
+}
+
+/**
+ * @brief Disable code cache
+ */
+void LMEM_DisableCodeCache(void)
+{
+    LMEM->PCCCR &= ~LMEM_PCCCR_ENCACHE_MASK;
+    LMEM_RunCacheCommand(LMEM_PCCCR_INVW0_MASK | LMEM_PCCCR_INVW1_MASK);
+}
+
+/**
+ * @brief Check code cache state
+ */
+bool LMEM_IsCodeCacheEnabled(void)
+{
+    return ((LMEM->PCCCR & LMEM_PCCCR_ENCACHE_MASK) != 0U);
+}
+
+/**
+ * @brief Invalidate code cache
+ */
+void LMEM_InvalidateCodeCache(void)
+{
+    LMEM_RunCacheCommand(LMEM_PCCCR_INVW0_MASK | LMEM_PCCCR_INVW1_MASK);
+}
+
+/**
+ * @brief Push and invalidate code cache
+ */
+void LMEM_FlushCodeCache(void)
+{
+    LMEM_RunCacheCommand(LMEM_PCCCR_PUSHW0_MASK | LMEM_PCCCR_PUSHW1_MASK |
+                         LMEM_PCCCR_INVW0_MASK | LMEM_PCCCR_INVW1_MASK);
+}
+
+/**
+ * @brief Invalidate code cache lines of a range
+ */
+void LMEM_InvalidateCodeCacheLines(uint32_t address, uint32_t size)
+{
+    uint32_t line;
+    uint32_t end;
+
+    if (size == 0U) {
+        return;
+    }
+
+    /* Above one cache size the global command is cheaper than per-line commands */
+    if (size >= LMEM_CACHE_SIZE) {
+        LMEM_InvalidateCodeCache();
+        return;
+    }
+
+    line = address & ~(LMEM_CACHE_LINE_SIZE - 1U);
+    end = address + size;
+
+    /* Same line command for every line, only the address changes */
+    LMEM->PCCLCR = LMEM_PCCLCR_LADSEL_MASK | LMEM_PCCLCR_LCMD(LMEM_LCMD_INVALIDATE);
+
+    /* Overflow check: ranges ending at 0xFFFFFFFF wrap end to 0 */
+    while ((line < end) || (end < address)) {
+        LMEM->PCCSAR = (line & LMEM_PCCSAR_PHYADDR_MASK) | LMEM_PCCSAR_LGO_MASK;
+        while ((LMEM->PCCSAR & LMEM_PCCSAR_LGO_MASK) != 0U) {
+        }
+
+        line += LMEM_CACHE_LINE_SIZE;
+        if (line == 0U) {
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Prepare cache for flash operation
+ */
+bool LMEM_FlashOperationBegin(void)
+{
+    bool wasEnabled = LMEM_IsCodeCacheEnabled();
+
+    if (wasEnabled) {
+        LMEM->PCCCR &= ~LMEM_PCCCR_ENCACHE_MASK;
+    }
+
+    return wasEnabled;
+}
+
+/**
+ * @brief Restore cache after flash operation
+ */
+void LMEM_FlashOperationEnd(bool wasEnabled)
+{
+    /* Lines filled before the operation hold the old flash contents */
+    LMEM_RunCacheCommand(LMEM_PCCCR_INVW0_MASK | LMEM_PCCCR_INVW1_MASK);
+
+    if (wasEnabled) {
+        LMEM->PCCCR |= LMEM_PCCCR_ENCACHE_MASK;
+    }
+}
@@ -0,0 +1,110 @@
+/**
+ * @file    lmem.h
+ * @brief   LMEM code cache driver for S32K144
+ * @details
+ * LMEM driver provides the following APIs for the 4 KB, 2-way processor
+ * code bus cache in front of program flash:
+ * - Enable / disable (with full invalidation)
+ * - Invalidate / flush the whole cache
+ * - Invalidate an address range line by line
+ * - Begin / end hooks around flash program and erase operations
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ *
+ * @note
+ * - SystemInit() enables the cache when ICACHE_ENABLE is 1 (default)
+ * - The code cache is read-only for flash, so a flush equals an invalidate;
+ *   it is still issued as push + invalidate to match the hardware commands
+ * - After programming or erasing flash, stale lines must be invalidated
+ *   before the new contents are executed or read through the code bus
+ *
+ * @par Change Log:
+ * - Version 1.0 (14/10/2026): Initial LMEM code cache driver
+ */
+
+#ifndef LMEM_H
+#define LMEM_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "lmem_reg.h"
+
+/*******************************************************************************
+ * API Function Prototypes
+ ******************************************************************************/
+
+/**
+ * @defgroup LMEM_Functions LMEM Functions
+ * @{
+ */
+
+/**
+ * @brief Invalidate both ways and enable the code cache
+ */
+void LMEM_EnableCodeCache(void);
+
+/**
+ * @brief Disable the code cache and invalidate its contents
+ */
+void LMEM_DisableCodeCache(void);
+
+/**
+ * @brief Check whether the code cache is enabled
+ * @return bool true if PCCCR[ENCACHE] is set
+ */
+bool LMEM_IsCodeCacheEnabled(void);
+
+/**
+ * @brief Invalidate the whole code cache
+ */
+void LMEM_InvalidateCodeCache(void);
+
+/**
+ * @brief Push and invalidate the whole code cache
+ */
+void LMEM_FlushCodeCache(void);
+
+/**
+ * @brief Invalidate the lines covering an address range
+ * @details Issues one physical-address line command per 16-byte line.
+ *          Ranges larger than the cache fall back to a full invalidation.
+ *
+ * @param[in] address Start address
+ * @param[in] size    Size in bytes (0 = nothing)
+ *
+ * @code
+ * // Sector 0x0003F000 rewritten with new calibration data
+ * LMEM_InvalidateCodeCacheLines(0x0003F000UL, 4096U);
+ * @endcode
+ */
+void LMEM_InvalidateCodeCacheLines(uint32_t address, uint32_t size);
+
+/**
+ * @brief Prepare the cache for a flash program / erase operation
+ * @details Disables the cache so no line is filled from flash while the
+ *          array is being modified.
+ * @return bool Cache state to pass to LMEM_FlashOperationEnd()
+ */
+bool LMEM_FlashOperationBegin(void);
+
+/**
+ * @brief Restore the cache after a flash program / erase operation
+ * @details Invalidates both ways, then re-enables the cache if it was enabled.
+ * @param[in] wasEnabled Value returned by LMEM_FlashOperationBegin()
+ *
+ * @code
+ * bool cache = LMEM_FlashOperationBegin();
+ * // ... FTFC program / erase command ...
+ * LMEM_FlashOperationEnd(cache);
+ * @endcode
+ */
+void LMEM_FlashOperationEnd(bool wasEnabled);
+
+/** @} */ /* End of LMEM_Functions */
+
+#endif /* LMEM_H */
@@ -0,0 +1,85 @@
+/**
+ * @file    lmem_reg.h
+ * @brief   LMEM Register Definitions for S32K144
+ * @details This file contains low-level Local Memory Controller register
+ *          definitions for the 4 KB processor code bus cache.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ *
+ * @note    These are raw register definitions for LMEM peripheral
+ * @warning Direct register access - use with caution
+ *
+ * @par Change Log:
+ * - Version 1.0 (Oct 14, 2026): Initial version
+ *
+ */
+
+#ifndef LMEM_REG_H
+#define LMEM_REG_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include "def_reg.h"
+
+/*******************************************************************************
+ * LMEM Register Structure
+ ******************************************************************************/
+
+/**
+ * @brief LMEM Register Layout
+ */
+typedef struct {
+    __IO uint32_t PCCCR;        /**< Cache Control Register, offset: 0x00 */
+    __IO uint32_t PCCLCR;       /**< Cache Line Control Register, offset: 0x04 */
+    __IO uint32_t PCCSAR;       /**< Cache Search Address Register, offset: 0x08 */
+    __IO uint32_t PCCCVR;       /**< Cache Read/Write Value Register, offset: 0x0C */
+    uint8_t RESERVED_0[16];
+    __IO uint32_t PCCRMR;       /**< Cache Regions Mode Register, offset: 0x20 */
+} LMEM_RegType;
+
+/** @brief LMEM base address (private peripheral bus) */
+#define LMEM_BASE_ADDR          (0xE0082000UL)
+
+/** @brief LMEM base pointer */
+#define LMEM                    ((LMEM_RegType *)LMEM_BASE_ADDR)
+
+/** @brief Cache geometry: 2 ways x 128 sets x 16-byte lines */
+#define LMEM_CACHE_LINE_SIZE    (16U)
+#define LMEM_CACHE_SIZE         (4096U)
+
+/*******************************************************************************
+ * PCCCR - Cache Control Register
+ ******************************************************************************/
+#define LMEM_PCCCR_ENCACHE_MASK     (0x00000001UL)
+#define LMEM_PCCCR_INVW0_MASK       (0x01000000UL)
+#define LMEM_PCCCR_PUSHW0_MASK      (0x02000000UL)
+#define LMEM_PCCCR_INVW1_MASK       (0x04000000UL)
+#define LMEM_PCCCR_PUSHW1_MASK      (0x08000000UL)
+#define LMEM_PCCCR_GO_MASK          (0x80000000UL)
+
+/*******************************************************************************
+ * PCCLCR - Cache Line Control Register
+ ******************************************************************************/
+#define LMEM_PCCLCR_LGO_MASK        (0x00000001UL)
+#define LMEM_PCCLCR_LCMD_MASK       (0x03000000UL)
+#define LMEM_PCCLCR_LCMD_SHIFT      (24U)
+#define LMEM_PCCLCR_LCMD(x)         (((uint32_t)(x) << LMEM_PCCLCR_LCMD_SHIFT) & LMEM_PCCLCR_LCMD_MASK)
+#define LMEM_PCCLCR_LADSEL_MASK     (0x04000000UL)
+
+/** @brief LCMD values */
+#define LMEM_LCMD_SEARCH            (0U)    /**< Search and read / write */
+#define LMEM_LCMD_INVALIDATE        (1U)    /**< Invalidate line */
+#define LMEM_LCMD_PUSH              (2U)    /**< Push line */
+#define LMEM_LCMD_CLEAR             (3U)    /**< Push and invalidate line */
+
+/*******************************************************************************
+ * PCCSAR - Cache Search Address Register
+ ******************************************************************************/
+#define LMEM_PCCSAR_LGO_MASK        (0x00000001UL)
+#define LMEM_PCCSAR_PHYADDR_MASK    (0xFFFFFFFCUL)
+
+#endif /* LMEM_REG_H */
@@ -29,6 +29,7 @@
  * Includes
  ******************************************************************************/
 #include "lpit.h"
+#include "nvic.h"
 #include <stddef.h>
 
 /*******************************************************************************
@@ -420,13 +421,11 @@ status_t LPIT_InstallCallback(uint8_t channel, lpit_callback_t callback, void *u
 }
 
 /**
- * @brief Handle LPIT interrupt (called from ISR)
+ * @brief Service one channel interrupt (channel already validated)
  */
-void LPIT_IRQHandler(uint8_t channel)
+static inline void LPIT_ServiceChannel(uint8_t channel)
 {
-    if (!LPIT_IsValidChannel(channel)) {
-        return;
-    }
+    NVIC_TRACE_ISR_ENTRY((IRQn_Type)((uint32_t)LPIT0_Ch0_IRQn + channel));
     
     /* Clear interrupt flag */
     LPIT_ClearInterruptFlag(channel);
@@ -437,6 +436,45 @@ void LPIT_IRQHandler(uint8_t channel)
     }
 }
 
+/**
+ * @brief Handle LPIT interrupt (called from ISR)
+ */
+void LPIT_IRQHandler(uint8_t channel)
+{
+    if (!LPIT_IsValidChannel(channel)) {
+        return;
+    }
+    
+    LPIT_ServiceChannel(channel);
+}
+
+/* Per-channel vectors: channel is a constant, LPIT_ServiceChannel() is inlined */
+static void LPIT_Ch0Vector(void) { LPIT_ServiceChannel(0U); }
+static void LPIT_Ch1Vector(void) { LPIT_ServiceChannel(1U); }
+static void LPIT_Ch2Vector(void) { LPIT_ServiceChannel(2U); }
+static void LPIT_Ch3Vector(void) { LPIT_ServiceChannel(3U); }
+
+static const nvic_handler_t s_lpitVectors[LPIT_MAX_CHANNELS] = {
+    LPIT_Ch0Vector, LPIT_Ch1Vector, LPIT_Ch2Vector, LPIT_Ch3Vector
+};
+
+/**
+ * @brief Install the channel handler in the RAM vector table
+ */
+status_t LPIT_InstallIrqHandler(uint8_t channel)
+{
+    if (!LPIT_IsValidChannel(channel)) {
+        return STATUS_ERROR;
+    }
+    
+    if (NVIC_InstallHandler((IRQn_Type)((uint32_t)LPIT0_Ch0_IRQn + channel),
+                            s_lpitVectors[channel]) != NVIC_STATUS_SUCCESS) {
+        return STATUS_ERROR;
+    }
+    
+    return STATUS_SUCCESS;
+}
+
 /**
  * @brief Táº¡o delay báº±ng LPIT (blocking)
  */
@@ -519,3 +557,43 @@ uint32_t LPIT_CalculatePeriod(uint32_t clockFreq, uint32_t desiredFreq)
     
     return period;
 }
+
+/**
+ * @brief Get LPIT functional clock frequency
+ */
+uint32_t LPIT_GetClockFreq(void)
+{
+    return s_lpitClockFreq;
+}
+
+/**
+ * @brief Get channel reload value (TVAL)
+ */
+status_t LPIT_GetPeriod(uint8_t channel, uint32_t *period)
+{
+    if (!LPIT_IsValidChannel(channel) || (period == NULL)) {
+        return STATUS_ERROR;
+    }
+    
+    *period = LPIT0->CHANNEL[channel].TVAL;
+    
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Keep LPIT counting in STOP / VLPS
+ */
+status_t LPIT_SetDozeEnable(bool enable)
+{
+    if (!s_lpitInitialized) {
+        return STATUS_ERROR;
+    }
+    
+    if (enable) {
+        LPIT0->MCR |= LPIT_MCR_DOZE_EN_MASK;
+    } else {
+        LPIT0->MCR &= ~LPIT_MCR_DOZE_EN_MASK;
+    }
+    
+    return STATUS_SUCCESS;
+}
@@ -18,7 +18,7 @@
  *
  * @author  PhucPH32
  * @date    28/11/2025
- * @version 1.0
+ * @version 1.1
  *
  * @note
  * - The LPIT clock must be configured before use
@@ -31,6 +31,7 @@
  *
  * @par Change Log:
  * - Version 1.0 (28/11/2025): Initial LPIT driver
+ * - Version 1.1 (14/10/2026): LPIT_InstallIrqHandler() for the RAM vector table
  */
 
 #ifndef LPIT_H
@@ -342,6 +343,25 @@ status_t LPIT_InstallCallback(uint8_t channel, lpit_callback_t callback, void *u
  */
 void LPIT_IRQHandler(uint8_t channel);
 
+/**
+ * @brief Install the channel ISR directly in the RAM vector table
+ * @details The LPIT0_ChN vector then enters the driver with the channel
+ *          number baked in, without an application LPIT0_ChN_IRQHandler
+ *          wrapper around LPIT_IRQHandler().
+ * 
+ * @param[in] channel LPIT channel number (0-3)
+ * 
+ * @return STATUS_SUCCESS if installed (NVIC enable is left to the caller)
+ * @return STATUS_ERROR if channel invalid or no RAM vector table
+ * 
+ * @code
+ * LPIT_InstallCallback(0, myTimerCallback, NULL);
+ * LPIT_InstallIrqHandler(0);
+ * NVIC_EnableIRQ(LPIT0_Ch0_IRQn);
+ * @endcode
+ */
+status_t LPIT_InstallIrqHandler(uint8_t channel);
+
 /**
  * @brief Create delay using LPIT (blocking)
  * @details
@@ -358,6 +378,8 @@ void LPIT_IRQHandler(uint8_t channel);
  * - This function is blocking
  * - Should not be used in interrupt context
  * - Clock source must be known for accurate calculation
+ * - Reconfigures the channel on every call; for short delays that must not
+ *   touch timer channels use ClockManager_DelayUs()
  * 
  * @code
  * // Delay 1000us (1ms)
@@ -386,6 +408,37 @@ status_t LPIT_DelayUs(uint8_t channel, uint32_t delayUs);
  */
 uint32_t LPIT_CalculatePeriod(uint32_t clockFreq, uint32_t desiredFreq);
 
+/**
+ * @brief Get LPIT functional clock frequency
+ * @details Frequency of the clock source selected in LPIT_Init(), used to
+ *          convert time to timer ticks. Independent of the core clock.
+ * 
+ * @return Clock frequency in Hz
+ */
+uint32_t LPIT_GetClockFreq(void);
+
+/**
+ * @brief Get channel reload value (TVAL)
+ * @details Counter runs TVAL..0, so (TVAL - CVAL) is the number of counts
+ *          since the last expiry / trigger of a periodic channel.
+ * 
+ * @param[in] channel Channel number (0-3)
+ * @param[out] period Reload value
+ * @return STATUS_SUCCESS or STATUS_ERROR
+ */
+status_t LPIT_GetPeriod(uint8_t channel, uint32_t *period);
+
+/**
+ * @brief Keep LPIT counting in STOP / VLPS (MCR[DOZE_EN])
+ * @details LPIT_Init() leaves timers stopped in low-power modes. Enable
+ *          when an LPIT channel must wake the core from VLPS; the selected
+ *          clock source must also stay on in stop (e.g. SIRC with SIRCSTEN).
+ * 
+ * @param[in] enable true = timers run in doze/stop modes
+ * @return STATUS_SUCCESS or STATUS_ERROR if LPIT not initialized
+ */
+status_t LPIT_SetDozeEnable(bool enable);
+
 /** @} */ /* End of LPIT_Functions */
 
 #endif /* LPIT_H */
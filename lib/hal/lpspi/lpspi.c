@@ -0,0 +1,536 @@
+/**
+ * @file    lpspi.c
+ * @brief   LPSPI Driver Implementation for S32K144
+ * @details Implementation of master init, TCR-based per-transfer setup,
+ *          FIFO-driven blocking transfers and eDMA full-duplex transfers.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "lpspi.h"
+#include "pcc.h"
+#include "dma.h"
+#include "nvic.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Largest TCR[PRESCALE] value (divide by 128) */
+#define LPSPI_MAX_PRESCALE      (7U)
+
+/** @brief Largest CCR[SCKDIV] value */
+#define LPSPI_MAX_SCKDIV        (255U)
+
+/** @brief Frame size limits supported by the driver (one FIFO word per frame) */
+#define LPSPI_MIN_FRAME_SIZE    (8U)
+#define LPSPI_MAX_FRAME_SIZE    (32U)
+
+/** @brief W1C status flags */
+#define LPSPI_SR_CLEAR_MASK     (LPSPI_SR_WCF_MASK | LPSPI_SR_FCF_MASK | LPSPI_SR_TCF_MASK | \
+                                 LPSPI_SR_TEF_MASK | LPSPI_SR_REF_MASK | LPSPI_SR_DMF_MASK)
+
+/*******************************************************************************
+ * Private Types
+ ******************************************************************************/
+
+/**
+ * @brief Per-instance driver state
+ */
+typedef struct {
+    bool initialized;                   /**< LPSPI_MasterInit() done */
+    volatile bool busy;                 /**< DMA transfer in progress */
+    uint8_t instance;                   /**< Instance number (DMA callback context) */
+    uint8_t prescale;                   /**< TCR[PRESCALE] chosen at init */
+    uint32_t baudRate;                  /**< Actual SCK in Hz */
+    uint32_t tcr;                       /**< TCR of the current DMA transfer */
+    uint8_t txChannel;                  /**< DMA TX channel */
+    uint8_t rxChannel;                  /**< DMA RX channel */
+    lpspi_callback_t callback;
+    void *userData;
+} lpspi_state_t;
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+
+/** @brief LPSPI base addresses */
+static LPSPI_Type * const s_lpspiBases[LPSPI_INSTANCE_COUNT] = LPSPI_BASE_PTRS;
+
+/** @brief PCC index per instance */
+static const uint8_t s_lpspiPccIndex[LPSPI_INSTANCE_COUNT] = {
+    PCC_LPSPI0_INDEX, PCC_LPSPI1_INDEX, PCC_LPSPI2_INDEX
+};
+
+/** @brief DMAMUX sources per instance */
+static const dmamux_source_t s_lpspiTxSource[LPSPI_INSTANCE_COUNT] = {
+    DMAMUX_SRC_LPSPI0_TX, DMAMUX_SRC_LPSPI1_TX, DMAMUX_SRC_LPSPI2_TX
+};
+
+static const dmamux_source_t s_lpspiRxSource[LPSPI_INSTANCE_COUNT] = {
+    DMAMUX_SRC_LPSPI0_RX, DMAMUX_SRC_LPSPI1_RX, DMAMUX_SRC_LPSPI2_RX
+};
+
+/** @brief Driver state */
+static lpspi_state_t s_lpspiState[LPSPI_INSTANCE_COUNT];
+
+/** @brief Dummy words for NULL TX / RX buffers */
+static const uint32_t s_dummyTx = 0U;
+static volatile uint32_t s_dummyRx;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static inline bool LPSPI_IsValidInstance(uint8_t instance)
+{
+    return (instance < LPSPI_INSTANCE_COUNT);
+}
+
+/* 8 bits -> 1 byte, 9-16 -> 2, 17-32 -> 4 */
+static inline uint32_t LPSPI_FrameBytes(uint16_t frameSize)
+{
+    if (frameSize <= 8U) {
+        return 1U;
+    }
+
+    return (frameSize <= 16U) ? 2U : 4U;
+}
+
+static bool LPSPI_IsValidTransfer(const lpspi_transfer_config_t *config)
+{
+    return (config != NULL) &&
+           (config->frameSize >= LPSPI_MIN_FRAME_SIZE) &&
+           (config->frameSize <= LPSPI_MAX_FRAME_SIZE) &&
+           ((uint32_t)config->pcs <= (uint32_t)LPSPI_PCS3);
+}
+
+static uint32_t LPSPI_BuildTcr(const lpspi_state_t *state, const lpspi_transfer_config_t *config)
+{
+    uint32_t tcr = LPSPI_TCR_PRESCALE(state->prescale) |
+                   LPSPI_TCR_PCS(config->pcs) |
+                   LPSPI_TCR_FRAMESZ((uint32_t)config->frameSize - 1U);
+
+    if (config->cpol) {
+        tcr |= LPSPI_TCR_CPOL_MASK;
+    }
+    if (config->cpha) {
+        tcr |= LPSPI_TCR_CPHA_MASK;
+    }
+    if (config->lsbFirst) {
+        tcr |= LPSPI_TCR_LSBF_MASK;
+    }
+    if (config->continuousCs) {
+        tcr |= LPSPI_TCR_CONT_MASK;
+    }
+
+    return tcr;
+}
+
+/* Smallest divider (fastest SCK) not exceeding the requested baud rate */
+static bool LPSPI_CalcDivider(uint32_t srcFreq, uint32_t baudRate,
+                              uint8_t *prescale, uint8_t *sckdiv, uint32_t *actual)
+{
+    uint32_t total = (srcFreq + baudRate - 1U) / baudRate;
+    uint32_t p;
+    uint32_t divisor;
+
+    for (p = 0U; p <= LPSPI_MAX_PRESCALE; p++) {
+        /* SCK = srcFreq / (2^p * (SCKDIV + 2)), rounded up so that SCK <= baudRate */
+        divisor = (total + (1UL << p) - 1U) >> p;
+        if (divisor < 2U) {
+            divisor = 2U;
+        }
+
+        if ((divisor - 2U) <= LPSPI_MAX_SCKDIV) {
+            *prescale = (uint8_t)p;
+            *sckdiv = (uint8_t)(divisor - 2U);
+            *actual = (srcFreq >> p) / divisor;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static inline void LPSPI_WriteFrame(LPSPI_Type *base, const void *buffer,
+                                    uint32_t index, uint32_t bytes)
+{
+    uint32_t data = 0U;
+
+    if (buffer != NULL) {
+        if (bytes == 1U) {
+            data = ((const uint8_t *)buffer)[index];
+        } else if (bytes == 2U) {
+            data = ((const uint16_t *)buffer)[index];
+        } else {
+            data = ((const uint32_t *)buffer)[index];
+        }
+    }
+
+    base->TDR = data;
+}
+
+static inline void LPSPI_ReadFrame(LPSPI_Type *base, void *buffer,
+                                   uint32_t index, uint32_t bytes)
+{
+    uint32_t data = base->RDR;
+
+    if (buffer == NULL) {
+        return;
+    }
+
+    if (bytes == 1U) {
+        ((uint8_t *)buffer)[index] = (uint8_t)data;
+    } else if (bytes == 2U) {
+        ((uint16_t *)buffer)[index] = (uint16_t)data;
+    } else {
+        ((uint32_t *)buffer)[index] = data;
+    }
+}
+
+/* Flush the FIFOs and clear the error flags before each transfer */
+static inline void LPSPI_ResetFifos(LPSPI_Type *base)
+{
+    base->CR |= LPSPI_CR_RTF_MASK | LPSPI_CR_RRF_MASK;
+    base->SR = LPSPI_SR_CLEAR_MASK;
+}
+
+static inline uint32_t LPSPI_TxCount(const LPSPI_Type *base)
+{
+    return (base->FSR & LPSPI_FSR_TXCOUNT_MASK) >> LPSPI_FSR_TXCOUNT_SHIFT;
+}
+
+static inline uint32_t LPSPI_RxCount(const LPSPI_Type *base)
+{
+    return (base->FSR & LPSPI_FSR_RXCOUNT_MASK) >> LPSPI_FSR_RXCOUNT_SHIFT;
+}
+
+/* RX major loop done: every frame received, TX is done too */
+static void LPSPI_DmaRxComplete(uint8_t channel, void *userData)
+{
+    lpspi_state_t *state = (lpspi_state_t *)userData;
+    LPSPI_Type *base = s_lpspiBases[state->instance];
+
+    (void)channel;
+
+    base->DER = 0U;
+
+    /* Command word with CONT = 0 to negate CS */
+    if ((state->tcr & LPSPI_TCR_CONT_MASK) != 0U) {
+        base->TCR = state->tcr & ~LPSPI_TCR_CONT_MASK;
+    }
+
+    state->busy = false;
+
+    if (state->callback != NULL) {
+        state->callback(state->instance, state->userData);
+    }
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+status_t LPSPI_MasterInit(uint8_t instance, const lpspi_master_config_t *config)
+{
+    LPSPI_Type *base;
+    lpspi_state_t *state;
+    uint32_t srcFreq;
+    uint32_t actual;
+    uint8_t prescale;
+    uint8_t sckdiv;
+    uint32_t cfgr1;
+
+    if (!LPSPI_IsValidInstance(instance) || (config == NULL) || (config->baudRate == 0U)) {
+        return STATUS_ERROR;
+    }
+
+    base = s_lpspiBases[instance];
+    state = &s_lpspiState[instance];
+
+    if (state->busy) {
+        return STATUS_BUSY;
+    }
+
+    PCC->PCCn[s_lpspiPccIndex[instance]] |= PCC_PCCn_CGC_MASK;
+
+    srcFreq = PCC_GetLpspiClockFreq(instance);
+    if ((srcFreq == 0U) || !LPSPI_CalcDivider(srcFreq, config->baudRate, &prescale, &sckdiv, &actual)) {
+        return STATUS_ERROR;
+    }
+
+    /* Software reset: every register back to default, FIFOs empty */
+    base->CR = LPSPI_CR_RST_MASK;
+    base->CR = 0U;
+
+    /* NOSTALL = 0: the master stalls on a full RX FIFO instead of overrunning */
+    cfgr1 = LPSPI_CFGR1_MASTER_MASK | LPSPI_CFGR1_PCSPOL(config->pcsActiveHighMask);
+    if (config->delayedSample) {
+        cfgr1 |= LPSPI_CFGR1_SAMPLE_MASK;
+    }
+    base->CFGR1 = cfgr1;
+
+    base->CCR = LPSPI_CCR_SCKDIV(sckdiv) |
+                LPSPI_CCR_DBT(config->betweenTransferDelay) |
+                LPSPI_CCR_PCSSCK(config->pcsToSckDelay) |
+                LPSPI_CCR_SCKPCS(config->sckToPcsDelay);
+
+    /* TX request while there is room, RX request with >= 1 word */
+    base->FCR = LPSPI_FCR_TXWATER(LPSPI_FIFO_SIZE - 1U) | LPSPI_FCR_RXWATER(0U);
+
+    base->IER = 0U;
+    base->DER = 0U;
+    base->CR = LPSPI_CR_MEN_MASK | LPSPI_CR_DBGEN_MASK;
+
+    state->instance = instance;
+    state->prescale = prescale;
+    state->baudRate = actual;
+    state->callback = NULL;
+    state->userData = NULL;
+    state->initialized = true;
+
+    return STATUS_SUCCESS;
+}
+
+status_t LPSPI_Deinit(uint8_t instance)
+{
+    lpspi_state_t *state;
+
+    if (!LPSPI_IsValidInstance(instance)) {
+        return STATUS_ERROR;
+    }
+
+    state = &s_lpspiState[instance];
+    if (state->busy) {
+        return STATUS_BUSY;
+    }
+
+    if (state->initialized) {
+        s_lpspiBases[instance]->CR = 0U;
+    }
+
+    PCC->PCCn[s_lpspiPccIndex[instance]] &= ~PCC_PCCn_CGC_MASK;
+
+    state->initialized = false;
+    state->baudRate = 0U;
+
+    return STATUS_SUCCESS;
+}
+
+uint32_t LPSPI_GetBaudRate(uint8_t instance)
+{
+    if (!LPSPI_IsValidInstance(instance)) {
+        return 0U;
+    }
+
+    return s_lpspiState[instance].baudRate;
+}
+
+status_t LPSPI_TransferBlocking(uint8_t instance, const lpspi_transfer_config_t *config,
+                                const void *txBuffer, void *rxBuffer, uint32_t frames)
+{
+    LPSPI_Type *base;
+    lpspi_state_t *state;
+    uint32_t bytes;
+    uint32_t tcr;
+    uint32_t txIndex = 0U;
+    uint32_t rxIndex = 0U;
+    uint32_t timeout = LPSPI_TIMEOUT_COUNT;
+    bool progress;
+
+    if (!LPSPI_IsValidInstance(instance) || !LPSPI_IsValidTransfer(config) || (frames == 0U)) {
+        return STATUS_ERROR;
+    }
+
+    base = s_lpspiBases[instance];
+    state = &s_lpspiState[instance];
+
+    if (!state->initialized) {
+        return STATUS_ERROR;
+    }
+    if (state->busy) {
+        return STATUS_BUSY;
+    }
+
+    bytes = LPSPI_FrameBytes(config->frameSize);
+    tcr = LPSPI_BuildTcr(state, config);
+
+    LPSPI_ResetFifos(base);
+
+    /* A TCR write takes 1 TX FIFO slot, the frames follow */
+    base->TCR = tcr;
+
+    while (rxIndex < frames) {
+        progress = false;
+
+        /* At most LPSPI_FIFO_SIZE frames in flight: the RX FIFO never overflows */
+        while ((txIndex < frames) && ((txIndex - rxIndex) < LPSPI_FIFO_SIZE) &&
+               (LPSPI_TxCount(base) < LPSPI_FIFO_SIZE)) {
+            LPSPI_WriteFrame(base, txBuffer, txIndex, bytes);
+            txIndex++;
+            progress = true;
+        }
+
+        while ((rxIndex < txIndex) && (LPSPI_RxCount(base) != 0U)) {
+            LPSPI_ReadFrame(base, rxBuffer, rxIndex, bytes);
+            rxIndex++;
+            progress = true;
+        }
+
+        if (progress) {
+            timeout = LPSPI_TIMEOUT_COUNT;
+        } else if (--timeout == 0U) {
+            LPSPI_ResetFifos(base);
+            base->TCR = tcr & ~LPSPI_TCR_CONT_MASK;
+            return STATUS_TIMEOUT;
+        }
+    }
+
+    if (config->continuousCs) {
+        base->TCR = tcr & ~LPSPI_TCR_CONT_MASK;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+status_t LPSPI_TransferDma(uint8_t instance, const lpspi_transfer_config_t *config,
+                           const void *txBuffer, void *rxBuffer, uint16_t frames,
+                           const lpspi_dma_config_t *dma)
+{
+    LPSPI_Type *base;
+    lpspi_state_t *state;
+    dma_channel_config_t txConfig;
+    dma_channel_config_t rxConfig;
+    dma_transfer_size_t size;
+    uint32_t bytes;
+    uint32_t primask;
+
+    if (!LPSPI_IsValidInstance(instance) || !LPSPI_IsValidTransfer(config) || (dma == NULL) ||
+        (frames == 0U) || (frames > LPSPI_DMA_MAX_FRAMES) || (dma->txChannel == dma->rxChannel)) {
+        return STATUS_ERROR;
+    }
+
+    base = s_lpspiBases[instance];
+    state = &s_lpspiState[instance];
+
+    if (!state->initialized) {
+        return STATUS_ERROR;
+    }
+
+    primask = NVIC_DisableGlobalIRQ();
+    if (state->busy) {
+        NVIC_EnableGlobalIRQ(primask);
+        return STATUS_BUSY;
+    }
+    state->busy = true;
+    NVIC_EnableGlobalIRQ(primask);
+
+    bytes = LPSPI_FrameBytes(config->frameSize);
+    size = (bytes == 1U) ? DMA_TRANSFER_SIZE_1B :
+           ((bytes == 2U) ? DMA_TRANSFER_SIZE_2B : DMA_TRANSFER_SIZE_4B);
+
+    state->tcr = LPSPI_BuildTcr(state, config);
+    state->txChannel = dma->txChannel;
+    state->rxChannel = dma->rxChannel;
+    state->callback = dma->callback;
+    state->userData = dma->userData;
+
+    /* NULL buffer: source / dest fixed on a dummy word */
+    txConfig.channel = dma->txChannel;
+    txConfig.source = s_lpspiTxSource[instance];
+    txConfig.transferType = DMA_TRANSFER_MEM_TO_PERIPH;
+    txConfig.transferSize = size;
+    txConfig.priority = DMA_PRIORITY_NORMAL;
+    txConfig.sourceAddr = (txBuffer != NULL) ? (uint32_t)txBuffer : (uint32_t)&s_dummyTx;
+    txConfig.sourceOffset = (txBuffer != NULL) ? (int16_t)bytes : 0;
+    txConfig.sourceLastAddrAdjust = 0;
+    txConfig.destAddr = (uint32_t)&base->TDR;
+    txConfig.destOffset = 0;
+    txConfig.destLastAddrAdjust = 0;
+    txConfig.minorLoopBytes = bytes;
+    txConfig.majorLoopCount = frames;
+    txConfig.enableInterrupt = false;
+    txConfig.disableRequestAfterDone = true;
+    txConfig.enablePeriodicTrigger = false;
+
+    /* RX has priority over TX: drain RDR before TX pushes another frame */
+    rxConfig.channel = dma->rxChannel;
+    rxConfig.source = s_lpspiRxSource[instance];
+    rxConfig.transferType = DMA_TRANSFER_PERIPH_TO_MEM;
+    rxConfig.transferSize = size;
+    rxConfig.priority = DMA_PRIORITY_HIGH;
+    rxConfig.sourceAddr = (uint32_t)&base->RDR;
+    rxConfig.sourceOffset = 0;
+    rxConfig.sourceLastAddrAdjust = 0;
+    rxConfig.destAddr = (rxBuffer != NULL) ? (uint32_t)rxBuffer : (uint32_t)&s_dummyRx;
+    rxConfig.destOffset = (rxBuffer != NULL) ? (int16_t)bytes : 0;
+    rxConfig.destLastAddrAdjust = 0;
+    rxConfig.minorLoopBytes = bytes;
+    rxConfig.majorLoopCount = frames;
+    rxConfig.enableInterrupt = true;
+    rxConfig.disableRequestAfterDone = true;
+    rxConfig.enablePeriodicTrigger = false;
+
+    if ((DMA_ConfigChannel(&txConfig) != STATUS_SUCCESS) ||
+        (DMA_ConfigChannel(&rxConfig) != STATUS_SUCCESS) ||
+        (DMA_InstallCallback(dma->rxChannel, LPSPI_DmaRxComplete, state) != STATUS_SUCCESS) ||
+        (DMA_StartChannel(dma->rxChannel) != STATUS_SUCCESS) ||
+        (DMA_StartChannel(dma->txChannel) != STATUS_SUCCESS)) {
+        (void)DMA_StopChannel(dma->txChannel);
+        (void)DMA_StopChannel(dma->rxChannel);
+        state->busy = false;
+        return STATUS_ERROR;
+    }
+
+    LPSPI_ResetFifos(base);
+
+    /* TCR goes into the FIFO before the TX DMA request is enabled */
+    base->TCR = state->tcr;
+    base->DER = LPSPI_DER_TDDE_MASK | LPSPI_DER_RDDE_MASK;
+
+    return STATUS_SUCCESS;
+}
+
+status_t LPSPI_AbortDma(uint8_t instance)
+{
+    LPSPI_Type *base;
+    lpspi_state_t *state;
+
+    if (!LPSPI_IsValidInstance(instance)) {
+        return STATUS_ERROR;
+    }
+
+    base = s_lpspiBases[instance];
+    state = &s_lpspiState[instance];
+
+    if (!state->busy) {
+        return STATUS_SUCCESS;
+    }
+
+    base->DER = 0U;
+    (void)DMA_StopChannel(state->txChannel);
+    (void)DMA_StopChannel(state->rxChannel);
+
+    LPSPI_ResetFifos(base);
+    base->TCR = state->tcr & ~LPSPI_TCR_CONT_MASK;
+
+    state->busy = false;
+
+    return STATUS_SUCCESS;
+}
+
+bool LPSPI_IsBusy(uint8_t instance)
+{
+    if (!LPSPI_IsValidInstance(instance)) {
+        return false;
+    }
+
+    return s_lpspiState[instance].busy;
+}
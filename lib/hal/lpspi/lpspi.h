@@ -0,0 +1,221 @@
+/**
+ * @file    lpspi.h
+ * @brief   LPSPI (Low Power SPI) master driver for S32K144
+ * @details
+ * LPSPI driver provides the following APIs:
+ * - Master initialization: SCK divider, CS delays, CS polarity, sample point
+ * - Per-transfer configuration through the Transmit Command Register:
+ *   CPOL / CPHA, frame size, bit order, chip select, continuous CS
+ * - Blocking full-duplex transfer that keeps the 4-word TX / RX FIFOs full
+ * - eDMA full-duplex transfer (TX and RX channels), completion callback
+ *   from the RX DMA interrupt
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ *
+ * @note
+ * - Select the LPSPI functional clock (PCC PCS) before LPSPI_MasterInit()
+ * - SCK = functional clock / (2^PRESCALE * (SCKDIV + 2)), max functional clock / 2
+ * - Frames of 8 bits use uint8_t buffers, 9-16 bits uint16_t, 17-32 bits uint32_t
+ *
+ * @par Change Log:
+ * - Version 1.0 (14/10/2026): Initial LPSPI master driver (FIFO, TCR, eDMA)
+ */
+
+#ifndef LPSPI_H
+#define LPSPI_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "lpspi_reg.h"
+#include "status.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @defgroup LPSPI_Definitions LPSPI Definitions
+ * @{
+ */
+
+/** @brief TX / RX FIFO depth (words) */
+#define LPSPI_FIFO_SIZE         (4U)
+
+/** @brief Maximum frames per DMA transfer (CITER without channel linking) */
+#define LPSPI_DMA_MAX_FRAMES    (0x7FFFU)
+
+/** @brief Blocking transfer timeout (in loop iterations without progress) */
+#define LPSPI_TIMEOUT_COUNT     (100000UL)
+
+/**
+ * @brief Chip select (TCR[PCS])
+ */
+typedef enum {
+    LPSPI_PCS0 = 0U,
+    LPSPI_PCS1 = 1U,
+    LPSPI_PCS2 = 2U,
+    LPSPI_PCS3 = 3U
+} lpspi_pcs_t;
+
+/**
+ * @brief Master configuration
+ */
+typedef struct {
+    uint32_t baudRate;                  /**< Maximum SCK frequency in Hz (actual <= requested) */
+    uint8_t pcsActiveHighMask;          /**< Bit n set: PCSn active high */
+    bool delayedSample;                 /**< Sample SIN on the delayed SCK edge (> 12 MHz) */
+    uint8_t pcsToSckDelay;              /**< CCR[PCSSCK]: CS assert to first SCK, prescaled clocks - 1 */
+    uint8_t sckToPcsDelay;              /**< CCR[SCKPCS]: last SCK to CS negate, prescaled clocks - 1 */
+    uint8_t betweenTransferDelay;       /**< CCR[DBT]: CS negate to next assert, prescaled clocks - 2 */
+} lpspi_master_config_t;
+
+/**
+ * @brief Per-transfer configuration (written to TCR before the data)
+ */
+typedef struct {
+    bool cpol;                          /**< SCK idle high */
+    bool cpha;                          /**< Sample on the second SCK edge */
+    bool lsbFirst;                      /**< LSB first */
+    lpspi_pcs_t pcs;                    /**< Chip select */
+    uint16_t frameSize;                 /**< Bits per frame (8-32) */
+    bool continuousCs;                  /**< Keep CS asserted between frames (TCR[CONT]) */
+} lpspi_transfer_config_t;
+
+/**
+ * @brief DMA transfer completion callback
+ * @param instance LPSPI instance
+ * @param userData Pointer to user data
+ */
+typedef void (*lpspi_callback_t)(uint8_t instance, void *userData);
+
+/**
+ * @brief eDMA channels of a full-duplex transfer
+ */
+typedef struct {
+    uint8_t txChannel;                  /**< eDMA channel for TDR writes */
+    uint8_t rxChannel;                  /**< eDMA channel for RDR reads (higher priority) */
+    lpspi_callback_t callback;          /**< Called once every frame has been received (NULL = none) */
+    void *userData;                     /**< Passed to callback */
+} lpspi_dma_config_t;
+
+/** @} */ /* End of LPSPI_Definitions */
+
+/*******************************************************************************
+ * API Function Prototypes
+ ******************************************************************************/
+
+/**
+ * @defgroup LPSPI_Functions LPSPI Functions
+ * @{
+ */
+
+/**
+ * @brief Initialize an LPSPI instance as master
+ * @details Enables the clock gate, resets the module, programs CFGR1 (master,
+ *          CS polarity, sample point, stall on FIFO empty / full), the SCK
+ *          divider and delays in CCR and the FIFO watermarks, then enables it.
+ *
+ * @param[in] instance LPSPI instance (0-2)
+ * @param[in] config   Master configuration
+ *
+ * @return STATUS_SUCCESS if successful
+ * @return STATUS_ERROR if parameters are invalid or the functional clock is off
+ *
+ * @code
+ * // 12 MHz SPI flash on LPSPI0 PCS0 (functional clock SPLLDIV2 = 40 MHz)
+ * lpspi_master_config_t spi = { 12000000U, 0U, true, 1U, 1U, 2U };
+ * LPSPI_MasterInit(0U, &spi);
+ * @endcode
+ */
+status_t LPSPI_MasterInit(uint8_t instance, const lpspi_master_config_t *config);
+
+/**
+ * @brief Disable the module and gate its clock
+ * @param[in] instance LPSPI instance (0-2)
+ * @return STATUS_SUCCESS if successful
+ * @return STATUS_BUSY if a DMA transfer is in progress
+ * @return STATUS_ERROR if instance invalid
+ */
+status_t LPSPI_Deinit(uint8_t instance);
+
+/**
+ * @brief Actual SCK frequency after LPSPI_MasterInit()
+ * @param[in] instance LPSPI instance (0-2)
+ * @return uint32_t SCK in Hz, 0 if not initialized
+ */
+uint32_t LPSPI_GetBaudRate(uint8_t instance);
+
+/**
+ * @brief Full-duplex blocking transfer
+ * @details Writes the TCR, then keeps up to LPSPI_FIFO_SIZE frames in
+ *          flight so SCK runs back-to-back. With continuousCs the CS is
+ *          negated by a final command word after the last frame.
+ *
+ * @param[in]  instance LPSPI instance (0-2)
+ * @param[in]  config   Transfer configuration
+ * @param[in]  txBuffer Frames to send (NULL sends zeros)
+ * @param[out] rxBuffer Received frames (NULL discards)
+ * @param[in]  frames   Number of frames
+ *
+ * @return STATUS_SUCCESS if successful
+ * @return STATUS_BUSY if a DMA transfer is in progress
+ * @return STATUS_TIMEOUT if the bus stopped making progress
+ * @return STATUS_ERROR if parameters are invalid
+ */
+status_t LPSPI_TransferBlocking(uint8_t instance, const lpspi_transfer_config_t *config,
+                                const void *txBuffer, void *rxBuffer, uint32_t frames);
+
+/**
+ * @brief Start a full-duplex eDMA transfer
+ * @details TX DMA feeds TDR while the TX FIFO is below its watermark, RX
+ *          DMA drains RDR; the LPSPI stalls instead of overflowing when RX
+ *          falls behind. Completion is signalled from the RX DMA interrupt.
+ *
+ * @param[in]  instance LPSPI instance (0-2)
+ * @param[in]  config   Transfer configuration
+ * @param[in]  txBuffer Frames to send (NULL sends zeros)
+ * @param[out] rxBuffer Received frames (NULL discards)
+ * @param[in]  frames   Number of frames (1 - LPSPI_DMA_MAX_FRAMES)
+ * @param[in]  dma      DMA channels and completion callback
+ *
+ * @return STATUS_SUCCESS if the transfer started
+ * @return STATUS_BUSY if a DMA transfer is in progress
+ * @return STATUS_ERROR if parameters are invalid or DMA setup failed
+ *
+ * @note DMA_Init() must have been called; buffers must stay valid until completion
+ *
+ * @code
+ * // Read 256 bytes from SPI flash: 4-byte command, then data, CS held low
+ * static uint8_t s_tx[260] = { 0x03U, addr2, addr1, addr0 };
+ * static uint8_t s_rx[260];
+ * lpspi_transfer_config_t xfer = { false, false, false, LPSPI_PCS0, 8U, true };
+ * lpspi_dma_config_t dma = { 0U, 1U, FlashReadDone, NULL };
+ * LPSPI_TransferDma(0U, &xfer, s_tx, s_rx, 260U, &dma);
+ * @endcode
+ */
+status_t LPSPI_TransferDma(uint8_t instance, const lpspi_transfer_config_t *config,
+                           const void *txBuffer, void *rxBuffer, uint16_t frames,
+                           const lpspi_dma_config_t *dma);
+
+/**
+ * @brief Abort a DMA transfer (FIFOs flushed, CS negated)
+ * @param[in] instance LPSPI instance (0-2)
+ * @return STATUS_SUCCESS if successful, STATUS_ERROR if instance invalid
+ */
+status_t LPSPI_AbortDma(uint8_t instance);
+
+/**
+ * @brief Check whether a DMA transfer is in progress
+ * @param[in] instance LPSPI instance (0-2)
+ * @return bool true while busy
+ */
+bool LPSPI_IsBusy(uint8_t instance);
+
+/** @} */ /* End of LPSPI_Functions */
+
+#endif /* LPSPI_H */
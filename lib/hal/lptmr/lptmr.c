@@ -0,0 +1,232 @@
+/**
+ * @file    lptmr.c
+ * @brief   LPTMR Driver Implementation for S32K144
+ * @details Implementation of the LPTMR0 time / pulse counter, compare
+ *          interrupt and counter readout.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "lptmr.h"
+#include "pcc.h"
+#include "nvic.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+
+/** @brief Compare callback */
+static lptmr_callback_t s_lptmrCallback = NULL;
+static void *s_lptmrUserData = NULL;
+
+/** @brief Configuration applied by LPTMR_Init() */
+static lptmr_mode_t s_lptmrMode = LPTMR_MODE_TIMER;
+static lptmr_clock_source_t s_lptmrClockSource = LPTMR_CLK_SRC_LPO1K;
+static uint8_t s_lptmrPrescaler = 0U;
+
+static bool s_lptmrInitialized = false;
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+status_t LPTMR_Init(const lptmr_config_t *config)
+{
+    uint32_t csr;
+    uint32_t psr;
+
+    if ((config == NULL) || (config->prescaler > LPTMR_MAX_PRESCALER) ||
+        ((uint32_t)config->clockSource > (uint32_t)LPTMR_CLK_SRC_PCC) ||
+        ((uint32_t)config->pinSelect > (uint32_t)LPTMR_PIN_ALT3)) {
+        return STATUS_ERROR;
+    }
+
+    /* Clock gate for the register interface (PCS only used with LPTMR_CLK_SRC_PCC) */
+    PCC->PCCn[PCC_LPTMR0_INDEX] |= PCC_PCCn_CGC_MASK;
+
+    /* Disable before changing PSR / CMR, clears TCF */
+    LPTMR0->CSR = LPTMR_CSR_TCF_MASK;
+
+    psr = LPTMR_PSR_PCS(config->clockSource);
+    if (config->prescaler == 0U) {
+        psr |= LPTMR_PSR_PBYP_MASK;
+    } else {
+        psr |= LPTMR_PSR_PRESCALE((uint32_t)config->prescaler - 1U);
+    }
+    LPTMR0->PSR = psr;
+    LPTMR0->CMR = config->compare;
+
+    csr = 0U;
+    if (config->mode == LPTMR_MODE_PULSE_COUNTER) {
+        csr |= LPTMR_CSR_TMS_MASK | LPTMR_CSR_TPS(config->pinSelect);
+        if (config->pinActiveLow) {
+            csr |= LPTMR_CSR_TPP_MASK;
+        }
+    }
+    if (config->freeRunning) {
+        csr |= LPTMR_CSR_TFC_MASK;
+    }
+    if (config->enableInterrupt) {
+        csr |= LPTMR_CSR_TIE_MASK;
+    }
+    LPTMR0->CSR = csr;
+
+    s_lptmrMode = config->mode;
+    s_lptmrClockSource = config->clockSource;
+    s_lptmrPrescaler = config->prescaler;
+    s_lptmrInitialized = true;
+
+    return STATUS_SUCCESS;
+}
+
+status_t LPTMR_Deinit(void)
+{
+    if (s_lptmrInitialized) {
+        LPTMR0->CSR = LPTMR_CSR_TCF_MASK;
+    }
+
+    PCC->PCCn[PCC_LPTMR0_INDEX] &= ~PCC_PCCn_CGC_MASK;
+
+    s_lptmrCallback = NULL;
+    s_lptmrUserData = NULL;
+    s_lptmrInitialized = false;
+
+    return STATUS_SUCCESS;
+}
+
+status_t LPTMR_Start(void)
+{
+    if (!s_lptmrInitialized) {
+        return STATUS_ERROR;
+    }
+
+    /* TCF not written: the previous run's flag was cleared by TEN = 0 */
+    LPTMR0->CSR = (LPTMR0->CSR & ~LPTMR_CSR_TCF_MASK) | LPTMR_CSR_TEN_MASK;
+
+    return STATUS_SUCCESS;
+}
+
+status_t LPTMR_Stop(void)
+{
+    if (!s_lptmrInitialized) {
+        return STATUS_ERROR;
+    }
+
+    /* TEN = 0 resets the counter and TCF */
+    LPTMR0->CSR &= ~(LPTMR_CSR_TEN_MASK | LPTMR_CSR_TCF_MASK);
+
+    return STATUS_SUCCESS;
+}
+
+status_t LPTMR_SetCompare(uint16_t compare)
+{
+    uint32_t csr;
+
+    if (!s_lptmrInitialized) {
+        return STATUS_ERROR;
+    }
+
+    csr = LPTMR0->CSR;
+    if (((csr & LPTMR_CSR_TEN_MASK) != 0U) && ((csr & LPTMR_CSR_TCF_MASK) == 0U)) {
+        return STATUS_BUSY;
+    }
+
+    LPTMR0->CMR = compare;
+
+    return STATUS_SUCCESS;
+}
+
+uint16_t LPTMR_GetCounter(void)
+{
+    if (!s_lptmrInitialized) {
+        return 0U;
+    }
+
+    /* Write any value to CNR to latch the counter */
+    LPTMR0->CNR = 0U;
+
+    return (uint16_t)(LPTMR0->CNR & LPTMR_CNR_COUNTER_MASK);
+}
+
+bool LPTMR_GetCompareFlag(void)
+{
+    if (!s_lptmrInitialized) {
+        return false;
+    }
+
+    return (LPTMR0->CSR & LPTMR_CSR_TCF_MASK) != 0U;
+}
+
+void LPTMR_ClearCompareFlag(void)
+{
+    if (s_lptmrInitialized) {
+        /* TCF write 1 to clear, other bits unchanged */
+        LPTMR0->CSR |= LPTMR_CSR_TCF_MASK;
+    }
+}
+
+uint32_t LPTMR_GetCounterFreq(void)
+{
+    uint32_t freq;
+
+    if (!s_lptmrInitialized || (s_lptmrMode != LPTMR_MODE_TIMER)) {
+        return 0U;
+    }
+
+    switch (s_lptmrClockSource) {
+        case LPTMR_CLK_SRC_SIRCDIV2:
+            freq = PCC_GetSircDiv2Freq();
+            break;
+        case LPTMR_CLK_SRC_LPO1K:
+            freq = LPTMR_LPO1K_FREQ;
+            break;
+        case LPTMR_CLK_SRC_RTC:
+            freq = LPTMR_RTC_CLK_FREQ;
+            break;
+        default:
+            freq = PCC_GetPeripheralClockFreq(PCC_LPTMR0_INDEX);
+            break;
+    }
+
+    return freq >> s_lptmrPrescaler;
+}
+
+status_t LPTMR_InstallCallback(lptmr_callback_t callback, void *userData)
+{
+    uint32_t basepri = NVIC_EnterCritical();
+
+    s_lptmrCallback = callback;
+    s_lptmrUserData = userData;
+
+    NVIC_ExitCritical(basepri);
+
+    return STATUS_SUCCESS;
+}
+
+status_t LPTMR_InstallIrqHandler(void)
+{
+    if (NVIC_InstallHandler(LPTMR0_IRQn, LPTMR_IRQHandler) != NVIC_STATUS_SUCCESS) {
+        return STATUS_ERROR;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+void LPTMR_IRQHandler(void)
+{
+    if ((LPTMR0->CSR & LPTMR_CSR_TCF_MASK) == 0U) {
+        return;
+    }
+
+    LPTMR0->CSR |= LPTMR_CSR_TCF_MASK;
+
+    if (s_lptmrCallback != NULL) {
+        s_lptmrCallback(s_lptmrUserData);
+    }
+}
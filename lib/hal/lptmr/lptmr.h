@@ -0,0 +1,207 @@
+/**
+ * @file    lptmr.h
+ * @brief   LPTMR (Low Power Timer) driver for S32K144
+ * @details
+ * LPTMR driver provides the following APIs:
+ * - Time counter mode: 16-bit compare interrupt from SIRCDIV2, LPO1K,
+ *   RTC_CLK or the PCC clock, with an optional 2^n prescaler
+ * - Pulse counter mode: count edges on a TRGMUX / ALT input pin, with an
+ *   optional glitch filter
+ * - Wakeup from VLPS: clocked from the LPO1K, the counter keeps running with
+ *   SIRC / FIRC / SOSC / SPLL off, so long sleeps need no other timer
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ *
+ * @note
+ * - The compare flag sets when the counter equals CMR and increments: the
+ *   period is (compare + 1) counts
+ * - With freeRunning = false the counter returns to 0 on every compare
+ * - PCS = LPTMR_CLK_SRC_PCC uses the clock selected in PCC_LPTMR0[PCS]
+ *
+ * @par Change Log:
+ * - Version 1.0 (14/10/2026): Initial LPTMR driver
+ */
+
+#ifndef LPTMR_H
+#define LPTMR_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "lptmr_reg.h"
+#include "status.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @defgroup LPTMR_Definitions LPTMR Definitions
+ * @{
+ */
+
+/** @brief Maximum compare value */
+#define LPTMR_MAX_COMPARE       (0xFFFFU)
+
+/** @brief Maximum prescaler exponent (divide by 2^16) */
+#define LPTMR_MAX_PRESCALER     (16U)
+
+/** @brief LPO1K clock frequency (Hz) */
+#define LPTMR_LPO1K_FREQ        (1000U)
+
+/** @brief RTC_CLK frequency assumed for LPTMR_CLK_SRC_RTC (Hz) */
+#ifndef LPTMR_RTC_CLK_FREQ
+#define LPTMR_RTC_CLK_FREQ      (32768U)
+#endif
+
+/**
+ * @brief LPTMR operating mode
+ */
+typedef enum {
+    LPTMR_MODE_TIMER         = 0U,  /**< Time counter (prescaler clock) */
+    LPTMR_MODE_PULSE_COUNTER = 1U   /**< Pulse counter (input pin) */
+} lptmr_mode_t;
+
+/**
+ * @brief Prescaler / glitch filter clock (PSR[PCS])
+ */
+typedef enum {
+    LPTMR_CLK_SRC_SIRCDIV2 = 0U,    /**< SIRCDIV2_CLK (stops in VLPS unless SIRC low-power enable) */
+    LPTMR_CLK_SRC_LPO1K    = 1U,    /**< LPO 1 kHz, always on */
+    LPTMR_CLK_SRC_RTC      = 2U,    /**< RTC_CLK (SIM_LPOCLKS[RTCCLKSEL]) */
+    LPTMR_CLK_SRC_PCC      = 3U     /**< PCC_LPTMR0[PCS] functional clock */
+} lptmr_clock_source_t;
+
+/**
+ * @brief Pulse counter input (CSR[TPS])
+ */
+typedef enum {
+    LPTMR_PIN_TRGMUX = 0U,          /**< TRGMUX output */
+    LPTMR_PIN_ALT1   = 1U,          /**< LPTMR0_ALT1 pin */
+    LPTMR_PIN_ALT2   = 2U,          /**< LPTMR0_ALT2 pin */
+    LPTMR_PIN_ALT3   = 3U           /**< LPTMR0_ALT3 pin */
+} lptmr_pin_select_t;
+
+/**
+ * @brief LPTMR configuration
+ */
+typedef struct {
+    lptmr_mode_t mode;                  /**< Time or pulse counter */
+    lptmr_clock_source_t clockSource;   /**< Prescaler / glitch filter clock */
+    uint8_t prescaler;                  /**< 0 = bypass, n = divide by 2^n (timer) or
+                                             2^(n-1) edges filter (pulse), 1..16 */
+    lptmr_pin_select_t pinSelect;       /**< Pulse counter input */
+    bool pinActiveLow;                  /**< Pulse counter counts falling edges */
+    bool freeRunning;                   /**< Counter not reset on compare */
+    bool enableInterrupt;               /**< Interrupt on compare */
+    uint16_t compare;                   /**< Compare value (period - 1) */
+} lptmr_config_t;
+
+/**
+ * @brief LPTMR compare callback (interrupt context)
+ * @param userData Pointer to user data
+ */
+typedef void (*lptmr_callback_t)(void *userData);
+
+/** @} */ /* End of LPTMR_Definitions */
+
+/*******************************************************************************
+ * API Function Prototypes
+ ******************************************************************************/
+
+/**
+ * @defgroup LPTMR_Functions LPTMR Functions
+ * @{
+ */
+
+/**
+ * @brief Enable the LPTMR0 clock gate and configure the timer (stopped)
+ *
+ * @param[in] config LPTMR configuration
+ *
+ * @return STATUS_SUCCESS, STATUS_ERROR on invalid parameters
+ *
+ * @code
+ * // 5 s wakeup from the LPO1K
+ * lptmr_config_t cfg = {
+ *     .mode = LPTMR_MODE_TIMER, .clockSource = LPTMR_CLK_SRC_LPO1K,
+ *     .prescaler = 0U, .freeRunning = false, .enableInterrupt = true,
+ *     .compare = 5000U - 1U
+ * };
+ * LPTMR_Init(&cfg);
+ * LPTMR_Start();
+ * @endcode
+ */
+status_t LPTMR_Init(const lptmr_config_t *config);
+
+/**
+ * @brief Stop the timer and gate the LPTMR0 clock
+ * @return STATUS_SUCCESS
+ */
+status_t LPTMR_Deinit(void);
+
+/**
+ * @brief Enable the counter (counts from 0)
+ * @return STATUS_ERROR if not initialized
+ */
+status_t LPTMR_Start(void);
+
+/**
+ * @brief Disable the counter (counter and compare flag reset)
+ * @return STATUS_ERROR if not initialized
+ */
+status_t LPTMR_Stop(void);
+
+/**
+ * @brief Change the compare value
+ * @details CMR may only change while the timer is disabled or the compare
+ *          flag is set (the driver checks it).
+ * @return STATUS_BUSY if the timer is running and the flag is clear
+ */
+status_t LPTMR_SetCompare(uint16_t compare);
+
+/**
+ * @brief Read the counter (CNR write-then-read latch)
+ * @return Counter value, 0 if not initialized
+ */
+uint16_t LPTMR_GetCounter(void);
+
+/**
+ * @brief Check the compare flag
+ */
+bool LPTMR_GetCompareFlag(void);
+
+/**
+ * @brief Clear the compare flag
+ */
+void LPTMR_ClearCompareFlag(void);
+
+/**
+ * @brief Counter frequency after the prescaler (Hz), timer mode
+ * @return 0 if not initialized or in pulse counter mode
+ */
+uint32_t LPTMR_GetCounterFreq(void);
+
+/**
+ * @brief Install the compare callback (NULL to remove)
+ */
+status_t LPTMR_InstallCallback(lptmr_callback_t callback, void *userData);
+
+/**
+ * @brief Install LPTMR_IRQHandler() in the RAM vector table
+ * @return STATUS_ERROR if the vector cannot be installed
+ */
+status_t LPTMR_InstallIrqHandler(void);
+
+/**
+ * @brief LPTMR0 interrupt handler: clears the compare flag, calls the callback
+ */
+void LPTMR_IRQHandler(void);
+
+/** @} */ /* End of LPTMR_Functions */
+
+#endif /* LPTMR_H */
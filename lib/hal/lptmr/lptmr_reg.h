@@ -0,0 +1,128 @@
+/**
+ * @file    lptmr_reg.h
+ * @brief   LPTMR (Low Power Timer) Register Definitions for S32K144
+ * @details
+ * Defines LPTMR0 registers and bitfields.
+ * LPTMR is a 16-bit counter that keeps running in VLPS from the always-on
+ * LPO, used as a low-power wakeup timer or as a pulse counter.
+ *
+ * S32K144 LPTMR features:
+ * - 1 instance (LPTMR0), 16-bit counter and compare
+ * - Time counter mode (SIRCDIV2, LPO1K, RTC_CLK or PCC clock) or pulse
+ *   counter mode (TRGMUX or ALT1..3 input pins)
+ * - Prescaler (2 .. 65536) or glitch filter (pulse mode)
+ * - Interrupt / DMA request on compare
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ *
+ * @note    Refer to S32K1xx Reference Manual Chapter 44 (LPTMR)
+ * @warning Must enable the LPTMR0 clock gate (PCC) before register access
+ *
+ * @par Change Log:
+ * - Version 1.0 (14/10/2026): Initial LPTMR register definitions
+ */
+
+#ifndef LPTMR_REG_H
+#define LPTMR_REG_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "def_reg.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief LPTMR0 module base address */
+#define LPTMR0_BASE         (0x40040000UL)
+
+/*******************************************************************************
+ * LPTMR Register Structure
+ ******************************************************************************/
+
+/**
+ * @brief LPTMR Module Structure
+ */
+typedef struct {
+    __IO uint32_t CSR;              /**< 0x0000: Control Status Register */
+    __IO uint32_t PSR;              /**< 0x0004: Prescale Register */
+    __IO uint32_t CMR;              /**< 0x0008: Compare Register */
+    __IO uint32_t CNR;              /**< 0x000C: Counter Register (write to latch, then read) */
+} LPTMR_Type;
+
+/*******************************************************************************
+ * Register Access Macros
+ ******************************************************************************/
+
+/** @brief LPTMR0 module pointer */
+#define LPTMR0              ((LPTMR_Type *)LPTMR0_BASE)
+
+/*******************************************************************************
+ * Control Status Register (CSR) Bit Definitions
+ ******************************************************************************/
+
+/** @brief Timer Enable - counter reset while 0 */
+#define LPTMR_CSR_TEN_MASK      (0x00000001UL)
+#define LPTMR_CSR_TEN_SHIFT     (0U)
+
+/** @brief Timer Mode Select - 0 time counter, 1 pulse counter */
+#define LPTMR_CSR_TMS_MASK      (0x00000002UL)
+#define LPTMR_CSR_TMS_SHIFT     (1U)
+
+/** @brief Timer Free-Running Counter - 1 = no reset on compare */
+#define LPTMR_CSR_TFC_MASK      (0x00000004UL)
+#define LPTMR_CSR_TFC_SHIFT     (2U)
+
+/** @brief Timer Pin Polarity - 1 = count falling edges */
+#define LPTMR_CSR_TPP_MASK      (0x00000008UL)
+#define LPTMR_CSR_TPP_SHIFT     (3U)
+
+/** @brief Timer Pin Select - pulse counter input */
+#define LPTMR_CSR_TPS_MASK      (0x00000030UL)
+#define LPTMR_CSR_TPS_SHIFT     (4U)
+#define LPTMR_CSR_TPS(x)        (((uint32_t)(x) << LPTMR_CSR_TPS_SHIFT) & LPTMR_CSR_TPS_MASK)
+
+/** @brief Timer Interrupt Enable */
+#define LPTMR_CSR_TIE_MASK      (0x00000040UL)
+#define LPTMR_CSR_TIE_SHIFT     (6U)
+
+/** @brief Timer Compare Flag (write 1 to clear) */
+#define LPTMR_CSR_TCF_MASK      (0x00000080UL)
+#define LPTMR_CSR_TCF_SHIFT     (7U)
+
+/** @brief Timer DMA Request Enable */
+#define LPTMR_CSR_TDRE_MASK     (0x00000100UL)
+#define LPTMR_CSR_TDRE_SHIFT    (8U)
+
+/*******************************************************************************
+ * Prescale Register (PSR) Bit Definitions
+ ******************************************************************************/
+
+/** @brief Prescaler Clock Select - 0 SIRCDIV2, 1 LPO1K, 2 RTC_CLK, 3 PCC */
+#define LPTMR_PSR_PCS_MASK      (0x00000003UL)
+#define LPTMR_PSR_PCS_SHIFT     (0U)
+#define LPTMR_PSR_PCS(x)        (((uint32_t)(x) << LPTMR_PSR_PCS_SHIFT) & LPTMR_PSR_PCS_MASK)
+
+/** @brief Prescaler Bypass */
+#define LPTMR_PSR_PBYP_MASK     (0x00000004UL)
+#define LPTMR_PSR_PBYP_SHIFT    (2U)
+
+/** @brief Prescale Value - divide by 2^(PRESCALE + 1) */
+#define LPTMR_PSR_PRESCALE_MASK     (0x00000078UL)
+#define LPTMR_PSR_PRESCALE_SHIFT    (3U)
+#define LPTMR_PSR_PRESCALE(x)       (((uint32_t)(x) << LPTMR_PSR_PRESCALE_SHIFT) & LPTMR_PSR_PRESCALE_MASK)
+
+/*******************************************************************************
+ * Compare / Counter Register Bit Definitions
+ ******************************************************************************/
+
+/** @brief Compare value */
+#define LPTMR_CMR_COMPARE_MASK  (0x0000FFFFUL)
+
+/** @brief Counter value */
+#define LPTMR_CNR_COUNTER_MASK  (0x0000FFFFUL)
+
+#endif /* LPTMR_REG_H */
@@ -5,23 +5,158 @@
  * 
  * @author  PhucPH32
  * @date    30/11/2025
- * @version 1.0
+ * @version 1.2
  */
 
 /*******************************************************************************
  * Includes
  ******************************************************************************/
 #include "nvic.h"
+#include <stddef.h>
 
 /*******************************************************************************
  * Private Definitions
  ******************************************************************************/
 
-/** @brief Number of implemented priority bits (4 bits = 16 levels) */
-#define NVIC_PRIO_BITS          (4U)
+/** @brief SRAM_L / SRAM_U range (VTOR already in RAM) */
+#define NVIC_SRAM_START         (0x1FFF8000UL)
+#define NVIC_SRAM_END           (0x20007000UL)
 
-/** @brief Vector table alignment requirement */
-#define NVIC_VTOR_ALIGNMENT     (128U)
+/** @brief Vector table index of the first device interrupt */
+#define NVIC_IRQ_VECTOR_OFFSET  (16)
+
+/** @brief First core exception with an SHPR priority (MemManage, exception 4) */
+#define NVIC_SHPR_FIRST_IRQN    (-12)
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+
+/** @brief NVIC_EnterCritical() uses the BASEPRI ceiling (priorities applied) */
+bool g_nvicPriorityPlanApplied = false;
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+
+/** @brief Default priority plan of the HAL interrupts (nvic.h, NVIC_PRIO_x) */
+static const nvic_priority_entry_t s_nvicPriorityPlan[] = {
+    { WDOG_EWM_IRQn,            NVIC_PRIO_WDOG },
+    { CAN0_ORed_0_15_MB_IRQn,   NVIC_PRIO_CAN_MB },
+    { CAN0_ORed_16_31_MB_IRQn,  NVIC_PRIO_CAN_MB },
+    { CAN1_ORed_0_15_MB_IRQn,   NVIC_PRIO_CAN_MB },
+    { CAN2_ORed_0_15_MB_IRQn,   NVIC_PRIO_CAN_MB },
+    { ADC0_IRQn,                NVIC_PRIO_ADC },
+    { ADC1_IRQn,                NVIC_PRIO_ADC },
+    { PDB0_IRQn,                NVIC_PRIO_PDB },
+    { PDB1_IRQn,                NVIC_PRIO_PDB },
+    { CMP0_IRQn,                NVIC_PRIO_CMP },
+    { DMA0_IRQn,                NVIC_PRIO_DMA },
+    { DMA1_IRQn,                NVIC_PRIO_DMA },
+    { DMA2_IRQn,                NVIC_PRIO_DMA },
+    { DMA3_IRQn,                NVIC_PRIO_DMA },
+    { DMA4_IRQn,                NVIC_PRIO_DMA },
+    { DMA5_IRQn,                NVIC_PRIO_DMA },
+    { DMA6_IRQn,                NVIC_PRIO_DMA },
+    { DMA7_IRQn,                NVIC_PRIO_DMA },
+    { DMA8_IRQn,                NVIC_PRIO_DMA },
+    { DMA9_IRQn,                NVIC_PRIO_DMA },
+    { DMA10_IRQn,               NVIC_PRIO_DMA },
+    { DMA11_IRQn,               NVIC_PRIO_DMA },
+    { DMA12_IRQn,               NVIC_PRIO_DMA },
+    { DMA13_IRQn,               NVIC_PRIO_DMA },
+    { DMA14_IRQn,               NVIC_PRIO_DMA },
+    { DMA15_IRQn,               NVIC_PRIO_DMA },
+    { LPIT0_Ch0_IRQn,           NVIC_PRIO_LPIT },
+    { LPIT0_Ch1_IRQn,           NVIC_PRIO_LPIT },
+    { LPIT0_Ch2_IRQn,           NVIC_PRIO_LPIT },
+    { LPIT0_Ch3_IRQn,           NVIC_PRIO_LPIT },
+    { LPTMR0_IRQn,              NVIC_PRIO_LPTMR },
+    { FTM0_Ch0_Ch1_IRQn,        NVIC_PRIO_FTM },
+    { FTM0_Ch2_Ch3_IRQn,        NVIC_PRIO_FTM },
+    { FTM0_Ch4_Ch5_IRQn,        NVIC_PRIO_FTM },
+    { FTM0_Ch6_Ch7_IRQn,        NVIC_PRIO_FTM },
+    { FTM0_Fault_IRQn,          NVIC_PRIO_FTM },
+    { FTM0_Ovf_Reload_IRQn,     NVIC_PRIO_FTM },
+    { FTM1_Ch0_Ch1_IRQn,        NVIC_PRIO_FTM },
+    { FTM1_Ch2_Ch3_IRQn,        NVIC_PRIO_FTM },
+    { FTM1_Ch4_Ch5_IRQn,        NVIC_PRIO_FTM },
+    { FTM1_Ch6_Ch7_IRQn,        NVIC_PRIO_FTM },
+    { FTM1_Fault_IRQn,          NVIC_PRIO_FTM },
+    { FTM1_Ovf_Reload_IRQn,     NVIC_PRIO_FTM },
+    { FTM2_Ch0_Ch1_IRQn,        NVIC_PRIO_FTM },
+    { FTM2_Ch2_Ch3_IRQn,        NVIC_PRIO_FTM },
+    { FTM2_Ch4_Ch5_IRQn,        NVIC_PRIO_FTM },
+    { FTM2_Ch6_Ch7_IRQn,        NVIC_PRIO_FTM },
+    { FTM2_Fault_IRQn,          NVIC_PRIO_FTM },
+    { FTM2_Ovf_Reload_IRQn,     NVIC_PRIO_FTM },
+    { FTM3_Ch0_Ch1_IRQn,        NVIC_PRIO_FTM },
+    { FTM3_Ch2_Ch3_IRQn,        NVIC_PRIO_FTM },
+    { FTM3_Ch4_Ch5_IRQn,        NVIC_PRIO_FTM },
+    { FTM3_Ch6_Ch7_IRQn,        NVIC_PRIO_FTM },
+    { FTM3_Fault_IRQn,          NVIC_PRIO_FTM },
+    { FTM3_Ovf_Reload_IRQn,     NVIC_PRIO_FTM },
+    { SysTick_IRQn,             NVIC_PRIO_SYSTICK },
+    { LPUART0_RxTx_IRQn,        NVIC_PRIO_UART },
+    { LPUART1_RxTx_IRQn,        NVIC_PRIO_UART },
+    { LPUART2_RxTx_IRQn,        NVIC_PRIO_UART },
+    { LPSPI0_IRQn,              NVIC_PRIO_SPI },
+    { LPSPI1_IRQn,              NVIC_PRIO_SPI },
+    { LPSPI2_IRQn,              NVIC_PRIO_SPI },
+    { LPI2C0_Master_IRQn,       NVIC_PRIO_I2C },
+    { LPI2C0_Slave_IRQn,        NVIC_PRIO_I2C },
+    { CAN0_ORed_IRQn,           NVIC_PRIO_CAN_STATUS },
+    { CAN0_Error_IRQn,          NVIC_PRIO_CAN_STATUS },
+    { CAN0_Wake_Up_IRQn,        NVIC_PRIO_CAN_STATUS },
+    { CAN1_ORed_IRQn,           NVIC_PRIO_CAN_STATUS },
+    { CAN1_Error_IRQn,          NVIC_PRIO_CAN_STATUS },
+    { CAN2_ORed_IRQn,           NVIC_PRIO_CAN_STATUS },
+    { CAN2_Error_IRQn,          NVIC_PRIO_CAN_STATUS },
+    { DMA_Error_IRQn,           NVIC_PRIO_DMA_ERROR },
+    { FTFC_IRQn,                NVIC_PRIO_FTFC },
+    { PORTA_IRQn,               NVIC_PRIO_PORT },
+    { PORTB_IRQn,               NVIC_PRIO_PORT },
+    { PORTC_IRQn,               NVIC_PRIO_PORT },
+    { PORTD_IRQn,               NVIC_PRIO_PORT },
+    { PORTE_IRQn,               NVIC_PRIO_PORT },
+    { RTC_IRQn,                 NVIC_PRIO_RTC },
+    { RTC_Seconds_IRQn,         NVIC_PRIO_RTC },
+    { SVCall_IRQn,              NVIC_PRIO_SVCALL },
+    { PendSV_IRQn,              NVIC_PRIO_PENDSV }
+};
+
+/** @brief ISR entry hook (instrumentation mode) */
+static volatile nvic_entry_hook_t s_nvicEntryHook = NULL;
+
+#if NVIC_RAM_VECTORS_ENABLE
+/** @brief RAM vector table (used when VTOR points to flash) */
+static nvic_handler_t s_nvicRamVectors[NVIC_VECTOR_COUNT] __attribute__((aligned(NVIC_VTOR_ALIGNMENT)));
+#endif
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Check whether VTOR points into SRAM
+ */
+static inline bool NVIC_IsVectorTableInRam(void)
+{
+    uint32_t vtor = SCB->VTOR;
+    
+    return ((vtor >= NVIC_SRAM_START) && (vtor < NVIC_SRAM_END));
+}
+
+/**
+ * @brief Check that an IRQ number has a vector table entry
+ */
+static inline bool NVIC_IsValidVector(IRQn_Type IRQn)
+{
+    int32_t index = (int32_t)IRQn + NVIC_IRQ_VECTOR_OFFSET;
+    
+    /* Entry 0 is the initial stack pointer, entry 1 the reset vector */
+    return ((index >= 2) && (index < (int32_t)NVIC_VECTOR_COUNT));
+}
 
 /*******************************************************************************
  * Public Functions
@@ -329,6 +464,60 @@ void NVIC_EnableGlobalIRQ(uint32_t primask)
     __asm volatile ("msr primask, %0" :: "r" (primask) : "memory");
 }
 
+/**
+ * @brief Apply a priority table
+ */
+nvic_status_t NVIC_ApplyPriorityTable(const nvic_priority_entry_t *table, uint32_t count)
+{
+    nvic_status_t status = NVIC_STATUS_SUCCESS;
+    uint8_t value;
+    uint32_t i;
+    int32_t irq;
+    
+    if (table == NULL) {
+        return NVIC_STATUS_INVALID_PARAM;
+    }
+    
+    for (i = 0U; i < count; i++) {
+        irq = (int32_t)table[i].irq;
+        
+        if ((table[i].priority > NVIC_PRIORITY_MIN) || (irq < NVIC_SHPR_FIRST_IRQN) ||
+            (irq >= (int32_t)NVIC_NUM_INTERRUPTS)) {
+            status = NVIC_STATUS_INVALID_PARAM;
+            continue;
+        }
+        
+        value = (uint8_t)(table[i].priority << (8U - NVIC_PRIO_BITS));
+        if (irq < 0) {
+            /* Core exception: SHPR byte (exception number - 4) */
+            SCB->SHPR[irq - NVIC_SHPR_FIRST_IRQN] = value;
+        } else {
+            NVIC->IP[(uint32_t)irq] = value;
+        }
+    }
+    
+    return status;
+}
+
+/**
+ * @brief Apply the default priority plan
+ */
+nvic_status_t NVIC_ApplyPriorityPlan(void)
+{
+    nvic_status_t status;
+    
+    status = NVIC_ApplyPriorityTable(s_nvicPriorityPlan,
+                                     (uint32_t)(sizeof(s_nvicPriorityPlan) / sizeof(s_nvicPriorityPlan[0])));
+    
+    /* Skipped entry = interrupt left at priority 0, keep the PRIMASK sections */
+    if (status == NVIC_STATUS_SUCCESS) {
+        __asm volatile ("dsb" ::: "memory");
+        g_nvicPriorityPlanApplied = true;
+    }
+    
+    return status;
+}
+
 /**
  * @brief Set vector table offset
  */
@@ -361,6 +550,80 @@ nvic_status_t NVIC_GetVectorTable(uint32_t *offset)
     return NVIC_STATUS_SUCCESS;
 }
 
+/**
+ * @brief Move the vector table to SRAM
+ */
+nvic_status_t NVIC_InitRamVectorTable(void)
+{
+#if NVIC_RAM_VECTORS_ENABLE
+    const nvic_handler_t *active;
+    uint32_t primask;
+    uint32_t i;
+    
+    if (NVIC_IsVectorTableInRam()) {
+        return NVIC_STATUS_SUCCESS;
+    }
+    
+    /* No interrupt may be taken between the copy and the VTOR switch */
+    primask = NVIC_DisableGlobalIRQ();
+    
+    active = (const nvic_handler_t *)SCB->VTOR;
+    for (i = 0U; i < NVIC_VECTOR_COUNT; i++) {
+        s_nvicRamVectors[i] = active[i];
+    }
+    
+    __asm volatile ("dsb" ::: "memory");
+    SCB->VTOR = (uint32_t)s_nvicRamVectors;
+    __asm volatile ("dsb\n\tisb" ::: "memory");
+    
+    NVIC_EnableGlobalIRQ(primask);
+    
+    return NVIC_STATUS_SUCCESS;
+#else
+    return NVIC_IsVectorTableInRam() ? NVIC_STATUS_SUCCESS : NVIC_STATUS_ERROR;
+#endif
+}
+
+/**
+ * @brief Install handler in the RAM vector table
+ */
+nvic_status_t NVIC_InstallHandler(IRQn_Type IRQn, nvic_handler_t handler)
+{
+    nvic_handler_t *table;
+    
+    if (!NVIC_IsValidVector(IRQn) || (handler == NULL)) {
+        return NVIC_STATUS_INVALID_PARAM;
+    }
+    
+    if (NVIC_InitRamVectorTable() != NVIC_STATUS_SUCCESS) {
+        return NVIC_STATUS_ERROR;
+    }
+    
+    table = (nvic_handler_t *)SCB->VTOR;
+    table[(int32_t)IRQn + NVIC_IRQ_VECTOR_OFFSET] = handler;
+    
+    /* Vector fetch after this point sees the new entry */
+    __asm volatile ("dsb" ::: "memory");
+    
+    return NVIC_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Get installed handler
+ */
+nvic_handler_t NVIC_GetHandler(IRQn_Type IRQn)
+{
+    const nvic_handler_t *table;
+    
+    if (!NVIC_IsValidVector(IRQn)) {
+        return NULL;
+    }
+    
+    table = (const nvic_handler_t *)SCB->VTOR;
+    
+    return table[(int32_t)IRQn + NVIC_IRQ_VECTOR_OFFSET];
+}
+
 /**
  * @brief Wait for interrupt
  */
@@ -410,3 +673,23 @@ nvic_status_t NVIC_EnableFaultHandlers(bool enableUsageFault,
     
     return NVIC_STATUS_SUCCESS;
 }
+
+/**
+ * @brief Install ISR entry hook
+ */
+void NVIC_InstallEntryHook(nvic_entry_hook_t hook)
+{
+    s_nvicEntryHook = hook;
+}
+
+/**
+ * @brief Report ISR entry to the installed hook
+ */
+void NVIC_TraceIsrEntry(IRQn_Type IRQn)
+{
+    nvic_entry_hook_t hook = s_nvicEntryHook;
+    
+    if (hook != NULL) {
+        hook(IRQn);
+    }
+}
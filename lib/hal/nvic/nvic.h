@@ -11,10 +11,18 @@
  * - Check interrupt active status
  * - Priority grouping configuration
  * - System reset
+ * - RAM vector table with direct handler installation
+ * - BASEPRI critical sections below a priority ceiling
+ * - Central priority plan for the HAL interrupts
  * 
  * @author  PhucPH32
  * @date    30/11/2025
- * @version 1.0
+ * @version 1.2
+ * 
+ * @par Change Log:
+ * - Version 1.1 (14/10/2026): RAM vector table, NVIC_InstallHandler()
+ * - Version 1.2 (14/10/2026): NVIC_EnterCritical() / NVIC_ExitCritical(), priority plan table
+ *   (PRIMASK fallback until the plan is applied)
  * 
  * @par Example:
  * @code
@@ -55,12 +63,201 @@ typedef enum {
     NVIC_STATUS_INVALID_PARAM = 0x04U    /**< Invalid parameter */
 } nvic_status_t;
 
+/** @brief Number of implemented priority bits (4 bits = 16 levels) */
+#define NVIC_PRIO_BITS          (4U)
+
 /** @brief Maximum priority value (lowest priority) */
 #define NVIC_PRIORITY_MIN       (15U)
 
 /** @brief Minimum priority value (highest priority) */
 #define NVIC_PRIORITY_MAX       (0U)
 
+/**
+ * @brief ISR latency instrumentation (0 = NVIC_TRACE_ISR_ENTRY compiles to nothing)
+ * @details When enabled, HAL interrupt handlers (ADC0/1_IRQHandler,
+ *          DMA_IRQHandler, LPIT_IRQHandler) report their entry through the
+ *          hook installed with NVIC_InstallEntryHook().
+ */
+#ifndef NVIC_ISR_TRACE_ENABLE
+#define NVIC_ISR_TRACE_ENABLE   (0U)
+#endif
+
+/** @brief ISR entry hook, called first thing in an instrumented handler */
+typedef void (*nvic_entry_hook_t)(IRQn_Type IRQn);
+
+#if NVIC_ISR_TRACE_ENABLE
+#define NVIC_TRACE_ISR_ENTRY(irq)   NVIC_TraceIsrEntry(irq)
+#else
+#define NVIC_TRACE_ISR_ENTRY(irq)   ((void)0)
+#endif
+
+/**
+ * @brief Complete a flag-clearing write before the handler returns
+ * @details The write to a peripheral flag register can still be in the bus
+ *          bridge when the handler returns; the interrupt line is then still
+ *          asserted and the NVIC tail-chains into the same handler again.
+ *          Reading back a register of the same peripheral stalls until the
+ *          write has completed. Needed only when nothing else touches the
+ *          peripheral between the clear and the exception return.
+ */
+#define NVIC_ISR_WRITE_FENCE(reg)   ((void)(reg))
+
+/**
+ * @brief RAM vector table support (0 = no table in .bss, NVIC_InstallHandler() fails)
+ * @details When the linker script already places the vector table in SRAM
+ *          (startup copies __VECTOR_TABLE to __VECTOR_RAM), that table is
+ *          reused and the driver table is never written.
+ */
+#ifndef NVIC_RAM_VECTORS_ENABLE
+#define NVIC_RAM_VECTORS_ENABLE     (1U)
+#endif
+
+/** @brief Vector table entries: 16 core exceptions + 123 S32K144 interrupts */
+#define NVIC_VECTOR_COUNT           (16U + 123U)
+
+/** @brief VTOR alignment: table size rounded up to a power of two (556 -> 1024 bytes) */
+#define NVIC_VTOR_ALIGNMENT         (1024U)
+
+/** @brief Exception / interrupt handler (vector table entry) */
+typedef void (*nvic_handler_t)(void);
+
+/**
+ * @defgroup NVIC_Priority_Plan NVIC Priority Plan
+ * @brief Critical section ceiling and default priorities of the HAL interrupts
+ * @details NVIC_EnterCritical() raises BASEPRI to NVIC_CRITICAL_CEILING:
+ *          interrupts with priority NVIC_CRITICAL_CEILING..15 wait, interrupts
+ *          with priority 0..NVIC_CRITICAL_CEILING-1 keep running inside every
+ *          critical section. Those "zero latency" handlers must not call into
+ *          drivers or services that use NVIC_EnterCritical() (they would race
+ *          with the protected data).
+ *
+ *          NVIC_ApplyPriorityPlan() writes one priority per HAL interrupt
+ *          from the NVIC_PRIO_x defines below. Override a define (build flag)
+ *          to move an interrupt; move it below the ceiling only if its
+ *          handler touches no shared driver / service state.
+ *
+ *          At reset every interrupt has priority 0, above any ceiling. Until
+ *          the plan has been applied NVIC_EnterCritical() therefore masks
+ *          with PRIMASK (all interrupts), the ceiling takes effect only after
+ *          a successful NVIC_ApplyPriorityPlan().
+ *
+ *          Default plan (0 = highest):
+ *          - 0          : WDOG early warning (reset follows in 128 bus clocks),
+ *                         otherwise free, above the ceiling
+ *          - 1          : CAN message buffers (RX ring must keep up with the bus)
+ *          - 2          : ADC, PDB, CMP, DMA channels (conversion / threshold /
+ *                         transfer complete)
+ *          - 3          : LPIT, LPTMR, FTM, SysTick (time base)
+ *          - 4          : LPUART, LPSPI, LPI2C
+ *          - 5          : CAN bus-off / error, DMA error, FTFC, PORT, RTC
+ *          - 15         : SVCall, PendSV
+ * @{
+ */
+
+/** @brief BASEPRI ceiling of NVIC_EnterCritical() (1..15, 0 would mask nothing) */
+#ifndef NVIC_CRITICAL_CEILING
+#define NVIC_CRITICAL_CEILING   (1U)
+#endif
+
+#if (NVIC_CRITICAL_CEILING == 0U) || (NVIC_CRITICAL_CEILING > NVIC_PRIORITY_MIN)
+#error "NVIC_CRITICAL_CEILING must be 1..15"
+#endif
+
+/** @brief NVIC_EnterCritical() state flag: section masked with PRIMASK (plan not applied) */
+#define NVIC_CRITICAL_PRIMASK   (0x100U)
+
+#ifndef NVIC_PRIO_WDOG
+#define NVIC_PRIO_WDOG          (0U)    /**< WDOG_EWM (handler touches no driver state) */
+#endif
+
+#ifndef NVIC_PRIO_CAN_MB
+#define NVIC_PRIO_CAN_MB        (1U)    /**< CANx_ORed_0_15_MB / 16_31_MB */
+#endif
+
+#ifndef NVIC_PRIO_ADC
+#define NVIC_PRIO_ADC           (2U)    /**< ADC0, ADC1 */
+#endif
+
+#ifndef NVIC_PRIO_PDB
+#define NVIC_PRIO_PDB           (2U)    /**< PDB0, PDB1 */
+#endif
+
+#ifndef NVIC_PRIO_CMP
+#define NVIC_PRIO_CMP           (2U)    /**< CMP0 threshold edge */
+#endif
+
+#ifndef NVIC_PRIO_DMA
+#define NVIC_PRIO_DMA           (2U)    /**< DMA0..DMA15 */
+#endif
+
+#ifndef NVIC_PRIO_LPIT
+#define NVIC_PRIO_LPIT          (3U)    /**< LPIT0 channel 0..3 */
+#endif
+
+#ifndef NVIC_PRIO_LPTMR
+#define NVIC_PRIO_LPTMR         (3U)    /**< LPTMR0 compare (low-power wakeup) */
+#endif
+
+#ifndef NVIC_PRIO_FTM
+#define NVIC_PRIO_FTM           (3U)    /**< FTM0..3 channel, overflow, fault */
+#endif
+
+#ifndef NVIC_PRIO_SYSTICK
+#define NVIC_PRIO_SYSTICK       (3U)
+#endif
+
+#ifndef NVIC_PRIO_UART
+#define NVIC_PRIO_UART          (4U)    /**< LPUART0..2 */
+#endif
+
+#ifndef NVIC_PRIO_SPI
+#define NVIC_PRIO_SPI           (4U)    /**< LPSPI0..2 */
+#endif
+
+#ifndef NVIC_PRIO_I2C
+#define NVIC_PRIO_I2C           (4U)    /**< LPI2C0 master / slave */
+#endif
+
+#ifndef NVIC_PRIO_CAN_STATUS
+#define NVIC_PRIO_CAN_STATUS    (5U)    /**< CANx_ORed (bus-off), CANx_Error, CAN0_Wake_Up */
+#endif
+
+#ifndef NVIC_PRIO_DMA_ERROR
+#define NVIC_PRIO_DMA_ERROR     (5U)
+#endif
+
+#ifndef NVIC_PRIO_FTFC
+#define NVIC_PRIO_FTFC          (5U)    /**< FTFC command complete (flash, EEE, CSEc) */
+#endif
+
+#ifndef NVIC_PRIO_PORT
+#define NVIC_PRIO_PORT          (5U)    /**< PORTA..PORTE pin detect */
+#endif
+
+#ifndef NVIC_PRIO_RTC
+#define NVIC_PRIO_RTC           (5U)    /**< RTC alarm / seconds */
+#endif
+
+#ifndef NVIC_PRIO_SVCALL
+#define NVIC_PRIO_SVCALL        (15U)
+#endif
+
+#ifndef NVIC_PRIO_PENDSV
+#define NVIC_PRIO_PENDSV        (15U)
+#endif
+
+/**
+ * @brief Priority table entry
+ * @details Core exceptions with a configurable priority (MemoryManagement_IRQn
+ *          .. SysTick_IRQn) are accepted as well.
+ */
+typedef struct {
+    IRQn_Type irq;                  /**< Interrupt or core exception */
+    uint8_t priority;               /**< 0-15, 0 = highest */
+} nvic_priority_entry_t;
+
+/** @} */ /* End of NVIC_Priority_Plan */
+
 /*******************************************************************************
  * API Functions
  ******************************************************************************/
@@ -338,11 +535,119 @@ uint32_t NVIC_DisableGlobalIRQ(void);
  */
 void NVIC_EnableGlobalIRQ(uint32_t primask);
 
+/**
+ * @brief Set by a successful NVIC_ApplyPriorityPlan(), selects the BASEPRI
+ *        path of NVIC_EnterCritical() (read only, do not write)
+ */
+extern bool g_nvicPriorityPlanApplied;
+
+/**
+ * @brief Enter a critical section below the priority ceiling
+ * @details Raises BASEPRI to NVIC_CRITICAL_CEILING (never lowers it, so
+ *          sections nest and can be entered from any handler). Interrupts
+ *          above the ceiling are not delayed.
+ *
+ * @return State to pass to NVIC_ExitCritical(): previous BASEPRI, or
+ *         NVIC_CRITICAL_PRIMASK | previous PRIMASK while the priority plan
+ *         has not been applied (every interrupt still at reset priority 0)
+ *
+ * @note Cortex-M4 r0p1 erratum 837070: the BASEPRI write is done with
+ *       PRIMASK set, so no interrupt below the new ceiling can slip in
+ *       right after it.
+ *
+ * @code
+ * uint32_t basepri = NVIC_EnterCritical();
+ * // Critical section
+ * NVIC_ExitCritical(basepri);
+ * @endcode
+ */
+#if (HAL_HOST_BUILD == 1U)
+static inline uint32_t NVIC_EnterCritical(void)
+{
+    /* Host build (tools/host_bench): no interrupts to mask */
+    __sync_synchronize();
+
+    return 0U;
+}
+#else
+static inline uint32_t NVIC_EnterCritical(void)
+{
+    uint32_t basepri;
+    uint32_t primask;
+
+    __asm volatile ("mrs %0, primask" : "=r" (primask));
+
+    /* Reset priorities: a BASEPRI ceiling would mask nothing */
+    if (!g_nvicPriorityPlanApplied) {
+        __asm volatile ("cpsid i" : : : "memory");
+        return NVIC_CRITICAL_PRIMASK | primask;
+    }
+
+    __asm volatile ("mrs %0, basepri" : "=r" (basepri));
+    __asm volatile ("cpsid i\n\t"
+                    "msr basepri_max, %0\n\t"
+                    "dsb\n\t"
+                    "isb"
+                    : : "r" (NVIC_CRITICAL_CEILING << (8U - NVIC_PRIO_BITS)) : "memory");
+    __asm volatile ("msr primask, %0" : : "r" (primask) : "memory");
+
+    return basepri;
+}
+#endif /* HAL_HOST_BUILD */
+
+/**
+ * @brief Leave a critical section entered with NVIC_EnterCritical()
+ *
+ * @param[in] basepri Value returned by NVIC_EnterCritical()
+ */
+#if (HAL_HOST_BUILD == 1U)
+static inline void NVIC_ExitCritical(uint32_t basepri)
+{
+    (void)basepri;
+    __sync_synchronize();
+}
+#else
+static inline void NVIC_ExitCritical(uint32_t basepri)
+{
+    if ((basepri & NVIC_CRITICAL_PRIMASK) != 0U) {
+        __asm volatile ("msr primask, %0" : : "r" (basepri & 1U) : "memory");
+    } else {
+        __asm volatile ("msr basepri, %0" : : "r" (basepri) : "memory");
+    }
+}
+#endif /* HAL_HOST_BUILD */
+
+/**
+ * @brief Apply a priority table
+ * @details Entries are written in order, a later entry for the same
+ *          interrupt wins.
+ *
+ * @param[in] table Priority entries
+ * @param[in] count Number of entries
+ *
+ * @return nvic_status_t
+ *         - NVIC_STATUS_SUCCESS: All entries applied
+ *         - NVIC_STATUS_INVALID_PARAM: NULL table, or an entry with an invalid
+ *           interrupt / priority (the other entries are still applied)
+ */
+nvic_status_t NVIC_ApplyPriorityTable(const nvic_priority_entry_t *table, uint32_t count);
+
+/**
+ * @brief Apply the default priority plan (NVIC_PRIO_x) to all HAL interrupts
+ * @details Call once at init, before the interrupts are enabled. On success
+ *          NVIC_EnterCritical() switches from PRIMASK to the BASEPRI ceiling.
+ *
+ * @return nvic_status_t
+ *         - NVIC_STATUS_SUCCESS: Plan applied
+ *         - NVIC_STATUS_INVALID_PARAM: An NVIC_PRIO_x override is out of range
+ */
+nvic_status_t NVIC_ApplyPriorityPlan(void);
+
 /**
  * @brief Set vector table offset
  * @details Change address of vector table
  * 
- * @param[in] offset Vector table offset address (must be aligned to 128 bytes)
+ * @param[in] offset Vector table offset address (must be aligned to NVIC_VTOR_ALIGNMENT)
  * 
  * @return nvic_status_t
  *         - NVIC_STATUS_SUCCESS: Vector table offset set
@@ -364,6 +669,55 @@ nvic_status_t NVIC_SetVectorTable(uint32_t offset);
  */
 nvic_status_t NVIC_GetVectorTable(uint32_t *offset);
 
+/**
+ * @brief Move the vector table to SRAM
+ * @details Copies the active table (flash or bootloader) into the driver
+ *          RAM table and points VTOR at it, with interrupts masked. Does
+ *          nothing if VTOR already points into SRAM.
+ * 
+ * @return nvic_status_t
+ *         - NVIC_STATUS_SUCCESS: VTOR points to a RAM table
+ *         - NVIC_STATUS_ERROR: Built with NVIC_RAM_VECTORS_ENABLE = 0
+ * 
+ * @note Called by NVIC_InstallHandler() on first use; call it early in
+ *       main() to keep the copy out of a time-critical path
+ */
+nvic_status_t NVIC_InitRamVectorTable(void);
+
+/**
+ * @brief Install an interrupt or exception handler in the RAM vector table
+ * @details The handler is entered directly by the hardware: no weak
+ *          wrapper, no callback pointer check. Handlers can be swapped at
+ *          runtime; the pending / enable state of the IRQ is not touched.
+ * 
+ * @param[in] IRQn    Interrupt number (NonMaskableInt_IRQn .. FTM3_Ovf_Reload_IRQn)
+ * @param[in] handler Handler function
+ * 
+ * @return nvic_status_t
+ *         - NVIC_STATUS_SUCCESS: Handler installed
+ *         - NVIC_STATUS_INVALID_PARAM: Invalid IRQ number or NULL handler
+ *         - NVIC_STATUS_ERROR: No RAM vector table
+ * 
+ * @code
+ * static void Lpit0Ch0Handler(void)
+ * {
+ *     LPIT0->MSR = LPIT_MSR_TIF0_MASK;
+ *     // ...
+ * }
+ * 
+ * NVIC_InstallHandler(LPIT0_Ch0_IRQn, Lpit0Ch0Handler);
+ * NVIC_EnableIRQ(LPIT0_Ch0_IRQn);
+ * @endcode
+ */
+nvic_status_t NVIC_InstallHandler(IRQn_Type IRQn, nvic_handler_t handler);
+
+/**
+ * @brief Get the handler currently in the active vector table
+ * @param[in] IRQn Interrupt number
+ * @return nvic_handler_t Handler, NULL if IRQn is invalid
+ */
+nvic_handler_t NVIC_GetHandler(IRQn_Type IRQn);
+
 /**
  * @brief Wait for interrupt
  * @details Enter sleep mode and wait for interrupt
@@ -399,4 +753,23 @@ nvic_status_t NVIC_EnableFaultHandlers(bool enableUsageFault,
                                    bool enableBusFault,
                                    bool enableMemManageFault);
 
+/**
+ * @brief Install ISR entry hook (instrumentation mode)
+ * @details Hook is called from NVIC_TRACE_ISR_ENTRY() in handler context,
+ *          keep it to a few register reads.
+ * 
+ * @param[in] hook Hook function, NULL to remove
+ * 
+ * @note Only has an effect when built with NVIC_ISR_TRACE_ENABLE = 1
+ */
+void NVIC_InstallEntryHook(nvic_entry_hook_t hook);
+
+/**
+ * @brief Report ISR entry to the installed hook
+ * @details Called via NVIC_TRACE_ISR_ENTRY() at the top of HAL handlers
+ * 
+ * @param[in] IRQn Interrupt being serviced
+ */
+HAL_RAMFUNC void NVIC_TraceIsrEntry(IRQn_Type IRQn);
+
 #endif /* NVIC_H */
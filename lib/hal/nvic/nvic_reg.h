@@ -217,6 +217,11 @@ typedef struct {
 #define SCB_AIRCR_PRIGROUP_MASK     (0x00000700UL)
 #define SCB_AIRCR_PRIGROUP_SHIFT    (8U)
 
+/* SCR Register */
+#define SCB_SCR_SLEEPONEXIT_MASK    (0x00000002UL)
+#define SCB_SCR_SLEEPDEEP_MASK      (0x00000004UL)
+#define SCB_SCR_SEVONPEND_MASK      (0x00000010UL)
+
 /* ICSR Register */
 #define SCB_ICSR_PENDSVSET_MASK     (0x10000000UL)
 #define SCB_ICSR_PENDSVCLR_MASK     (0x08000000UL)
@@ -0,0 +1,317 @@
+/**
+ * @file    osal.c
+ * @brief   OS abstraction layer implementation (bare-metal / FreeRTOS)
+ * @details Events map to indexed task notifications, mutexes to static
+ *          recursive mutexes. The tickless idle hook replaces SysTick with
+ *          a one-shot LPIT channel while the kernel is idle.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ *
+ * @par Change Log:
+ * - Version 1.0 (Oct 14, 2026): Initial version
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "osal.h"
+#include "nvic.h"
+#if OSAL_FREERTOS && OSAL_TICKLESS_LPIT
+#include "lpit.h"
+#include "systick.h"
+#endif
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+
+#if OSAL_FREERTOS
+
+#if (configTASK_NOTIFICATION_ARRAY_ENTRIES <= OSAL_NOTIFY_INDEX)
+#error "configTASK_NOTIFICATION_ARRAY_ENTRIES must be > OSAL_NOTIFY_INDEX"
+#endif
+
+#if (configSUPPORT_STATIC_ALLOCATION != 1) || (configUSE_RECURSIVE_MUTEXES != 1)
+#error "OSAL needs configSUPPORT_STATIC_ALLOCATION and configUSE_RECURSIVE_MUTEXES"
+#endif
+
+/* NVIC priority of an ISR that calls ...FromISR(), as written to NVIC_IPR */
+#define OSAL_NVIC_PRIO(prio)        ((prio) << (8U - NVIC_PRIO_BITS))
+
+#if (OSAL_NVIC_PRIO(NVIC_PRIO_CAN_MB) < configMAX_SYSCALL_INTERRUPT_PRIORITY) || \
+    (OSAL_NVIC_PRIO(NVIC_PRIO_UART) < configMAX_SYSCALL_INTERRUPT_PRIORITY) || \
+    (OSAL_NVIC_PRIO(NVIC_PRIO_I2C) < configMAX_SYSCALL_INTERRUPT_PRIORITY)
+#error "NVIC_PRIO_CAN_MB / UART / I2C must not be above configMAX_SYSCALL_INTERRUPT_PRIORITY"
+#endif
+
+#if OSAL_TICKLESS_LPIT
+#if (configUSE_TICKLESS_IDLE != 2)
+#error "OSAL_TICKLESS_LPIT needs configUSE_TICKLESS_IDLE 2"
+#endif
+
+#define OSAL_TICKLESS_IRQ       ((IRQn_Type)((uint32_t)LPIT0_Ch0_IRQn + OSAL_TICKLESS_LPIT_CHANNEL))
+#endif
+
+#endif /* OSAL_FREERTOS */
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+
+#if OSAL_FREERTOS && OSAL_TICKLESS_LPIT
+/* LPIT counts per kernel tick, 0 until OSAL_TicklessInit() */
+static uint32_t s_lpitPerTick = 0U;
+#endif
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+#if OSAL_FREERTOS
+static TickType_t OSAL_MsToTicks(uint32_t timeoutMs)
+{
+    if (timeoutMs == OSAL_WAIT_FOREVER) {
+        return portMAX_DELAY;
+    }
+
+    /* Round up: a 1 ms wait on a 10 ms tick still sleeps one tick */
+    return (TickType_t)((((uint64_t)timeoutMs * configTICK_RATE_HZ) + 999U) / 1000U);
+}
+#endif
+
+/*******************************************************************************
+ * Events
+ ******************************************************************************/
+
+#if OSAL_FREERTOS
+
+void OSAL_EventArm(osal_event_t *event)
+{
+    /* Drop a notification left over from an earlier timed-out wait */
+    (void)ulTaskNotifyTakeIndexed(OSAL_NOTIFY_INDEX, pdTRUE, 0U);
+    event->task = xTaskGetCurrentTaskHandle();
+}
+
+osal_status_t OSAL_EventWait(osal_event_t *event, uint32_t timeoutMs)
+{
+    uint32_t notified;
+
+    notified = ulTaskNotifyTakeIndexed(OSAL_NOTIFY_INDEX, pdTRUE, OSAL_MsToTicks(timeoutMs));
+
+    /* Timed out: an ISR that runs later must not notify this task */
+    event->task = NULL;
+
+    return (notified != 0U) ? OSAL_STATUS_SUCCESS : OSAL_STATUS_TIMEOUT;
+}
+
+void OSAL_EventSignalFromIsr(osal_event_t *event)
+{
+    BaseType_t woken = pdFALSE;
+    TaskHandle_t task = event->task;
+
+    if (task != NULL) {
+        event->task = NULL;
+        vTaskNotifyGiveIndexedFromISR(task, OSAL_NOTIFY_INDEX, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
+}
+
+#else
+
+void OSAL_EventArm(osal_event_t *event)
+{
+    event->pending = 0U;
+}
+
+osal_status_t OSAL_EventWait(osal_event_t *event, uint32_t timeoutMs)
+{
+    uint32_t loops = timeoutMs * OSAL_BM_LOOPS_PER_MS;
+
+    while (event->pending == 0U) {
+        if (timeoutMs != OSAL_WAIT_FOREVER) {
+            if (loops == 0U) {
+                return OSAL_STATUS_TIMEOUT;
+            }
+            loops--;
+        }
+    }
+
+    event->pending = 0U;
+
+    return OSAL_STATUS_SUCCESS;
+}
+
+void OSAL_EventSignalFromIsr(osal_event_t *event)
+{
+    event->pending = 1U;
+}
+
+#endif /* OSAL_FREERTOS */
+
+/*******************************************************************************
+ * Mutexes
+ ******************************************************************************/
+
+#if OSAL_FREERTOS
+
+osal_status_t OSAL_MutexInit(osal_mutex_t *mutex)
+{
+    if (mutex == NULL) {
+        return OSAL_STATUS_ERROR;
+    }
+
+    /* No NVIC critical section here: the kernel's own exit would clear BASEPRI */
+    if (mutex->handle == NULL) {
+        mutex->handle = xSemaphoreCreateRecursiveMutexStatic(&mutex->storage);
+    }
+
+    return (mutex->handle != NULL) ? OSAL_STATUS_SUCCESS : OSAL_STATUS_ERROR;
+}
+
+osal_status_t OSAL_MutexLock(osal_mutex_t *mutex, uint32_t timeoutMs)
+{
+    if ((mutex == NULL) || (mutex->handle == NULL)) {
+        return OSAL_STATUS_ERROR;
+    }
+
+    if (!OSAL_CanBlock()) {
+        return OSAL_STATUS_SUCCESS;
+    }
+
+    return (xSemaphoreTakeRecursive(mutex->handle, OSAL_MsToTicks(timeoutMs)) == pdTRUE) ?
+           OSAL_STATUS_SUCCESS : OSAL_STATUS_TIMEOUT;
+}
+
+void OSAL_MutexUnlock(osal_mutex_t *mutex)
+{
+    if ((mutex != NULL) && (mutex->handle != NULL) && OSAL_CanBlock()) {
+        (void)xSemaphoreGiveRecursive(mutex->handle);
+    }
+}
+
+#else
+
+osal_status_t OSAL_MutexInit(osal_mutex_t *mutex)
+{
+    return (mutex != NULL) ? OSAL_STATUS_SUCCESS : OSAL_STATUS_ERROR;
+}
+
+osal_status_t OSAL_MutexLock(osal_mutex_t *mutex, uint32_t timeoutMs)
+{
+    (void)timeoutMs;
+
+    return (mutex != NULL) ? OSAL_STATUS_SUCCESS : OSAL_STATUS_ERROR;
+}
+
+void OSAL_MutexUnlock(osal_mutex_t *mutex)
+{
+    (void)mutex;
+}
+
+#endif /* OSAL_FREERTOS */
+
+/*******************************************************************************
+ * Tickless Idle
+ ******************************************************************************/
+
+#if OSAL_FREERTOS && OSAL_TICKLESS_LPIT
+
+osal_status_t OSAL_TicklessInit(void)
+{
+    lpit_channel_config_t config = {
+        .channel = OSAL_TICKLESS_LPIT_CHANNEL,
+        .mode = LPIT_MODE_32BIT_PERIODIC,
+        .period = 0U,
+        .enableInterrupt = true,
+        .chainChannel = false,
+        .startOnTrigger = false,
+        .stopOnInterrupt = true,
+        .reloadOnTrigger = false
+    };
+
+    s_lpitPerTick = LPIT_GetClockFreq() / configTICK_RATE_HZ;
+    if (s_lpitPerTick == 0U) {
+        return OSAL_STATUS_ERROR;
+    }
+
+    config.period = s_lpitPerTick - 1U;
+    if (LPIT_ConfigChannel(&config) != STATUS_SUCCESS) {
+        s_lpitPerTick = 0U;
+        return OSAL_STATUS_ERROR;
+    }
+
+    /* Wakeup only: flag and pending bit are cleared before PRIMASK is released */
+    (void)NVIC_SetPriority(OSAL_TICKLESS_IRQ, NVIC_PRIO_LPIT);
+    (void)NVIC_EnableIRQ(OSAL_TICKLESS_IRQ);
+
+    return OSAL_STATUS_SUCCESS;
+}
+
+void vPortSuppressTicksAndSleep(TickType_t xExpectedIdleTime)
+{
+    uint32_t maxIdle;
+    uint32_t reload;
+    uint32_t remaining = 0U;
+    uint32_t elapsed;
+    bool expired;
+
+    if (s_lpitPerTick == 0U) {
+        return;
+    }
+
+    maxIdle = 0xFFFFFFFFUL / s_lpitPerTick;
+    if (xExpectedIdleTime > maxIdle) {
+        xExpectedIdleTime = maxIdle;
+    }
+
+    /* PRIMASK, not BASEPRI: every interrupt must still wake up the WFI */
+    __asm volatile ("cpsid i" ::: "memory");
+    __asm volatile ("dsb");
+    __asm volatile ("isb");
+
+    if (eTaskConfirmSleepModeStatus() == eAbortSleep) {
+        __asm volatile ("cpsie i" ::: "memory");
+        return;
+    }
+
+    SYSTICK_Stop();
+
+    reload = ((uint32_t)xExpectedIdleTime * s_lpitPerTick) - 1U;
+    (void)LPIT_SetPeriod(OSAL_TICKLESS_LPIT_CHANNEL, reload);
+    (void)LPIT_ClearInterruptFlag(OSAL_TICKLESS_LPIT_CHANNEL);
+    (void)LPIT_StartChannel(OSAL_TICKLESS_LPIT_CHANNEL);
+
+    configPRE_SLEEP_PROCESSING(xExpectedIdleTime);
+    if (xExpectedIdleTime > 0U) {
+        __asm volatile ("dsb" ::: "memory");
+        __asm volatile ("wfi");
+        __asm volatile ("isb");
+    }
+    configPOST_SLEEP_PROCESSING(xExpectedIdleTime);
+
+    /* Read the counter before the channel is stopped */
+    (void)LPIT_GetCurrentValue(OSAL_TICKLESS_LPIT_CHANNEL, &remaining);
+    expired = LPIT_GetInterruptFlag(OSAL_TICKLESS_LPIT_CHANNEL);
+    (void)LPIT_StopChannel(OSAL_TICKLESS_LPIT_CHANNEL);
+    (void)LPIT_ClearInterruptFlag(OSAL_TICKLESS_LPIT_CHANNEL);
+    (void)NVIC_ClearPendingIRQ(OSAL_TICKLESS_IRQ);
+
+    if (expired) {
+        elapsed = (uint32_t)xExpectedIdleTime;
+    } else {
+        /* Woken early by another interrupt: count whole ticks only */
+        elapsed = (reload - remaining) / s_lpitPerTick;
+    }
+
+    vTaskStepTick((TickType_t)elapsed);
+
+    /* The partial tick is dropped: SysTick restarts a full period */
+    SYSTICK_Reset();
+    SYSTICK_Start();
+
+    __asm volatile ("cpsie i" ::: "memory");
+}
+
+#endif /* OSAL_FREERTOS && OSAL_TICKLESS_LPIT */
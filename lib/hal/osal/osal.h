@@ -0,0 +1,262 @@
+/**
+ * @file    osal.h
+ * @brief   OS abstraction layer for the S32K144 HAL (bare-metal / FreeRTOS)
+ * @details
+ * Small set of primitives the drivers need to be used from several tasks:
+ * - Events: one task waits, an ISR signals (FreeRTOS direct-to-task
+ *   notification, no kernel object per event)
+ * - Mutexes: recursive, priority inheritance, statically allocated
+ * - Tickless idle: vPortSuppressTicksAndSleep() on an LPIT channel, so the
+ *   core can sleep for several ticks without SysTick
+ *
+ * With OSAL_FREERTOS = 0 (default) the drivers compile exactly as before:
+ * their OSAL hooks are removed by the preprocessor, blocking calls poll.
+ * The primitives below still build (events poll a flag, mutexes are no-ops)
+ * for portable application code.
+ *
+ * With OSAL_FREERTOS = 1:
+ * - UART_SendBlocking() / UART_ReceiveBlocking() lock a per-direction
+ *   mutex; with UART_EnableAsync() done they sleep on the ring ISR instead
+ *   of polling
+ * - I2C_MasterLockBus() / I2C_MasterUnlockBus() serialise master
+ *   sequences; I2C_MasterTransferBlocking() sleeps until the async engine
+ *   completes the descriptor
+ * - CAN_SendBlocking() / CAN_ReceiveBlocking() sleep on the Message Buffer
+ *   interrupt
+ * Calls made before vTaskStartScheduler() or from an ISR keep polling.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ *
+ * @note
+ * - FreeRTOSConfig.h: configSUPPORT_STATIC_ALLOCATION 1,
+ *   configUSE_RECURSIVE_MUTEXES 1, INCLUDE_xTaskGetSchedulerState 1,
+ *   INCLUDE_xTaskGetCurrentTaskHandle 1 and
+ *   configTASK_NOTIFICATION_ARRAY_ENTRIES > OSAL_NOTIFY_INDEX
+ * - Every ISR that signals an event (LPUART, LPI2C master, CAN MB vectors)
+ *   must have a priority numerically >= configMAX_SYSCALL_INTERRUPT_PRIORITY;
+ *   osal.c checks the NVIC_PRIO_x plan against it at compile time
+ * - Tickless idle: configUSE_TICKLESS_IDLE 2, LPIT_Init() done, then
+ *   OSAL_TicklessInit() before vTaskStartScheduler()
+ *
+ * @par Change Log:
+ * - Version 1.0 (14/10/2026): Initial OSAL (events, mutexes, LPIT tickless idle)
+ */
+
+#ifndef OSAL_H
+#define OSAL_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "def_reg.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @defgroup OSAL_Definitions OSAL Definitions
+ * @{
+ */
+
+/** @brief Build the drivers on top of FreeRTOS (0 = bare-metal) */
+#ifndef OSAL_FREERTOS
+#define OSAL_FREERTOS               (0U)
+#endif
+
+/** @brief Task notification index used by OSAL events (FreeRTOS >= 10.4) */
+#ifndef OSAL_NOTIFY_INDEX
+#define OSAL_NOTIFY_INDEX           (1U)
+#endif
+
+/** @brief Provide vPortSuppressTicksAndSleep() on an LPIT channel */
+#ifndef OSAL_TICKLESS_LPIT
+#define OSAL_TICKLESS_LPIT          (0U)
+#endif
+
+/** @brief LPIT channel reserved for tickless idle */
+#ifndef OSAL_TICKLESS_LPIT_CHANNEL
+#define OSAL_TICKLESS_LPIT_CHANNEL  (3U)
+#endif
+
+/** @brief Bare-metal event wait: poll iterations per millisecond */
+#ifndef OSAL_BM_LOOPS_PER_MS
+#define OSAL_BM_LOOPS_PER_MS        (8000U)
+#endif
+
+/** @brief Timeout value: wait forever */
+#define OSAL_WAIT_FOREVER           (0xFFFFFFFFUL)
+
+/** @brief Status return type (values match status_t) */
+typedef enum {
+    OSAL_STATUS_SUCCESS = 0x00U,        /**< Operation successful */
+    OSAL_STATUS_ERROR = 0x01U,          /**< Invalid object / kernel error */
+    OSAL_STATUS_TIMEOUT = 0x03U         /**< Not signalled / not acquired in time */
+} osal_status_t;
+
+/** @} */
+
+#if OSAL_FREERTOS
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#endif
+
+/*******************************************************************************
+ * Type Definitions
+ ******************************************************************************/
+
+#if OSAL_FREERTOS
+
+/**
+ * @brief ISR-to-task event
+ * @details Holds the waiting task between OSAL_EventArm() and the signal;
+ *          NULL while nobody waits, so a late ISR signal is dropped.
+ */
+typedef struct {
+    TaskHandle_t volatile task;     /**< Waiting task */
+} osal_event_t;
+
+/**
+ * @brief Recursive mutex with static storage
+ */
+typedef struct {
+    SemaphoreHandle_t handle;       /**< NULL until OSAL_MutexInit() */
+    StaticSemaphore_t storage;      /**< Kernel object storage */
+} osal_mutex_t;
+
+#else
+
+/** @brief ISR-to-task event (bare-metal: pending flag) */
+typedef struct {
+    volatile uint32_t pending;      /**< Set by OSAL_EventSignalFromIsr() */
+} osal_event_t;
+
+/** @brief Mutex (bare-metal: single thread, no state) */
+typedef struct {
+    uint8_t reserved;
+} osal_mutex_t;
+
+#endif /* OSAL_FREERTOS */
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/**
+ * @brief Check if the caller may block on an OSAL object
+ *
+ * @return true in a task with the scheduler running, false before the
+ *         scheduler starts, in an ISR, or without an RTOS
+ */
+#if OSAL_FREERTOS
+static inline bool OSAL_CanBlock(void)
+{
+    uint32_t ipsr;
+
+    __asm volatile ("mrs %0, ipsr" : "=r" (ipsr));
+
+    return (ipsr == 0U) && (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING);
+}
+#else
+static inline bool OSAL_CanBlock(void)
+{
+    return false;
+}
+#endif
+
+/**
+ * @brief Arm an event for the calling task
+ * @details Call before starting the operation whose ISR signals the event,
+ *          so a completion that fires before OSAL_EventWait() is not lost.
+ *
+ * @param[in] event  Event object
+ */
+void OSAL_EventArm(osal_event_t *event);
+
+/**
+ * @brief Wait for an armed event
+ *
+ * @param[in] event      Event armed by the calling task
+ * @param[in] timeoutMs  Timeout in ms, OSAL_WAIT_FOREVER to wait forever
+ *
+ * @return OSAL_STATUS_SUCCESS if signalled, OSAL_STATUS_TIMEOUT otherwise (the event
+ *         is disarmed in both cases)
+ */
+osal_status_t OSAL_EventWait(osal_event_t *event, uint32_t timeoutMs);
+
+/**
+ * @brief Signal an event from an ISR
+ * @details No effect when no task is armed. Requests a context switch on
+ *          ISR exit if the woken task has a higher priority.
+ *
+ * @param[in] event  Event object
+ */
+HAL_RAMFUNC void OSAL_EventSignalFromIsr(osal_event_t *event);
+
+/**
+ * @brief Create a mutex (idempotent)
+ * @details Safe to call again from a driver re-init; the kernel object is
+ *          created once. May be called before the scheduler starts, but
+ *          not for the same object from two tasks at once.
+ *
+ * @param[in] mutex  Mutex object
+ *
+ * @return OSAL_STATUS_SUCCESS, OSAL_STATUS_ERROR if the kernel object cannot be created
+ */
+osal_status_t OSAL_MutexInit(osal_mutex_t *mutex);
+
+/**
+ * @brief Lock a mutex (recursive)
+ * @details Returns OSAL_STATUS_SUCCESS at once when the caller cannot block
+ *          (see OSAL_CanBlock()): before the scheduler starts there is
+ *          only one thread of execution.
+ *
+ * @param[in] mutex      Mutex object
+ * @param[in] timeoutMs  Timeout in ms, OSAL_WAIT_FOREVER to wait forever
+ *
+ * @return OSAL_STATUS_SUCCESS, OSAL_STATUS_TIMEOUT if held by another task
+ */
+osal_status_t OSAL_MutexLock(osal_mutex_t *mutex, uint32_t timeoutMs);
+
+/**
+ * @brief Unlock a mutex locked by OSAL_MutexLock()
+ *
+ * @param[in] mutex  Mutex object
+ */
+void OSAL_MutexUnlock(osal_mutex_t *mutex);
+
+#if OSAL_FREERTOS && OSAL_TICKLESS_LPIT
+/**
+ * @brief Configure OSAL_TICKLESS_LPIT_CHANNEL for tickless idle
+ * @details One-shot wakeup timer: interrupt enabled, started / stopped by
+ *          vPortSuppressTicksAndSleep(). The LPIT clock must keep running
+ *          in the sleep mode selected by configPRE_SLEEP_PROCESSING (SIRC /
+ *          LPO source and LPIT_SetDozeEnable(true) for VLPS).
+ *
+ * @return OSAL_STATUS_SUCCESS, OSAL_STATUS_ERROR if LPIT is not initialised or its
+ *         clock is slower than configTICK_RATE_HZ
+ *
+ * @code
+ * LPIT_Init(LPIT_CLK_SRC_SIRC);
+ * OSAL_TicklessInit();
+ * vTaskStartScheduler();
+ * @endcode
+ */
+osal_status_t OSAL_TicklessInit(void);
+
+/**
+ * @brief FreeRTOS tickless idle hook (configUSE_TICKLESS_IDLE 2)
+ * @details Stops SysTick, sleeps until the LPIT one-shot or any other
+ *          interrupt, then steps the kernel tick by the elapsed time.
+ *
+ * @param[in] xExpectedIdleTime  Ticks until the next task unblocks
+ */
+void vPortSuppressTicksAndSleep(TickType_t xExpectedIdleTime);
+#endif
+
+#endif /* OSAL_H */
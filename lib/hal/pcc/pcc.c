@@ -23,6 +23,7 @@
 #include "pcc_reg.h"
 #include "scg.h"
 #include "scg_reg.h"
+#include "nvic.h"
 #include <stddef.h>
 
 /*******************************************************************************
@@ -32,11 +33,35 @@
 /* Maximum peripheral index */
 #define PCC_MAX_PERIPHERAL_INDEX    (PCC_PCCn_COUNT - 1U)
 
+/* DIV2 cache slots */
+#define PCC_DIV2_SOSC               (0U)
+#define PCC_DIV2_SIRC               (1U)
+#define PCC_DIV2_FIRC               (2U)
+#define PCC_DIV2_SPLL               (3U)
+#define PCC_DIV2_COUNT              (4U)
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+
+/** @brief SCG DIV2 output frequencies (Hz) */
+static uint32_t s_div2Freq[PCC_DIV2_COUNT];
+
+/** @brief SCG configuration generation the cache was computed from */
+static uint32_t s_div2Generation = 0U;
+
+/** @brief DIV2 cache valid flag */
+static volatile bool s_div2CacheValid = false;
+
+/** @brief Clock references per PCC register (PCC_AcquirePeripheralClock) */
+static uint8_t s_clockRefCount[PCC_PCCn_COUNT];
+
 /*******************************************************************************
  * Private Function Prototypes
  ******************************************************************************/
 
 static bool PCC_IsValidPeripheralIndex(uint8_t peripheral);
+static uint32_t PCC_GetDiv2Freq(uint32_t slot);
 
 /*******************************************************************************
  * Private Functions
@@ -50,6 +75,49 @@ static bool PCC_IsValidPeripheralIndex(uint8_t peripheral)
     return (peripheral <= PCC_MAX_PERIPHERAL_INDEX);
 }
 
+/**
+ * @brief DIV2 output = source >> (DIV2 - 1), 0 if DIV2 disabled
+ */
+static uint32_t PCC_DecodeDiv2(uint32_t srcFreq, uint32_t div2)
+{
+    /* DIV2 value: 0=disabled, 1=/1, 2=/2, 3=/4, 4=/8, 5=/16, 6=/32, 7=/64 */
+    return (div2 == 0U) ? 0U : (srcFreq >> (div2 - 1U));
+}
+
+/**
+ * @brief Get a cached SCG DIV2 output frequency
+ * @details Recomputed from SCG only after PCC_InvalidateClockCache() or an
+ *          SCG_InitXxx() call (generation change). Refresh is idempotent,
+ *          so an ISR interrupting a refresh simply recomputes.
+ */
+static uint32_t PCC_GetDiv2Freq(uint32_t slot)
+{
+    scg_clock_frequencies_t freqs;
+    uint32_t generation = SCG_GetConfigGeneration();
+    
+    if (!s_div2CacheValid || (s_div2Generation != generation)) {
+        s_div2CacheValid = false;
+        
+        if (!SCG_GetClockFrequencies(&freqs)) {
+            return 0U;  /* SCG not properly initialized, retry next call */
+        }
+        
+        s_div2Freq[PCC_DIV2_SOSC] = PCC_DecodeDiv2(freqs.soscClk,
+            (SCG->SOSCDIV & SCG_SOSCDIV_SOSCDIV2_MASK) >> SCG_SOSCDIV_SOSCDIV2_SHIFT);
+        s_div2Freq[PCC_DIV2_SIRC] = PCC_DecodeDiv2(freqs.sircClk,
+            (SCG->SIRCDIV & SCG_SIRCDIV_SIRCDIV2_MASK) >> SCG_SIRCDIV_SIRCDIV2_SHIFT);
+        s_div2Freq[PCC_DIV2_FIRC] = PCC_DecodeDiv2(freqs.fircClk,
+            (SCG->FIRCDIV & SCG_FIRCDIV_FIRCDIV2_MASK) >> SCG_FIRCDIV_FIRCDIV2_SHIFT);
+        s_div2Freq[PCC_DIV2_SPLL] = PCC_DecodeDiv2(freqs.spllClk,
+            (SCG->SPLLDIV & SCG_SPLLDIV_SPLLDIV2_MASK) >> SCG_SPLLDIV_SPLLDIV2_SHIFT);
+        
+        s_div2Generation = generation;
+        s_div2CacheValid = true;
+    }
+    
+    return s_div2Freq[slot];
+}
+
 /*******************************************************************************
  * Public Functions
  ******************************************************************************/
@@ -129,6 +197,66 @@ bool PCC_DisablePeripheralClock(uint8_t peripheral)
     return true;
 }
 
+bool PCC_AcquirePeripheralClock(uint8_t peripheral)
+{
+    uint32_t basepri;
+    bool result = true;
+    
+    if (!PCC_IsValidPeripheralIndex(peripheral)) {
+        return false;
+    }
+    
+    /* Drivers also acquire / release from ISRs */
+    basepri = NVIC_EnterCritical();
+    
+    if (s_clockRefCount[peripheral] == 0xFFU) {
+        result = false;
+    } else {
+        if (s_clockRefCount[peripheral] == 0U) {
+            PCC->PCCn[peripheral] |= PCC_PCCn_CGC_MASK;
+        }
+        s_clockRefCount[peripheral]++;
+    }
+    
+    NVIC_ExitCritical(basepri);
+    
+    return result;
+}
+
+bool PCC_ReleasePeripheralClock(uint8_t peripheral)
+{
+    uint32_t basepri;
+    bool result = true;
+    
+    if (!PCC_IsValidPeripheralIndex(peripheral)) {
+        return false;
+    }
+    
+    basepri = NVIC_EnterCritical();
+    
+    if (s_clockRefCount[peripheral] == 0U) {
+        result = false;
+    } else {
+        s_clockRefCount[peripheral]--;
+        if (s_clockRefCount[peripheral] == 0U) {
+            PCC->PCCn[peripheral] &= ~PCC_PCCn_CGC_MASK;
+        }
+    }
+    
+    NVIC_ExitCritical(basepri);
+    
+    return result;
+}
+
+uint8_t PCC_GetPeripheralClockRefCount(uint8_t peripheral)
+{
+    if (!PCC_IsValidPeripheralIndex(peripheral)) {
+        return 0U;
+    }
+    
+    return s_clockRefCount[peripheral];
+}
+
 bool PCC_SetPeripheralClockSource(uint8_t peripheral, pcc_clock_source_t source)
 {
     if (!PCC_IsValidPeripheralIndex(peripheral)) {
@@ -276,15 +404,9 @@ uint32_t PCC_GetPeripheralClockFreq(uint8_t peripheral)
     pcc_clock_source_t source = PCC_GetPeripheralClockSource(peripheral);
     
     uint32_t sourceFreq = 0U;
-    scg_clock_frequencies_t freqs;
-    
-    /* Get actual frequencies from SCG module */
-    if (!SCG_GetClockFrequencies(&freqs)) {
-        return 0U;  /* SCG not properly initialized */
-    }
     
     /* Get source frequency based on PCC clock source selection */
-    /* PCC uses DIV2 outputs from SCG */
+    /* PCC uses DIV2 outputs from SCG (cached, 0 if SCG not initialized) */
     switch (source) {
         case PCC_CLK_SRC_SOSC_DIV2:
             /* SOSCDIV2 = SOSC / DIV2 (configured in SCG) */
@@ -333,75 +455,27 @@ uint32_t PCC_GetPeripheralClockFreq(uint8_t peripheral)
 
 uint32_t PCC_GetSoscDiv2Freq(void)
 {
-    scg_clock_frequencies_t freqs;
-    
-    if (!SCG_GetClockFrequencies(&freqs)) {
-        return 0U;
-    }
-    
-    /* Read SOSCDIV2 divider from SCG register */
-    uint32_t div2 = (SCG->SOSCDIV & SCG_SOSCDIV_SOSCDIV2_MASK) >> SCG_SOSCDIV_SOSCDIV2_SHIFT;
-    
-    if (div2 == 0U) {
-        return 0U;  /* DIV2 output disabled */
-    }
-    
-    /* DIV2 value: 0=disabled, 1=/1, 2=/2, 3=/4, 4=/8, 5=/16, 6=/32, 7=/64 */
-    return freqs.soscClk >> (div2 - 1U);
+    return PCC_GetDiv2Freq(PCC_DIV2_SOSC);
 }
 
 uint32_t PCC_GetSircDiv2Freq(void)
 {
-    scg_clock_frequencies_t freqs;
-    
-    if (!SCG_GetClockFrequencies(&freqs)) {
-        return 0U;
-    }
-    
-    /* Read SIRCDIV2 divider from SCG register */
-    uint32_t div2 = (SCG->SIRCDIV & SCG_SIRCDIV_SIRCDIV2_MASK) >> SCG_SIRCDIV_SIRCDIV2_SHIFT;
-    
-    if (div2 == 0U) {
-        return 0U;  /* DIV2 output disabled */
-    }
-    
-    return freqs.sircClk >> (div2 - 1U);
+    return PCC_GetDiv2Freq(PCC_DIV2_SIRC);
 }
 
 uint32_t PCC_GetFircDiv2Freq(void)
 {
-    scg_clock_frequencies_t freqs;
-    
-    if (!SCG_GetClockFrequencies(&freqs)) {
-        return 0U;
-    }
-    
-    /* Read FIRCDIV2 divider from SCG register */
-    uint32_t div2 = (SCG->FIRCDIV & SCG_FIRCDIV_FIRCDIV2_MASK) >> SCG_FIRCDIV_FIRCDIV2_SHIFT;
-    
-    if (div2 == 0U) {
-        return 0U;  /* DIV2 output disabled */
-    }
-    
-    return freqs.fircClk >> (div2 - 1U);
+    return PCC_GetDiv2Freq(PCC_DIV2_FIRC);
 }
 
 uint32_t PCC_GetSpllDiv2Freq(void)
 {
-    scg_clock_frequencies_t freqs;
-    
-    if (!SCG_GetClockFrequencies(&freqs)) {
-        return 0U;
-    }
-    
-    /* Read SPLLDIV2 divider from SCG register */
-    uint32_t div2 = (SCG->SPLLDIV & SCG_SPLLDIV_SPLLDIV2_MASK) >> SCG_SPLLDIV_SPLLDIV2_SHIFT;
-    
-    if (div2 == 0U) {
-        return 0U;  /* DIV2 output disabled */
-    }
-    
-    return freqs.spllClk >> (div2 - 1U);
+    return PCC_GetDiv2Freq(PCC_DIV2_SPLL);
+}
+
+void PCC_InvalidateClockCache(void)
+{
+    s_div2CacheValid = false;
 }
 
 /*******************************************************************************
@@ -114,6 +114,41 @@ bool PCC_EnablePeripheralClock(uint8_t peripheral);
  */
 bool PCC_DisablePeripheralClock(uint8_t peripheral);
 
+/**
+ * @brief Take a reference on a peripheral clock
+ * @param[in] peripheral Peripheral index (0-115)
+ * @return true if the clock is running, false if index invalid or count saturated
+ * 
+ * @note The first reference sets CGC, the last PCC_ReleasePeripheralClock()
+ *       clears it, so drivers can hold the function clock only around
+ *       activity (e.g. one I2C transfer burst). Configure PCS / PCD before
+ *       the first reference (they are writable only while CGC = 0).
+ * @note ISR-safe. Do not mix with PCC_Enable/DisablePeripheralClock() on
+ *       the same peripheral: a manual disable gates a clock other users hold.
+ * 
+ * @par Example:
+ * @code
+ * PCC_AcquirePeripheralClock(PCC_LPI2C0_INDEX);
+ * // ... register access ...
+ * PCC_ReleasePeripheralClock(PCC_LPI2C0_INDEX);   // gated if no other user
+ * @endcode
+ */
+bool PCC_AcquirePeripheralClock(uint8_t peripheral);
+
+/**
+ * @brief Drop a reference on a peripheral clock, gate it on the last one
+ * @param[in] peripheral Peripheral index (0-115)
+ * @return true if successful, false if index invalid or no reference held
+ */
+bool PCC_ReleasePeripheralClock(uint8_t peripheral);
+
+/**
+ * @brief Get number of references held on a peripheral clock
+ * @param[in] peripheral Peripheral index (0-115)
+ * @return Reference count, 0 if index invalid
+ */
+uint8_t PCC_GetPeripheralClockRefCount(uint8_t peripheral);
+
 /**
  * @brief Set peripheral clock source
  * @param[in] peripheral Peripheral index (0-115)
@@ -204,10 +239,16 @@ bool PCC_DisableCANClock(uint8_t instance);
  * Clock Frequency Query Functions (using SCG)
  ******************************************************************************/
 
+/*
+ * DIV2 frequencies are cached: recomputed after an SCG_InitXxx() call
+ * (SCG_GetConfigGeneration()) or PCC_InvalidateClockCache(), so the
+ * per-peripheral queries below cost one PCC register read.
+ */
+
 /**
  * @brief Get SOSC DIV2 clock frequency
  * @return SOSCDIV2 frequency in Hz, 0 if disabled
- * @note Reads actual divider from SCG registers
+ * @note Divider read from SCG registers when the cache is refreshed
  */
 uint32_t PCC_GetSoscDiv2Freq(void);
 
@@ -229,6 +270,13 @@ uint32_t PCC_GetFircDiv2Freq(void);
  */
 uint32_t PCC_GetSpllDiv2Freq(void);
 
+/**
+ * @brief Invalidate the cached DIV2 frequencies
+ * @note Called by ClockManager_Update(). Call it after writing SCG
+ *       registers directly (without the SCG_InitXxx() functions).
+ */
+void PCC_InvalidateClockCache(void);
+
 /*******************************************************************************
  * Communication Peripheral Clock Helpers
  ******************************************************************************/
@@ -52,6 +52,14 @@ void PDB_Init(pdb_instance_t instance, const pdb_config_t *config)
     /* Configure PDB Status and Control register */
     base->SC = PDB_SC_PRESCALER(config->prescaler) |
                PDB_SC_MULT(config->mult_factor) |
+               PDB_SC_TRGSEL(config->trigger_source) |
+               PDB_SC_CONT(config->continuous_mode ? 1U : 0U) |
+               PDB_SC_PDBIE(config->enable_interrupt ? 1U : 0U);
+    
+    /* Set counter period */
+    base->MOD = config->mod_value;
+}
+
 /**
  * @brief Enable PDB module
  * @param instance PDB instance
@@ -91,6 +99,41 @@ void PDB_ConfigADCTrigger(pdb_instance_t instance, uint8_t channel, uint8_t pret
     base->CH[channel].DLY[pretrigger] = delay;
 }
 
+/**
+ * @brief Configure a back-to-back pre-trigger chain
+ * @param instance PDB instance
+ * @param num_pretriggers Number of pre-triggers / ADC SC1 slots (1-16)
+ * @param delay Delay of pre-trigger 0 from the PDB trigger
+ * @note Replaces the whole C1 configuration of both channels
+ */
+void PDB_ConfigBackToBackChain(pdb_instance_t instance, uint8_t num_pretriggers, uint16_t delay)
+{
+    PDB_Type *base = PDB_GetBase(instance);
+    uint32_t ch;
+    uint32_t count;
+    uint32_t en;
+    
+    if (num_pretriggers > PDB_MAX_PRETRIGGERS) {
+        num_pretriggers = (uint8_t)PDB_MAX_PRETRIGGERS;
+    }
+    
+    for (ch = 0U; ch < PDB_CH_COUNT; ch++) {
+        count = (num_pretriggers > (ch * PDB_DLY_COUNT)) ? (num_pretriggers - (ch * PDB_DLY_COUNT)) : 0U;
+        if (count > PDB_DLY_COUNT) {
+            count = PDB_DLY_COUNT;
+        }
+        en = (1UL << count) - 1U;
+        
+        if (ch == 0U) {
+            /* Only CH0 PT0 waits for its delay, everything after is back-to-back */
+            base->CH[0].C1 = PDB_C1_EN(en) | PDB_C1_TOS(1U) | PDB_C1_BB(en & ~1UL);
+            base->CH[0].DLY[0] = delay;
+        } else {
+            base->CH[ch].C1 = PDB_C1_EN(en) | PDB_C1_BB(en);
+        }
+    }
+}
+
 /**
  * @brief Load PDB configuration (set LDOK bit)
  * @param instance PDB instance
@@ -109,15 +152,6 @@ void PDB_LoadConfig(pdb_instance_t instance)
  */
 void PDB_SoftwareTrigger(pdb_instance_t instance)
 {
-    PDB_
-void PDB_LoadConfig(pdb_instance_t instance)
-{
-    PDB_RegType *base = PDB_GetBase(instance);
-    base->SC |= PDB_SC_LDOK_MASK;
-}
-
-void PDB_SoftwareTrigger(pdb_instance_t instance)
-{
-    PDB_RegType *base = PDB_GetBase(instance);
+    PDB_Type *base = PDB_GetBase(instance);
     base->SC |= PDB_SC_SWTRIG_MASK;
 }
@@ -59,8 +59,12 @@ typedef enum {
     PDB_MULT_40 = 3
 } pdb_mult_t;
 
+/** @brief Pre-triggers per PDB (2 channels x 8), one per ADC SC1 slot */
+#define PDB_MAX_PRETRIGGERS     (PDB_CH_COUNT * PDB_DLY_COUNT)
+
 /** @brief PDB trigger source */
 typedef enum {
+    PDB_TRIGGER_TRGMUX = 0,    /* TRGMUX output (one event can start PDB0 and PDB1) */
     PDB_TRIGGER_SOFTWARE = 15  /* Software trigger */
 } pdb_trigger_t;
 
@@ -98,6 +102,14 @@ void PDB_Disable(pdb_instance_t instance);
  */
 void PDB_ConfigADCTrigger(pdb_instance_t instance, uint8_t channel, uint8_t pretrigger, uint16_t delay);
 
+/**
+ * @brief Configure a back-to-back pre-trigger chain
+ * @details Pre-trigger 0 fires after delay, each following pre-trigger fires
+ *          on the conversion complete of the previous one (CH0 PT7 chains into
+ *          CH1 PT0), so pre-trigger n converts ADC SC1[n].
+ */
+void PDB_ConfigBackToBackChain(pdb_instance_t instance, uint8_t num_pretriggers, uint16_t delay);
+
 /**
  * @brief Load configuration (LDOK)
  */
@@ -160,10 +160,4 @@ typedef struct {
 #define PDB_C1_BB_WIDTH                          8u
 #define PDB_C1_BB(x)                             (((uint32_t)(((uint32_t)(x))<<PDB_C1_BB_SHIFT))&PDB_C1_BB_MASK)
 
-/*******************************************************************************
- * PDB Register Indices
- ******************************************************************************/
-#define PCC_PDB0_INDEX                          (36u)
-#define PCC_PDB1_INDEX                          (37u)
-
 #endif /* PDB_REG_H */
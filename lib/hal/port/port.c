@@ -224,6 +224,40 @@ void PORT_DisablePassiveFilter(port_name_t port, uint8_t pin)
     base->PCR[pin] &= ~PORT_PCR_PFE_MASK;
 }
 
+void PORT_SetDigitalFilterConfig(port_name_t port, port_filter_clock_t clock, uint8_t width)
+{
+    PORT_Type *base = PORT_GetBase(port);
+    uint32_t dfer = base->DFER;
+    
+    if (width > PORT_FILTER_MAX_WIDTH) {
+        width = PORT_FILTER_MAX_WIDTH;
+    }
+    
+    /* DFCR / DFWR may only change while every pin has the filter disabled */
+    base->DFER = 0U;
+    base->DFCR = PORT_DFCR_CS(clock);
+    base->DFWR = PORT_DFWR_FILT(width);
+    base->DFER = dfer;
+}
+
+void PORT_EnableDigitalFilter(port_name_t port, uint8_t pin)
+{
+    PORT_Type *base = PORT_GetBase(port);
+    base->DFER |= (1U << pin);
+}
+
+void PORT_DisableDigitalFilter(port_name_t port, uint8_t pin)
+{
+    PORT_Type *base = PORT_GetBase(port);
+    base->DFER &= ~(1U << pin);
+}
+
+uint32_t PORT_GetDigitalFilterMask(port_name_t port)
+{
+    PORT_Type *base = PORT_GetBase(port);
+    return base->DFER;
+}
+
 /*******************************************************************************
  * EOF
  ******************************************************************************/
\ No newline at end of file
@@ -94,6 +94,18 @@ typedef struct {
     bool digitalFilter;                      /**< Digital filter enable */
 } port_pin_config_t;
 
+/** @brief Digital filter clock source (DFCR[CS]) */
+typedef enum {
+    PORT_FILTER_CLK_BUS = 0U,    /**< Bus clock */
+    PORT_FILTER_CLK_LPO = 1U     /**< LPO 128 kHz (also runs in STOP / VLPS) */
+} port_filter_clock_t;
+
+/** @brief LPO clock of the digital filter (Hz) */
+#define PORT_FILTER_LPO_FREQ        (128000U)
+
+/** @brief Maximum digital filter width (DFWR[FILT], filter clock cycles) */
+#define PORT_FILTER_MAX_WIDTH       (31U)
+
 /** @} */ /* End of PORT_Definitions */
 
 /*******************************************************************************
@@ -304,6 +316,65 @@ void PORT_EnablePassiveFilter(port_name_t port, uint8_t pin);
  */
 void PORT_DisablePassiveFilter(port_name_t port, uint8_t pin);
 
+/**
+ * @brief Configure the digital filter of a port
+ * @details Sets the filter clock and width shared by every pin of the port.
+ *          A pin with the filter enabled only changes (and only raises
+ *          PORT interrupts) once its input was stable for width filter
+ *          clock cycles, so glitches shorter than that never reach ISFR.
+ *          DFER is cleared while DFCR / DFWR change and then restored.
+ * 
+ * @param[in] port PORT name (PORT_A to PORT_E)
+ * @param[in] clock Filter clock source
+ * @param[in] width Filter length in filter clock cycles (0 = bypass, max PORT_FILTER_MAX_WIDTH)
+ * 
+ * @return None
+ * 
+ * @note With PORT_FILTER_CLK_LPO the longest filter is 31 / 128 kHz = 242 us:
+ *       enough for EMI glitches, not for mechanical contact bounce (use
+ *       debounce_srv for that)
+ * 
+ * @par Example:
+ * @code
+ * PORT_SetDigitalFilterConfig(PORT_C, PORT_FILTER_CLK_LPO, 16U);  // 125 us
+ * PORT_EnableDigitalFilter(PORT_C, 12);
+ * @endcode
+ */
+void PORT_SetDigitalFilterConfig(port_name_t port, port_filter_clock_t clock, uint8_t width);
+
+/**
+ * @brief Enable digital filter
+ * @details Enables the digital filter (DFER) for the specified pin
+ * 
+ * @param[in] port PORT name (PORT_A to PORT_E)
+ * @param[in] pin Pin number (0-31)
+ * 
+ * @return None
+ * 
+ * @note Filter clock / width from PORT_SetDigitalFilterConfig()
+ */
+void PORT_EnableDigitalFilter(port_name_t port, uint8_t pin);
+
+/**
+ * @brief Disable digital filter
+ * @details Disables the digital filter (DFER) for the specified pin
+ * 
+ * @param[in] port PORT name (PORT_A to PORT_E)
+ * @param[in] pin Pin number (0-31)
+ * 
+ * @return None
+ */
+void PORT_DisableDigitalFilter(port_name_t port, uint8_t pin);
+
+/**
+ * @brief Get digital filter enable mask
+ * 
+ * @param[in] port PORT name (PORT_A to PORT_E)
+ * 
+ * @return DFER value, bit n = filter enabled on pin n
+ */
+uint32_t PORT_GetDigitalFilterMask(port_name_t port);
+
 /** @} */ /* End of PORT_Functions */
 
 #endif /* PORT_H */
@@ -0,0 +1,278 @@
+/**
+ * @file    rtc.c
+ * @brief   RTC Driver Implementation for S32K144
+ * @details Implementation of the RTC seconds counter, alarm and seconds
+ *          interrupt.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "rtc.h"
+#include "pcc.h"
+#include "nvic.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief SIM->LPOCLKS address */
+#define RTC_SIM_LPOCLKS_ADDR            (0x40048010UL)
+#define RTC_SIM_LPOCLKS                 (*(volatile uint32_t *)RTC_SIM_LPOCLKS_ADDR)
+
+/** @brief SIM->LPOCLKS RTCCLKSEL field (0 SOSCDIV1, 1 LPO32K, 2 RTC_CLKIN, 3 FIRCDIV1) */
+#define RTC_SIM_LPOCLKS_RTCCLKSEL_MASK  (0x00000030UL)
+#define RTC_SIM_LPOCLKS_RTCCLKSEL_SHIFT (4U)
+#define RTC_SIM_RTCCLKSEL_LPO32K        (1UL)
+#define RTC_SIM_RTCCLKSEL_CLKIN         (2UL)
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+
+static rtc_callback_t s_rtcAlarmCallback = NULL;
+static void *s_rtcAlarmUserData = NULL;
+static rtc_callback_t s_rtcSecondsCallback = NULL;
+static void *s_rtcSecondsUserData = NULL;
+
+static bool s_rtcInitialized = false;
+
+/** @brief Counter kept from before a warm reset or set by RTC_SetTime() */
+static bool s_rtcTimeValid = false;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/* Does the clock in use match clockSource */
+static bool RTC_IsClockSelected(rtc_clock_source_t clockSource)
+{
+    uint32_t rtcclksel = (RTC_SIM_LPOCLKS & RTC_SIM_LPOCLKS_RTCCLKSEL_MASK) >> RTC_SIM_LPOCLKS_RTCCLKSEL_SHIFT;
+    bool lpos = (RTC->CR & RTC_CR_LPOS_MASK) != 0U;
+
+    switch (clockSource) {
+        case RTC_CLK_SRC_LPO_1K:
+            return lpos;
+        case RTC_CLK_SRC_LPO_32K:
+            return !lpos && (rtcclksel == RTC_SIM_RTCCLKSEL_LPO32K);
+        default:
+            return !lpos && (rtcclksel == RTC_SIM_RTCCLKSEL_CLKIN);
+    }
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+status_t RTC_Init(rtc_clock_source_t clockSource)
+{
+    uint32_t lpoclks;
+
+    if ((uint32_t)clockSource > (uint32_t)RTC_CLK_SRC_CLKIN) {
+        return STATUS_ERROR;
+    }
+
+    PCC->PCCn[PCC_RTC_INDEX] |= PCC_PCCn_CGC_MASK;
+
+    /* Counter valid from before a warm reset: keep the time */
+    if (((RTC->SR & (RTC_SR_TIF_MASK | RTC_SR_TCE_MASK)) == RTC_SR_TCE_MASK) &&
+        RTC_IsClockSelected(clockSource)) {
+        RTC->IER &= ~(RTC_IER_TAIE_MASK | RTC_IER_TSIE_MASK);
+        s_rtcTimeValid = true;
+        s_rtcInitialized = true;
+        return STATUS_SUCCESS;
+    }
+
+    RTC->CR = RTC_CR_SWR_MASK;
+    RTC->CR = 0U;
+    RTC->IER = 0U;
+
+    if (clockSource == RTC_CLK_SRC_LPO_1K) {
+        RTC->CR = RTC_CR_LPOS_MASK;
+    } else {
+        lpoclks = RTC_SIM_LPOCLKS & ~RTC_SIM_LPOCLKS_RTCCLKSEL_MASK;
+        lpoclks |= ((clockSource == RTC_CLK_SRC_LPO_32K) ? RTC_SIM_RTCCLKSEL_LPO32K : RTC_SIM_RTCCLKSEL_CLKIN)
+                   << RTC_SIM_LPOCLKS_RTCCLKSEL_SHIFT;
+        RTC_SIM_LPOCLKS = lpoclks;
+    }
+
+    /* Counter stops while TIF = 1: write TSR = 0 to run from 0 (alarm / wakeup usable at once) */
+    RTC->TPR = 0U;
+    RTC->TSR = 0U;
+    RTC->SR = RTC_SR_TCE_MASK;
+
+    s_rtcTimeValid = false;
+    s_rtcInitialized = true;
+
+    return STATUS_SUCCESS;
+}
+
+status_t RTC_Deinit(void)
+{
+    if (s_rtcInitialized) {
+        RTC->IER = 0U;
+        RTC->SR = 0U;
+    }
+
+    PCC->PCCn[PCC_RTC_INDEX] &= ~PCC_PCCn_CGC_MASK;
+
+    s_rtcAlarmCallback = NULL;
+    s_rtcSecondsCallback = NULL;
+    s_rtcInitialized = false;
+
+    return STATUS_SUCCESS;
+}
+
+bool RTC_IsTimeValid(void)
+{
+    return s_rtcInitialized && s_rtcTimeValid;
+}
+
+status_t RTC_SetTime(uint32_t seconds)
+{
+    if (!s_rtcInitialized) {
+        return STATUS_ERROR;
+    }
+
+    /* TSR / TPR are writable only while TCE = 0; writing TSR clears TIF / TOF */
+    RTC->SR = 0U;
+    RTC->TPR = 0U;
+    RTC->TSR = seconds;
+    RTC->SR = RTC_SR_TCE_MASK;
+
+    s_rtcTimeValid = true;
+
+    return STATUS_SUCCESS;
+}
+
+uint32_t RTC_GetTime(void)
+{
+    uint32_t first;
+    uint32_t second;
+
+    if (!s_rtcInitialized) {
+        return 0U;
+    }
+
+    /* TSR may change while being read: read until two reads match */
+    do {
+        first = RTC->TSR;
+        second = RTC->TSR;
+    } while (first != second);
+
+    return second;
+}
+
+status_t RTC_SetAlarm(uint32_t seconds, rtc_callback_t callback, void *userData)
+{
+    uint32_t basepri;
+
+    if (!s_rtcInitialized || (seconds <= RTC_GetTime())) {
+        return STATUS_ERROR;
+    }
+
+    basepri = NVIC_EnterCritical();
+
+    s_rtcAlarmCallback = callback;
+    s_rtcAlarmUserData = userData;
+
+    /* TAF sets when TSR == TAR and TSR increments: TAR = seconds - 1. Writing TAR clears TAF */
+    RTC->TAR = seconds - 1U;
+    RTC->IER |= RTC_IER_TAIE_MASK;
+
+    NVIC_ExitCritical(basepri);
+
+    return STATUS_SUCCESS;
+}
+
+status_t RTC_CancelAlarm(void)
+{
+    uint32_t basepri;
+
+    if (!s_rtcInitialized) {
+        return STATUS_ERROR;
+    }
+
+    basepri = NVIC_EnterCritical();
+
+    RTC->IER &= ~RTC_IER_TAIE_MASK;
+    RTC->TAR = RTC->TAR;
+    s_rtcAlarmCallback = NULL;
+
+    NVIC_ExitCritical(basepri);
+
+    return STATUS_SUCCESS;
+}
+
+status_t RTC_EnableSecondsInterrupt(rtc_callback_t callback, void *userData)
+{
+    uint32_t basepri;
+
+    if (!s_rtcInitialized) {
+        return STATUS_ERROR;
+    }
+
+    basepri = NVIC_EnterCritical();
+
+    s_rtcSecondsCallback = callback;
+    s_rtcSecondsUserData = userData;
+    RTC->IER = (RTC->IER & ~RTC_IER_TSIC_MASK) | RTC_IER_TSIC(0U) | RTC_IER_TSIE_MASK;
+
+    NVIC_ExitCritical(basepri);
+
+    return STATUS_SUCCESS;
+}
+
+status_t RTC_DisableSecondsInterrupt(void)
+{
+    if (!s_rtcInitialized) {
+        return STATUS_ERROR;
+    }
+
+    RTC->IER &= ~RTC_IER_TSIE_MASK;
+    s_rtcSecondsCallback = NULL;
+
+    return STATUS_SUCCESS;
+}
+
+status_t RTC_InstallIrqHandler(void)
+{
+    if ((NVIC_InstallHandler(RTC_IRQn, RTC_IRQHandler) != NVIC_STATUS_SUCCESS) ||
+        (NVIC_InstallHandler(RTC_Seconds_IRQn, RTC_Seconds_IRQHandler) != NVIC_STATUS_SUCCESS)) {
+        return STATUS_ERROR;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+void RTC_IRQHandler(void)
+{
+    rtc_callback_t callback;
+
+    if (((RTC->SR & RTC_SR_TAF_MASK) == 0U) || ((RTC->IER & RTC_IER_TAIE_MASK) == 0U)) {
+        return;
+    }
+
+    /* One-shot: disarm, then clear TAF */
+    RTC->IER &= ~RTC_IER_TAIE_MASK;
+    RTC->TAR = RTC->TAR;
+
+    callback = s_rtcAlarmCallback;
+    s_rtcAlarmCallback = NULL;
+    if (callback != NULL) {
+        callback(s_rtcAlarmUserData);
+    }
+}
+
+void RTC_Seconds_IRQHandler(void)
+{
+    /* The seconds interrupt has no flag */
+    if (s_rtcSecondsCallback != NULL) {
+        s_rtcSecondsCallback(s_rtcSecondsUserData);
+    }
+}
@@ -0,0 +1,167 @@
+/**
+ * @file    rtc.h
+ * @brief   RTC (Real Time Clock) driver for S32K144
+ * @details
+ * RTC driver provides the following APIs:
+ * - 32-bit seconds counter from a 32 kHz clock (LPO32K / RTC_CLKIN) or the
+ *   LPO 1 kHz, running in RUN, VLPR and VLPS
+ * - Seconds alarm interrupt (one-shot, absolute time), wakes from VLPS
+ * - 1 Hz seconds interrupt
+ * - Counter kept across warm resets: RTC_Init() does not reset a counter
+ *   that is valid and running with the same clock
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ *
+ * @note
+ * - RTC_CLK_SRC_LPO_1K increments the counter every 1024 LPO cycles
+ *   (1.024 s, TPR[4:0] bypassed); use a 32.768 kHz RTC_CLKIN for calendar
+ *   accuracy
+ * - RTC_CLK_SRC_LPO_32K / RTC_CLKIN write SIM_LPOCLKS[RTCCLKSEL]; SIM_LPOCLKS
+ *   is write-once after reset, RTC_Init() must be its only writer
+ * - The RTC registers are reset by POR only (and CR[SWR])
+ *
+ * @par Change Log:
+ * - Version 1.0 (14/10/2026): Initial RTC driver
+ */
+
+#ifndef RTC_H
+#define RTC_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "rtc_reg.h"
+#include "status.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @defgroup RTC_Definitions RTC Definitions
+ * @{
+ */
+
+/**
+ * @brief RTC counter clock
+ */
+typedef enum {
+    RTC_CLK_SRC_LPO_1K  = 0U,       /**< LPO 1 kHz (CR[LPOS]), always on */
+    RTC_CLK_SRC_LPO_32K = 1U,       /**< LPO 32 kHz through SIM_LPOCLKS[RTCCLKSEL] */
+    RTC_CLK_SRC_CLKIN   = 2U        /**< RTC_CLKIN pin (32.768 kHz) through SIM_LPOCLKS[RTCCLKSEL] */
+} rtc_clock_source_t;
+
+/**
+ * @brief RTC alarm / seconds callback (interrupt context)
+ * @param userData Pointer to user data
+ */
+typedef void (*rtc_callback_t)(void *userData);
+
+/** @} */ /* End of RTC_Definitions */
+
+/*******************************************************************************
+ * API Function Prototypes
+ ******************************************************************************/
+
+/**
+ * @defgroup RTC_Functions RTC Functions
+ * @{
+ */
+
+/**
+ * @brief Enable the RTC clock gate and start the seconds counter
+ * @details A counter that is already valid (SR[TIF] = 0) and running from
+ *          the same clock is left untouched. Otherwise the RTC is reset and
+ *          counts from 0 (RTC_IsTimeValid() = false until RTC_SetTime()), so
+ *          alarms relative to RTC_GetTime() work before the time is known.
+ *
+ * @param[in] clockSource Counter clock
+ *
+ * @return STATUS_SUCCESS, STATUS_ERROR on invalid parameter
+ *
+ * @code
+ * RTC_Init(RTC_CLK_SRC_CLKIN);
+ * if (!RTC_IsTimeValid()) {
+ *     RTC_SetTime(unixTimeFromGateway);
+ * }
+ * @endcode
+ */
+status_t RTC_Init(rtc_clock_source_t clockSource);
+
+/**
+ * @brief Stop the counter, disable the interrupts and gate the RTC clock
+ * @return STATUS_SUCCESS
+ */
+status_t RTC_Deinit(void);
+
+/**
+ * @brief Check whether the counter holds a time set by RTC_SetTime()
+ * @return true after RTC_SetTime(), or when RTC_Init() kept a counter
+ *         running from before a warm reset
+ */
+bool RTC_IsTimeValid(void);
+
+/**
+ * @brief Set the seconds counter (prescaler restarts from 0)
+ * @param[in] seconds New time (e.g. UNIX time)
+ * @return STATUS_ERROR if not initialized
+ */
+status_t RTC_SetTime(uint32_t seconds);
+
+/**
+ * @brief Read the seconds counter (double read, coherent while counting)
+ * @return Seconds, 0 if not initialized
+ */
+uint32_t RTC_GetTime(void);
+
+/**
+ * @brief Arm the alarm at an absolute time
+ * @details The callback runs once from RTC_IRQHandler() when the counter
+ *          reaches seconds, then the alarm disarms itself.
+ *
+ * @param[in] seconds  Alarm time, must be later than RTC_GetTime()
+ * @param[in] callback Alarm callback (NULL = wakeup only)
+ * @param[in] userData Passed to callback
+ *
+ * @return STATUS_ERROR if not initialized or seconds is not in the future
+ */
+status_t RTC_SetAlarm(uint32_t seconds, rtc_callback_t callback, void *userData);
+
+/**
+ * @brief Disarm the alarm
+ */
+status_t RTC_CancelAlarm(void);
+
+/**
+ * @brief Enable the 1 Hz seconds interrupt
+ */
+status_t RTC_EnableSecondsInterrupt(rtc_callback_t callback, void *userData);
+
+/**
+ * @brief Disable the seconds interrupt
+ */
+status_t RTC_DisableSecondsInterrupt(void);
+
+/**
+ * @brief Install RTC_IRQHandler() / RTC_Seconds_IRQHandler() in the RAM vector table
+ * @return STATUS_ERROR if a vector cannot be installed
+ */
+status_t RTC_InstallIrqHandler(void);
+
+/**
+ * @brief RTC alarm interrupt handler (RTC_IRQn)
+ */
+void RTC_IRQHandler(void);
+
+/**
+ * @brief RTC seconds interrupt handler (RTC_Seconds_IRQn)
+ */
+void RTC_Seconds_IRQHandler(void);
+
+/** @} */ /* End of RTC_Functions */
+
+#endif /* RTC_H */
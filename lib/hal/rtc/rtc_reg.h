@@ -0,0 +1,137 @@
+/**
+ * @file    rtc_reg.h
+ * @brief   RTC (Real Time Clock) Register Definitions for S32K144
+ * @details
+ * Defines RTC registers and bitfields.
+ * The RTC is a 32-bit seconds counter with a 15-bit prescaler and a seconds
+ * alarm, clocked from a 32 kHz source or the LPO 1 kHz, running in VLPS.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ *
+ * @note    Refer to S32K1xx Reference Manual Chapter 46 (RTC)
+ * @warning Must enable the RTC clock gate (PCC) before register access
+ *
+ * @par Change Log:
+ * - Version 1.0 (14/10/2026): Initial RTC register definitions
+ */
+
+#ifndef RTC_REG_H
+#define RTC_REG_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "def_reg.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief RTC module base address */
+#define RTC_BASE            (0x4003D000UL)
+
+/*******************************************************************************
+ * RTC Register Structure
+ ******************************************************************************/
+
+/**
+ * @brief RTC Module Structure
+ */
+typedef struct {
+    __IO uint32_t TSR;              /**< 0x0000: Time Seconds Register */
+    __IO uint32_t TPR;              /**< 0x0004: Time Prescaler Register */
+    __IO uint32_t TAR;              /**< 0x0008: Time Alarm Register */
+    __IO uint32_t TCR;              /**< 0x000C: Time Compensation Register */
+    __IO uint32_t CR;               /**< 0x0010: Control Register */
+    __IO uint32_t SR;               /**< 0x0014: Status Register */
+    __IO uint32_t LR;               /**< 0x0018: Lock Register */
+    __IO uint32_t IER;              /**< 0x001C: Interrupt Enable Register */
+} RTC_Type;
+
+/*******************************************************************************
+ * Register Access Macros
+ ******************************************************************************/
+
+/** @brief RTC module pointer */
+#define RTC                 ((RTC_Type *)RTC_BASE)
+
+/*******************************************************************************
+ * Control Register (CR) Bit Definitions
+ ******************************************************************************/
+
+/** @brief Software Reset - resets all RTC registers except SWR */
+#define RTC_CR_SWR_MASK         (0x00000001UL)
+#define RTC_CR_SWR_SHIFT        (0U)
+
+/** @brief Supervisor Access - 1 = user mode writes allowed */
+#define RTC_CR_SUP_MASK         (0x00000004UL)
+#define RTC_CR_SUP_SHIFT        (2U)
+
+/** @brief Update Mode - TSR / TPR writable while locked */
+#define RTC_CR_UM_MASK          (0x00000008UL)
+#define RTC_CR_UM_SHIFT         (3U)
+
+/** @brief Clock Pin Select (RTC_CLKOUT source) */
+#define RTC_CR_CPS_MASK         (0x00000020UL)
+#define RTC_CR_CPS_SHIFT        (5U)
+
+/** @brief LPO Select - 1 = prescaler clocked by LPO 1 kHz, TPR[4:0] bypassed */
+#define RTC_CR_LPOS_MASK        (0x00000080UL)
+#define RTC_CR_LPOS_SHIFT       (7U)
+
+/** @brief Clock Output - 1 = 32 kHz clock not output to peripherals */
+#define RTC_CR_CLKO_MASK        (0x00000200UL)
+#define RTC_CR_CLKO_SHIFT       (9U)
+
+/** @brief Clock Pin Enable (RTC_CLKOUT) */
+#define RTC_CR_CPE_MASK         (0x01000000UL)
+#define RTC_CR_CPE_SHIFT        (24U)
+
+/*******************************************************************************
+ * Status Register (SR) Bit Definitions
+ ******************************************************************************/
+
+/** @brief Time Invalid Flag - set on POR / software reset, cleared by TSR write */
+#define RTC_SR_TIF_MASK         (0x00000001UL)
+#define RTC_SR_TIF_SHIFT        (0U)
+
+/** @brief Time Overflow Flag - cleared by TSR write */
+#define RTC_SR_TOF_MASK         (0x00000002UL)
+#define RTC_SR_TOF_SHIFT        (1U)
+
+/** @brief Time Alarm Flag - cleared by TAR write */
+#define RTC_SR_TAF_MASK         (0x00000004UL)
+#define RTC_SR_TAF_SHIFT        (2U)
+
+/** @brief Time Counter Enable - TSR / TPR writable only while 0 */
+#define RTC_SR_TCE_MASK         (0x00000010UL)
+#define RTC_SR_TCE_SHIFT        (4U)
+
+/*******************************************************************************
+ * Interrupt Enable Register (IER) Bit Definitions
+ ******************************************************************************/
+
+/** @brief Time Invalid Interrupt Enable */
+#define RTC_IER_TIIE_MASK       (0x00000001UL)
+#define RTC_IER_TIIE_SHIFT      (0U)
+
+/** @brief Time Overflow Interrupt Enable */
+#define RTC_IER_TOIE_MASK       (0x00000002UL)
+#define RTC_IER_TOIE_SHIFT      (1U)
+
+/** @brief Time Alarm Interrupt Enable */
+#define RTC_IER_TAIE_MASK       (0x00000004UL)
+#define RTC_IER_TAIE_SHIFT      (2U)
+
+/** @brief Time Seconds Interrupt Enable (RTC_Seconds_IRQn) */
+#define RTC_IER_TSIE_MASK       (0x00000010UL)
+#define RTC_IER_TSIE_SHIFT      (4U)
+
+/** @brief Timer Seconds Interrupt Configuration - 0 = 1 Hz ... 7 = 128 Hz */
+#define RTC_IER_TSIC_MASK       (0x00070000UL)
+#define RTC_IER_TSIC_SHIFT      (16U)
+#define RTC_IER_TSIC(x)         (((uint32_t)(x) << RTC_IER_TSIC_SHIFT) & RTC_IER_TSIC_MASK)
+
+#endif /* RTC_REG_H */
@@ -21,6 +21,7 @@
  ******************************************************************************/
 #include "scg.h"
 #include "scg_reg.h"
+#include "smc_reg.h"
 #include <stddef.h>
 
 /*******************************************************************************
@@ -38,6 +39,10 @@
 /* Timeout values */
 #define SCG_TIMEOUT             (10000U)
 
+/* SCS / DIVCORE / DIVBUS / DIVSLOW, shared by CSR and the xCCR registers */
+#define SCG_CCR_FIELDS_MASK     (SCG_RCCR_SCS_MASK | SCG_RCCR_DIVCORE_MASK | \
+                                 SCG_RCCR_DIVBUS_MASK | SCG_RCCR_DIVSLOW_MASK)
+
 /*******************************************************************************
  * Private Variables
  ******************************************************************************/
@@ -54,6 +59,9 @@ static uint32_t s_sircFreq = SIRC_HIGH_RANGE_FREQ;
 /** @brief FIRC frequency */
 static uint32_t s_fircFreq = FIRC_48M_FREQ;
 
+/** @brief Incremented on every source / divider configuration */
+static volatile uint32_t s_configGeneration = 0U;
+
 /*******************************************************************************
  * Private Function Prototypes
  ******************************************************************************/
@@ -102,6 +110,58 @@ static uint32_t SCG_ConvertDividerToValue(scg_clock_divider_t divider)
     return (uint32_t)divider + 1U;
 }
 
+/**
+ * @brief Decode an RCCR / VCCR / HCCR / CSR value (same field layout)
+ */
+static bool SCG_DecodeClockControl(uint32_t ccr, scg_system_clock_config_t *config)
+{
+    /* Extract configuration */
+    uint32_t scs = (ccr & SCG_RCCR_SCS_MASK) >> SCG_RCCR_SCS_SHIFT;
+    
+    /* Map register value to clock source enum */
+    switch (scs) {
+        case SCG_SYSTEM_CLOCK_SRC_SIRC:
+            config->source = SCG_CLOCK_SRC_SIRC;
+            break;
+        case SCG_SYSTEM_CLOCK_SRC_FIRC:
+            config->source = SCG_CLOCK_SRC_FIRC;
+            break;
+        case SCG_SYSTEM_CLOCK_SRC_SOSC:
+            config->source = SCG_CLOCK_SRC_SOSC;
+            break;
+        case SCG_SYSTEM_CLOCK_SRC_SPLL:
+            config->source = SCG_CLOCK_SRC_SPLL;
+            break;
+        default:
+            return false;
+    }
+    
+    config->divCore = (scg_clock_divider_t)((ccr & SCG_RCCR_DIVCORE_MASK) >> SCG_RCCR_DIVCORE_SHIFT);
+    config->divBus  = (scg_clock_divider_t)((ccr & SCG_RCCR_DIVBUS_MASK) >> SCG_RCCR_DIVBUS_SHIFT);
+    config->divSlow = (scg_clock_divider_t)((ccr & SCG_RCCR_DIVSLOW_MASK) >> SCG_RCCR_DIVSLOW_SHIFT);
+    
+    return true;
+}
+
+/**
+ * @brief Check whether the SMC is currently in the run mode using this CCR
+ */
+static bool SCG_IsModeActive(scg_system_clock_mode_t mode)
+{
+    uint32_t pmstat = SMC->PMSTAT & SMC_PMSTAT_PMSTAT_MASK;
+
+    switch (mode) {
+        case SCG_SYSTEM_CLOCK_MODE_RUN:
+            return (pmstat == SMC_PMSTAT_RUN);
+        case SCG_SYSTEM_CLOCK_MODE_VLPR:
+            return (pmstat == SMC_PMSTAT_VLPR);
+        case SCG_SYSTEM_CLOCK_MODE_HSRUN:
+            return (pmstat == SMC_PMSTAT_HSRUN);
+        default:
+            return false;
+    }
+}
+
 /**
  * @brief Wait for clock source to become valid
  */
@@ -156,6 +216,7 @@ bool SCG_InitSIRC(const scg_sirc_config_t *config)
     /* Configure dividers */
     SCG->SIRCDIV = SCG_SIRCDIV_SIRCDIV1(config->div1) |
                    SCG_SIRCDIV_SIRCDIV2(config->div2);
+    s_configGeneration++;
     
     /* Configure control/status register */
     uint32_t csr = SCG_SIRCCSR_SIRCEN_MASK;
@@ -208,6 +269,7 @@ bool SCG_InitFIRC(const scg_firc_config_t *config)
     /* Configure dividers */
     SCG->FIRCDIV = SCG_FIRCDIV_FIRCDIV1(config->div1) |
                    SCG_FIRCDIV_FIRCDIV2(config->div2);
+    s_configGeneration++;
     
     /* Configure control/status register */
     uint32_t csr = SCG_FIRCCSR_FIRCEN_MASK;
@@ -232,6 +294,7 @@ bool SCG_InitSOSC(const scg_sosc_config_t *config)
     
     /* Store SOSC frequency */
     s_soscFreq = config->freq;
+    s_configGeneration++;
     
     /* Configure SOSC */
     uint32_t cfg = SCG_SOSCCFG_RANGE(config->range);
@@ -283,6 +346,7 @@ bool SCG_InitSPLL(const scg_spll_config_t *config)
     /* Configure dividers */
     SCG->SPLLDIV = SCG_SPLLDIV_SPLLDIV1(config->div1) |
                    SCG_SPLLDIV_SPLLDIV2(config->div2);
+    s_configGeneration++;
     
     /* Enable SPLL */
     SCG->SPLLCSR = SCG_SPLLCSR_SPLLEN_MASK;
@@ -341,12 +405,40 @@ bool SCG_SetSystemClockConfig(scg_system_clock_mode_t mode, const scg_system_clo
             return false;
     }
     
-    /* Wait for system clock source to switch */
+    /* VCCR / HCCR of an inactive mode are applied by the SMC transition */
+    if (!SCG_IsModeActive(mode)) {
+        return true;
+    }
+
+    return SCG_WaitForSystemClock(mode);
+}
+
+bool SCG_WaitForSystemClock(scg_system_clock_mode_t mode)
+{
+    volatile const uint32_t *ccrReg;
+    uint32_t ccr;
     uint32_t timeout = SCG_TIMEOUT;
-    while (((SCG->CSR & SCG_CSR_SCS_MASK) >> SCG_CSR_SCS_SHIFT != scsValue) && (timeout > 0U)) {
+
+    switch (mode) {
+        case SCG_SYSTEM_CLOCK_MODE_RUN:
+            ccrReg = &SCG->RCCR;
+            break;
+        case SCG_SYSTEM_CLOCK_MODE_VLPR:
+            ccrReg = &SCG->VCCR;
+            break;
+        case SCG_SYSTEM_CLOCK_MODE_HSRUN:
+            ccrReg = &SCG->HCCR;
+            break;
+        default:
+            return false;
+    }
+
+    /* CSR mirrors the CCR layout once source and dividers have switched */
+    ccr = *ccrReg & SCG_CCR_FIELDS_MASK;
+    while (((SCG->CSR & SCG_CCR_FIELDS_MASK) != ccr) && (timeout > 0U)) {
         timeout--;
     }
-    
+
     return (timeout > 0U);
 }
 
@@ -373,32 +465,7 @@ bool SCG_GetSystemClockConfig(scg_system_clock_mode_t mode, scg_system_clock_con
             return false;
     }
     
-    /* Extract configuration */
-    uint32_t scs = (ccr & SCG_RCCR_SCS_MASK) >> SCG_RCCR_SCS_SHIFT;
-    
-    /* Map register value to clock source enum */
-    switch (scs) {
-        case SCG_SYSTEM_CLOCK_SRC_SIRC:
-            config->source = SCG_CLOCK_SRC_SIRC;
-            break;
-        case SCG_SYSTEM_CLOCK_SRC_FIRC:
-            config->source = SCG_CLOCK_SRC_FIRC;
-            break;
-        case SCG_SYSTEM_CLOCK_SRC_SOSC:
-            config->source = SCG_CLOCK_SRC_SOSC;
-            break;
-        case SCG_SYSTEM_CLOCK_SRC_SPLL:
-            config->source = SCG_CLOCK_SRC_SPLL;
-            break;
-        default:
-            return false;
-    }
-    
-    config->divCore = (scg_clock_divider_t)((ccr & SCG_RCCR_DIVCORE_MASK) >> SCG_RCCR_DIVCORE_SHIFT);
-    config->divBus  = (scg_clock_divider_t)((ccr & SCG_RCCR_DIVBUS_MASK) >> SCG_RCCR_DIVBUS_SHIFT);
-    config->divSlow = (scg_clock_divider_t)((ccr & SCG_RCCR_DIVSLOW_MASK) >> SCG_RCCR_DIVSLOW_SHIFT);
-    
-    return true;
+    return SCG_DecodeClockControl(ccr, config);
 }
 
 bool SCG_GetClockFrequencies(scg_clock_frequencies_t *freqs)
@@ -407,9 +474,9 @@ bool SCG_GetClockFrequencies(scg_clock_frequencies_t *freqs)
         return false;
     }
     
-    /* Get current system clock configuration */
+    /* Active configuration (CSR): RCCR, VCCR or HCCR depending on run mode */
     scg_system_clock_config_t config;
-    if (!SCG_GetSystemClockConfig(SCG_SYSTEM_CLOCK_MODE_RUN, &config)) {
+    if (!SCG_DecodeClockControl(SCG->CSR, &config)) {
         return false;
     }
     
@@ -505,6 +572,28 @@ bool SCG_IsClockValid(scg_clock_source_t source)
     return isValid;
 }
 
+bool SCG_SetSircLowPowerEnable(bool enableInStop, bool enableInLowPower)
+{
+    uint32_t csr = SCG->SIRCCSR;
+    
+    /* Control bits are read-only while the register is locked */
+    if ((csr & SCG_SIRCCSR_LK_MASK) != 0U) {
+        return false;
+    }
+    
+    csr &= ~(SCG_SIRCCSR_SIRCSTEN_MASK | SCG_SIRCCSR_SIRCLPEN_MASK);
+    if (enableInStop) {
+        csr |= SCG_SIRCCSR_SIRCSTEN_MASK;
+    }
+    if (enableInLowPower) {
+        csr |= SCG_SIRCCSR_SIRCLPEN_MASK;
+    }
+    
+    SCG->SIRCCSR = csr;
+    
+    return true;
+}
+
 scg_clock_source_t SCG_GetSystemClockSource(void)
 {
     uint32_t scs = (SCG->CSR & SCG_CSR_SCS_MASK) >> SCG_CSR_SCS_SHIFT;
@@ -564,6 +653,11 @@ uint32_t SCG_GetSlowClockFreq(void)
     return 0U;
 }
 
+uint32_t SCG_GetConfigGeneration(void)
+{
+    return s_configGeneration;
+}
+
 bool SCG_ConfigureClockout(uint8_t source)
 {
     if (source > 15U) {
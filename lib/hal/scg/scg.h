@@ -215,9 +215,19 @@ bool SCG_InitSPLL(const scg_spll_config_t *config);
  * @return true if successful, false if failed
  * 
  * @note This function switches the system clock source
+ * @note VCCR / HCCR written while another run mode is active only take effect
+ *       on the SMC transition to that mode; the call then returns without
+ *       waiting. Use SCG_WaitForSystemClock() after SMC_SetRunMode().
  */
 bool SCG_SetSystemClockConfig(scg_system_clock_mode_t mode, const scg_system_clock_config_t *config);
 
+/**
+ * @brief Wait until the active clock (CSR) matches the mode's configuration
+ * @param[in] mode System clock mode whose RCCR / VCCR / HCCR is expected
+ * @return true if CSR matches, false on timeout or invalid mode
+ */
+bool SCG_WaitForSystemClock(scg_system_clock_mode_t mode);
+
 /**
  * @brief Get current system clock configuration
  * @param[in] mode System clock mode to query
@@ -231,7 +241,8 @@ bool SCG_GetSystemClockConfig(scg_system_clock_mode_t mode, scg_system_clock_con
  * @param[out] freqs Pointer to store clock frequencies
  * @return true if successful, false if failed
  * 
- * @note This function calculates all clock frequencies based on current configuration
+ * @note This function calculates all clock frequencies based on the active
+ *       configuration (CSR), so HSRUN / VLPR clocks are reported correctly
  */
 bool SCG_GetClockFrequencies(scg_clock_frequencies_t *freqs);
 
@@ -258,6 +269,17 @@ bool SCG_DisableClock(scg_clock_source_t source);
  */
 bool SCG_IsClockValid(scg_clock_source_t source);
 
+/**
+ * @brief Keep SIRC running in STOP / VLP modes
+ * @param[in] enableInStop     Keep SIRC enabled in STOP/VLPS (SIRCSTEN)
+ * @param[in] enableInLowPower Keep SIRC enabled in VLPR/VLPS (SIRCLPEN)
+ * @return true if successful, false if SIRCCSR is locked
+ * 
+ * @note Required for peripherals clocked from SIRCDIV2 (e.g. LPUART) that
+ *       must keep receiving while the core is in STOP/VLPS
+ */
+bool SCG_SetSircLowPowerEnable(bool enableInStop, bool enableInLowPower);
+
 /**
  * @brief Get current system clock source
  * @return Current system clock source
@@ -282,6 +304,14 @@ uint32_t SCG_GetBusClockFreq(void);
  */
 uint32_t SCG_GetSlowClockFreq(void);
 
+/**
+ * @brief Get SCG configuration generation
+ * @return Counter incremented by every SCG_InitSIRC/FIRC/SOSC/SPLL() call
+ * @note Lets frequency caches (PCC DIV2 outputs) detect a source or divider
+ *       change without polling the SCG registers
+ */
+uint32_t SCG_GetConfigGeneration(void);
+
 /**
  * @brief Configure CLKOUT (clock output pin)
  * @param[in] source Clock source to output (0-15)
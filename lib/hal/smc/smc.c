@@ -0,0 +1,161 @@
+/**
+ * @file    smc.c
+ * @brief   System Mode Controller (SMC) Driver Implementation for S32K144
+ * @details This file contains the implementation of stop mode entry and
+ *          run mode transitions.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.1
+ *
+ * @par Change Log:
+ * - Version 1.0 (Oct 14, 2026): Initial version
+ * - Version 1.1 (Oct 14, 2026): SMC_SetRunMode()
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "smc.h"
+#include "smc_reg.h"
+#include "nvic_reg.h"
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+/**
+ * @brief Allow VLP and HSRUN modes
+ */
+void SMC_SetProtection(bool allowVlp, bool allowHsrun)
+{
+    uint32_t prot = 0U;
+
+    if (allowVlp) {
+        prot |= SMC_PMPROT_AVLP_MASK;
+    }
+
+    if (allowHsrun) {
+        prot |= SMC_PMPROT_AHSRUN_MASK;
+    }
+
+    SMC->PMPROT = prot;
+}
+
+/**
+ * @brief Enter stop mode and wait for wakeup
+ */
+smc_status_t SMC_EnterStopMode(smc_stop_mode_t mode)
+{
+    uint32_t pmctrl;
+
+    if (mode > SMC_STOP_MODE_VLPS) {
+        return SMC_STATUS_INVALID_PARAM;
+    }
+
+    pmctrl = SMC->PMCTRL & ~SMC_PMCTRL_STOPM_MASK;
+
+    if (mode == SMC_STOP_MODE_VLPS) {
+        if ((SMC->PMPROT & SMC_PMPROT_AVLP_MASK) == 0U) {
+            return SMC_STATUS_ERROR;
+        }
+        pmctrl |= SMC_PMCTRL_STOPM(SMC_STOPM_VLPS);
+    } else {
+        /* STOPO: 1 = STOP1, 2 = STOP2 */
+        SMC->STOPCTRL = (SMC->STOPCTRL & ~SMC_STOPCTRL_STOPO_MASK) |
+                        SMC_STOPCTRL_STOPO((uint32_t)mode + 1U);
+        pmctrl |= SMC_PMCTRL_STOPM(SMC_STOPM_STOP);
+    }
+
+    SMC->PMCTRL = pmctrl;
+
+    /* Read back so the write completes before WFI */
+    (void)SMC->PMCTRL;
+
+    SCB->SCR |= SCB_SCR_SLEEPDEEP_MASK;
+    __asm volatile ("dsb");
+    __asm volatile ("wfi");
+    __asm volatile ("isb");
+    SCB->SCR &= ~SCB_SCR_SLEEPDEEP_MASK;
+
+    if ((mode == SMC_STOP_MODE_VLPS) && ((SMC->PMCTRL & SMC_PMCTRL_VLPSA_MASK) != 0U)) {
+        return SMC_STATUS_ABORTED;
+    }
+
+    return SMC_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Switch run mode and wait for PMSTAT
+ */
+smc_status_t SMC_SetRunMode(smc_run_mode_t mode)
+{
+    uint32_t target;
+    uint32_t current;
+    uint32_t timeout = SMC_TIMEOUT;
+
+    switch (mode) {
+        case SMC_RUN_MODE_RUN:
+            target = SMC_PMSTAT_RUN;
+            break;
+        case SMC_RUN_MODE_VLPR:
+            if ((SMC->PMPROT & SMC_PMPROT_AVLP_MASK) == 0U) {
+                return SMC_STATUS_ERROR;
+            }
+            target = SMC_PMSTAT_VLPR;
+            break;
+        case SMC_RUN_MODE_HSRUN:
+            if ((SMC->PMPROT & SMC_PMPROT_AHSRUN_MASK) == 0U) {
+                return SMC_STATUS_ERROR;
+            }
+            target = SMC_PMSTAT_HSRUN;
+            break;
+        default:
+            return SMC_STATUS_INVALID_PARAM;
+    }
+
+    current = SMC->PMSTAT & SMC_PMSTAT_PMSTAT_MASK;
+    if (current == target) {
+        return SMC_STATUS_SUCCESS;
+    }
+
+    /* HSRUN and VLPR are only entered from / exited to RUN */
+    if ((target != SMC_PMSTAT_RUN) && (current != SMC_PMSTAT_RUN)) {
+        return SMC_STATUS_ERROR;
+    }
+
+    if (mode == SMC_RUN_MODE_VLPR) {
+        SMC_PMC_REGSC |= SMC_PMC_REGSC_BIASEN_MASK;
+    }
+
+    SMC->PMCTRL = (SMC->PMCTRL & ~SMC_PMCTRL_RUNM_MASK) | SMC_PMCTRL_RUNM((uint32_t)mode);
+
+    while (((SMC->PMSTAT & SMC_PMSTAT_PMSTAT_MASK) != target) && (timeout > 0U)) {
+        timeout--;
+    }
+
+    if (timeout == 0U) {
+        return SMC_STATUS_TIMEOUT;
+    }
+
+    if (current == SMC_PMSTAT_VLPR) {
+        /* Regulator back in full performance before fast clocks are restarted */
+        timeout = SMC_TIMEOUT;
+        while (((SMC_PMC_REGSC & SMC_PMC_REGSC_REGFPM_MASK) == 0U) && (timeout > 0U)) {
+            timeout--;
+        }
+        if (timeout == 0U) {
+            return SMC_STATUS_TIMEOUT;
+        }
+    }
+
+    return SMC_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Get current power mode
+ */
+smc_power_mode_t SMC_GetPowerMode(void)
+{
+    return (smc_power_mode_t)(SMC->PMSTAT & SMC_PMSTAT_PMSTAT_MASK);
+}
@@ -0,0 +1,143 @@
+/**
+ * @file    smc.h
+ * @brief   System Mode Controller (SMC) Driver Header File for S32K144
+ * @details This file contains the SMC driver interface for low-power stop
+ *          mode entry (STOP1, STOP2, VLPS) and run mode transitions
+ *          (RUN, HSRUN, VLPR).
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.1
+ *
+ * @note Wakeup sources (e.g. FlexCAN Pretended Networking, PORT interrupts)
+ *       must be configured and enabled in NVIC before entering stop mode.
+ * @warning PMPROT is write-once after reset: call SMC_SetProtection() once
+ *          during startup, before any VLP mode request.
+ *
+ * @par Change Log:
+ * - Version 1.0 (Oct 14, 2026): Initial version
+ * - Version 1.1 (Oct 14, 2026): SMC_SetRunMode() for RUN / HSRUN / VLPR
+ */
+
+#ifndef SMC_H
+#define SMC_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "smc_reg.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief PMSTAT polling limit for run mode transitions */
+#define SMC_TIMEOUT             (10000U)
+
+/**
+ * @brief SMC Status Return Codes
+ */
+typedef enum {
+    SMC_STATUS_SUCCESS = 0x00U,         /**< Operation successful */
+    SMC_STATUS_ERROR = 0x01U,           /**< General error (e.g. mode not allowed) */
+    SMC_STATUS_ABORTED = 0x02U,         /**< Stop entry aborted by pending interrupt */
+    SMC_STATUS_TIMEOUT = 0x03U,         /**< PMSTAT did not reach the requested mode */
+    SMC_STATUS_INVALID_PARAM = 0x04U    /**< Invalid parameter */
+} smc_status_t;
+
+/**
+ * @brief Stop Mode Selection
+ */
+typedef enum {
+    SMC_STOP_MODE_STOP1 = 0U,   /**< STOP1: bus and system clocks gated */
+    SMC_STOP_MODE_STOP2 = 1U,   /**< STOP2: system clock gated, bus clock on */
+    SMC_STOP_MODE_VLPS  = 2U    /**< VLPS: very low power stop */
+} smc_stop_mode_t;
+
+/**
+ * @brief Run Mode Selection (PMCTRL[RUNM])
+ */
+typedef enum {
+    SMC_RUN_MODE_RUN   = SMC_RUNM_RUN,      /**< RUN: up to 80 MHz core */
+    SMC_RUN_MODE_VLPR  = SMC_RUNM_VLPR,     /**< VLPR: SIRC only, up to 4 MHz core */
+    SMC_RUN_MODE_HSRUN = SMC_RUNM_HSRUN     /**< HSRUN: up to 112 MHz core */
+} smc_run_mode_t;
+
+/**
+ * @brief Current Power Mode (PMSTAT)
+ */
+typedef enum {
+    SMC_POWER_MODE_RUN   = SMC_PMSTAT_RUN,      /**< RUN */
+    SMC_POWER_MODE_STOP  = SMC_PMSTAT_STOP,     /**< STOP */
+    SMC_POWER_MODE_VLPR  = SMC_PMSTAT_VLPR,     /**< VLPR */
+    SMC_POWER_MODE_VLPS  = SMC_PMSTAT_VLPS,     /**< VLPS */
+    SMC_POWER_MODE_HSRUN = SMC_PMSTAT_HSRUN     /**< HSRUN */
+} smc_power_mode_t;
+
+/*******************************************************************************
+ * API Function Prototypes
+ ******************************************************************************/
+
+/**
+ * @brief Allow VLP and HSRUN modes
+ * @param[in] allowVlp Allow VLPR/VLPS
+ * @param[in] allowHsrun Allow HSRUN
+ *
+ * @note PMPROT is write-once: only the first call after reset takes effect.
+ */
+void SMC_SetProtection(bool allowVlp, bool allowHsrun);
+
+/**
+ * @brief Enter stop mode and wait for wakeup
+ * @details Programs PMCTRL/STOPCTRL, sets SCB SCR[SLEEPDEEP] and executes WFI.
+ *          Returns after the wakeup interrupt has been serviced, with the
+ *          core back in RUN mode.
+ *
+ * @param[in] mode Stop mode to enter
+ *
+ * @return smc_status_t
+ *         - SMC_STATUS_SUCCESS: Stop mode entered and exited by wakeup
+ *         - SMC_STATUS_ABORTED: VLPS entry aborted (VLPSA set)
+ *         - SMC_STATUS_ERROR: VLPS not allowed by PMPROT
+ *         - SMC_STATUS_INVALID_PARAM: Invalid mode
+ *
+ * @par Example:
+ * @code
+ * SMC_SetProtection(true, false);
+ * CAN_EnterPretendedNetworking(0);
+ * SMC_EnterStopMode(SMC_STOP_MODE_VLPS);
+ * CAN_ExitPretendedNetworking(0);
+ * @endcode
+ */
+smc_status_t SMC_EnterStopMode(smc_stop_mode_t mode);
+
+/**
+ * @brief Switch run mode and wait for PMSTAT
+ * @details Writes PMCTRL[RUNM] and polls PMSTAT until the mode is reached.
+ *          VLPR entry enables the PMC bias (REGSC[BIASEN]) first; VLPR exit
+ *          also waits for the regulator to return to full performance.
+ *
+ * @param[in] mode Target run mode
+ *
+ * @return smc_status_t
+ *         - SMC_STATUS_SUCCESS: Mode reached (or already active)
+ *         - SMC_STATUS_ERROR: Not allowed by PMPROT, or HSRUN <-> VLPR requested
+ *           directly (both must go through RUN)
+ *         - SMC_STATUS_TIMEOUT: PMSTAT or the regulator did not change
+ *         - SMC_STATUS_INVALID_PARAM: Invalid mode
+ *
+ * @note The SCG applies HCCR / VCCR / RCCR on the transition: program the
+ *       target clock configuration first. VLPR needs SIRC as system clock and
+ *       SPLL / FIRC / SOSC disabled.
+ */
+smc_status_t SMC_SetRunMode(smc_run_mode_t mode);
+
+/**
+ * @brief Get current power mode
+ * @return smc_power_mode_t Current mode from PMSTAT
+ */
+smc_power_mode_t SMC_GetPowerMode(void);
+
+#endif /* SMC_H */
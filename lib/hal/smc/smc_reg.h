@@ -0,0 +1,104 @@
+/**
+ * @file    smc_reg.h
+ * @brief   SMC Register Definitions for S32K144
+ * @details This file contains low-level System Mode Controller register
+ *          definitions and macros for power mode control.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.1
+ *
+ * @note    These are raw register definitions for SMC peripheral
+ * @warning Direct register access - use with caution
+ *
+ * @par Change Log:
+ * - Version 1.0 (Oct 14, 2026): Initial version
+ * - Version 1.1 (Oct 14, 2026): RUNM values, PMC REGSC bias control for VLP modes
+ *
+ */
+
+#ifndef SMC_REG_H
+#define SMC_REG_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include "def_reg.h"
+
+/*******************************************************************************
+ * SMC Register Structure
+ ******************************************************************************/
+
+/**
+ * @brief SMC Register Layout
+ */
+typedef struct {
+    __I  uint32_t VERID;        /**< SMC Version ID Register, offset: 0x00 */
+    __I  uint32_t PARAM;        /**< SMC Parameter Register, offset: 0x04 */
+    __IO uint32_t PMPROT;       /**< Power Mode Protection Register, offset: 0x08 */
+    __IO uint32_t PMCTRL;       /**< Power Mode Control Register, offset: 0x0C */
+    __IO uint32_t STOPCTRL;     /**< Stop Control Register, offset: 0x10 */
+    __I  uint32_t PMSTAT;       /**< Power Mode Status Register, offset: 0x14 */
+} SMC_RegType;
+
+/** @brief SMC base address */
+#define SMC_BASE_ADDR           (0x4007E000UL)
+
+/** @brief SMC base pointer */
+#define SMC                     ((SMC_RegType *)SMC_BASE_ADDR)
+
+/*******************************************************************************
+ * PMPROT - Power Mode Protection Register (write-once after reset)
+ ******************************************************************************/
+#define SMC_PMPROT_AVLP_MASK        (0x20U)
+#define SMC_PMPROT_AVLP_SHIFT       (5U)
+#define SMC_PMPROT_AHSRUN_MASK      (0x80U)
+#define SMC_PMPROT_AHSRUN_SHIFT     (7U)
+
+/*******************************************************************************
+ * PMCTRL - Power Mode Control Register
+ ******************************************************************************/
+#define SMC_PMCTRL_STOPM_MASK       (0x7U)
+#define SMC_PMCTRL_STOPM_SHIFT      (0U)
+#define SMC_PMCTRL_STOPM(x)         (((uint32_t)(x) << SMC_PMCTRL_STOPM_SHIFT) & SMC_PMCTRL_STOPM_MASK)
+#define SMC_PMCTRL_VLPSA_MASK       (0x8U)
+#define SMC_PMCTRL_VLPSA_SHIFT      (3U)
+#define SMC_PMCTRL_RUNM_MASK        (0x60U)
+#define SMC_PMCTRL_RUNM_SHIFT       (5U)
+#define SMC_PMCTRL_RUNM(x)          (((uint32_t)(x) << SMC_PMCTRL_RUNM_SHIFT) & SMC_PMCTRL_RUNM_MASK)
+
+/** @brief RUNM values */
+#define SMC_RUNM_RUN                (0U)    /**< Normal run */
+#define SMC_RUNM_VLPR               (2U)    /**< Very low power run */
+#define SMC_RUNM_HSRUN              (3U)    /**< High speed run */
+
+/** @brief STOPM values */
+#define SMC_STOPM_STOP              (0U)    /**< Normal stop (STOP1/STOP2 per STOPCTRL) */
+#define SMC_STOPM_VLPS              (2U)    /**< Very low power stop */
+
+/*******************************************************************************
+ * STOPCTRL - Stop Control Register
+ ******************************************************************************/
+#define SMC_STOPCTRL_STOPO_MASK     (0xC0U)
+#define SMC_STOPCTRL_STOPO_SHIFT    (6U)
+#define SMC_STOPCTRL_STOPO(x)       (((uint32_t)(x) << SMC_STOPCTRL_STOPO_SHIFT) & SMC_STOPCTRL_STOPO_MASK)
+
+/*******************************************************************************
+ * PMSTAT - Power Mode Status Register
+ ******************************************************************************/
+#define SMC_PMSTAT_PMSTAT_MASK      (0xFFU)
+#define SMC_PMSTAT_RUN              (0x01U)
+#define SMC_PMSTAT_STOP             (0x02U)
+#define SMC_PMSTAT_VLPR             (0x04U)
+#define SMC_PMSTAT_VLPS             (0x10U)
+#define SMC_PMSTAT_HSRUN            (0x80U)
+
+/*******************************************************************************
+ * PMC REGSC - Regulator Status and Control Register (8-bit, PMC offset 0x02)
+ ******************************************************************************/
+#define SMC_PMC_REGSC               (*(volatile uint8_t *)0x4007D002UL)
+#define SMC_PMC_REGSC_BIASEN_MASK   (0x01U)     /**< Bias enable, required in VLPR/VLPS */
+#define SMC_PMC_REGSC_REGFPM_MASK   (0x04U)     /**< 1 = regulator in full performance mode */
+
+#endif /* SMC_REG_H */
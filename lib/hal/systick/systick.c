@@ -21,6 +21,8 @@
  ******************************************************************************/
 #include "systick.h"
 #include "systick_reg.h"
+#include "nvic.h"
+#include "clock_manager.h"
 #include <stddef.h>
 
 /*******************************************************************************
@@ -37,8 +39,24 @@
 /** @brief Callback function pointer */
 static systick_callback_t s_systickCallback = NULL;
 
-/** @brief Tick counter for millisecond tracking */
+/** @brief Tick counter for millisecond tracking (low / high word of the 64-bit count) */
 static volatile uint32_t s_tickCounter = 0U;
+static volatile uint32_t s_tickCounterHigh = 0U;
+
+/** @brief Tick hook slot */
+typedef struct {
+    systick_hook_t hook;        /**< Hook function */
+    void *userData;             /**< Hook user data */
+    uint32_t divisor;           /**< Call every divisor ticks */
+    uint32_t countdown;         /**< Ticks left until the next call */
+} systick_hook_slot_t;
+
+/** @brief Subscribed hooks, s_hookCount first slots used */
+static systick_hook_slot_t s_hooks[SYSTICK_MAX_HOOKS];
+static volatile uint32_t s_hookCount = 0U;
+
+/** @brief Tick period in us set by SYSTICK_Config*(), 0 = raw reload (not re-timed) */
+static uint32_t s_tickPeriodUs = 0U;
 
 /*******************************************************************************
  * Private Function Prototypes
@@ -51,6 +69,13 @@ static volatile uint32_t s_tickCounter = 0U;
  */
 static bool SYSTICK_ValidateReloadValue(uint32_t value);
 
+/**
+ * @brief Clock Manager notifier, recomputes the reload for the stored tick period
+ * @param[in] event    Clock change event
+ * @param[in] userData Unused
+ */
+static void SYSTICK_ClockNotifier(clock_notify_event_t event, void *userData);
+
 /*******************************************************************************
  * Private Functions
  ******************************************************************************/
@@ -60,6 +85,27 @@ static bool SYSTICK_ValidateReloadValue(uint32_t value)
     return ((value > 0U) && (value <= SYSTICK_MAX_RELOAD));
 }
 
+static void SYSTICK_ClockNotifier(clock_notify_event_t event, void *userData)
+{
+    uint64_t cycles;
+
+    (void)userData;
+
+    if ((event != CLOCK_NOTIFY_AFTER) || (s_tickPeriodUs == 0U)) {
+        return;
+    }
+
+    cycles = ((uint64_t)ClockManager_GetCoreFreq() * (uint64_t)s_tickPeriodUs) / 1000000ULL;
+
+    /* Period not reachable at the new core clock: keep the old reload */
+    if ((cycles <= 1ULL) || (cycles > (uint64_t)SYSTICK_MAX_RELOAD)) {
+        return;
+    }
+
+    /* Takes effect on the next wrap; the current period finishes on the old count */
+    SYSTICK->RVR = SYSTICK_RVR_RELOAD((uint32_t)cycles - 1U);
+}
+
 /*******************************************************************************
  * Public Functions
  ******************************************************************************/
@@ -99,6 +145,10 @@ bool SYSTICK_Init(const systick_config_t *config)
     
     /* Reset tick counter */
     s_tickCounter = 0U;
+    s_tickCounterHigh = 0U;
+    
+    /* Raw reload value: owner handles clock changes */
+    s_tickPeriodUs = 0U;
     
     return true;
 }
@@ -154,7 +204,12 @@ bool SYSTICK_ConfigMillisecond(uint32_t systemClockHz, bool enableInterrupt)
         .enableInterrupt = enableInterrupt
     };
     
-    return SYSTICK_Init(&config);
+    if (!SYSTICK_Init(&config)) {
+        return false;
+    }
+    
+    s_tickPeriodUs = 1000U;
+    return ClockManager_RegisterNotifier(SYSTICK_ClockNotifier, NULL);
 }
 
 bool SYSTICK_ConfigMicrosecond(uint32_t systemClockHz, uint32_t microseconds, bool enableInterrupt)
@@ -176,25 +231,21 @@ bool SYSTICK_ConfigMicrosecond(uint32_t systemClockHz, uint32_t microseconds, bo
         .enableInterrupt = enableInterrupt
     };
     
-    return SYSTICK_Init(&config);
+    if (!SYSTICK_Init(&config)) {
+        return false;
+    }
+    
+    s_tickPeriodUs = microseconds;
+    return ClockManager_RegisterNotifier(SYSTICK_ClockNotifier, NULL);
 }
 
 void SYSTICK_DelayMs(uint32_t milliseconds)
 {
-    uint32_t startTick = s_tickCounter;
-    uint32_t targetTick = startTick + milliseconds;
-    
-    /* Handle counter overflow */
-    if (targetTick < startTick) {
-        /* Wait for overflow */
-        while (s_tickCounter >= startTick) {
-            __asm("NOP");
-        }
-    }
+    uint64_t startTick = SYSTICK_GetTicks64();
     
-    /* Wait for target tick */
-    while (s_tickCounter < targetTick) {
-        __asm("NOP");
+    /* 64-bit count never wraps; sleep until each tick IRQ */
+    while ((SYSTICK_GetTicks64() - startTick) < (uint64_t)milliseconds) {
+        NVIC_WaitForInterrupt();
     }
 }
 
@@ -302,15 +353,101 @@ void SYSTICK_UnregisterCallback(void)
     s_systickCallback = NULL;
 }
 
+bool SYSTICK_AddHook(systick_hook_t hook, void *userData, uint32_t divisor)
+{
+    uint32_t basepri;
+    uint32_t i;
+    bool added = false;
+
+    if ((hook == NULL) || (divisor == 0U)) {
+        return false;
+    }
+
+    basepri = NVIC_EnterCritical();
+
+    for (i = 0U; i < s_hookCount; i++) {
+        if ((s_hooks[i].hook == hook) && (s_hooks[i].userData == userData)) {
+            break;
+        }
+    }
+
+    if ((i == s_hookCount) && (s_hookCount < SYSTICK_MAX_HOOKS)) {
+        s_hooks[s_hookCount].hook = hook;
+        s_hooks[s_hookCount].userData = userData;
+        s_hooks[s_hookCount].divisor = divisor;
+        s_hooks[s_hookCount].countdown = divisor;
+        s_hookCount++;
+        added = true;
+    }
+
+    NVIC_ExitCritical(basepri);
+
+    return added;
+}
+
+bool SYSTICK_RemoveHook(systick_hook_t hook, void *userData)
+{
+    uint32_t basepri;
+    uint32_t i;
+    bool removed = false;
+
+    basepri = NVIC_EnterCritical();
+
+    for (i = 0U; i < s_hookCount; i++) {
+        if ((s_hooks[i].hook == hook) && (s_hooks[i].userData == userData)) {
+            removed = true;
+            break;
+        }
+    }
+
+    /* Keep the used slots packed, order preserved */
+    if (removed) {
+        for (; (i + 1U) < s_hookCount; i++) {
+            s_hooks[i] = s_hooks[i + 1U];
+        }
+        s_hookCount--;
+    }
+
+    NVIC_ExitCritical(basepri);
+
+    return removed;
+}
+
 void SYSTICK_IRQHandler(void)
 {
-    /* Increment tick counter */
+    uint32_t i;
+    systick_hook_slot_t *slot;
+    systick_hook_t hook;
+    void *userData;
+
+    /* Increment tick counter, carry into the high word */
     s_tickCounter++;
+    if (s_tickCounter == 0U) {
+        s_tickCounterHigh++;
+    }
     
     /* Call user callback if registered */
     if (s_systickCallback != NULL) {
         s_systickCallback();
     }
+
+    /* Hooks whose divisor elapsed; index re-checked since a hook may remove itself */
+    i = 0U;
+    while (i < s_hookCount) {
+        slot = &s_hooks[i];
+        slot->countdown--;
+        if (slot->countdown == 0U) {
+            slot->countdown = slot->divisor;
+            hook = slot->hook;
+            userData = slot->userData;
+            hook(userData);
+            /* Removed itself: the next hook moved into this slot */
+            if ((i >= s_hookCount) || (s_hooks[i].hook != hook) || (s_hooks[i].userData != userData)) {
+                continue;
+            }
+        }
+        i++;
+    }
 }
 
 void SYSTICK_EnableInterrupt(void)
@@ -352,7 +489,52 @@ uint32_t SYSTICK_GetTicks(void)
     return s_tickCounter;
 }
 
+uint64_t SYSTICK_GetTicks64(void)
+{
+    uint32_t high;
+    uint32_t low;
+
+    /* Retry if the tick ISR carried into the high word meanwhile */
+    do {
+        high = s_tickCounterHigh;
+        low = s_tickCounter;
+    } while (high != s_tickCounterHigh);
+
+    return ((uint64_t)high << 32U) | (uint64_t)low;
+}
+
 void SYSTICK_ResetTicks(void)
 {
+    uint32_t basepri = NVIC_EnterCritical();
+
     s_tickCounter = 0U;
+    s_tickCounterHigh = 0U;
+
+    NVIC_ExitCritical(basepri);
+}
+
+bool SYSTICK_SuspendTick(void)
+{
+    bool running = SYSTICK_IsEnabled() && SYSTICK_IsInterruptEnabled();
+    
+    if (running) {
+        SYSTICK_DISABLE();
+    }
+    
+    return running;
+}
+
+void SYSTICK_ResumeTick(uint32_t elapsedTicks)
+{
+    uint32_t low = s_tickCounter + elapsedTicks;
+
+    /* Tick is stopped, no ISR races the two words */
+    if (low < s_tickCounter) {
+        s_tickCounterHigh++;
+    }
+    s_tickCounter = low;
+    
+    /* Restart a full period from now */
+    SYSTICK->CVR = 0U;
+    SYSTICK_ENABLE();
 }
@@ -53,6 +53,17 @@ typedef struct {
 /** @brief SysTick callback function type */
 typedef void (*systick_callback_t)(void);
 
+/** @brief Number of tick hook slots (SYSTICK_AddHook()) */
+#ifndef SYSTICK_MAX_HOOKS
+#define SYSTICK_MAX_HOOKS       (8U)
+#endif
+
+/**
+ * @brief Tick hook function type
+ * @param[in] userData Pointer given to SYSTICK_AddHook()
+ */
+typedef void (*systick_hook_t)(void *userData);
+
 /** @} */ /* End of SysTick_Definitions */
 
 /*******************************************************************************
@@ -124,6 +135,8 @@ bool SYSTICK_HasCountedToZero(void);
  * @return true if successful, false if failed
  * 
  * @note Configures SysTick to generate 1ms ticks
+ * @note The reload is recomputed from the core clock when
+ *       ClockManager_Update() reports a clock change
  * @warning System clock must be known and passed correctly
  * 
  * Example usage:
@@ -142,6 +155,7 @@ bool SYSTICK_ConfigMillisecond(uint32_t systemClockHz, bool enableInterrupt);
  * @return true if successful, false if failed
  * 
  * @note Limited by 24-bit reload value and clock frequency
+ * @note The period is kept across clock changes like SYSTICK_ConfigMillisecond()
  */
 bool SYSTICK_ConfigMicrosecond(uint32_t systemClockHz, uint32_t microseconds, bool enableInterrupt);
 
@@ -149,12 +163,13 @@ bool SYSTICK_ConfigMicrosecond(uint32_t systemClockHz, uint32_t microseconds, bo
  * @brief Blocking delay in milliseconds
  * @param[in] milliseconds Number of milliseconds to delay
  * 
- * @note SysTick must be configured with 1ms tick before using
+ * @note SysTick must be configured with 1ms tick and interrupt enabled
+ * @note The core sleeps (WFI) between ticks instead of spinning
  * @warning This is a blocking delay
  * 
  * Example usage:
  * @code
- * SYSTICK_ConfigMillisecond(48000000U, false);
+ * SYSTICK_ConfigMillisecond(48000000U, true);
  * SYSTICK_Start();
  * SYSTICK_DelayMs(1000U);  // Delay 1 second
  * @endcode
@@ -167,7 +182,8 @@ void SYSTICK_DelayMs(uint32_t milliseconds);
  * @param[in] systemClockHz System clock frequency in Hz
  * 
  * @note This function temporarily reconfigures SysTick
- * @warning Not suitable for precise short delays (< 10us)
+ * @warning Not suitable for precise short delays (< 10us), use
+ *          ClockManager_DelayUs() instead
  */
 void SYSTICK_DelayUs(uint32_t microseconds, uint32_t systemClockHz);
 
@@ -194,13 +210,43 @@ void SYSTICK_RegisterCallback(systick_callback_t callback);
  */
 void SYSTICK_UnregisterCallback(void);
 
+/**
+ * @brief Subscribe a hook to the tick
+ * @param[in] hook     Function called from SYSTICK_IRQHandler()
+ * @param[in] userData Passed to the hook
+ * @param[in] divisor  Call the hook every divisor ticks (>= 1)
+ * @return true if added, false if the list is full, the pair is already
+ *         subscribed, hook is NULL or divisor is 0
+ * 
+ * @note Hooks run in subscription order after the SYSTICK_RegisterCallback()
+ *       callback; the first call comes divisor ticks after subscribing
+ * @note Ticks compensated by SYSTICK_ResumeTick() do not call the hooks
+ * 
+ * Example usage:
+ * @code
+ * SYSTICK_AddHook(Keypad_Scan, &keypad, 10U);    // every 10 ms
+ * SYSTICK_AddHook(Led_Blink, NULL, 500U);        // every 500 ms
+ * @endcode
+ */
+bool SYSTICK_AddHook(systick_hook_t hook, void *userData, uint32_t divisor);
+
+/**
+ * @brief Unsubscribe a hook added with SYSTICK_AddHook()
+ * @param[in] hook     Hook function
+ * @param[in] userData Same pointer as in SYSTICK_AddHook()
+ * @return true if removed, false if not subscribed
+ * 
+ * @note May be called from the hook itself
+ */
+bool SYSTICK_RemoveHook(systick_hook_t hook, void *userData);
+
 /**
  * @brief SysTick interrupt handler
  * 
  * @note This function should be called from SysTick_Handler in vector table
  * @note Automatically calls registered callback if available
  */
-void SYSTICK_IRQHandler(void);
+HAL_RAMFUNC void SYSTICK_IRQHandler(void);
 
 /**
  * @brief Enable SysTick interrupt
@@ -233,18 +279,44 @@ void SYSTICK_SetClockSource(systick_clock_source_t source);
 
 /**
  * @brief Get elapsed ticks since start
- * @return Number of ticks elapsed
+ * @return Number of ticks elapsed (low 32 bits of SYSTICK_GetTicks64())
  * 
  * @note Requires interrupt to be enabled for accurate counting
  * @note Counter wraps around at maximum uint32_t value
  */
 uint32_t SYSTICK_GetTicks(void);
 
+/**
+ * @brief Get elapsed ticks since start as a 64-bit count
+ * @return Number of ticks elapsed, does not wrap in practice
+ * 
+ * @note Consistent without masking interrupts: the high word is re-read
+ *       until it did not change around the low word read
+ */
+uint64_t SYSTICK_GetTicks64(void);
+
 /**
  * @brief Reset tick counter
  */
 void SYSTICK_ResetTicks(void);
 
+/**
+ * @brief Stop the periodic tick before a tickless idle period
+ * @return true if the tick was running and must be resumed
+ * 
+ * @note The tick counter is frozen until SYSTICK_ResumeTick()
+ */
+bool SYSTICK_SuspendTick(void);
+
+/**
+ * @brief Restart the periodic tick after a tickless idle period
+ * @param[in] elapsedTicks Ticks slept, measured by a timer that kept running
+ *                         (e.g. LPIT)
+ * 
+ * @note SYSTICK_GetTicks() continues from the compensated value
+ */
+void SYSTICK_ResumeTick(uint32_t elapsedTicks);
+
 /** @} */ /* End of SysTick_Functions */
 
 /*******************************************************************************
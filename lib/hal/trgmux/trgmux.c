@@ -0,0 +1,163 @@
+/**
+ * @file    trgmux.c
+ * @brief   TRGMUX (Trigger Multiplexer) Driver Implementation for S32K144
+ * @details Implementation of trigger routing between hardware trigger
+ *          sources and peripheral trigger inputs.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "trgmux.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+/**
+ * @brief Route a trigger source to one input of a target
+ */
+status_t TRGMUX_SetSource(trgmux_target_t target, uint8_t input, trgmux_source_t source)
+{
+    uint32_t value;
+
+    if ((input >= TRGMUX_SEL_COUNT) || ((uint32_t)target >= TRGMUX_REG_COUNT)) {
+        return STATUS_ERROR;
+    }
+
+    value = TRGMUX->TRGMUXn[target];
+    if ((value & TRGMUX_LK_MASK) != 0U) {
+        return STATUS_ERROR;
+    }
+
+    value &= ~(TRGMUX_SEL_MASK << TRGMUX_SEL_SHIFT(input));
+    value |= ((uint32_t)source & TRGMUX_SEL_MASK) << TRGMUX_SEL_SHIFT(input);
+    TRGMUX->TRGMUXn[target] = value;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Get the source routed to one input of a target
+ */
+trgmux_source_t TRGMUX_GetSource(trgmux_target_t target, uint8_t input)
+{
+    if ((input >= TRGMUX_SEL_COUNT) || ((uint32_t)target >= TRGMUX_REG_COUNT)) {
+        return TRGMUX_SRC_DISABLED;
+    }
+
+    return (trgmux_source_t)((TRGMUX->TRGMUXn[target] >> TRGMUX_SEL_SHIFT(input)) & TRGMUX_SEL_MASK);
+}
+
+/**
+ * @brief Lock a target register until the next reset
+ */
+void TRGMUX_Lock(trgmux_target_t target)
+{
+    if ((uint32_t)target < TRGMUX_REG_COUNT) {
+        TRGMUX->TRGMUXn[target] |= TRGMUX_LK_MASK;
+    }
+}
+
+/**
+ * @brief Check whether a target register is locked
+ */
+bool TRGMUX_IsLocked(trgmux_target_t target)
+{
+    if ((uint32_t)target >= TRGMUX_REG_COUNT) {
+        return false;
+    }
+
+    return ((TRGMUX->TRGMUXn[target] & TRGMUX_LK_MASK) != 0U);
+}
+
+/**
+ * @brief Select the hardware trigger path of an ADC
+ */
+status_t TRGMUX_SetAdcTrigger(uint8_t adcInstance, trgmux_adc_trigger_t trigger)
+{
+    uint32_t value;
+
+    if (adcInstance >= 2U) {
+        return STATUS_ERROR;
+    }
+
+    value = TRGMUX_SIM_ADCOPT;
+    value &= ~(TRGMUX_ADCOPT_TRGSEL_MASK(adcInstance) | TRGMUX_ADCOPT_PRETRGSEL_MASK(adcInstance));
+    if (trigger == TRGMUX_ADC_TRIGGER_TRGMUX) {
+        value |= TRGMUX_ADCOPT_TRGSEL_MASK(adcInstance) | TRGMUX_ADCOPT_PRETRGSEL(adcInstance, 1U);
+    }
+    TRGMUX_SIM_ADCOPT = value;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Apply a route table
+ */
+status_t TRGMUX_ApplyRoutes(const trgmux_route_t *routes, uint32_t count, bool lock)
+{
+    uint32_t i;
+
+    if ((routes == NULL) && (count != 0U)) {
+        return STATUS_ERROR;
+    }
+
+    for (i = 0U; i < count; i++) {
+        if ((routes[i].input >= TRGMUX_SEL_COUNT) ||
+            ((uint32_t)routes[i].target >= TRGMUX_REG_COUNT) ||
+            TRGMUX_IsLocked(routes[i].target)) {
+            return STATUS_ERROR;
+        }
+    }
+
+    for (i = 0U; i < count; i++) {
+        switch (routes[i].target) {
+            case TRGMUX_TARGET_ADC0:
+                (void)TRGMUX_SetAdcTrigger(0U, TRGMUX_ADC_TRIGGER_TRGMUX);
+                break;
+            case TRGMUX_TARGET_ADC1:
+                (void)TRGMUX_SetAdcTrigger(1U, TRGMUX_ADC_TRIGGER_TRGMUX);
+                break;
+            case TRGMUX_TARGET_PDB0:
+                (void)TRGMUX_SetAdcTrigger(0U, TRGMUX_ADC_TRIGGER_PDB);
+                break;
+            case TRGMUX_TARGET_PDB1:
+                (void)TRGMUX_SetAdcTrigger(1U, TRGMUX_ADC_TRIGGER_PDB);
+                break;
+            default:
+                break;
+        }
+
+        (void)TRGMUX_SetSource(routes[i].target, routes[i].input, routes[i].source);
+    }
+
+    if (lock) {
+        for (i = 0U; i < count; i++) {
+            TRGMUX_Lock(routes[i].target);
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Disconnect every route of a table
+ */
+void TRGMUX_ClearRoutes(const trgmux_route_t *routes, uint32_t count)
+{
+    uint32_t i;
+
+    if (routes == NULL) {
+        return;
+    }
+
+    for (i = 0U; i < count; i++) {
+        (void)TRGMUX_SetSource(routes[i].target, routes[i].input, TRGMUX_SRC_DISABLED);
+    }
+}
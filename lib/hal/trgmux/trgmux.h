@@ -0,0 +1,203 @@
+/**
+ * @file    trgmux.h
+ * @brief   TRGMUX (Trigger Multiplexer) driver for S32K144
+ * @details
+ * TRGMUX driver routes hardware trigger outputs (LPIT, FTM, LPTMR, ...) to
+ * peripheral trigger inputs. Routing the same source to several targets
+ * (e.g. PDB0 and PDB1) starts them on the same clock edge.
+ *
+ * Hardware-timed pipelines are described as a route table and applied in
+ * one call, the driver also selects the ADC trigger path (SIM ADCOPT):
+ * @code
+ * static const trgmux_route_t s_routes[] = {
+ *     TRGMUX_ROUTE(TRGMUX_SRC_LPIT_CH0, TRGMUX_TARGET_ADC0, 0U),    // LPIT0 -> ADC0 SC1[0]
+ *     TRGMUX_ROUTE(TRGMUX_SRC_LPIT_CH1, TRGMUX_TARGET_DMAMUX0, 1U), // LPIT1 -> DMA ch1
+ *     TRGMUX_ROUTE(TRGMUX_SRC_FTM0_INIT, TRGMUX_TARGET_PDB1, 0U),   // FTM0 -> PDB1 -> ADC1
+ * };
+ * TRGMUX_ApplyRoutes(s_routes, 3U, false);
+ * @endcode
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ *
+ * @note TRGMUX has no PCC clock gate, it is always clocked
+ * @warning TRGMUX_Lock() is permanent until the next reset
+ */
+
+#ifndef TRGMUX_H
+#define TRGMUX_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "trgmux_reg.h"
+#include "status.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @defgroup TRGMUX_Definitions TRGMUX Definitions
+ * @{
+ */
+
+/**
+ * @brief TRGMUX trigger sources (SELx values)
+ */
+typedef enum {
+    TRGMUX_SRC_DISABLED       = 0U,   /**< Logic 0 */
+    TRGMUX_SRC_VDD            = 1U,   /**< Logic 1 */
+    TRGMUX_SRC_TRGMUX_IN0     = 2U,   /**< TRGMUX_IN0 pin (IN1-IN11 follow) */
+    TRGMUX_SRC_CMP0_OUT       = 14U,  /**< CMP0 output */
+    TRGMUX_SRC_LPIT_CH0       = 17U,  /**< LPIT channel 0 timeout */
+    TRGMUX_SRC_LPIT_CH1       = 18U,  /**< LPIT channel 1 timeout */
+    TRGMUX_SRC_LPIT_CH2       = 19U,  /**< LPIT channel 2 timeout */
+    TRGMUX_SRC_LPIT_CH3       = 20U,  /**< LPIT channel 3 timeout */
+    TRGMUX_SRC_LPTMR0         = 21U,  /**< LPTMR0 compare */
+    TRGMUX_SRC_FTM0_INIT      = 22U,  /**< FTM0 initialization trigger */
+    TRGMUX_SRC_FTM0_EXT       = 23U,  /**< FTM0 external trigger */
+    TRGMUX_SRC_FTM1_INIT      = 24U,  /**< FTM1 initialization trigger */
+    TRGMUX_SRC_FTM1_EXT       = 25U,  /**< FTM1 external trigger */
+    TRGMUX_SRC_FTM2_INIT      = 26U,  /**< FTM2 initialization trigger */
+    TRGMUX_SRC_FTM2_EXT       = 27U,  /**< FTM2 external trigger */
+    TRGMUX_SRC_FTM3_INIT      = 28U,  /**< FTM3 initialization trigger */
+    TRGMUX_SRC_FTM3_EXT       = 29U,  /**< FTM3 external trigger */
+    TRGMUX_SRC_ADC0_SC1A_COCO = 30U,  /**< ADC0 SC1[0] conversion complete */
+    TRGMUX_SRC_ADC1_SC1A_COCO = 32U,  /**< ADC1 SC1[0] conversion complete */
+    TRGMUX_SRC_PDB0_CH0_TRIG  = 34U,  /**< PDB0 channel 0 pre-trigger */
+    TRGMUX_SRC_PDB1_CH0_TRIG  = 37U   /**< PDB1 channel 0 pre-trigger */
+} trgmux_source_t;
+
+/**
+ * @brief TRGMUX targets (TRGMUXn register index)
+ */
+typedef enum {
+    TRGMUX_TARGET_DMAMUX0 = 0U,       /**< DMAMUX0 always-on trigger inputs */
+    TRGMUX_TARGET_EXTOUT0 = 1U,       /**< TRGMUX_OUT0-3 pins */
+    TRGMUX_TARGET_EXTOUT1 = 2U,       /**< TRGMUX_OUT4-7 pins */
+    TRGMUX_TARGET_ADC0    = 3U,       /**< ADC0 hardware trigger (SIM ADCOPT = TRGMUX) */
+    TRGMUX_TARGET_ADC1    = 4U,       /**< ADC1 hardware trigger (SIM ADCOPT = TRGMUX) */
+    TRGMUX_TARGET_CMP0    = 7U,       /**< CMP0 sample / window */
+    TRGMUX_TARGET_FTM0    = 10U,      /**< FTM0 hardware triggers */
+    TRGMUX_TARGET_FTM1    = 11U,      /**< FTM1 hardware triggers */
+    TRGMUX_TARGET_FTM2    = 12U,      /**< FTM2 hardware triggers */
+    TRGMUX_TARGET_FTM3    = 13U,      /**< FTM3 hardware triggers */
+    TRGMUX_TARGET_PDB0    = 14U,      /**< PDB0 trigger input (PDB TRGSEL = 0) */
+    TRGMUX_TARGET_PDB1    = 15U,      /**< PDB1 trigger input (PDB TRGSEL = 0) */
+    TRGMUX_TARGET_FLEXIO  = 17U,      /**< FlexIO timer triggers */
+    TRGMUX_TARGET_LPIT0   = 18U,      /**< LPIT0 channel triggers */
+    TRGMUX_TARGET_LPUART0 = 19U,      /**< LPUART0 trigger */
+    TRGMUX_TARGET_LPUART1 = 20U,      /**< LPUART1 trigger */
+    TRGMUX_TARGET_LPI2C0  = 21U,      /**< LPI2C0 trigger */
+    TRGMUX_TARGET_LPSPI0  = 23U,      /**< LPSPI0 trigger */
+    TRGMUX_TARGET_LPSPI1  = 24U,      /**< LPSPI1 trigger */
+    TRGMUX_TARGET_LPTMR0  = 25U       /**< LPTMR0 trigger */
+} trgmux_target_t;
+
+/**
+ * @brief ADC hardware trigger path (SIM ADCOPT)
+ */
+typedef enum {
+    TRGMUX_ADC_TRIGGER_PDB    = 0U,   /**< PDB triggers and pre-triggers (reset default) */
+    TRGMUX_ADC_TRIGGER_TRGMUX = 1U    /**< TRGMUX_ADCx SELn triggers SC1[n] */
+} trgmux_adc_trigger_t;
+
+/**
+ * @brief One trigger route (source -> target input)
+ * @details Input meaning depends on the target:
+ *          - ADC0/ADC1: SEL n triggers conversion of SC1[n]
+ *          - DMAMUX0: SEL n is the periodic trigger of DMA channel n (0-3),
+ *            enable it with DMA_SetPeriodicTrigger()
+ *          - PDB0/PDB1: single input, use 0
+ */
+typedef struct {
+    trgmux_source_t source;           /**< Trigger source */
+    trgmux_target_t target;           /**< TRGMUXn register */
+    uint8_t input;                    /**< SEL field (0-3) */
+} trgmux_route_t;
+
+/** @brief Route table initializer */
+#define TRGMUX_ROUTE(src, tgt, in)    { (src), (tgt), (uint8_t)(in) }
+
+/** @} */
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @defgroup TRGMUX_Functions TRGMUX Functions
+ * @{
+ */
+
+/**
+ * @brief Route a trigger source to one input of a target
+ * @param[in] target TRGMUXn register
+ * @param[in] input  SEL field (0-3), 0 for single-input targets such as PDB
+ * @param[in] source Trigger source
+ * @retval STATUS_SUCCESS Routing written
+ * @retval STATUS_ERROR   Invalid input or register locked
+ */
+status_t TRGMUX_SetSource(trgmux_target_t target, uint8_t input, trgmux_source_t source);
+
+/**
+ * @brief Get the source routed to one input of a target
+ * @param[in] target TRGMUXn register
+ * @param[in] input  SEL field (0-3)
+ * @return trgmux_source_t Current source (TRGMUX_SRC_DISABLED for invalid input)
+ */
+trgmux_source_t TRGMUX_GetSource(trgmux_target_t target, uint8_t input);
+
+/**
+ * @brief Lock a target register until the next reset
+ * @param[in] target TRGMUXn register
+ */
+void TRGMUX_Lock(trgmux_target_t target);
+
+/**
+ * @brief Check whether a target register is locked
+ * @param[in] target TRGMUXn register
+ * @return bool true if LK is set
+ */
+bool TRGMUX_IsLocked(trgmux_target_t target);
+
+/**
+ * @brief Select the hardware trigger path of an ADC
+ * @param[in] adcInstance ADC instance (0-1)
+ * @param[in] trigger     PDB or TRGMUX
+ * @retval STATUS_SUCCESS ADCOPT written
+ * @retval STATUS_ERROR   Invalid instance
+ * @note Set the path before enabling ADC hardware trigger (SC2 ADTRG)
+ */
+status_t TRGMUX_SetAdcTrigger(uint8_t adcInstance, trgmux_adc_trigger_t trigger);
+
+/**
+ * @brief Apply a route table
+ * @details All routes are validated before any register is written. Routes to
+ *          TRGMUX_TARGET_ADCx select the TRGMUX trigger path of that ADC,
+ *          routes to TRGMUX_TARGET_PDBx restore the PDB path of ADCx.
+ *          Route the trigger source last: configure LPIT / PDB / DMA first,
+ *          start the source timer after this call.
+ * @param[in] routes Route table
+ * @param[in] count  Number of routes
+ * @param[in] lock   Lock every written target register until reset
+ * @retval STATUS_SUCCESS All routes written
+ * @retval STATUS_ERROR   Invalid route or locked target, nothing written
+ */
+status_t TRGMUX_ApplyRoutes(const trgmux_route_t *routes, uint32_t count, bool lock);
+
+/**
+ * @brief Disconnect every route of a table (SEL = TRGMUX_SRC_DISABLED)
+ * @param[in] routes Route table
+ * @param[in] count  Number of routes
+ * @note ADC trigger path selection is left unchanged; locked targets are skipped
+ */
+void TRGMUX_ClearRoutes(const trgmux_route_t *routes, uint32_t count);
+
+/** @} */
+
+#endif /* TRGMUX_H */
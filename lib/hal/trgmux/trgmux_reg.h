@@ -0,0 +1,79 @@
+/**
+ * @file    trgmux_reg.h
+ * @brief   TRGMUX (Trigger Multiplexer) Register Definitions for S32K144
+ * @details
+ * Defines TRGMUX module registers and bitfields.
+ * Each TRGMUXn register routes up to 4 trigger sources (SEL0-SEL3) to one
+ * peripheral trigger input (ADC, PDB, DMAMUX, FTM, LPIT, ...).
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ *
+ * @note    Refer to S32K1xx Reference Manual Chapter 24 (TRGMUX)
+ * @warning A register with LK set cannot be changed until the next reset
+ */
+
+#ifndef TRGMUX_REG_H
+#define TRGMUX_REG_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "def_reg.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief TRGMUX module base address */
+#define TRGMUX_BASE_ADDR        (0x40063000UL)
+
+/** @brief Number of TRGMUXn registers */
+#define TRGMUX_REG_COUNT        (26U)
+
+/** @brief Number of SEL fields per TRGMUXn register */
+#define TRGMUX_SEL_COUNT        (4U)
+
+/*******************************************************************************
+ * TRGMUX Register Structure
+ ******************************************************************************/
+
+/**
+ * @brief TRGMUX Register Structure
+ */
+typedef struct {
+    __IO uint32_t TRGMUXn[TRGMUX_REG_COUNT];    /**< Target registers, offset: 0x0, step: 0x4 */
+} TRGMUX_RegType;
+
+/** @brief TRGMUX register pointer */
+#define TRGMUX                  ((TRGMUX_RegType *)TRGMUX_BASE_ADDR)
+
+/*******************************************************************************
+ * TRGMUXn Register Bit Definitions
+ ******************************************************************************/
+
+/** @brief SELx: trigger source of input x (x = 0-3), 8-bit field stride */
+#define TRGMUX_SEL_WIDTH        (8U)
+#define TRGMUX_SEL_MASK         (0x3FU)
+#define TRGMUX_SEL_SHIFT(x)     ((uint32_t)(x) * TRGMUX_SEL_WIDTH)
+
+/** @brief LK: register locked until reset */
+#define TRGMUX_LK_MASK          (0x80000000UL)
+#define TRGMUX_LK_SHIFT         (31U)
+
+/*******************************************************************************
+ * SIM ADCOPT (ADC trigger source select)
+ ******************************************************************************/
+
+/** @brief SIM_ADCOPT: selects PDB or TRGMUX as ADC trigger / pre-trigger source */
+#define TRGMUX_SIM_ADCOPT               (*(volatile uint32_t *)0x40048018UL)
+
+/** @brief ADCxTRGSEL: 0 = PDB, 1 = TRGMUX (ADC1 fields are ADC0 fields << 8) */
+#define TRGMUX_ADCOPT_TRGSEL_MASK(n)    (0x1UL << ((uint32_t)(n) * 8U))
+
+/** @brief ADCxPRETRGSEL: 0 = PDB pre-trigger, 1 = TRGMUX pre-trigger */
+#define TRGMUX_ADCOPT_PRETRGSEL_MASK(n) (0x30UL << ((uint32_t)(n) * 8U))
+#define TRGMUX_ADCOPT_PRETRGSEL(n, x)   (((uint32_t)(x) << 4U) << ((uint32_t)(n) * 8U))
+
+#endif /* TRGMUX_REG_H */
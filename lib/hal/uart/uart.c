@@ -15,6 +15,9 @@
 #include "uart_reg.h"
 #include "pcc.h"
 #include "clock_manager.h"
+#include "scg.h"
+#include "nvic.h"
+#include "osal.h"
 #if UART_DMA_ENABLE
 #include "dma.h"
 #endif
@@ -32,9 +35,126 @@
 /* Number of hardware UART instances available on S32K144 */
 #define UART_INSTANCE_COUNT     (3U)
 
+/* Instances with driver state (hal_config.h), the state tables hold only these */
+#define UART_STATE_COUNT        (HAL_LPUART0_ENABLE + HAL_LPUART1_ENABLE + HAL_LPUART2_ENABLE)
+
 /* Default clock source used when enabling UART via PCC */
 #define UART_DEFAULT_CLK_SOURCE PCC_CLK_SRC_SOSC_DIV2
 
+/* Ring buffer index masks */
+#define UART_TX_RING_MASK       (UART_TX_RING_SIZE - 1U)
+#define UART_RX_RING_MASK       (UART_RX_RING_SIZE - 1U)
+
+#if ((UART_TX_RING_SIZE & UART_TX_RING_MASK) != 0U) || ((UART_RX_RING_SIZE & UART_RX_RING_MASK) != 0U)
+#error "UART_TX_RING_SIZE and UART_RX_RING_SIZE must be powers of 2"
+#endif
+
+/* Idle characters before RDRF is forced with data below the RX watermark */
+#define UART_FIFO_RX_IDLE       (1U)
+
+/* Status flags that report a low-power wakeup */
+#define UART_WAKEUP_FLAGS       (LPUART_STAT_RXEDGIF_MASK | LPUART_STAT_MA1F_MASK | LPUART_STAT_MA2F_MASK)
+
+/* Keep the compiler from moving ring data writes past the index update */
+#define UART_COMPILER_BARRIER() __asm volatile ("" : : : "memory")
+
+/* Status flags cleared by the ring buffer ISR */
+#define UART_ASYNC_ERROR_FLAGS  (LPUART_STAT_OR_MASK | LPUART_STAT_PF_MASK | \
+                                 LPUART_STAT_FE_MASK | LPUART_STAT_NF_MASK)
+
+/* TC interrupt needed when the TX ring drains */
+#if OSAL_FREERTOS
+#define UART_TC_WANTED(instance, callbacks) \
+    (((callbacks)->txComplete != NULL) || s_uartOsal[(instance)].txWaiting)
+#else
+#define UART_TC_WANTED(instance, callbacks) ((callbacks)->txComplete != NULL)
+#endif
+
+/* Error interrupts armed while an error callback is installed */
+#define UART_ERROR_INT_MASK     (LPUART_CTRL_PEIE_MASK | LPUART_CTRL_FEIE_MASK | LPUART_CTRL_NEIE_MASK)
+
+/**
+ * @brief Interrupt-driven transfer state
+ * @details Single producer / single consumer rings: the application owns
+ *          txHead and rxTail, the ISR owns txTail and rxHead.
+ */
+typedef struct uart_async_state {
+    uint8_t txBuf[UART_TX_RING_SIZE];   /**< TX ring storage */
+    uint8_t rxBuf[UART_RX_RING_SIZE];   /**< RX ring storage */
+    volatile uint32_t txHead;           /**< Next write index (application) */
+    volatile uint32_t txTail;           /**< Next send index (ISR) */
+    volatile uint32_t rxHead;           /**< Next store index (ISR) */
+    volatile uint32_t rxTail;           /**< Next read index (application) */
+    volatile uint32_t rxDropped;        /**< Bytes lost to ring full / overrun */
+    uint8_t txFifoDepth;                /**< Hardware TX FIFO depth */
+    bool enabled;                       /**< Async mode active */
+} uart_async_state_t;
+
+#if UART_DMA_ENABLE
+/**
+ * @brief Circular DMA RX state
+ * @details readPos is only touched by UART_PollCircularRxDMA(), which runs
+ *          from the LPUART and DMA interrupts at the same priority.
+ */
+typedef struct {
+    LPUART_RegType *base;               /**< Owning UART instance */
+    uint8_t *buffer;                    /**< Circular buffer being written by DMA */
+    uint16_t size;                      /**< Buffer size in bytes */
+    uint16_t readPos;                   /**< First byte not yet reported */
+    uint8_t channel;                    /**< DMA channel */
+    UART_RxDmaCallback_t callback;      /**< New data callback */
+    void *userData;                     /**< Callback user data */
+    bool active;                        /**< Circular reception running */
+} uart_rx_dma_state_t;
+
+/** @brief Ping-pong TX buffer state */
+typedef enum {
+    UART_PP_FREE = 0U,      /**< Owned by the application */
+    UART_PP_QUEUED,         /**< Committed, waiting for the other buffer */
+    UART_PP_SENDING         /**< Being read by DMA */
+} uart_pp_buf_state_t;
+
+/**
+ * @brief Ping-pong DMA TX state
+ * @details bufState is shared with the DMA ISR, application-side updates
+ *          are done with interrupts masked.
+ */
+typedef struct {
+    uint8_t *buffer[2];                 /**< Buffer A / B */
+    uint16_t length[2];                 /**< Committed length per buffer */
+    volatile uint8_t bufState[2];       /**< uart_pp_buf_state_t per buffer */
+    uint16_t size;                      /**< Capacity of each buffer */
+    uint8_t fillIndex;                  /**< Buffer handed to the application */
+    uint8_t channel;                    /**< DMA channel */
+    bool active;                        /**< Ping-pong mode running */
+} uart_pp_tx_state_t;
+#endif
+
+#if OSAL_FREERTOS
+/**
+ * @brief RTOS state per instance
+ * @details txWaiting / rxWaiting tell the ISR that a task sleeps in
+ *          UART_SendBlocking() / UART_ReceiveBlocking().
+ */
+typedef struct {
+    osal_mutex_t txLock;                /**< Serialises UART_SendBlocking() */
+    osal_mutex_t rxLock;                /**< Serialises UART_ReceiveBlocking() */
+    osal_event_t txDone;                /**< Ring drained and TC set */
+    osal_event_t rxReady;               /**< New bytes in the RX ring */
+    volatile bool txWaiting;
+    volatile bool rxWaiting;
+} uart_osal_state_t;
+#endif
+
+/**
+ * @brief Per-instance low-power wakeup state
+ */
+typedef struct {
+    UART_WakeupCallback_t callback;     /**< Wakeup callback */
+    void *userData;                     /**< Callback context */
+    volatile uint32_t source;           /**< Accumulated UART_WakeupSource_t flags */
+} uart_wakeup_state_t;
+
 /*******************************************************************************
  * Private Data
  ******************************************************************************/
@@ -51,17 +171,69 @@ static const uint8_t s_uartPccIndexMap[UART_INSTANCE_COUNT] = {
     PCC_LPUART2_INDEX
 };
 
+/* Hardware instance number of each state slot */
+static const uint8_t s_uartStateInstance[UART_STATE_COUNT] = {
+#if (HAL_LPUART0_ENABLE == 1U)
+    0U,
+#endif
+#if (HAL_LPUART1_ENABLE == 1U)
+    1U,
+#endif
+#if (HAL_LPUART2_ENABLE == 1U)
+    2U,
+#endif
+};
+
+/* Interrupt-driven rings: CPU only, kept off the DMA bank */
+static uart_async_state_t s_uartAsync[UART_STATE_COUNT] FAST_DATA_SRAM_L;
+
+static uart_wakeup_state_t s_uartWakeup[UART_STATE_COUNT];
+
+/* Event callbacks installed with UART_InstallCallbacks() */
+static UART_Callbacks_t s_uartCallbacks[UART_STATE_COUNT];
+
+/* Requested and achieved baud rate from the last UART_Init() */
+static uint32_t s_uartBaudTarget[UART_STATE_COUNT];
+static uint32_t s_uartBaudActual[UART_STATE_COUNT];
+
+/* TE / RE bits cleared by the clock notifier between BEFORE and AFTER */
+static uint32_t s_uartClockPaused[UART_STATE_COUNT];
+
+#if OSAL_FREERTOS
+static uart_osal_state_t s_uartOsal[UART_STATE_COUNT];
+#endif
+
+#if UART_DMA_ENABLE
+static uart_rx_dma_state_t s_uartRxDma[UART_STATE_COUNT];
+
+/* Scatter-gather TCD pool (first segment lives in the channel TCD), 32-byte aligned */
+#if (UART_DMA_MAX_IOV < 2U)
+#error "UART_DMA_MAX_IOV must be at least 2"
+#endif
+static DMA_TCD_Type s_uartTxSgTcd[UART_STATE_COUNT][UART_DMA_MAX_IOV - 1U] __attribute__((aligned(32))) DMA_BUFFER_SRAM_U;
+static uint8_t s_uartTxSgChannel[UART_STATE_COUNT];
+static bool s_uartTxSgUsed[UART_STATE_COUNT];
+
+static uart_pp_tx_state_t s_uartPpTx[UART_STATE_COUNT];
+#endif
+
 /*******************************************************************************
  * Private Functions
  ******************************************************************************/
 
+/**
+ * @brief Map a base address to its driver state slot
+ * @details The slot indexes the s_uart* state tables. It equals the LPUART
+ *          number unless instances are compiled out in hal_config.h; use
+ *          s_uartStateInstance[] where the hardware number is needed.
+ */
 static bool UART_GetInstanceFromBase(const LPUART_RegType *base, uint8_t *instance)
 {
     if (base == NULL) {
         return false;
     }
 
-#if defined(LPUART0)
+#if defined(LPUART0) && (HAL_LPUART0_ENABLE == 1U)
     if (base == LPUART0) {
         if (instance != NULL) {
             *instance = 0U;
@@ -70,19 +242,19 @@ static bool UART_GetInstanceFromBase(const LPUART_RegType *base, uint8_t *instan
     }
 #endif
 
-#if defined(LPUART1)
+#if defined(LPUART1) && (HAL_LPUART1_ENABLE == 1U)
     if (base == LPUART1) {
         if (instance != NULL) {
-            *instance = 1U;
+            *instance = (uint8_t)HAL_LPUART0_ENABLE;
         }
         return true;
     }
 #endif
 
-#if defined(LPUART2)
+#if defined(LPUART2) && (HAL_LPUART2_ENABLE == 1U)
     if (base == LPUART2) {
         if (instance != NULL) {
-            *instance = 2U;
+            *instance = (uint8_t)(HAL_LPUART0_ENABLE + HAL_LPUART1_ENABLE);
         }
         return true;
     }
@@ -93,11 +265,19 @@ static bool UART_GetInstanceFromBase(const LPUART_RegType *base, uint8_t *instan
 
 static uint32_t UART_GetInstanceClockFreqInternal(uint8_t instance)
 {
+    uint32_t freq;
+
     if (instance >= UART_INSTANCE_COUNT) {
         return 0U;
     }
 
-    return ClockManager_GetFrequency(s_uartClockNameMap[instance]);
+    /* Live PCC read first, the Clock Manager cache may predate a PCS change */
+    freq = PCC_GetLpuartClockFreq(instance);
+    if (freq == 0U) {
+        freq = ClockManager_GetFrequency(s_uartClockNameMap[instance]);
+    }
+
+    return freq;
 }
 
 static bool UART_GetPccIndex(uint8_t instance, uint8_t *pccIndex)
@@ -110,18 +290,150 @@ static bool UART_GetPccIndex(uint8_t instance, uint8_t *pccIndex)
     return true;
 }
 
+/**
+ * @brief Decode FIFO depth field (TXFIFOSIZE/RXFIFOSIZE)
+ */
+static uint8_t UART_DecodeFifoDepth(uint32_t sizeField)
+{
+    return (sizeField == 0U) ? 1U : (uint8_t)(1U << (sizeField + 1U));
+}
+
+/**
+ * @brief Program FIFO enables and watermarks
+ * @note TE and RE must be disabled by the caller
+ */
+static void UART_ConfigFifo(LPUART_RegType *base, uint8_t txWatermark, uint8_t rxWatermark)
+{
+    uint32_t fifo = base->FIFO;
+    uint8_t depth = UART_DecodeFifoDepth((fifo & LPUART_FIFO_TXFIFOSIZE_MASK) >> LPUART_FIFO_TXFIFOSIZE_SHIFT);
+
+    if (txWatermark >= depth) {
+        txWatermark = depth - 1U;
+    }
+    if (rxWatermark >= depth) {
+        rxWatermark = depth - 1U;
+    }
+
+    base->WATER = LPUART_WATER_TXWATER(txWatermark) | LPUART_WATER_RXWATER(rxWatermark);
+
+    fifo &= ~(LPUART_FIFO_RXIDEN_MASK | LPUART_FIFO_RXUF_MASK | LPUART_FIFO_TXOF_MASK);
+    if (rxWatermark > 0U) {
+        fifo |= LPUART_FIFO_RXIDEN(UART_FIFO_RX_IDLE);
+    }
+
+    base->FIFO = fifo | LPUART_FIFO_TXFE_MASK | LPUART_FIFO_RXFE_MASK |
+                 LPUART_FIFO_TXFLUSH_MASK | LPUART_FIFO_RXFLUSH_MASK;
+}
+
+/**
+ * @brief Get async state for a UART base, NULL if async mode is not enabled
+ */
+static uart_async_state_t *UART_GetAsyncState(const LPUART_RegType *base)
+{
+    uint8_t instance;
+
+    if (!UART_GetInstanceFromBase(base, &instance)) {
+        return NULL;
+    }
+
+    return s_uartAsync[instance].enabled ? &s_uartAsync[instance] : NULL;
+}
+
+/**
+ * @brief Copy data into the TX ring and arm TIE, state NULL = async mode off
+ */
+static UART_Status_t UART_RingWrite(LPUART_RegType *base, uart_async_state_t *state,
+                                    const uint8_t *txBuff, uint32_t txSize, uint32_t *written)
+{
+    uint32_t head;
+    uint32_t space;
+    uint32_t count;
+    uint32_t i;
+
+    if (written != NULL) {
+        *written = 0U;
+    }
+
+    if ((state == NULL) || (txBuff == NULL)) {
+        return UART_STATUS_ERROR;
+    }
+
+    head = state->txHead;
+    space = UART_TX_RING_SIZE - (head - state->txTail);
+    count = (txSize < space) ? txSize : space;
+
+    for (i = 0U; i < count; i++) {
+        state->txBuf[(head + i) & UART_TX_RING_MASK] = txBuff[i];
+    }
+
+    UART_COMPILER_BARRIER();
+    state->txHead = head + count;
+
+    /* ISR clears TIE when the ring runs empty */
+    if (count > 0U) {
+        base->CTRL |= LPUART_CTRL_TIE_MASK;
+    }
+
+    if (written != NULL) {
+        *written = count;
+    }
+
+    return (count == txSize) ? UART_STATUS_SUCCESS : UART_STATUS_BUSY;
+}
+
+/**
+ * @brief Copy received bytes out of the RX ring, state NULL = async mode off
+ */
+static uint32_t UART_RingRead(uart_async_state_t *state, uint8_t *rxBuff, uint32_t rxSize)
+{
+    uint32_t tail;
+    uint32_t count;
+    uint32_t i;
+
+    if ((state == NULL) || (rxBuff == NULL)) {
+        return 0U;
+    }
+
+    tail = state->rxTail;
+    count = state->rxHead - tail;
+    if (count > rxSize) {
+        count = rxSize;
+    }
+
+    UART_COMPILER_BARRIER();
+
+    for (i = 0U; i < count; i++) {
+        rxBuff[i] = state->rxBuf[(tail + i) & UART_RX_RING_MASK];
+    }
+
+    UART_COMPILER_BARRIER();
+    state->rxTail = tail + count;
+
+    return count;
+}
+
 /**
  * @brief Calculate baud rate register value
+ * @details Searches OSR 4..32 with a rounded SBR for each, preferring the
+ *          highest OSR on ties (more samples per bit, better noise margin).
+ * @return Achieved baud rate, 0 if no divisor fits
  */
-static void UART_CalculateBaudRate(uint32_t srcClock, uint32_t baudRate, 
-                                   uint32_t *sbr, uint32_t *osr)
+static uint32_t UART_CalculateBaudRate(uint32_t srcClock, uint32_t baudRate, 
+                                       uint32_t *sbr, uint32_t *osr)
 {
     uint32_t tempOsr, tempSbr;
     uint32_t calculatedBaud, tempDiff, minDiff = 0xFFFFFFFFU;
-    
+    uint32_t bestBaud = 0U;
+    uint32_t divisor;
+
+    if (baudRate == 0U) {
+        return 0U;
+    }
+
     /* Try different OSR values to find best match */
     for (tempOsr = 4U; tempOsr <= 32U; tempOsr++) {
-        tempSbr = (srcClock / (baudRate * tempOsr));
+        divisor = baudRate * tempOsr;
+        tempSbr = (srcClock + (divisor / 2U)) / divisor;
         
         if ((tempSbr >= 1U) && (tempSbr <= 8191U)) {
             calculatedBaud = srcClock / (tempOsr * tempSbr);
@@ -133,14 +445,93 @@ static void UART_CalculateBaudRate(uint32_t srcClock, uint32_t baudRate,
                 tempDiff = baudRate - calculatedBaud;
             }
             
-            /* Check if this is better */
-            if (tempDiff < minDiff) {
+            /* Check if this is at least as good */
+            if (tempDiff <= minDiff) {
                 minDiff = tempDiff;
+                bestBaud = calculatedBaud;
                 *sbr = tempSbr;
                 *osr = tempOsr - 1U;  /* OSR field is (actual OSR - 1) */
             }
         }
     }
+
+    return bestBaud;
+}
+
+/**
+ * @brief Signed baud rate error in ppm
+ */
+static int32_t UART_BaudErrorPpm(uint32_t actualBaud, uint32_t targetBaud)
+{
+    int64_t diff = (int64_t)actualBaud - (int64_t)targetBaud;
+
+    return (targetBaud == 0U) ? 0 : (int32_t)((diff * 1000000LL) / (int64_t)targetBaud);
+}
+
+/**
+ * @brief Clock Manager notifier, keeps the baud rate across clock switches
+ * @details BEFORE: lets the last frame leave the shifter, then clears TE / RE
+ *          so nothing is sampled on the old divider with the new clock.
+ *          AFTER: recomputes SBR / OSR for the stored target from the live
+ *          PCC clock and restores TE / RE. If the new clock cannot reach the
+ *          target within UART_BAUD_MAX_ERROR_PPM the instance stays disabled
+ *          and UART_GetActualBaudRate() returns 0.
+ */
+static void UART_ClockNotifier(clock_notify_event_t event, void *userData)
+{
+    LPUART_RegType *base = (LPUART_RegType *)userData;
+    uint32_t timeout = UART_TIMEOUT_COUNT;
+    uint32_t sbr = 0U, osr = UART_DEFAULT_OSR;
+    uint32_t actualBaud;
+    int32_t errorPpm;
+    uint32_t baudReg;
+    uint8_t instance;
+
+    /* Registers of a gated module fault on access (UART_DisableClock() also updates the cache) */
+    if (!UART_GetInstanceFromBase(base, &instance) ||
+        !PCC_IsPeripheralClockEnabled(s_uartPccIndexMap[s_uartStateInstance[instance]])) {
+        return;
+    }
+
+    if (event == CLOCK_NOTIFY_BEFORE) {
+        if ((base->CTRL & LPUART_CTRL_TE_MASK) != 0U) {
+            while (((base->STAT & LPUART_STAT_TC_MASK) == 0U) && (timeout > 0U)) {
+                timeout--;
+            }
+        }
+        s_uartClockPaused[instance] |= base->CTRL & (LPUART_CTRL_TE_MASK | LPUART_CTRL_RE_MASK);
+        base->CTRL &= ~(LPUART_CTRL_TE_MASK | LPUART_CTRL_RE_MASK);
+        return;
+    }
+
+    if (s_uartBaudTarget[instance] == 0U) {
+        return;
+    }
+
+    /* AFTER without BEFORE (e.g. PCC change + ClockManager_Update()): disable first */
+    s_uartClockPaused[instance] |= base->CTRL & (LPUART_CTRL_TE_MASK | LPUART_CTRL_RE_MASK);
+    base->CTRL &= ~(LPUART_CTRL_TE_MASK | LPUART_CTRL_RE_MASK);
+
+    actualBaud = UART_CalculateBaudRate(UART_GetInstanceClockFreqInternal(s_uartStateInstance[instance]),
+                                        s_uartBaudTarget[instance], &sbr, &osr);
+    errorPpm = UART_BaudErrorPpm(actualBaud, s_uartBaudTarget[instance]);
+    if ((actualBaud == 0U) || (errorPpm > (int32_t)UART_BAUD_MAX_ERROR_PPM) ||
+        (errorPpm < -(int32_t)UART_BAUD_MAX_ERROR_PPM)) {
+        s_uartBaudActual[instance] = 0U;
+        return;
+    }
+
+    /* Only the divider fields change, stop bits / M10 / DMA / interrupt enables stay */
+    baudReg = base->BAUD & ~(LPUART_BAUD_SBR_MASK | LPUART_BAUD_OSR_MASK | LPUART_BAUD_BOTHEDGE_MASK);
+    baudReg |= LPUART_BAUD_SBR(sbr) | LPUART_BAUD_OSR(osr);
+    if (osr < 7U) {
+        baudReg |= LPUART_BAUD_BOTHEDGE_MASK;
+    }
+    base->BAUD = baudReg;
+    s_uartBaudActual[instance] = actualBaud;
+
+    base->CTRL |= s_uartClockPaused[instance];
+    s_uartClockPaused[instance] = 0U;
 }
 
 /*******************************************************************************
@@ -153,6 +544,8 @@ static void UART_CalculateBaudRate(uint32_t srcClock, uint32_t baudRate,
 UART_Status_t UART_Init(LPUART_RegType *base, const UART_Config_t *config, uint32_t srcClock)
 {
     uint32_t sbr = 0U, osr = UART_DEFAULT_OSR;
+    uint32_t actualBaud;
+    int32_t errorPpm;
     uint32_t baudReg = 0U;
     uint32_t ctrlReg = 0U;
     uint32_t effectiveSrcClock = srcClock;
@@ -167,26 +560,50 @@ UART_Status_t UART_Init(LPUART_RegType *base, const UART_Config_t *config, uint3
             return UART_STATUS_ERROR;
         }
 
-        effectiveSrcClock = UART_GetInstanceClockFreqInternal(instance);
+        effectiveSrcClock = UART_GetInstanceClockFreqInternal(s_uartStateInstance[instance]);
     }
 
     if (effectiveSrcClock == 0U) {
         return UART_STATUS_ERROR;
     }
 
+    /* Reject rates the clock cannot produce within tolerance */
+    actualBaud = UART_CalculateBaudRate(effectiveSrcClock, config->baudRate, &sbr, &osr);
+    errorPpm = UART_BaudErrorPpm(actualBaud, config->baudRate);
+    if ((actualBaud == 0U) || (errorPpm > (int32_t)UART_BAUD_MAX_ERROR_PPM) ||
+        (errorPpm < -(int32_t)UART_BAUD_MAX_ERROR_PPM)) {
+        return UART_STATUS_ERROR;
+    }
+
     /* Disable transmitter and receiver before configuration */
     LPUART_DISABLE_TX(base);
     LPUART_DISABLE_RX(base);
 
-    /* Software reset */
+    /* Software reset (also disables FIFOs, so async mode must be re-enabled) */
     LPUART_SW_RESET(base);
     base->GLOBAL &= ~LPUART_GLOBAL_RST_MASK;
 
-    /* Calculate baud rate parameters */
-    UART_CalculateBaudRate(effectiveSrcClock, config->baudRate, &sbr, &osr);
+    if (UART_GetInstanceFromBase(base, &instance)) {
+        s_uartAsync[instance].enabled = false;
+        s_uartBaudTarget[instance] = config->baudRate;
+        s_uartBaudActual[instance] = actualBaud;
+        s_uartClockPaused[instance] = 0U;
+        (void)ClockManager_RegisterNotifier(UART_ClockNotifier, base);
+#if OSAL_FREERTOS
+        if ((OSAL_MutexInit(&s_uartOsal[instance].txLock) != OSAL_STATUS_SUCCESS) ||
+            (OSAL_MutexInit(&s_uartOsal[instance].rxLock) != OSAL_STATUS_SUCCESS)) {
+            return UART_STATUS_ERROR;
+        }
+#endif
+    }
 
     /* Configure BAUD register */
     baudReg = LPUART_BAUD_SBR(sbr) | LPUART_BAUD_OSR(osr);
+
+    /* Sampling on both edges is mandatory for OSR 4x..7x */
+    if (osr < 7U) {
+        baudReg |= LPUART_BAUD_BOTHEDGE_MASK;
+    }
     
     /* Configure stop bits */
     if (config->stopBits == UART_TWO_STOP_BIT) {
@@ -217,6 +634,11 @@ UART_Status_t UART_Init(LPUART_RegType *base, const UART_Config_t *config, uint3
     
     base->CTRL = ctrlReg;
 
+    /* FIFOs can only be enabled while TE and RE are cleared */
+    if (config->enableFifo) {
+        UART_ConfigFifo(base, config->txWatermark, config->rxWatermark);
+    }
+
     /* Enable transmitter and receiver if configured */
     if (config->enableTx) {
         LPUART_ENABLE_TX(base);
@@ -234,6 +656,15 @@ UART_Status_t UART_Init(LPUART_RegType *base, const UART_Config_t *config, uint3
  */
 void UART_Deinit(LPUART_RegType *base)
 {
+    uint8_t instance;
+
+    if (UART_GetInstanceFromBase(base, &instance)) {
+        ClockManager_UnregisterNotifier(UART_ClockNotifier, base);
+        s_uartBaudTarget[instance] = 0U;
+        s_uartBaudActual[instance] = 0U;
+        s_uartClockPaused[instance] = 0U;
+    }
+
     if (base != NULL) {
         /* Disable transmitter and receiver */
         LPUART_DISABLE_TX(base);
@@ -256,6 +687,9 @@ void UART_GetDefaultConfig(UART_Config_t *config)
         config->dataBits  = UART_8_DATA_BITS;
         config->enableTx  = true;
         config->enableRx  = true;
+        config->enableFifo  = true;
+        config->txWatermark = 1U;
+        config->rxWatermark = 2U;
     }
 }
 
@@ -264,17 +698,13 @@ void UART_GetDefaultConfig(UART_Config_t *config)
  ******************************************************************************/
 
 /**
- * @brief Send data in blocking mode
+ * @brief Send data by polling TDRE / TC
  */
-UART_Status_t UART_SendBlocking(LPUART_RegType *base, const uint8_t *txBuff, uint32_t txSize)
+static UART_Status_t UART_SendPolled(LPUART_RegType *base, const uint8_t *txBuff, uint32_t txSize)
 {
     uint32_t i;
     uint32_t timeout;
 
-    if ((base == NULL) || (txBuff == NULL) || (txSize == 0U)) {
-        return UART_STATUS_ERROR;
-    }
-
     for (i = 0U; i < txSize; i++) {
         timeout = UART_TIMEOUT_COUNT;
 
@@ -301,18 +731,14 @@ UART_Status_t UART_SendBlocking(LPUART_RegType *base, const uint8_t *txBuff, uin
 }
 
 /**
- * @brief Receive data in blocking mode
+ * @brief Receive data by polling RDRF
  */
-UART_Status_t UART_ReceiveBlocking(LPUART_RegType *base, uint8_t *rxBuff, uint32_t rxSize)
+static UART_Status_t UART_ReceivePolled(LPUART_RegType *base, uint8_t *rxBuff, uint32_t rxSize)
 {
     uint32_t i;
     uint32_t timeout;
     UART_Status_t errorStatus;
 
-    if ((base == NULL) || (rxBuff == NULL) || (rxSize == 0U)) {
-        return UART_STATUS_ERROR;
-    }
-
     for (i = 0U; i < rxSize; i++) {
         timeout = UART_TIMEOUT_COUNT;
 
@@ -338,6 +764,124 @@ UART_Status_t UART_ReceiveBlocking(LPUART_RegType *base, uint8_t *rxBuff, uint32
     return UART_STATUS_SUCCESS;
 }
 
+#if OSAL_FREERTOS
+/**
+ * @brief Task-context send: ring + TC interrupt, the task sleeps meanwhile
+ */
+static UART_Status_t UART_OsalSend(LPUART_RegType *base, uint8_t instance,
+                                   const uint8_t *txBuff, uint32_t txSize)
+{
+    uart_osal_state_t *os = &s_uartOsal[instance];
+    UART_Status_t status = UART_STATUS_SUCCESS;
+    uint32_t sent = 0U;
+    uint32_t written;
+
+    if (OSAL_MutexLock(&os->txLock, UART_OSAL_TIMEOUT_MS) != OSAL_STATUS_SUCCESS) {
+        return UART_STATUS_BUSY;
+    }
+
+    if (!s_uartAsync[instance].enabled) {
+        status = UART_SendPolled(base, txBuff, txSize);
+    } else {
+        /* One ring-full per wakeup, TC of the last byte ends the call */
+        while ((sent < txSize) && (status == UART_STATUS_SUCCESS)) {
+            OSAL_EventArm(&os->txDone);
+            os->txWaiting = true;
+            (void)UART_RingWrite(base, &s_uartAsync[instance], &txBuff[sent], txSize - sent, &written);
+            sent += written;
+            if (OSAL_EventWait(&os->txDone, UART_OSAL_TIMEOUT_MS) != OSAL_STATUS_SUCCESS) {
+                status = UART_STATUS_TIMEOUT;
+            }
+        }
+        os->txWaiting = false;
+    }
+
+    OSAL_MutexUnlock(&os->txLock);
+
+    return status;
+}
+
+/**
+ * @brief Task-context receive: sleeps until the ring ISR stores new bytes
+ */
+static UART_Status_t UART_OsalReceive(LPUART_RegType *base, uint8_t instance,
+                                      uint8_t *rxBuff, uint32_t rxSize)
+{
+    uart_osal_state_t *os = &s_uartOsal[instance];
+    UART_Status_t status = UART_STATUS_SUCCESS;
+    uint32_t received;
+
+    if (OSAL_MutexLock(&os->rxLock, UART_OSAL_TIMEOUT_MS) != OSAL_STATUS_SUCCESS) {
+        return UART_STATUS_BUSY;
+    }
+
+    if (!s_uartAsync[instance].enabled) {
+        status = UART_ReceivePolled(base, rxBuff, rxSize);
+    } else {
+        received = UART_RingRead(&s_uartAsync[instance], rxBuff, rxSize);
+        while ((received < rxSize) && (status == UART_STATUS_SUCCESS)) {
+            OSAL_EventArm(&os->rxReady);
+            os->rxWaiting = true;
+            /* Bytes stored between the read and the arm must not be slept on */
+            if ((s_uartAsync[instance].rxHead == s_uartAsync[instance].rxTail) &&
+                (OSAL_EventWait(&os->rxReady, UART_OSAL_TIMEOUT_MS) != OSAL_STATUS_SUCCESS)) {
+                status = UART_STATUS_TIMEOUT;
+            }
+            os->rxWaiting = false;
+            received += UART_RingRead(&s_uartAsync[instance], &rxBuff[received], rxSize - received);
+        }
+    }
+
+    OSAL_MutexUnlock(&os->rxLock);
+
+    return status;
+}
+#endif /* OSAL_FREERTOS */
+
+/**
+ * @brief Send data in blocking mode
+ */
+UART_Status_t UART_SendBlocking(LPUART_RegType *base, const uint8_t *txBuff, uint32_t txSize)
+{
+#if OSAL_FREERTOS
+    uint8_t instance;
+#endif
+
+    if ((base == NULL) || (txBuff == NULL) || (txSize == 0U)) {
+        return UART_STATUS_ERROR;
+    }
+
+#if OSAL_FREERTOS
+    if (OSAL_CanBlock() && UART_GetInstanceFromBase(base, &instance)) {
+        return UART_OsalSend(base, instance, txBuff, txSize);
+    }
+#endif
+
+    return UART_SendPolled(base, txBuff, txSize);
+}
+
+/**
+ * @brief Receive data in blocking mode
+ */
+UART_Status_t UART_ReceiveBlocking(LPUART_RegType *base, uint8_t *rxBuff, uint32_t rxSize)
+{
+#if OSAL_FREERTOS
+    uint8_t instance;
+#endif
+
+    if ((base == NULL) || (rxBuff == NULL) || (rxSize == 0U)) {
+        return UART_STATUS_ERROR;
+    }
+
+#if OSAL_FREERTOS
+    if (OSAL_CanBlock() && UART_GetInstanceFromBase(base, &instance)) {
+        return UART_OsalReceive(base, instance, rxBuff, rxSize);
+    }
+#endif
+
+    return UART_ReceivePolled(base, rxBuff, rxSize);
+}
+
 /**
  * @brief Send a single byte
  */
@@ -514,331 +1058,1587 @@ uint32_t UART_GetEnabledInterrupts(LPUART_RegType *base)
 }
 
 /*******************************************************************************
- * Clock Control Functions
+ * FIFO Control Functions
  ******************************************************************************/
 
 /**
- * @brief Enable UART clock
+ * @brief Get hardware FIFO depth
  */
-void UART_EnableClock(uint8_t instance)
+uint8_t UART_GetFifoDepth(LPUART_RegType *base)
 {
-    pcc_config_t config;
-    uint8_t pccIndex;
-
-    if (!UART_GetPccIndex(instance, &pccIndex)) {
-        return;
+    if (base == NULL) {
+        return 0U;
     }
 
-    /* Ensure clock gate is disabled before reconfiguring source */
-    (void)PCC_DisablePeripheralClock(pccIndex);
+    return UART_DecodeFifoDepth((base->FIFO & LPUART_FIFO_TXFIFOSIZE_MASK) >> LPUART_FIFO_TXFIFOSIZE_SHIFT);
+}
 
-    config.clockSource = UART_DEFAULT_CLK_SOURCE;
-    config.enableClock = true;
-    config.divider = 0U;
-    config.fractionalDivider = false;
+/**
+ * @brief Set FIFO watermarks at runtime
+ */
+UART_Status_t UART_SetFifoWatermarks(LPUART_RegType *base, uint8_t txWatermark, uint8_t rxWatermark)
+{
+    uint8_t depth = UART_GetFifoDepth(base);
 
-    (void)PCC_SetPeripheralClockConfig(pccIndex, &config);
+    if ((depth == 0U) || (txWatermark >= depth) || (rxWatermark >= depth)) {
+        return UART_STATUS_ERROR;
+    }
 
-    /* Refresh clock cache so new frequency is visible via Clock Manager */
-    ClockManager_Update();
+    /* WATER can be written at any time, unlike the FIFO enable bits */
+    base->WATER = LPUART_WATER_TXWATER(txWatermark) | LPUART_WATER_RXWATER(rxWatermark);
+
+    return UART_STATUS_SUCCESS;
 }
 
 /**
- * @brief Disable UART clock
+ * @brief Discard all data in the TX FIFO
  */
-void UART_DisableClock(uint8_t instance)
+void UART_FlushTxFifo(LPUART_RegType *base)
 {
-    uint8_t pccIndex;
+    if (base != NULL) {
+        base->FIFO = (base->FIFO & ~(LPUART_FIFO_RXUF_MASK | LPUART_FIFO_TXOF_MASK)) | LPUART_FIFO_TXFLUSH_MASK;
+    }
+}
 
-    if (!UART_GetPccIndex(instance, &pccIndex)) {
-        return;
+/**
+ * @brief Discard all data in the RX FIFO
+ */
+void UART_FlushRxFifo(LPUART_RegType *base)
+{
+    if (base != NULL) {
+        base->FIFO = (base->FIFO & ~(LPUART_FIFO_RXUF_MASK | LPUART_FIFO_TXOF_MASK)) | LPUART_FIFO_RXFLUSH_MASK;
     }
+}
 
-    (void)PCC_DisablePeripheralClock(pccIndex);
-    ClockManager_Update();
+/**
+ * @brief Get number of words in the TX FIFO
+ */
+uint32_t UART_GetTxFifoCount(LPUART_RegType *base)
+{
+    return (base != NULL) ? ((base->WATER & LPUART_WATER_TXCOUNT_MASK) >> LPUART_WATER_TXCOUNT_SHIFT) : 0U;
 }
 
 /**
- * @brief Get current UART functional clock frequency for an instance
+ * @brief Get number of words in the RX FIFO
  */
-uint32_t UART_GetClockFrequency(uint8_t instance)
+uint32_t UART_GetRxFifoCount(LPUART_RegType *base)
 {
-    return UART_GetInstanceClockFreqInternal(instance);
+    return (base != NULL) ? ((base->WATER & LPUART_WATER_RXCOUNT_MASK) >> LPUART_WATER_RXCOUNT_SHIFT) : 0U;
 }
 
 /*******************************************************************************
- * DMA Transfer Functions
+ * Interrupt-Driven Transfer Functions
  ******************************************************************************/
-#if UART_DMA_ENABLE
+
 /**
- * @brief Get DMAMUX source for UART instance TX
+ * @brief Enable interrupt-driven (ring buffer) transfer
  */
-static dmamux_source_t UART_GetTxDmaMuxSource(const LPUART_RegType *base)
+UART_Status_t UART_EnableAsync(LPUART_RegType *base)
 {
-    if (base == LPUART0) {
-        return DMAMUX_SRC_LPUART0_TX;
-    } else if (base == LPUART1) {
-        return DMAMUX_SRC_LPUART1_TX;
-    } else if (base == LPUART2) {
-        return DMAMUX_SRC_LPUART2_TX;
+    uart_async_state_t *state;
+    uint32_t ctrl;
+    uint32_t fifo;
+    uint8_t instance;
+    uint8_t txDepth;
+    uint8_t rxDepth;
+
+    if (!UART_GetInstanceFromBase(base, &instance)) {
+        return UART_STATUS_ERROR;
     }
-    return DMAMUX_SRC_DISABLED;
+
+    state = &s_uartAsync[instance];
+
+    /* FIFO enable bits may only change while TX and RX are disabled */
+    ctrl = base->CTRL;
+    base->CTRL = ctrl & ~(LPUART_CTRL_TE_MASK | LPUART_CTRL_RE_MASK |
+                          LPUART_CTRL_TIE_MASK | LPUART_CTRL_RIE_MASK |
+                          LPUART_CTRL_ORIE_MASK);
+
+    state->enabled = false;
+    state->txHead = 0U;
+    state->txTail = 0U;
+    state->rxHead = 0U;
+    state->rxTail = 0U;
+    state->rxDropped = 0U;
+
+    fifo = base->FIFO;
+    txDepth = UART_DecodeFifoDepth((fifo & LPUART_FIFO_TXFIFOSIZE_MASK) >> LPUART_FIFO_TXFIFOSIZE_SHIFT);
+    rxDepth = UART_DecodeFifoDepth((fifo & LPUART_FIFO_RXFIFOSIZE_MASK) >> LPUART_FIFO_RXFIFOSIZE_SHIFT);
+    state->txFifoDepth = txDepth;
+
+    if ((fifo & (LPUART_FIFO_TXFE_MASK | LPUART_FIFO_RXFE_MASK)) ==
+        (LPUART_FIFO_TXFE_MASK | LPUART_FIFO_RXFE_MASK)) {
+        /* Keep the watermarks chosen in UART_Init(), just flush */
+        base->FIFO = (fifo & ~(LPUART_FIFO_RXUF_MASK | LPUART_FIFO_TXOF_MASK)) |
+                     LPUART_FIFO_TXFLUSH_MASK | LPUART_FIFO_RXFLUSH_MASK;
+    } else {
+        /* TDRE while one entry is still queued, RDRF with one free entry left */
+        UART_ConfigFifo(base, (txDepth > 1U) ? 1U : 0U, (rxDepth > 2U) ? (rxDepth - 2U) : 0U);
+    }
+
+    LPUART_CLEAR_STATUS_FLAG(base, UART_ASYNC_ERROR_FLAGS);
+
+    state->enabled = true;
+
+    /* Restore TE/RE, RX and overrun interrupts on; TIE set on demand */
+    base->CTRL = (ctrl & ~LPUART_CTRL_TIE_MASK) | LPUART_CTRL_RIE_MASK | LPUART_CTRL_ORIE_MASK;
+
+    return UART_STATUS_SUCCESS;
 }
 
 /**
- * @brief Get DMAMUX source for UART instance RX
+ * @brief Disable interrupt-driven transfer
  */
-static dmamux_source_t UART_GetRxDmaMuxSource(const LPUART_RegType *base)
+void UART_DisableAsync(LPUART_RegType *base)
 {
-    if (base == LPUART0) {
-        return DMAMUX_SRC_LPUART0_RX;
-    } else if (base == LPUART1) {
-        return DMAMUX_SRC_LPUART1_RX;
-    } else if (base == LPUART2) {
-        return DMAMUX_SRC_LPUART2_RX;
+    uint8_t instance;
+
+    if (!UART_GetInstanceFromBase(base, &instance)) {
+        return;
     }
-    return DMAMUX_SRC_DISABLED;
+
+    base->CTRL &= ~(LPUART_CTRL_TIE_MASK | LPUART_CTRL_TCIE_MASK | LPUART_CTRL_RIE_MASK | LPUART_CTRL_ORIE_MASK);
+    s_uartAsync[instance].enabled = false;
 }
 
 /**
- * @brief Configure UART for DMA transmission
+ * @brief Queue data for interrupt-driven transmission
  */
-UART_Status_t UART_ConfigTxDMA(LPUART_RegType *base, uint8_t dmaChannel)
+UART_Status_t UART_WriteAsync(LPUART_RegType *base, const uint8_t *txBuff,
+                              uint32_t txSize, uint32_t *written)
 {
-    dmamux_source_t dmaMuxSource;
-    
-    if (base == NULL) {
-        return UART_STATUS_ERROR;
-    }
-    
-    /* Get DMAMUX source for this UART instance */
-    dmaMuxSource = UART_GetTxDmaMuxSource(base);
-    if (dmaMuxSource == DMAMUX_SRC_DISABLED) {
-        return UART_STATUS_ERROR;
-    }
-    
-    /* Enable UART TX DMA request */
-    base->BAUD |= LPUART_BAUD_TDMAE_MASK;
-    
-    return UART_STATUS_SUCCESS;
+    return UART_RingWrite(base, UART_GetAsyncState(base), txBuff, txSize, written);
 }
 
 /**
- * @brief Configure UART for DMA reception
+ * @brief Get number of received bytes waiting in the RX ring
  */
-UART_Status_t UART_ConfigRxDMA(LPUART_RegType *base, uint8_t dmaChannel)
+uint32_t UART_ReadAvailable(LPUART_RegType *base)
 {
-    dmamux_source_t dmaMuxSource;
-    
-    if (base == NULL) {
-        return UART_STATUS_ERROR;
-    }
-    
-    /* Get DMAMUX source for this UART instance */
-    dmaMuxSource = UART_GetRxDmaMuxSource(base);
-    if (dmaMuxSource == DMAMUX_SRC_DISABLED) {
-        return UART_STATUS_ERROR;
+    uart_async_state_t *state = UART_GetAsyncState(base);
+
+    if (state == NULL) {
+        return 0U;
     }
-    
-    /* Enable UART RX DMA request */
-    base->BAUD |= LPUART_BAUD_RDMAE_MASK;
-    
-    return UART_STATUS_SUCCESS;
+
+    return state->rxHead - state->rxTail;
 }
 
 /**
- * @brief Send data using DMA
+ * @brief Read received bytes from the RX ring
  */
-UART_Status_t UART_SendDMA(LPUART_RegType *base, uint8_t dmaChannel, 
-                           const uint8_t *txBuff, uint32_t txSize)
+uint32_t UART_ReadAsync(LPUART_RegType *base, uint8_t *rxBuff, uint32_t rxSize)
 {
-    status_t dmaStatus;
-    dmamux_source_t dmaMuxSource;
-    dma_channel_config_t dmaConfig;
-    
-    if ((base == NULL) || (txBuff == NULL) || (txSize == 0U)) {
-        return UART_STATUS_ERROR;
-    }
-    
-    /* Get DMAMUX source */
-    dmaMuxSource = UART_GetTxDmaMuxSource(base);
-    if (dmaMuxSource == DMAMUX_SRC_DISABLED) {
-        return UART_STATUS_ERROR;
-    }
-    
-    /* Configure DMA channel for UART TX */
-    dmaConfig.channel = dmaChannel;
-    dmaConfig.source = dmaMuxSource;
-    dmaConfig.transferType = DMA_TRANSFER_MEM_TO_PERIPH;
-    dmaConfig.transferSize = DMA_TRANSFER_SIZE_1B;          /* 1 byte per transfer */
-    dmaConfig.priority = DMA_PRIORITY_NORMAL;
-    
-    /* Source: TX buffer */
-    dmaConfig.sourceAddr = (uint32_t)txBuff;
-    dmaConfig.sourceOffset = 1;                             /* Move forward 1 byte */
-    dmaConfig.sourceLastAddrAdjust = 0;
-    
-    /* Destination: UART DATA register */
-    dmaConfig.destAddr = (uint32_t)&(base->DATA);
-    dmaConfig.destOffset = 0;                               /* Keep same address */
-    dmaConfig.destLastAddrAdjust = 0;
-    
-    /* Transfer configuration */
-    dmaConfig.minorLoopBytes = 1U;                          /* 1 byte per minor loop */
-    dmaConfig.majorLoopCount = (uint16_t)txSize;           /* Total bytes to send */
-    dmaConfig.enableInterrupt = false;
-    dmaConfig.disableRequestAfterDone = true;
-    
-    /* Configure and start DMA */
-    dmaStatus = DMA_ConfigChannel(&dmaConfig);
-    if (dmaStatus != STATUS_SUCCESS) {
-        return UART_STATUS_ERROR;
-    }
-    
-    dmaStatus = DMA_StartChannel(dmaChannel);
-    if (dmaStatus != STATUS_SUCCESS) {
-        return UART_STATUS_ERROR;
+    return UART_RingRead(UART_GetAsyncState(base), rxBuff, rxSize);
+}
+
+/**
+ * @brief Get number of bytes still queued for transmission
+ */
+uint32_t UART_GetTxPending(LPUART_RegType *base)
+{
+    uart_async_state_t *state = UART_GetAsyncState(base);
+
+    if (state == NULL) {
+        return 0U;
     }
-    
-    return UART_STATUS_SUCCESS;
+
+    return state->txHead - state->txTail;
 }
 
 /**
- * @brief Receive data using DMA
+ * @brief Get number of dropped received bytes
  */
-UART_Status_t UART_ReceiveDMA(LPUART_RegType *base, uint8_t dmaChannel,
-                              uint8_t *rxBuff, uint32_t rxSize)
+uint32_t UART_GetRxDropCount(LPUART_RegType *base)
 {
-    status_t dmaStatus;
-    dmamux_source_t dmaMuxSource;
-    dma_channel_config_t dmaConfig;
-    
-    if ((base == NULL) || (rxBuff == NULL) || (rxSize == 0U)) {
+    uart_async_state_t *state = UART_GetAsyncState(base);
+
+    return (state != NULL) ? state->rxDropped : 0U;
+}
+
+/**
+ * @brief Install event callbacks for interrupt-driven transfer
+ */
+UART_Status_t UART_InstallCallbacks(LPUART_RegType *base, const UART_Callbacks_t *callbacks)
+{
+    uint32_t primask;
+    uint8_t instance;
+
+    if (!UART_GetInstanceFromBase(base, &instance)) {
         return UART_STATUS_ERROR;
     }
-    
-    /* Get DMAMUX source */
-    dmaMuxSource = UART_GetRxDmaMuxSource(base);
-    if (dmaMuxSource == DMAMUX_SRC_DISABLED) {
-        return UART_STATUS_ERROR;
+
+    /* The ISR must never see a half-written handle */
+    primask = NVIC_DisableGlobalIRQ();
+
+    if (callbacks != NULL) {
+        s_uartCallbacks[instance] = *callbacks;
+    } else {
+        s_uartCallbacks[instance].txComplete = NULL;
+        s_uartCallbacks[instance].rxReceived = NULL;
+        s_uartCallbacks[instance].error = NULL;
+        s_uartCallbacks[instance].userData = NULL;
     }
-    
-    /* Configure DMA channel for UART RX */
-    dmaConfig.channel = dmaChannel;
-    dmaConfig.source = dmaMuxSource;
-    dmaConfig.transferType = DMA_TRANSFER_PERIPH_TO_MEM;
-    dmaConfig.transferSize = DMA_TRANSFER_SIZE_1B;          /* 1 byte per transfer */
-    dmaConfig.priority = DMA_PRIORITY_NORMAL;
-    
-    /* Source: UART DATA register */
-    dmaConfig.sourceAddr = (uint32_t)&(base->DATA);
-    dmaConfig.sourceOffset = 0;                             /* Keep same address */
-    dmaConfig.sourceLastAddrAdjust = 0;
-    
-    /* Destination: RX buffer */
-    dmaConfig.destAddr = (uint32_t)rxBuff;
-    dmaConfig.destOffset = 1;                               /* Move forward 1 byte */
-    dmaConfig.destLastAddrAdjust = 0;
-    
-    /* Transfer configuration */
-    dmaConfig.minorLoopBytes = 1U;                          /* 1 byte per minor loop */
-    dmaConfig.majorLoopCount = (uint16_t)rxSize;           /* Total bytes to receive */
-    dmaConfig.enableInterrupt = false;
-    dmaConfig.disableRequestAfterDone = true;
-    
-    /* Configure and start DMA */
-    dmaStatus = DMA_ConfigChannel(&dmaConfig);
-    if (dmaStatus != STATUS_SUCCESS) {
-        return UART_STATUS_ERROR;
+
+    if (s_uartCallbacks[instance].error != NULL) {
+        base->CTRL |= UART_ERROR_INT_MASK;
+    } else {
+        base->CTRL &= ~UART_ERROR_INT_MASK;
     }
-    
-    dmaStatus = DMA_StartChannel(dmaChannel);
-    if (dmaStatus != STATUS_SUCCESS) {
-        return UART_STATUS_ERROR;
+    if (!UART_TC_WANTED(instance, &s_uartCallbacks[instance])) {
+        base->CTRL &= ~LPUART_CTRL_TCIE_MASK;
     }
-    
+
+    NVIC_EnableGlobalIRQ(primask);
+
     return UART_STATUS_SUCCESS;
 }
 
 /**
- * @brief Send data using DMA with blocking wait
+ * @brief Clear wakeup flags and notify the application
  */
-UART_Status_t UART_SendDMABlocking(LPUART_RegType *base, uint8_t dmaChannel,
-                                   const uint8_t *txBuff, uint32_t txSize)
+static void UART_HandleWakeup(LPUART_RegType *base, uint8_t instance, uint32_t stat)
 {
-    UART_Status_t status;
-    uint32_t timeout = UART_TIMEOUT_COUNT * txSize;
-    
-    /* Start DMA transfer */
-    status = UART_SendDMA(base, dmaChannel, txBuff, txSize);
-    if (status != UART_STATUS_SUCCESS) {
-        return status;
+    uart_wakeup_state_t *state = &s_uartWakeup[instance];
+    uint32_t source = 0U;
+
+    /* RXEDGIF sets on every falling edge, disarm after the first one */
+    if (((stat & LPUART_STAT_RXEDGIF_MASK) != 0U) && ((base->BAUD & LPUART_BAUD_RXEDGIE_MASK) != 0U)) {
+        base->BAUD &= ~LPUART_BAUD_RXEDGIE_MASK;
+        source |= (uint32_t)UART_WAKEUP_RX_EDGE;
     }
-    
-    /* Wait for completion */
-    while (!DMA_IsChannelDone(dmaChannel) && (timeout > 0U)) {
-        timeout--;
+    if (((stat & LPUART_STAT_MA1F_MASK) != 0U) && ((base->CTRL & LPUART_CTRL_MA1IE_MASK) != 0U)) {
+        source |= (uint32_t)UART_WAKEUP_MATCH1;
     }
-    
-    if (timeout == 0U) {
-        DMA_StopChannel(dmaChannel);
-        return UART_STATUS_TIMEOUT;
+    if (((stat & LPUART_STAT_MA2F_MASK) != 0U) && ((base->CTRL & LPUART_CTRL_MA2IE_MASK) != 0U)) {
+        source |= (uint32_t)UART_WAKEUP_MATCH2;
+    }
+
+    LPUART_CLEAR_STATUS_FLAG(base, stat & UART_WAKEUP_FLAGS);
+
+    if (source != 0U) {
+        state->source |= source;
+        if (state->callback != NULL) {
+            state->callback(base, source, state->userData);
+        }
     }
-    
-    /* Clear done flag */
-    DMA_ClearDone(dmaChannel);
-    
-    return UART_STATUS_SUCCESS;
 }
 
 /**
- * @brief Receive data using DMA with blocking wait
+ * @brief Ring buffer ISR body, shared by UART_IRQHandler() and UART_HandleIRQHandler()
  */
-UART_Status_t UART_ReceiveDMABlocking(LPUART_RegType *base, uint8_t dmaChannel,
-                                      uint8_t *rxBuff, uint32_t rxSize)
+static void UART_ServiceIrq(LPUART_RegType *base, uint8_t instance)
 {
-    UART_Status_t status;
-    uint32_t timeout = UART_TIMEOUT_COUNT * rxSize;
-    
-    /* Start DMA transfer */
-    status = UART_ReceiveDMA(base, dmaChannel, rxBuff, rxSize);
-    if (status != UART_STATUS_SUCCESS) {
-        return status;
+    const UART_Callbacks_t *callbacks;
+    uart_async_state_t *state;
+    uint32_t stat;
+    uint32_t head;
+    uint32_t tail;
+    uint8_t data;
+
+    stat = base->STAT;
+
+    if ((stat & UART_WAKEUP_FLAGS) != 0U) {
+        UART_HandleWakeup(base, instance, stat);
     }
-    
-    /* Wait for completion */
-    while (!DMA_IsChannelDone(dmaChannel) && (timeout > 0U)) {
-        timeout--;
+
+#if UART_DMA_ENABLE
+    /* Circular DMA RX: line went idle, report what DMA has stored so far */
+    if (s_uartRxDma[instance].active && ((stat & LPUART_STAT_IDLE_MASK) != 0U)) {
+        LPUART_CLEAR_STATUS_FLAG(base, LPUART_STAT_IDLE_MASK);
+        (void)UART_PollCircularRxDMA(base);
+    }
+#endif
+
+    callbacks = &s_uartCallbacks[instance];
+    state = &s_uartAsync[instance];
+
+    /* Clear error flags, a hardware overrun has already lost data */
+    if (((stat & UART_ASYNC_ERROR_FLAGS) != 0U) && (state->enabled || (callbacks->error != NULL))) {
+        LPUART_CLEAR_STATUS_FLAG(base, stat & UART_ASYNC_ERROR_FLAGS);
+        if (state->enabled && ((stat & LPUART_STAT_OR_MASK) != 0U)) {
+            state->rxDropped++;
+        }
+        if (callbacks->error != NULL) {
+            callbacks->error(base, stat & UART_ASYNC_ERROR_FLAGS, callbacks->userData);
+        }
+    }
+
+    if (!state->enabled) {
+        return;
+    }
+
+    /* RX: drain the whole FIFO */
+    head = state->rxHead;
+    tail = head;
+    while ((base->WATER & LPUART_WATER_RXCOUNT_MASK) != 0U) {
+        data = (uint8_t)LPUART_READ_DATA(base);
+        if ((head - state->rxTail) < UART_RX_RING_SIZE) {
+            state->rxBuf[head & UART_RX_RING_MASK] = data;
+            head++;
+        } else {
+            state->rxDropped++;
+        }
+    }
+    UART_COMPILER_BARRIER();
+    state->rxHead = head;
+
+    if ((head != tail) && (callbacks->rxReceived != NULL)) {
+        callbacks->rxReceived(base, head - state->rxTail, callbacks->userData);
+    }
+
+#if OSAL_FREERTOS
+    if ((head != tail) && s_uartOsal[instance].rxWaiting) {
+        s_uartOsal[instance].rxWaiting = false;
+        OSAL_EventSignalFromIsr(&s_uartOsal[instance].rxReady);
+    }
+#endif
+
+    /* TX complete: ring drained earlier, last frame has left the shifter */
+    if (((base->CTRL & LPUART_CTRL_TCIE_MASK) != 0U) && ((base->STAT & LPUART_STAT_TC_MASK) != 0U)) {
+        base->CTRL &= ~LPUART_CTRL_TCIE_MASK;
+        /* New data queued meanwhile: TCIE is re-armed when the ring drains again */
+        if ((state->txTail == state->txHead) && (callbacks->txComplete != NULL)) {
+            callbacks->txComplete(base, callbacks->userData);
+        }
+#if OSAL_FREERTOS
+        if ((state->txTail == state->txHead) && s_uartOsal[instance].txWaiting) {
+            s_uartOsal[instance].txWaiting = false;
+            OSAL_EventSignalFromIsr(&s_uartOsal[instance].txDone);
+        }
+#endif
+    }
+
+    /* TX: top up the FIFO */
+    if (((base->CTRL & LPUART_CTRL_TIE_MASK) != 0U) && ((stat & LPUART_STAT_TDRE_MASK) != 0U)) {
+        tail = state->txTail;
+        head = state->txHead;
+
+        while ((tail != head) &&
+               (((base->WATER & LPUART_WATER_TXCOUNT_MASK) >> LPUART_WATER_TXCOUNT_SHIFT) < state->txFifoDepth)) {
+            LPUART_WRITE_DATA(base, state->txBuf[tail & UART_TX_RING_MASK]);
+            tail++;
+        }
+
+        state->txTail = tail;
+
+        if (tail == head) {
+            base->CTRL &= ~LPUART_CTRL_TIE_MASK;
+            if (UART_TC_WANTED(instance, callbacks)) {
+                base->CTRL |= LPUART_CTRL_TCIE_MASK;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Handle LPUART interrupt for ring buffer transfer
+ */
+void UART_IRQHandler(LPUART_RegType *base)
+{
+    uint8_t instance;
+
+    if (UART_GetInstanceFromBase(base, &instance)) {
+        UART_ServiceIrq(base, instance);
+    }
+}
+
+/*******************************************************************************
+ * Low-Power Wakeup Functions
+ ******************************************************************************/
+
+/**
+ * @brief Configure the UART as a wakeup source for STOP / VLPS
+ */
+UART_Status_t UART_ConfigWakeup(LPUART_RegType *base, const UART_WakeupConfig_t *config)
+{
+    uint32_t ctrl;
+    uint32_t baud;
+    uint8_t instance;
+    uint8_t pccIndex;
+    bool sircClocked;
+
+    if ((config == NULL) || !UART_GetInstanceFromBase(base, &instance) ||
+        !UART_GetPccIndex(s_uartStateInstance[instance], &pccIndex)) {
+        return UART_STATUS_ERROR;
+    }
+
+    /* Match compare runs on the functional clock, only SIRC survives STOP */
+    sircClocked = (PCC_GetPeripheralClockSource(pccIndex) == PCC_CLK_SRC_SIRC_DIV2);
+    if ((config->wakeOnMatch1 || config->wakeOnMatch2) && !sircClocked) {
+        return UART_STATUS_ERROR;
+    }
+    if (sircClocked && !SCG_SetSircLowPowerEnable(true, true)) {
+        return UART_STATUS_ERROR;
+    }
+
+    /* Receiver off while the match configuration changes */
+    ctrl = base->CTRL;
+    base->CTRL = ctrl & ~LPUART_CTRL_RE_MASK;
+
+    base->MATCH = LPUART_MATCH_MA1(config->matchAddress1) | LPUART_MATCH_MA2(config->matchAddress2);
+
+    baud = base->BAUD & ~(LPUART_BAUD_MAEN1_MASK | LPUART_BAUD_MAEN2_MASK | LPUART_BAUD_RXEDGIE_MASK);
+    baud |= LPUART_BAUD_MAEN1(config->wakeOnMatch1 ? 1U : 0U) | LPUART_BAUD_MAEN2(config->wakeOnMatch2 ? 1U : 0U);
+    base->BAUD = baud;
+
+    ctrl &= ~(LPUART_CTRL_DOZEEN_MASK | LPUART_CTRL_MA1IE_MASK | LPUART_CTRL_MA2IE_MASK);
+    ctrl |= LPUART_CTRL_MA1IE(config->wakeOnMatch1 ? 1U : 0U) | LPUART_CTRL_MA2IE(config->wakeOnMatch2 ? 1U : 0U);
+
+    LPUART_CLEAR_STATUS_FLAG(base, UART_WAKEUP_FLAGS);
+    s_uartWakeup[instance].source = 0U;
+
+    base->CTRL = ctrl;
+
+    /* Arm the edge detector last, once stale flags are cleared */
+    if (config->wakeOnRxEdge) {
+        base->BAUD |= LPUART_BAUD_RXEDGIE_MASK;
+    }
+
+    return UART_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Disarm all wakeup sources
+ */
+void UART_DisableWakeup(LPUART_RegType *base)
+{
+    uint32_t ctrl;
+    uint8_t instance;
+
+    if (!UART_GetInstanceFromBase(base, &instance)) {
+        return;
+    }
+
+    ctrl = base->CTRL;
+    base->CTRL = ctrl & ~(LPUART_CTRL_RE_MASK | LPUART_CTRL_MA1IE_MASK | LPUART_CTRL_MA2IE_MASK);
+    base->BAUD &= ~(LPUART_BAUD_MAEN1_MASK | LPUART_BAUD_MAEN2_MASK | LPUART_BAUD_RXEDGIE_MASK);
+    LPUART_CLEAR_STATUS_FLAG(base, UART_WAKEUP_FLAGS);
+    base->CTRL = ctrl & ~(LPUART_CTRL_MA1IE_MASK | LPUART_CTRL_MA2IE_MASK);
+}
+
+/**
+ * @brief Install wakeup callback
+ */
+void UART_InstallWakeupCallback(LPUART_RegType *base, UART_WakeupCallback_t callback, void *userData)
+{
+    uint8_t instance;
+
+    if (!UART_GetInstanceFromBase(base, &instance)) {
+        return;
+    }
+
+    s_uartWakeup[instance].callback = NULL;
+    s_uartWakeup[instance].userData = userData;
+    s_uartWakeup[instance].callback = callback;
+}
+
+/**
+ * @brief Get and clear the accumulated wakeup sources
+ */
+uint32_t UART_GetWakeupSource(LPUART_RegType *base)
+{
+    uint32_t source;
+    uint32_t primask;
+    uint8_t instance;
+
+    if (!UART_GetInstanceFromBase(base, &instance)) {
+        return 0U;
+    }
+
+    primask = NVIC_DisableGlobalIRQ();
+    source = s_uartWakeup[instance].source;
+    s_uartWakeup[instance].source = 0U;
+    NVIC_EnableGlobalIRQ(primask);
+
+    return source;
+}
+
+/*******************************************************************************
+ * Clock Control Functions
+ ******************************************************************************/
+
+/**
+ * @brief Enable UART clock
+ */
+void UART_EnableClock(uint8_t instance)
+{
+    UART_EnableClockSource(instance, UART_DEFAULT_CLK_SOURCE);
+}
+
+/**
+ * @brief Enable UART clock from a selected PCC source
+ */
+void UART_EnableClockSource(uint8_t instance, pcc_clock_source_t source)
+{
+    pcc_config_t config;
+    uint8_t pccIndex;
+
+    if (!UART_GetPccIndex(instance, &pccIndex)) {
+        return;
+    }
+
+    /* Ensure clock gate is disabled before reconfiguring source */
+    (void)PCC_DisablePeripheralClock(pccIndex);
+
+    config.clockSource = source;
+    config.enableClock = true;
+    config.divider = 0U;
+    config.fractionalDivider = false;
+
+    (void)PCC_SetPeripheralClockConfig(pccIndex, &config);
+
+    /* Refresh clock cache so new frequency is visible via Clock Manager */
+    ClockManager_Update();
+}
+
+/**
+ * @brief Disable UART clock
+ */
+void UART_DisableClock(uint8_t instance)
+{
+    uint8_t pccIndex;
+
+    if (!UART_GetPccIndex(instance, &pccIndex)) {
+        return;
+    }
+
+    (void)PCC_DisablePeripheralClock(pccIndex);
+    ClockManager_Update();
+}
+
+/**
+ * @brief Get achieved baud rate
+ */
+uint32_t UART_GetActualBaudRate(LPUART_RegType *base)
+{
+    uint8_t instance;
+
+    return UART_GetInstanceFromBase(base, &instance) ? s_uartBaudActual[instance] : 0U;
+}
+
+/**
+ * @brief Get baud rate error of the last UART_Init()
+ */
+int32_t UART_GetBaudRateError(LPUART_RegType *base)
+{
+    uint8_t instance;
+
+    if (!UART_GetInstanceFromBase(base, &instance)) {
+        return 0;
+    }
+
+    return UART_BaudErrorPpm(s_uartBaudActual[instance], s_uartBaudTarget[instance]);
+}
+
+/**
+ * @brief Get current UART functional clock frequency for an instance
+ */
+uint32_t UART_GetClockFrequency(uint8_t instance)
+{
+    return UART_GetInstanceClockFreqInternal(instance);
+}
+
+/*******************************************************************************
+ * DMA Transfer Functions
+ ******************************************************************************/
+#if UART_DMA_ENABLE
+/**
+ * @brief Get DMAMUX source for UART instance TX
+ */
+static dmamux_source_t UART_GetTxDmaMuxSource(const LPUART_RegType *base)
+{
+    if (base == LPUART0) {
+        return DMAMUX_SRC_LPUART0_TX;
+    } else if (base == LPUART1) {
+        return DMAMUX_SRC_LPUART1_TX;
+    } else if (base == LPUART2) {
+        return DMAMUX_SRC_LPUART2_TX;
+    }
+    return DMAMUX_SRC_DISABLED;
+}
+
+/**
+ * @brief Get DMAMUX source for UART instance RX
+ */
+static dmamux_source_t UART_GetRxDmaMuxSource(const LPUART_RegType *base)
+{
+    if (base == LPUART0) {
+        return DMAMUX_SRC_LPUART0_RX;
+    } else if (base == LPUART1) {
+        return DMAMUX_SRC_LPUART1_RX;
+    } else if (base == LPUART2) {
+        return DMAMUX_SRC_LPUART2_RX;
+    }
+    return DMAMUX_SRC_DISABLED;
+}
+
+/**
+ * @brief Configure UART for DMA transmission
+ */
+UART_Status_t UART_ConfigTxDMA(LPUART_RegType *base, uint8_t dmaChannel)
+{
+    dmamux_source_t dmaMuxSource;
+    
+    if (base == NULL) {
+        return UART_STATUS_ERROR;
     }
     
-    if (timeout == 0U) {
-        DMA_StopChannel(dmaChannel);
-        return UART_STATUS_TIMEOUT;
+    /* Get DMAMUX source for this UART instance */
+    dmaMuxSource = UART_GetTxDmaMuxSource(base);
+    if (dmaMuxSource == DMAMUX_SRC_DISABLED) {
+        return UART_STATUS_ERROR;
     }
     
-    /* Clear done flag */
-    DMA_ClearDone(dmaChannel);
+    /* Enable UART TX DMA request */
+    base->BAUD |= LPUART_BAUD_TDMAE_MASK;
     
     return UART_STATUS_SUCCESS;
 }
 
 /**
- * @brief Disable UART TX DMA
+ * @brief Configure UART for DMA reception
  */
-void UART_DisableTxDMA(LPUART_RegType *base)
+UART_Status_t UART_ConfigRxDMA(LPUART_RegType *base, uint8_t dmaChannel)
 {
-    if (base != NULL) {
-        base->BAUD &= ~LPUART_BAUD_TDMAE_MASK;
+    dmamux_source_t dmaMuxSource;
+    
+    if (base == NULL) {
+        return UART_STATUS_ERROR;
+    }
+    
+    /* Get DMAMUX source for this UART instance */
+    dmaMuxSource = UART_GetRxDmaMuxSource(base);
+    if (dmaMuxSource == DMAMUX_SRC_DISABLED) {
+        return UART_STATUS_ERROR;
     }
+    
+    /* Enable UART RX DMA request */
+    base->BAUD |= LPUART_BAUD_RDMAE_MASK;
+    
+    return UART_STATUS_SUCCESS;
 }
 
 /**
- * @brief Disable UART RX DMA
+ * @brief Start a TX DMA transfer on an already resolved DMAMUX source
  */
-void UART_DisableRxDMA(LPUART_RegType *base)
+static UART_Status_t UART_StartTxDma(LPUART_RegType *base, uint8_t dmaChannel, dmamux_source_t dmaMuxSource,
+                                     const uint8_t *txBuff, uint32_t txSize)
 {
-    if (base != NULL) {
-        base->BAUD &= ~LPUART_BAUD_RDMAE_MASK;
-    }
+    status_t dmaStatus;
+    dma_channel_config_t dmaConfig;
+    
+    /* Configure DMA channel for UART TX */
+    dmaConfig.channel = dmaChannel;
+    dmaConfig.source = dmaMuxSource;
+    dmaConfig.transferType = DMA_TRANSFER_MEM_TO_PERIPH;
+    dmaConfig.transferSize = DMA_TRANSFER_SIZE_1B;          /* 1 byte per transfer */
+    dmaConfig.priority = DMA_PRIORITY_NORMAL;
+    
+    /* Source: TX buffer */
+    dmaConfig.sourceAddr = (uint32_t)txBuff;
+    dmaConfig.sourceOffset = 1;                             /* Move forward 1 byte */
+    dmaConfig.sourceLastAddrAdjust = 0;
+    
+    /* Destination: UART DATA register */
+    dmaConfig.destAddr = (uint32_t)&(base->DATA);
+    dmaConfig.destOffset = 0;                               /* Keep same address */
+    dmaConfig.destLastAddrAdjust = 0;
+    
+    /* Transfer configuration */
+    dmaConfig.minorLoopBytes = 1U;                          /* 1 byte per minor loop */
+    dmaConfig.majorLoopCount = (uint16_t)txSize;           /* Total bytes to send */
+    dmaConfig.enableInterrupt = false;
+    dmaConfig.disableRequestAfterDone = true;
+    dmaConfig.enablePeriodicTrigger = false;
+    
+    /* Configure and start DMA */
+    dmaStatus = DMA_ConfigChannel(&dmaConfig);
+    if (dmaStatus != STATUS_SUCCESS) {
+        return UART_STATUS_ERROR;
+    }
+    
+    dmaStatus = DMA_StartChannel(dmaChannel);
+    if (dmaStatus != STATUS_SUCCESS) {
+        return UART_STATUS_ERROR;
+    }
+    
+    return UART_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Start an RX DMA transfer on an already resolved DMAMUX source
+ */
+static UART_Status_t UART_StartRxDma(LPUART_RegType *base, uint8_t dmaChannel, dmamux_source_t dmaMuxSource,
+                                     uint8_t *rxBuff, uint32_t rxSize)
+{
+    status_t dmaStatus;
+    dma_channel_config_t dmaConfig;
+    
+    /* Configure DMA channel for UART RX */
+    dmaConfig.channel = dmaChannel;
+    dmaConfig.source = dmaMuxSource;
+    dmaConfig.transferType = DMA_TRANSFER_PERIPH_TO_MEM;
+    dmaConfig.transferSize = DMA_TRANSFER_SIZE_1B;          /* 1 byte per transfer */
+    dmaConfig.priority = DMA_PRIORITY_NORMAL;
+    
+    /* Source: UART DATA register */
+    dmaConfig.sourceAddr = (uint32_t)&(base->DATA);
+    dmaConfig.sourceOffset = 0;                             /* Keep same address */
+    dmaConfig.sourceLastAddrAdjust = 0;
+    
+    /* Destination: RX buffer */
+    dmaConfig.destAddr = (uint32_t)rxBuff;
+    dmaConfig.destOffset = 1;                               /* Move forward 1 byte */
+    dmaConfig.destLastAddrAdjust = 0;
+    
+    /* Transfer configuration */
+    dmaConfig.minorLoopBytes = 1U;                          /* 1 byte per minor loop */
+    dmaConfig.majorLoopCount = (uint16_t)rxSize;           /* Total bytes to receive */
+    dmaConfig.enableInterrupt = false;
+    dmaConfig.disableRequestAfterDone = true;
+    dmaConfig.enablePeriodicTrigger = false;
+    
+    /* Configure and start DMA */
+    dmaStatus = DMA_ConfigChannel(&dmaConfig);
+    if (dmaStatus != STATUS_SUCCESS) {
+        return UART_STATUS_ERROR;
+    }
+    
+    dmaStatus = DMA_StartChannel(dmaChannel);
+    if (dmaStatus != STATUS_SUCCESS) {
+        return UART_STATUS_ERROR;
+    }
+    
+    return UART_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Send data using DMA
+ */
+UART_Status_t UART_SendDMA(LPUART_RegType *base, uint8_t dmaChannel, 
+                           const uint8_t *txBuff, uint32_t txSize)
+{
+    dmamux_source_t dmaMuxSource;
+    
+    if ((base == NULL) || (txBuff == NULL) || (txSize == 0U)) {
+        return UART_STATUS_ERROR;
+    }
+    
+    /* Get DMAMUX source */
+    dmaMuxSource = UART_GetTxDmaMuxSource(base);
+    if (dmaMuxSource == DMAMUX_SRC_DISABLED) {
+        return UART_STATUS_ERROR;
+    }
+    
+    return UART_StartTxDma(base, dmaChannel, dmaMuxSource, txBuff, txSize);
+}
+
+/**
+ * @brief Receive data using DMA
+ */
+UART_Status_t UART_ReceiveDMA(LPUART_RegType *base, uint8_t dmaChannel,
+                              uint8_t *rxBuff, uint32_t rxSize)
+{
+    dmamux_source_t dmaMuxSource;
+    
+    if ((base == NULL) || (rxBuff == NULL) || (rxSize == 0U)) {
+        return UART_STATUS_ERROR;
+    }
+    
+    /* Get DMAMUX source */
+    dmaMuxSource = UART_GetRxDmaMuxSource(base);
+    if (dmaMuxSource == DMAMUX_SRC_DISABLED) {
+        return UART_STATUS_ERROR;
+    }
+    
+    return UART_StartRxDma(base, dmaChannel, dmaMuxSource, rxBuff, rxSize);
+}
+
+/**
+ * @brief Send data using DMA with blocking wait
+ */
+UART_Status_t UART_SendDMABlocking(LPUART_RegType *base, uint8_t dmaChannel,
+                                   const uint8_t *txBuff, uint32_t txSize)
+{
+    UART_Status_t status;
+    uint32_t timeout = UART_TIMEOUT_COUNT * txSize;
+    
+    /* Start DMA transfer */
+    status = UART_SendDMA(base, dmaChannel, txBuff, txSize);
+    if (status != UART_STATUS_SUCCESS) {
+        return status;
+    }
+    
+    /* Wait for completion */
+    while (!DMA_IsChannelDone(dmaChannel) && (timeout > 0U)) {
+        timeout--;
+    }
+    
+    if (timeout == 0U) {
+        DMA_StopChannel(dmaChannel);
+        return UART_STATUS_TIMEOUT;
+    }
+    
+    /* Clear done flag */
+    DMA_ClearDone(dmaChannel);
+    
+    return UART_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Receive data using DMA with blocking wait
+ */
+UART_Status_t UART_ReceiveDMABlocking(LPUART_RegType *base, uint8_t dmaChannel,
+                                      uint8_t *rxBuff, uint32_t rxSize)
+{
+    UART_Status_t status;
+    uint32_t timeout = UART_TIMEOUT_COUNT * rxSize;
+    
+    /* Start DMA transfer */
+    status = UART_ReceiveDMA(base, dmaChannel, rxBuff, rxSize);
+    if (status != UART_STATUS_SUCCESS) {
+        return status;
+    }
+    
+    /* Wait for completion */
+    while (!DMA_IsChannelDone(dmaChannel) && (timeout > 0U)) {
+        timeout--;
+    }
+    
+    if (timeout == 0U) {
+        DMA_StopChannel(dmaChannel);
+        return UART_STATUS_TIMEOUT;
+    }
+    
+    /* Clear done flag */
+    DMA_ClearDone(dmaChannel);
+    
+    return UART_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Disable UART TX DMA
+ */
+void UART_DisableTxDMA(LPUART_RegType *base)
+{
+    if (base != NULL) {
+        base->BAUD &= ~LPUART_BAUD_TDMAE_MASK;
+    }
+}
+
+/**
+ * @brief Disable UART RX DMA
+ */
+void UART_DisableRxDMA(LPUART_RegType *base)
+{
+    if (base != NULL) {
+        base->BAUD &= ~LPUART_BAUD_RDMAE_MASK;
+    }
+}
+
+/**
+ * @brief Send several buffers as one DMA transfer (scatter-gather)
+ */
+UART_Status_t UART_SendDMAVector(LPUART_RegType *base, uint8_t dmaChannel,
+                                 const UART_IoVec_t *iov, uint32_t count)
+{
+    const UART_IoVec_t *seg[UART_DMA_MAX_IOV];
+    dma_channel_config_t dmaConfig;
+    dmamux_source_t dmaMuxSource;
+    DMA_TCD_Type *tcd;
+    uint32_t segCount = 0U;
+    uint32_t i;
+    uint8_t instance;
+
+    if ((iov == NULL) || (count == 0U) || (count > UART_DMA_MAX_IOV) ||
+        (dmaChannel >= DMA_MAX_CHANNELS)) {
+        return UART_STATUS_ERROR;
+    }
+
+    if (!UART_GetInstanceFromBase(base, &instance)) {
+        return UART_STATUS_ERROR;
+    }
+
+    dmaMuxSource = UART_GetTxDmaMuxSource(base);
+    if (dmaMuxSource == DMAMUX_SRC_DISABLED) {
+        return UART_STATUS_ERROR;
+    }
+
+    /* The TCD pool is still being fetched until the last TCD clears ERQ */
+    if (s_uartTxSgUsed[instance] &&
+        ((DMA->ERQ & (1UL << s_uartTxSgChannel[instance])) != 0U)) {
+        return UART_STATUS_BUSY;
+    }
+
+    for (i = 0U; i < count; i++) {
+        if (iov[i].length == 0U) {
+            continue;
+        }
+        if ((iov[i].data == NULL) || (iov[i].length > 0x7FFFU)) {
+            return UART_STATUS_ERROR;
+        }
+        seg[segCount++] = &iov[i];
+    }
+
+    if (segCount == 0U) {
+        return UART_STATUS_ERROR;
+    }
+
+    /* First segment goes straight into the channel TCD (also routes DMAMUX) */
+    dmaConfig.channel = dmaChannel;
+    dmaConfig.source = dmaMuxSource;
+    dmaConfig.transferType = DMA_TRANSFER_MEM_TO_PERIPH;
+    dmaConfig.transferSize = DMA_TRANSFER_SIZE_1B;
+    dmaConfig.priority = DMA_PRIORITY_NORMAL;
+    dmaConfig.sourceAddr = (uint32_t)seg[0]->data;
+    dmaConfig.sourceOffset = 1;
+    dmaConfig.sourceLastAddrAdjust = 0;
+    dmaConfig.destAddr = (uint32_t)&(base->DATA);
+    dmaConfig.destOffset = 0;
+    dmaConfig.destLastAddrAdjust = 0;
+    dmaConfig.minorLoopBytes = 1U;
+    dmaConfig.majorLoopCount = (uint16_t)seg[0]->length;
+    dmaConfig.enableInterrupt = false;
+    dmaConfig.disableRequestAfterDone = true;
+    dmaConfig.enablePeriodicTrigger = false;
+
+    if (DMA_ConfigChannel(&dmaConfig) != STATUS_SUCCESS) {
+        return UART_STATUS_ERROR;
+    }
+
+    s_uartTxSgChannel[instance] = dmaChannel;
+    s_uartTxSgUsed[instance] = true;
+
+    /* Remaining segments: RAM TCDs loaded by hardware at each major loop end */
+    for (i = 1U; i < segCount; i++) {
+        tcd = &s_uartTxSgTcd[instance][i - 1U];
+        tcd->SADDR = (uint32_t)seg[i]->data;
+        tcd->SOFF = 1U;
+        tcd->ATTR = DMA->TCD[dmaChannel].ATTR;
+        tcd->NBYTES_MLNO = 1U;
+        tcd->SLAST = 0U;
+        tcd->DADDR = (uint32_t)&(base->DATA);
+        tcd->DOFF = 0U;
+        tcd->CITER_ELINKNO = (uint16_t)seg[i]->length;
+        tcd->BITER_ELINKNO = (uint16_t)seg[i]->length;
+
+        if ((i + 1U) < segCount) {
+            tcd->DLAST_SGA = (uint32_t)&s_uartTxSgTcd[instance][i];
+            tcd->CSR = DMA_TCD_CSR_ESG_MASK;
+        } else {
+            tcd->DLAST_SGA = 0U;
+            tcd->CSR = DMA_TCD_CSR_DREQ_MASK;
+        }
+    }
+
+    if (segCount > 1U) {
+        /* Link the channel TCD to the pool; DONE is clear after ConfigChannel */
+        DMA->TCD[dmaChannel].DLAST_SGA = (uint32_t)&s_uartTxSgTcd[instance][0];
+        DMA->TCD[dmaChannel].CSR = (DMA->TCD[dmaChannel].CSR & ~DMA_TCD_CSR_DREQ_MASK) |
+                                   DMA_TCD_CSR_ESG_MASK;
+    }
+
+    if (DMA_StartChannel(dmaChannel) != STATUS_SUCCESS) {
+        return UART_STATUS_ERROR;
+    }
+
+    return UART_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Point the configured channel TCD at a ping-pong buffer and start it
+ */
+static void UART_PingPongTxKick(uart_pp_tx_state_t *state, uint8_t index)
+{
+    state->bufState[index] = UART_PP_SENDING;
+
+    /* Only the fields that change between buffers, the rest stays from ConfigChannel */
+    DMA->TCD[state->channel].SADDR = (uint32_t)state->buffer[index];
+    DMA->TCD[state->channel].CITER_ELINKNO = state->length[index];
+    DMA->TCD[state->channel].BITER_ELINKNO = state->length[index];
+
+    (void)DMA_StartChannel(state->channel);
+}
+
+/**
+ * @brief DMA major loop interrupt for ping-pong TX
+ */
+static void UART_PingPongTxDmaCallback(uint8_t channel, void *userData)
+{
+    uart_pp_tx_state_t *state = (uart_pp_tx_state_t *)userData;
+    uint8_t i;
+
+    (void)channel;
+
+    if (!state->active) {
+        return;
+    }
+
+    for (i = 0U; i < 2U; i++) {
+        if (state->bufState[i] == UART_PP_SENDING) {
+            state->bufState[i] = UART_PP_FREE;
+            if (state->bufState[i ^ 1U] == UART_PP_QUEUED) {
+                UART_PingPongTxKick(state, i ^ 1U);
+            }
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Start double-buffered (ping-pong) DMA transmission
+ */
+UART_Status_t UART_StartPingPongTxDMA(LPUART_RegType *base, uint8_t dmaChannel,
+                                      uint8_t *bufferA, uint8_t *bufferB, uint16_t size)
+{
+    uart_pp_tx_state_t *state;
+    dma_channel_config_t dmaConfig;
+    dmamux_source_t dmaMuxSource;
+    uint8_t instance;
+
+    if ((bufferA == NULL) || (bufferB == NULL) || (size == 0U) || (size > 0x7FFFU) ||
+        (dmaChannel >= DMA_MAX_CHANNELS)) {
+        return UART_STATUS_ERROR;
+    }
+
+    if (!UART_GetInstanceFromBase(base, &instance)) {
+        return UART_STATUS_ERROR;
+    }
+
+    dmaMuxSource = UART_GetTxDmaMuxSource(base);
+    if (dmaMuxSource == DMAMUX_SRC_DISABLED) {
+        return UART_STATUS_ERROR;
+    }
+
+    state = &s_uartPpTx[instance];
+    if (state->active) {
+        return UART_STATUS_BUSY;
+    }
+
+    state->buffer[0] = bufferA;
+    state->buffer[1] = bufferB;
+    state->length[0] = 0U;
+    state->length[1] = 0U;
+    state->bufState[0] = UART_PP_FREE;
+    state->bufState[1] = UART_PP_FREE;
+    state->size = size;
+    state->fillIndex = 0U;
+    state->channel = dmaChannel;
+
+    /* Program the static part of the TCD once, buffers are swapped in the ISR */
+    dmaConfig.channel = dmaChannel;
+    dmaConfig.source = dmaMuxSource;
+    dmaConfig.transferType = DMA_TRANSFER_MEM_TO_PERIPH;
+    dmaConfig.transferSize = DMA_TRANSFER_SIZE_1B;
+    dmaConfig.priority = DMA_PRIORITY_NORMAL;
+    dmaConfig.sourceAddr = (uint32_t)bufferA;
+    dmaConfig.sourceOffset = 1;
+    dmaConfig.sourceLastAddrAdjust = 0;
+    dmaConfig.destAddr = (uint32_t)&(base->DATA);
+    dmaConfig.destOffset = 0;
+    dmaConfig.destLastAddrAdjust = 0;
+    dmaConfig.minorLoopBytes = 1U;
+    dmaConfig.majorLoopCount = size;
+    dmaConfig.enableInterrupt = true;
+    dmaConfig.disableRequestAfterDone = true;
+    dmaConfig.enablePeriodicTrigger = false;
+
+    if (DMA_ConfigChannel(&dmaConfig) != STATUS_SUCCESS) {
+        return UART_STATUS_ERROR;
+    }
+
+    if (DMA_InstallCallback(dmaChannel, UART_PingPongTxDmaCallback, state) != STATUS_SUCCESS) {
+        return UART_STATUS_ERROR;
+    }
+
+    base->BAUD |= LPUART_BAUD_TDMAE_MASK;
+    state->active = true;
+
+    return UART_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Stop ping-pong transmission
+ */
+void UART_StopPingPongTxDMA(LPUART_RegType *base)
+{
+    uart_pp_tx_state_t *state;
+    uint8_t instance;
+
+    if (!UART_GetInstanceFromBase(base, &instance)) {
+        return;
+    }
+
+    state = &s_uartPpTx[instance];
+    if (!state->active) {
+        return;
+    }
+
+    state->active = false;
+    (void)DMA_StopChannel(state->channel);
+    base->BAUD &= ~LPUART_BAUD_TDMAE_MASK;
+
+    state->bufState[0] = UART_PP_FREE;
+    state->bufState[1] = UART_PP_FREE;
+}
+
+/**
+ * @brief Get the buffer the application may fill next
+ */
+uint8_t *UART_GetPingPongTxBuffer(LPUART_RegType *base, uint16_t *capacity)
+{
+    uart_pp_tx_state_t *state;
+    uint8_t instance;
+    uint8_t index;
+
+    if (!UART_GetInstanceFromBase(base, &instance) || !s_uartPpTx[instance].active) {
+        return NULL;
+    }
+
+    state = &s_uartPpTx[instance];
+
+    /* Keep handing out the same buffer until it is committed */
+    index = state->fillIndex;
+    if (state->bufState[index] != UART_PP_FREE) {
+        index ^= 1U;
+        if (state->bufState[index] != UART_PP_FREE) {
+            return NULL;
+        }
+        state->fillIndex = index;
+    }
+
+    if (capacity != NULL) {
+        *capacity = state->size;
+    }
+
+    return state->buffer[index];
+}
+
+/**
+ * @brief Queue the buffer returned by UART_GetPingPongTxBuffer()
+ */
+UART_Status_t UART_CommitPingPongTxBuffer(LPUART_RegType *base, uint16_t length)
+{
+    uart_pp_tx_state_t *state;
+    UART_Status_t status = UART_STATUS_SUCCESS;
+    uint32_t primask;
+    uint8_t instance;
+    uint8_t index;
+
+    if (!UART_GetInstanceFromBase(base, &instance) || !s_uartPpTx[instance].active) {
+        return UART_STATUS_ERROR;
+    }
+
+    state = &s_uartPpTx[instance];
+    if ((length == 0U) || (length > state->size)) {
+        return UART_STATUS_ERROR;
+    }
+
+    index = state->fillIndex;
+
+    primask = NVIC_DisableGlobalIRQ();
+
+    if (state->bufState[index] != UART_PP_FREE) {
+        status = UART_STATUS_BUSY;
+    } else {
+        state->length[index] = length;
+        if (state->bufState[index ^ 1U] == UART_PP_SENDING) {
+            state->bufState[index] = UART_PP_QUEUED;
+        } else {
+            UART_PingPongTxKick(state, index);
+        }
+        state->fillIndex = index ^ 1U;
+    }
+
+    NVIC_EnableGlobalIRQ(primask);
+
+    return status;
+}
+
+/**
+ * @brief Check whether both ping-pong buffers have been sent
+ */
+bool UART_IsPingPongTxIdle(LPUART_RegType *base)
+{
+    uint8_t instance;
+
+    if (!UART_GetInstanceFromBase(base, &instance)) {
+        return true;
+    }
+
+    return (s_uartPpTx[instance].bufState[0] == UART_PP_FREE) &&
+           (s_uartPpTx[instance].bufState[1] == UART_PP_FREE);
+}
+
+/**
+ * @brief DMA half / major loop interrupt for circular RX
+ */
+static void UART_CircularRxDmaCallback(uint8_t channel, void *userData)
+{
+    uart_rx_dma_state_t *state = (uart_rx_dma_state_t *)userData;
+
+    (void)channel;
+
+    if (state->active) {
+        (void)UART_PollCircularRxDMA(state->base);
+    }
+}
+
+/**
+ * @brief Start continuous DMA reception into a circular buffer
+ */
+UART_Status_t UART_StartCircularRxDMA(LPUART_RegType *base, uint8_t dmaChannel,
+                                      uint8_t *rxBuff, uint16_t rxSize,
+                                      UART_RxDmaCallback_t callback, void *userData)
+{
+    uart_rx_dma_state_t *state;
+    dmamux_source_t dmaMuxSource;
+    dma_channel_config_t dmaConfig;
+    uint8_t instance;
+
+    /* CITER/BITER hold 15 bits when channel linking is disabled */
+    if ((rxBuff == NULL) || (rxSize < 2U) || (rxSize > 0x7FFFU) ||
+        (dmaChannel >= DMA_MAX_CHANNELS)) {
+        return UART_STATUS_ERROR;
+    }
+
+    if (!UART_GetInstanceFromBase(base, &instance)) {
+        return UART_STATUS_ERROR;
+    }
+
+    dmaMuxSource = UART_GetRxDmaMuxSource(base);
+    if (dmaMuxSource == DMAMUX_SRC_DISABLED) {
+        return UART_STATUS_ERROR;
+    }
+
+    state = &s_uartRxDma[instance];
+    if (state->active) {
+        return UART_STATUS_BUSY;
+    }
+
+    state->base = base;
+    state->buffer = rxBuff;
+    state->size = rxSize;
+    state->readPos = 0U;
+    state->channel = dmaChannel;
+    state->callback = callback;
+    state->userData = userData;
+
+    /* Source: UART DATA register, destination: buffer wrapping via DLAST */
+    dmaConfig.channel = dmaChannel;
+    dmaConfig.source = dmaMuxSource;
+    dmaConfig.transferType = DMA_TRANSFER_PERIPH_TO_MEM;
+    dmaConfig.transferSize = DMA_TRANSFER_SIZE_1B;
+    dmaConfig.priority = DMA_PRIORITY_NORMAL;
+    dmaConfig.sourceAddr = (uint32_t)&(base->DATA);
+    dmaConfig.sourceOffset = 0;
+    dmaConfig.sourceLastAddrAdjust = 0;
+    dmaConfig.destAddr = (uint32_t)rxBuff;
+    dmaConfig.destOffset = 1;
+    dmaConfig.destLastAddrAdjust = -(int32_t)rxSize;      /* Back to buffer start */
+    dmaConfig.minorLoopBytes = 1U;
+    dmaConfig.majorLoopCount = rxSize;
+    dmaConfig.enableInterrupt = true;
+    dmaConfig.disableRequestAfterDone = false;            /* Keep running forever */
+    dmaConfig.enablePeriodicTrigger = false;
+
+    if (DMA_ConfigChannel(&dmaConfig) != STATUS_SUCCESS) {
+        return UART_STATUS_ERROR;
+    }
+
+    /* Also interrupt at half buffer so one notification never covers a full lap */
+    DMA->TCD[dmaChannel].CSR |= DMA_TCD_CSR_INTHALF_MASK;
+
+    if (DMA_InstallCallback(dmaChannel, UART_CircularRxDmaCallback, state) != STATUS_SUCCESS) {
+        return UART_STATUS_ERROR;
+    }
+
+    state->active = true;
+
+    /* Idle detection starts counting after the stop bit, one idle character */
+    base->CTRL &= ~(LPUART_CTRL_RIE_MASK | LPUART_CTRL_IDLECFG_MASK);
+    base->CTRL |= LPUART_CTRL_ILT_MASK;
+    LPUART_CLEAR_STATUS_FLAG(base, LPUART_STAT_IDLE_MASK | UART_ASYNC_ERROR_FLAGS);
+
+    if (DMA_StartChannel(dmaChannel) != STATUS_SUCCESS) {
+        state->active = false;
+        return UART_STATUS_ERROR;
+    }
+
+    base->BAUD |= LPUART_BAUD_RDMAE_MASK;
+    base->CTRL |= LPUART_CTRL_ILIE_MASK;
+
+    return UART_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Stop continuous DMA reception
+ */
+void UART_StopCircularRxDMA(LPUART_RegType *base)
+{
+    uart_rx_dma_state_t *state;
+    uint8_t instance;
+
+    if (!UART_GetInstanceFromBase(base, &instance)) {
+        return;
+    }
+
+    state = &s_uartRxDma[instance];
+    if (!state->active) {
+        return;
+    }
+
+    base->CTRL &= ~LPUART_CTRL_ILIE_MASK;
+    base->BAUD &= ~LPUART_BAUD_RDMAE_MASK;
+
+    (void)UART_PollCircularRxDMA(base);
+
+    state->active = false;
+    (void)DMA_StopChannel(state->channel);
+}
+
+/**
+ * @brief Report bytes received since the last notification
+ */
+uint32_t UART_PollCircularRxDMA(LPUART_RegType *base)
+{
+    uart_rx_dma_state_t *state;
+    uint16_t remaining;
+    uint32_t writePos;
+    uint32_t readPos;
+    uint32_t count;
+    uint8_t instance;
+
+    if (!UART_GetInstanceFromBase(base, &instance)) {
+        return 0U;
+    }
+
+    state = &s_uartRxDma[instance];
+    if (!state->active ||
+        (DMA_GetRemainingMajorLoops(state->channel, &remaining) != STATUS_SUCCESS)) {
+        return 0U;
+    }
+
+    /* CITER counts down from size and reloads to size at the wrap */
+    writePos = (uint32_t)state->size - (uint32_t)remaining;
+    if (writePos >= state->size) {
+        writePos = 0U;
+    }
+
+    readPos = state->readPos;
+    if (writePos == readPos) {
+        return 0U;
+    }
+
+    if (writePos > readPos) {
+        count = writePos - readPos;
+        if (state->callback != NULL) {
+            state->callback(base, &state->buffer[readPos], count, state->userData);
+        }
+    } else {
+        /* Wrapped: tail of the buffer first, then the head */
+        count = (uint32_t)state->size - readPos;
+        if (state->callback != NULL) {
+            state->callback(base, &state->buffer[readPos], count, state->userData);
+            if (writePos != 0U) {
+                state->callback(base, state->buffer, writePos, state->userData);
+            }
+        }
+        count += writePos;
+    }
+
+    state->readPos = (uint16_t)writePos;
+
+    return count;
+}
+#endif
+
+/*******************************************************************************
+ * Handle-Based Functions
+ ******************************************************************************/
+
+/**
+ * @brief Initialize UART and fill a handle with the resolved instance state
+ */
+UART_Status_t UART_HandleInit(uart_handle_t *handle, LPUART_RegType *base,
+                              const UART_Config_t *config, uint32_t srcClock)
+{
+    UART_Status_t status;
+    uint8_t instance;
+
+    if (handle == NULL) {
+        return UART_STATUS_ERROR;
+    }
+
+    handle->base = NULL;
+    handle->async = NULL;
+    handle->srcClock = 0U;
+    handle->instance = 0U;
+    handle->txDmaChannel = UART_HANDLE_NO_DMA;
+    handle->rxDmaChannel = UART_HANDLE_NO_DMA;
+    handle->txDmaSource = 0U;
+    handle->rxDmaSource = 0U;
+
+    /* Handles only exist for real instances, other bases cannot use the ring ISR */
+    if (!UART_GetInstanceFromBase(base, &instance)) {
+        return UART_STATUS_ERROR;
+    }
+
+    status = UART_Init(base, config, srcClock);
+    if (status != UART_STATUS_SUCCESS) {
+        return status;
+    }
+
+    handle->base = base;
+    handle->async = &s_uartAsync[instance];
+    handle->srcClock = (srcClock != 0U) ? srcClock :
+                       UART_GetInstanceClockFreqInternal(s_uartStateInstance[instance]);
+    handle->instance = instance;
+
+    return UART_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Send data in blocking mode through a handle
+ */
+UART_Status_t UART_HandleSendBlocking(const uart_handle_t *handle, const uint8_t *txBuff, uint32_t txSize)
+{
+    if (HAL_PARAM_INVALID((handle == NULL) || (handle->base == NULL) || (txBuff == NULL) || (txSize == 0U))) {
+        return UART_STATUS_ERROR;
+    }
+
+#if OSAL_FREERTOS
+    if (OSAL_CanBlock()) {
+        return UART_OsalSend(handle->base, handle->instance, txBuff, txSize);
+    }
+#endif
+
+    return UART_SendPolled(handle->base, txBuff, txSize);
+}
+
+/**
+ * @brief Receive data in blocking mode through a handle
+ */
+UART_Status_t UART_HandleReceiveBlocking(const uart_handle_t *handle, uint8_t *rxBuff, uint32_t rxSize)
+{
+    if (HAL_PARAM_INVALID((handle == NULL) || (handle->base == NULL) || (rxBuff == NULL) || (rxSize == 0U))) {
+        return UART_STATUS_ERROR;
+    }
+
+#if OSAL_FREERTOS
+    if (OSAL_CanBlock()) {
+        return UART_OsalReceive(handle->base, handle->instance, rxBuff, rxSize);
+    }
+#endif
+
+    return UART_ReceivePolled(handle->base, rxBuff, rxSize);
+}
+
+/**
+ * @brief Queue data for interrupt-driven transmission through a handle
+ */
+UART_Status_t UART_HandleWriteAsync(const uart_handle_t *handle, const uint8_t *txBuff,
+                                    uint32_t txSize, uint32_t *written)
+{
+    if ((handle == NULL) || (handle->async == NULL) || !handle->async->enabled) {
+        if (written != NULL) {
+            *written = 0U;
+        }
+        return UART_STATUS_ERROR;
+    }
+
+    return UART_RingWrite(handle->base, handle->async, txBuff, txSize, written);
+}
+
+/**
+ * @brief Get number of received bytes waiting in the RX ring of a handle
+ */
+uint32_t UART_HandleReadAvailable(const uart_handle_t *handle)
+{
+    if ((handle == NULL) || (handle->async == NULL) || !handle->async->enabled) {
+        return 0U;
+    }
+
+    return handle->async->rxHead - handle->async->rxTail;
+}
+
+/**
+ * @brief Read received bytes from the RX ring of a handle
+ */
+uint32_t UART_HandleReadAsync(const uart_handle_t *handle, uint8_t *rxBuff, uint32_t rxSize)
+{
+    if ((handle == NULL) || (handle->async == NULL) || !handle->async->enabled) {
+        return 0U;
+    }
+
+    return UART_RingRead(handle->async, rxBuff, rxSize);
+}
+
+/**
+ * @brief Handle LPUART interrupt for ring buffer transfer through a handle
+ */
+void UART_HandleIRQHandler(const uart_handle_t *handle)
+{
+    /* Instance is validated once in UART_HandleInit(), not on every interrupt */
+    UART_ServiceIrq(handle->base, handle->instance);
+}
+
+#if UART_DMA_ENABLE
+/**
+ * @brief Bind TX / RX DMA channels to a handle
+ */
+UART_Status_t UART_HandleConfigDMA(uart_handle_t *handle, uint8_t txDmaChannel, uint8_t rxDmaChannel)
+{
+    if ((handle == NULL) || (handle->base == NULL)) {
+        return UART_STATUS_ERROR;
+    }
+
+    if (txDmaChannel != UART_HANDLE_NO_DMA) {
+        if (UART_ConfigTxDMA(handle->base, txDmaChannel) != UART_STATUS_SUCCESS) {
+            return UART_STATUS_ERROR;
+        }
+        handle->txDmaSource = (uint8_t)UART_GetTxDmaMuxSource(handle->base);
+    }
+
+    if (rxDmaChannel != UART_HANDLE_NO_DMA) {
+        if (UART_ConfigRxDMA(handle->base, rxDmaChannel) != UART_STATUS_SUCCESS) {
+            return UART_STATUS_ERROR;
+        }
+        handle->rxDmaSource = (uint8_t)UART_GetRxDmaMuxSource(handle->base);
+    }
+
+    handle->txDmaChannel = txDmaChannel;
+    handle->rxDmaChannel = rxDmaChannel;
+
+    return UART_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Send data using the TX DMA channel bound to a handle
+ */
+UART_Status_t UART_HandleSendDMA(const uart_handle_t *handle, const uint8_t *txBuff, uint32_t txSize)
+{
+    if (HAL_PARAM_INVALID((handle == NULL) || (handle->txDmaChannel == UART_HANDLE_NO_DMA) ||
+                          (txBuff == NULL) || (txSize == 0U))) {
+        return UART_STATUS_ERROR;
+    }
+
+    return UART_StartTxDma(handle->base, handle->txDmaChannel,
+                           (dmamux_source_t)handle->txDmaSource, txBuff, txSize);
+}
+
+/**
+ * @brief Receive data using the RX DMA channel bound to a handle
+ */
+UART_Status_t UART_HandleReceiveDMA(const uart_handle_t *handle, uint8_t *rxBuff, uint32_t rxSize)
+{
+    if (HAL_PARAM_INVALID((handle == NULL) || (handle->rxDmaChannel == UART_HANDLE_NO_DMA) ||
+                          (rxBuff == NULL) || (rxSize == 0U))) {
+        return UART_STATUS_ERROR;
+    }
+
+    return UART_StartRxDma(handle->base, handle->rxDmaChannel,
+                           (dmamux_source_t)handle->rxDmaSource, rxBuff, rxSize);
 }
 #endif
@@ -20,6 +20,36 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "uart_reg.h"
+#include "pcc.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Software TX ring size per instance for UART_WriteAsync() (power of 2) */
+#ifndef UART_TX_RING_SIZE
+#define UART_TX_RING_SIZE           (256U)
+#endif
+
+/** @brief Software RX ring size per instance for UART_ReadAsync() (power of 2) */
+#ifndef UART_RX_RING_SIZE
+#define UART_RX_RING_SIZE           (64U)
+#endif
+
+/** @brief Maximum baud rate error accepted by UART_Init() in ppm (default 2%) */
+#ifndef UART_BAUD_MAX_ERROR_PPM
+#define UART_BAUD_MAX_ERROR_PPM     (20000U)
+#endif
+
+/** @brief RTOS builds: mutex wait and per-wakeup transfer timeout of the blocking calls (ms) */
+#ifndef UART_OSAL_TIMEOUT_MS
+#define UART_OSAL_TIMEOUT_MS        (1000U)
+#endif
+
+/** @brief Maximum number of segments per UART_SendDMAVector() call */
+#ifndef UART_DMA_MAX_IOV
+#define UART_DMA_MAX_IOV            (4U)
+#endif
 
 /*******************************************************************************
  * Type Definitions
@@ -61,6 +91,9 @@ typedef struct {
     UART_DataBits_t   dataBits;     /**< Number of data bits */
     bool              enableTx;     /**< Enable transmitter */
     bool              enableRx;     /**< Enable receiver */
+    bool              enableFifo;   /**< Enable TX/RX hardware FIFOs */
+    uint8_t           txWatermark;  /**< TDRE when TX FIFO count <= watermark (0 to depth-1) */
+    uint8_t           rxWatermark;  /**< RDRF when RX FIFO count > watermark (0 to depth-1) */
 } UART_Config_t;
 
 /**
@@ -72,6 +105,75 @@ typedef struct {
     uint32_t       dataSize;        /**< Size of data transfer */
 } UART_Transfer_t;
 
+/**
+ * @brief Scatter-gather transmit segment
+ */
+typedef struct {
+    const uint8_t *data;            /**< Segment start */
+    uint32_t       length;          /**< Segment length in bytes (0 = skipped) */
+} UART_IoVec_t;
+
+/**
+ * @brief TX complete callback (ring drained and last stop bit sent)
+ * @param base     UART instance
+ * @param userData User context
+ */
+typedef void (*UART_TxCallback_t)(LPUART_RegType *base, void *userData);
+
+/**
+ * @brief RX callback (new bytes stored in the RX ring)
+ * @param base      UART instance
+ * @param available Bytes waiting for UART_ReadAsync()
+ * @param userData  User context
+ */
+typedef void (*UART_RxCallback_t)(LPUART_RegType *base, uint32_t available, void *userData);
+
+/**
+ * @brief Error callback
+ * @param base       UART instance
+ * @param errorFlags LPUART_STAT_PF/FE/NF/OR_MASK bits seen in this interrupt
+ * @param userData   User context
+ */
+typedef void (*UART_ErrorCallback_t)(LPUART_RegType *base, uint32_t errorFlags, void *userData);
+
+/**
+ * @brief Per-instance event callbacks for interrupt-driven transfer
+ */
+typedef struct {
+    UART_TxCallback_t    txComplete;    /**< TX ring empty and line idle (NULL = off) */
+    UART_RxCallback_t    rxReceived;    /**< Data stored in RX ring (NULL = off) */
+    UART_ErrorCallback_t error;         /**< Parity/framing/noise/overrun (NULL = off) */
+    void                *userData;      /**< Passed to every callback */
+} UART_Callbacks_t;
+
+/**
+ * @brief Low-power wakeup sources (bit flags)
+ */
+typedef enum {
+    UART_WAKEUP_RX_EDGE = 0x01U,    /**< Active edge on the RX pin */
+    UART_WAKEUP_MATCH1  = 0x02U,    /**< Received character equal to MA1 */
+    UART_WAKEUP_MATCH2  = 0x04U     /**< Received character equal to MA2 */
+} UART_WakeupSource_t;
+
+/**
+ * @brief Low-power wakeup configuration
+ */
+typedef struct {
+    bool     wakeOnRxEdge;          /**< Interrupt on the first RX edge (one-shot) */
+    bool     wakeOnMatch1;          /**< Enable match address 1 (MAEN1 + MA1IE) */
+    bool     wakeOnMatch2;          /**< Enable match address 2 (MAEN2 + MA2IE) */
+    uint16_t matchAddress1;         /**< Match address 1 (10-bit) */
+    uint16_t matchAddress2;         /**< Match address 2 (10-bit) */
+} UART_WakeupConfig_t;
+
+/**
+ * @brief Wakeup callback
+ * @param base     UART instance that woke the core
+ * @param source   UART_WakeupSource_t flags seen in this interrupt
+ * @param userData User context
+ */
+typedef void (*UART_WakeupCallback_t)(LPUART_RegType *base, uint32_t source, void *userData);
+
 /**
  * @brief UART status codes
  */
@@ -86,6 +188,31 @@ typedef enum {
     UART_STATUS_ERROR               /**< General error */
 } UART_Status_t;
 
+/** @brief DMA channel value meaning "no DMA bound to this handle" */
+#define UART_HANDLE_NO_DMA      (0xFFU)
+
+/** @brief Interrupt-driven transfer state of one instance (private to uart.c) */
+struct uart_async_state;
+
+/**
+ * @brief Per-instance UART handle
+ * @details Filled once by UART_HandleInit(): the instance, ring buffer state
+ *          and DMAMUX sources are resolved there, so the UART_Handle*()
+ *          calls skip the base-address lookup of the base-pointer API.
+ *          Fields are read-only for the application.
+ */
+typedef struct {
+    LPUART_RegType          *base;          /**< Peripheral base address */
+    struct uart_async_state *async;         /**< Ring buffer state of the instance */
+    uint32_t                 srcClock;      /**< Functional clock at init (Hz) */
+    uint8_t                  instance;      /**< Driver state slot (LPUART number unless
+                                                 instances are compiled out in hal_config.h) */
+    uint8_t                  txDmaChannel;  /**< TX DMA channel or UART_HANDLE_NO_DMA */
+    uint8_t                  rxDmaChannel;  /**< RX DMA channel or UART_HANDLE_NO_DMA */
+    uint8_t                  txDmaSource;   /**< Cached DMAMUX TX request source */
+    uint8_t                  rxDmaSource;   /**< Cached DMAMUX RX request source */
+} uart_handle_t;
+
 /*******************************************************************************
  * Function Prototypes - Initialization
  ******************************************************************************/
@@ -98,6 +225,17 @@ typedef enum {
  * @param[in] srcClock  Source clock frequency in Hz (set to 0 to auto-detect via Clock Manager)
  * 
  * @return UART_STATUS_SUCCESS if successful
+ * 
+ * @note The OSR/SBR pair closest to baudRate is searched over OSR 4..32,
+ *       BOTHEDGE is set automatically for OSR below 8. Returns
+ *       UART_STATUS_ERROR if the error exceeds UART_BAUD_MAX_ERROR_PPM.
+ *       With srcClock = 0 the live PCC clock of the instance is used.
+ * @note With enableFifo and rxWatermark > 0, the receiver also asserts RDRF
+ *       after one idle character, so bytes below the watermark are not stuck.
+ *       Watermarks above depth-1 are clamped.
+ * @note Registers a Clock Manager notifier: TE / RE pause around
+ *       ClockManager_NotifyBeforeChange() and SBR / OSR are recomputed for
+ *       baudRate when ClockManager_Update() reports new frequencies.
  */
 UART_Status_t UART_Init(LPUART_RegType *base, const UART_Config_t *config, uint32_t srcClock);
 
@@ -127,6 +265,12 @@ void UART_GetDefaultConfig(UART_Config_t *config);
  * @param[in] txSize    Number of bytes to send
  * 
  * @return UART_STATUS_SUCCESS if successful
+ * 
+ * @note With OSAL_FREERTOS = 1 and called from a task: a per-instance TX
+ *       mutex serialises callers (UART_STATUS_BUSY after
+ *       UART_OSAL_TIMEOUT_MS). When UART_EnableAsync() is active the data
+ *       goes through the TX ring and the task sleeps until TC, otherwise
+ *       TDRE is polled as in bare-metal builds.
  */
 UART_Status_t UART_SendBlocking(LPUART_RegType *base, const uint8_t *txBuff, uint32_t txSize);
 
@@ -138,6 +282,12 @@ UART_Status_t UART_SendBlocking(LPUART_RegType *base, const uint8_t *txBuff, uin
  * @param[in]  rxSize  Number of bytes to receive
  * 
  * @return UART_STATUS_SUCCESS if successful
+ * 
+ * @note With OSAL_FREERTOS = 1 and called from a task: a per-instance RX
+ *       mutex serialises callers. When UART_EnableAsync() is active the
+ *       task sleeps on the RX ring interrupt (UART_STATUS_TIMEOUT if no
+ *       byte arrives for UART_OSAL_TIMEOUT_MS); line errors are then only
+ *       counted by UART_GetRxDropCount() / the error callback.
  */
 UART_Status_t UART_ReceiveBlocking(LPUART_RegType *base, uint8_t *rxBuff, uint32_t rxSize);
 
@@ -209,6 +359,62 @@ bool UART_IsRxReady(LPUART_RegType *base);
  */
 UART_Status_t UART_GetError(LPUART_RegType *base);
 
+/*******************************************************************************
+ * Function Prototypes - FIFO Control
+ ******************************************************************************/
+
+/**
+ * @brief Get hardware FIFO depth
+ * 
+ * @param[in] base  Pointer to UART peripheral base address
+ * 
+ * @return TX FIFO depth in words (RX depth is the same on S32K144), 0 on error
+ */
+uint8_t UART_GetFifoDepth(LPUART_RegType *base);
+
+/**
+ * @brief Set FIFO watermarks at runtime
+ * 
+ * @param[in] base          Pointer to UART peripheral base address
+ * @param[in] txWatermark   TX watermark (0 to depth-1)
+ * @param[in] rxWatermark   RX watermark (0 to depth-1)
+ * 
+ * @return UART_STATUS_SUCCESS if successful, UART_STATUS_ERROR if out of range
+ */
+UART_Status_t UART_SetFifoWatermarks(LPUART_RegType *base, uint8_t txWatermark, uint8_t rxWatermark);
+
+/**
+ * @brief Discard all data in the TX FIFO
+ * 
+ * @param[in] base  Pointer to UART peripheral base address
+ */
+void UART_FlushTxFifo(LPUART_RegType *base);
+
+/**
+ * @brief Discard all data in the RX FIFO
+ * 
+ * @param[in] base  Pointer to UART peripheral base address
+ */
+void UART_FlushRxFifo(LPUART_RegType *base);
+
+/**
+ * @brief Get number of words in the TX FIFO
+ * 
+ * @param[in] base  Pointer to UART peripheral base address
+ * 
+ * @return TX FIFO count
+ */
+uint32_t UART_GetTxFifoCount(LPUART_RegType *base);
+
+/**
+ * @brief Get number of words in the RX FIFO
+ * 
+ * @param[in] base  Pointer to UART peripheral base address
+ * 
+ * @return RX FIFO count
+ */
+uint32_t UART_GetRxFifoCount(LPUART_RegType *base);
+
 /*******************************************************************************
  * Function Prototypes - Interrupt Control
  ******************************************************************************/
@@ -238,6 +444,211 @@ void UART_DisableInterrupts(LPUART_RegType *base, uint32_t intMask);
  */
 uint32_t UART_GetEnabledInterrupts(LPUART_RegType *base);
 
+/*******************************************************************************
+ * Function Prototypes - Interrupt-Driven Transfer
+ ******************************************************************************/
+
+/**
+ * @brief Enable interrupt-driven (ring buffer) transfer
+ * @details Resets the TX/RX software rings and enables the RX and overrun
+ *          interrupts. TX interrupt is enabled on demand by UART_WriteAsync().
+ *          If UART_Init() already enabled the FIFOs, the configured watermarks
+ *          are kept; otherwise the FIFOs are enabled here with TX watermark 1
+ *          and RX watermark 2 (1-character idle flush).
+ * 
+ * @param[in] base  Pointer to UART peripheral base address
+ * 
+ * @return UART_STATUS_SUCCESS if successful, UART_STATUS_ERROR for invalid base
+ * 
+ * @note Call after UART_Init(). The LPUART interrupt must be enabled in NVIC
+ *       and UART_IRQHandler() called from the LPUARTx_RxTx_IRQHandler.
+ * 
+ * @code
+ * UART_Init(LPUART1, &config, 0U);
+ * UART_EnableAsync(LPUART1);
+ * NVIC_EnableIRQ(LPUART1_RxTx_IRQn);
+ * 
+ * UART_WriteAsync(LPUART1, (const uint8_t *)"boot\r\n", 6U, NULL);
+ * 
+ * void LPUART1_RxTx_IRQHandler(void) {
+ *     UART_IRQHandler(LPUART1);
+ * }
+ * @endcode
+ */
+UART_Status_t UART_EnableAsync(LPUART_RegType *base);
+
+/**
+ * @brief Disable interrupt-driven transfer
+ * @details Disables TX/RX/overrun interrupts. Data left in the rings is discarded.
+ * 
+ * @param[in] base  Pointer to UART peripheral base address
+ */
+void UART_DisableAsync(LPUART_RegType *base);
+
+/**
+ * @brief Queue data for interrupt-driven transmission (non-blocking)
+ * @details Copies as many bytes as fit into the TX ring and returns at once.
+ * 
+ * @param[in]  base     Pointer to UART peripheral base address
+ * @param[in]  txBuff   Pointer to transmit data
+ * @param[in]  txSize   Number of bytes to queue
+ * @param[out] written  Number of bytes actually queued (may be NULL)
+ * 
+ * @return UART_STATUS_SUCCESS if all bytes were queued,
+ *         UART_STATUS_BUSY if the ring was full and only part was queued,
+ *         UART_STATUS_ERROR for invalid parameters or async mode not enabled
+ */
+UART_Status_t UART_WriteAsync(LPUART_RegType *base, const uint8_t *txBuff,
+                              uint32_t txSize, uint32_t *written);
+
+/**
+ * @brief Get number of received bytes waiting in the RX ring
+ * 
+ * @param[in] base  Pointer to UART peripheral base address
+ * 
+ * @return Number of bytes available for UART_ReadAsync()
+ */
+uint32_t UART_ReadAvailable(LPUART_RegType *base);
+
+/**
+ * @brief Read received bytes from the RX ring (non-blocking)
+ * 
+ * @param[in]  base     Pointer to UART peripheral base address
+ * @param[out] rxBuff   Pointer to destination buffer
+ * @param[in]  rxSize   Maximum number of bytes to read
+ * 
+ * @return Number of bytes copied (0 if none available)
+ */
+uint32_t UART_ReadAsync(LPUART_RegType *base, uint8_t *rxBuff, uint32_t rxSize);
+
+/**
+ * @brief Get number of bytes still queued for transmission
+ * 
+ * @param[in] base  Pointer to UART peripheral base address
+ * 
+ * @return Bytes in the TX ring (not counting the hardware FIFO)
+ */
+uint32_t UART_GetTxPending(LPUART_RegType *base);
+
+/**
+ * @brief Get number of received bytes dropped because the RX ring was full
+ *        or the hardware overran
+ * 
+ * @param[in] base  Pointer to UART peripheral base address
+ * 
+ * @return Dropped byte count since UART_EnableAsync()
+ */
+uint32_t UART_GetRxDropCount(LPUART_RegType *base);
+
+/**
+ * @brief Install event callbacks for interrupt-driven transfer
+ * @details The callbacks are copied into the per-instance driver handle and
+ *          dispatched from UART_IRQHandler():
+ *          - rxReceived after each RX FIFO drain that stored new bytes
+ *          - txComplete once the TX ring is empty and TC is set (TCIE is
+ *            armed only while a callback is installed)
+ *          - error for PF/FE/NF/OR; PEIE/FEIE/NEIE are enabled while an
+ *            error callback is installed, the byte itself is still stored
+ * 
+ * @param[in] base       Pointer to UART peripheral base address
+ * @param[in] callbacks  Callback set (NULL removes all callbacks)
+ * 
+ * @return UART_STATUS_SUCCESS if successful, UART_STATUS_ERROR for invalid base
+ * 
+ * @note Callbacks run in interrupt context. Calling UART_WriteAsync() or
+ *       UART_ReadAsync() from them is allowed.
+ * 
+ * @code
+ * static void OnRx(LPUART_RegType *base, uint32_t available, void *user)
+ * {
+ *     uint8_t buf[16];
+ *     uint32_t n = UART_ReadAsync(base, buf, sizeof(buf));
+ *     Protocol_Feed(buf, n);
+ * }
+ * 
+ * UART_Callbacks_t cb = { .rxReceived = OnRx, .error = OnError };
+ * UART_EnableAsync(LPUART1);
+ * UART_InstallCallbacks(LPUART1, &cb);
+ * @endcode
+ */
+UART_Status_t UART_InstallCallbacks(LPUART_RegType *base, const UART_Callbacks_t *callbacks);
+
+/**
+ * @brief Handle LPUART interrupt for ring buffer transfer (called from ISR)
+ * @details Drains the RX FIFO into the RX ring and refills the TX FIFO from
+ *          the TX ring, so each interrupt moves up to a full FIFO of data.
+ *          Dispatches the callbacks installed with UART_InstallCallbacks().
+ * 
+ * @param[in] base  Pointer to UART peripheral base address
+ * 
+ * @note User should call this from LPUARTx_RxTx_IRQHandler.
+ */
+void UART_IRQHandler(LPUART_RegType *base);
+
+/*******************************************************************************
+ * Function Prototypes - Low-Power Wakeup
+ ******************************************************************************/
+
+/**
+ * @brief Configure the UART as a wakeup source for STOP / VLPS
+ * 
+ * @details Clears DOZEEN so the LPUART stays enabled in low-power modes and
+ *          arms the RX edge and/or match address interrupts. With match
+ *          address enabled, characters that differ from MA1/MA2 are
+ *          discarded by hardware, so the core only wakes for its own address.
+ * 
+ * @param[in] base    Pointer to UART peripheral base address
+ * @param[in] config  Wakeup configuration
+ * 
+ * @return UART_STATUS_SUCCESS if successful
+ * @return UART_STATUS_ERROR if match wakeup is requested while the functional
+ *         clock is not SIRCDIV2, or SIRCCSR is locked
+ * 
+ * @note Match wakeup needs the receiver clocked during STOP: select
+ *       PCC_CLK_SRC_SIRC_DIV2 with UART_EnableClockSource() before UART_Init().
+ *       SIRC is then kept running in STOP/VLPS (SCG_SetSircLowPowerEnable()).
+ * @note The interrupts reach the core through UART_IRQHandler(), so the
+ *       LPUARTx_RxTx IRQ must be enabled in the NVIC.
+ * 
+ * @code
+ * UART_WakeupConfig_t wake = { .wakeOnMatch1 = true, .matchAddress1 = 0x5AU };
+ * UART_EnableClockSource(1U, PCC_CLK_SRC_SIRC_DIV2);
+ * UART_Init(LPUART1, &config, 0U);
+ * UART_InstallWakeupCallback(LPUART1, OnWake, NULL);
+ * UART_ConfigWakeup(LPUART1, &wake);
+ * SMC_EnterStopMode(SMC_STOP_MODE_VLPS);
+ * @endcode
+ */
+UART_Status_t UART_ConfigWakeup(LPUART_RegType *base, const UART_WakeupConfig_t *config);
+
+/**
+ * @brief Disarm all wakeup sources and disable match address filtering
+ * 
+ * @param[in] base  Pointer to UART peripheral base address
+ */
+void UART_DisableWakeup(LPUART_RegType *base);
+
+/**
+ * @brief Install wakeup callback (called from UART_IRQHandler())
+ * 
+ * @param[in] base      Pointer to UART peripheral base address
+ * @param[in] callback  Callback function (NULL to remove)
+ * @param[in] userData  User context passed to the callback
+ */
+void UART_InstallWakeupCallback(LPUART_RegType *base, UART_WakeupCallback_t callback, void *userData);
+
+/**
+ * @brief Get and clear the wakeup sources seen since the last call
+ * 
+ * @param[in] base  Pointer to UART peripheral base address
+ * 
+ * @return UART_WakeupSource_t flags, 0 if none
+ * 
+ * @note RX edge wakeup is one-shot, call UART_ConfigWakeup() again before
+ *       the next STOP entry.
+ */
+uint32_t UART_GetWakeupSource(LPUART_RegType *base);
+
 /*******************************************************************************
  * Function Prototypes - Clock Control
  ******************************************************************************/
@@ -249,6 +660,14 @@ uint32_t UART_GetEnabledInterrupts(LPUART_RegType *base);
  */
 void UART_EnableClock(uint8_t instance);
 
+/**
+ * @brief Enable UART clock from a selected PCC source (divide by 1)
+ * 
+ * @param[in] instance  UART instance number (0, 1, 2)
+ * @param[in] source    Functional clock source, e.g. PCC_CLK_SRC_SPLL_DIV2 for 1-3 Mbps
+ */
+void UART_EnableClockSource(uint8_t instance, pcc_clock_source_t source);
+
 /**
  * @brief Disable UART clock
  * 
@@ -264,6 +683,32 @@ void UART_DisableClock(uint8_t instance);
  */
 uint32_t UART_GetClockFrequency(uint8_t instance);
 
+/**
+ * @brief Get baud rate achieved by the last UART_Init()
+ * 
+ * @param[in] base  Pointer to UART peripheral base address
+ * 
+ * @return Achieved baud rate in bit/s, 0 if not initialized
+ */
+uint32_t UART_GetActualBaudRate(LPUART_RegType *base);
+
+/**
+ * @brief Get baud rate error of the last UART_Init()
+ * 
+ * @param[in] base  Pointer to UART peripheral base address
+ * 
+ * @return Signed error in ppm ((actual - requested) / requested)
+ * 
+ * @code
+ * // 2 Mbps from SPLLDIV2 = 40 MHz: OSR 20, SBR 1, 0 ppm
+ * UART_EnableClockSource(1U, PCC_CLK_SRC_SPLL_DIV2);
+ * config.baudRate = 2000000U;
+ * UART_Init(LPUART1, &config, 0U);
+ * int32_t ppm = UART_GetBaudRateError(LPUART1);
+ * @endcode
+ */
+int32_t UART_GetBaudRateError(LPUART_RegType *base);
+
 /*******************************************************************************
  * Function Prototypes - DMA Transfer
  ******************************************************************************/
@@ -387,7 +832,328 @@ void UART_DisableTxDMA(LPUART_RegType *base);
  * @param[in] base  Pointer to UART peripheral base address
  */
 void UART_DisableRxDMA(LPUART_RegType *base);
+
+/**
+ * @brief Send several buffers as one DMA transfer (scatter-gather)
+ * @details Builds one eDMA TCD per segment in a per-instance RAM pool and
+ *          links them through ESG/DLAST_SGA, so header, payload and CRC go out
+ *          back to back without a staging copy. The last TCD disables the
+ *          request and sets DONE, like UART_SendDMA().
+ * 
+ * @param[in] base          Pointer to UART peripheral base address
+ * @param[in] dmaChannel    DMA channel number for TX (0-15)
+ * @param[in] iov           Segment array
+ * @param[in] count         Number of segments (1 to UART_DMA_MAX_IOV)
+ * 
+ * @return UART_STATUS_SUCCESS if transfer started,
+ *         UART_STATUS_BUSY if the previous vector transfer on this instance
+ *         is still running, UART_STATUS_ERROR for invalid parameters
+ * 
+ * @note Segment buffers must stay valid until the transfer completes.
+ *       Each segment is limited to 32767 bytes.
+ * 
+ * @code
+ * UART_IoVec_t iov[3] = {
+ *     { (const uint8_t *)&hdr, sizeof(hdr) },
+ *     { payload, payloadLen },
+ *     { (const uint8_t *)&crc, sizeof(crc) }
+ * };
+ * UART_ConfigTxDMA(LPUART1, 0);
+ * UART_SendDMAVector(LPUART1, 0, iov, 3U);
+ * @endcode
+ */
+UART_Status_t UART_SendDMAVector(LPUART_RegType *base, uint8_t dmaChannel,
+                                 const UART_IoVec_t *iov, uint32_t count);
+
+/**
+ * @brief Start double-buffered (ping-pong) DMA transmission
+ * @details The application fills one buffer while the other is on the wire.
+ *          The DMA major loop interrupt frees the sent buffer and starts the
+ *          queued one, so back-to-back frames leave no gap beyond the ISR
+ *          latency (hidden by the TX FIFO when enabled).
+ * 
+ * @param[in] base          Pointer to UART peripheral base address
+ * @param[in] dmaChannel    DMA channel number for TX (0-15)
+ * @param[in] bufferA       First buffer
+ * @param[in] bufferB       Second buffer
+ * @param[in] size          Capacity of each buffer in bytes (1-32767)
+ * 
+ * @return UART_STATUS_SUCCESS if successful
+ * 
+ * @note DMA_IRQHandler(dmaChannel) must be called from the DMA channel IRQ.
+ * 
+ * @code
+ * static uint8_t bufA[512], bufB[512];
+ * UART_StartPingPongTxDMA(LPUART1, 0, bufA, bufB, sizeof(bufA));
+ * NVIC_EnableIRQ(DMA0_IRQn);
+ * 
+ * uint16_t cap;
+ * uint8_t *buf = UART_GetPingPongTxBuffer(LPUART1, &cap);
+ * if (buf != NULL) {
+ *     uint16_t len = Telemetry_Fill(buf, cap);
+ *     UART_CommitPingPongTxBuffer(LPUART1, len);
+ * }
+ * @endcode
+ */
+UART_Status_t UART_StartPingPongTxDMA(LPUART_RegType *base, uint8_t dmaChannel,
+                                      uint8_t *bufferA, uint8_t *bufferB, uint16_t size);
+
+/**
+ * @brief Stop ping-pong transmission
+ * @details Aborts the buffer in flight and drops any queued buffer.
+ * 
+ * @param[in] base  Pointer to UART peripheral base address
+ */
+void UART_StopPingPongTxDMA(LPUART_RegType *base);
+
+/**
+ * @brief Get the buffer the application may fill next
+ * 
+ * @param[in]  base      Pointer to UART peripheral base address
+ * @param[out] capacity  Buffer capacity in bytes (may be NULL)
+ * 
+ * @return Free buffer, or NULL if one buffer is in flight and the other is queued
+ */
+uint8_t *UART_GetPingPongTxBuffer(LPUART_RegType *base, uint16_t *capacity);
+
+/**
+ * @brief Queue the buffer returned by UART_GetPingPongTxBuffer()
+ * @details Starts DMA immediately if the line is idle, otherwise the buffer
+ *          is sent as soon as the one in flight completes.
+ * 
+ * @param[in] base    Pointer to UART peripheral base address
+ * @param[in] length  Number of valid bytes (1 to capacity)
+ * 
+ * @return UART_STATUS_SUCCESS if queued,
+ *         UART_STATUS_BUSY if no buffer was free,
+ *         UART_STATUS_ERROR for invalid length or inactive mode
+ */
+UART_Status_t UART_CommitPingPongTxBuffer(LPUART_RegType *base, uint16_t length);
+
+/**
+ * @brief Check whether both ping-pong buffers have been sent
+ * 
+ * @param[in] base  Pointer to UART peripheral base address
+ * 
+ * @return true if nothing is in flight or queued
+ */
+bool UART_IsPingPongTxIdle(LPUART_RegType *base);
+
+/**
+ * @brief Circular DMA RX notification callback
+ *
+ * @param[in] base      UART instance that received the data
+ * @param[in] data      Pointer to the new bytes inside the circular buffer
+ * @param[in] length    Number of new bytes (never wraps past the buffer end)
+ * @param[in] userData  User data passed to UART_StartCircularRxDMA()
+ *
+ * @note Called from interrupt context. The bytes stay valid until the DMA
+ *       laps the buffer, so copy or parse them before returning.
+ */
+typedef void (*UART_RxDmaCallback_t)(LPUART_RegType *base, const uint8_t *data,
+                                     uint32_t length, void *userData);
+
+/**
+ * @brief Start continuous DMA reception into a circular buffer
+ * @details The DMA channel writes every received byte into @p rxBuff and
+ *          wraps back to the start through DLAST, so it never stops. New data
+ *          is reported through @p callback on line idle (ILIE), half buffer
+ *          and buffer wrap, using the current CITER position.
+ *
+ * @param[in] base          Pointer to UART peripheral base address
+ * @param[in] dmaChannel    DMA channel number for RX (0-15)
+ * @param[in] rxBuff        Circular receive buffer
+ * @param[in] rxSize        Buffer size in bytes (2-32767)
+ * @param[in] callback      Called with each new data segment (may be NULL)
+ * @param[in] userData      User data passed to @p callback
+ *
+ * @return UART_STATUS_SUCCESS if reception started
+ *
+ * @note The application must route both the DMA channel IRQ
+ *       (DMA_IRQHandler()) and the LPUART IRQ (UART_IRQHandler()) at the
+ *       same NVIC priority. Both interrupts are enabled here in the
+ *       peripherals, but not in NVIC.
+ * @note Size the buffer for the longest burst between two notifications,
+ *       data overwritten before it is reported cannot be detected.
+ * @note Not compatible with UART_EnableAsync() RX on the same instance.
+ *
+ * @code
+ * static uint8_t rxRing[256];
+ * UART_StartCircularRxDMA(LPUART1, 2, rxRing, sizeof(rxRing), OnRxData, NULL);
+ * NVIC_EnableIRQ(DMA2_IRQn);
+ * NVIC_EnableIRQ(LPUART1_RxTx_IRQn);
+ * @endcode
+ */
+UART_Status_t UART_StartCircularRxDMA(LPUART_RegType *base, uint8_t dmaChannel,
+                                      uint8_t *rxBuff, uint16_t rxSize,
+                                      UART_RxDmaCallback_t callback, void *userData);
+
+/**
+ * @brief Stop continuous DMA reception
+ * @details Reports any bytes still pending, then stops the DMA channel and
+ *          disables the RX DMA request and idle interrupt.
+ *
+ * @param[in] base  Pointer to UART peripheral base address
+ */
+void UART_StopCircularRxDMA(LPUART_RegType *base);
+
+/**
+ * @brief Report bytes received since the last notification
+ * @details Reads the DMA write position and calls the RX callback for the
+ *          new region, split in two when it wraps. Called internally from
+ *          the idle and DMA interrupts, can also be called from a periodic
+ *          task running at the same priority.
+ *
+ * @param[in] base  Pointer to UART peripheral base address
+ *
+ * @return Number of new bytes reported
+ */
+uint32_t UART_PollCircularRxDMA(LPUART_RegType *base);
+#endif
+
+/*******************************************************************************
+ * Function Prototypes - Handle-Based API
+ ******************************************************************************/
+
+/**
+ * @brief Initialize UART and fill a handle for the hot-path calls
+ * @details Runs UART_Init() and caches the instance number, ring buffer
+ *          state and source clock. No DMA channel is bound until
+ *          UART_HandleConfigDMA().
+ * 
+ * @param[out] handle    Handle to fill (cleared on failure)
+ * @param[in]  base      LPUART0, LPUART1 or LPUART2
+ * @param[in]  config    Pointer to configuration structure
+ * @param[in]  srcClock  Source clock frequency in Hz (0 = auto-detect)
+ * 
+ * @return UART_STATUS_SUCCESS if successful, otherwise the UART_Init() error
+ * 
+ * @note The base-pointer API stays usable on the same instance; both share
+ *       the rings, callbacks and OSAL locks.
+ * @note srcClock is a snapshot: after ClockManager_Update() the baud divisor
+ *       is recomputed by the driver, the cached value is not.
+ * 
+ * @code
+ * static uart_handle_t s_console;
+ * 
+ * UART_GetDefaultConfig(&config);
+ * UART_HandleInit(&s_console, LPUART1, &config, 0U);
+ * UART_EnableAsync(LPUART1);
+ * NVIC_EnableIRQ(LPUART1_RxTx_IRQn);
+ * 
+ * void LPUART1_RxTx_IRQHandler(void) {
+ *     UART_HandleIRQHandler(&s_console);
+ * }
+ * 
+ * UART_HandleWriteAsync(&s_console, msg, len, NULL);
+ * @endcode
+ */
+UART_Status_t UART_HandleInit(uart_handle_t *handle, LPUART_RegType *base,
+                              const UART_Config_t *config, uint32_t srcClock);
+
+/**
+ * @brief Send data in blocking mode (see UART_SendBlocking())
+ * 
+ * @param[in] handle  Initialized handle
+ * @param[in] txBuff  Pointer to transmit buffer
+ * @param[in] txSize  Number of bytes to send
+ * 
+ * @return UART_STATUS_SUCCESS if successful
+ */
+UART_Status_t UART_HandleSendBlocking(const uart_handle_t *handle, const uint8_t *txBuff, uint32_t txSize);
+
+/**
+ * @brief Receive data in blocking mode (see UART_ReceiveBlocking())
+ * 
+ * @param[in]  handle  Initialized handle
+ * @param[out] rxBuff  Pointer to receive buffer
+ * @param[in]  rxSize  Number of bytes to receive
+ * 
+ * @return UART_STATUS_SUCCESS if successful, error code otherwise
+ */
+UART_Status_t UART_HandleReceiveBlocking(const uart_handle_t *handle, uint8_t *rxBuff, uint32_t rxSize);
+
+/**
+ * @brief Queue data for interrupt-driven transmission (see UART_WriteAsync())
+ * 
+ * @param[in]  handle   Initialized handle
+ * @param[in]  txBuff   Pointer to transmit data
+ * @param[in]  txSize   Number of bytes to queue
+ * @param[out] written  Number of bytes actually queued (may be NULL)
+ * 
+ * @return UART_STATUS_SUCCESS if all bytes were queued, UART_STATUS_BUSY if
+ *         the ring was full, UART_STATUS_ERROR if async mode is not enabled
+ */
+UART_Status_t UART_HandleWriteAsync(const uart_handle_t *handle, const uint8_t *txBuff,
+                                    uint32_t txSize, uint32_t *written);
+
+/**
+ * @brief Get number of received bytes waiting in the RX ring
+ * 
+ * @param[in] handle  Initialized handle
+ * 
+ * @return Bytes available, 0 if async mode is not enabled
+ */
+uint32_t UART_HandleReadAvailable(const uart_handle_t *handle);
+
+/**
+ * @brief Read received bytes from the RX ring (see UART_ReadAsync())
+ * 
+ * @param[in]  handle  Initialized handle
+ * @param[out] rxBuff  Destination buffer
+ * @param[in]  rxSize  Maximum number of bytes to read
+ * 
+ * @return Number of bytes copied
+ */
+uint32_t UART_HandleReadAsync(const uart_handle_t *handle, uint8_t *rxBuff, uint32_t rxSize);
+
+/**
+ * @brief Handle LPUART interrupt for ring buffer transfer (called from ISR)
+ * @details Same work as UART_IRQHandler() without the base-to-instance lookup.
+ * 
+ * @param[in] handle  Handle filled by a successful UART_HandleInit()
+ * 
+ * @note The handle is not validated here, pass only initialized handles.
+ */
+void UART_HandleIRQHandler(const uart_handle_t *handle);
+
+#if UART_DMA_ENABLE
+/**
+ * @brief Bind TX / RX DMA channels to a handle
+ * @details Enables the LPUART DMA requests (UART_ConfigTxDMA() /
+ *          UART_ConfigRxDMA()) and caches the DMAMUX sources.
+ * 
+ * @param[in,out] handle        Initialized handle
+ * @param[in]     txDmaChannel  TX DMA channel (0-15) or UART_HANDLE_NO_DMA
+ * @param[in]     rxDmaChannel  RX DMA channel (0-15) or UART_HANDLE_NO_DMA
+ * 
+ * @return UART_STATUS_SUCCESS if successful
+ */
+UART_Status_t UART_HandleConfigDMA(uart_handle_t *handle, uint8_t txDmaChannel, uint8_t rxDmaChannel);
+
+/**
+ * @brief Send data on the TX DMA channel of a handle (see UART_SendDMA())
+ * 
+ * @param[in] handle  Handle with a TX DMA channel bound
+ * @param[in] txBuff  Pointer to transmit buffer
+ * @param[in] txSize  Number of bytes to send
+ * 
+ * @return UART_STATUS_SUCCESS if transfer started successfully
+ */
+UART_Status_t UART_HandleSendDMA(const uart_handle_t *handle, const uint8_t *txBuff, uint32_t txSize);
+
+/**
+ * @brief Receive data on the RX DMA channel of a handle (see UART_ReceiveDMA())
+ * 
+ * @param[in]  handle  Handle with an RX DMA channel bound
+ * @param[out] rxBuff  Pointer to receive buffer
+ * @param[in]  rxSize  Number of bytes to receive
+ * 
+ * @return UART_STATUS_SUCCESS if transfer started successfully
+ */
+UART_Status_t UART_HandleReceiveDMA(const uart_handle_t *handle, uint8_t *rxBuff, uint32_t rxSize);
 #endif
+
 /*******************************************************************************
  * Interrupt Masks
  ******************************************************************************/
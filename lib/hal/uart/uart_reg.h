@@ -111,6 +111,36 @@ typedef struct {
 #define LPUART_BAUD_RXEDGIE_WIDTH       (1U)
 #define LPUART_BAUD_RXEDGIE(x)          (((uint32_t)(x) << LPUART_BAUD_RXEDGIE_SHIFT) & LPUART_BAUD_RXEDGIE_MASK)
 
+/* LIN Break Detect Interrupt Enable (LBKDIE) */
+#define LPUART_BAUD_LBKDIE_SHIFT        (15U)
+#define LPUART_BAUD_LBKDIE_MASK         (0x00008000UL)
+#define LPUART_BAUD_LBKDIE_WIDTH        (1U)
+#define LPUART_BAUD_LBKDIE(x)           (((uint32_t)(x) << LPUART_BAUD_LBKDIE_SHIFT) & LPUART_BAUD_LBKDIE_MASK)
+
+/* Resynchronization Disable (RESYNCDIS) */
+#define LPUART_BAUD_RESYNCDIS_SHIFT     (16U)
+#define LPUART_BAUD_RESYNCDIS_MASK      (0x00010000UL)
+#define LPUART_BAUD_RESYNCDIS_WIDTH     (1U)
+#define LPUART_BAUD_RESYNCDIS(x)        (((uint32_t)(x) << LPUART_BAUD_RESYNCDIS_SHIFT) & LPUART_BAUD_RESYNCDIS_MASK)
+
+/* Both Edge Sampling (BOTHEDGE) */
+#define LPUART_BAUD_BOTHEDGE_SHIFT      (17U)
+#define LPUART_BAUD_BOTHEDGE_MASK       (0x00020000UL)
+#define LPUART_BAUD_BOTHEDGE_WIDTH      (1U)
+#define LPUART_BAUD_BOTHEDGE(x)         (((uint32_t)(x) << LPUART_BAUD_BOTHEDGE_SHIFT) & LPUART_BAUD_BOTHEDGE_MASK)
+
+/* Receiver Full DMA Enable (RDMAE) */
+#define LPUART_BAUD_RDMAE_SHIFT         (21U)
+#define LPUART_BAUD_RDMAE_MASK          (0x00200000UL)
+#define LPUART_BAUD_RDMAE_WIDTH         (1U)
+#define LPUART_BAUD_RDMAE(x)            (((uint32_t)(x) << LPUART_BAUD_RDMAE_SHIFT) & LPUART_BAUD_RDMAE_MASK)
+
+/* Transmitter DMA Enable (TDMAE) */
+#define LPUART_BAUD_TDMAE_SHIFT         (23U)
+#define LPUART_BAUD_TDMAE_MASK          (0x00800000UL)
+#define LPUART_BAUD_TDMAE_WIDTH         (1U)
+#define LPUART_BAUD_TDMAE(x)            (((uint32_t)(x) << LPUART_BAUD_TDMAE_SHIFT) & LPUART_BAUD_TDMAE_MASK)
+
 /* Over Sampling Ratio (OSR) */
 #define LPUART_BAUD_OSR_SHIFT           (24U)
 #define LPUART_BAUD_OSR_MASK            (0x1F000000UL)
@@ -123,6 +153,18 @@ typedef struct {
 #define LPUART_BAUD_M10_WIDTH           (1U)
 #define LPUART_BAUD_M10(x)              (((uint32_t)(x) << LPUART_BAUD_M10_SHIFT) & LPUART_BAUD_M10_MASK)
 
+/* Match Address Mode Enable 2 (MAEN2) */
+#define LPUART_BAUD_MAEN2_SHIFT         (30U)
+#define LPUART_BAUD_MAEN2_MASK          (0x40000000UL)
+#define LPUART_BAUD_MAEN2_WIDTH         (1U)
+#define LPUART_BAUD_MAEN2(x)            (((uint32_t)(x) << LPUART_BAUD_MAEN2_SHIFT) & LPUART_BAUD_MAEN2_MASK)
+
+/* Match Address Mode Enable 1 (MAEN1) */
+#define LPUART_BAUD_MAEN1_SHIFT         (31U)
+#define LPUART_BAUD_MAEN1_MASK          (0x80000000UL)
+#define LPUART_BAUD_MAEN1_WIDTH         (1U)
+#define LPUART_BAUD_MAEN1(x)            (((uint32_t)(x) << LPUART_BAUD_MAEN1_SHIFT) & LPUART_BAUD_MAEN1_MASK)
+
 /*******************************************************************************
  * LPUART Status Register (STAT) Bit Definitions
  ******************************************************************************/
@@ -182,6 +224,26 @@ typedef struct {
 #define LPUART_STAT_RAF_MASK            (0x01000000UL)
 #define LPUART_STAT_RAF_WIDTH           (1U)
 
+/* LIN Break Detection Enable (LBKDE) */
+#define LPUART_STAT_LBKDE_SHIFT         (25U)
+#define LPUART_STAT_LBKDE_MASK          (0x02000000UL)
+#define LPUART_STAT_LBKDE_WIDTH         (1U)
+
+/* Break Character Generation Length (BRK13): 1 = 13 bit times */
+#define LPUART_STAT_BRK13_SHIFT         (26U)
+#define LPUART_STAT_BRK13_MASK          (0x04000000UL)
+#define LPUART_STAT_BRK13_WIDTH         (1U)
+
+/* LPUART_RX Pin Active Edge Interrupt Flag (RXEDGIF) */
+#define LPUART_STAT_RXEDGIF_SHIFT       (30U)
+#define LPUART_STAT_RXEDGIF_MASK        (0x40000000UL)
+#define LPUART_STAT_RXEDGIF_WIDTH       (1U)
+
+/* LIN Break Detect Interrupt Flag (LBKDIF) */
+#define LPUART_STAT_LBKDIF_SHIFT        (31U)
+#define LPUART_STAT_LBKDIF_MASK         (0x80000000UL)
+#define LPUART_STAT_LBKDIF_WIDTH        (1U)
+
 /*******************************************************************************
  * LPUART Control Register (CTRL) Bit Definitions
  ******************************************************************************/
@@ -357,6 +419,132 @@ typedef struct {
 #define LPUART_DATA_RT_MASK             (0x000003FFUL)
 #define LPUART_DATA_RT_WIDTH            (10U)
 
+/*******************************************************************************
+ * LPUART Match Address Register (MATCH) Bit Definitions
+ ******************************************************************************/
+
+/* Match Address 1 (MA1) */
+#define LPUART_MATCH_MA1_SHIFT          (0U)
+#define LPUART_MATCH_MA1_MASK           (0x000003FFUL)
+#define LPUART_MATCH_MA1_WIDTH          (10U)
+#define LPUART_MATCH_MA1(x)             (((uint32_t)(x) << LPUART_MATCH_MA1_SHIFT) & LPUART_MATCH_MA1_MASK)
+
+/* Match Address 2 (MA2) */
+#define LPUART_MATCH_MA2_SHIFT          (16U)
+#define LPUART_MATCH_MA2_MASK           (0x03FF0000UL)
+#define LPUART_MATCH_MA2_WIDTH          (10U)
+#define LPUART_MATCH_MA2(x)             (((uint32_t)(x) << LPUART_MATCH_MA2_SHIFT) & LPUART_MATCH_MA2_MASK)
+
+/*******************************************************************************
+ * LPUART FIFO Register (FIFO) Bit Definitions
+ ******************************************************************************/
+
+/* Receive FIFO Buffer Depth (RXFIFOSIZE, read-only) */
+#define LPUART_FIFO_RXFIFOSIZE_SHIFT    (0U)
+#define LPUART_FIFO_RXFIFOSIZE_MASK     (0x00000007UL)
+#define LPUART_FIFO_RXFIFOSIZE_WIDTH    (3U)
+#define LPUART_FIFO_RXFIFOSIZE(x)       (((uint32_t)(x) << LPUART_FIFO_RXFIFOSIZE_SHIFT) & LPUART_FIFO_RXFIFOSIZE_MASK)
+
+/* Receive FIFO Enable (RXFE) */
+#define LPUART_FIFO_RXFE_SHIFT          (3U)
+#define LPUART_FIFO_RXFE_MASK           (0x00000008UL)
+#define LPUART_FIFO_RXFE_WIDTH          (1U)
+#define LPUART_FIFO_RXFE(x)             (((uint32_t)(x) << LPUART_FIFO_RXFE_SHIFT) & LPUART_FIFO_RXFE_MASK)
+
+/* Transmit FIFO Buffer Depth (TXFIFOSIZE, read-only) */
+#define LPUART_FIFO_TXFIFOSIZE_SHIFT    (4U)
+#define LPUART_FIFO_TXFIFOSIZE_MASK     (0x00000070UL)
+#define LPUART_FIFO_TXFIFOSIZE_WIDTH    (3U)
+#define LPUART_FIFO_TXFIFOSIZE(x)       (((uint32_t)(x) << LPUART_FIFO_TXFIFOSIZE_SHIFT) & LPUART_FIFO_TXFIFOSIZE_MASK)
+
+/* Transmit FIFO Enable (TXFE) */
+#define LPUART_FIFO_TXFE_SHIFT          (7U)
+#define LPUART_FIFO_TXFE_MASK           (0x00000080UL)
+#define LPUART_FIFO_TXFE_WIDTH          (1U)
+#define LPUART_FIFO_TXFE(x)             (((uint32_t)(x) << LPUART_FIFO_TXFE_SHIFT) & LPUART_FIFO_TXFE_MASK)
+
+/* Receive FIFO Underflow Interrupt Enable (RXUFE) */
+#define LPUART_FIFO_RXUFE_SHIFT         (8U)
+#define LPUART_FIFO_RXUFE_MASK          (0x00000100UL)
+#define LPUART_FIFO_RXUFE_WIDTH         (1U)
+#define LPUART_FIFO_RXUFE(x)            (((uint32_t)(x) << LPUART_FIFO_RXUFE_SHIFT) & LPUART_FIFO_RXUFE_MASK)
+
+/* Transmit FIFO Overflow Interrupt Enable (TXOFE) */
+#define LPUART_FIFO_TXOFE_SHIFT         (9U)
+#define LPUART_FIFO_TXOFE_MASK          (0x00000200UL)
+#define LPUART_FIFO_TXOFE_WIDTH         (1U)
+#define LPUART_FIFO_TXOFE(x)            (((uint32_t)(x) << LPUART_FIFO_TXOFE_SHIFT) & LPUART_FIFO_TXOFE_MASK)
+
+/* Receiver Idle Empty Enable (RXIDEN) */
+#define LPUART_FIFO_RXIDEN_SHIFT        (10U)
+#define LPUART_FIFO_RXIDEN_MASK         (0x00001C00UL)
+#define LPUART_FIFO_RXIDEN_WIDTH        (3U)
+#define LPUART_FIFO_RXIDEN(x)           (((uint32_t)(x) << LPUART_FIFO_RXIDEN_SHIFT) & LPUART_FIFO_RXIDEN_MASK)
+
+/* Receive FIFO Flush (RXFLUSH, write-only) */
+#define LPUART_FIFO_RXFLUSH_SHIFT       (14U)
+#define LPUART_FIFO_RXFLUSH_MASK        (0x00004000UL)
+#define LPUART_FIFO_RXFLUSH_WIDTH       (1U)
+#define LPUART_FIFO_RXFLUSH(x)          (((uint32_t)(x) << LPUART_FIFO_RXFLUSH_SHIFT) & LPUART_FIFO_RXFLUSH_MASK)
+
+/* Transmit FIFO Flush (TXFLUSH, write-only) */
+#define LPUART_FIFO_TXFLUSH_SHIFT       (15U)
+#define LPUART_FIFO_TXFLUSH_MASK        (0x00008000UL)
+#define LPUART_FIFO_TXFLUSH_WIDTH       (1U)
+#define LPUART_FIFO_TXFLUSH(x)          (((uint32_t)(x) << LPUART_FIFO_TXFLUSH_SHIFT) & LPUART_FIFO_TXFLUSH_MASK)
+
+/* Receiver Buffer Underflow Flag (RXUF, w1c) */
+#define LPUART_FIFO_RXUF_SHIFT          (16U)
+#define LPUART_FIFO_RXUF_MASK           (0x00010000UL)
+#define LPUART_FIFO_RXUF_WIDTH          (1U)
+#define LPUART_FIFO_RXUF(x)             (((uint32_t)(x) << LPUART_FIFO_RXUF_SHIFT) & LPUART_FIFO_RXUF_MASK)
+
+/* Transmitter Buffer Overflow Flag (TXOF, w1c) */
+#define LPUART_FIFO_TXOF_SHIFT          (17U)
+#define LPUART_FIFO_TXOF_MASK           (0x00020000UL)
+#define LPUART_FIFO_TXOF_WIDTH          (1U)
+#define LPUART_FIFO_TXOF(x)             (((uint32_t)(x) << LPUART_FIFO_TXOF_SHIFT) & LPUART_FIFO_TXOF_MASK)
+
+/* Receive Buffer/FIFO Empty (RXEMPT) */
+#define LPUART_FIFO_RXEMPT_SHIFT        (22U)
+#define LPUART_FIFO_RXEMPT_MASK         (0x00400000UL)
+#define LPUART_FIFO_RXEMPT_WIDTH        (1U)
+#define LPUART_FIFO_RXEMPT(x)           (((uint32_t)(x) << LPUART_FIFO_RXEMPT_SHIFT) & LPUART_FIFO_RXEMPT_MASK)
+
+/* Transmit Buffer/FIFO Empty (TXEMPT) */
+#define LPUART_FIFO_TXEMPT_SHIFT        (23U)
+#define LPUART_FIFO_TXEMPT_MASK         (0x00800000UL)
+#define LPUART_FIFO_TXEMPT_WIDTH        (1U)
+#define LPUART_FIFO_TXEMPT(x)           (((uint32_t)(x) << LPUART_FIFO_TXEMPT_SHIFT) & LPUART_FIFO_TXEMPT_MASK)
+
+/*******************************************************************************
+ * LPUART Watermark Register (WATER) Bit Definitions
+ ******************************************************************************/
+
+/* Transmit Watermark (TXWATER) */
+#define LPUART_WATER_TXWATER_SHIFT      (0U)
+#define LPUART_WATER_TXWATER_MASK       (0x00000003UL)
+#define LPUART_WATER_TXWATER_WIDTH      (2U)
+#define LPUART_WATER_TXWATER(x)         (((uint32_t)(x) << LPUART_WATER_TXWATER_SHIFT) & LPUART_WATER_TXWATER_MASK)
+
+/* Transmit Counter (TXCOUNT, read-only) */
+#define LPUART_WATER_TXCOUNT_SHIFT      (8U)
+#define LPUART_WATER_TXCOUNT_MASK       (0x00000700UL)
+#define LPUART_WATER_TXCOUNT_WIDTH      (3U)
+#define LPUART_WATER_TXCOUNT(x)         (((uint32_t)(x) << LPUART_WATER_TXCOUNT_SHIFT) & LPUART_WATER_TXCOUNT_MASK)
+
+/* Receive Watermark (RXWATER) */
+#define LPUART_WATER_RXWATER_SHIFT      (16U)
+#define LPUART_WATER_RXWATER_MASK       (0x00030000UL)
+#define LPUART_WATER_RXWATER_WIDTH      (2U)
+#define LPUART_WATER_RXWATER(x)         (((uint32_t)(x) << LPUART_WATER_RXWATER_SHIFT) & LPUART_WATER_RXWATER_MASK)
+
+/* Receive Counter (RXCOUNT, read-only) */
+#define LPUART_WATER_RXCOUNT_SHIFT      (24U)
+#define LPUART_WATER_RXCOUNT_MASK       (0x07000000UL)
+#define LPUART_WATER_RXCOUNT_WIDTH      (3U)
+#define LPUART_WATER_RXCOUNT(x)         (((uint32_t)(x) << LPUART_WATER_RXCOUNT_SHIFT) & LPUART_WATER_RXCOUNT_MASK)
+
 /*******************************************************************************
  * LPUART Helper Macros
  ******************************************************************************/
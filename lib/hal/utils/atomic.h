@@ -0,0 +1,145 @@
+/**
+ * @file    atomic.h
+ * @brief   Lock-free atomic primitives for Cortex-M4 (LDREX / STREX)
+ * @details
+ * Thin inline wrappers around the ARMv7-M exclusive access instructions,
+ * used to update shared words from thread and interrupt context without
+ * masking interrupts.
+ *
+ * On a single-core Cortex-M4 every exception entry / return clears the local
+ * exclusive monitor, so a STREX fails whenever an interrupt ran between the
+ * LDREX and the STREX. Retry loops built on these primitives are therefore
+ * free of the ABA problem for data shared with ISRs.
+ *
+ * @code
+ * static volatile uint32_t s_count;
+ * (void)ATOMIC_Add(&s_count, 1);   // safe from any priority
+ * @endcode
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ *
+ * @note Exclusive accesses must target normal memory (SRAM), not peripherals
+ */
+
+#ifndef ATOMIC_H
+#define ATOMIC_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "hal_config.h"
+
+/*******************************************************************************
+ * API Functions
+ ******************************************************************************/
+
+#if (HAL_HOST_BUILD == 1U)
+/* Host build (tools/host_bench): single thread, no interrupts, plain accesses are atomic */
+static inline void ATOMIC_Barrier(void)
+{
+    __sync_synchronize();
+}
+
+static inline uint32_t ATOMIC_LoadExclusive(volatile uint32_t *addr)
+{
+    return *addr;
+}
+
+static inline uint32_t ATOMIC_StoreExclusive(volatile uint32_t *addr, uint32_t value)
+{
+    *addr = value;
+
+    return 0U;
+}
+
+static inline void ATOMIC_ClearExclusive(void)
+{
+}
+#else
+/**
+ * @brief Data memory barrier
+ */
+static inline void ATOMIC_Barrier(void)
+{
+    __asm volatile ("dmb" : : : "memory");
+}
+
+/**
+ * @brief Load a word and tag it for exclusive access (LDREX)
+ * @param[in] addr Word address
+ * @return uint32_t Current value
+ */
+static inline uint32_t ATOMIC_LoadExclusive(volatile uint32_t *addr)
+{
+    uint32_t value;
+
+    __asm volatile ("ldrex %0, %1" : "=r" (value) : "Q" (*addr) : "memory");
+
+    return value;
+}
+
+/**
+ * @brief Store a word if the exclusive tag is still held (STREX)
+ * @param[in] addr  Word address (same as the preceding LDREX)
+ * @param[in] value Value to store
+ * @return uint32_t 0 on success, 1 if the store was not performed
+ */
+static inline uint32_t ATOMIC_StoreExclusive(volatile uint32_t *addr, uint32_t value)
+{
+    uint32_t result;
+
+    __asm volatile ("strex %0, %2, %1" : "=&r" (result), "=Q" (*addr) : "r" (value) : "memory");
+
+    return result;
+}
+
+/**
+ * @brief Drop the exclusive tag (CLREX) when a retry loop exits without STREX
+ */
+static inline void ATOMIC_ClearExclusive(void)
+{
+    __asm volatile ("clrex" : : : "memory");
+}
+#endif /* HAL_HOST_BUILD */
+
+/**
+ * @brief Atomically add a signed delta to a word
+ * @param[in] addr  Word address
+ * @param[in] delta Value to add
+ * @return uint32_t Value after the addition
+ */
+static inline uint32_t ATOMIC_Add(volatile uint32_t *addr, int32_t delta)
+{
+    uint32_t value;
+
+    do {
+        value = ATOMIC_LoadExclusive(addr) + (uint32_t)delta;
+    } while (ATOMIC_StoreExclusive(addr, value) != 0U);
+
+    return value;
+}
+
+/**
+ * @brief Atomically replace a word if it holds the expected value
+ * @param[in] addr     Word address
+ * @param[in] expected Value the word must hold
+ * @param[in] desired  New value
+ * @return bool true if the word was replaced
+ */
+static inline bool ATOMIC_CompareExchange(volatile uint32_t *addr, uint32_t expected, uint32_t desired)
+{
+    do {
+        if (ATOMIC_LoadExclusive(addr) != expected) {
+            ATOMIC_ClearExclusive();
+            return false;
+        }
+    } while (ATOMIC_StoreExclusive(addr, desired) != 0U);
+
+    return true;
+}
+
+#endif /* ATOMIC_H */
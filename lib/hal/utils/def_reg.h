@@ -11,6 +11,7 @@
  * - 32-bit register access macros (REG_READ32, REG_WRITE32, REG_BIT_SET32,
  *   REG_BIT_CLEAR32, REG_RMW32)
  * - Interrupt vector numbers (IRQn_Type) for S32K144
+ * - HAL_RAMFUNC placement attribute for RAM-resident ISRs and callees
  *
  * @author  PhucPH32
  * @date    23/11/2025
@@ -24,6 +25,8 @@
  *
  * @par     Change Log:
  * - v1.0 (2025-11-23) : Added Doxygen header and clarifying notes.
+ * - v1.1 (2026-10-14) : Added HAL_RAMFUNC.
+ * - v1.2 (2026-10-14) : Include hal_config.h (driver feature selection).
  */
 
 #ifndef DEF_REG_H
@@ -33,6 +36,7 @@
  * Includes
  ******************************************************************************/
 #include <stdint.h>
+#include "hal_config.h"
 
 /*******************************************************************************
  * Generic macros
@@ -93,6 +97,83 @@
 
 #define NULL (void*)0
 
+/**
+ * @brief Run HAL_RAMFUNC functions from SRAM (0 = leave everything in flash)
+ */
+#ifndef HAL_RAMFUNC_ENABLE
+#define HAL_RAMFUNC_ENABLE      (1U)
+#endif
+
+/**
+ * @brief Place a function in the .code_ram section
+ * @details startup.c copies .code_ram from flash (__CODE_ROM) to SRAM_L
+ *          (__CODE_RAM) before main(). SRAM_L sits on the code bus, so the
+ *          function is fetched with zero wait states and never misses in
+ *          the LMEM cache. Put it on the prototype (and on the definition
+ *          of handlers without one). noinline keeps the body out of flash
+ *          callers. Calls between flash and SRAM are beyond BL range; the
+ *          GNU linker inserts long-branch veneers automatically.
+ *
+ * @code
+ * HAL_RAMFUNC void DMA_IRQHandler(uint8_t channel);
+ * @endcode
+ *
+ * @note Map report: python3 tools/ramfunc_report.py build/app.map
+ */
+#if (HAL_RAMFUNC_ENABLE == 1U) && (defined(__GNUC__) || defined(__ARMCC_VERSION))
+  #define HAL_RAMFUNC           __attribute__((section(".code_ram"), noinline))
+#elif (HAL_RAMFUNC_ENABLE == 1U) && defined(__ICCARM__)
+  #define HAL_RAMFUNC           __ramfunc
+#else
+  #define HAL_RAMFUNC
+#endif
+
+/**
+ * @brief Place bank-tagged buffers in SRAM_L / SRAM_U (0 = default .bss)
+ */
+#ifndef HAL_SRAM_BANK_PLACEMENT
+#define HAL_SRAM_BANK_PLACEMENT (1U)
+#endif
+
+/**
+ * @brief Bank placement of zero-initialized objects
+ * @details DMA_BUFFER_SRAM_U (SRAM_U, 0x20000000, system bus) is for memory
+ *          read or written by eDMA: buffers, TCD pools. FAST_DATA_SRAM_L
+ *          (SRAM_L, 0x1FFF8000, code bus) is for data the CPU works on at
+ *          high rate while DMA runs: ISR rings, message queues. Keeping the
+ *          two apart means DMA bursts never wait on the bank the CPU is
+ *          hammering, and the other way round. Never point DMA at
+ *          FAST_DATA_SRAM_L objects.
+ *
+ * @code
+ * static uint16_t s_frames[32] DMA_BUFFER_SRAM_U;
+ * static DMA_TCD_Type s_tcd[2] DMA_TCD_ALIGN DMA_BUFFER_SRAM_U;
+ * @endcode
+ *
+ * @note Only for zero-initialized objects. The sections are named
+ *       .bss.sram_u / .bss.sram_l, so a linker script without the output
+ *       sections below still collects them into .bss (no placement, same
+ *       behaviour). For placement add, before .bss (GNU ld, S32K144 SDK
+ *       memory regions m_data = SRAM_L, m_data_2 = SRAM_U):
+ * @code
+ * .bss_sram_l (NOLOAD) : ALIGN(4) {
+ *     __BSS_SRAM_L_START = .;  *(.bss.sram_l*)  . = ALIGN(4);  __BSS_SRAM_L_END = .;
+ * } > m_data
+ * .bss_sram_u (NOLOAD) : ALIGN(4) {
+ *     __BSS_SRAM_U_START = .;  *(.bss.sram_u*)  . = ALIGN(4);  __BSS_SRAM_U_END = .;
+ * } > m_data_2
+ * @endcode
+ *       init_data_bss() clears both ranges. Moving the main stack to the
+ *       top of m_data (__StackTop) keeps push / pop off the DMA bank too.
+ */
+#if (HAL_SRAM_BANK_PLACEMENT == 1U) && (defined(__GNUC__) || defined(__ARMCC_VERSION))
+  #define DMA_BUFFER_SRAM_U     __attribute__((section(".bss.sram_u")))
+  #define FAST_DATA_SRAM_L      __attribute__((section(".bss.sram_l")))
+#else
+  #define DMA_BUFFER_SRAM_U
+  #define FAST_DATA_SRAM_L
+#endif
+
 /*!
  * @}
  */ /* end of group Interrupt_vector_numbers_S32K144 */
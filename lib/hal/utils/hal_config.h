@@ -0,0 +1,130 @@
+/**
+ * @file    hal_config.h
+ * @brief   Central compile-time feature selection for the HAL drivers
+ * @details
+ * One place to size the static driver tables to the instances / channels an
+ * application really uses and to drop argument validation from release
+ * builds. Every option has a default that keeps the full-featured build, so
+ * nothing changes until a value is overridden (compiler -D or editing the
+ * defaults below).
+ *
+ * Included through def_reg.h, so every driver sees the same values.
+ *
+ * @code
+ * // Release build of a node with LPUART1, CAN0 and DMA channels 0-9:
+ * //   -DHAL_PARAM_CHECK_ENABLE=0U
+ * //   -DHAL_LPUART0_ENABLE=0U -DHAL_LPUART2_ENABLE=0U
+ * //   -DHAL_CAN1_ENABLE=0U -DHAL_CAN2_ENABLE=0U
+ * //   -DHAL_DMA_CHANNEL_COUNT=10U
+ * @endcode
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+#ifndef HAL_CONFIG_H
+#define HAL_CONFIG_H
+
+/*******************************************************************************
+ * Argument Validation
+ ******************************************************************************/
+
+/**
+ * @brief Compile argument checks of the hot-path functions (0 = release build)
+ * @details With 0 the NULL pointer / index range checks wrapped in
+ *          HAL_PARAM_INVALID() fold to false and are removed by the compiler.
+ *          Checks of runtime state (initialized, busy, mode) always stay.
+ */
+#ifndef HAL_PARAM_CHECK_ENABLE
+#define HAL_PARAM_CHECK_ENABLE      (1U)
+#endif
+
+/**
+ * @brief Argument check that disappears with HAL_PARAM_CHECK_ENABLE = 0
+ *
+ * @code
+ * if (HAL_PARAM_INVALID((message == NULL) || (mbIndex >= count))) {
+ *     return STATUS_INVALID_PARAM;
+ * }
+ * @endcode
+ *
+ * @note The condition is not evaluated when checks are off, it must have no
+ *       side effects.
+ */
+#if (HAL_PARAM_CHECK_ENABLE == 1U)
+#define HAL_PARAM_INVALID(cond)     (cond)
+#else
+#define HAL_PARAM_INVALID(cond)     (0)
+#endif
+
+/*******************************************************************************
+ * Instance / Channel Selection
+ ******************************************************************************/
+
+/**
+ * @brief LPUART instances with driver state (0 = registers only)
+ * @details A disabled instance gets no ring buffers, callbacks or DMA state;
+ *          the base-pointer functions reject it. UART_EnableClock() and the
+ *          other instance-number functions still work.
+ */
+#ifndef HAL_LPUART0_ENABLE
+#define HAL_LPUART0_ENABLE          (1U)
+#endif
+#ifndef HAL_LPUART1_ENABLE
+#define HAL_LPUART1_ENABLE          (1U)
+#endif
+#ifndef HAL_LPUART2_ENABLE
+#define HAL_LPUART2_ENABLE          (1U)
+#endif
+
+/**
+ * @brief FlexCAN instances with MB callback storage (0 = CAN_Init() rejects it)
+ */
+#ifndef HAL_CAN0_ENABLE
+#define HAL_CAN0_ENABLE             (1U)
+#endif
+#ifndef HAL_CAN1_ENABLE
+#define HAL_CAN1_ENABLE             (1U)
+#endif
+#ifndef HAL_CAN2_ENABLE
+#define HAL_CAN2_ENABLE             (1U)
+#endif
+
+/**
+ * @brief eDMA channels managed by the DMA driver: channels 0 to n-1 (1-16)
+ * @note The allocator classes (DMA_HIGH_CLASS_CHANNELS / DMA_LOW_CLASS_CHANNELS)
+ *       are carved from this range and must leave room for each other.
+ */
+#ifndef HAL_DMA_CHANNEL_COUNT
+#define HAL_DMA_CHANNEL_COUNT       (16U)
+#endif
+
+/*******************************************************************************
+ * Host Build
+ ******************************************************************************/
+
+/**
+ * @brief Compile for the development PC instead of the Cortex-M4 (1 = host)
+ * @details Only for tools/host_bench: the inline-asm primitives (critical
+ *          section, exclusive access, barriers) get single-threaded host
+ *          equivalents so pure-logic paths build with the native gcc. Never
+ *          set it in a firmware build.
+ */
+#ifndef HAL_HOST_BUILD
+#define HAL_HOST_BUILD              (0U)
+#endif
+
+#if (HAL_LPUART0_ENABLE + HAL_LPUART1_ENABLE + HAL_LPUART2_ENABLE) == 0U
+#error "hal_config.h: enable at least one LPUART instance"
+#endif
+
+#if (HAL_CAN0_ENABLE + HAL_CAN1_ENABLE + HAL_CAN2_ENABLE) == 0U
+#error "hal_config.h: enable at least one CAN instance"
+#endif
+
+#if (HAL_DMA_CHANNEL_COUNT == 0U) || (HAL_DMA_CHANNEL_COUNT > 16U)
+#error "hal_config.h: HAL_DMA_CHANNEL_COUNT must be 1 to 16"
+#endif
+
+#endif /* HAL_CONFIG_H */
@@ -0,0 +1,203 @@
+/**
+ * @file    lfqueue.c
+ * @brief   Lock-free bounded queues implementation
+ * @details SPSC ring with publish barriers and bounded MPSC queue with
+ *          LDREX / STREX slot claiming and per-slot sequence numbers.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "lfqueue.h"
+#include "atomic.h"
+#include <stddef.h>
+#include <string.h>
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static inline bool LFQ_IsValidCapacity(uint32_t capacity)
+{
+    return (capacity != 0U) && ((capacity & (capacity - 1U)) == 0U);
+}
+
+/*******************************************************************************
+ * SPSC Functions
+ ******************************************************************************/
+
+bool LFQ_SpscInit(lfq_spsc_t *q, void *buffer, uint32_t elemSize, uint32_t capacity)
+{
+    if ((q == NULL) || (buffer == NULL) || (elemSize == 0U) || !LFQ_IsValidCapacity(capacity)) {
+        return false;
+    }
+
+    q->buffer = (uint8_t *)buffer;
+    q->elemSize = elemSize;
+    q->mask = capacity - 1U;
+    q->head = 0U;
+    q->tail = 0U;
+
+    return true;
+}
+
+void *LFQ_SpscReserveWrite(lfq_spsc_t *q)
+{
+    uint32_t head = q->head;
+
+    if ((head - q->tail) > q->mask) {
+        return NULL;
+    }
+
+    return &q->buffer[(head & q->mask) * q->elemSize];
+}
+
+void LFQ_SpscCommitWrite(lfq_spsc_t *q)
+{
+    /* Slot data must be visible before the new head */
+    ATOMIC_Barrier();
+    q->head = q->head + 1U;
+}
+
+const void *LFQ_SpscPeekRead(const lfq_spsc_t *q)
+{
+    uint32_t tail = q->tail;
+
+    if (tail == q->head) {
+        return NULL;
+    }
+
+    /* Head read before the slot data */
+    ATOMIC_Barrier();
+
+    return &q->buffer[(tail & q->mask) * q->elemSize];
+}
+
+void LFQ_SpscCommitRead(lfq_spsc_t *q)
+{
+    /* Slot fully read before the producer may reuse it */
+    ATOMIC_Barrier();
+    q->tail = q->tail + 1U;
+}
+
+bool LFQ_SpscPush(lfq_spsc_t *q, const void *elem)
+{
+    void *slot = LFQ_SpscReserveWrite(q);
+
+    if (slot == NULL) {
+        return false;
+    }
+
+    memcpy(slot, elem, q->elemSize);
+    LFQ_SpscCommitWrite(q);
+
+    return true;
+}
+
+bool LFQ_SpscPop(lfq_spsc_t *q, void *elem)
+{
+    const void *slot = LFQ_SpscPeekRead(q);
+
+    if (slot == NULL) {
+        return false;
+    }
+
+    memcpy(elem, slot, q->elemSize);
+    LFQ_SpscCommitRead(q);
+
+    return true;
+}
+
+uint32_t LFQ_SpscCount(const lfq_spsc_t *q)
+{
+    return q->head - q->tail;
+}
+
+void LFQ_SpscReset(lfq_spsc_t *q)
+{
+    q->tail = q->head;
+}
+
+/*******************************************************************************
+ * MPSC Functions
+ ******************************************************************************/
+
+bool LFQ_MpscInit(lfq_mpsc_t *q, void *buffer, volatile uint32_t *seq,
+                  uint32_t elemSize, uint32_t capacity)
+{
+    uint32_t i;
+
+    if ((q == NULL) || (buffer == NULL) || (seq == NULL) || (elemSize == 0U) ||
+        !LFQ_IsValidCapacity(capacity)) {
+        return false;
+    }
+
+    q->buffer = (uint8_t *)buffer;
+    q->seq = seq;
+    q->elemSize = elemSize;
+    q->mask = capacity - 1U;
+    q->head = 0U;
+    q->tail = 0U;
+
+    /* seq == pos: slot free for claim pos, seq == pos + 1: published */
+    for (i = 0U; i < capacity; i++) {
+        seq[i] = i;
+    }
+    ATOMIC_Barrier();
+
+    return true;
+}
+
+bool LFQ_MpscPush(lfq_mpsc_t *q, const void *elem)
+{
+    uint32_t pos;
+    uint32_t slot;
+
+    do {
+        pos = ATOMIC_LoadExclusive(&q->head);
+        if (q->seq[pos & q->mask] != pos) {
+            /* Consumer has not released this slot yet */
+            ATOMIC_ClearExclusive();
+            return false;
+        }
+    } while (ATOMIC_StoreExclusive(&q->head, pos + 1U) != 0U);
+
+    slot = pos & q->mask;
+    memcpy(&q->buffer[slot * q->elemSize], elem, q->elemSize);
+
+    ATOMIC_Barrier();
+    q->seq[slot] = pos + 1U;
+
+    return true;
+}
+
+bool LFQ_MpscPop(lfq_mpsc_t *q, void *elem)
+{
+    uint32_t pos = q->tail;
+    uint32_t slot = pos & q->mask;
+
+    if (q->seq[slot] != (pos + 1U)) {
+        return false;
+    }
+
+    ATOMIC_Barrier();
+    memcpy(elem, &q->buffer[slot * q->elemSize], q->elemSize);
+    ATOMIC_Barrier();
+
+    /* Free for the producer that claims pos + capacity */
+    q->seq[slot] = pos + q->mask + 1U;
+    q->tail = pos + 1U;
+
+    return true;
+}
+
+bool LFQ_MpscIsEmpty(const lfq_mpsc_t *q)
+{
+    uint32_t pos = q->tail;
+
+    return (q->seq[pos & q->mask] != (pos + 1U));
+}
@@ -0,0 +1,162 @@
+/**
+ * @file    lfqueue.h
+ * @brief   Lock-free bounded queues for ISR-to-thread handoff
+ * @details
+ * Fixed-size element queues over caller-provided storage, usable between
+ * interrupt and thread context without NVIC_DisableGlobalIRQ():
+ *
+ * - SPSC ring: one producer, one consumer. Only plain loads / stores and a
+ *   barrier on publish, plus in-place reserve / commit so a producer can
+ *   fill a slot directly (e.g. read a CAN mailbox into it).
+ * - MPSC queue: any number of producers (ISRs of different priorities and
+ *   thread code), one consumer. Producers claim a slot with LDREX / STREX
+ *   and publish it through a per-slot sequence number, so a producer
+ *   preempted between claim and publish never exposes a half-written slot.
+ *
+ * Indices are free-running 32-bit counters, capacity must be a power of 2
+ * and every slot is usable.
+ *
+ * @code
+ * static can_srv_message_t s_rxStorage[16];
+ * static lfq_spsc_t s_rxQueue;
+ *
+ * LFQ_SpscInit(&s_rxQueue, s_rxStorage, sizeof(s_rxStorage[0]), 16U);
+ * // ISR
+ * (void)LFQ_SpscPush(&s_rxQueue, &msg);
+ * // main loop
+ * while (LFQ_SpscPop(&s_rxQueue, &msg)) { ... }
+ * @endcode
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+#ifndef LFQUEUE_H
+#define LFQUEUE_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @brief Single-producer / single-consumer ring
+ */
+typedef struct {
+    uint8_t *buffer;                /**< capacity * elemSize bytes */
+    uint32_t elemSize;              /**< Bytes per element */
+    uint32_t mask;                  /**< capacity - 1 */
+    volatile uint32_t head;         /**< Written by the producer only */
+    volatile uint32_t tail;         /**< Written by the consumer only */
+} lfq_spsc_t;
+
+/**
+ * @brief Multi-producer / single-consumer queue
+ */
+typedef struct {
+    uint8_t *buffer;                /**< capacity * elemSize bytes */
+    volatile uint32_t *seq;         /**< capacity sequence words */
+    uint32_t elemSize;              /**< Bytes per element */
+    uint32_t mask;                  /**< capacity - 1 */
+    volatile uint32_t head;         /**< Next slot to claim (LDREX / STREX) */
+    volatile uint32_t tail;         /**< Written by the consumer only */
+} lfq_mpsc_t;
+
+/*******************************************************************************
+ * SPSC API
+ ******************************************************************************/
+
+/**
+ * @brief Initialize an SPSC ring
+ * @param[in] q        Queue
+ * @param[in] buffer   Element storage (capacity * elemSize bytes)
+ * @param[in] elemSize Bytes per element
+ * @param[in] capacity Number of elements (power of 2)
+ * @return bool false on invalid parameters
+ */
+bool LFQ_SpscInit(lfq_spsc_t *q, void *buffer, uint32_t elemSize, uint32_t capacity);
+
+/**
+ * @brief Copy one element in (producer)
+ * @return bool false if the ring is full
+ */
+bool LFQ_SpscPush(lfq_spsc_t *q, const void *elem);
+
+/**
+ * @brief Copy one element out (consumer)
+ * @return bool false if the ring is empty
+ */
+bool LFQ_SpscPop(lfq_spsc_t *q, void *elem);
+
+/**
+ * @brief Get the next free slot for in-place filling (producer)
+ * @return void* Slot, NULL if the ring is full. Publish with LFQ_SpscCommitWrite().
+ */
+void *LFQ_SpscReserveWrite(lfq_spsc_t *q);
+
+/**
+ * @brief Publish the slot returned by LFQ_SpscReserveWrite() (producer)
+ */
+void LFQ_SpscCommitWrite(lfq_spsc_t *q);
+
+/**
+ * @brief Get the oldest element in place (consumer)
+ * @return const void* Element, NULL if the ring is empty. Release with LFQ_SpscCommitRead().
+ */
+const void *LFQ_SpscPeekRead(const lfq_spsc_t *q);
+
+/**
+ * @brief Release the element returned by LFQ_SpscPeekRead() (consumer)
+ */
+void LFQ_SpscCommitRead(lfq_spsc_t *q);
+
+/**
+ * @brief Number of queued elements (snapshot)
+ */
+uint32_t LFQ_SpscCount(const lfq_spsc_t *q);
+
+/**
+ * @brief Drop every element (consumer side, producer must be idle)
+ */
+void LFQ_SpscReset(lfq_spsc_t *q);
+
+/*******************************************************************************
+ * MPSC API
+ ******************************************************************************/
+
+/**
+ * @brief Initialize an MPSC queue
+ * @param[in] q        Queue
+ * @param[in] buffer   Element storage (capacity * elemSize bytes)
+ * @param[in] seq      Sequence storage (capacity words)
+ * @param[in] elemSize Bytes per element
+ * @param[in] capacity Number of elements (power of 2)
+ * @return bool false on invalid parameters
+ */
+bool LFQ_MpscInit(lfq_mpsc_t *q, void *buffer, volatile uint32_t *seq,
+                  uint32_t elemSize, uint32_t capacity);
+
+/**
+ * @brief Copy one element in (any context)
+ * @return bool false if the queue is full
+ */
+bool LFQ_MpscPush(lfq_mpsc_t *q, const void *elem);
+
+/**
+ * @brief Copy one element out (single consumer)
+ * @return bool false if empty or the oldest slot is still being written
+ */
+bool LFQ_MpscPop(lfq_mpsc_t *q, void *elem);
+
+/**
+ * @brief Check whether a published element is waiting (consumer)
+ */
+bool LFQ_MpscIsEmpty(const lfq_mpsc_t *q);
+
+#endif /* LFQUEUE_H */
@@ -0,0 +1,240 @@
+/**
+ * @file    wdog.c
+ * @brief   WDOG Driver Implementation for S32K144
+ * @details Implementation of the watchdog configuration sequence (unlock,
+ *          TOVAL / WIN / CS inside the 128 bus clock window), window check
+ *          and early interrupt.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "wdog.h"
+#include "scg.h"
+#include "nvic.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+
+/** @brief Early interrupt callback */
+static wdog_callback_t s_wdogCallback = NULL;
+static void *s_wdogUserData = NULL;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Counter clock frequency of a clock source (Hz), 0 if off
+ */
+static uint32_t WDOG_GetSourceFreq(wdog_clock_source_t source)
+{
+    scg_clock_frequencies_t freqs;
+
+    if (source == WDOG_CLK_SRC_LPO) {
+        return WDOG_LPO_FREQ;
+    }
+
+    if (!SCG_GetClockFrequencies(&freqs)) {
+        return 0U;
+    }
+
+    switch (source) {
+        case WDOG_CLK_SRC_BUS:
+            return freqs.busClk;
+        case WDOG_CLK_SRC_SOSC:
+            return freqs.soscClk;
+        default:
+            return freqs.sircClk;
+    }
+}
+
+/**
+ * @brief Convert microseconds to WDOG counts (0 if it overflows 32 bit)
+ */
+static uint32_t WDOG_UsToCounts(uint32_t freq, uint32_t us, uint32_t div)
+{
+    uint64_t counts = ((uint64_t)freq * us) / (1000000ULL * div);
+
+    return (counts > 0xFFFFFFFFULL) ? 0U : (uint32_t)counts;
+}
+
+/**
+ * @brief Unlock, write TOVAL / WIN / CS, wait for the reconfiguration
+ * @details Interrupts masked (PRIMASK): an ISR between the unlock and the CS write
+ *          would exceed 128 bus clocks and the WDOG would reset the MCU.
+ */
+static status_t WDOG_Configure(uint32_t cs, uint32_t toval, uint32_t win)
+{
+    uint32_t primask;
+    uint32_t timeout;
+    status_t status = STATUS_SUCCESS;
+
+    primask = NVIC_DisableGlobalIRQ();
+
+    WDOG->CNT = WDOG_UNLOCK_KEY;
+
+    /* ULK sets after a few bus clocks */
+    timeout = WDOG_TIMEOUT_COUNT;
+    while (((WDOG->CS & WDOG_CS_ULK_MASK) == 0U) && (timeout > 0U)) {
+        timeout--;
+    }
+
+    if (timeout == 0U) {
+        status = STATUS_TIMEOUT;
+    } else {
+        WDOG->TOVAL = toval;
+        WDOG->WIN = win;
+        /* CS written last: ends the sequence, FLG write 1 to clear */
+        WDOG->CS = cs | WDOG_CS_FLG_MASK;
+
+        timeout = WDOG_TIMEOUT_COUNT;
+        while (((WDOG->CS & WDOG_CS_RCS_MASK) == 0U) && (timeout > 0U)) {
+            timeout--;
+        }
+        if (timeout == 0U) {
+            status = STATUS_TIMEOUT;
+        }
+    }
+
+    NVIC_EnableGlobalIRQ(primask);
+
+    return status;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+status_t WDOG_Init(const wdog_config_t *config)
+{
+    uint32_t freq;
+    uint32_t div = 1U;
+    uint32_t toval;
+    uint32_t win = 0U;
+    uint32_t cs;
+
+    if ((config == NULL) || ((uint32_t)config->clockSource > (uint32_t)WDOG_CLK_SRC_SIRC) ||
+        (config->timeoutUs == 0U) || (config->windowUs >= config->timeoutUs)) {
+        return STATUS_ERROR;
+    }
+
+    if ((WDOG->CS & WDOG_CS_UPDATE_MASK) == 0U) {
+        return STATUS_BUSY;
+    }
+
+    freq = WDOG_GetSourceFreq(config->clockSource);
+    if (freq == 0U) {
+        return STATUS_ERROR;
+    }
+
+    /* Select the /256 prescaler when the timeout does not fit 16 bits */
+    toval = WDOG_UsToCounts(freq, config->timeoutUs, 1U);
+    if ((toval == 0U) || (toval > WDOG_MAX_COUNT)) {
+        div = WDOG_PRESCALER;
+        toval = WDOG_UsToCounts(freq, config->timeoutUs, div);
+    }
+    if ((toval == 0U) || (toval > WDOG_MAX_COUNT)) {
+        return STATUS_ERROR;
+    }
+
+    cs = WDOG_CS_EN_MASK | WDOG_CS_CMD32EN_MASK | WDOG_CS_CLK(config->clockSource);
+
+    if (config->windowUs != 0U) {
+        win = WDOG_UsToCounts(freq, config->windowUs, div);
+        if (win == 0U) {
+            return STATUS_ERROR;
+        }
+        cs |= WDOG_CS_WIN_MASK;
+    }
+    if (div != 1U) {
+        cs |= WDOG_CS_PRES_MASK;
+    }
+    if (config->enableInterrupt) {
+        cs |= WDOG_CS_INT_MASK;
+    }
+    if (config->allowUpdate) {
+        cs |= WDOG_CS_UPDATE_MASK;
+    }
+    if (config->runInWait) {
+        cs |= WDOG_CS_WAIT_MASK;
+    }
+    if (config->runInStop) {
+        cs |= WDOG_CS_STOP_MASK;
+    }
+    if (config->runInDebug) {
+        cs |= WDOG_CS_DBG_MASK;
+    }
+
+    return WDOG_Configure(cs, toval, win);
+}
+
+status_t WDOG_Deinit(void)
+{
+    if ((WDOG->CS & WDOG_CS_UPDATE_MASK) == 0U) {
+        return STATUS_BUSY;
+    }
+
+    /* Keep UPDATE so it can be re-enabled, LPO clock as after reset */
+    return WDOG_Configure(WDOG_CS_CMD32EN_MASK | WDOG_CS_UPDATE_MASK | WDOG_CS_CLK(WDOG_CLK_SRC_LPO),
+                          WDOG_MAX_COUNT, 0U);
+}
+
+uint16_t WDOG_GetCounter(void)
+{
+    return (uint16_t)(WDOG->CNT & WDOG_CNT_MASK);
+}
+
+bool WDOG_IsRefreshAllowed(void)
+{
+    if ((WDOG->CS & WDOG_CS_WIN_MASK) == 0U) {
+        return true;
+    }
+
+    return (WDOG->CNT & WDOG_CNT_MASK) >= (WDOG->WIN & WDOG_WIN_MASK);
+}
+
+bool WDOG_IsEnabled(void)
+{
+    return (WDOG->CS & WDOG_CS_EN_MASK) != 0U;
+}
+
+status_t WDOG_InstallCallback(wdog_callback_t callback, void *userData)
+{
+    uint32_t basepri = NVIC_EnterCritical();
+
+    s_wdogCallback = callback;
+    s_wdogUserData = userData;
+
+    NVIC_ExitCritical(basepri);
+
+    return STATUS_SUCCESS;
+}
+
+status_t WDOG_InstallIrqHandler(void)
+{
+    if (NVIC_InstallHandler(WDOG_EWM_IRQn, WDOG_IRQHandler) != NVIC_STATUS_SUCCESS) {
+        return STATUS_ERROR;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+void WDOG_IRQHandler(void)
+{
+    if ((WDOG->CS & WDOG_CS_FLG_MASK) == 0U) {
+        return;
+    }
+
+    /* FLG is not cleared: CS is writable only after an unlock, and the reset
+     * still follows after 128 bus clocks - the callback only has time to write a few words to RAM */
+    if (s_wdogCallback != NULL) {
+        s_wdogCallback(s_wdogUserData);
+    }
+}
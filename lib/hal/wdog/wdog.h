@@ -0,0 +1,181 @@
+/**
+ * @file    wdog.h
+ * @brief   WDOG (Watchdog Timer) driver for S32K144
+ * @details
+ * WDOG driver provides the following APIs:
+ * - Timeout configured in microseconds from LPO (128 kHz), SOSC, SIRC or
+ *   bus clock, /256 prescaler selected automatically for long timeouts
+ * - Window mode: a refresh before the window opens resets the MCU
+ * - Early interrupt (128 bus clocks before the reset) for last-gasp logging
+ * - Single-store refresh (WDOG_Refresh(), inline) and a reconfiguration
+ *   sequence that completes inside the 128 bus clock unlock window
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ *
+ * @note
+ * - The WDOG is enabled out of reset. SystemInit() disables it when
+ *   DISABLE_WDOG = 1, otherwise it extends the timeout to BOOT_WDOG_TIMEOUT
+ *   and leaves it reconfigurable for WDOG_Init()
+ * - allowUpdate = false locks the configuration until the next reset
+ * - Task-level supervision (every task checks in before the refresh) is in
+ *   the wdog_srv service
+ *
+ * @par Change Log:
+ * - Version 1.0 (14/10/2026): Initial WDOG driver
+ */
+
+#ifndef WDOG_H
+#define WDOG_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "wdog_reg.h"
+#include "status.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @defgroup WDOG_Definitions WDOG Definitions
+ * @{
+ */
+
+/** @brief LPO clock frequency seen by the WDOG (Hz) */
+#define WDOG_LPO_FREQ           (128000UL)
+
+/** @brief Maximum TOVAL / WIN count */
+#define WDOG_MAX_COUNT          (0xFFFFUL)
+
+/** @brief Prescaler divide value (CS[PRES] = 1) */
+#define WDOG_PRESCALER          (256UL)
+
+/** @brief Loop iterations waiting for ULK / RCS after the unlock */
+#define WDOG_TIMEOUT_COUNT      (10000UL)
+
+/**
+ * @brief WDOG clock source (CS[CLK])
+ */
+typedef enum {
+    WDOG_CLK_SRC_BUS  = 0U,             /**< Bus clock */
+    WDOG_CLK_SRC_LPO  = 1U,             /**< LPO 128 kHz, runs in every mode */
+    WDOG_CLK_SRC_SOSC = 2U,             /**< SOSC */
+    WDOG_CLK_SRC_SIRC = 3U              /**< SIRC 8 MHz */
+} wdog_clock_source_t;
+
+/**
+ * @brief WDOG configuration
+ */
+typedef struct {
+    wdog_clock_source_t clockSource;    /**< Counter clock */
+    uint32_t timeoutUs;                 /**< Reset when no refresh for this long (us) */
+    uint32_t windowUs;                  /**< Refresh allowed only after this long (us), 0 = no window */
+    bool enableInterrupt;               /**< Early interrupt before the reset */
+    bool allowUpdate;                   /**< Allow later WDOG_Init() / WDOG_Deinit() */
+    bool runInWait;                     /**< Counter runs in wait (sleep) */
+    bool runInStop;                     /**< Counter runs in stop (VLPS) */
+    bool runInDebug;                    /**< Counter runs with the core halted */
+} wdog_config_t;
+
+/**
+ * @brief Early interrupt callback (interrupt context, reset follows in 128 bus clocks)
+ * @param userData Pointer to user data
+ */
+typedef void (*wdog_callback_t)(void *userData);
+
+/** @} */ /* End of WDOG_Definitions */
+
+/*******************************************************************************
+ * API Function Prototypes
+ ******************************************************************************/
+
+/**
+ * @defgroup WDOG_Functions WDOG Functions
+ * @{
+ */
+
+/**
+ * @brief Configure and enable the watchdog
+ * @details The counter restarts from 0. Unlock and the TOVAL / WIN / CS writes
+ *          run with interrupts masked so they fit in the unlock window.
+ *
+ * @param[in] config WDOG configuration
+ *
+ * @return STATUS_SUCCESS,
+ *         STATUS_ERROR if parameters are invalid, the clock is off or the
+ *         timeout cannot be reached with TOVAL / prescaler,
+ *         STATUS_BUSY if the configuration is locked (CS[UPDATE] = 0),
+ *         STATUS_TIMEOUT if the reconfiguration is not acknowledged
+ *
+ * @code
+ * // 100 ms timeout, refresh not before 20 ms, LPO clock
+ * wdog_config_t cfg = {
+ *     .clockSource = WDOG_CLK_SRC_LPO,
+ *     .timeoutUs = 100000U,
+ *     .windowUs = 20000U,
+ *     .allowUpdate = false
+ * };
+ * WDOG_Init(&cfg);
+ * @endcode
+ */
+status_t WDOG_Init(const wdog_config_t *config);
+
+/**
+ * @brief Disable the watchdog
+ * @return STATUS_BUSY if the configuration is locked, STATUS_TIMEOUT if the
+ *         reconfiguration is not acknowledged
+ */
+status_t WDOG_Deinit(void);
+
+/**
+ * @brief Restart the counter
+ * @details One 32-bit store of the refresh key (CS[CMD32EN] = 1): no
+ *          interrupt masking needed. In window mode a refresh while
+ *          CNT < WIN resets the MCU, see WDOG_IsRefreshAllowed().
+ */
+static inline void WDOG_Refresh(void)
+{
+    WDOG->CNT = WDOG_REFRESH_KEY;
+}
+
+/**
+ * @brief Current counter value
+ */
+uint16_t WDOG_GetCounter(void);
+
+/**
+ * @brief Check whether a refresh now is accepted (window open or no window)
+ * @return true if WDOG_Refresh() is safe
+ */
+bool WDOG_IsRefreshAllowed(void);
+
+/**
+ * @brief Check whether the watchdog is enabled
+ */
+bool WDOG_IsEnabled(void);
+
+/**
+ * @brief Install the early interrupt callback (NULL to remove)
+ */
+status_t WDOG_InstallCallback(wdog_callback_t callback, void *userData);
+
+/**
+ * @brief Install WDOG_IRQHandler() in the RAM vector table (WDOG_EWM_IRQn)
+ * @return STATUS_ERROR if the vector cannot be installed
+ */
+status_t WDOG_InstallIrqHandler(void);
+
+/**
+ * @brief WDOG interrupt handler: calls the callback when CS[FLG] is set
+ * @note The reset is not cancelled, only 128 bus clocks remain
+ */
+void WDOG_IRQHandler(void);
+
+/** @} */ /* End of WDOG_Functions */
+
+#endif /* WDOG_H */
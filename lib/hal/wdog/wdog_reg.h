@@ -0,0 +1,148 @@
+/**
+ * @file    wdog_reg.h
+ * @brief   WDOG (Watchdog Timer) Register Definitions for S32K144
+ * @details
+ * Defines WDOG registers, bitfields and the unlock / refresh keys.
+ * WDOG resets the MCU if the counter reaches TOVAL without a refresh, or - in
+ * window mode - if the refresh comes before the counter reaches WIN.
+ *
+ * S32K144 WDOG features:
+ * - 16-bit counter clocked from bus clock, LPO (128 kHz), SOSC or SIRC
+ * - Optional fixed /256 prescaler
+ * - Window mode, early interrupt 128 bus clocks before the reset
+ * - Enabled out of reset: LPO clock, TOVAL = 0x400 (~8 ms)
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ *
+ * @note    Refer to S32K1xx Reference Manual Chapter 23 (WDOG)
+ * @warning CS / TOVAL / WIN writes must follow the unlock key within 128 bus
+ *          clocks, otherwise the WDOG resets the MCU
+ *
+ * @par Change Log:
+ * - Version 1.0 (14/10/2026): Initial WDOG register definitions
+ */
+
+#ifndef WDOG_REG_H
+#define WDOG_REG_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "def_reg.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief WDOG module base address */
+#define WDOG_BASE           (0x40052000UL)
+
+/*******************************************************************************
+ * WDOG Register Structure
+ ******************************************************************************/
+
+/**
+ * @brief WDOG Module Structure
+ */
+typedef struct {
+    __IO uint32_t CS;               /**< 0x0000: Control and Status Register */
+    __IO uint32_t CNT;              /**< 0x0004: Counter Register (write: unlock / refresh key) */
+    __IO uint32_t TOVAL;            /**< 0x0008: Timeout Value Register */
+    __IO uint32_t WIN;              /**< 0x000C: Window Register */
+} WDOG_Type;
+
+/*******************************************************************************
+ * Register Access Macros
+ ******************************************************************************/
+
+/** @brief WDOG module pointer */
+#define WDOG                ((WDOG_Type *)WDOG_BASE)
+
+/*******************************************************************************
+ * Key Values (32-bit command writes, CS[CMD32EN] = 1)
+ ******************************************************************************/
+
+/** @brief Unlock key - opens the 128 bus clock reconfiguration window */
+#define WDOG_UNLOCK_KEY         (0xD928C520UL)
+
+/** @brief Refresh key - restarts the counter */
+#define WDOG_REFRESH_KEY        (0xB480A602UL)
+
+/*******************************************************************************
+ * Control and Status Register (CS) Bit Definitions
+ ******************************************************************************/
+
+/** @brief Stop Enable - counter runs in stop modes */
+#define WDOG_CS_STOP_MASK       (0x00000001UL)
+#define WDOG_CS_STOP_SHIFT      (0U)
+
+/** @brief Wait Enable - counter runs in wait modes */
+#define WDOG_CS_WAIT_MASK       (0x00000002UL)
+#define WDOG_CS_WAIT_SHIFT      (1U)
+
+/** @brief Debug Enable - counter runs with the core halted by the debugger */
+#define WDOG_CS_DBG_MASK        (0x00000004UL)
+#define WDOG_CS_DBG_SHIFT       (2U)
+
+/** @brief Watchdog Test */
+#define WDOG_CS_TST_MASK        (0x00000018UL)
+#define WDOG_CS_TST_SHIFT       (3U)
+#define WDOG_CS_TST(x)          (((uint32_t)(x) << WDOG_CS_TST_SHIFT) & WDOG_CS_TST_MASK)
+
+/** @brief Allow Updates - 0 = configuration locked until the next reset */
+#define WDOG_CS_UPDATE_MASK     (0x00000020UL)
+#define WDOG_CS_UPDATE_SHIFT    (5U)
+
+/** @brief Watchdog Interrupt - early interrupt before the reset */
+#define WDOG_CS_INT_MASK        (0x00000040UL)
+#define WDOG_CS_INT_SHIFT       (6U)
+
+/** @brief Watchdog Enable */
+#define WDOG_CS_EN_MASK         (0x00000080UL)
+#define WDOG_CS_EN_SHIFT        (7U)
+
+/** @brief Watchdog Clock - 0 bus, 1 LPO, 2 SOSC, 3 SIRC */
+#define WDOG_CS_CLK_MASK        (0x00000300UL)
+#define WDOG_CS_CLK_SHIFT       (8U)
+#define WDOG_CS_CLK(x)          (((uint32_t)(x) << WDOG_CS_CLK_SHIFT) & WDOG_CS_CLK_MASK)
+
+/** @brief Reconfiguration Success (read only) */
+#define WDOG_CS_RCS_MASK        (0x00000400UL)
+#define WDOG_CS_RCS_SHIFT       (10U)
+
+/** @brief Unlock Status (read only) */
+#define WDOG_CS_ULK_MASK        (0x00000800UL)
+#define WDOG_CS_ULK_SHIFT       (11U)
+
+/** @brief Watchdog Prescaler - fixed divide by 256 */
+#define WDOG_CS_PRES_MASK       (0x00001000UL)
+#define WDOG_CS_PRES_SHIFT      (12U)
+
+/** @brief Enables 32-bit refresh / unlock command write words */
+#define WDOG_CS_CMD32EN_MASK    (0x00002000UL)
+#define WDOG_CS_CMD32EN_SHIFT   (13U)
+
+/** @brief Watchdog Interrupt Flag (write 1 to clear) */
+#define WDOG_CS_FLG_MASK        (0x00004000UL)
+#define WDOG_CS_FLG_SHIFT       (14U)
+
+/** @brief Watchdog Window - refresh only allowed once CNT >= WIN */
+#define WDOG_CS_WIN_MASK        (0x00008000UL)
+#define WDOG_CS_WIN_SHIFT       (15U)
+
+/*******************************************************************************
+ * Counter / Timeout / Window Register Bit Definitions
+ ******************************************************************************/
+
+/** @brief Counter value */
+#define WDOG_CNT_MASK           (0x0000FFFFUL)
+
+/** @brief Timeout value */
+#define WDOG_TOVAL_MASK         (0x0000FFFFUL)
+
+/** @brief Window value */
+#define WDOG_WIN_MASK           (0x0000FFFFUL)
+
+#endif /* WDOG_REG_H */
@@ -6,231 +6,413 @@
  */
 
 #include "Nextion.h"
+#include "dma.h"
+#include "nvic.h"
+#include <string.h>
 
-uint8_t NextionAddComp(Nextion* nex, NexComp* _nexcomp, char* objectname, uint8_t __page, uint8_t __id, void (*callbackFuncOnPress)(), void (*callbackFuncOnRelease)())
+#define NEXTION_TX_QUEUE_MASK (NEXTION_TX_QUEUE_LEN - 1U)
+
+#if ((NEXTION_TX_QUEUE_LEN & NEXTION_TX_QUEUE_MASK) != 0U)
+#error "NEXTION_TX_QUEUE_LEN must be a power of 2"
+#endif
+
+#if (NEXTION_MAX_COMP_COUNT > 255)
+#error "NEXTION_MAX_COMP_COUNT must fit the uint8_t dispatch table"
+#endif
+
+static uint8_t NextionQueueCommand(Nextion *nex, const char *_command, uint32_t len);
+
+//Length of the packages with a fixed size (head + payload + 3x 0xFF), 0 = variable.
+//Their payload may contain 0xFF (e.g. number -1), so 0xFF 0xFF 0xFF alone does not end them.
+static uint8_t NextionPackageLength(uint8_t head)
+{
+	switch(head)
+	{
+		case NEX_RET_CURRENT_PAGE_ID_HEAD:      return 5;
+		case NEX_RET_EVENT_TOUCH_HEAD:          return 7;
+		case NEX_RET_NUMBER_HEAD:               return 8;
+		case NEX_RET_EVENT_POSITION_HEAD:
+		case NEX_RET_EVENT_SLEEP_POSITION_HEAD: return 9;
+		default:                                return 0;
+	}
+}
+
+static bool NextionIsErrorReply(uint8_t head)
 {
-	//Make space before passing the object name to the nexcomp struct
-	_nexcomp->objname = (char *) malloc((strlen(objectname)*sizeof(char)) + 1);
-	//Pass the object name to the struct
-	strcpy(_nexcomp->objname, objectname);
+	return (head == NEX_RET_INVALID_CMD) || (head == NEX_RET_INVALID_COMPONENT_ID) ||
+	       (head == NEX_RET_INVALID_PAGE_ID) || (head == NEX_RET_INVALID_PICTURE_ID) ||
+	       (head == NEX_RET_INVALID_FONT_ID) || (head == NEX_RET_INVALID_VARIABLE) ||
+	       (head == NEX_RET_INVALID_OPERATION);
+}
+
+//Handle one complete package of 'count' bytes (terminators included)
+static void NextionHandlePackage(Nextion *nex, uint8_t count)
+{
+	//In case of a touch event call the callback function accordingly,
+	if(nex->_RxDataArr[0] == NEX_RET_EVENT_TOUCH_HEAD)
+	{
+		uint8_t page = nex->_RxDataArr[1];
+		uint8_t id = nex->_RxDataArr[2];
+		uint8_t slot;
+		NexComp *comp;
+
+		//Pages / IDs outside the table have no registered component
+		if((page >= NEXTION_MAX_PAGES) || (id >= NEXTION_MAX_PAGE_IDS))
+			return;
+
+		//Detect the affected component by its Page and ID in one lookup
+		slot = nex->_NexCompIndex[page][id];
+		if(slot == 0)
+			return;
+		comp = nex->_NexCompArr[slot - 1];
+
+		//Call the desired On Press or On Release callback function,
+		if((nex->_RxDataArr[3] == NEX_EVENT_ON_PRESS) && (comp->callbackOnPress != NULL))
+			comp->callbackOnPress();
+		if((nex->_RxDataArr[3] == NEX_EVENT_ON_RELEASE) && (comp->callbackOnRelease != NULL))
+			comp->callbackOnRelease();
+	}
+
+	//If the received package contains string data
+	else if(nex->_RxDataArr[0] == NEX_RET_STRING_HEAD)
+	{
+		uint8_t len = count - 4;
+		if(len > (NEXTION_TEXT_BUFF_LEN - 1))
+			len = NEXTION_TEXT_BUFF_LEN - 1;
+
+		memcpy(nex->NexTextBuff, &nex->_RxDataArr[1], len);
+		nex->NextTextLen = len;
+
+		//Complete a pending NextionGetText (and add NULL character to the end)
+		char *dest = nex->_textDest;
+		if(dest != NULL)
+		{
+			memcpy(dest, nex->NexTextBuff, len);
+			dest[len] = '\0';
+			nex->_textDest = NULL;
+		}
+	}
+
+	//If the received package contains integer data
+	else if(nex->_RxDataArr[0] == NEX_RET_NUMBER_HEAD)
+	{
+		nex->NextNumBuff = (int32_t)(((uint32_t)nex->_RxDataArr[4]<<24)|((uint32_t)nex->_RxDataArr[3]<<16)|((uint32_t)nex->_RxDataArr[2]<<8)|(nex->_RxDataArr[1]));
+
+		int *dest = nex->_valDest;
+		if(dest != NULL)
+		{
+			*dest = nex->NextNumBuff;
+			nex->_valDest = NULL;
+		}
+	}
+
+	//A failed get will never be answered, release it
+	else if(NextionIsErrorReply(nex->_RxDataArr[0]))
+	{
+		nex->_textDest = NULL;
+		nex->_valDest = NULL;
+	}
+}
+
+//Append a string to a command buffer of NEXTION_MAX_BUFF_LEN bytes, false if it does not fit
+static bool NextionAppendStr(char *buf, uint32_t *pos, const char *str)
+{
+	uint32_t p = *pos;
+
+	while(*str != '\0')
+	{
+		if(p >= NEXTION_MAX_BUFF_LEN)
+			return false;
+		buf[p++] = *str++;
+	}
+
+	*pos = p;
+	return true;
+}
+
+//Append a signed decimal number to a command buffer
+static bool NextionAppendInt(char *buf, uint32_t *pos, int value)
+{
+	char digits[10];
+	uint32_t n = 0, p = *pos;
+	uint32_t mag = (value < 0) ? (0U - (uint32_t)value) : (uint32_t)value;
+
+	//Digits in reverse order, INT_MIN included
+	do
+	{
+		digits[n++] = (char)('0' + (mag % 10U));
+		mag /= 10U;
+	} while(mag != 0U);
+
+	if((p + n + ((value < 0) ? 1U : 0U)) > NEXTION_MAX_BUFF_LEN)
+		return false;
+
+	if(value < 0)
+		buf[p++] = '-';
+	while(n > 0)
+		buf[p++] = digits[--n];
+
+	*pos = p;
+	return true;
+}
+
+//Circular RX DMA notification (interrupt context)
+static void NextionRxCallback(LPUART_RegType *base, const uint8_t *data, uint32_t length, void *userData)
+{
+	(void)base;
+	NextionUpdate((Nextion *)userData, data, length);
+}
+
+uint8_t NextionAddComp(Nextion* nex, NexComp* _nexcomp, const char* objectname, uint8_t __page, uint8_t __id, void (*callbackFuncOnPress)(), void (*callbackFuncOnRelease)())
+{
+	if(nex->_NexCompCount >= NEXTION_MAX_COMP_COUNT)
+		return NEX_ERROR;
+
+	//One component per (page, id), inside the dispatch table
+	if((__page >= NEXTION_MAX_PAGES) || (__id >= NEXTION_MAX_PAGE_IDS) || (nex->_NexCompIndex[__page][__id] != 0))
+		return NEX_ERROR;
+
+	//Pass the object name to the struct (no heap, the string must stay valid)
+	_nexcomp->objname = objectname;
 
 	//Pass the corresponding data from component to component struct
 	_nexcomp->_id = __id;
 	_nexcomp->_page = __page;
 
+	//Bind the correct callback functions together
+	_nexcomp->callbackOnPress = callbackFuncOnPress;
+	_nexcomp->callbackOnRelease = callbackFuncOnRelease;
+
 	//Add the component struct to the list on the Nextion Struct
 	nex->_NexCompArr[nex->_NexCompCount] = _nexcomp;
 	nex->_NexCompCount++;
 
-	//Bind the correct callback functions together
-	_nexcomp->callbackOnPress = callbackFuncOnPress;
-	_nexcomp->callbackOnRelease = callbackFuncOnRelease;
+	//Register it in the touch dispatch table (index + 1, 0 = empty)
+	nex->_NexCompIndex[__page][__id] = nex->_NexCompCount;
 
 	//Return OK
-	return 0;
+	return NEX_OK;
 }
 
-uint8_t NextionInit(Nextion *nex, UART_HandleTypeDef *nextionUARTHandle)
+uint8_t NextionInit(Nextion *nex, LPUART_RegType *base, uint8_t rxDmaChannel, uint8_t txDmaChannel)
 {
-	//Pass the used UART handle to the struct
-	nex->nextionUARTHandle = nextionUARTHandle;
+	//Pass the used UART to the struct
+	nex->uart = base;
+	nex->_txDmaChannel = txDmaChannel;
 
 	//Start the parsing counters from zero
 	nex->_arrCount = 0;
 	nex->_pkgCount = 0;
 
-	//Start UART transaction using DMA
-	HAL_UART_Receive_IT(nex->nextionUARTHandle, (uint8_t *)&nex->_RxData, 1);
+	//Empty TX queue, no pending requests
+	nex->_txHead = 0;
+	nex->_txTail = 0;
+	nex->_txInflight = 0;
+	nex->_textDest = NULL;
+	nex->_valDest = NULL;
+	nex->NextTextLen = 0;
+	nex->NextNumBuff = 0;
 
 	//Start the component count variable from zero
 	nex->_NexCompCount  = 0;
+	memset(nex->_NexCompIndex, 0, sizeof(nex->_NexCompIndex));
+
+	if(UART_ConfigTxDMA(base, txDmaChannel) != UART_STATUS_SUCCESS)
+		return NEX_ERROR;
+
+	//Start continuous reception, bytes are reported on line idle / half / full buffer
+	if(UART_StartCircularRxDMA(base, rxDmaChannel, nex->_RxRing, NEXTION_RX_RING_LEN, NextionRxCallback, nex) != UART_STATUS_SUCCESS)
+		return NEX_ERROR;
 
 	//Return OK
-	return 0;
+	return NEX_OK;
 }
 
-uint8_t NextionUpdate(UART_HandleTypeDef *huart, Nextion *nex)
+uint8_t NextionUpdate(Nextion *nex, const uint8_t *data, uint32_t len)
 {
-	if(huart->Instance == (nex->nextionUARTHandle->Instance))
+	for(uint32_t n = 0; n < len; n++)
 	{
+		uint8_t byte = data[n];
+
 		//Add the received byte to the array and increment the counter afterwards
-		nex->_RxDataArr[nex->_arrCount] = nex->_RxData;
+		nex->_RxDataArr[nex->_arrCount] = byte;
 		nex->_arrCount++;
 
 		//Count 0xFF
-		if(nex->_RxData == 0xFF)
+		if(byte == 0xFF)
 			nex->_pkgCount++;
 		else
 			nex->_pkgCount = 0;
 
-		//Assume a package is received after three 0xFF commands,
-		//and start processing the data
-		if(nex->_pkgCount == 3)
+		uint8_t expected = NextionPackageLength(nex->_RxDataArr[0]);
+
+		//A package is received after three 0xFF (and the full length for fixed-size packages)
+		if((nex->_pkgCount >= 3) && ((expected == 0) || (nex->_arrCount >= expected)))
 		{
-			//Determine the length (count) of the data
-			uint8_t count = 0, FFCount = 0;
-			for(uint8_t i = 0; FFCount < 3; i++)
-			{
-				count++;
-				if(nex->_RxDataArr[i] == 0xFF) FFCount++;
-			}
-
-			//In case of a touch event call the callback function accordingly,
-			if(nex->_RxDataArr[0] == NEX_RET_EVENT_TOUCH_HEAD)
-			{
-				//Loop through the component struct array,
-				for(uint8_t i = 0; i < nex->_NexCompCount; i++)
-				{
-					//Detect the affected component by its Page and ID
-					if( (nex->_RxDataArr[2] == (nex->_NexCompArr[i]->_id)) && (nex->_RxDataArr[1] == (nex->_NexCompArr[i]->_page)) )
-					{
-						//Call the desired On Press or On Release callback function,
-						if((nex->_RxDataArr[3] == NEX_EVENT_ON_PRESS) && (nex->_NexCompArr[i]->callbackOnPress != NULL))
-							nex->_NexCompArr[i]->callbackOnPress();
-						if((nex->_RxDataArr[3] == NEX_EVENT_ON_RELEASE) && (nex->_NexCompArr[i]->callbackOnRelease != NULL))
-							nex->_NexCompArr[i]->callbackOnRelease();
-					}
-				}
-			}
-
-			//If the received package contains string data
-			if(nex->_RxDataArr[0] == NEX_RET_STRING_HEAD)
-			{
-				nex->NextTextLen = 0;
-				for(int i = 0; i < (count - 4); i++)
-				{
-					nex->NexTextBuff[i] = nex->_RxDataArr[i+1];
-					nex->NextTextLen++;
-				}
-			}
-
-			//If the received package contains integer data
-			if(nex->_RxDataArr[0] == NEX_RET_NUMBER_HEAD)
-			{
-				nex->NextNumBuff = ((uint32_t)nex->_RxDataArr[4]<<24)|((uint32_t)nex->_RxDataArr[3]<<16)|(nex->_RxDataArr[2]<<8)|(nex->_RxDataArr[1]);
-			}
+			NextionHandlePackage(nex, nex->_arrCount);
 
 			//Reset the buffer counters
 			nex->_pkgCount = 0;
 			nex->_arrCount = 0;
 		}
-
-		HAL_UART_Receive_IT(nex->nextionUARTHandle, (uint8_t *)&nex->_RxData, 1);
+		//Fixed-size package without terminator or buffer overflow: drop and resync
+		else if(((expected != 0) && (nex->_arrCount >= expected)) || (nex->_arrCount >= NEXTION_MAX_BUFF_LEN))
+		{
+			nex->_pkgCount = 0;
+			nex->_arrCount = 0;
+		}
 	}
 
 	//Return OK
-	return 0;
+	return NEX_OK;
 }
 
-uint8_t NextionGetText(Nextion *nex, NexComp *comp, char *buf)
+uint8_t NextionProcess(Nextion *nex)
 {
-	//Allocate a static buffer for combining the transfer command string
-	char transmitBuff[NEXTION_TEXT_BUFF_LEN] = {0};
-
-	//Combine required commands in a single string
-	sprintf(transmitBuff, "get %s.txt", comp->objname);
-
-	//Send the combined command to Nextion and wait for the received answer
-	NextionSendCommand(nex, transmitBuff);
-	HAL_Delay(10);
+	uint32_t tail, chunk, offset;
 
-	//Copy the received string to the desired buffer (and add NULL character to the end),
-	for(uint8_t i = 0; i < nex->NextTextLen; i++)
+	//Previous DMA transfer finished: release its bytes
+	if(nex->_txInflight != 0)
 	{
-		buf[i] = nex->NexTextBuff[i];
+		if(!DMA_IsChannelDone(nex->_txDmaChannel))
+			return NEX_BUSY;
+
+		(void)DMA_ClearDone(nex->_txDmaChannel);
+		nex->_txTail += nex->_txInflight;
+		nex->_txInflight = 0;
 	}
-	buf[nex->NextTextLen] = '\0';
 
-	//Return OK
-	return 0;
+	tail = nex->_txTail;
+	chunk = nex->_txHead - tail;
+	if(chunk == 0)
+		return NEX_OK;
+
+	//Contiguous part only, the wrapped remainder goes in the next call
+	offset = tail & NEXTION_TX_QUEUE_MASK;
+	if(chunk > (NEXTION_TX_QUEUE_LEN - offset))
+		chunk = NEXTION_TX_QUEUE_LEN - offset;
+
+	if(UART_SendDMA(nex->uart, nex->_txDmaChannel, &nex->_TxQueue[offset], chunk) == UART_STATUS_SUCCESS)
+		nex->_txInflight = chunk;
+
+	return NEX_BUSY;
 }
 
-uint8_t NextionSetText(Nextion *nex, NexComp *comp, char *usertext)
+uint8_t NextionGetText(Nextion *nex, NexComp *comp, char *buf)
 {
-	//Allocate a static buffer for combining the transfer command string
-	char transmitBuff[NEXTION_TEXT_BUFF_LEN] = {0};
+	char transmitBuff[NEXTION_MAX_BUFF_LEN];
+	uint32_t len = 0;
+	uint8_t status;
+
+	//Only one text request at a time, replies carry no component reference
+	if(nex->_textDest != NULL)
+		return NEX_BUSY;
 
 	//Combine required commands in a single string
-	sprintf(transmitBuff, "%s.txt=\"%s\"", comp->objname, usertext);
+	if(!NextionAppendStr(transmitBuff, &len, "get ") || !NextionAppendStr(transmitBuff, &len, comp->objname) ||
+	   !NextionAppendStr(transmitBuff, &len, ".txt"))
+		return NEX_ERROR;
 
-	//Send the combined command to Nextion and wait for the received answer
-	NextionSendCommand(nex, transmitBuff);
+	//Register the destination before the reply can arrive
+	nex->_textDest = buf;
+	status = NextionQueueCommand(nex, transmitBuff, len);
+	if(status != NEX_OK)
+		nex->_textDest = NULL;
 
-	//Return OK
-	return 0;
+	return status;
 }
 
-uint8_t NextionGetVal(Nextion *nex, NexComp *comp, int *valBuf)
+uint8_t NextionSetText(Nextion *nex, NexComp *comp, const char *usertext)
 {
-	//Allocate a static buffer for combining the transfer command string
-	char transmitBuff[NEXTION_TEXT_BUFF_LEN] = {0};
+	char transmitBuff[NEXTION_MAX_BUFF_LEN];
+	uint32_t len = 0;
 
 	//Combine required commands in a single string
-	sprintf(transmitBuff, "get %s.val", comp->objname);
+	if(!NextionAppendStr(transmitBuff, &len, comp->objname) || !NextionAppendStr(transmitBuff, &len, ".txt=\"") ||
+	   !NextionAppendStr(transmitBuff, &len, usertext) || !NextionAppendStr(transmitBuff, &len, "\""))
+		return NEX_ERROR;
 
-	//Send the combined command to Nextion and wait for the received answer
-	NextionSendCommand(nex, transmitBuff);
+	//Queue the combined command, NextionProcess sends it
+	return NextionQueueCommand(nex, transmitBuff, len);
+}
 
-	//Wait for Nextion to send the command back;
-	//This line blocks the code for a while and provides a crude ensurement
-	HAL_Delay(50);
+uint8_t NextionGetVal(Nextion *nex, NexComp *comp, int *valBuf)
+{
+	char transmitBuff[NEXTION_MAX_BUFF_LEN];
+	uint32_t len = 0;
+	uint8_t status;
 
-	//Get the received value from the buffer and pass it to the user variable
-	*valBuf = nex->NextNumBuff;
+	if(nex->_valDest != NULL)
+		return NEX_BUSY;
 
-	//Return OK
-	return 0;
+	//Combine required commands in a single string
+	if(!NextionAppendStr(transmitBuff, &len, "get ") || !NextionAppendStr(transmitBuff, &len, comp->objname) ||
+	   !NextionAppendStr(transmitBuff, &len, ".val"))
+		return NEX_ERROR;
+
+	//No more waiting here: the parser writes *valBuf when the 0x71 package arrives
+	nex->_valDest = valBuf;
+	status = NextionQueueCommand(nex, transmitBuff, len);
+	if(status != NEX_OK)
+		nex->_valDest = NULL;
+
+	return status;
 }
 
 uint8_t NextionSetVal(Nextion *nex, NexComp *comp, int userval)
 {
-	//Allocate a static buffer for combining the transfer command string
-	char transmitBuff[NEXTION_TEXT_BUFF_LEN] = {0};
+	char transmitBuff[NEXTION_MAX_BUFF_LEN];
+	uint32_t len = 0;
 
 	//Combine required commands in a single string
-	sprintf(transmitBuff, "%s.val=%d", comp->objname, userval);
+	if(!NextionAppendStr(transmitBuff, &len, comp->objname) || !NextionAppendStr(transmitBuff, &len, ".val=") ||
+	   !NextionAppendInt(transmitBuff, &len, userval))
+		return NEX_ERROR;
 
-	//Send the combined command to Nextion and wait for the received answer
-	NextionSendCommand(nex, transmitBuff);
-
-	//Return OK
-	return 0;
+	//Queue the combined command, NextionProcess sends it
+	return NextionQueueCommand(nex, transmitBuff, len);
 }
 
-char ENDTERMS[]={255,255,255};
-uint8_t NextionSendCommand(Nextion *nex, char *_command)
+bool NextionTextReady(Nextion *nex)
 {
-	HAL_UART_Transmit(nex->nextionUARTHandle, (uint8_t *)_command, strlen((const char*)_command), NEXTION_TIMEOUT);
-	NextionEndCommand(nex);
-
-	//Return OK
-	return 0;
+	return nex->_textDest == NULL;
 }
 
-uint8_t NextionEndCommand(Nextion *nex)
+bool NextionValReady(Nextion *nex)
 {
-	uint8_t EndCommand[3] = {255, 255, 255};
-	HAL_UART_Transmit(nex->nextionUARTHandle, EndCommand, 3, NEXTION_TIMEOUT);
-	NextionRestartIT(nex);
-
-	//Return OK
-	return 0;
+	return nex->_valDest == NULL;
 }
 
-//Following two functions are not needed anymore and will be removed in the future,
-uint8_t NextionRestartIT(Nextion *nex)
+uint8_t NextionSendCommand(Nextion *nex, const char *_command)
 {
-	HAL_UART_Receive_IT(nex->nextionUARTHandle, (uint8_t *)&nex->_RxData, 1);
-
-	//Return OK
-	return 0;
+	return NextionQueueCommand(nex, _command, strlen(_command));
 }
 
-uint8_t NextionStopIT(Nextion *nex)
+//Queue 'len' command bytes plus the terminator
+static uint8_t NextionQueueCommand(Nextion *nex, const char *_command, uint32_t len)
 {
-	//Stop UART interrupts. Required for Nextion communication functions,
-	HAL_UART_AbortReceive_IT(nex->nextionUARTHandle);
+	uint32_t primask, head;
+
+	//Callbacks may send from the RX interrupt: reserve the space atomically
+	primask = NVIC_DisableGlobalIRQ();
+
+	head = nex->_txHead;
+	if((len + 3) > (NEXTION_TX_QUEUE_LEN - (head - nex->_txTail)))
+	{
+		NVIC_EnableGlobalIRQ(primask);
+		return NEX_BUSY;
+	}
+
+	//Whole command plus the 0xFF 0xFF 0xFF terminator, never half a command
+	for(uint32_t i = 0; i < len; i++)
+		nex->_TxQueue[(head + i) & NEXTION_TX_QUEUE_MASK] = (uint8_t)_command[i];
+	for(uint32_t i = 0; i < 3; i++)
+		nex->_TxQueue[(head + len + i) & NEXTION_TX_QUEUE_MASK] = 0xFF;
+
+	nex->_txHead = head + len + 3;
+
+	NVIC_EnableGlobalIRQ(primask);
 
 	//Return OK
-	return 0;
-}
\ No newline at end of file
+	return NEX_OK;
+}
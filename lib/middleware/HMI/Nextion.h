@@ -4,15 +4,27 @@
  *  Created on: Aug 12, 2022
  *      Author: Emre DUR
  *
+ *  Ported to the S32K144 uart.h driver:
+ *  - RX: circular DMA (UART_StartCircularRxDMA), bytes parsed incrementally
+ *    into 0xFF 0xFF 0xFF terminated packages from the DMA/idle interrupt
+ *  - TX: commands go into a byte queue drained by DMA from NextionProcess(),
+ *    NextionSetText / NextionSetVal / NextionGet* never block
  *
- * Configure UART RX and TX DMA streams and UART Global Interrupt to use this library.
- * This library also requires the function below included in the main code wihtout ANY changes.
- *
+ * Requires UART_DMA_ENABLE. Route the RX DMA channel IRQ (DMA_IRQHandler),
+ * the LPUART IRQ (UART_IRQHandler) at the same priority, then:
  *
 ----------------------------
-void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+Nextion nextion;
+
+UART_Init(LPUART1, &uartConfig, UART_GetClockFrequency(1));
+NextionInit(&nextion, LPUART1, 2, 3);	//RX DMA ch 2, TX DMA ch 3
+NVIC_EnableIRQ(DMA2_IRQn);
+NVIC_EnableIRQ(LPUART1_RxTx_IRQn);
+
+while(1)
 {
-	Nextion_Update(huart, &nextion);
+	NextionProcess(&nextion);
+	...
 }
 -----------------------------
  *
@@ -22,23 +34,50 @@ void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
 #ifndef INC_NEXTION_H_
 #define INC_NEXTION_H_
 
-//Include HAL Library from main header file :/
-#include "main.h"
+//Include S32K144 drivers
+#include "uart.h"
 
 //Include libraries
-#include "stdlib.h"
-#include "string.h"
-#include "stdio.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#if !UART_DMA_ENABLE
+#error "Nextion driver requires UART_DMA_ENABLE"
+#endif
 
 /*
  * Defines
  */
 //Reminder: To use more components or to receive more characters increase buffer or list counts!
-#define NEXTION_TIMEOUT 250
 #define NEXTION_MAX_BUFF_LEN 96
 #define NEXTION_TEXT_BUFF_LEN 64
 #define NEXTION_MAX_COMP_COUNT 32
 
+//Touch dispatch table bounds: components must use page < NEXTION_MAX_PAGES and
+//id < NEXTION_MAX_PAGE_IDS (one byte per (page, id) slot)
+#ifndef NEXTION_MAX_PAGES
+#define NEXTION_MAX_PAGES 8
+#endif
+
+#ifndef NEXTION_MAX_PAGE_IDS
+#define NEXTION_MAX_PAGE_IDS 32
+#endif
+
+//Circular DMA RX buffer, holds the longest burst between two idle-line notifications
+#ifndef NEXTION_RX_RING_LEN
+#define NEXTION_RX_RING_LEN 128
+#endif
+
+//TX command queue (power of 2), whole commands incl. terminators
+#ifndef NEXTION_TX_QUEUE_LEN
+#define NEXTION_TX_QUEUE_LEN 256
+#endif
+
+//Return codes of the library functions
+#define NEX_OK                               (0)
+#define NEX_BUSY                             (1)    //Queue full or a reply is still pending
+#define NEX_ERROR                            (2)
+
 #define NEX_RET_CMD_FINISHED                 (0x01)
 #define NEX_RET_EVENT_LAUNCHED               (0x88)
 #define NEX_RET_EVENT_UPGRADED               (0x89)
@@ -67,12 +106,12 @@ typedef struct
 	//Variables for storing page and ID for every component
 	uint8_t _page, _id;
 
-	//Function pointers for storing the callback functions
+	//Function pointers for storing the callback functions (called from the RX interrupt)
 	void (*callbackOnPress)();
 	void (*callbackOnRelease)();
 
-	//Variable for storing object name
-	char *objname;
+	//Variable for storing object name (not copied, must stay valid)
+	const char *objname;
 
 } NexComp;
 
@@ -82,20 +121,36 @@ typedef struct
  */
 typedef struct
 {
-	//Handle for the UART used with the Nextion display
-	UART_HandleTypeDef *nextionUARTHandle;
+	//UART used with the Nextion display and its DMA channels
+	LPUART_RegType *uart;
+	uint8_t _txDmaChannel;
+
+	//Circular DMA RX storage
+	uint8_t _RxRing[NEXTION_RX_RING_LEN];
 
 	//Variables for parsing the received data
-	uint8_t _RxDataArr[NEXTION_MAX_BUFF_LEN], _RxData, _arrCount, _pkgCount;
+	uint8_t _RxDataArr[NEXTION_MAX_BUFF_LEN], _arrCount, _pkgCount;
+
+	//TX command queue (free-running indexes) and bytes in the running DMA transfer
+	uint8_t _TxQueue[NEXTION_TX_QUEUE_LEN];
+	volatile uint32_t _txHead;
+	uint32_t _txTail, _txInflight;
 
 	//Variables for component list
 	NexComp* _NexCompArr[NEXTION_MAX_COMP_COUNT];
 	uint8_t _NexCompCount;
 
+	//Touch dispatch table, (index in _NexCompArr + 1) per (page, id), 0 = no component
+	uint8_t _NexCompIndex[NEXTION_MAX_PAGES][NEXTION_MAX_PAGE_IDS];
+
 	//Variables for receiving strings and numbers,
 	uint8_t NexTextBuff[NEXTION_TEXT_BUFF_LEN], NextTextLen;
 	int32_t NextNumBuff;
 
+	//Destinations of the pending get requests (NULL = none pending)
+	char * volatile _textDest;
+	int * volatile _valDest;
+
 } Nextion;
 
 
@@ -103,21 +158,27 @@ typedef struct
  * Library User functions
  */
 
-uint8_t NextionAddComp(Nextion* nex, NexComp* _nexcomp, char* objectname, uint8_t __page, uint8_t __id, void (*callbackFuncOnPress)(), void (*callbackFuncOnRelease)());
-uint8_t NextionUpdate(UART_HandleTypeDef *huart, Nextion *nex);
-uint8_t NextionInit(Nextion *nex, UART_HandleTypeDef *nextionUARTHandle);
+//NEX_ERROR if the list is full, page / id is outside the dispatch table or already registered
+uint8_t NextionAddComp(Nextion* nex, NexComp* _nexcomp, const char* objectname, uint8_t __page, uint8_t __id, void (*callbackFuncOnPress)(), void (*callbackFuncOnRelease)());
+uint8_t NextionInit(Nextion *nex, LPUART_RegType *base, uint8_t rxDmaChannel, uint8_t txDmaChannel);
+uint8_t NextionProcess(Nextion *nex);
+
+//Queue "get"; buf (NEXTION_TEXT_BUFF_LEN bytes) / *valBuf is written when the reply arrives,
+//poll NextionTextReady / NextionValReady. NEX_BUSY while a previous get is pending.
 uint8_t NextionGetText(Nextion *nex, NexComp *comp, char *buf);
-uint8_t NextionSetText(Nextion *nex, NexComp *comp, char *usertext);
 uint8_t NextionGetVal(Nextion *nex, NexComp *comp, int *valBuf);
+bool NextionTextReady(Nextion *nex);
+bool NextionValReady(Nextion *nex);
+
+//Queue "set", returns at once (NEX_BUSY if the queue is full)
+uint8_t NextionSetText(Nextion *nex, NexComp *comp, const char *usertext);
 uint8_t NextionSetVal(Nextion *nex, NexComp *comp, int userval);
 
 
 /*
  * Library Low Level Functions
  */
-uint8_t NextionSendCommand(Nextion *nex, char *_command);
-uint8_t NextionEndCommand(Nextion *nex);
-uint8_t NextionRestartIT(Nextion *nex);
-uint8_t NextionStopIT(Nextion *nex);
+uint8_t NextionSendCommand(Nextion *nex, const char *_command);
+uint8_t NextionUpdate(Nextion *nex, const uint8_t *data, uint32_t len);
 
-#endif /* INC_NEXTION_H_ */
\ No newline at end of file
+#endif /* INC_NEXTION_H_ */
@@ -13,20 +13,37 @@
  ******************************************************************************/
 #include "lcd_i2c.h"
 #include "i2c.h"
+#include "lpit.h"
+#include "nvic.h"
+#include "clock_manager.h"
 #include <stdio.h>
 #include <stdarg.h>
 #include <string.h>
 
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static bool s_lcdTimerAttached = false;
+static uint8_t s_lcdTimerChannel = 0;
+static volatile bool s_lcdTimerBusy = false;    /* One-shot deadline pending */
+
+#if LCD_I2C_BUFFER_ENABLE
+/* DDRAM address of column 0 for each row */
+static const uint8_t s_lcdRowOffset[LCD_MAX_ROWS] = { 0x00, 0x40, 0x14, 0x54 };
+#endif
+
 /*******************************************************************************
  * Private Functions
  ******************************************************************************/
 
 /**
- * @brief Delay in milliseconds (simple busy-wait)
+ * @brief Delay in milliseconds (busy-wait on the DWT cycle counter)
+ * @note Scaled by the cached core clock, so clock switches followed by
+ *       ClockManager_Update() keep the HD44780 timing.
  */
 static void LCD_DelayMs(uint32_t ms)
 {
-    for (volatile uint32_t i = 0; i < ms * 8000; i++);
+    ClockManager_DelayUs(ms * 1000U);
 }
 
 /**
@@ -34,7 +51,61 @@ static void LCD_DelayMs(uint32_t ms)
  */
 static void LCD_DelayUs(uint32_t us)
 {
-    for (volatile uint32_t i = 0; i < us * 8; i++);
+    ClockManager_DelayUs(us);
+}
+
+/**
+ * @brief LPIT one-shot expired: LCD ready for the next command
+ */
+static void LCD_TimerCallback(uint8_t channel, void *userData)
+{
+    (void)channel;
+    (void)userData;
+
+    s_lcdTimerBusy = false;
+}
+
+/**
+ * @brief Wait for a pending deadline (sleeps, the LPIT IRQ wakes the core)
+ */
+static void LCD_WaitReady(void)
+{
+    while (s_lcdTimerBusy) {
+        NVIC_WaitForInterrupt();
+    }
+}
+
+/**
+ * @brief Start the time the LCD needs before its next access
+ * @details With a timer this returns at once, the next LCD access waits
+ *          for the deadline; without one it falls back to the software loops.
+ */
+static void LCD_Schedule(uint32_t us)
+{
+    uint32_t freq;
+    uint32_t ticks;
+
+    if (!s_lcdTimerAttached) {
+        if (us >= 1000U) {
+            LCD_DelayMs((us + 999U) / 1000U);
+        } else {
+            LCD_DelayUs(us);
+        }
+        return;
+    }
+
+    LCD_WaitReady();
+
+    freq = LPIT_GetClockFreq();
+    ticks = (uint32_t)((((uint64_t)us * freq) + 999999U) / 1000000U);
+    if (ticks == 0U) {
+        ticks = 1U;
+    }
+
+    s_lcdTimerBusy = true;
+    (void)LPIT_StopChannel(s_lcdTimerChannel);
+    (void)LPIT_SetPeriod(s_lcdTimerChannel, ticks - 1U);
+    (void)LPIT_StartChannel(s_lcdTimerChannel);
 }
 
 /**
@@ -47,18 +118,57 @@ static void LCD_SendNibble(LCD_I2C_Handle_t *lcd, uint8_t nibble, uint8_t rs)
     /* Prepare data byte: D7-D4 = nibble, D3 = BL, D2 = EN, D1 = RW, D0 = RS */
     data = (nibble & 0xF0) | (lcd->backlight ? LCD_BIT_BL : 0) | (rs ? LCD_BIT_RS : 0);
     
-    /* Send with EN=1 */
+    LCD_WaitReady();
+
+    /* Send with EN=1 then EN=0. One I2C byte (>= 22 us up to 400 kHz) is
+     * longer than the EN pulse width and the 37 us execution time, so no
+     * extra delay is needed between nibbles or characters */
     uint8_t dataH = data | LCD_BIT_EN;
     I2C_MasterStart(lcd->i2cBase, lcd->address, I2C_WRITE);
     I2C_MasterSend(lcd->i2cBase, &dataH, 1, false);
-    LCD_DelayUs(1);
     
-    /* Send with EN=0 */
     uint8_t dataL = data;
     I2C_MasterSend(lcd->i2cBase, &dataL, 1, true);
-    LCD_DelayUs(50);
 }
 
+#if LCD_I2C_BUFFER_ENABLE
+/**
+ * @brief Pack one HD44780 byte as 4 PCF8574 bytes (hi/lo nibble, EN high then low)
+ */
+static uint32_t LCD_PackByte(const LCD_I2C_Handle_t *lcd, uint8_t *out, uint8_t value, uint8_t rs)
+{
+    uint8_t ctrl = (lcd->backlight ? LCD_BIT_BL : 0) | (rs ? LCD_BIT_RS : 0);
+    uint8_t hi = (value & 0xF0) | ctrl;
+    uint8_t lo = ((value << 4) & 0xF0) | ctrl;
+
+    out[0] = hi | LCD_BIT_EN;
+    out[1] = hi;
+    out[2] = lo | LCD_BIT_EN;
+    out[3] = lo;
+
+    return LCD_BYTES_PER_WRITE;
+}
+
+/**
+ * @brief Write a character into the framebuffer at the cursor (clipped per row)
+ */
+static void LCD_BufferPut(LCD_I2C_Handle_t *lcd, char ch)
+{
+    if ((lcd->cursorRow < lcd->rows) && (lcd->cursorCol < lcd->cols)) {
+        lcd->frame[lcd->cursorRow][lcd->cursorCol] = ch;
+        lcd->cursorCol++;
+    }
+}
+
+/**
+ * @brief Cell needs sending (changed, or everything on resync)
+ */
+static bool LCD_CellDirty(const LCD_I2C_Handle_t *lcd, uint8_t row, uint8_t col)
+{
+    return lcd->resync || (lcd->frame[row][col] != lcd->shown[row][col]);
+}
+#endif
+
 /*******************************************************************************
  * Public Functions
  ******************************************************************************/
@@ -74,11 +184,9 @@ void LCD_SendCmd(LCD_I2C_Handle_t *lcd, uint8_t cmd)
     /* Send lower nibble */
     LCD_SendNibble(lcd, (cmd << 4) & 0xF0, 0);
     
-    /* Commands need time to execute */
+    /* CLEAR / HOME take 1.52 ms: return now, the next access waits */
     if (cmd == LCD_CMD_CLEAR || cmd == LCD_CMD_HOME) {
-        LCD_DelayMs(2);
-    } else {
-        LCD_DelayUs(50);
+        LCD_Schedule(LCD_CLEAR_HOME_US);
     }
 }
 
@@ -92,8 +200,42 @@ void LCD_SendData(LCD_I2C_Handle_t *lcd, uint8_t data)
     
     /* Send lower nibble with RS=1 */
     LCD_SendNibble(lcd, (data << 4) & 0xF0, 1);
-    
-    LCD_DelayUs(50);
+}
+
+/**
+ * @brief Use an LPIT channel for LCD command timing
+ */
+LCD_Status_t LCD_AttachTimer(uint8_t lpitChannel)
+{
+    lpit_channel_config_t config = {
+        .channel = lpitChannel,
+        .mode = LPIT_MODE_32BIT_PERIODIC,
+        .period = 0,
+        .enableInterrupt = true,
+        .chainChannel = false,
+        .startOnTrigger = false,
+        .stopOnInterrupt = true,        /* One-shot */
+        .reloadOnTrigger = false
+    };
+
+    if ((LPIT_ConfigChannel(&config) != STATUS_SUCCESS) ||
+        (LPIT_InstallCallback(lpitChannel, LCD_TimerCallback, NULL) != STATUS_SUCCESS)) {
+        return LCD_STATUS_ERROR;
+    }
+
+    s_lcdTimerChannel = lpitChannel;
+    s_lcdTimerBusy = false;
+    s_lcdTimerAttached = true;
+
+    return LCD_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Check whether the LCD can take the next command / flush
+ */
+bool LCD_IsReady(void)
+{
+    return !s_lcdTimerBusy;
 }
 
 /**
@@ -116,22 +258,25 @@ void LCD_InitEx(LCD_I2C_Handle_t *lcd, LPI2C_RegType *i2cBase,
     lcd->backlight = 1;
     lcd->rows = rows;
     lcd->cols = cols;
+#if LCD_I2C_BUFFER_ENABLE
+    lcd->buffered = false;
+#endif
     
     /* Wait for LCD power-up */
-    LCD_DelayMs(50);
+    LCD_Schedule(LCD_POWER_UP_US);
     
-    /* Initialization sequence for 4-bit mode */
+    /* Initialization sequence for 4-bit mode (each nibble waits for the previous deadline) */
     LCD_SendNibble(lcd, 0x30, 0);  /* Function set: 8-bit */
-    LCD_DelayMs(5);
+    LCD_Schedule(LCD_FUNCTION_SET_US);
     
     LCD_SendNibble(lcd, 0x30, 0);  /* Function set: 8-bit */
-    LCD_DelayUs(150);
+    LCD_Schedule(LCD_INIT_STEP_US);
     
     LCD_SendNibble(lcd, 0x30, 0);  /* Function set: 8-bit */
-    LCD_DelayUs(150);
+    LCD_Schedule(LCD_INIT_STEP_US);
     
     LCD_SendNibble(lcd, 0x20, 0);  /* Function set: 4-bit */
-    LCD_DelayUs(150);
+    LCD_Schedule(LCD_INIT_STEP_US);
     
     /* Configure LCD */
     LCD_SendCmd(lcd, 0x28);  /* 4-bit, 2 lines, 5x8 font */
@@ -146,6 +291,15 @@ void LCD_InitEx(LCD_I2C_Handle_t *lcd, LPI2C_RegType *i2cBase,
  */
 void LCD_Clear(LCD_I2C_Handle_t *lcd)
 {
+#if LCD_I2C_BUFFER_ENABLE
+    if (lcd->buffered) {
+        /* Spaces instead of the 2 ms CLEAR command, flush sends only what was visible */
+        memset(lcd->frame, ' ', sizeof(lcd->frame));
+        lcd->cursorCol = 0;
+        lcd->cursorRow = 0;
+        return;
+    }
+#endif
     LCD_SendCmd(lcd, LCD_CMD_CLEAR);
 }
 
@@ -154,6 +308,13 @@ void LCD_Clear(LCD_I2C_Handle_t *lcd)
  */
 void LCD_Home(LCD_I2C_Handle_t *lcd)
 {
+#if LCD_I2C_BUFFER_ENABLE
+    if (lcd->buffered) {
+        lcd->cursorCol = 0;
+        lcd->cursorRow = 0;
+        return;
+    }
+#endif
     LCD_SendCmd(lcd, LCD_CMD_HOME);
 }
 
@@ -164,6 +325,16 @@ void LCD_SetCursor(LCD_I2C_Handle_t *lcd, uint8_t col, uint8_t row)
 {
     uint8_t address;
     
+#if LCD_I2C_BUFFER_ENABLE
+    if (lcd->buffered) {
+        if ((row < lcd->rows) && (col < lcd->cols)) {
+            lcd->cursorCol = col;
+            lcd->cursorRow = row;
+        }
+        return;
+    }
+#endif
+
     /* Calculate DDRAM address based on row */
     switch (row) {
         case 0: address = 0x00 + col; break;  /* Row 1 */
@@ -181,6 +352,12 @@ void LCD_SetCursor(LCD_I2C_Handle_t *lcd, uint8_t col, uint8_t row)
  */
 void LCD_PutChar(LCD_I2C_Handle_t *lcd, char ch)
 {
+#if LCD_I2C_BUFFER_ENABLE
+    if (lcd->buffered) {
+        LCD_BufferPut(lcd, ch);
+        return;
+    }
+#endif
     LCD_SendData(lcd, (uint8_t)ch);
 }
 
@@ -189,6 +366,14 @@ void LCD_PutChar(LCD_I2C_Handle_t *lcd, char ch)
  */
 void LCD_Print(LCD_I2C_Handle_t *lcd, const char *str)
 {
+#if LCD_I2C_BUFFER_ENABLE
+    if (lcd->buffered) {
+        while (*str) {
+            LCD_BufferPut(lcd, *str++);
+        }
+        return;
+    }
+#endif
     while (*str) {
         LCD_SendData(lcd, *str++);
     }
@@ -215,8 +400,15 @@ void LCD_Printf(LCD_I2C_Handle_t *lcd, const char *format, ...)
 void LCD_BacklightOn(LCD_I2C_Handle_t *lcd)
 {
     lcd->backlight = 1;
+#if LCD_I2C_BUFFER_ENABLE
+    if (lcd->buffered) {
+        lcd->backlightDirty = true;
+        return;
+    }
+#endif
     uint8_t data = LCD_BIT_BL;
     
+    LCD_WaitReady();
     I2C_MasterStart(lcd->i2cBase, lcd->address, I2C_WRITE);
     I2C_MasterSend(lcd->i2cBase, &data, 1, true);
 }
@@ -227,8 +419,15 @@ void LCD_BacklightOn(LCD_I2C_Handle_t *lcd)
 void LCD_BacklightOff(LCD_I2C_Handle_t *lcd)
 {
     lcd->backlight = 0;
+#if LCD_I2C_BUFFER_ENABLE
+    if (lcd->buffered) {
+        lcd->backlightDirty = true;
+        return;
+    }
+#endif
     uint8_t data = 0x00;
     
+    LCD_WaitReady();
     I2C_MasterStart(lcd->i2cBase, lcd->address, I2C_WRITE);
     I2C_MasterSend(lcd->i2cBase, &data, 1, true);
 }
@@ -249,3 +448,100 @@ void LCD_CreateChar(LCD_I2C_Handle_t *lcd, uint8_t location, uint8_t charmap[])
     /* Return to DDRAM */
     LCD_SendCmd(lcd, LCD_CMD_DDRAM_ADDR);
 }
+
+#if LCD_I2C_BUFFER_ENABLE
+/**
+ * @brief Switch the handle to framebuffer mode
+ */
+void LCD_EnableBuffer(LCD_I2C_Handle_t *lcd)
+{
+    memset(lcd->frame, ' ', sizeof(lcd->frame));
+    memset(lcd->shown, ' ', sizeof(lcd->shown));
+    lcd->cursorCol = 0;
+    lcd->cursorRow = 0;
+    lcd->resync = true;
+    lcd->backlightDirty = false;
+    memset(&lcd->transfer, 0, sizeof(lcd->transfer));
+    lcd->transfer.status = I2C_STATUS_SUCCESS;
+    lcd->buffered = true;
+}
+
+/**
+ * @brief Send changed cells to the panel
+ */
+LCD_Status_t LCD_Flush(LCD_I2C_Handle_t *lcd)
+{
+    uint32_t len = 0;
+    uint8_t row;
+    uint8_t col;
+
+    if (!lcd->buffered) {
+        return LCD_STATUS_ERROR;
+    }
+
+    if ((lcd->transfer.status == I2C_STATUS_BUSY) || s_lcdTimerBusy) {
+        return LCD_STATUS_BUSY;
+    }
+
+    /* Last flush was not acknowledged: panel content unknown */
+    if (lcd->transfer.status != I2C_STATUS_SUCCESS) {
+        lcd->resync = true;
+    }
+
+    for (row = 0; row < lcd->rows; row++) {
+        col = 0;
+        while (col < lcd->cols) {
+            if (!LCD_CellDirty(lcd, row, col)) {
+                col++;
+                continue;
+            }
+
+            /* One DDRAM address per run; a single clean cell inside a run is
+             * resent, it costs the same 4 bytes as a new address command */
+            len += LCD_PackByte(lcd, &lcd->stream[len], LCD_CMD_DDRAM_ADDR | (s_lcdRowOffset[row] + col), 0);
+            while ((col < lcd->cols) &&
+                   (LCD_CellDirty(lcd, row, col) ||
+                    (((col + 1) < lcd->cols) && LCD_CellDirty(lcd, row, col + 1)))) {
+                len += LCD_PackByte(lcd, &lcd->stream[len], (uint8_t)lcd->frame[row][col], 1);
+                lcd->shown[row][col] = lcd->frame[row][col];
+                col++;
+            }
+        }
+    }
+
+    /* Backlight bit rides on every byte; alone it needs one PCF8574 write */
+    if ((len == 0) && lcd->backlightDirty) {
+        lcd->stream[0] = lcd->backlight ? LCD_BIT_BL : 0;
+        len = 1;
+    }
+
+    lcd->resync = false;
+    lcd->backlightDirty = false;
+
+    if (len == 0) {
+        return LCD_STATUS_SUCCESS;
+    }
+
+    lcd->transfer.slaveAddress = lcd->address;
+    lcd->transfer.direction = I2C_WRITE;
+    lcd->transfer.regSize = 0;
+    lcd->transfer.txBuff = lcd->stream;
+    lcd->transfer.size = len;
+    lcd->transfer.sendStop = true;
+
+    if (I2C_MasterSubmit(lcd->i2cBase, &lcd->transfer) != I2C_STATUS_SUCCESS) {
+        lcd->resync = true;
+        return LCD_STATUS_ERROR;
+    }
+
+    return LCD_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Check whether a flush is still on the bus
+ */
+bool LCD_IsFlushBusy(const LCD_I2C_Handle_t *lcd)
+{
+    return lcd->buffered && (lcd->transfer.status == I2C_STATUS_BUSY);
+}
+#endif
@@ -19,6 +19,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "i2c_reg.h"
+#include "i2c.h"
 
 /*******************************************************************************
  * Definitions
@@ -43,10 +44,40 @@
 #define LCD_CMD_CGRAM_ADDR      0x40    /* Set CGRAM address */
 #define LCD_CMD_DDRAM_ADDR      0x80    /* Set DDRAM address */
 
+/* HD44780 execution times (us) */
+#define LCD_POWER_UP_US         50000   /* After VCC rises to 4.5 V */
+#define LCD_FUNCTION_SET_US     4100    /* First 8-bit function set */
+#define LCD_INIT_STEP_US        150     /* Remaining init nibbles */
+#define LCD_CLEAR_HOME_US       2000    /* CLEAR / HOME (1.52 ms typ.) */
+
+/* Shadow framebuffer + async LCD_Flush() (0 = direct mode only) */
+#ifndef LCD_I2C_BUFFER_ENABLE
+#define LCD_I2C_BUFFER_ENABLE   (1U)
+#endif
+
+/* Largest supported panel (20x4) */
+#define LCD_MAX_ROWS            4
+#define LCD_MAX_COLS            20
+
+/* PCF8574 bytes per HD44780 byte in 4-bit mode (EN high/low per nibble) */
+#define LCD_BYTES_PER_WRITE     4
+
+/* Flush stream worst case: every row = DDRAM address + all columns */
+#define LCD_STREAM_SIZE         (LCD_MAX_ROWS * (LCD_MAX_COLS + 1) * LCD_BYTES_PER_WRITE)
+
 /*******************************************************************************
  * Type Definitions
  ******************************************************************************/
 
+/**
+ * @brief LCD status codes
+ */
+typedef enum {
+    LCD_STATUS_SUCCESS = 0,     /**< Flush queued or nothing to send */
+    LCD_STATUS_BUSY,            /**< Previous flush / command delay still running */
+    LCD_STATUS_ERROR            /**< Not buffered / I2C submit failed */
+} LCD_Status_t;
+
 /**
  * @brief LCD handle structure
  */
@@ -56,12 +87,53 @@ typedef struct {
     uint8_t backlight;          /**< Backlight state: 0=Off, 1=On */
     uint8_t rows;               /**< Number of rows (2 or 4) */
     uint8_t cols;               /**< Number of columns (16 or 20) */
+#if LCD_I2C_BUFFER_ENABLE
+    bool buffered;                              /**< LCD_EnableBuffer() done */
+    bool resync;                                /**< Resend every cell on next flush */
+    bool backlightDirty;                        /**< Backlight changed since last flush */
+    uint8_t cursorCol;                          /**< Framebuffer cursor column */
+    uint8_t cursorRow;                          /**< Framebuffer cursor row */
+    char frame[LCD_MAX_ROWS][LCD_MAX_COLS];     /**< Wanted content (RAM only) */
+    char shown[LCD_MAX_ROWS][LCD_MAX_COLS];     /**< Content last sent to the panel */
+    uint8_t stream[LCD_STREAM_SIZE];            /**< Packed PCF8574 bytes of a flush */
+    I2C_Transfer_t transfer;                    /**< Async I2C descriptor of a flush */
+#endif
 } LCD_I2C_Handle_t;
 
 /*******************************************************************************
  * API Functions
  ******************************************************************************/
 
+/**
+ * @brief Use an LPIT channel for LCD command timing
+ * @details Long waits (power-up, init, CLEAR / HOME) become a one-shot
+ *          LPIT deadline instead of a busy loop: the command returns at
+ *          once and only the next LCD access waits (WFI) if the deadline
+ *          has not passed yet. Timing follows the LPIT functional clock, so
+ *          it stays correct when the core clock changes.
+ *          Without a timer the calibrated software loops are used.
+ * @param lpitChannel LPIT channel (0-3), shared by all LCD handles
+ * @return LCD_STATUS_SUCCESS, LCD_STATUS_ERROR if the channel cannot be configured
+ * @note Call after LPIT_Init() and before LCD_Init / LCD_InitEx. Enable the
+ *       channel IRQ and call LPIT_IRQHandler(channel) from its handler.
+ *
+ * @code
+ * LPIT_Init(LPIT_CLK_SRC_SIRC);
+ * NVIC_EnableIRQ(LPIT0_Ch3_IRQn);
+ * LCD_AttachTimer(3);
+ * LCD_InitEx(&lcd, LPI2C0, 0x27, 2, 16);   // 50 ms power-up without busy loop
+ *
+ * void LPIT0_Ch3_IRQHandler(void) { LPIT_IRQHandler(3); }
+ * @endcode
+ */
+LCD_Status_t LCD_AttachTimer(uint8_t lpitChannel);
+
+/**
+ * @brief Check whether the LCD can take the next command / flush
+ * @return false while a CLEAR / HOME / init delay is still running
+ */
+bool LCD_IsReady(void);
+
 /**
  * @brief Initialize LCD with default configuration (16x2, address 0x27)
  * @param lcd Pointer to LCD handle structure
@@ -156,4 +228,55 @@ void LCD_BacklightOff(LCD_I2C_Handle_t *lcd);
  */
 void LCD_CreateChar(LCD_I2C_Handle_t *lcd, uint8_t location, uint8_t charmap[]);
 
+#if LCD_I2C_BUFFER_ENABLE
+/**
+ * @brief Switch the handle to framebuffer mode
+ * @details Afterwards LCD_Clear, LCD_Home, LCD_SetCursor, LCD_PutChar,
+ *          LCD_Print, LCD_Printf and the backlight functions only update RAM;
+ *          LCD_Flush() sends the changes. The framebuffer starts blank and
+ *          the first flush rewrites every cell.
+ * @param lcd Pointer to LCD handle (after LCD_Init / LCD_InitEx)
+ * @note Call I2C_MasterEnableAsync() on the bus first and do LCD_CreateChar
+ *       before this: the direct (blocking) functions must not run while
+ *       async transfers are queued.
+ *
+ * @code
+ * LCD_InitEx(&lcd, LPI2C0, 0x27, 2, 16);
+ * I2C_MasterEnableAsync(LPI2C0);
+ * LCD_EnableBuffer(&lcd);
+ *
+ * while (1) {
+ *     LCD_SetCursor(&lcd, 0, 1);
+ *     LCD_Printf(&lcd, "Count: %03d", count);   // RAM only
+ *     LCD_Flush(&lcd);                           // only "Count" digits that changed
+ * }
+ * @endcode
+ */
+void LCD_EnableBuffer(LCD_I2C_Handle_t *lcd);
+
+/**
+ * @brief Send changed cells to the panel (non-blocking)
+ * @details Compares the framebuffer with what was last sent and packs each
+ *          changed run as DDRAM address + characters into one I2C write
+ *          (4 PCF8574 bytes per HD44780 byte), submitted to the async I2C
+ *          engine. Returns at once; the CPU cost is the comparison + packing.
+ * @param lcd Pointer to LCD handle
+ * @return LCD_STATUS_SUCCESS, LCD_STATUS_BUSY while the previous flush is on
+ *         the bus or a CLEAR / HOME delay runs (call again later),
+ *         LCD_STATUS_ERROR if not buffered or
+ *         the submit failed
+ * @note Bus <= 400 kHz: one PCF8574 byte then lasts longer than the
+ *       HD44780 execution time (37 us per 4 bytes), so no delays are needed.
+ *       A failed flush (NACK) makes the next one resend everything.
+ */
+LCD_Status_t LCD_Flush(LCD_I2C_Handle_t *lcd);
+
+/**
+ * @brief Check whether a flush is still on the bus
+ * @param lcd Pointer to LCD handle
+ * @return true while the last LCD_Flush() transfer is running
+ */
+bool LCD_IsFlushBusy(const LCD_I2C_Handle_t *lcd);
+#endif
+
 #endif /* LCD_I2C_H */
\ No newline at end of file
@@ -7,6 +7,8 @@
 #include "lib/hal/adc/adc.h"
 #include "lib/hal/lpit/lpit.h"
 #include "lib/hal/pcc/pcc.h"
+#include "lib/hal/scg/scg.h"
+#include "lib/hal/nvic/nvic.h"
 #include <string.h>
 
 /*******************************************************************************
@@ -16,14 +18,30 @@ static touch_channel_t s_touch_channels[TOUCH_MAX_CHANNELS];
 static touch_system_config_t s_system_config;
 static bool s_is_initialized = false;
 static bool s_is_scanning = false;
-static uint8_t s_current_scan_channel = 0;
+
+/* PDB scan engine: frame n = s_touch_frames[n * num_channels + slot], slot = channel_id */
+static uint16_t s_touch_frames[2U * TOUCH_MAX_CHANNELS];
+static const uint16_t *volatile s_touch_ready_frame = NULL;
+static volatile uint32_t s_touch_dropped_frames = 0U;
+static uint32_t s_touch_frame_count = 0U;
+
+/* Adaptive scan: full rate while active, guard channel only while idle */
+static touch_scan_mode_t s_scan_mode = TOUCH_SCAN_FULL;
+static uint16_t s_idle_frames = 0U;
 
 /*******************************************************************************
  * Private Function Prototypes
  ******************************************************************************/
 static void TOUCH_ProcessChannel(uint8_t channel_id);
-static void TOUCH_UpdateBaseline(uint8_t channel_id);
-static void TOUCH_ADC_Callback(uint8_t adc_channel, uint16_t raw_value);
+static void TOUCH_UpdateBaseline(uint8_t channel_id, uint16_t sample);
+static void TOUCH_SetBaseline(touch_channel_t *ch, uint16_t baseline);
+static uint16_t TOUCH_MedianFilter(touch_channel_t *ch, uint16_t raw);
+static void TOUCH_FrameCallback(ADC_Instance_t instance, const uint16_t *block,
+                                uint16_t count, void *userData);
+static touch_status_t TOUCH_StartPdbScan(touch_scan_mode_t mode);
+static void TOUCH_StopPdbScan(void);
+static void TOUCH_ProcessFrame(const uint16_t *frame);
+static void TOUCH_ProcessGuardFrame(const uint16_t *frame);
 
 /*******************************************************************************
  * Public Functions
@@ -31,7 +49,8 @@ static void TOUCH_ADC_Callback(uint8_t adc_channel, uint16_t raw_value);
 
 touch_status_t TOUCH_Init(const touch_system_config_t *config)
 {
-    if (config == NULL || config->num_channels > TOUCH_MAX_CHANNELS) {
+    if (config == NULL || config->num_channels > TOUCH_MAX_CHANNELS ||
+        (config->idle_timeout_frames != 0U && config->guard_channel >= config->num_channels)) {
         return TOUCH_STATUS_INVALID_PARAM;
     }
     
@@ -41,23 +60,26 @@ touch_status_t TOUCH_Init(const touch_system_config_t *config)
     /* Save configuration */
     memcpy(&s_system_config, config, sizeof(touch_system_config_t));
     
-    /* Initialize ADC based on trigger mode */
-    if (config->trigger_mode == TOUCH_TRIGGER_SW) {
-        ADC_Init(ADC_INSTANCE_0, NULL);  /* SW trigger mode */
-    } else if (config->trigger_mode == TOUCH_TRIGGER_HW_PDB) {
-        /* Configure ADC for PDB trigger */
-        adc_config_t adc_cfg = {
-            .trigger_mode = ADC_TRIGGER_PDB,
-            .resolution = ADC_RESOLUTION_12BIT,
-            .clock_div = ADC_CLK_DIV_1,
-            .enable_dma = false
-        };
-        ADC_Init(ADC_INSTANCE_0, &adc_cfg);
-        
-        /* Configure PDB for periodic trigger */
-        ADC_ConfigPDB(config->scan_period_us);
+    /* ADC0, software trigger; PDB mode switches to hardware trigger in TOUCH_StartScan() */
+    ADC_Config_t adc_cfg = {
+        .clockSource = ADC_CLK_ALT1,
+        .resolution = ADC_RESOLUTION_12BIT,
+        .clockDivider = ADC_CLK_DIV_1,
+        .voltageRef = ADC_VREF_VREFH_VREFL,
+        .triggerSource = ADC_TRIGGER_SOFTWARE,
+        .continuousMode = false,
+        .dmaEnable = false,
+        .interruptEnable = false     /* COCO must reach the DMA in PDB mode */
+    };
+    
+    if (ADC_Init(ADC_INSTANCE_0, &adc_cfg) != ADC_STATUS_SUCCESS) {
+        return TOUCH_STATUS_ERROR;
     }
     
+    s_touch_ready_frame = NULL;
+    s_touch_dropped_frames = 0U;
+    s_touch_frame_count = 0U;
+    
     s_is_initialized = true;
     return TOUCH_STATUS_SUCCESS;
 }
@@ -68,10 +90,20 @@ touch_status_t TOUCH_ConfigChannel(uint8_t channel_id, const touch_channel_confi
         return TOUCH_STATUS_INVALID_PARAM;
     }
     
+    if (config->baseline_shift > TOUCH_BASELINE_SHIFT_MAX ||
+        config->median_window > TOUCH_MEDIAN_MAX ||
+        (config->median_window > 1U && (config->median_window & 1U) == 0U)) {
+        return TOUCH_STATUS_INVALID_PARAM;
+    }
+    
     touch_channel_t *ch = &s_touch_channels[channel_id];
     
     ch->adc_channel = config->adc_channel;
-    ch->baseline = config->baseline;
+    TOUCH_SetBaseline(ch, config->baseline);
+    ch->baseline_shift = (config->baseline_shift != 0U) ? config->baseline_shift : TOUCH_BASELINE_SHIFT_DEFAULT;
+    ch->median_window = (config->median_window > 1U) ? config->median_window : 1U;
+    ch->median_index = 0;
+    ch->median_fill = 0;
     ch->threshold = config->threshold;
     ch->debounce_count = config->debounce_count;
     ch->drift_comp_enabled = config->enable_drift_compensation;
@@ -87,19 +119,41 @@ touch_status_t TOUCH_CalibrateChannel(uint8_t channel_id, uint16_t num_samples)
         return TOUCH_STATUS_INVALID_PARAM;
     }
     
+    if (num_samples == 0U) {
+        return TOUCH_STATUS_INVALID_PARAM;
+    }
+    
     touch_channel_t *ch = &s_touch_channels[channel_id];
     uint32_t sum = 0;
+    uint16_t raw;
+    
+    /* PDB scan running: collect samples from the frames in TOUCH_Process() */
+    if (s_is_scanning && s_system_config.trigger_mode == TOUCH_TRIGGER_HW_PDB) {
+        ch->cal_sum = 0U;
+        ch->cal_samples = num_samples;
+        ch->cal_remaining = num_samples;
+        ch->state = TOUCH_STATE_CALIBRATING;
+        
+        /* Guard scan does not sample this channel */
+        if (s_scan_mode == TOUCH_SCAN_GUARD) {
+            TOUCH_StopPdbScan();
+            return TOUCH_StartPdbScan(TOUCH_SCAN_FULL);
+        }
+        return TOUCH_STATUS_SUCCESS;
+    }
     
     ch->state = TOUCH_STATE_CALIBRATING;
     
     /* Take multiple samples and average */
     for (uint16_t i = 0; i < num_samples; i++) {
-        ADC_StartConversion(ADC_INSTANCE_0, ch->adc_channel);
-        while (!ADC_IsConversionComplete(ADC_INSTANCE_0));
-        sum += ADC_GetConversionResult(ADC_INSTANCE_0);
+        if (ADC_ReadBlocking(ADC_INSTANCE_0, (ADC_Channel_t)ch->adc_channel, &raw) != ADC_STATUS_SUCCESS) {
+            ch->state = TOUCH_STATE_IDLE;
+            return TOUCH_STATUS_ERROR;
+        }
+        sum += raw;
     }
     
-    ch->baseline = sum / num_samples;
+    TOUCH_SetBaseline(ch, (uint16_t)(sum / num_samples));
     ch->state = TOUCH_STATE_IDLE;
     
     return TOUCH_STATUS_SUCCESS;
@@ -126,8 +180,15 @@ touch_status_t TOUCH_StartScan(void)
         return TOUCH_STATUS_NOT_INITIALIZED;
     }
     
+    if (s_is_scanning) {
+        return TOUCH_STATUS_BUSY;
+    }
+    
     if (s_system_config.trigger_mode == TOUCH_TRIGGER_HW_PDB) {
-        ADC_StartPDB();
+        touch_status_t status = TOUCH_StartPdbScan(TOUCH_SCAN_FULL);
+        if (status != TOUCH_STATUS_SUCCESS) {
+            return status;
+        }
     }
     
     s_is_scanning = true;
@@ -140,11 +201,12 @@ touch_status_t TOUCH_StopScan(void)
         return TOUCH_STATUS_NOT_INITIALIZED;
     }
     
-    if (s_system_config.trigger_mode == TOUCH_TRIGGER_HW_PDB) {
-        ADC_StopPDB();
+    if (s_system_config.trigger_mode == TOUCH_TRIGGER_HW_PDB && s_is_scanning) {
+        TOUCH_StopPdbScan();
     }
     
     s_is_scanning = false;
+    s_touch_ready_frame = NULL;
     return TOUCH_STATUS_SUCCESS;
 }
 
@@ -159,12 +221,32 @@ touch_status_t TOUCH_Process(void)
         for (uint8_t i = 0; i < s_system_config.num_channels; i++) {
             touch_channel_t *ch = &s_touch_channels[i];
             if (ch->adc_channel != 0) {
-                ADC_StartConversion(ADC_INSTANCE_0, ch->adc_channel);
-                while (!ADC_IsConversionComplete(ADC_INSTANCE_0));
-                ch->raw_value = ADC_GetConversionResult(ADC_INSTANCE_0);
+                if (ADC_ReadBlocking(ADC_INSTANCE_0, (ADC_Channel_t)ch->adc_channel,
+                                     &ch->raw_value) != ADC_STATUS_SUCCESS) {
+                    return TOUCH_STATUS_ERROR;
+                }
                 TOUCH_ProcessChannel(i);
             }
         }
+        s_touch_frame_count++;
+    } else if (s_system_config.trigger_mode == TOUCH_TRIGGER_HW_PDB) {
+        const uint16_t *frame;
+        uint32_t primask;
+        
+        primask = NVIC_DisableGlobalIRQ();
+        frame = s_touch_ready_frame;
+        s_touch_ready_frame = NULL;
+        NVIC_EnableGlobalIRQ(primask);
+        
+        if (frame == NULL) {
+            return TOUCH_STATUS_SUCCESS;
+        }
+        
+        if (s_scan_mode == TOUCH_SCAN_GUARD) {
+            TOUCH_ProcessGuardFrame(frame);
+        } else {
+            TOUCH_ProcessFrame(frame);
+        }
     }
     
     return TOUCH_STATUS_SUCCESS;
@@ -176,7 +258,7 @@ touch_status_t TOUCH_GetChannelState(uint8_t channel_id, touch_state_t *state)
         return TOUCH_STATUS_INVALID_PARAM;
     }
     
-    *state = s_touch_channels[channel_id].state;
+    *state = (touch_state_t)s_touch_channels[channel_id].state;
     return TOUCH_STATUS_SUCCESS;
 }
 
@@ -230,20 +312,189 @@ touch_status_t TOUCH_SetDriftCompensation(uint8_t channel_id, bool enable)
     return TOUCH_STATUS_SUCCESS;
 }
 
+touch_scan_mode_t TOUCH_GetScanMode(void)
+{
+    return s_scan_mode;
+}
+
+uint32_t TOUCH_GetFrameCount(void)
+{
+    return s_touch_frame_count;
+}
+
+uint32_t TOUCH_GetDroppedFrames(void)
+{
+    return s_touch_dropped_frames + ADC_GetDmaStreamOverruns(ADC_INSTANCE_0);
+}
+
 /*******************************************************************************
  * Private Functions
  ******************************************************************************/
 
+static touch_status_t TOUCH_StartPdbScan(touch_scan_mode_t mode)
+{
+    static const uint8_t mult_values[] = {1U, 10U, 20U, 40U};
+    ADC_Channel_t slots[TOUCH_MAX_CHANNELS];
+    ADC_ScanGroupConfig_t group;
+    uint8_t num = s_system_config.num_channels;
+    uint32_t period_us = s_system_config.scan_period_us;
+    uint64_t counts;
+    uint64_t divided = 0U;
+    uint32_t prescaler = 0U;
+    uint32_t mult;
+    
+    if (mode == TOUCH_SCAN_GUARD) {
+        num = 1U;
+        period_us = s_system_config.idle_period_us;
+    }
+    
+    if (num == 0U || period_us == 0U) {
+        return TOUCH_STATUS_INVALID_PARAM;
+    }
+    
+    /* Slot i = channel i: the frame is indexed by channel_id, no lookup */
+    if (mode == TOUCH_SCAN_GUARD) {
+        slots[0] = (ADC_Channel_t)s_touch_channels[s_system_config.guard_channel].adc_channel;
+    } else {
+        for (uint8_t i = 0; i < num; i++) {
+            slots[i] = (ADC_Channel_t)s_touch_channels[i].adc_channel;
+        }
+    }
+    
+    /* PDB counts at bus clock: smallest prescaler x multiplier that fits MOD */
+    counts = ((uint64_t)SCG_GetBusClockFreq() * period_us) / 1000000U;
+    for (mult = 0U; mult < sizeof(mult_values); mult++) {
+        for (prescaler = 0U; prescaler <= (uint32_t)PDB_PRESCALER_128; prescaler++) {
+            divided = (counts / mult_values[mult]) >> prescaler;
+            if (divided <= 0xFFFFU) {
+                break;
+            }
+        }
+        if (prescaler <= (uint32_t)PDB_PRESCALER_128) {
+            break;
+        }
+    }
+    if (mult >= sizeof(mult_values) || divided == 0U) {
+        return TOUCH_STATUS_INVALID_PARAM;
+    }
+    
+    memset(&group, 0, sizeof(group));
+    group.channels[0] = slots;
+    group.numChannels[0] = num;
+    group.prescaler = (pdb_prescaler_t)prescaler;
+    group.multFactor = (pdb_mult_t)mult;
+    group.modulus = (uint16_t)divided;
+    group.delay = 0U;
+    group.triggerSource = PDB_TRIGGER_SOFTWARE;
+    group.continuousMode = true;
+    
+    if (ADC_ConfigScanGroup(&group) != ADC_STATUS_SUCCESS) {
+        return TOUCH_STATUS_ERROR;
+    }
+    
+    if (ADC_StartScanGroupDma(ADC_INSTANCE_0, s_system_config.dma_channel, s_touch_frames,
+                              TOUCH_FrameCallback, NULL) != ADC_STATUS_SUCCESS) {
+        ADC_StopScanGroup();
+        return TOUCH_STATUS_ERROR;
+    }
+    
+    s_touch_ready_frame = NULL;
+    s_scan_mode = mode;
+    s_idle_frames = 0U;
+    
+    /* Continuous mode: one software trigger starts the periodic scan */
+    ADC_StartScanGroup();
+    
+    return TOUCH_STATUS_SUCCESS;
+}
+
+static void TOUCH_StopPdbScan(void)
+{
+    ADC_StopDmaStream(ADC_INSTANCE_0);
+    ADC_StopScanGroup();
+    s_touch_ready_frame = NULL;
+}
+
+static void TOUCH_ProcessGuardFrame(const uint16_t *frame)
+{
+    touch_channel_t *ch = &s_touch_channels[s_system_config.guard_channel];
+    
+    ch->raw_value = frame[0];
+    s_touch_frame_count++;
+    
+    /* Activity: back to full rate, the next frames do the real detection */
+    if ((int32_t)ch->baseline - (int32_t)ch->raw_value > (int32_t)ch->threshold) {
+        TOUCH_StopPdbScan();
+        if (TOUCH_StartPdbScan(TOUCH_SCAN_FULL) != TOUCH_STATUS_SUCCESS) {
+            s_is_scanning = false;
+        }
+        return;
+    }
+    
+    if (ch->drift_comp_enabled) {
+        TOUCH_UpdateBaseline(s_system_config.guard_channel, ch->raw_value);
+    }
+}
+
+static void TOUCH_ProcessFrame(const uint16_t *frame)
+{
+    bool active = false;
+    
+    for (uint8_t i = 0; i < s_system_config.num_channels; i++) {
+        touch_channel_t *ch = &s_touch_channels[i];
+        
+        if (ch->adc_channel == 0) {
+            continue;
+        }
+        
+        ch->raw_value = frame[i];
+        
+        if (ch->cal_remaining != 0U) {
+            ch->cal_sum += ch->raw_value;
+            ch->cal_remaining--;
+            if (ch->cal_remaining == 0U) {
+                TOUCH_SetBaseline(ch, (uint16_t)(ch->cal_sum / ch->cal_samples));
+                ch->state = TOUCH_STATE_IDLE;
+                ch->debounce_counter = 0;
+            }
+            active = true;
+            continue;
+        }
+        
+        TOUCH_ProcessChannel(i);
+        if (ch->state != TOUCH_STATE_IDLE || ch->debounce_counter != 0U) {
+            active = true;
+        }
+    }
+    
+    s_touch_frame_count++;
+    
+    if (s_system_config.idle_timeout_frames == 0U) {
+        return;
+    }
+    
+    /* Nothing touched for idle_timeout_frames: drop to the guard scan */
+    s_idle_frames = active ? 0U : (uint16_t)(s_idle_frames + 1U);
+    if (s_idle_frames >= s_system_config.idle_timeout_frames) {
+        TOUCH_StopPdbScan();
+        if (TOUCH_StartPdbScan(TOUCH_SCAN_GUARD) != TOUCH_STATUS_SUCCESS &&
+            TOUCH_StartPdbScan(TOUCH_SCAN_FULL) != TOUCH_STATUS_SUCCESS) {
+            s_is_scanning = false;
+        }
+    }
+}
+
 static void TOUCH_ProcessChannel(uint8_t channel_id)
 {
     touch_channel_t *ch = &s_touch_channels[channel_id];
+    uint16_t sample = TOUCH_MedianFilter(ch, ch->raw_value);
     
     /* Calculate delta from baseline */
-    ch->delta = (int16_t)ch->baseline - (int16_t)ch->raw_value;
+    ch->delta = (int16_t)ch->baseline - (int16_t)sample;
     
     /* Apply drift compensation */
     if (ch->drift_comp_enabled && ch->state == TOUCH_STATE_IDLE) {
-        TOUCH_UpdateBaseline(channel_id);
+        TOUCH_UpdateBaseline(channel_id, sample);
     }
     
     /* Touch detection with debouncing */
@@ -257,7 +508,7 @@ static void TOUCH_ProcessChannel(uint8_t channel_id)
                 
                 /* Trigger callback */
                 if (s_system_config.callback != NULL) {
-                    s_system_config.callback(channel_id, ch->state, ch->delta);
+                    s_system_config.callback(channel_id, (touch_state_t)ch->state, ch->delta);
                 }
             }
         }
@@ -271,7 +522,7 @@ static void TOUCH_ProcessChannel(uint8_t channel_id)
                 
                 /* Trigger callback */
                 if (s_system_config.callback != NULL) {
-                    s_system_config.callback(channel_id, ch->state, ch->delta);
+                    s_system_config.callback(channel_id, (touch_state_t)ch->state, ch->delta);
                 }
                 
                 ch->state = TOUCH_STATE_IDLE;
@@ -282,24 +533,67 @@ static void TOUCH_ProcessChannel(uint8_t channel_id)
     }
 }
 
-static void TOUCH_UpdateBaseline(uint8_t channel_id)
+static void TOUCH_UpdateBaseline(uint8_t channel_id, uint16_t sample)
 {
     touch_channel_t *ch = &s_touch_channels[channel_id];
     
-    /* Slow baseline drift compensation (IIR filter) */
-    /* baseline = baseline * 0.99 + raw_value * 0.01 */
-    uint32_t new_baseline = ((uint32_t)ch->baseline * 99 + (uint32_t)ch->raw_value) / 100;
-    ch->baseline = (uint16_t)new_baseline;
+    /* Slow baseline drift compensation (IIR filter, shift only):
+     * acc += (sample - baseline) / 2^shift, acc = baseline << 8 keeps the
+     * fraction so steps smaller than 1 LSB still accumulate */
+    int32_t error = ((int32_t)sample << TOUCH_BASELINE_FRAC_BITS) - (int32_t)ch->baseline_acc;
+    ch->baseline_acc = (uint32_t)((int32_t)ch->baseline_acc + (error >> ch->baseline_shift));
+    ch->baseline = (uint16_t)(ch->baseline_acc >> TOUCH_BASELINE_FRAC_BITS);
 }
 
-static void TOUCH_ADC_Callback(uint8_t adc_channel, uint16_t raw_value)
+static void TOUCH_SetBaseline(touch_channel_t *ch, uint16_t baseline)
 {
-    /* Called from ADC ISR for HW trigger modes */
-    for (uint8_t i = 0; i < s_system_config.num_channels; i++) {
-        if (s_touch_channels[i].adc_channel == adc_channel) {
-            s_touch_channels[i].raw_value = raw_value;
-            TOUCH_ProcessChannel(i);
-            break;
+    ch->baseline = baseline;
+    ch->baseline_acc = (uint32_t)baseline << TOUCH_BASELINE_FRAC_BITS;
+}
+
+static uint16_t TOUCH_MedianFilter(touch_channel_t *ch, uint16_t raw)
+{
+    uint16_t sorted[TOUCH_MEDIAN_MAX];
+    uint8_t n;
+    
+    if (ch->median_window <= 1U) {
+        return raw;
+    }
+    
+    ch->median_buf[ch->median_index] = raw;
+    ch->median_index++;
+    if (ch->median_index >= ch->median_window) {
+        ch->median_index = 0;
+    }
+    if (ch->median_fill < ch->median_window) {
+        ch->median_fill++;
+    }
+    
+    /* Insertion sort of at most 5 samples, cheaper than a divide */
+    n = ch->median_fill;
+    for (uint8_t i = 0; i < n; i++) {
+        uint16_t v = ch->median_buf[i];
+        uint8_t j = i;
+        while (j > 0U && sorted[j - 1U] > v) {
+            sorted[j] = sorted[j - 1U];
+            j--;
         }
+        sorted[j] = v;
+    }
+    
+    return sorted[n >> 1];
+}
+
+static void TOUCH_FrameCallback(ADC_Instance_t instance, const uint16_t *block,
+                                uint16_t count, void *userData)
+{
+    (void)instance;
+    (void)count;
+    (void)userData;
+    
+    /* DMA ISR, once per frame: only hand the frame over to TOUCH_Process() */
+    if (s_touch_ready_frame != NULL) {
+        s_touch_dropped_frames++;
     }
+    s_touch_ready_frame = block;
 }
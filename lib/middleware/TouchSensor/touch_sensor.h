@@ -6,6 +6,8 @@
  *          - Baseline calibration and drift compensation
  *          - Touch threshold and debouncing
  *          - Support for both polling and interrupt modes
+ *          - PDB + eDMA scan engine: one interrupt per frame of all channels,
+ *            processing deferred to TOUCH_Process()
  * 
  * @author  PhucPH32
  * @date    14/12/2025
@@ -25,8 +27,20 @@
  * Definitions
  ******************************************************************************/
 
-/** @brief Maximum number of touch channels */
-#define TOUCH_MAX_CHANNELS          (8U)
+/** @brief Maximum number of touch channels (one ADC0 SC1 slot each in PDB mode) */
+#define TOUCH_MAX_CHANNELS          (16U)
+
+/** @brief Default drift filter coefficient: baseline += (raw - baseline) / 2^7 */
+#define TOUCH_BASELINE_SHIFT_DEFAULT (7U)
+
+/** @brief Maximum drift filter shift (slower than ~1/32768 is not useful) */
+#define TOUCH_BASELINE_SHIFT_MAX    (15U)
+
+/** @brief Fraction bits of the baseline accumulator (baseline << 8) */
+#define TOUCH_BASELINE_FRAC_BITS    (8U)
+
+/** @brief Maximum median filter window (odd, 1 = off) */
+#define TOUCH_MEDIAN_MAX            (5U)
 
 /** @brief Touch sensor states */
 typedef enum {
@@ -52,6 +66,12 @@ typedef enum {
     TOUCH_TRIGGER_HW_PDB            /**< Hardware trigger via PDB */
 } touch_trigger_mode_t;
 
+/** @brief Scan rate selected by the adaptive scheduler */
+typedef enum {
+    TOUCH_SCAN_FULL = 0,            /**< All channels every scan_period_us */
+    TOUCH_SCAN_GUARD                /**< Guard channel only every idle_period_us */
+} touch_scan_mode_t;
+
 /** @brief Touch sensor configuration */
 typedef struct {
     uint8_t adc_channel;            /**< ADC channel for this sensor */
@@ -59,19 +79,37 @@ typedef struct {
     uint16_t threshold;             /**< Touch detection threshold (delta from baseline) */
     uint8_t debounce_count;         /**< Number of samples for debouncing */
     bool enable_drift_compensation; /**< Enable baseline drift compensation */
+    uint8_t baseline_shift;         /**< Drift filter 1/2^shift (0 = TOUCH_BASELINE_SHIFT_DEFAULT) */
+    uint8_t median_window;          /**< Median-of-N pre-filter: 0/1 = off, 3 or 5 */
 } touch_channel_config_t;
 
-/** @brief Touch sensor channel data */
+/**
+ * @brief Touch sensor channel data
+ * @details Field order is the per-sample access order of TOUCH_ProcessChannel():
+ *          the first 16 bytes hold the filter / detection / debounce state
+ *          and the drift flag, the drift shift and median window follow, the
+ *          calibration state and ADC channel come last. 40 bytes, the only
+ *          padding is the last byte.
+ */
 typedef struct {
-    uint8_t adc_channel;            /**< ADC channel */
+    uint32_t baseline_acc;          /**< Baseline << TOUCH_BASELINE_FRAC_BITS (drift filter state) */
     uint16_t raw_value;             /**< Current raw ADC value */
     uint16_t baseline;              /**< Baseline value */
     int16_t delta;                  /**< Delta from baseline */
     uint16_t threshold;             /**< Touch threshold */
-    touch_state_t state;            /**< Current state */
+    uint8_t state;                  /**< Current state (touch_state_t) */
     uint8_t debounce_counter;       /**< Debounce counter */
     uint8_t debounce_count;         /**< Debounce threshold */
     bool drift_comp_enabled;        /**< Drift compensation enabled */
+    uint8_t baseline_shift;         /**< Drift filter coefficient exponent */
+    uint8_t median_window;          /**< Median window (1 = off) */
+    uint8_t median_index;           /**< Next slot in median_buf */
+    uint8_t median_fill;            /**< Valid samples in median_buf */
+    uint16_t median_buf[TOUCH_MEDIAN_MAX]; /**< Last raw samples */
+    uint16_t cal_samples;           /**< Calibration sample count (PDB mode) */
+    uint32_t cal_sum;               /**< Calibration accumulator (PDB mode) */
+    uint16_t cal_remaining;         /**< Calibration samples still to collect */
+    uint8_t adc_channel;            /**< ADC channel */
 } touch_channel_t;
 
 /** @brief Touch sensor callback function type */
@@ -83,6 +121,10 @@ typedef struct {
     uint16_t scan_period_us;            /**< Scan period in microseconds (for HW trigger) */
     uint8_t num_channels;               /**< Number of active channels */
     touch_callback_t callback;          /**< Touch event callback */
+    uint8_t dma_channel;                /**< DMA channel collecting scan frames (HW_PDB mode) */
+    uint8_t guard_channel;              /**< Channel scanned alone while idle (HW_PDB mode) */
+    uint32_t idle_period_us;            /**< Guard scan period while idle */
+    uint16_t idle_timeout_frames;       /**< Idle frames before slow scan (0 = always full rate) */
 } touch_system_config_t;
 
 /*******************************************************************************
@@ -98,7 +140,7 @@ touch_status_t TOUCH_Init(const touch_system_config_t *config);
 
 /**
  * @brief Configure a touch sensor channel
- * @param channel_id Channel index (0-7)
+ * @param channel_id Channel index (0-15)
  * @param config Channel configuration
  * @return touch_status_t Status of operation
  */
@@ -106,7 +148,11 @@ touch_status_t TOUCH_ConfigChannel(uint8_t channel_id, const touch_channel_confi
 
 /**
  * @brief Calibrate baseline for a channel
- * @param channel_id Channel index (0-7)
+ * @details While a PDB scan is running the samples are taken from the scan
+ *          frames in TOUCH_Process() and the call returns immediately; the
+ *          channel stays in TOUCH_STATE_CALIBRATING until done. Otherwise the
+ *          channel is sampled with blocking conversions.
+ * @param channel_id Channel index (0-15)
  * @param num_samples Number of samples to average for baseline
  * @return touch_status_t Status of operation
  */
@@ -121,6 +167,12 @@ touch_status_t TOUCH_CalibrateAll(uint16_t num_samples);
 
 /**
  * @brief Start touch sensor scanning
+ * @details HW_PDB mode: channel i is converted in ADC0 slot i by a
+ *          back-to-back PDB chain every scan_period_us, eDMA writes the
+ *          results into a ping-pong frame buffer indexed by slot. Channels
+ *          must be configured before this call.
+ * @note Enable the DMA channel IRQ in the NVIC and call DMA_IRQHandler()
+ *       from it; ADC0 must not have its conversion interrupt enabled.
  * @return touch_status_t Status of operation
  */
 touch_status_t TOUCH_StartScan(void);
@@ -132,14 +184,16 @@ touch_status_t TOUCH_StartScan(void);
 touch_status_t TOUCH_StopScan(void);
 
 /**
- * @brief Process touch sensor (call in main loop for SW trigger mode)
+ * @brief Process touch sensor (call in main loop)
+ * @details SW mode: scans all channels. HW_PDB mode: processes the latest
+ *          complete frame, if any, and returns immediately otherwise.
  * @return touch_status_t Status of operation
  */
 touch_status_t TOUCH_Process(void);
 
 /**
  * @brief Get touch channel state
- * @param channel_id Channel index (0-7)
+ * @param channel_id Channel index (0-15)
  * @param state Pointer to store state
  * @return touch_status_t Status of operation
  */
@@ -147,7 +201,7 @@ touch_status_t TOUCH_GetChannelState(uint8_t channel_id, touch_state_t *state);
 
 /**
  * @brief Get touch channel delta value
- * @param channel_id Channel index (0-7)
+ * @param channel_id Channel index (0-15)
  * @param delta Pointer to store delta value
  * @return touch_status_t Status of operation
  */
@@ -155,7 +209,7 @@ touch_status_t TOUCH_GetChannelDelta(uint8_t channel_id, int16_t *delta);
 
 /**
  * @brief Get touch channel raw value
- * @param channel_id Channel index (0-7)
+ * @param channel_id Channel index (0-15)
  * @param raw_value Pointer to store raw value
  * @return touch_status_t Status of operation
  */
@@ -170,7 +224,7 @@ touch_status_t TOUCH_RegisterCallback(touch_callback_t callback);
 
 /**
  * @brief Update touch threshold for a channel
- * @param channel_id Channel index (0-7)
+ * @param channel_id Channel index (0-15)
  * @param threshold New threshold value
  * @return touch_status_t Status of operation
  */
@@ -178,10 +232,36 @@ touch_status_t TOUCH_SetThreshold(uint8_t channel_id, uint16_t threshold);
 
 /**
  * @brief Enable/disable drift compensation for a channel
- * @param channel_id Channel index (0-7)
+ * @param channel_id Channel index (0-15)
  * @param enable Enable flag
  * @return touch_status_t Status of operation
  */
 touch_status_t TOUCH_SetDriftCompensation(uint8_t channel_id, bool enable);
 
+/**
+ * @brief Number of scan frames completed before TOUCH_Process() consumed the
+ *        previous one (HW_PDB mode)
+ * @return uint32_t Dropped frame count
+ */
+uint32_t TOUCH_GetDroppedFrames(void);
+
+/**
+ * @brief Number of frames processed since TOUCH_Init()
+ * @details Incremented once per full scan (SW mode) or per frame consumed
+ *          by TOUCH_Process() (HW_PDB mode); lets consumers such as the
+ *          slider engine detect new data.
+ * @return uint32_t Frame counter
+ */
+uint32_t TOUCH_GetFrameCount(void);
+
+/**
+ * @brief Get the current scan rate (HW_PDB mode)
+ * @details With idle_timeout_frames != 0, after that many full-rate frames
+ *          without any channel touched or debouncing the scan drops to the
+ *          guard channel at idle_period_us. A guard delta above its threshold
+ *          returns to full rate in the same TOUCH_Process() call.
+ * @return touch_scan_mode_t Current scan mode
+ */
+touch_scan_mode_t TOUCH_GetScanMode(void);
+
 #endif /* TOUCH_SENSOR_H */
@@ -0,0 +1,239 @@
+/**
+ * @file    touch_slider.c
+ * @brief   Touch Slider / Wheel Position Engine Implementation
+ */
+
+#include "touch_slider.h"
+#include <string.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+
+/** @brief Fraction bits of the interpolated electrode position */
+#define TOUCH_SLIDER_POS_FRAC_BITS  (8U)
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static touch_slider_t s_sliders[TOUCH_SLIDER_MAX_SLIDERS];
+static uint32_t s_slider_scale_q16[TOUCH_SLIDER_MAX_SLIDERS];
+static touch_slider_callback_t s_slider_callback = NULL;
+static uint32_t s_last_frame = 0U;
+
+/*******************************************************************************
+ * Private Function Prototypes
+ ******************************************************************************/
+static void TOUCH_SLIDER_Update(uint8_t slider_id);
+static void TOUCH_SLIDER_Report(uint8_t slider_id);
+static uint16_t TOUCH_SLIDER_Distance(const touch_slider_t *slider, uint16_t a, uint16_t b);
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+touch_status_t TOUCH_SLIDER_Init(uint8_t slider_id, const touch_slider_config_t *config)
+{
+    if (slider_id >= TOUCH_SLIDER_MAX_SLIDERS || config == NULL || config->channels == NULL ||
+        config->resolution == 0U || config->num_channels > TOUCH_SLIDER_MAX_CHANNELS) {
+        return TOUCH_STATUS_INVALID_PARAM;
+    }
+    
+    if (config->num_channels < ((config->type == TOUCH_SLIDER_WHEEL) ? 3U : 2U)) {
+        return TOUCH_STATUS_INVALID_PARAM;
+    }
+    
+    touch_slider_t *slider = &s_sliders[slider_id];
+    uint32_t span;
+    
+    for (uint8_t i = 0; i < config->num_channels; i++) {
+        if (config->channels[i] >= TOUCH_MAX_CHANNELS) {
+            return TOUCH_STATUS_INVALID_PARAM;
+        }
+    }
+    
+    memset(slider, 0, sizeof(touch_slider_t));
+    memcpy(&slider->config, config, sizeof(touch_slider_config_t));
+    memcpy(slider->channels, config->channels, config->num_channels);
+    slider->config.channels = slider->channels;
+    
+    /* Electrode position (Q8) -> output range, divide once here */
+    span = (config->type == TOUCH_SLIDER_WHEEL) ? config->num_channels : (config->num_channels - 1U);
+    s_slider_scale_q16[slider_id] = ((uint32_t)config->resolution << 16) /
+                                    (span << TOUCH_SLIDER_POS_FRAC_BITS);
+    
+    slider->configured = true;
+    return TOUCH_STATUS_SUCCESS;
+}
+
+touch_status_t TOUCH_SLIDER_Deinit(uint8_t slider_id)
+{
+    if (slider_id >= TOUCH_SLIDER_MAX_SLIDERS) {
+        return TOUCH_STATUS_INVALID_PARAM;
+    }
+    
+    s_sliders[slider_id].configured = false;
+    return TOUCH_STATUS_SUCCESS;
+}
+
+touch_status_t TOUCH_SLIDER_Process(void)
+{
+    uint32_t frame = TOUCH_GetFrameCount();
+    
+    /* Positions only change with a new frame; also keeps the rate limiter in frames */
+    if (frame == s_last_frame) {
+        return TOUCH_STATUS_SUCCESS;
+    }
+    s_last_frame = frame;
+    
+    for (uint8_t i = 0; i < TOUCH_SLIDER_MAX_SLIDERS; i++) {
+        if (s_sliders[i].configured) {
+            TOUCH_SLIDER_Update(i);
+            TOUCH_SLIDER_Report(i);
+        }
+    }
+    
+    return TOUCH_STATUS_SUCCESS;
+}
+
+touch_status_t TOUCH_SLIDER_GetPosition(uint8_t slider_id, uint16_t *positions, uint8_t *touch_count)
+{
+    if (slider_id >= TOUCH_SLIDER_MAX_SLIDERS || positions == NULL || touch_count == NULL ||
+        !s_sliders[slider_id].configured) {
+        return TOUCH_STATUS_INVALID_PARAM;
+    }
+    
+    touch_slider_t *slider = &s_sliders[slider_id];
+    
+    for (uint8_t i = 0; i < slider->touch_count; i++) {
+        positions[i] = slider->positions[i];
+    }
+    *touch_count = slider->touch_count;
+    
+    return TOUCH_STATUS_SUCCESS;
+}
+
+touch_status_t TOUCH_SLIDER_RegisterCallback(touch_slider_callback_t callback)
+{
+    s_slider_callback = callback;
+    return TOUCH_STATUS_SUCCESS;
+}
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static void TOUCH_SLIDER_Update(uint8_t slider_id)
+{
+    touch_slider_t *slider = &s_sliders[slider_id];
+    const touch_slider_config_t *cfg = &slider->config;
+    bool wheel = (cfg->type == TOUCH_SLIDER_WHEEL);
+    uint8_t n = cfg->num_channels;
+    int32_t d[TOUCH_SLIDER_MAX_CHANNELS];
+    int32_t span_q8 = (int32_t)n << TOUCH_SLIDER_POS_FRAC_BITS;
+    int32_t max_q8 = (int32_t)(n - 1U) << TOUCH_SLIDER_POS_FRAC_BITS;
+    int16_t delta;
+    
+    /* Only touched direction counts, noise below baseline is clipped */
+    for (uint8_t k = 0; k < n; k++) {
+        (void)TOUCH_GetChannelDelta(cfg->channels[k], &delta);
+        d[k] = (delta > 0) ? delta : 0;
+    }
+    
+    slider->touch_count = 0;
+    
+    for (uint8_t k = 0; k < n && slider->touch_count < TOUCH_SLIDER_MAX_TOUCHES; k++) {
+        int32_t prev;
+        int32_t next;
+        int32_t sum;
+        int32_t pos_q8;
+        
+        if (d[k] < (int32_t)cfg->touch_threshold) {
+            continue;
+        }
+        
+        if (wheel) {
+            prev = d[(k == 0U) ? (n - 1U) : (k - 1U)];
+            next = d[(k + 1U == n) ? 0U : (k + 1U)];
+        } else {
+            prev = (k == 0U) ? 0 : d[k - 1U];
+            next = (k + 1U == n) ? 0 : d[k + 1U];
+        }
+        
+        /* Local maximum; ties go to the left electrode so a plateau is one touch */
+        if (d[k] <= prev || d[k] < next) {
+            continue;
+        }
+        
+        /* Three-point centroid: k + (next - prev) / (prev + peak + next) */
+        sum = prev + d[k] + next;
+        pos_q8 = ((int32_t)k << TOUCH_SLIDER_POS_FRAC_BITS) +
+                 (((next - prev) << TOUCH_SLIDER_POS_FRAC_BITS) / sum);
+        
+        if (wheel) {
+            if (pos_q8 < 0) {
+                pos_q8 += span_q8;
+            } else if (pos_q8 >= span_q8) {
+                pos_q8 -= span_q8;
+            }
+        } else if (pos_q8 < 0) {
+            pos_q8 = 0;
+        } else if (pos_q8 > max_q8) {
+            pos_q8 = max_q8;
+        }
+        
+        slider->positions[slider->touch_count] =
+            (uint16_t)(((uint64_t)(uint32_t)pos_q8 * s_slider_scale_q16[slider_id]) >> 16);
+        slider->touch_count++;
+    }
+}
+
+static void TOUCH_SLIDER_Report(uint8_t slider_id)
+{
+    touch_slider_t *slider = &s_sliders[slider_id];
+    bool report = false;
+    
+    if (slider->frames_since_event < 0xFFU) {
+        slider->frames_since_event++;
+    }
+    
+    if (slider->touch_count != slider->reported_count) {
+        /* Touch / release / second finger: report immediately */
+        report = true;
+    } else if (slider->touch_count != 0U &&
+               slider->frames_since_event >= slider->config.min_interval) {
+        for (uint8_t i = 0; i < slider->touch_count; i++) {
+            if (TOUCH_SLIDER_Distance(slider, slider->positions[i], slider->reported[i]) >=
+                slider->config.min_move) {
+                report = true;
+                break;
+            }
+        }
+    }
+    
+    if (!report) {
+        return;
+    }
+    
+    for (uint8_t i = 0; i < slider->touch_count; i++) {
+        slider->reported[i] = slider->positions[i];
+    }
+    slider->reported_count = slider->touch_count;
+    slider->frames_since_event = 0;
+    
+    if (s_slider_callback != NULL) {
+        s_slider_callback(slider_id, slider->touch_count, slider->positions);
+    }
+}
+
+static uint16_t TOUCH_SLIDER_Distance(const touch_slider_t *slider, uint16_t a, uint16_t b)
+{
+    uint16_t dist = (a > b) ? (uint16_t)(a - b) : (uint16_t)(b - a);
+    
+    /* Wheel: shorter way around */
+    if (slider->config.type == TOUCH_SLIDER_WHEEL && dist > (slider->config.resolution >> 1)) {
+        dist = (uint16_t)(slider->config.resolution - dist);
+    }
+    
+    return dist;
+}
@@ -0,0 +1,116 @@
+/**
+ * @file    touch_slider.h
+ * @brief   Touch Slider / Wheel Position Engine
+ * @details Turns the per-channel deltas of touch_sensor into positions
+ *          - Linear sliders and rotary wheels built from groups of channels
+ *          - Interpolated centroid position in fixed point (one divide per
+ *            touch per frame)
+ *          - Up to TOUCH_SLIDER_MAX_TOUCHES separate touches per slider
+ *          - Event rate limiting (minimum movement and frame interval)
+ *
+ *          Call TOUCH_SLIDER_Process() after TOUCH_Process(); a slider is
+ *          only evaluated when the touch sensor produced a new frame.
+ * 
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+#ifndef TOUCH_SLIDER_H
+#define TOUCH_SLIDER_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "touch_sensor.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Maximum number of sliders / wheels */
+#define TOUCH_SLIDER_MAX_SLIDERS    (4U)
+
+/** @brief Maximum channels in one slider */
+#define TOUCH_SLIDER_MAX_CHANNELS   (TOUCH_MAX_CHANNELS)
+
+/** @brief Maximum simultaneous touches reported per slider */
+#define TOUCH_SLIDER_MAX_TOUCHES    (2U)
+
+/** @brief Slider layout */
+typedef enum {
+    TOUCH_SLIDER_LINEAR = 0,        /**< Open-ended strip: 0 .. resolution at the end electrodes */
+    TOUCH_SLIDER_WHEEL              /**< Closed ring: 0 .. resolution - 1, wraps */
+} touch_slider_type_t;
+
+/** @brief Slider configuration */
+typedef struct {
+    touch_slider_type_t type;       /**< Linear or wheel */
+    const uint8_t *channels;        /**< Touch channel ids in physical order */
+    uint8_t num_channels;           /**< Channels in the group (2 - TOUCH_SLIDER_MAX_CHANNELS, wheel >= 3) */
+    uint16_t resolution;            /**< Output range, e.g. 256 or 360 for a wheel in degrees */
+    uint16_t touch_threshold;       /**< Minimum peak delta counted as a touch */
+    uint16_t min_move;              /**< Minimum position change for a move event */
+    uint8_t min_interval;           /**< Minimum frames between two move events */
+} touch_slider_config_t;
+
+/** @brief Slider event callback (touch_count = 0 on release) */
+typedef void (*touch_slider_callback_t)(uint8_t slider_id, uint8_t touch_count,
+                                        const uint16_t *positions);
+
+/** @brief Slider runtime state */
+typedef struct {
+    touch_slider_config_t config;                       /**< Configuration */
+    uint8_t channels[TOUCH_SLIDER_MAX_CHANNELS];        /**< Copy of config.channels */
+    bool configured;                                    /**< Slider in use */
+    uint8_t touch_count;                                /**< Current touches */
+    uint16_t positions[TOUCH_SLIDER_MAX_TOUCHES];       /**< Current positions */
+    uint16_t reported[TOUCH_SLIDER_MAX_TOUCHES];        /**< Positions of the last event */
+    uint8_t reported_count;                             /**< Touches of the last event */
+    uint8_t frames_since_event;                         /**< Rate limiter */
+} touch_slider_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Configure a slider or wheel
+ * @param slider_id Slider index (0 - TOUCH_SLIDER_MAX_SLIDERS-1)
+ * @param config Slider configuration (channels are copied)
+ * @return touch_status_t Status of operation
+ */
+touch_status_t TOUCH_SLIDER_Init(uint8_t slider_id, const touch_slider_config_t *config);
+
+/**
+ * @brief Remove a slider
+ * @param slider_id Slider index
+ * @return touch_status_t Status of operation
+ */
+touch_status_t TOUCH_SLIDER_Deinit(uint8_t slider_id);
+
+/**
+ * @brief Update all sliders from the latest touch frame (call after TOUCH_Process)
+ * @return touch_status_t Status of operation
+ */
+touch_status_t TOUCH_SLIDER_Process(void);
+
+/**
+ * @brief Get current slider positions
+ * @param slider_id Slider index
+ * @param positions Buffer of TOUCH_SLIDER_MAX_TOUCHES entries
+ * @param touch_count Number of valid positions (0 = not touched)
+ * @return touch_status_t Status of operation
+ */
+touch_status_t TOUCH_SLIDER_GetPosition(uint8_t slider_id, uint16_t *positions, uint8_t *touch_count);
+
+/**
+ * @brief Register callback for slider events
+ * @param callback Callback function pointer (NULL = polling only)
+ * @return touch_status_t Status of operation
+ */
+touch_status_t TOUCH_SLIDER_RegisterCallback(touch_slider_callback_t callback);
+
+#endif /* TOUCH_SLIDER_H */
@@ -0,0 +1,376 @@
+/**
+ * @file    benchmark_suite.c
+ * @brief   On-target Performance Regression Benchmark Suite
+ * @details
+ * Firmware target chạy cùng một bộ workload chuẩn cho mỗi release và in
+ * report dạng CSV qua LPUART1, so sánh hai report bằng
+ * tools/bench_compare.py để bắt regression trước khi deploy.
+ * integrated_test.c kiểm tra chức năng, file này chỉ đo hiệu năng.
+ *
+ * Workloads (mỗi workload chạy BENCH_WINDOW_MS, đo bằng DWT CYCCNT):
+ * - CAN0 loopback 1 Mbps: frames/s và CPU cycles mỗi frame (Send + Receive)
+ * - LPUART1 TX DMA: bytes/s và line utilization so với baud rate
+ * - ADC0 qua PDB0 + DMA ping-pong: samples/s đạt được so với rate yêu cầu
+ * - LPI2C0 register read 2 byte @ 400 kHz: transactions/s (cần slave ACK)
+ * - DMA memcopy 4 KB: KiB/s
+ * - ISR latency LPIT0 ch1: min / avg / max ns (build với NVIC_ISR_TRACE_ENABLE = 1)
+ *
+ * Report format (một dòng mỗi metric, dòng khác bắt đầu bằng '#'):
+ *   BENCH_BEGIN,<suite version>,<core clock Hz>
+ *   BENCH,<metric>,<value>,<unit>
+ *   BENCH_SKIP,<metric>,<reason>
+ *   BENCH_END,<metric count>
+ *
+ * ADC / DMA / UART DMA / LPIT workload nằm trong benchmark_suite_adc_dma.c:
+ * adc.h, dma.h, lpit.h (status.h) và can.h khai báo status_t khác nhau nên
+ * không include chung một translation unit.
+ *
+ * Hardware Setup:
+ * - LPUART1 TX: PTC7, RX: PTC6 (115200 bps, OpenSDA virtual COM)
+ * - CAN0: loopback mode, không cần transceiver
+ * - ADC0 channel 12 (PTC14, potentiometer trên EVB)
+ * - LPI2C0: PTA2 (SCL), PTA3 (SDA), slave tại BENCH_I2C_SLAVE_ADDR
+ *   (mặc định EEPROM 0x50); không có slave thì workload bị skip
+ * - DMA channel 0 (ADC stream), 1 (memcopy), 2 (UART TX)
+ *
+ * Build flags: -DUART_DMA_ENABLE=1 -DNVIC_ISR_TRACE_ENABLE=1
+ *
+ * @note Số liệu chỉ so sánh được với cùng clock config, compiler flags và
+ *       linker placement; BENCH_SUITE_VERSION đổi khi workload đổi.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../inc/prof_srv.h"
+#include "can.h"
+#include "i2c.h"
+#include "uart.h"
+#include "port.h"
+#include "pcc_reg.h"
+#include "clocks_and_modes.h"
+#include <stdio.h>
+#include <string.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Tăng khi workload hoặc format report đổi: report khác version không so sánh */
+#define BENCH_SUITE_VERSION         (1U)
+
+#define BENCH_CORE_CLOCK_HZ         (80000000U)
+#define BENCH_WINDOW_MS             (100U)
+#define BENCH_WINDOW_CYCLES         ((BENCH_CORE_CLOCK_HZ / 1000U) * BENCH_WINDOW_MS)
+
+/* UART Configuration */
+#define UART_INSTANCE               LPUART1
+#define UART_TX_PIN                 (7U)
+#define UART_RX_PIN                 (6U)
+#define UART_BAUDRATE               (115200U)
+
+/* CAN Configuration */
+#define CAN_INSTANCE                (0U)
+#define CAN_TX_MB                   (8U)
+#define CAN_RX_MB                   (16U)
+#define CAN_BENCH_ID                (0x123U)
+#define CAN_BENCH_BAUDRATE          (1000000U)
+
+/* I2C Configuration */
+#ifndef BENCH_I2C_SLAVE_ADDR
+#define BENCH_I2C_SLAVE_ADDR        (0x50U)
+#endif
+#define I2C_BENCH_BAUDRATE          (400000U)
+#define I2C_SRC_CLOCK_HZ            (8000000U)  /* SOSCDIV2 */
+
+#define BENCH_LINE_SIZE             (80U)
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+static uint32_t g_benchMetricCount = 0U;
+
+/*******************************************************************************
+ * External Functions
+ ******************************************************************************/
+/* benchmark_suite_adc_dma.c */
+extern void Bench_AdcDmaInit(void);
+extern void Bench_AdcStream(uint32_t windowCycles);
+extern void Bench_DmaMemCopy(void);
+extern void Bench_UartDma(LPUART_RegType *base, uint32_t baudRate);
+extern void Bench_IsrLatency(uint32_t windowCycles);
+
+/*******************************************************************************
+ * Report
+ ******************************************************************************/
+
+static void Bench_PrintLine(const char *line, int len)
+{
+    if (len > (int)(BENCH_LINE_SIZE - 1U)) {
+        len = (int)(BENCH_LINE_SIZE - 1U);
+    }
+    if (len > 0) {
+        (void)UART_SendBlocking(UART_INSTANCE, (const uint8_t *)line, (uint32_t)len);
+    }
+}
+
+/**
+ * @brief In một metric (cũng được gọi từ benchmark_suite_adc_dma.c)
+ */
+void Bench_Report(const char *metric, uint32_t value, const char *unit)
+{
+    char line[BENCH_LINE_SIZE];
+
+    Bench_PrintLine(line, snprintf(line, sizeof(line), "BENCH,%s,%lu,%s\r\n",
+                                   metric, (unsigned long)value, unit));
+    g_benchMetricCount++;
+}
+
+/**
+ * @brief Báo workload không chạy được (thiếu hardware / build flag)
+ */
+void Bench_ReportSkip(const char *metric, const char *reason)
+{
+    char line[BENCH_LINE_SIZE];
+
+    Bench_PrintLine(line, snprintf(line, sizeof(line), "BENCH_SKIP,%s,%s\r\n", metric, reason));
+}
+
+/**
+ * @brief count sự kiện trong cycles core clock → sự kiện mỗi giây
+ */
+uint32_t Bench_PerSecond(uint32_t count, uint32_t cycles)
+{
+    if (cycles == 0U) {
+        return 0U;
+    }
+
+    return (uint32_t)(((uint64_t)count * BENCH_CORE_CLOCK_HZ) / cycles);
+}
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static void InitClocks(void)
+{
+    PCC->PCCn[PCC_PORTA_INDEX] = PCC_PCCn_CGC_MASK;
+    PCC->PCCn[PCC_PORTC_INDEX] = PCC_PCCn_CGC_MASK;
+    PCC->PCCn[PCC_LPI2C0_INDEX] = PCC_PCCn_PCS(1U) | PCC_PCCn_CGC_MASK;  /* SOSCDIV2 */
+}
+
+static void InitUART(void)
+{
+    UART_Config_t uartConfig;
+
+    UART_EnableClock(1);
+    PORT_SetPinMux(PORT_C, UART_TX_PIN, PORT_MUX_ALT2);
+    PORT_SetPinMux(PORT_C, UART_RX_PIN, PORT_MUX_ALT2);
+
+    UART_GetDefaultConfig(&uartConfig);
+    uartConfig.baudRate = UART_BAUDRATE;
+    (void)UART_Init(UART_INSTANCE, &uartConfig, UART_GetClockFrequency(1));
+}
+
+static bool InitCAN(void)
+{
+    can_config_t config = {
+        .instance = CAN_INSTANCE,
+        .clockSource = CAN_CLK_SRC_BUSCLOCK,
+        .baudRate = CAN_BENCH_BAUDRATE,
+        .mode = CAN_MODE_LOOPBACK,
+        .enableSelfReception = true,
+        .useRxFifo = false
+    };
+    can_rx_filter_t filter = {
+        .id = CAN_BENCH_ID,
+        .mask = 0x7FF,
+        .idType = CAN_ID_STD
+    };
+
+    return (CAN_Init(&config) == STATUS_SUCCESS) &&
+           (CAN_ConfigRxFilter(CAN_INSTANCE, CAN_RX_MB, &filter) == STATUS_SUCCESS);
+}
+
+static bool InitI2C(void)
+{
+    I2C_MasterConfig_t config = {
+        .baudRate = I2C_BENCH_BAUDRATE,
+        .prescaler = 0,
+        .enableMaster = true,
+        .enableDebug = false
+    };
+
+    PORT_SetPinMux(PORT_A, 2U, PORT_MUX_ALT3);
+    PORT_SetPinMux(PORT_A, 3U, PORT_MUX_ALT3);
+    PORT_SetPullConfig(PORT_A, 2U, PORT_PULL_UP);
+    PORT_SetPullConfig(PORT_A, 3U, PORT_PULL_UP);
+
+    I2C_EnableClock(0);
+    return I2C_MasterInit(LPI2C0, &config, I2C_SRC_CLOCK_HZ) == I2C_STATUS_SUCCESS;
+}
+
+/**
+ * @brief CAN loopback: giữ TX MB luôn bận, đếm frame nhận lại trong window
+ */
+static void Bench_CanLoopback(void)
+{
+    can_message_t txMsg;
+    can_message_t rxMsg;
+    uint32_t start;
+    uint32_t now;
+    uint32_t t0;
+    uint32_t cpuCycles = 0U;
+    uint32_t frames = 0U;
+    bool busy;
+
+    memset(&txMsg, 0, sizeof(txMsg));
+    txMsg.id = CAN_BENCH_ID;
+    txMsg.idType = CAN_ID_STD;
+    txMsg.frameType = CAN_FRAME_DATA;
+    txMsg.dataLength = 8;
+
+    /* cpu: chỉ thời gian trong CAN_Send() và CAN_Receive() có frame */
+    start = PROF_SRV_CYCCNT;
+    do {
+        if ((CAN_IsMbBusy(CAN_INSTANCE, CAN_TX_MB, &busy) == STATUS_SUCCESS) && !busy) {
+            txMsg.data[0] = (uint8_t)frames;
+            t0 = PROF_SRV_CYCCNT;
+            (void)CAN_Send(CAN_INSTANCE, CAN_TX_MB, &txMsg);
+            cpuCycles += PROF_SRV_CYCCNT - t0;
+        }
+        t0 = PROF_SRV_CYCCNT;
+        if (CAN_Receive(CAN_INSTANCE, CAN_RX_MB, &rxMsg) == STATUS_SUCCESS) {
+            cpuCycles += PROF_SRV_CYCCNT - t0;
+            frames++;
+        }
+        now = PROF_SRV_CYCCNT;
+    } while ((now - start) < BENCH_WINDOW_CYCLES);
+
+    if (frames == 0U) {
+        Bench_ReportSkip("can_loopback", "no_frames");
+        return;
+    }
+
+    Bench_Report("can_loopback_frames", Bench_PerSecond(frames, now - start), "per_s");
+    Bench_Report("can_loopback_cpu", cpuCycles / frames, "cycles");
+}
+
+/**
+ * @brief I2C: register read liên tục (START, reg, Sr, 2 byte, STOP)
+ */
+static void Bench_I2C(bool ready)
+{
+    static const uint8_t reg[1] = {0x00U};
+    uint8_t data[2];
+    uint32_t start;
+    uint32_t now;
+    uint32_t count = 0U;
+    I2C_Status_t status;
+
+    if (!ready) {
+        Bench_ReportSkip("i2c_transactions", "init_failed");
+        return;
+    }
+
+    start = PROF_SRV_CYCCNT;
+    do {
+        status = I2C_MasterStart(LPI2C0, BENCH_I2C_SLAVE_ADDR, I2C_WRITE);
+        if (status == I2C_STATUS_SUCCESS) {
+            status = I2C_MasterSend(LPI2C0, reg, sizeof(reg), false);
+        }
+        if (status == I2C_STATUS_SUCCESS) {
+            status = I2C_MasterStart(LPI2C0, BENCH_I2C_SLAVE_ADDR, I2C_READ);
+        }
+        if (status == I2C_STATUS_SUCCESS) {
+            status = I2C_MasterReceive(LPI2C0, data, sizeof(data), true);
+        }
+        if (status != I2C_STATUS_SUCCESS) {
+            (void)I2C_MasterStop(LPI2C0);
+            break;
+        }
+        count++;
+        now = PROF_SRV_CYCCNT;
+    } while ((now - start) < BENCH_WINDOW_CYCLES);
+
+    if (status != I2C_STATUS_SUCCESS) {
+        Bench_ReportSkip("i2c_transactions", (status == I2C_STATUS_NACK) ? "nack" : "bus_error");
+        return;
+    }
+
+    Bench_Report("i2c_transactions", Bench_PerSecond(count, now - start), "per_s");
+}
+
+/*******************************************************************************
+ * Main Benchmark Function
+ ******************************************************************************/
+
+/**
+ * @brief Chạy toàn bộ suite một lần rồi in report
+ */
+void Benchmark_Suite_Main(void)
+{
+    char line[BENCH_LINE_SIZE];
+    bool canReady;
+    bool i2cReady;
+
+    SOSC_init_8MHz();
+    SPLL_init_160MHz();
+    NormalRUNmode_80MHz();
+
+    InitClocks();
+    InitUART();
+    canReady = InitCAN();
+    i2cReady = InitI2C();
+    Bench_AdcDmaInit();
+
+    if (PROF_SRV_Init() != PROF_SRV_SUCCESS) {
+        while (1) {
+        }
+    }
+
+    g_benchMetricCount = 0U;
+    Bench_PrintLine(line, snprintf(line, sizeof(line), "\r\n# S32K144 benchmark suite\r\nBENCH_BEGIN,%u,%lu\r\n",
+                                   BENCH_SUITE_VERSION, (unsigned long)BENCH_CORE_CLOCK_HZ));
+
+    if (canReady) {
+        Bench_CanLoopback();
+    } else {
+        Bench_ReportSkip("can_loopback", "init_failed");
+    }
+    Bench_UartDma(UART_INSTANCE, UART_BAUDRATE);
+    Bench_AdcStream(BENCH_WINDOW_CYCLES);
+    Bench_I2C(i2cReady);
+    Bench_DmaMemCopy();
+    Bench_IsrLatency(BENCH_WINDOW_CYCLES);
+
+    Bench_PrintLine(line, snprintf(line, sizeof(line), "BENCH_END,%lu\r\n",
+                                   (unsigned long)g_benchMetricCount));
+
+    while (1) {
+    }
+}
+
+/*******************************************************************************
+ * Usage Instructions
+ ******************************************************************************/
+
+/*
+ * TO USE THIS BENCHMARK:
+ *
+ * 1. Build benchmark_suite.c + benchmark_suite_adc_dma.c với
+ *    -DUART_DMA_ENABLE=1 -DNVIC_ISR_TRACE_ENABLE=1, cùng optimization level
+ *    như firmware release
+ *
+ * 2. In main():
+ *    int main(void) {
+ *        Benchmark_Suite_Main();
+ *    }
+ *
+ * 3. Capture report (115200 baud) và so sánh với baseline:
+ *    python3 tools/bench_compare.py baseline.txt current.txt --tolerance 5
+ *    Exit code 1 khi có metric xấu đi quá tolerance (%).
+ */
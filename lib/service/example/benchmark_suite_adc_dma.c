@@ -0,0 +1,302 @@
+/**
+ * @file    benchmark_suite_adc_dma.c
+ * @brief   ADC / DMA / UART DMA / ISR latency workloads of benchmark_suite.c
+ * @details
+ * Tách riêng vì adc.h, dma.h, lpit.h dùng status_t của status.h, can.h khai
+ * báo status_t riêng; hai nhóm header không include chung được. Kết quả
+ * in qua Bench_Report() của benchmark_suite.c.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../inc/prof_srv.h"
+#include "../inc/lat_srv.h"
+#include "adc.h"
+#include "pdb.h"
+#include "dma.h"
+#include "lpit.h"
+#include "uart.h"
+#include "port.h"
+#include "nvic.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define BENCH_BUS_CLOCK_HZ          (40000000U)     /* PDB clock */
+
+/* ADC stream: PDB0 continuous, software trigger */
+#define DMA_CHANNEL_ADC             (0U)
+#define ADC_BENCH_RATE_HZ           (100000U)
+#define ADC_BENCH_HALF              (64U)
+
+/* DMA memcopy */
+#define DMA_CHANNEL_COPY            (1U)
+#define DMA_COPY_SIZE               (4096U)
+#define DMA_COPY_RUNS               (16U)
+
+/* UART TX DMA: 16 dòng comment '#', parser bỏ qua */
+#define DMA_CHANNEL_UART_TX         (2U)
+#define UART_DMA_LINE_SIZE          (64U)
+#define UART_DMA_SIZE               (16U * UART_DMA_LINE_SIZE)
+
+/* ISR latency: LPIT0 ch1 periodic */
+#define LPIT_LAT_CHANNEL            (1U)
+#define LPIT_LAT_RATE_HZ            (10000U)
+
+/*******************************************************************************
+ * Global Variables
+ ******************************************************************************/
+static uint16_t g_adcSamples[2U * ADC_BENCH_HALF];
+static volatile uint32_t g_adcBlocks = 0U;
+
+static uint32_t g_dmaSrc[DMA_COPY_SIZE / 4U];
+static uint32_t g_dmaDst[DMA_COPY_SIZE / 4U];
+
+static uint8_t g_uartDmaBuffer[UART_DMA_SIZE];
+
+static lat_srv_probe_t g_latLpit;
+
+/*******************************************************************************
+ * External Functions
+ ******************************************************************************/
+/* benchmark_suite.c */
+extern void Bench_Report(const char *metric, uint32_t value, const char *unit);
+extern void Bench_ReportSkip(const char *metric, const char *reason);
+extern uint32_t Bench_PerSecond(uint32_t count, uint32_t cycles);
+
+/*******************************************************************************
+ * Interrupt Handlers
+ ******************************************************************************/
+
+static void OnAdcBlock(ADC_Instance_t instance, const uint16_t *block, uint16_t count, void *userData)
+{
+    (void)instance;
+    (void)block;
+    (void)count;
+    (void)userData;
+
+    g_adcBlocks++;
+}
+
+void DMA0_IRQHandler(void)
+{
+    DMA_IRQHandler(DMA_CHANNEL_ADC);
+}
+
+void LPIT0_Ch1_IRQHandler(void)
+{
+    LPIT_IRQHandler(LPIT_LAT_CHANNEL);
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+void Bench_AdcDmaInit(void)
+{
+    ADC_Config_t adcConfig = {
+        .clockSource = ADC_CLK_ALT1,
+        .resolution = ADC_RESOLUTION_12BIT,
+        .clockDivider = ADC_CLK_DIV_2,
+        .voltageRef = ADC_VREF_VREFH_VREFL,
+        .triggerSource = ADC_TRIGGER_HARDWARE,
+        .continuousMode = false,
+        .dmaEnable = true,
+        .interruptEnable = false
+    };
+    uint32_t i;
+
+    PORT_SetPinMux(PORT_C, 14U, PORT_MUX_DISABLED);
+    ADC_EnableClock(ADC_INSTANCE_0);
+    (void)ADC_Init(ADC_INSTANCE_0, &adcConfig);
+    (void)ADC_Calibrate(ADC_INSTANCE_0);
+    (void)ADC_ConfigHardwareTrigger(ADC_INSTANCE_0, ADC_CHANNEL_AD12, false);
+
+    (void)DMA_Init();
+    NVIC_EnableIRQ(DMA0_IRQn);
+
+    for (i = 0U; i < (DMA_COPY_SIZE / 4U); i++) {
+        g_dmaSrc[i] = i * 0x01010101UL;
+    }
+
+    for (i = 0U; i < UART_DMA_SIZE; i++) {
+        switch (i % UART_DMA_LINE_SIZE) {
+        case 0U:
+            g_uartDmaBuffer[i] = '#';
+            break;
+        case UART_DMA_LINE_SIZE - 2U:
+            g_uartDmaBuffer[i] = '\r';
+            break;
+        case UART_DMA_LINE_SIZE - 1U:
+            g_uartDmaBuffer[i] = '\n';
+            break;
+        default:
+            g_uartDmaBuffer[i] = 'U';               /* 0x55: toggle mỗi bit */
+            break;
+        }
+    }
+}
+
+/**
+ * @brief ADC qua PDB + DMA: samples/s thực tế ở ADC_BENCH_RATE_HZ
+ */
+void Bench_AdcStream(uint32_t windowCycles)
+{
+    pdb_config_t pdbConfig = {
+        .prescaler = PDB_PRESCALER_1,
+        .mult_factor = PDB_MULT_1,
+        .trigger_source = PDB_TRIGGER_SOFTWARE,
+        .mod_value = (uint16_t)((BENCH_BUS_CLOCK_HZ / ADC_BENCH_RATE_HZ) - 1U),
+        .continuous_mode = true,
+        .enable_interrupt = false
+    };
+    uint32_t start;
+    uint32_t elapsed;
+    uint32_t blocks;
+
+    if (ADC_StartDmaStream(ADC_INSTANCE_0, DMA_CHANNEL_ADC, g_adcSamples, ADC_BENCH_HALF,
+                           OnAdcBlock, NULL) != ADC_STATUS_SUCCESS) {
+        Bench_ReportSkip("adc_pdb_dma", "dma_setup");
+        return;
+    }
+
+    PDB_Init(PDB_INSTANCE_0, &pdbConfig);
+    PDB_ConfigADCTrigger(PDB_INSTANCE_0, 0U, 0U, 0U);
+    PDB_LoadConfig(PDB_INSTANCE_0);
+    PDB_Enable(PDB_INSTANCE_0);
+
+    /* Đếm từ block đầu tiên: bỏ qua startup của PDB / ADC */
+    PDB_SoftwareTrigger(PDB_INSTANCE_0);
+    while (g_adcBlocks == 0U) {
+    }
+    blocks = g_adcBlocks;
+    start = PROF_SRV_CYCCNT;
+    do {
+        elapsed = PROF_SRV_CYCCNT - start;
+    } while (elapsed < windowCycles);
+    blocks = g_adcBlocks - blocks;
+
+    PDB_Disable(PDB_INSTANCE_0);
+    (void)ADC_StopDmaStream(ADC_INSTANCE_0);
+
+    Bench_Report("adc_pdb_dma_samples", Bench_PerSecond(blocks * ADC_BENCH_HALF, elapsed), "per_s");
+    Bench_Report("adc_pdb_dma_lost_blocks", ADC_GetDmaStreamOverruns(ADC_INSTANCE_0), "count");
+}
+
+/**
+ * @brief DMA memory-to-memory, DMA_COPY_RUNS lần DMA_COPY_SIZE bytes
+ */
+void Bench_DmaMemCopy(void)
+{
+    uint32_t start;
+    uint32_t elapsed;
+    uint32_t i;
+
+    start = PROF_SRV_CYCCNT;
+    for (i = 0U; i < DMA_COPY_RUNS; i++) {
+        if (DMA_MemCopy(DMA_CHANNEL_COPY, g_dmaSrc, g_dmaDst, DMA_COPY_SIZE) != STATUS_SUCCESS) {
+            Bench_ReportSkip("dma_memcopy", "dma_error");
+            return;
+        }
+    }
+    elapsed = PROF_SRV_CYCCNT - start;
+
+    if (g_dmaDst[(DMA_COPY_SIZE / 4U) - 1U] != g_dmaSrc[(DMA_COPY_SIZE / 4U) - 1U]) {
+        Bench_ReportSkip("dma_memcopy", "data_mismatch");
+        return;
+    }
+
+    Bench_Report("dma_memcopy", Bench_PerSecond((DMA_COPY_RUNS * DMA_COPY_SIZE) / 1024U, elapsed), "kib_per_s");
+}
+
+/**
+ * @brief UART TX DMA: bytes/s, % line rate (10 bit mỗi byte) và setup cost
+ * @note Đo tới DMA done: 1-2 byte cuối còn trong FIFO / shift register
+ */
+void Bench_UartDma(LPUART_RegType *base, uint32_t baudRate)
+{
+    uint32_t start;
+    uint32_t setup;
+    uint32_t elapsed;
+    uint32_t bytesPerSecond;
+
+    if (UART_ConfigTxDMA(base, DMA_CHANNEL_UART_TX) != UART_STATUS_SUCCESS) {
+        Bench_ReportSkip("uart_dma", "dma_setup");
+        return;
+    }
+
+    start = PROF_SRV_CYCCNT;
+    if (UART_SendDMA(base, DMA_CHANNEL_UART_TX, g_uartDmaBuffer, UART_DMA_SIZE) != UART_STATUS_SUCCESS) {
+        UART_DisableTxDMA(base);
+        Bench_ReportSkip("uart_dma", "dma_start");
+        return;
+    }
+    setup = PROF_SRV_CYCCNT - start;
+    while (!DMA_IsChannelDone(DMA_CHANNEL_UART_TX)) {
+    }
+    elapsed = PROF_SRV_CYCCNT - start;
+
+    (void)DMA_ClearDone(DMA_CHANNEL_UART_TX);
+    UART_DisableTxDMA(base);
+
+    bytesPerSecond = Bench_PerSecond(UART_DMA_SIZE, elapsed);
+    Bench_Report("uart_dma_throughput", bytesPerSecond, "bytes_per_s");
+    Bench_Report("uart_dma_line_rate", (bytesPerSecond * 1000U) / (baudRate / 10U), "permille");
+    Bench_Report("uart_dma_setup", setup, "cycles");
+}
+
+/**
+ * @brief ISR latency LPIT0 ch1 (lat_srv), chỉ với NVIC_ISR_TRACE_ENABLE = 1
+ */
+void Bench_IsrLatency(uint32_t windowCycles)
+{
+    lpit_channel_config_t lpitConfig = {
+        .channel = LPIT_LAT_CHANNEL,
+        .mode = LPIT_MODE_32BIT_PERIODIC,
+        .period = 0U,
+        .enableInterrupt = true,
+        .chainChannel = false,
+        .startOnTrigger = false,
+        .stopOnInterrupt = false,
+        .reloadOnTrigger = false
+    };
+    uint32_t clockHz;
+    uint32_t start;
+
+    if (LPIT_Init(LPIT_CLK_SRC_FIRC) != STATUS_SUCCESS) {
+        Bench_ReportSkip("isr_latency", "lpit_init");
+        return;
+    }
+    clockHz = LPIT_GetClockFreq();
+    lpitConfig.period = LPIT_CalculatePeriod(clockHz, LPIT_LAT_RATE_HZ);
+
+    if ((LPIT_ConfigChannel(&lpitConfig) != STATUS_SUCCESS) ||
+        (LAT_SRV_Init(LPIT_LAT_CHANNEL) != LAT_SRV_SUCCESS) ||
+        (LAT_SRV_Register(&g_latLpit, LPIT0_Ch1_IRQn, "lpit0_ch1") != LAT_SRV_SUCCESS)) {
+        Bench_ReportSkip("isr_latency", "trace_disabled");
+        return;
+    }
+
+    NVIC_EnableIRQ(LPIT0_Ch1_IRQn);
+    (void)LPIT_StartChannel(LPIT_LAT_CHANNEL);
+    start = PROF_SRV_CYCCNT;
+    while ((PROF_SRV_CYCCNT - start) < windowCycles) {
+    }
+    (void)LPIT_StopChannel(LPIT_LAT_CHANNEL);
+    NVIC_DisableIRQ(LPIT0_Ch1_IRQn);
+
+    if (g_latLpit.count == 0U) {
+        Bench_ReportSkip("isr_latency", "no_samples");
+        return;
+    }
+
+    Bench_Report("isr_latency_min", (uint32_t)(((uint64_t)g_latLpit.min * 1000000000ULL) / clockHz), "ns");
+    Bench_Report("isr_latency_avg",
+                 (uint32_t)(((g_latLpit.total / g_latLpit.count) * 1000000000ULL) / clockHz), "ns");
+    Bench_Report("isr_latency_max", (uint32_t)(((uint64_t)g_latLpit.max * 1000000000ULL) / clockHz), "ns");
+}
@@ -54,7 +54,7 @@ void CAN_BasicExample(void)
     can_cfg.filter_extended = false;    /* Standard 11-bit ID */
     
     /* 5. Initialize CAN */
-    status = CAN_SRV_Init(&can_cfg);
+    status = CAN_SRV_Init(CAN_SRV_CAN0, &can_cfg);
     if (status != CAN_SRV_SUCCESS) {
         UART_SRV_SendString("CAN Init Failed!\r\n");
         while(1);
@@ -85,7 +85,7 @@ void CAN_BasicExample(void)
         tx_msg.data[3] = counter & 0xFF;
         
         /* Send CAN message */
-        status = CAN_SRV_Send(&tx_msg);
+        status = CAN_SRV_Send(CAN_SRV_CAN0, &tx_msg);
         
         if (status == CAN_SRV_SUCCESS) {
             char buffer[64];
@@ -97,7 +97,7 @@ void CAN_BasicExample(void)
         }
         
         /* Try to receive message */
-        status = CAN_SRV_Receive(&rx_msg);
+        status = CAN_SRV_Receive(CAN_SRV_CAN0, &rx_msg);
         
         if (status == CAN_SRV_SUCCESS) {
             char buffer[128];
@@ -131,7 +131,7 @@ void CAN_SensorDataExample(void)
     /* Initialize */
     CLOCK_SRV_V2_InitPreset("RUN_80MHz");
     CLOCK_SRV_V2_EnablePeripheral(CLOCK_SRV_V2_FLEXCAN0, CLOCK_SRV_V2_PCS_SOSCDIV2);
-    CAN_SRV_Init(&can_cfg);
+    CAN_SRV_Init(CAN_SRV_CAN0, &can_cfg);
     
     /* Simulate sensor readings */
     uint16_t temperature = 250;  /* 25.0°C */
@@ -151,7 +151,7 @@ void CAN_SensorDataExample(void)
         msg.data[4] = (humidity >> 8) & 0xFF;
         msg.data[5] = humidity & 0xFF;
         
-        CAN_SRV_Send(&msg);
+        CAN_SRV_Send(CAN_SRV_CAN0, &msg);
         
         /* Update values (simulate changes) */
         temperature += 1;
@@ -177,7 +177,7 @@ void CAN_ExtendedIDExample(void)
     
     CLOCK_SRV_V2_InitPreset("RUN_80MHz");
     CLOCK_SRV_V2_EnablePeripheral(CLOCK_SRV_V2_FLEXCAN0, CLOCK_SRV_V2_PCS_SOSCDIV2);
-    CAN_SRV_Init(&can_cfg);
+    CAN_SRV_Init(CAN_SRV_CAN0, &can_cfg);
     
     /* Send with 29-bit ID */
     msg.id = 0x12345678;
@@ -189,7 +189,7 @@ void CAN_ExtendedIDExample(void)
     }
     
     while(1) {
-        CAN_SRV_Send(&msg);
+        CAN_SRV_Send(CAN_SRV_CAN0, &msg);
         
         /* Delay */
         for(volatile uint32_t i = 0; i < 1000000; i++);
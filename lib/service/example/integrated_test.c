@@ -107,7 +107,7 @@ void Button_Start_Callback(uint8_t port, uint8_t pin)
     start_msg.data[6] = 0x00;
     start_msg.data[7] = 0x00;
     
-    if (CAN_SRV_Send(&start_msg) == CAN_SRV_SUCCESS) {
+    if (CAN_SRV_Send(CAN_SRV_CAN0, &start_msg) == CAN_SRV_SUCCESS) {
         g_can_tx_count++;
         UART_SRV_SendString("[BTN] START command sent via CAN\r\n");
     } else {
@@ -153,7 +153,7 @@ void ADC_Sample_Callback(void)
         data_msg.data[6] = (g_adc_sample_count >> 8) & 0xFF;
         data_msg.data[7] = g_adc_sample_count & 0xFF;
         
-        if (CAN_SRV_Send(&data_msg) == CAN_SRV_SUCCESS) {
+        if (CAN_SRV_Send(CAN_SRV_CAN0, &data_msg) == CAN_SRV_SUCCESS) {
             g_can_tx_count++;
             
             char buffer[64];
@@ -342,7 +342,7 @@ static void Hardware_Init(void)
     can_cfg.filter_mask = 0x000;
     can_cfg.filter_extended = false;
     
-    if (CAN_SRV_Init(&can_cfg) != CAN_SRV_SUCCESS) {
+    if (CAN_SRV_Init(CAN_SRV_CAN0, &can_cfg) != CAN_SRV_SUCCESS) {
         UART_SRV_SendString("[ERROR] CAN initialization failed!\r\n");
         while(1);
     }
@@ -411,7 +411,7 @@ void Integrated_Test_Main(void)
     /* Main loop */
     while(1) {
         /* Check for received CAN messages */
-        if (CAN_SRV_Receive(&rx_msg) == CAN_SRV_SUCCESS) {
+        if (CAN_SRV_Receive(CAN_SRV_CAN0, &rx_msg) == CAN_SRV_SUCCESS) {
             ProcessCANMessage(&rx_msg);
         }
         
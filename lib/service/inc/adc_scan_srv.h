@@ -0,0 +1,252 @@
+/**
+ * @file    adc_scan_srv.h
+ * @brief   ADC Scan Service - Continuous Multi-channel Sampling
+ * @details
+ * Scan liên tục một danh sách channel bằng hardware (PDB back-to-back scan
+ * group + eDMA ping-pong frame), DMA ISR cập nhật bảng giá trị mới nhất
+ * theo channel. Module bất kỳ đọc channel bất kỳ trong O(1), không trigger
+ * conversion và không chờ COCO như ADC_SRV_Start() / ADC_SRV_Read().
+ *
+ * Features:
+ * - 1 - 16 channel trên một ADC instance, chu kỳ scan = PDB modulus
+ * - Bảng latest-value lock-free: mỗi entry là một halfword, ISR là writer
+ *   duy nhất, reader không cần critical section
+ * - Min / max tùy chọn theo channel, đóng gói trong một word (đọc không bị
+ *   tear), reset lock-free qua request bitmask
+ * - Snapshot cả frame nhất quán bằng frame counter (seqlock)
+ * - VREFH thực tế đo qua bandgap (ADC_CHANNEL_BANDGAP trong scan list):
+ *   scale Q16 cập nhật mỗi frame, ADC_SCAN_SRV_ReadMillivolts() chỉ nhân +
+ *   shift; nhiệt độ chip từ ADC_CHANNEL_TEMP_SENSOR
+ * - Oversample-and-decimate theo channel: cộng 4^n frame, dịch phải n bit,
+ *   kết quả 12 + n bit (tối đa 16 bit), kết hợp hardware averaging
+ *
+ * @code
+ * static const ADC_Channel_t s_channels[] = { ADC_CHANNEL_AD0, ADC_CHANNEL_AD4, ADC_CHANNEL_AD12,
+ *                                             ADC_CHANNEL_BANDGAP, ADC_CHANNEL_TEMP_SENSOR };
+ *
+ * adc_scan_srv_config_t cfg = {
+ *     .instance = ADC_INSTANCE_0, .dma_channel = 2U,
+ *     .channels = s_channels, .num_channels = 5U,
+ *     .prescaler = PDB_PRESCALER_1, .mult = PDB_MULT_10, .modulus = 4000U,
+ *     .track_min_max = true
+ * };
+ * ADC_Init(ADC_INSTANCE_0, &adc_cfg);                 // interruptEnable = false
+ * ADC_Calibrate(ADC_INSTANCE_0);
+ * ADC_SCAN_SRV_Start(&cfg);
+ *
+ * uint16_t vbat;
+ * if (ADC_SCAN_SRV_Read(ADC_CHANNEL_AD4, &vbat) == ADC_SCAN_SRV_SUCCESS) { ... }
+ *
+ * uint32_t mv;
+ * int32_t t10;
+ * ADC_SCAN_SRV_ReadMillivolts(ADC_CHANNEL_AD4, &mv);  // theo VREFH đo được
+ * ADC_SCAN_SRV_ReadTemperature(&t10);                 // 0.1 degC
+ * @endcode
+ *
+ * Oversampling AD12 lên 16 bit (256 frame / kết quả), AD0 / AD4 giữ 12 bit:
+ * @code
+ * static const uint8_t s_os_bits[] = { 0U, 0U, 4U, 0U, 0U };   // theo thứ tự scan list
+ * cfg.oversample_bits = s_os_bits;
+ * cfg.hw_average.enable = true;
+ * cfg.hw_average.averageMode = ADC_AVERAGE_4;          // giảm noise từng frame
+ * ADC_SCAN_SRV_Start(&cfg);
+ *
+ * uint16_t precise;
+ * uint8_t bits;
+ * ADC_SCAN_SRV_ReadOversampled(ADC_CHANNEL_AD12, &precise, &bits);   // bits = 16
+ * @endcode
+ *
+ * @note Enable IRQ của dma_channel trong NVIC và gọi DMA_IRQHandler() từ đó.
+ * @note Oversampling chỉ tăng resolution khi tín hiệu có noise >= 1 LSB
+ *       (dither tự nhiên). Hardware averaging làm tròn về 12 bit và nhân
+ *       thời gian conversion lên số mẫu trung bình: modulus phải đủ dài cho
+ *       cả scan. Tốc độ ra của channel = tốc độ scan / 4^n.
+ * @note Service chiếm scan group và DMA stream của instance: không dùng
+ *       chung với ADC_StartDmaStream() / ADC_StartDualSync().
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+#ifndef ADC_SCAN_SRV_H
+#define ADC_SCAN_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "adc.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Số channel tối đa của scan list (số SC1 slot) */
+#define ADC_SCAN_SRV_MAX_CHANNELS       (16U)
+
+/** @brief Số bit oversampling tối đa (4^4 = 256 frame, kết quả 16 bit) */
+#define ADC_SCAN_SRV_MAX_OVERSAMPLE_BITS (4U)
+
+/** @brief VREFH nominal khi bandgap không có trong scan list (mV) */
+#ifndef ADC_SCAN_SRV_DEFAULT_VREF_MV
+#define ADC_SCAN_SRV_DEFAULT_VREF_MV    (5000U)
+#endif
+
+/** @brief Hệ số IIR của bandgap: mỗi frame đi 1 / 2^n về giá trị mới */
+#ifndef ADC_SCAN_SRV_VREF_FILTER_SHIFT
+#define ADC_SCAN_SRV_VREF_FILTER_SHIFT  (3U)
+#endif
+
+/** @brief Số lần đọc lại tối đa của ADC_SCAN_SRV_GetSnapshot() */
+#ifndef ADC_SCAN_SRV_SNAPSHOT_RETRIES
+#define ADC_SCAN_SRV_SNAPSHOT_RETRIES   (4U)
+#endif
+
+/**
+ * @brief ADC scan service status codes
+ */
+typedef enum {
+    ADC_SCAN_SRV_SUCCESS = 0,
+    ADC_SCAN_SRV_ERROR,
+    ADC_SCAN_SRV_NOT_INITIALIZED,
+    ADC_SCAN_SRV_NO_DATA,           /**< Channel không có trong scan list hoặc chưa có frame */
+    ADC_SCAN_SRV_BUSY               /**< Snapshot bị frame mới ghi đè liên tục */
+} adc_scan_srv_status_t;
+
+/**
+ * @brief Scan configuration
+ */
+typedef struct {
+    ADC_Instance_t instance;        /**< ADC instance (đã ADC_Init() + ADC_Calibrate()) */
+    uint8_t dma_channel;            /**< DMA channel thu frame */
+    const ADC_Channel_t *channels;  /**< Scan list theo thứ tự slot (AD0-15, TEMP_SENSOR, BANDGAP), không trùng */
+    uint8_t num_channels;           /**< 1 - ADC_SCAN_SRV_MAX_CHANNELS */
+    pdb_prescaler_t prescaler;      /**< PDB prescaler */
+    pdb_mult_t mult;                /**< PDB prescaler multiplier */
+    uint16_t modulus;               /**< Chu kỳ scan (PDB counts), phải dài hơn thời gian scan */
+    bool track_min_max;             /**< Cập nhật min / max theo channel */
+    const uint8_t *oversample_bits; /**< n theo slot (0 - ADC_SCAN_SRV_MAX_OVERSAMPLE_BITS), NULL = tắt */
+    ADC_AverageConfig_t hw_average; /**< Hardware averaging của instance (ghi vào SC3 khi Start) */
+    uint32_t vref_mv;               /**< VREFH nominal (0 = ADC_SCAN_SRV_DEFAULT_VREF_MV), thay bằng giá trị đo khi scan bandgap */
+} adc_scan_srv_config_t;
+
+/**
+ * @brief Frame hook (DMA ISR): frame của lần scan vừa xong, thứ tự scan list
+ * @param frame Giá trị raw (chỉ hợp lệ trong lúc hook chạy)
+ * @param count Số channel
+ */
+typedef void (*adc_scan_srv_frame_hook_t)(const uint16_t *frame, uint8_t count);
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Cấu hình scan group + DMA và bắt đầu scan liên tục
+ * @param config Scan configuration (channels phải tồn tại khi service chạy)
+ * @return adc_scan_srv_status_t ADC_SCAN_SRV_ERROR nếu config không hợp lệ
+ *         hoặc HAL từ chối (DMA stream đang chạy, AIEN set...)
+ */
+adc_scan_srv_status_t ADC_SCAN_SRV_Start(const adc_scan_srv_config_t *config);
+
+/**
+ * @brief Dừng DMA và scan group, bảng giá trị giữ lại giá trị cuối
+ * @return adc_scan_srv_status_t Status of operation
+ */
+adc_scan_srv_status_t ADC_SCAN_SRV_Stop(void);
+
+/**
+ * @brief Đọc giá trị mới nhất của channel (O(1), mọi context)
+ * @param channel ADC channel
+ * @param value   Kết quả conversion
+ * @return adc_scan_srv_status_t ADC_SCAN_SRV_NO_DATA nếu channel không được
+ *         scan hoặc chưa có frame nào
+ */
+adc_scan_srv_status_t ADC_SCAN_SRV_Read(ADC_Channel_t channel, uint16_t *value);
+
+/**
+ * @brief Đọc kết quả oversampling mới nhất của channel (O(1), mọi context)
+ * @details Cập nhật mỗi 4^n frame; n = 0 trả giá trị như ADC_SCAN_SRV_Read().
+ * @param channel ADC channel
+ * @param value   Kết quả 12 + n bit
+ * @param bits    Resolution của value (có thể NULL)
+ * @return adc_scan_srv_status_t ADC_SCAN_SRV_NO_DATA nếu chưa đủ 4^n frame
+ */
+adc_scan_srv_status_t ADC_SCAN_SRV_ReadOversampled(ADC_Channel_t channel, uint16_t *value,
+                                                   uint8_t *bits);
+
+/**
+ * @brief Đọc giá trị mới nhất của channel theo mV (multiply + shift)
+ * @param channel    ADC channel
+ * @param millivolts Điện áp theo VREFH đo qua bandgap (hoặc nominal)
+ * @return adc_scan_srv_status_t Như ADC_SCAN_SRV_Read()
+ */
+adc_scan_srv_status_t ADC_SCAN_SRV_ReadMillivolts(ADC_Channel_t channel, uint32_t *millivolts);
+
+/**
+ * @brief VREFH hiện tại
+ * @param millivolts VREFH (mV)
+ * @return adc_scan_srv_status_t ADC_SCAN_SRV_NO_DATA nếu đang là giá trị
+ *         nominal (bandgap không được scan hoặc chưa có frame)
+ */
+adc_scan_srv_status_t ADC_SCAN_SRV_GetVrefMillivolts(uint32_t *millivolts);
+
+/**
+ * @brief Nhiệt độ chip từ ADC_CHANNEL_TEMP_SENSOR
+ * @param deci_celsius Nhiệt độ (0.1 degC)
+ * @return adc_scan_srv_status_t ADC_SCAN_SRV_NO_DATA nếu temperature sensor
+ *         không có trong scan list
+ */
+adc_scan_srv_status_t ADC_SCAN_SRV_ReadTemperature(int32_t *deci_celsius);
+
+/**
+ * @brief Đọc min / max của channel từ lần reset trước
+ * @param channel ADC channel
+ * @param min     Giá trị nhỏ nhất
+ * @param max     Giá trị lớn nhất
+ * @return adc_scan_srv_status_t ADC_SCAN_SRV_ERROR nếu track_min_max = false
+ */
+adc_scan_srv_status_t ADC_SCAN_SRV_GetMinMax(ADC_Channel_t channel, uint16_t *min, uint16_t *max);
+
+/**
+ * @brief Yêu cầu reset min / max (ISR-safe)
+ * @details Áp dụng ở frame tiếp theo: min = max = giá trị của frame đó.
+ * @param channel ADC channel, ADC_CHANNEL_DISABLED = mọi channel
+ * @return adc_scan_srv_status_t Status of operation
+ */
+adc_scan_srv_status_t ADC_SCAN_SRV_ResetMinMax(ADC_Channel_t channel);
+
+/**
+ * @brief Copy cả frame mới nhất theo thứ tự scan list
+ * @details Nhất quán: mọi giá trị cùng một lần scan. Không gọi từ ISR có
+ *          priority cao hơn DMA ISR (luôn trả ADC_SCAN_SRV_BUSY khi chen
+ *          giữa lúc ISR đang ghi bảng).
+ * @param values Buffer num_channels phần tử
+ * @param frame  Số thứ tự frame (có thể NULL)
+ * @return adc_scan_srv_status_t Status of operation
+ */
+adc_scan_srv_status_t ADC_SCAN_SRV_GetSnapshot(uint16_t *values, uint32_t *frame);
+
+/**
+ * @brief Đăng ký hook nhận từng frame (vd. DATALOG_SRV_LogAdc)
+ * @details Hook chạy cuối DMA ISR, sau khi bảng latest-value đã cập nhật:
+ *          chỉ copy dữ liệu, không xử lý nặng.
+ * @param hook Frame hook (NULL để tắt)
+ */
+void ADC_SCAN_SRV_InstallFrameHook(adc_scan_srv_frame_hook_t hook);
+
+/**
+ * @brief Số frame đã nhận từ ADC_SCAN_SRV_Start()
+ * @return uint32_t Frame count
+ */
+uint32_t ADC_SCAN_SRV_GetFrameCount(void);
+
+/**
+ * @brief Số frame bị mất (DMA ISR trễ quá một chu kỳ scan)
+ * @return uint32_t Overrun count
+ */
+uint32_t ADC_SCAN_SRV_GetOverruns(void);
+
+#endif /* ADC_SCAN_SRV_H */
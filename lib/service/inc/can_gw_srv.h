@@ -0,0 +1,156 @@
+/**
+ * @file    can_gw_srv.h
+ * @brief   CAN Gateway Service - Table-driven CAN-to-CAN Routing
+ * @details
+ * Forward frame giữa CAN0 / CAN1 / CAN2 ngay trong RX ISR của can_srv
+ * (raw RX hook), không qua application và không giải mã thành message:
+ * 4 word của RX mailbox được copy thẳng sang TX mailbox của bus đích.
+ *
+ * Features:
+ * - Routing table const, sắp xếp theo (src, is_extended, id): lookup bằng
+ *   binary search, O(log n), không tốn RAM cho hash
+ * - Mỗi route: bus đích, ID remap tùy chọn, rate limit (khoảng cách tối
+ *   thiểu giữa hai frame forward), copy tùy chọn vào RX ring local
+ * - TX pool riêng trên mỗi bus đích (CAN_GW_SRV_FIRST_MB ..), nằm ngoài
+ *   mailbox của can_srv và can_sched_srv
+ * - Frame không có route đi vào RX ring của can_srv như bình thường
+ *
+ * @code
+ * static const can_gw_srv_route_t s_routes[] = {     // sorted
+ *     { .src = CAN_SRV_CAN0, .dst = CAN_SRV_CAN1, .id = 0x100U, .remap_id = CAN_GW_SRV_NO_REMAP },
+ *     { .src = CAN_SRV_CAN0, .dst = CAN_SRV_CAN1, .id = 0x3E0U, .remap_id = 0x3E8U,
+ *       .min_interval_ms = 100U },
+ *     { .src = CAN_SRV_CAN1, .dst = CAN_SRV_CAN0, .id = 0x200U, .remap_id = CAN_GW_SRV_NO_REMAP,
+ *       .flags = CAN_GW_SRV_FLAG_LOCAL },
+ * };
+ * static can_gw_srv_route_state_t s_route_state[3];
+ *
+ * CAN_SRV_Init(CAN_SRV_CAN0, &cfg0);                  // filter_mask = 0: nhận mọi ID
+ * CAN_SRV_Init(CAN_SRV_CAN1, &cfg1);
+ * CAN_GW_SRV_SetTimeSource(TIME_SRV_GetMicros32);
+ * CAN_GW_SRV_Init(s_routes, s_route_state, 3U);
+ * @endcode
+ *
+ * @note Latency ISR path: 4 word read + binary search + 4 word write, vài µs
+ *       @ 80 MHz, thấp hơn nhiều so với 50 µs. Frame chỉ được forward khi
+ *       bus đích có TX MB trống, ngược lại bị drop và đếm (không queue, không
+ *       gửi dữ liệu cũ trễ).
+ * @note RX filter của can_srv trên bus nguồn phải nhận các ID có route.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+#ifndef CAN_GW_SRV_H
+#define CAN_GW_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "can_srv.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief MB đầu tiên của TX pool gateway trên mỗi bus đích */
+#ifndef CAN_GW_SRV_FIRST_MB
+#define CAN_GW_SRV_FIRST_MB         (13U)
+#endif
+
+/** @brief Số TX mailbox của pool gateway */
+#ifndef CAN_GW_SRV_MB_COUNT
+#define CAN_GW_SRV_MB_COUNT         (3U)
+#endif
+
+/** @brief remap_id: giữ nguyên ID */
+#define CAN_GW_SRV_NO_REMAP         (0xFFFFFFFFUL)
+
+/** @brief Route flag: frame cũng được đưa vào RX ring của bus nguồn */
+#define CAN_GW_SRV_FLAG_LOCAL       (0x01U)
+
+/**
+ * @brief CAN gateway service status codes
+ */
+typedef enum {
+    CAN_GW_SRV_SUCCESS = 0,
+    CAN_GW_SRV_ERROR,
+    CAN_GW_SRV_NOT_INITIALIZED
+} can_gw_srv_status_t;
+
+/**
+ * @brief Time source (us, free running), vd. TIME_SRV_GetMicros32
+ */
+typedef uint32_t (*can_gw_srv_time_source_t)(void);
+
+/**
+ * @brief Route entry
+ * @note Table sắp xếp tăng dần theo src, rồi is_extended (11-bit trước), rồi id
+ */
+typedef struct {
+    can_srv_instance_t src;         /**< Bus nguồn */
+    can_srv_instance_t dst;         /**< Bus đích (khác src) */
+    uint32_t id;                    /**< 11-bit hoặc 29-bit ID trên bus nguồn */
+    bool is_extended;               /**< true = 29-bit ID */
+    uint32_t remap_id;              /**< ID trên bus đích, CAN_GW_SRV_NO_REMAP = giữ nguyên */
+    uint16_t min_interval_ms;       /**< Rate limit, 0 = không giới hạn (cần time source) */
+    uint8_t flags;                  /**< CAN_GW_SRV_FLAG_x */
+} can_gw_srv_route_t;
+
+/**
+ * @brief Route statistics / state (application cấp phát, một phần tử mỗi route)
+ */
+typedef struct {
+    uint32_t forwarded;             /**< Frame đã nạp vào TX MB bus đích */
+    uint32_t rate_limited;          /**< Frame bỏ qua do rate limit */
+    uint32_t dropped;               /**< Frame bỏ qua do TX pool bus đích đầy */
+    uint32_t last_us;               /**< Private: thời điểm forward trước */
+} can_gw_srv_route_state_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Nạp routing table và gắn raw RX hook vào các bus nguồn
+ * @details Bus nguồn / đích phải được CAN_SRV_Init() trước. TX pool của
+ *          mọi bus đích được set TX_INACTIVE.
+ * @param routes Routing table (sorted, giữ nguyên trong suốt thời gian chạy)
+ * @param states State array, count phần tử
+ * @param count Số route
+ * @return can_gw_srv_status_t CAN_GW_SRV_ERROR nếu table không sorted, có
+ *         route trùng / src = dst, CAN_GW_SRV_NOT_INITIALIZED nếu bus chưa init
+ */
+can_gw_srv_status_t CAN_GW_SRV_Init(const can_gw_srv_route_t *routes,
+                                    can_gw_srv_route_state_t *states, uint16_t count);
+
+/**
+ * @brief Gỡ raw RX hook, frame quay về RX ring của can_srv
+ */
+void CAN_GW_SRV_Deinit(void);
+
+/**
+ * @brief Đăng ký time source cho rate limit (NULL = rate limit tắt)
+ * @param source Time source function
+ */
+void CAN_GW_SRV_SetTimeSource(can_gw_srv_time_source_t source);
+
+/**
+ * @brief Lấy statistics của route
+ * @param route Index trong routing table
+ * @return Pointer tới state, NULL nếu index không hợp lệ
+ */
+const can_gw_srv_route_state_t *CAN_GW_SRV_GetStats(uint16_t route);
+
+/**
+ * @brief Raw RX hook (đăng ký bởi CAN_GW_SRV_Init(), interrupt context)
+ * @param instance Bus nguồn
+ * @param mb_words CS, ID, DATA0, DATA1
+ * @return true nếu frame chỉ được forward (không đưa vào RX ring)
+ */
+bool CAN_GW_SRV_RxHook(can_srv_instance_t instance, const uint32_t *mb_words);
+
+#endif /* CAN_GW_SRV_H */
@@ -0,0 +1,198 @@
+/**
+ * @file    can_sched_srv.h
+ * @brief   CAN Periodic TX Scheduler Service - API
+ * @details
+ * Scheduler cho các frame CAN định kỳ (kiểu J1939 / CANopen PDO), thay cho
+ * việc gọi CAN_SRV_Send() thủ công từ superloop cho từng message.
+ *
+ * Features:
+ * - Mỗi message là một soft timer của timer_srv: period drift-free
+ *   (expires += period), launch trong LPIT interrupt context
+ * - Offset tự động (stagger): hai chuỗi period p1, p2 với offset o1, o2 trùng
+ *   tick khi (o1 - o2) chia hết cho gcd(p1, p2); offset được chọn để số
+ *   message trùng tick là ít nhất
+ * - Mailbox image (CS, ID, 2 data word big-endian) build sẵn khi Add / Update,
+ *   callback chỉ copy 4 word vào một TX mailbox trống của pool
+ * - Frame không có mailbox trống bị bỏ qua (không gửi dữ liệu cũ trễ), đếm
+ *   trong missed
+ * - Đo jitter launch (us) mỗi message khi có time source
+ *
+ * Dùng pool CAN0 MB CAN_SCHED_SRV_FIRST_MB..+CAN_SCHED_SRV_MB_COUNT, nằm ngoài
+ * RX MB / TX pool của can_srv (mặc định MB4 / MB8) và trong MAXMB = 15.
+ *
+ * @note Jitter chủ yếu là latency của LPIT interrupt: để jitter < 100 us,
+ *       LPIT channel của timer_srv cần priority cao hơn các ISR dài
+ *       (DMA, UART) và các critical section trong application phải ngắn.
+ *
+ * @code
+ * static can_sched_srv_msg_t s_engine;
+ * const can_sched_srv_msg_config_t engine_cfg = {
+ *     .id = 0x0CF00400UL, .is_extended = true, .length = 8U,
+ *     .period_ms = 10U, .offset_ms = CAN_SCHED_SRV_OFFSET_AUTO, .data = NULL
+ * };
+ *
+ * CAN_SRV_Init(CAN_SRV_CAN0, &can_cfg);
+ * TIMER_SRV_Init(0U);
+ * CAN_SCHED_SRV_Init();
+ * CAN_SCHED_SRV_SetTimeSource(TIME_SRV_GetMicros32);
+ * CAN_SCHED_SRV_Add(&s_engine, &engine_cfg);
+ * CAN_SCHED_SRV_Start();
+ *
+ * for (;;) {
+ *     ENGINE_Pack(payload, &engine);
+ *     CAN_SCHED_SRV_Update(&s_engine, payload);
+ * }
+ * @endcode
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+#ifndef CAN_SCHED_SRV_H
+#define CAN_SCHED_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "timer_srv.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief MB đầu tiên của TX pool (CAN0) */
+#ifndef CAN_SCHED_SRV_FIRST_MB
+#define CAN_SCHED_SRV_FIRST_MB          (9U)
+#endif
+
+/** @brief Số TX mailbox của pool */
+#ifndef CAN_SCHED_SRV_MB_COUNT
+#define CAN_SCHED_SRV_MB_COUNT          (4U)
+#endif
+
+/** @brief Giới hạn số offset thử khi stagger (ticks), giữ Add() ngắn với period dài */
+#ifndef CAN_SCHED_SRV_OFFSET_SEARCH
+#define CAN_SCHED_SRV_OFFSET_SEARCH     (100U)
+#endif
+
+/** @brief offset_ms: để scheduler chọn offset */
+#define CAN_SCHED_SRV_OFFSET_AUTO       (0xFFFFFFFFUL)
+
+/**
+ * @brief CAN scheduler service status codes
+ */
+typedef enum {
+    CAN_SCHED_SRV_SUCCESS = 0,
+    CAN_SCHED_SRV_ERROR,
+    CAN_SCHED_SRV_NOT_INITIALIZED
+} can_sched_srv_status_t;
+
+/**
+ * @brief Time source (us, free running), vd. TIME_SRV_GetMicros32
+ */
+typedef uint32_t (*can_sched_srv_time_source_t)(void);
+
+/**
+ * @brief Periodic message configuration
+ */
+typedef struct {
+    uint32_t id;                    /**< 11-bit hoặc 29-bit ID */
+    bool is_extended;               /**< true = 29-bit ID */
+    uint8_t length;                 /**< DLC (0-8) */
+    uint32_t period_ms;             /**< Period (ms), > 0 */
+    uint32_t offset_ms;             /**< Offset từ CAN_SCHED_SRV_Start(), hoặc CAN_SCHED_SRV_OFFSET_AUTO */
+    const uint8_t *data;            /**< Payload ban đầu, NULL = 0 */
+} can_sched_srv_msg_config_t;
+
+/**
+ * @brief Message statistics
+ */
+typedef struct {
+    uint32_t sent;                  /**< Frame đã nạp vào mailbox */
+    uint32_t missed;                /**< Period bị bỏ qua do pool đầy */
+    uint32_t jitter_max_us;         /**< |interval - period| lớn nhất, 0 nếu không có time source */
+} can_sched_srv_stats_t;
+
+typedef struct can_sched_srv_msg can_sched_srv_msg_t;
+
+/**
+ * @brief Periodic message object
+ * @details Do application cấp phát; các field là private của service.
+ */
+struct can_sched_srv_msg {
+    timer_srv_timer_t timer;        /**< Soft timer của message */
+    can_sched_srv_msg_t *next;      /**< Scheduler list */
+    uint32_t cs;                    /**< Mailbox CS image (CODE = TX_DATA) */
+    uint32_t id;                    /**< Mailbox ID image */
+    volatile uint32_t word[2];      /**< Mailbox data words (big-endian) */
+    uint32_t period;                /**< Period (ticks) */
+    uint32_t offset;                /**< Offset (ticks) */
+    uint32_t last_us;               /**< Thời điểm launch trước */
+    can_sched_srv_stats_t stats;    /**< Statistics */
+};
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Khởi tạo scheduler, set pool mailbox về TX_INACTIVE
+ * @details CAN_SRV_Init(CAN_SRV_CAN0, ...) và TIMER_SRV_Init() phải được gọi trước.
+ * @return can_sched_srv_status_t Status of operation
+ */
+can_sched_srv_status_t CAN_SCHED_SRV_Init(void);
+
+/**
+ * @brief Đăng ký time source để đo jitter
+ * @param source Time source (NULL để tắt)
+ * @return can_sched_srv_status_t Status of operation
+ */
+can_sched_srv_status_t CAN_SCHED_SRV_SetTimeSource(can_sched_srv_time_source_t source);
+
+/**
+ * @brief Thêm message vào scheduler, build mailbox image và chọn offset
+ * @details Gọi trước CAN_SCHED_SRV_Start(). Với CAN_SCHED_SRV_OFFSET_AUTO,
+ *          offset là giá trị trong [0, min(period, CAN_SCHED_SRV_OFFSET_SEARCH))
+ *          trùng tick với ít message đã thêm nhất; thêm message period ngắn trước.
+ * @param msg    Message object
+ * @param config Message configuration
+ * @return can_sched_srv_status_t Status of operation
+ */
+can_sched_srv_status_t CAN_SCHED_SRV_Add(can_sched_srv_msg_t *msg, const can_sched_srv_msg_config_t *config);
+
+/**
+ * @brief Start tất cả message, offset tính từ tick hiện tại
+ * @return can_sched_srv_status_t Status of operation
+ */
+can_sched_srv_status_t CAN_SCHED_SRV_Start(void);
+
+/**
+ * @brief Stop tất cả message (frame đã nạp vào mailbox vẫn được gửi)
+ */
+void CAN_SCHED_SRV_Stop(void);
+
+/**
+ * @brief Cập nhật payload, có hiệu lực từ lần launch kế tiếp
+ * @param msg  Message object
+ * @param data length bytes theo config
+ * @return can_sched_srv_status_t Status of operation
+ */
+can_sched_srv_status_t CAN_SCHED_SRV_Update(can_sched_srv_msg_t *msg, const uint8_t *data);
+
+/**
+ * @brief Đọc statistics của message
+ * @param msg   Message object
+ * @param stats Pointer nhận statistics
+ * @return can_sched_srv_status_t Status of operation
+ */
+can_sched_srv_status_t CAN_SCHED_SRV_GetStats(const can_sched_srv_msg_t *msg, can_sched_srv_stats_t *stats);
+
+/**
+ * @brief Reset statistics và mốc đo jitter của tất cả message
+ */
+void CAN_SCHED_SRV_ResetStats(void);
+
+#endif /* CAN_SCHED_SRV_H */
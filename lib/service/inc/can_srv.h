@@ -10,6 +10,30 @@
  * - Message transmission
  * - Message reception
  * - RX callback support
+ * - Interrupt-driven RX ring buffer với batch drain
+ * - Zero-copy peek / release message ngay trong ring (CAN_SRV_PeekRx)
+ * - TX / RX hook cho secure onboard communication (MAC append / verify,
+ *   vd. secoc_srv)
+ * - Multi-instance: CAN0 / CAN1 / CAN2 chạy song song, mỗi instance có
+ *   state, RX ring, TX queue và hook riêng, cùng một code path
+ * - Mailbox partition: RX MB (CAN_SRV_RX_MB) và TX MB pool
+ *   (CAN_SRV_TX_MB_FIRST .. + CAN_SRV_TX_MB_COUNT), TX queue được ISR
+ *   nạp vào MB khi MB rảnh
+ * 
+ * @code
+ * // Gateway 3 bus: mỗi vector gọi handler với instance của nó
+ * void CAN0_ORed_0_15_MB_IRQHandler(void) { CAN_SRV_IRQHandler(CAN_SRV_CAN0); }
+ * void CAN1_ORed_0_15_MB_IRQHandler(void) { CAN_SRV_IRQHandler(CAN_SRV_CAN1); }
+ * void CAN2_ORed_0_15_MB_IRQHandler(void) { CAN_SRV_IRQHandler(CAN_SRV_CAN2); }
+ * 
+ * CAN_SRV_Init(CAN_SRV_CAN0, &pt_cfg);
+ * CAN_SRV_Init(CAN_SRV_CAN1, &body_cfg);
+ * 
+ * while ((msg = CAN_SRV_PeekRx(CAN_SRV_CAN0)) != NULL) {
+ *     (void)CAN_SRV_Send(CAN_SRV_CAN1, msg);
+ *     CAN_SRV_ReleaseRx(CAN_SRV_CAN0);
+ * }
+ * @endcode
  * 
  * @author  PhucPH32
  * @date    05/12/2025
@@ -29,6 +53,59 @@
  * Definitions
  ******************************************************************************/
 
+/**
+ * @brief Số message tối đa trong RX ring buffer
+ * @note Phải là lũy thừa của 2. Ring giữ tối đa CAN_SRV_RX_RING_SIZE message.
+ */
+#ifndef CAN_SRV_RX_RING_SIZE
+#define CAN_SRV_RX_RING_SIZE    (32U)
+#endif
+
+/**
+ * @brief Số message tối đa chờ trong TX queue của mỗi instance
+ * @note Phải là lũy thừa của 2
+ */
+#ifndef CAN_SRV_TX_QUEUE_SIZE
+#define CAN_SRV_TX_QUEUE_SIZE   (16U)
+#endif
+
+/**
+ * @brief Số instance được cấp state (1 - 3, CAN0 .. CAN2)
+ * @note Mỗi instance tốn RX ring + TX queue trong RAM, giảm để tiết kiệm
+ */
+#ifndef CAN_SRV_INSTANCE_COUNT
+#define CAN_SRV_INSTANCE_COUNT  (3U)
+#endif
+
+/** @brief RX mailbox (filter của can_srv_config_t) */
+#ifndef CAN_SRV_RX_MB
+#define CAN_SRV_RX_MB           (4U)
+#endif
+
+/** @brief TX mailbox đầu tiên của pool */
+#ifndef CAN_SRV_TX_MB_FIRST
+#define CAN_SRV_TX_MB_FIRST     (8U)
+#endif
+
+/**
+ * @brief Số TX mailbox của pool
+ * @note Nhiều MB tăng throughput nhưng FlexCAN chọn frame theo ID / số MB,
+ *       frame cùng ID có thể ra bus sai thứ tự (vd. ISO-TP CF). Giữ 1 khi
+ *       cần thứ tự FIFO.
+ */
+#ifndef CAN_SRV_TX_MB_COUNT
+#define CAN_SRV_TX_MB_COUNT     (1U)
+#endif
+
+/**
+ * @brief CAN service instance
+ */
+typedef enum {
+    CAN_SRV_CAN0 = 0,               /**< FlexCAN0 */
+    CAN_SRV_CAN1 = 1,               /**< FlexCAN1 */
+    CAN_SRV_CAN2 = 2                /**< FlexCAN2 */
+} can_srv_instance_t;
+
 /**
  * @brief CAN service status codes
  */
@@ -46,6 +123,8 @@ typedef struct {
     uint8_t data[8];                /**< Data bytes */
     uint8_t length;                 /**< Data length (0-8) */
     bool isExtended;                /**< true = 29-bit ID, false = 11-bit ID */
+    uint16_t timeStamp;             /**< RX: MB TIME_STAMP (bit times, free running timer) */
+    uint32_t timestampUs;           /**< RX: thời điểm nhận theo time source (us), 0 nếu chưa đăng ký */
 } can_srv_message_t;
 
 /**
@@ -63,36 +142,173 @@ typedef struct {
  */
 typedef void (*can_srv_rx_callback_t)(const can_srv_message_t *msg);
 
+/**
+ * @brief TX hook: sửa message ngay trước khi nạp mailbox (vd. append MAC)
+ * @param msg Bản copy của message, hook được đổi data / length (<= 8)
+ * @return false để hủy frame (CAN_SRV_Send trả CAN_SRV_ERROR)
+ */
+typedef bool (*can_srv_tx_hook_t)(can_srv_message_t *msg);
+
+/**
+ * @brief RX hook: kiểm tra / sửa message trước khi trả cho application
+ * @param msg Message nhận được, hook được đổi data / length (vd. bỏ MAC)
+ * @return false để drop frame (vd. MAC sai), đếm trong CAN_SRV_GetRxRejectCount()
+ */
+typedef bool (*can_srv_rx_hook_t)(can_srv_message_t *msg);
+
+/**
+ * @brief Raw RX hook: chạy trong CAN_SRV_IRQHandler() trên 4 word của RX mailbox
+ * @param instance Instance nhận frame
+ * @param mb_words CS, ID, DATA0, DATA1 (layout FlexCAN, data big-endian)
+ * @return true nếu frame đã được xử lý (không đưa vào RX ring)
+ */
+typedef bool (*can_srv_raw_rx_hook_t)(can_srv_instance_t instance, const uint32_t *mb_words);
+
+/**
+ * @brief Time source type, trả về bộ đếm microsecond free running
+ */
+typedef uint32_t (*can_srv_time_source_t)(void);
+
 /*******************************************************************************
  * API Function Declarations
  ******************************************************************************/
 
 /**
  * @brief Initialize CAN service với config struct
+ * @param instance CAN instance (< CAN_SRV_INSTANCE_COUNT)
  * @param config Pointer to CAN configuration structure
  * @return can_srv_status_t Status of initialization
+ * @note PCC clock của FlexCAN phải được bật trước
  */
-can_srv_status_t CAN_SRV_Init(const can_srv_config_t *config);
+can_srv_status_t CAN_SRV_Init(can_srv_instance_t instance, const can_srv_config_t *config);
 
 /**
  * @brief Send CAN message
+ * @details Nạp thẳng vào TX MB khi queue rỗng và có MB rảnh, ngược lại
+ *          đưa vào TX queue; CAN_SRV_IRQHandler() nạp tiếp khi MB gửi xong.
+ *          ISR-safe (critical section ngắn quanh MB / queue).
+ * @param instance CAN instance
  * @param msg Pointer to message structure
- * @return can_srv_status_t Status of operation
+ * @return can_srv_status_t CAN_SRV_ERROR khi mọi TX MB bận và queue đầy
  */
-can_srv_status_t CAN_SRV_Send(const can_srv_message_t *msg);
+can_srv_status_t CAN_SRV_Send(can_srv_instance_t instance, const can_srv_message_t *msg);
 
 /**
  * @brief Receive CAN message
+ * @details Pop từ RX ring, frame chỉ vào ring qua CAN_SRV_IRQHandler()
+ *          (MB interrupt phải được enable ở NVIC).
+ * @param instance CAN instance
  * @param msg Pointer to store received message
  * @return can_srv_status_t Status of operation
  */
-can_srv_status_t CAN_SRV_Receive(can_srv_message_t *msg);
+can_srv_status_t CAN_SRV_Receive(can_srv_instance_t instance, can_srv_message_t *msg);
 
 /**
  * @brief Register RX callback
+ * @param instance CAN instance
  * @param callback Callback function for received messages
  * @return can_srv_status_t Status of operation
  */
-can_srv_status_t CAN_SRV_RegisterCallback(can_srv_rx_callback_t callback);
+can_srv_status_t CAN_SRV_RegisterCallback(can_srv_instance_t instance, can_srv_rx_callback_t callback);
+
+/**
+ * @brief Đăng ký time source để mở rộng timestamp 16-bit của FlexCAN (mọi instance)
+ * @details timestampUs = time_source() - (TIMER - TIME_STAMP) * bit_time.
+ *          Message phải được đọc trong vòng 65536 bit times (131 ms @ 500 kbps),
+ *          ISR path (CAN_SRV_IRQHandler) luôn thỏa điều kiện này.
+ * @param source Time source function (NULL để tắt)
+ * @return can_srv_status_t Status of operation
+ */
+can_srv_status_t CAN_SRV_RegisterTimeSource(can_srv_time_source_t source);
+
+/**
+ * @brief Đăng ký TX / RX hook
+ * @details Hook chạy trong context của CAN_SRV_Send() / CAN_SRV_Receive() /
+ *          CAN_SRV_ReceiveBatch() (main loop), không chạy trong ISR. TX hook chỉ
+ *          được gọi khi TX mailbox trống, mỗi lần gọi là một frame thực sự được gửi.
+ * @param instance CAN instance
+ * @param tx_hook TX hook (NULL để tắt)
+ * @param rx_hook RX hook (NULL để tắt)
+ * @return can_srv_status_t Status of operation
+ * @note CAN_SRV_PeekRx() là đường zero-copy, không qua RX hook
+ */
+can_srv_status_t CAN_SRV_RegisterHooks(can_srv_instance_t instance,
+                                       can_srv_tx_hook_t tx_hook, can_srv_rx_hook_t rx_hook);
+
+/**
+ * @brief Đăng ký raw RX hook (interrupt context, vd. can_gw_srv)
+ * @details Hook chạy trước khi frame được giải mã vào RX ring, chỉ trên ISR
+ *          path. Frame hook trả false đi tiếp vào ring như bình thường.
+ * @param instance CAN instance
+ * @param hook Raw RX hook (NULL để tắt)
+ * @return can_srv_status_t Status of operation
+ */
+can_srv_status_t CAN_SRV_RegisterRawRxHook(can_srv_instance_t instance, can_srv_raw_rx_hook_t hook);
+
+/**
+ * @brief Lấy số message bị RX hook từ chối
+ * @param instance CAN instance
+ * @return Số message bị drop kể từ khi init
+ */
+uint32_t CAN_SRV_GetRxRejectCount(can_srv_instance_t instance);
+
+/**
+ * @brief Drain nhiều message từ RX ring buffer trong một lần gọi
+ * @details Ring được ISR (CAN_SRV_IRQHandler) ghi vào, main loop đọc ra.
+ *          Single-producer/single-consumer nên không cần disable interrupt.
+ * @param instance CAN instance
+ * @param msgs Mảng nhận message
+ * @param max_count Số phần tử tối đa của msgs
+ * @param count Pointer nhận số message đã copy (0 nếu ring rỗng)
+ * @return can_srv_status_t Status of operation
+ * @note RX callback không được gọi cho message lấy qua batch API
+ */
+can_srv_status_t CAN_SRV_ReceiveBatch(can_srv_instance_t instance, can_srv_message_t *msgs,
+                                      uint32_t max_count, uint32_t *count);
+
+/**
+ * @brief Xem message cũ nhất ngay trong RX ring buffer (không copy)
+ * @details Slot thuộc về consumer cho tới CAN_SRV_ReleaseRx(), ISR không
+ *          ghi đè slot đang peek.
+ * @param instance CAN instance
+ * @return Pointer tới message, NULL nếu ring rỗng hoặc chưa init
+ * @note RX callback không được gọi cho message lấy qua peek API
+ */
+const can_srv_message_t *CAN_SRV_PeekRx(can_srv_instance_t instance);
+
+/**
+ * @brief Giải phóng message trả về bởi CAN_SRV_PeekRx()
+ * @param instance CAN instance
+ */
+void CAN_SRV_ReleaseRx(can_srv_instance_t instance);
+
+/**
+ * @brief Lấy số message bị mất do RX ring buffer đầy
+ * @param instance CAN instance
+ * @return Số message bị drop kể từ khi init
+ */
+uint32_t CAN_SRV_GetRxOverflowCount(can_srv_instance_t instance);
+
+/**
+ * @brief Kiểm tra instance đã được CAN_SRV_Init()
+ * @param instance CAN instance
+ */
+bool CAN_SRV_IsInitialized(can_srv_instance_t instance);
+
+/**
+ * @brief Số message đang chờ trong TX queue (chưa nạp vào MB)
+ * @param instance CAN instance
+ */
+uint32_t CAN_SRV_GetTxQueueCount(can_srv_instance_t instance);
+
+/**
+ * @brief CAN MB interrupt handler
+ * @details RX: copy message từ RX mailbox vào ring buffer và clear flag.
+ *          TX: clear flag của TX pool, nạp message kế tiếp từ TX queue.
+ *          Không gọi callback trong ISR, việc xử lý được dời về main loop.
+ * @param instance CAN instance
+ * @note User should call this from CANx_ORed_0_15_MB_IRQHandler() in application
+ */
+void CAN_SRV_IRQHandler(can_srv_instance_t instance);
 
 #endif /* CAN_SRV_H */
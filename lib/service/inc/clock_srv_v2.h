@@ -12,10 +12,25 @@
  * - Runtime clock switching
  * - Clock monitoring và validation
  * - Peripheral clock source selection
+ * - Compile-time configuration: preset table + _Static_assert trên VCO range
+ *   và divider limits, boot không cần strcmp / runtime validation
+ *
+ * @code
+ * // Custom config, validate lúc build
+ * CLOCK_SRV_V2_STATIC_ASSERT_SPLL(8000000UL, CLOCK_SRV_V2_SPLL_PREDIV_1, 30U);
+ * CLOCK_SRV_V2_STATIC_ASSERT_SYSCLK(CLOCK_SRV_V2_SPLL_OUT_HZ(8000000UL, CLOCK_SRV_V2_SPLL_PREDIV_1, 30U),
+ *                                   CLOCK_SRV_V2_DIV_2, CLOCK_SRV_V2_DIV_4, CLOCK_SRV_V2_DIV_8,
+ *                                   CLOCK_SRV_V2_LIMITS_RUN);
+ * static const clock_srv_v2_config_t s_clock_cfg = { ... };
+ * CLOCK_SRV_V2_InitStatic(&s_clock_cfg);
+ *
+ * // Hoặc preset có sẵn
+ * CLOCK_SRV_V2_InitPresetId(CLOCK_SRV_V2_PRESET_RUN_80MHZ);
+ * @endcode
  * 
  * @author  PhucPH32
- * @date    05/12/2025
- * @version 2.0
+ * @date    14/10/2026
+ * @version 2.1
  */
 
 #ifndef CLOCK_SRV_V2_H
@@ -198,6 +213,80 @@ typedef enum {
     CLOCK_SRV_V2_LPUART2
 } clock_srv_v2_peripheral_t;
 
+/**
+ * @brief Preset configurations (static table, đã validate lúc build)
+ */
+typedef enum {
+    CLOCK_SRV_V2_PRESET_RUN_80MHZ = 0,  /**< SOSC 8 MHz -> SPLL 160 MHz, core 80 / bus 40 / slow 20 MHz */
+    CLOCK_SRV_V2_PRESET_RUN_48MHZ,      /**< FIRC 48 MHz, core 48 / bus 48 / slow 24 MHz */
+    CLOCK_SRV_V2_PRESET_HSRUN_112MHZ,   /**< SOSC 8 MHz -> SPLL 112 MHz, core 112 / bus 56 / slow 28 MHz (HSRUN) */
+    CLOCK_SRV_V2_PRESET_VLPR_4MHZ,      /**< SIRC 8 MHz, core 4 / bus 4 / slow 1 MHz */
+    CLOCK_SRV_V2_PRESET_COUNT
+} clock_srv_v2_preset_t;
+
+/*******************************************************************************
+ * Compile-time Validation
+ ******************************************************************************/
+
+/** @brief SPLL VCO range (Hz) */
+#define CLOCK_SRV_V2_SPLL_VCO_MIN_HZ    (180000000UL)
+#define CLOCK_SRV_V2_SPLL_VCO_MAX_HZ    (320000000UL)
+
+/** @brief Clock limits theo run mode: core, bus, slow (Hz) */
+#define CLOCK_SRV_V2_LIMITS_RUN         80000000UL, 48000000UL, 26670000UL
+#define CLOCK_SRV_V2_LIMITS_HSRUN       112000000UL, 56000000UL, 28000000UL
+#define CLOCK_SRV_V2_LIMITS_VLPR        4000000UL, 4000000UL, 1000000UL
+
+/** @brief Hệ số chia của divider enum (DIV_DISABLE = 0) */
+#define CLOCK_SRV_V2_DIV_VALUE(div) \
+    (((uint32_t)(div) == 0U) ? 0UL : (1UL << ((uint32_t)(div) - 1U)))
+
+/** @brief SPLL VCO = SOSC / (PREDIV + 1) * MULT */
+#define CLOCK_SRV_V2_SPLL_VCO_HZ(sosc_hz, prediv, mult) \
+    (((uint32_t)(sosc_hz) / ((uint32_t)(prediv) + 1U)) * (uint32_t)(mult))
+
+/** @brief SPLL_CLK = VCO / 2 */
+#define CLOCK_SRV_V2_SPLL_OUT_HZ(sosc_hz, prediv, mult) \
+    (CLOCK_SRV_V2_SPLL_VCO_HZ(sosc_hz, prediv, mult) / 2U)
+
+/** @brief Clock sau divider (DIV_DISABLE -> 0) */
+#define CLOCK_SRV_V2_DIVIDED_HZ(hz, div) \
+    ((CLOCK_SRV_V2_DIV_VALUE(div) == 0UL) ? 0UL : ((uint32_t)(hz) / CLOCK_SRV_V2_DIV_VALUE(div)))
+
+/**
+ * @brief Compile error nếu SPLL ngoài spec (MULT 16-47, VCO 180-320 MHz)
+ * @note Dùng ở file scope, tham số phải là constant expression
+ */
+#define CLOCK_SRV_V2_STATIC_ASSERT_SPLL(sosc_hz, prediv, mult)                                       \
+    _Static_assert(((mult) >= 16U) && ((mult) <= 47U), "SPLL multiplier must be 16-47");            \
+    _Static_assert((uint32_t)(prediv) <= (uint32_t)CLOCK_SRV_V2_SPLL_PREDIV_8, "SPLL prediv 1-8");  \
+    _Static_assert((CLOCK_SRV_V2_SPLL_VCO_HZ(sosc_hz, prediv, mult) >= CLOCK_SRV_V2_SPLL_VCO_MIN_HZ) && \
+                   (CLOCK_SRV_V2_SPLL_VCO_HZ(sosc_hz, prediv, mult) <= CLOCK_SRV_V2_SPLL_VCO_MAX_HZ),   \
+                   "SPLL VCO must be 180-320 MHz")
+
+/**
+ * @brief Compile error nếu core / bus / slow vượt limit của mode
+ * @param sys_hz  Clock của system source
+ * @param limits  CLOCK_SRV_V2_LIMITS_RUN / _HSRUN / _VLPR
+ * @note DIVCORE / DIVBUS 1-16, DIVSLOW 1-8; bus và slow không nhanh hơn core
+ */
+#define CLOCK_SRV_V2_STATIC_ASSERT_SYSCLK(sys_hz, core_div, bus_div, slow_div, limits) \
+    CLOCK_SRV_V2_STATIC_ASSERT_SYSCLK_(sys_hz, core_div, bus_div, slow_div, limits)
+
+/* Indirection để limits được tách thành 3 tham số */
+#define CLOCK_SRV_V2_STATIC_ASSERT_SYSCLK_(sys_hz, core_div, bus_div, slow_div, core_max, bus_max, slow_max) \
+    _Static_assert(((uint32_t)(core_div) >= (uint32_t)CLOCK_SRV_V2_DIV_1) &&                      \
+                   ((uint32_t)(core_div) <= (uint32_t)CLOCK_SRV_V2_DIV_16), "DIVCORE must be 1-16"); \
+    _Static_assert(((uint32_t)(bus_div) >= (uint32_t)CLOCK_SRV_V2_DIV_1) &&                       \
+                   ((uint32_t)(bus_div) <= (uint32_t)CLOCK_SRV_V2_DIV_16), "DIVBUS must be 1-16");  \
+    _Static_assert(((uint32_t)(slow_div) >= (uint32_t)CLOCK_SRV_V2_DIV_1) &&                      \
+                   ((uint32_t)(slow_div) <= (uint32_t)CLOCK_SRV_V2_DIV_8), "DIVSLOW must be 1-8");  \
+    _Static_assert(CLOCK_SRV_V2_DIVIDED_HZ(sys_hz, core_div) <= (core_max), "Core clock over limit"); \
+    _Static_assert(CLOCK_SRV_V2_DIVIDED_HZ(sys_hz, bus_div) <= (bus_max), "Bus clock over limit");    \
+    _Static_assert(CLOCK_SRV_V2_DIVIDED_HZ(sys_hz, slow_div) <= (slow_max), "Slow clock over limit"); \
+    _Static_assert(((uint32_t)(bus_div) >= (uint32_t)(core_div)) &&                                \
+                   ((uint32_t)(slow_div) >= (uint32_t)(core_div)), "Bus / slow faster than core")
+
 /*******************************************************************************
  * API Function Declarations
  ******************************************************************************/
@@ -213,9 +302,26 @@ clock_srv_v2_status_t CLOCK_SRV_V2_Init(const clock_srv_v2_config_t *config);
  * @brief Initialize với preset configuration (helper)
  * @param preset_name Preset name: "RUN_80MHz", "RUN_48MHz", "HSRUN_112MHz", "VLPR_4MHz"
  * @return clock_srv_v2_status_t Status of initialization
+ * @note Giữ cho code cũ; boot path nên dùng CLOCK_SRV_V2_InitPresetId()
  */
 clock_srv_v2_status_t CLOCK_SRV_V2_InitPreset(const char *preset_name);
 
+/**
+ * @brief Initialize với preset từ static table, không strcmp / validation
+ * @param preset Preset ID
+ * @return CLOCK_SRV_V2_INVALID_CONFIG nếu preset ngoài range
+ */
+clock_srv_v2_status_t CLOCK_SRV_V2_InitPresetId(clock_srv_v2_preset_t preset);
+
+/**
+ * @brief Initialize với config đã validate lúc build
+ * @details Như CLOCK_SRV_V2_Init() nhưng bỏ CLOCK_SRV_V2_ValidateConfig().
+ * @param config Config đã check bằng CLOCK_SRV_V2_STATIC_ASSERT_SPLL /
+ *               CLOCK_SRV_V2_STATIC_ASSERT_SYSCLK
+ * @return clock_srv_v2_status_t Status of initialization
+ */
+clock_srv_v2_status_t CLOCK_SRV_V2_InitStatic(const clock_srv_v2_config_t *config);
+
 /**
  * @brief Configure individual clock source
  * @param source Clock source to configure
@@ -272,7 +378,7 @@ clock_srv_v2_status_t CLOCK_SRV_V2_GetConfig(clock_srv_v2_config_t *config);
  * @param sosc_freq SOSC input frequency in Hz
  * @param prediv Pre-divider value
  * @param mult Multiplier value
- * @return uint32_t SPLL output frequency in Hz
+ * @return uint32_t SPLL output frequency in Hz (VCO / 2)
  */
 uint32_t CLOCK_SRV_V2_CalculateSPLLFreq(uint32_t sosc_freq, uint8_t prediv, uint8_t mult);
 
@@ -302,12 +408,12 @@ uint32_t CLOCK_SRV_V2_CalculateSPLLFreq(uint32_t sosc_freq, uint8_t prediv, uint
 }
 
 /**
- * @brief Create SPLL configuration for 80MHz (8MHz * 20 / 2 = 80MHz)
+ * @brief Create SPLL configuration for 160MHz (8MHz * 40 / 2, DIVCORE 2 -> 80MHz)
  */
 #define CLOCK_SRV_V2_SPLL_80MHZ() {                 \
     .enable = true,                                  \
     .prediv = CLOCK_SRV_V2_SPLL_PREDIV_1,           \
-    .mult = 20,                                      \
+    .mult = 40,                                      \
     .div1 = CLOCK_SRV_V2_DIV_2,                     \
     .div2 = CLOCK_SRV_V2_DIV_4                      \
 }
@@ -0,0 +1,155 @@
+/**
+ * @file    crash_srv.h
+ * @brief   Crash Service Layer - Fault Capture in No-Init RAM
+ * @details
+ * Service layer ghi lại trạng thái CPU khi HardFault / MemManage / BusFault /
+ * UsageFault xảy ra, lưu vào RAM không bị khởi tạo lại (.noinit) để đọc sau
+ * NVIC_SystemReset() (post-mortem lỗi ngoài field).
+ *
+ * Record gồm:
+ * - Exception frame: R0-R3, R12, LR, PC, xPSR và SP trước exception
+ * - EXC_RETURN, exception number (IPSR)
+ * - CFSR / HFSR / MMFAR / BFAR
+ * - Tail của trace ring (trace_srv), decode bằng tools/trace_decode.py
+ * - Checksum: RAM sau power-on (nội dung ngẫu nhiên) không bị nhận nhầm
+ *
+ * Features:
+ * - Không tốn gì ở runtime bình thường: chỉ chạy trong fault handler
+ * - Handler dùng stack frame từ MSP hoặc PSP (EXC_RETURN bit 2)
+ * - Frame không được đọc khi chính lúc stacking bị lỗi (STKERR / MSTKERR)
+ * - Fault count cộng dồn qua các lần reset tới khi CRASH_SRV_Clear()
+ *
+ * @code
+ * CRASH_SRV_Init();                   // sớm nhất có thể trong main()
+ * if (CRASH_SRV_HasRecord()) {
+ *     CRASH_SRV_Dump(LPUART1);        // hoặc CRASH_SRV_GetRecord + lưu NVM
+ *     CRASH_SRV_Clear();
+ * }
+ * @endcode
+ *
+ * @note Linker script phải có output section .noinit (NOLOAD) trong SRAM,
+ *       ngoài .bss / .data:
+ *       .noinit (NOLOAD) : { KEEP(*(.noinit)) } > m_data_2
+ * @note SRAM của S32K144 có ECC: vòng RAM init trong startup assembly phải
+ *       bỏ qua vùng .noinit (hoặc chỉ chạy khi RCM_SRS báo power-on / LVD),
+ *       nếu không record bị xóa ở mỗi reset.
+ * @note Sau khi capture, handler luôn gọi NVIC_SystemReset().
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+#ifndef CRASH_SRV_H
+#define CRASH_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "uart.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Lưu tail của trace ring vào record (cần trace_srv) */
+#ifndef CRASH_SRV_TRACE_ENABLE
+#define CRASH_SRV_TRACE_ENABLE      (1U)
+#endif
+
+/** @brief Số word trace lưu trong record */
+#ifndef CRASH_SRV_TRACE_WORDS
+#define CRASH_SRV_TRACE_WORDS       (32U)
+#endif
+
+/** @brief Section chứa record */
+#ifndef CRASH_SRV_SECTION
+#define CRASH_SRV_SECTION           ".noinit"
+#endif
+
+/** @brief Record hợp lệ */
+#define CRASH_SRV_MAGIC             (0xC0FFEE42UL)
+
+/**
+ * @brief Crash service status codes
+ */
+typedef enum {
+    CRASH_SRV_SUCCESS = 0,
+    CRASH_SRV_ERROR,
+    CRASH_SRV_NO_RECORD             /**< Không có record hợp lệ */
+} crash_srv_status_t;
+
+/**
+ * @brief Crash record (nằm trong CRASH_SRV_SECTION)
+ */
+typedef struct {
+    uint32_t magic;                 /**< CRASH_SRV_MAGIC */
+    uint32_t fault_count;           /**< Số fault từ lần Clear cuối */
+    uint32_t exception;             /**< IPSR: 3 = HardFault, 4 = MemManage, 5 = BusFault, 6 = UsageFault */
+    uint32_t exc_return;            /**< LR lúc vào handler */
+    uint32_t frame_valid;           /**< 0 nếu stacking lỗi (r0..xpsr không có giá trị) */
+    uint32_t r0;
+    uint32_t r1;
+    uint32_t r2;
+    uint32_t r3;
+    uint32_t r12;
+    uint32_t lr;
+    uint32_t pc;                    /**< Lệnh gây fault (precise fault) */
+    uint32_t xpsr;
+    uint32_t sp;                    /**< SP trước exception */
+    uint32_t cfsr;
+    uint32_t hfsr;
+    uint32_t mmfar;
+    uint32_t bfar;
+    uint32_t trace_words;           /**< Số word hợp lệ trong trace[] */
+    uint32_t trace[CRASH_SRV_TRACE_WORDS];
+    uint32_t checksum;              /**< ~(tổng các word phía trên) */
+} crash_srv_record_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Install fault handlers và bật MemManage / BusFault / UsageFault
+ * @details Handler được đặt vào RAM vector table (NVIC_InstallHandler)
+ *          cho HardFault, MemManage, BusFault, UsageFault, sau đó gọi
+ *          NVIC_EnableFaultHandlers(true, true, true). Record cũ giữ nguyên.
+ * @return crash_srv_status_t CRASH_SRV_ERROR nếu không install được handler
+ */
+crash_srv_status_t CRASH_SRV_Init(void);
+
+/**
+ * @brief Kiểm tra record từ lần reset trước
+ * @return bool true nếu có record hợp lệ
+ */
+bool CRASH_SRV_HasRecord(void);
+
+/**
+ * @brief Copy record ra ngoài (vd. để lưu nvm_srv / gửi qua CAN)
+ * @param record Pointer nhận record
+ * @return crash_srv_status_t CRASH_SRV_NO_RECORD nếu không có record hợp lệ
+ */
+crash_srv_status_t CRASH_SRV_GetRecord(crash_srv_record_t *record);
+
+/**
+ * @brief Xóa record (fault count về 0)
+ */
+void CRASH_SRV_Clear(void);
+
+/**
+ * @brief In record dạng text qua UART (blocking)
+ * @param base UART instance
+ * @return crash_srv_status_t CRASH_SRV_NO_RECORD nếu không có record hợp lệ
+ */
+crash_srv_status_t CRASH_SRV_Dump(LPUART_RegType *base);
+
+/**
+ * @brief Fault handler chung (được CRASH_SRV_Init install)
+ * @details Dùng trực tiếp trong vector table tĩnh nếu không có RAM vector table.
+ */
+void CRASH_SRV_FaultHandler(void);
+
+#endif /* CRASH_SRV_H */
@@ -0,0 +1,216 @@
+/**
+ * @file    datalog_srv.h
+ * @brief   Datalog Service - Streaming ADC / CAN Capture to Flash
+ * @details
+ * Ghi liên tục stream ADC và CAN vào flash on-chip cho chẩn đoán ngoài hiện
+ * trường, không làm chậm control loop. Pipeline 3 tầng:
+ * - Capture (ISR): frame ADC (adc_scan_srv frame hook) / CAN (raw RX hook
+ *   của can_srv) được copy raw vào capture ring trong RAM, vài chục cycle
+ * - Compress (DATALOG_SRV_Process(), main loop): timestamp delta + varint,
+ *   ADC delta theo channel + zigzag varint, ghi vào block RAM
+ * - Program (FTFC async, CCIF interrupt): block đầy được program trong lúc
+ *   block kia đang được điền, sector kế tiếp erase khi write pointer tới
+ *
+ * Block format (DATALOG_SRV_BLOCK_SIZE bytes, tự decode được độc lập):
+ * - Header datalog_srv_block_header_t: magic, sequence, timestamp gốc,
+ *   số byte đã dùng
+ * - Record: tag byte [3:0] type, [7:4] aux, varint(dt) rồi payload
+ *   - ADC (aux = count - 1): count x zigzag varint(value - value trước),
+ *     value trước = 0 ở đầu block
+ *   - CAN (aux = instance): varint(ID word), byte (CS >> 16) & 0x3F
+ *     (IDE, RTR, DLC), rồi min(DLC, 8) byte data
+ * - Phần còn lại 0xFF; decode bằng tools/datalog_decode.py
+ *
+ * Features:
+ * - Capture ring full → record bị drop và đếm, ISR không bao giờ chờ
+ * - Ring trên flash (wrap = ghi đè dữ liệu cũ nhất) hoặc dừng khi đầy
+ * - DATALOG_SRV_Start() tìm block cuối cùng trên flash và ghi tiếp sau đó
+ *
+ * @code
+ * static const datalog_srv_config_t s_log_cfg = {
+ *     .flash_start = 0x10000000UL, .flash_size = 0x8000UL,   // 32 KB FlexNVM
+ *     .wrap = true, .time_source = TIME_SRV_GetMicros32
+ * };
+ *
+ * NVIC_EnableIRQ(FTFC_IRQn);
+ * DATALOG_SRV_Start(&s_log_cfg);
+ * ADC_SCAN_SRV_InstallFrameHook(DATALOG_SRV_LogAdc);
+ * CAN_SRV_RegisterRawRxHook(CAN_SRV_CAN0, DATALOG_SRV_CanRawHook);
+ *
+ * while (1) {
+ *     ...
+ *     DATALOG_SRV_Process();
+ * }
+ * @endcode
+ *
+ * @note Async FTFC chỉ cho FlexNVM (trừ khi FTFC_ASYNC_PFLASH_ENABLE = 1):
+ *       vùng log phải nằm trong phần D-Flash còn lại sau partition EEE của
+ *       nvm_srv. FTFC_IRQn phải được enable và nối tới FTFC_IRQHandler().
+ * @note Dung lượng: ADC 8 channel thay đổi ít (delta 1 byte) tốn ~10 byte
+ *       mỗi frame, 32 KB chứa ~3000 frame, tức gần một phút ở 50 Hz.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+#ifndef DATALOG_SRV_H
+#define DATALOG_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "can_srv.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Capture ring size in 32-bit words (power of 2) */
+#ifndef DATALOG_SRV_CAPTURE_WORDS
+#define DATALOG_SRV_CAPTURE_WORDS       (1024U)
+#endif
+
+/** @brief Block size (bytes): bội của FTFC_PHRASE_SIZE, ước của sector size */
+#ifndef DATALOG_SRV_BLOCK_SIZE
+#define DATALOG_SRV_BLOCK_SIZE          (512U)
+#endif
+
+/** @brief Số record tối đa nén trong một lần DATALOG_SRV_Process() */
+#ifndef DATALOG_SRV_RECORDS_PER_PROCESS
+#define DATALOG_SRV_RECORDS_PER_PROCESS (32U)
+#endif
+
+/** @brief Số channel tối đa của một ADC record */
+#define DATALOG_SRV_MAX_ADC_CHANNELS    (16U)
+
+/** @brief Block header magic ("DLOG") */
+#define DATALOG_SRV_BLOCK_MAGIC         (0x474F4C44UL)
+
+/** @brief Block format version */
+#define DATALOG_SRV_BLOCK_VERSION       (1U)
+
+/** @brief Record type (tag bit [3:0]) */
+#define DATALOG_SRV_TYPE_ADC            (1U)
+#define DATALOG_SRV_TYPE_CAN            (2U)
+
+/**
+ * @brief Datalog service status codes
+ */
+typedef enum {
+    DATALOG_SRV_SUCCESS = 0,
+    DATALOG_SRV_ERROR,
+    DATALOG_SRV_NOT_INITIALIZED,
+    DATALOG_SRV_BUSY,               /**< Đang chạy (Start) */
+    DATALOG_SRV_FULL                /**< Vùng flash đầy, wrap = false */
+} datalog_srv_status_t;
+
+/**
+ * @brief Timestamp source (free-running, vd. microsecond counter)
+ */
+typedef uint32_t (*datalog_srv_time_source_t)(void);
+
+/**
+ * @brief Datalog configuration
+ */
+typedef struct {
+    uint32_t flash_start;           /**< Đầu vùng log, sector-aligned */
+    uint32_t flash_size;            /**< Kích thước vùng log, bội của sector size */
+    bool wrap;                      /**< true: ghi đè sector cũ nhất khi đầy */
+    datalog_srv_time_source_t time_source; /**< Timestamp (NULL = 0) */
+} datalog_srv_config_t;
+
+/**
+ * @brief Header đầu mỗi block trên flash (16 bytes)
+ */
+typedef struct {
+    uint32_t magic;                 /**< DATALOG_SRV_BLOCK_MAGIC */
+    uint32_t sequence;              /**< Tăng dần theo block, tìm điểm ghi tiếp */
+    uint32_t timestamp;             /**< Timestamp của record đầu block */
+    uint16_t used;                  /**< Số byte đã dùng (kể cả header) */
+    uint8_t version;                /**< DATALOG_SRV_BLOCK_VERSION */
+    uint8_t reserved;               /**< 0xFF */
+} datalog_srv_block_header_t;
+
+/**
+ * @brief Thống kê pipeline
+ */
+typedef struct {
+    uint32_t records;               /**< Record đã nén */
+    uint32_t dropped;               /**< Record bị drop do capture ring full */
+    uint32_t raw_bytes;             /**< Kích thước raw của các record đã nén */
+    uint32_t encoded_bytes;         /**< Kích thước sau nén (không tính header) */
+    uint32_t blocks_written;        /**< Block đã program thành công */
+    uint32_t blocks_lost;           /**< Block bị bỏ (flash đầy hoặc lỗi program) */
+    uint32_t flash_errors;          /**< Lỗi erase / program từ FTFC */
+} datalog_srv_stats_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Bắt đầu log vào vùng flash, ghi tiếp sau block có sequence lớn nhất
+ * @details Scan header các block (đọc memory-mapped); phần còn lại của sector
+ *          chứa block cuối phải trắng, nếu không ghi từ sector kế tiếp.
+ * @param config Configuration (copy vào service)
+ * @return datalog_srv_status_t DATALOG_SRV_FULL nếu vùng đầy và wrap = false
+ */
+datalog_srv_status_t DATALOG_SRV_Start(const datalog_srv_config_t *config);
+
+/**
+ * @brief Dừng capture, record còn trong pipeline vẫn được ghi xuống flash
+ * @details Gọi DATALOG_SRV_Process() tới khi DATALOG_SRV_IsIdle().
+ * @return datalog_srv_status_t Status of operation
+ */
+datalog_srv_status_t DATALOG_SRV_Stop(void);
+
+/**
+ * @brief Capture một frame ADC (mọi context, signature của adc_scan_srv frame hook)
+ * @param values Giá trị raw
+ * @param count  Số channel (1 - DATALOG_SRV_MAX_ADC_CHANNELS)
+ */
+void DATALOG_SRV_LogAdc(const uint16_t *values, uint8_t count);
+
+/**
+ * @brief Capture một CAN frame từ 4 word của RX mailbox (mọi context)
+ * @param instance Instance nhận frame
+ * @param mb_words CS, ID, DATA0, DATA1 (layout FlexCAN)
+ */
+void DATALOG_SRV_LogCan(can_srv_instance_t instance, const uint32_t *mb_words);
+
+/**
+ * @brief Raw RX hook cho CAN_SRV_RegisterRawRxHook(): log rồi cho frame đi tiếp
+ * @param instance Instance nhận frame
+ * @param mb_words CS, ID, DATA0, DATA1
+ * @return false (frame vẫn vào RX ring của can_srv)
+ */
+bool DATALOG_SRV_CanRawHook(can_srv_instance_t instance, const uint32_t *mb_words);
+
+/**
+ * @brief Nén record từ capture ring và điều khiển erase / program (main loop)
+ * @details Non-blocking, tối đa DATALOG_SRV_RECORDS_PER_PROCESS record mỗi lần.
+ */
+void DATALOG_SRV_Process(void);
+
+/**
+ * @brief Đóng block đang điền (kể cả chưa đầy) để ghi xuống flash
+ * @details Áp dụng ở DATALOG_SRV_Process() sau khi capture ring đã được nén hết.
+ */
+void DATALOG_SRV_Flush(void);
+
+/**
+ * @brief Pipeline rỗng: không còn record / block chờ, FTFC không chạy lệnh của service
+ */
+bool DATALOG_SRV_IsIdle(void);
+
+/**
+ * @brief Đọc thống kê pipeline
+ * @param stats Buffer đích
+ * @return datalog_srv_status_t Status of operation
+ */
+datalog_srv_status_t DATALOG_SRV_GetStats(datalog_srv_stats_t *stats);
+
+#endif /* DATALOG_SRV_H */
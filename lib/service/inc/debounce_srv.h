@@ -0,0 +1,161 @@
+/**
+ * @file    debounce_srv.h
+ * @brief   Debounce Service - Interrupt-driven Input Debouncing
+ * @details
+ * Debounce input (nút nhấn, contact, cảm biến nhiễu) mà không busy-wait và
+ * không bị interrupt storm: edge đầu tiên tắt PORT interrupt của pin và
+ * start một soft timer (timer_srv); khi timer hết hạn pin được đọc lại, nếu
+ * level khác level ổn định trước đó thì callback được gọi, rồi interrupt
+ * được bật lại. Mỗi lần bounce chỉ tốn tối đa một PORT interrupt.
+ *
+ * Features:
+ * - Input object do application cấp phát, một object mỗi pin
+ * - Dispatch O(1) theo pin (bảng pointer mỗi port), chỉ xử lý / clear ISF
+ *   của pin thuộc service
+ * - Kết hợp PORT digital filter (DFER): glitch ngắn bị lọc bằng hardware,
+ *   debounce_ms = 0 thì edge đã lọc được báo thẳng từ PORT ISR
+ *
+ * @code
+ * static debounce_srv_input_t s_sw2;
+ *
+ * LPIT_Init(LPIT_CLK_SRC_SIRC);
+ * TIMER_SRV_Init(0U);
+ * NVIC_EnableIRQ(LPIT0_Ch0_IRQn);
+ *
+ * debounce_srv_config_t cfg = {
+ *     .port = PORT_C, .pin = 12U, .pull = PORT_PULL_DISABLE,
+ *     .debounce_ms = 20U, .hw_filter = false,
+ *     .callback = OnButton, .user_data = NULL
+ * };
+ * DEBOUNCE_SRV_Add(&s_sw2, &cfg);
+ * NVIC_EnableIRQ(PORTC_IRQn);
+ *
+ * void PORTC_IRQHandler(void)
+ * {
+ *     DEBOUNCE_SRV_PortIRQHandler(PORT_C);
+ * }
+ * @endcode
+ *
+ * Glitch filter bằng hardware, không timer (LPO 128 kHz, 16 cycle = 125 us):
+ * @code
+ * PORT_SetDigitalFilterConfig(PORT_E, PORT_FILTER_CLK_LPO, 16U);
+ * cfg.port = PORT_E; cfg.pin = 2U; cfg.debounce_ms = 0U; cfg.hw_filter = true;
+ * DEBOUNCE_SRV_Add(&s_sensor, &cfg);
+ * @endcode
+ *
+ * @note Callback chạy trong LPIT interrupt context (timer) hoặc PORT
+ *       interrupt context (debounce_ms = 0).
+ * @note Nếu gpio_srv cũng dispatch cùng port, gọi DEBOUNCE_SRV_PortIRQHandler()
+ *       trước GPIO_SRV_PORTx_IRQHandler().
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+#ifndef DEBOUNCE_SRV_H
+#define DEBOUNCE_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "port.h"
+#include "gpio.h"
+#include "timer_srv.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Số pin mỗi port */
+#define DEBOUNCE_SRV_PINS_PER_PORT      (32U)
+
+/** @brief Số port (PORT_A - PORT_E) */
+#define DEBOUNCE_SRV_PORT_COUNT         (5U)
+
+/**
+ * @brief Debounce service status codes
+ */
+typedef enum {
+    DEBOUNCE_SRV_SUCCESS = 0,
+    DEBOUNCE_SRV_ERROR,
+    DEBOUNCE_SRV_BUSY               /**< Pin đã có input đăng ký */
+} debounce_srv_status_t;
+
+typedef struct debounce_srv_input debounce_srv_input_t;
+
+/**
+ * @brief Callback khi level ổn định của pin thay đổi
+ * @param input     Input object
+ * @param level     Level mới (true = high)
+ * @param user_data Pointer to user data
+ */
+typedef void (*debounce_srv_callback_t)(debounce_srv_input_t *input, bool level, void *user_data);
+
+/**
+ * @brief Input configuration
+ */
+typedef struct {
+    port_name_t port;               /**< PORT (clock được enable bởi service) */
+    uint8_t pin;                    /**< Pin number (0-31) */
+    port_pull_config_t pull;        /**< Internal pull resistor */
+    uint32_t debounce_ms;           /**< Thời gian ổn định, 0 = chỉ dùng hw_filter */
+    bool hw_filter;                 /**< Enable PORT digital filter (DFER) của pin */
+    debounce_srv_callback_t callback; /**< Level change callback */
+    void *user_data;                /**< Callback argument */
+} debounce_srv_config_t;
+
+/**
+ * @brief Input object
+ * @details Do application cấp phát; các field là private của service.
+ */
+struct debounce_srv_input {
+    timer_srv_timer_t timer;        /**< Debounce timer */
+    gpio_pin_t gpio;                /**< Pin descriptor */
+    uint32_t ticks;                 /**< Debounce time (timer_srv ticks), 0 = pass-through */
+    debounce_srv_callback_t callback; /**< Level change callback */
+    void *user_data;                /**< Callback argument */
+    port_name_t port;               /**< PORT */
+    uint8_t pin;                    /**< Pin number */
+    volatile bool level;            /**< Level ổn định cuối cùng */
+};
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Cấu hình pin làm GPIO input và bắt đầu debounce
+ * @details Level ban đầu đọc khi Add, không gọi callback. Digital filter
+ *          clock / width của port do PORT_SetDigitalFilterConfig().
+ *          timer_srv phải được TIMER_SRV_Init() khi debounce_ms > 0.
+ * @param input  Input object (tồn tại tới DEBOUNCE_SRV_Remove())
+ * @param config Input configuration
+ * @return debounce_srv_status_t DEBOUNCE_SRV_BUSY nếu pin đã được đăng ký
+ */
+debounce_srv_status_t DEBOUNCE_SRV_Add(debounce_srv_input_t *input, const debounce_srv_config_t *config);
+
+/**
+ * @brief Dừng debounce, tắt interrupt và digital filter của pin
+ * @param input Input object
+ * @return debounce_srv_status_t Status of operation
+ */
+debounce_srv_status_t DEBOUNCE_SRV_Remove(debounce_srv_input_t *input);
+
+/**
+ * @brief Level ổn định hiện tại (không đọc pin)
+ * @param input Input object
+ * @return true nếu high
+ */
+bool DEBOUNCE_SRV_Read(const debounce_srv_input_t *input);
+
+/**
+ * @brief Xử lý PORT interrupt cho các pin của service
+ * @details Chỉ clear ISF của pin đã đăng ký, pin khác giữ nguyên flag.
+ * @param port PORT có interrupt (gọi từ PORTx_IRQHandler())
+ */
+void DEBOUNCE_SRV_PortIRQHandler(port_name_t port);
+
+#endif /* DEBOUNCE_SRV_H */
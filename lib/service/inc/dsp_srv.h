@@ -0,0 +1,227 @@
+/**
+ * @file    dsp_srv.h
+ * @brief   DSP Service Layer - Fixed-Point Block Processing API
+ * @details
+ * Service layer xử lý block sample (vd. half buffer từ ADC_StartDmaStream())
+ * bằng fixed-point thay cho ADC_ConvertToVoltage() từng sample.
+ *
+ * Features:
+ * - Raw ADC → Q15 (bỏ offset, saturate) và raw → millivolt với gain tính trước
+ *   (1 multiply + shift, không divide)
+ * - Q15 / Q31 scaling có saturate
+ * - Moving average cửa sổ 2^k (running sum, O(1) mỗi sample)
+ * - IIR low-pass: one-pole (shift-only) và biquad Q14 coefficients
+ * - Decimation boxcar 2^k
+ *
+ * Trên Cortex-M4 dùng DSP instructions (SMLAD, SSAT) qua inline asm,
+ * các compiler / target khác dùng C fallback cho cùng kết quả.
+ *
+ * @note Không phụ thuộc hardware, state do application cấp phát.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+#ifndef DSP_SRV_H
+#define DSP_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Q15 fixed point: [-1, 1) in int16_t */
+typedef int16_t dsp_srv_q15_t;
+
+/** @brief Q31 fixed point: [-1, 1) in int32_t */
+typedef int32_t dsp_srv_q31_t;
+
+/** @brief Biquad coefficient fraction bits (Q14, range [-2, 2)) */
+#define DSP_SRV_BIQUAD_FRAC_BITS    (14U)
+
+/**
+ * @brief DSP service status codes
+ */
+typedef enum {
+    DSP_SRV_SUCCESS = 0,
+    DSP_SRV_ERROR
+} dsp_srv_status_t;
+
+/**
+ * @brief Moving average state (window = 2^window_log2)
+ */
+typedef struct {
+    dsp_srv_q15_t *history;         /**< 2^window_log2 samples, do application cấp */
+    int32_t sum;                    /**< Running sum of history */
+    uint16_t index;                 /**< Oldest sample */
+    uint8_t window_log2;            /**< Window size exponent (0-15) */
+} dsp_srv_mavg_t;
+
+/**
+ * @brief One-pole low-pass state: y += (x - y) / 2^shift
+ */
+typedef struct {
+    int32_t y;                      /**< Output in Q15 << 16 (extra precision) */
+    uint8_t shift;                  /**< Coefficient exponent (1-15) */
+} dsp_srv_lowpass_t;
+
+/**
+ * @brief Biquad (Direct Form I) state
+ * @details y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] - a1 y[n-1] - a2 y[n-2],
+ *          coefficients Q14. Packed in halfword pairs for SMLAD.
+ */
+typedef struct {
+    uint32_t b0_b1;                 /**< Packed (b0, b1) */
+    uint32_t b2_na1;                /**< Packed (b2, -a1) */
+    int32_t na2;                    /**< -a2 */
+    dsp_srv_q15_t x1;               /**< x[n-1] */
+    dsp_srv_q15_t x2;               /**< x[n-2] */
+    dsp_srv_q15_t y1;               /**< y[n-1] */
+    dsp_srv_q15_t y2;               /**< y[n-2] */
+} dsp_srv_biquad_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Convert raw ADC samples to Q15
+ * @details dst = SSAT((raw - offset) << (15 - resolution_bits)). offset = 0
+ *          cho tín hiệu unipolar, mid-scale (vd. 2048) cho current sensor bipolar.
+ * @param src             Raw samples
+ * @param dst             Q15 output (có thể trùng src)
+ * @param n               Number of samples
+ * @param resolution_bits ADC resolution (8, 10, 12)
+ * @param offset          Raw offset subtracted before scaling
+ * @return dsp_srv_status_t Status of operation
+ */
+dsp_srv_status_t DSP_SRV_RawToQ15(const uint16_t *src, dsp_srv_q15_t *dst, uint32_t n,
+                                  uint8_t resolution_bits, uint16_t offset);
+
+/**
+ * @brief Tính gain Q16 cho DSP_SRV_RawToMillivolts() (gọi một lần lúc init)
+ * @param vref_mv         Reference voltage in mV
+ * @param resolution_bits ADC resolution (8, 10, 12)
+ * @return uint32_t vref_mv / (2^bits - 1) in Q16, 0 when resolution is invalid
+ */
+uint32_t DSP_SRV_MillivoltGainQ16(uint32_t vref_mv, uint8_t resolution_bits);
+
+/**
+ * @brief Convert raw ADC samples to millivolts
+ * @details mv = (raw * gain_q16 + 0x8000) >> 16, kết quả giống
+ *          ADC_ConvertToVoltage() (±1 mV do rounding) nhưng không có divide.
+ * @param src      Raw samples
+ * @param dst      Millivolt output (có thể trùng src)
+ * @param n        Number of samples
+ * @param gain_q16 Gain from DSP_SRV_MillivoltGainQ16()
+ */
+void DSP_SRV_RawToMillivolts(const uint16_t *src, uint16_t *dst, uint32_t n, uint32_t gain_q16);
+
+/**
+ * @brief Scale Q15 block: dst = SSAT((src * scale) >> (15 - shift))
+ * @param src   Q15 input
+ * @param dst   Q15 output (có thể trùng src)
+ * @param n     Number of samples
+ * @param scale Q15 scale factor
+ * @param shift Extra left shift for gains >= 1 (0-15)
+ */
+void DSP_SRV_ScaleQ15(const dsp_srv_q15_t *src, dsp_srv_q15_t *dst, uint32_t n,
+                      dsp_srv_q15_t scale, uint8_t shift);
+
+/**
+ * @brief Scale Q31 block: dst = SAT((src * scale) >> (31 - shift))
+ * @param src   Q31 input
+ * @param dst   Q31 output (có thể trùng src)
+ * @param n     Number of samples
+ * @param scale Q31 scale factor
+ * @param shift Extra left shift for gains >= 1 (0-31)
+ */
+void DSP_SRV_ScaleQ31(const dsp_srv_q31_t *src, dsp_srv_q31_t *dst, uint32_t n,
+                      dsp_srv_q31_t scale, uint8_t shift);
+
+/**
+ * @brief Khởi tạo moving average
+ * @param state       Filter state
+ * @param history     Buffer 2^window_log2 samples
+ * @param window_log2 Window exponent (0-15)
+ * @return dsp_srv_status_t Status of operation
+ */
+dsp_srv_status_t DSP_SRV_MovingAverageInit(dsp_srv_mavg_t *state, dsp_srv_q15_t *history,
+                                           uint8_t window_log2);
+
+/**
+ * @brief Moving average một block (state giữ qua các block)
+ * @param state Filter state
+ * @param src   Q15 input
+ * @param dst   Q15 output (có thể trùng src)
+ * @param n     Number of samples
+ */
+void DSP_SRV_MovingAverageQ15(dsp_srv_mavg_t *state, const dsp_srv_q15_t *src,
+                              dsp_srv_q15_t *dst, uint32_t n);
+
+/**
+ * @brief Khởi tạo one-pole low-pass
+ * @details Cutoff ≈ fs / (2π · 2^shift), vd. shift = 4 ở 10 kS/s → ~100 Hz.
+ * @param state   Filter state
+ * @param shift   Coefficient exponent (1-15)
+ * @param initial Initial output (Q15), tránh transient lúc start
+ * @return dsp_srv_status_t Status of operation
+ */
+dsp_srv_status_t DSP_SRV_LowPassInit(dsp_srv_lowpass_t *state, uint8_t shift, dsp_srv_q15_t initial);
+
+/**
+ * @brief One-pole low-pass một block
+ * @param state Filter state
+ * @param src   Q15 input
+ * @param dst   Q15 output (có thể trùng src)
+ * @param n     Number of samples
+ */
+void DSP_SRV_LowPassQ15(dsp_srv_lowpass_t *state, const dsp_srv_q15_t *src,
+                        dsp_srv_q15_t *dst, uint32_t n);
+
+/**
+ * @brief Khởi tạo biquad
+ * @param state Filter state
+ * @param b0    Feed-forward coefficient (Q14)
+ * @param b1    Feed-forward coefficient (Q14)
+ * @param b2    Feed-forward coefficient (Q14)
+ * @param a1    Feedback coefficient (Q14, as in the transfer function denominator)
+ * @param a2    Feedback coefficient (Q14)
+ *
+ * @code
+ * // Butterworth low-pass fc = fs/10: b = {0.0675, 0.1349, 0.0675}, a = {-1.1430, 0.4128}
+ * DSP_SRV_BiquadInit(&lp, 1105, 2210, 1105, -18727, 6763);
+ * @endcode
+ */
+void DSP_SRV_BiquadInit(dsp_srv_biquad_t *state, int16_t b0, int16_t b1, int16_t b2,
+                        int16_t a1, int16_t a2);
+
+/**
+ * @brief Biquad một block (3 MAC qua 2 SMLAD + 1 MLA mỗi sample)
+ * @param state Filter state
+ * @param src   Q15 input
+ * @param dst   Q15 output (có thể trùng src)
+ * @param n     Number of samples
+ */
+void DSP_SRV_BiquadQ15(dsp_srv_biquad_t *state, const dsp_srv_q15_t *src,
+                       dsp_srv_q15_t *dst, uint32_t n);
+
+/**
+ * @brief Decimate bằng trung bình mỗi nhóm 2^factor_log2 samples
+ * @details Với src align 4 byte, cộng 2 sample mỗi SMLAD.
+ * @param src         Q15 input
+ * @param dst         Q15 output, n >> factor_log2 samples (có thể trùng src)
+ * @param n           Number of input samples (bội số của 2^factor_log2)
+ * @param factor_log2 Decimation exponent (1-15)
+ * @return dsp_srv_status_t DSP_SRV_ERROR khi n không chia hết
+ */
+dsp_srv_status_t DSP_SRV_DecimateQ15(const dsp_srv_q15_t *src, dsp_srv_q15_t *dst, uint32_t n,
+                                     uint8_t factor_log2);
+
+#endif /* DSP_SRV_H */
@@ -0,0 +1,201 @@
+/**
+ * @file    frame_srv.h
+ * @brief   Frame Service Layer - COBS Framing + CRC-16 API
+ * @details
+ * Service layer cung cấp binary framing cho UART link thay cho text/printf.
+ * Frame trên dây: COBS(payload + CRC16) + 0x00 delimiter.
+ *
+ * Features:
+ * - Streaming COBS encoder (không cần buffer cả message đầu vào)
+ * - Streaming COBS decoder, feed từng đoạn từ RX ISR / DMA callback
+ * - CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF) tính incremental
+ * - CRC bằng hardware CRC engine (crc.h), lookup table chỉ còn là fallback
+ *   khi engine đang bận ở context khác hoặc chưa CRC_Init()
+ * - Overhead cố định: 2 byte CRC + 1 delimiter + 1 byte mỗi 254 byte
+ *
+ * @note Không phụ thuộc I/O: encoder ghi qua callback, decoder nhận
+ *       byte từ bất kỳ nguồn nào (UART_ReadAsync, UART_StartCircularRxDMA...).
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.1
+ */
+
+#ifndef FRAME_SRV_H
+#define FRAME_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Frame delimiter on the wire */
+#define FRAME_SRV_DELIMITER         (0x00U)
+
+/** @brief Bytes appended to each payload (CRC-16, big-endian) */
+#define FRAME_SRV_CRC_SIZE          (2U)
+
+/** @brief Tính CRC bằng hardware CRC engine (0 = chỉ dùng lookup table) */
+#ifndef FRAME_SRV_HW_CRC_ENABLE
+#define FRAME_SRV_HW_CRC_ENABLE     (1U)
+#endif
+
+/** @brief Đoạn ngắn hơn giá trị này dùng lookup table (setup engine ~10 register access) */
+#ifndef FRAME_SRV_HW_CRC_MIN_LEN
+#define FRAME_SRV_HW_CRC_MIN_LEN    (8U)
+#endif
+
+/** @brief Worst-case encoded size for a payload of n bytes (incl. delimiter) */
+#define FRAME_SRV_ENCODED_MAX(n)    ((n) + FRAME_SRV_CRC_SIZE + (((n) + FRAME_SRV_CRC_SIZE) / 254U) + 2U)
+
+/**
+ * @brief Frame service status codes
+ */
+typedef enum {
+    FRAME_SRV_SUCCESS = 0,
+    FRAME_SRV_ERROR,
+    FRAME_SRV_BUFFER_FULL
+} frame_srv_status_t;
+
+/**
+ * @brief Encoder output callback
+ * @param data Encoded bytes
+ * @param len  Number of bytes
+ * @param ctx  User context
+ */
+typedef void (*frame_srv_write_t)(const uint8_t *data, uint32_t len, void *ctx);
+
+/**
+ * @brief Decoder complete-frame callback
+ * @param payload Decoded payload (CRC already checked and stripped)
+ * @param len     Payload length
+ * @param ctx     User context
+ * @note Gọi từ context của FRAME_SRV_DecoderFeed() (thường là ISR),
+ *       payload chỉ hợp lệ trong callback.
+ */
+typedef void (*frame_srv_frame_cb_t)(const uint8_t *payload, uint16_t len, void *ctx);
+
+/**
+ * @brief Streaming encoder state
+ */
+typedef struct {
+    frame_srv_write_t write;        /**< Output callback */
+    void *ctx;                      /**< Output callback context */
+    uint8_t block[255];             /**< Pending COBS block: [0] = code, then data */
+    uint8_t block_len;              /**< Bytes in block */
+    uint16_t crc;                   /**< Running CRC of the payload */
+} frame_srv_encoder_t;
+
+/**
+ * @brief Streaming decoder state
+ */
+typedef struct {
+    uint8_t *buffer;                /**< Payload + CRC storage */
+    uint16_t buffer_size;           /**< Buffer capacity */
+    uint16_t len;                   /**< Bytes decoded so far */
+    uint16_t crc;                   /**< CRC residue of the last frame (0 = good) */
+    uint8_t code;                   /**< Current COBS code byte */
+    uint8_t remaining;              /**< Data bytes left in current block */
+    bool discard;                   /**< Skip until next delimiter */
+    frame_srv_frame_cb_t callback;  /**< Complete-frame callback */
+    void *ctx;                      /**< Callback context */
+    uint32_t frames_ok;             /**< Valid frames delivered */
+    uint32_t crc_errors;            /**< Frames dropped on CRC mismatch */
+    uint32_t overflows;             /**< Frames dropped, longer than buffer */
+} frame_srv_decoder_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Update CRC-16/CCITT-FALSE với một đoạn dữ liệu
+ * @param crc  Running CRC (start with 0xFFFF)
+ * @param data Data
+ * @param len  Length
+ * @return uint16_t Updated CRC
+ */
+uint16_t FRAME_SRV_Crc16(uint16_t crc, const uint8_t *data, uint32_t len);
+
+/**
+ * @brief Bắt đầu encode một frame mới
+ * @param enc   Encoder state
+ * @param write Output callback (bắt buộc)
+ * @param ctx   Output callback context
+ * @return frame_srv_status_t Status of operation
+ */
+frame_srv_status_t FRAME_SRV_EncoderBegin(frame_srv_encoder_t *enc, frame_srv_write_t write, void *ctx);
+
+/**
+ * @brief Thêm payload bytes vào frame đang encode
+ * @details Có thể gọi nhiều lần (header, payload, ...). Output được ghi ra
+ *          mỗi khi đủ một COBS block.
+ * @param enc  Encoder state
+ * @param data Payload bytes
+ * @param len  Length
+ * @return frame_srv_status_t Status of operation
+ */
+frame_srv_status_t FRAME_SRV_EncoderPut(frame_srv_encoder_t *enc, const uint8_t *data, uint32_t len);
+
+/**
+ * @brief Kết thúc frame: append CRC, flush block cuối và delimiter
+ * @param enc Encoder state
+ * @return frame_srv_status_t Status of operation
+ */
+frame_srv_status_t FRAME_SRV_EncoderEnd(frame_srv_encoder_t *enc);
+
+/**
+ * @brief Encode cả frame vào buffer (one-shot)
+ * @param payload  Payload
+ * @param len      Payload length
+ * @param out      Output buffer (dùng FRAME_SRV_ENCODED_MAX(len) để cấp phát)
+ * @param out_size Output buffer size
+ * @param out_len  Encoded length incl. delimiter
+ * @return frame_srv_status_t FRAME_SRV_BUFFER_FULL nếu out quá nhỏ
+ */
+frame_srv_status_t FRAME_SRV_Encode(const uint8_t *payload, uint32_t len,
+                                    uint8_t *out, uint32_t out_size, uint32_t *out_len);
+
+/**
+ * @brief Khởi tạo decoder
+ * @param dec         Decoder state
+ * @param buffer      Storage cho payload + 2 byte CRC
+ * @param buffer_size Storage size (max payload = buffer_size - 2)
+ * @param callback    Complete-frame callback
+ * @param ctx         Callback context
+ * @return frame_srv_status_t Status of operation
+ */
+frame_srv_status_t FRAME_SRV_DecoderInit(frame_srv_decoder_t *dec, uint8_t *buffer, uint16_t buffer_size,
+                                         frame_srv_frame_cb_t callback, void *ctx);
+
+/**
+ * @brief Feed received bytes vào decoder
+ * @details Xử lý từng byte O(1), CRC của payload + CRC được kiểm tra một lần
+ *          ở delimiter, gọi callback nếu CRC đúng. Frame lỗi được đếm và bỏ qua, decoder tự
+ *          resync ở delimiter tiếp theo.
+ * @param dec  Decoder state
+ * @param data Received bytes
+ * @param len  Length
+ *
+ * @code
+ * static void OnRx(LPUART_RegType *base, const uint8_t *data, uint32_t len, void *user)
+ * {
+ *     FRAME_SRV_DecoderFeed((frame_srv_decoder_t *)user, data, len);
+ * }
+ * UART_StartCircularRxDMA(LPUART1, 2, s_rx_ring, sizeof(s_rx_ring), OnRx, &s_decoder);
+ * @endcode
+ */
+void FRAME_SRV_DecoderFeed(frame_srv_decoder_t *dec, const uint8_t *data, uint32_t len);
+
+/**
+ * @brief Bỏ frame đang decode dở, chờ delimiter tiếp theo
+ * @param dec Decoder state
+ */
+void FRAME_SRV_DecoderReset(frame_srv_decoder_t *dec);
+
+#endif /* FRAME_SRV_H */
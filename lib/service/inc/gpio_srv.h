@@ -11,6 +11,8 @@
  * - Pin toggle operation
  * - External interrupt support (for buttons, sensors)
  * - Callback registration for interrupt handling
+ * - PORTx ISR dispatch: ISFR đọc một lần, duyệt bit set bằng CLZ, clear bằng
+ *   một lần write-one-to-clear (constant-time theo số pin của port)
  * 
  * @author  PhucPH32
  * @date    05/12/2025
@@ -30,6 +32,15 @@
  * Definitions
  ******************************************************************************/
 
+/**
+ * @brief Service định nghĩa sẵn PORTA_IRQHandler() ... PORTE_IRQHandler()
+ * @note Để 0 nếu application tự định nghĩa PORTx_IRQHandler() và gọi
+ *       GPIO_SRV_PORTx_IRQHandler() từ đó (tránh duplicate symbol)
+ */
+#ifndef GPIO_SRV_PORT_IRQ_HANDLERS
+#define GPIO_SRV_PORT_IRQ_HANDLERS      (0U)
+#endif
+
 /**
  * @brief GPIO service status codes
  */
@@ -170,4 +181,15 @@ gpio_srv_status_t GPIO_SRV_WritePin(uint8_t port, uint8_t pin, uint8_t value);
  */
 gpio_srv_status_t GPIO_SRV_TogglePin(uint8_t port, uint8_t pin);
 
+/**
+ * @brief Dispatch interrupt của PORT A ... PORT E tới callbacks đã đăng ký
+ * @note Gọi từ PORTx_IRQHandler() của application khi
+ *       GPIO_SRV_PORT_IRQ_HANDLERS = 0
+ */
+void GPIO_SRV_PORTA_IRQHandler(void);
+void GPIO_SRV_PORTB_IRQHandler(void);
+void GPIO_SRV_PORTC_IRQHandler(void);
+void GPIO_SRV_PORTD_IRQHandler(void);
+void GPIO_SRV_PORTE_IRQHandler(void);
+
 #endif /* GPIO_SRV_H */
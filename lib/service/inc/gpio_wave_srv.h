@@ -0,0 +1,185 @@
+/**
+ * @file    gpio_wave_srv.h
+ * @brief   GPIO Waveform Service - DMA-paced Multi-pin Output
+ * @details
+ * Xuất waveform trên nhiều pin của một GPIO port mà CPU không can thiệp từng
+ * bit: timer trigger (LPIT hoặc FTM qua TRGMUX) gate DMAMUX periodic trigger,
+ * mỗi trigger eDMA copy một sample từ pattern buffer vào PDOR / PSOR / PCOR /
+ * PTOR. Thay cho bit-bang bằng GPIO_TogglePin() (WS2812, protocol tự định
+ * nghĩa, test pattern) với jitter chỉ còn là DMA arbitration.
+ *
+ * Features:
+ * - Sample rate tới vài MHz (LPIT channel do service cấu hình từ sample_rate_hz)
+ * - Hoặc bất kỳ TRGMUX source nào (FTMx_INIT...) do application cấu hình
+ * - Sample 8 / 16 / 32 bit ghi vào byte lane của register: write 8 bit vào
+ *   PDOR chỉ đổi 8 pin của lane đó, PSOR / PCOR / PTOR chỉ đổi bit = 1
+ * - One-shot (callback khi sample cuối được ghi) hoặc loop liên tục
+ *   (callback mỗi vòng, dùng để refill buffer)
+ * - Encoder WS2812: mỗi bit = 3 slot PTOR, sample rate 2.4 MHz
+ *
+ * @code
+ * // 30 LED WS2812 trên PTD0, LPIT channel 0 (FIRC 48 MHz) pace DMA channel 1
+ * static uint8_t s_slots[30U * 24U * GPIO_WAVE_SRV_WS2812_SLOTS_PER_BIT];
+ *
+ * LPIT_Init(LPIT_CLK_SRC_FIRC);
+ * GPIO_WritePin(GPIO_PORT_D, 0U, 0U);                  // line idle low
+ * uint32_t n = GPIO_WAVE_SRV_EncodeWs2812(grb, 90U, GPIO_WAVE_SRV_LANE_MASK(0U),
+ *                                         s_slots, sizeof(s_slots));
+ *
+ * gpio_wave_srv_config_t cfg = {
+ *     .port = GPIO_PORT_D, .target = GPIO_WAVE_SRV_REG_PTOR,
+ *     .width = GPIO_WAVE_SRV_WIDTH_8, .lane = GPIO_WAVE_SRV_LANE(0U),
+ *     .dma_channel = 1U, .trigger = TRGMUX_SRC_LPIT_CH0,
+ *     .sample_rate_hz = GPIO_WAVE_SRV_WS2812_RATE_HZ,
+ *     .pattern = s_slots, .length = (uint16_t)n, .loop = false
+ * };
+ * GPIO_WAVE_SRV_Start(&cfg, OnFrameSent, NULL);
+ * @endcode
+ *
+ * @note Enable IRQ của dma_channel trong NVIC và gọi DMA_IRQHandler() từ đó
+ *       (callback / one-shot completion). Loop không callback chạy không ISR.
+ * @note LPIT_Init() do application gọi trước. Period LPIT là số nguyên:
+ *       sample rate thực = clock / (clock / sample_rate_hz).
+ * @note PDOR ghi toàn bộ pin của lane (pin ngoài pattern cũng bị ghi);
+ *       PSOR / PCOR / PTOR chỉ tác động bit = 1, pin khác giữ nguyên.
+ * @note Sample đầu được ghi ngay khi Start (software START), các sample sau
+ *       mỗi trigger: sample i xuất ở thời điểm i / sample_rate_hz.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+#ifndef GPIO_WAVE_SRV_H
+#define GPIO_WAVE_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "gpio.h"
+#include "trgmux.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Số sample tối đa một pattern (CITER 15 bit) */
+#define GPIO_WAVE_SRV_MAX_SAMPLES       (32767U)
+
+/** @brief Số DMA channel có periodic trigger (DMAMUX channel 0 - 3) */
+#define GPIO_WAVE_SRV_DMA_CHANNELS      (4U)
+
+/** @brief Byte lane chứa pin (0 - 3) */
+#define GPIO_WAVE_SRV_LANE(pin)         ((uint8_t)((pin) / 8U))
+
+/** @brief Mask của pin trong byte lane của nó (sample 8 bit) */
+#define GPIO_WAVE_SRV_LANE_MASK(pin)    ((uint8_t)(1U << ((pin) % 8U)))
+
+/** @brief WS2812: 3 slot mỗi bit (bit 0 = H L L, bit 1 = H H L) */
+#define GPIO_WAVE_SRV_WS2812_SLOTS_PER_BIT (3U)
+
+/** @brief WS2812: 800 kbit/s * 3 slot, slot = 417 ns */
+#define GPIO_WAVE_SRV_WS2812_RATE_HZ    (2400000U)
+
+/**
+ * @brief GPIO waveform service status codes
+ */
+typedef enum {
+    GPIO_WAVE_SRV_SUCCESS = 0,
+    GPIO_WAVE_SRV_ERROR,
+    GPIO_WAVE_SRV_BUSY              /**< Waveform khác đang chạy */
+} gpio_wave_srv_status_t;
+
+/**
+ * @brief Register đích của mỗi sample
+ */
+typedef enum {
+    GPIO_WAVE_SRV_REG_PDOR = 0U,    /**< Ghi trực tiếp level của mọi pin trong lane */
+    GPIO_WAVE_SRV_REG_PSOR,         /**< Set bit = 1 */
+    GPIO_WAVE_SRV_REG_PCOR,         /**< Clear bit = 1 */
+    GPIO_WAVE_SRV_REG_PTOR          /**< Toggle bit = 1 */
+} gpio_wave_srv_reg_t;
+
+/**
+ * @brief Độ rộng một sample (kiểu phần tử của pattern)
+ */
+typedef enum {
+    GPIO_WAVE_SRV_WIDTH_8  = 1U,    /**< uint8_t, 8 pin của một byte lane */
+    GPIO_WAVE_SRV_WIDTH_16 = 2U,    /**< uint16_t, lane 0 hoặc 2 */
+    GPIO_WAVE_SRV_WIDTH_32 = 4U     /**< uint32_t, cả port (lane 0) */
+} gpio_wave_srv_width_t;
+
+/**
+ * @brief Waveform configuration
+ */
+typedef struct {
+    gpio_port_t port;               /**< GPIO port (pin đã mux GPIO, output) */
+    gpio_wave_srv_reg_t target;     /**< Register đích */
+    gpio_wave_srv_width_t width;    /**< Độ rộng sample */
+    uint8_t lane;                   /**< Byte offset trong register, căn theo width */
+    uint8_t dma_channel;            /**< 0 - 3 (periodic trigger) */
+    trgmux_source_t trigger;        /**< TRGMUX_SRC_LPIT_CH0..3 hoặc source do application pace */
+    uint32_t sample_rate_hz;        /**< Chỉ dùng với LPIT trigger, <= LPIT clock / 2 */
+    const void *pattern;            /**< Mảng sample theo width, tồn tại khi service chạy */
+    uint16_t length;                /**< 1 - GPIO_WAVE_SRV_MAX_SAMPLES sample */
+    bool loop;                      /**< Lặp pattern liên tục tới GPIO_WAVE_SRV_Stop() */
+} gpio_wave_srv_config_t;
+
+/**
+ * @brief Callback khi sample cuối của pattern đã được ghi (DMA ISR context)
+ * @details One-shot: waveform đã dừng, có thể Start lại trong callback.
+ *          Loop: gọi mỗi vòng, pattern đang chạy lại từ sample 0.
+ * @param user_data Pointer to user data
+ */
+typedef void (*gpio_wave_srv_callback_t)(void *user_data);
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Cấu hình DMA + trigger và bắt đầu xuất waveform
+ * @param config    Waveform configuration
+ * @param callback  Completion callback (có thể NULL)
+ * @param user_data Truyền vào callback
+ * @return gpio_wave_srv_status_t GPIO_WAVE_SRV_BUSY nếu waveform trước chưa
+ *         xong, GPIO_WAVE_SRV_ERROR nếu config không hợp lệ hoặc HAL từ chối
+ */
+gpio_wave_srv_status_t GPIO_WAVE_SRV_Start(const gpio_wave_srv_config_t *config,
+                                           gpio_wave_srv_callback_t callback,
+                                           void *user_data);
+
+/**
+ * @brief Dừng waveform ngay (pin giữ level của sample cuối đã ghi)
+ * @return gpio_wave_srv_status_t Status of operation
+ */
+gpio_wave_srv_status_t GPIO_WAVE_SRV_Stop(void);
+
+/**
+ * @brief Waveform đang chạy
+ */
+bool GPIO_WAVE_SRV_IsBusy(void);
+
+/**
+ * @brief Số sample chưa ghi của vòng hiện tại
+ * @return uint16_t 0 khi không chạy
+ */
+uint16_t GPIO_WAVE_SRV_GetRemaining(void);
+
+/**
+ * @brief Encode dữ liệu WS2812 (GRB, MSB first) thành slot PTOR 8 bit
+ * @details Line phải idle low trước khi Start; mỗi bit kết thúc ở low nên
+ *          frame kết thúc ở low, reset (>= 50 us low) do application chờ.
+ * @param data      Byte dữ liệu theo thứ tự gửi
+ * @param num_bytes Số byte
+ * @param lane_mask Mask pin trong byte lane (GPIO_WAVE_SRV_LANE_MASK())
+ * @param slots     Buffer output (pattern uint8_t)
+ * @param max_slots Kích thước buffer
+ * @return uint32_t Số slot đã ghi, 0 nếu buffer không đủ
+ */
+uint32_t GPIO_WAVE_SRV_EncodeWs2812(const uint8_t *data, uint32_t num_bytes, uint8_t lane_mask,
+                                    uint8_t *slots, uint32_t max_slots);
+
+#endif /* GPIO_WAVE_SRV_H */
@@ -0,0 +1,360 @@
+/**
+ * @file    isotp_srv.h
+ * @brief   ISO-TP Service Layer - ISO 15765-2 Transport over Classic CAN
+ * @details
+ * Service layer segment / reassemble message lớn hơn 8 bytes trên CAN
+ * (normal addressing, 11-bit hoặc 29-bit id), dùng cho UDS / bootloader.
+ *
+ * Features:
+ * - Single Frame, First Frame (12-bit length và escape 32-bit > 4095 bytes),
+ *   Consecutive Frame, Flow Control (CTS / WAIT / OVFLW)
+ * - Streaming RX: data được đưa ra sink theo từng CF, không cần buffer
+ *   một message nguyên vẹn trong service (message nhiều KB)
+ * - Receiver BS / STmin chỉnh lúc runtime (ISOTP_SRV_SetFlowControl): BS
+ *   lớn + STmin = 0 cho throughput gần wire speed
+ * - RX back-pressure: ISOTP_SRV_RxPause() giữ CTS tiếp theo và gửi FC WAIT
+ *   định kỳ (trước N_Br) cho tới ISOTP_SRV_RxResume()
+ * - TX non-blocking: CF được gửi trong ISOTP_SRV_Process() theo STmin / BS
+ *   của peer, timeout N_Bs / N_Cr
+ * - Buffer mode (ISOTP_SRV_SetRxBuffer): payload được copy thẳng từ frame
+ *   vào buffer của caller tại offset cuối cùng, không có buffer trung gian
+ * - can_srv binding: ISOTP_SRV_PollCanSrv() đọc frame ngay trong RX ring
+ *   của can_srv (CAN_SRV_PeekRx), ISOTP_SRV_CanSrvTxFrame() gửi qua CAN_SRV_Send
+ *   trên bus config.instance của link
+ *
+ * @code
+ * static bool OnRxBegin(uint32_t length, void *user_data)
+ * {
+ *     return (length <= sizeof(s_rx_buf));    // false -> FC OVFLW
+ * }
+ *
+ * static void OnRxData(const uint8_t *data, uint8_t length, uint32_t offset, void *user_data)
+ * {
+ *     memcpy(&s_rx_buf[offset], data, length);
+ * }
+ *
+ * static const isotp_srv_config_t s_isotp_cfg = {
+ *     .instance = 0U, .tx_mb = 8U, .tx_id = 0x7E8U, .rx_id = 0x7E0U, .id_type = CAN_ID_STD,
+ *     .block_size = 0U, .st_min = 0U, .padding = ISOTP_SRV_PADDING_BYTE,
+ *     .rx_begin = OnRxBegin, .rx_data = OnRxData, .rx_done = OnRxDone
+ * };
+ *
+ * ISOTP_SRV_Init(&s_link, &s_isotp_cfg);
+ *
+ * while (1) {
+ *     if (CAN_Receive(0U, 16U, &msg) == STATUS_SUCCESS) {
+ *         ISOTP_SRV_OnFrame(&s_link, &msg);
+ *     }
+ *     ISOTP_SRV_Process(&s_link);
+ * }
+ * @endcode
+ *
+ * Buffer mode trên can_srv (diagnostics, message tới 4 KB):
+ * @code
+ * static uint8_t s_diag_buf[2][4096];
+ *
+ * static void OnDiagDone(isotp_srv_status_t status, void *user_data)
+ * {
+ *     if (status == ISOTP_SRV_SUCCESS) {
+ *         s_ready = s_fill;                       // buffer thuộc application
+ *         s_fill ^= 1U;
+ *         ISOTP_SRV_SetRxBuffer(&s_diag, s_diag_buf[s_fill], sizeof(s_diag_buf[0]));
+ *     }
+ * }
+ *
+ * static const isotp_srv_config_t s_diag_cfg = {
+ *     .instance = CAN_SRV_CAN0, .tx_id = 0x7E8U, .rx_id = 0x7E0U, .id_type = CAN_ID_STD,
+ *     .block_size = 8U, .st_min = 0U, .padding = ISOTP_SRV_PADDING_BYTE,
+ *     .rx_done = OnDiagDone, .tx_frame = ISOTP_SRV_CanSrvTxFrame
+ * };
+ * static isotp_srv_link_t *const s_links[] = { &s_diag };
+ *
+ * ISOTP_SRV_Init(&s_diag, &s_diag_cfg);
+ * ISOTP_SRV_SetRxBuffer(&s_diag, s_diag_buf[0], sizeof(s_diag_buf[0]));
+ *
+ * while (1) {
+ *     ISOTP_SRV_PollCanSrv(CAN_SRV_CAN0, s_links, 1U, OnOtherFrame);
+ *     ISOTP_SRV_Process(&s_diag);
+ * }
+ * @endcode
+ *
+ * @note Timing dùng TIME_SRV_GetMicros32(): gọi TIME_SRV_Init() trước.
+ * @note ISOTP_SRV_OnFrame() và ISOTP_SRV_Process() của cùng link phải gọi
+ *       từ cùng một context (main loop, hoặc cùng một ISR priority).
+ * @note Chỉ full-duplex theo nghĩa một RX và một TX cùng lúc trên một link;
+ *       FC và CF dùng chung tx_mb, FC được retry trong Process khi MB bận.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.1
+ *
+ * @par Change Log:
+ * - Version 1.0: SF / FF / CF / FC, streaming RX, FC WAIT back-pressure
+ * - Version 1.1: Buffer mode, tx_frame hook, can_srv RX ring binding
+ */
+
+#ifndef ISOTP_SRV_H
+#define ISOTP_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "can.h"
+#include "can_srv.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief N_Bs: chờ FC sau FF / cuối block (µs) */
+#ifndef ISOTP_SRV_N_BS_TIMEOUT_US
+#define ISOTP_SRV_N_BS_TIMEOUT_US   (1000000UL)
+#endif
+
+/** @brief N_Cr: chờ CF tiếp theo (µs) */
+#ifndef ISOTP_SRV_N_CR_TIMEOUT_US
+#define ISOTP_SRV_N_CR_TIMEOUT_US   (1000000UL)
+#endif
+
+/** @brief Chu kỳ gửi FC WAIT khi RX bị pause (µs), phải < N_Bs của peer */
+#ifndef ISOTP_SRV_WAIT_PERIOD_US
+#define ISOTP_SRV_WAIT_PERIOD_US    (100000UL)
+#endif
+
+/** @brief N_WFTmax: số FC WAIT tối đa (RX gửi đi / TX chấp nhận) trước khi abort */
+#ifndef ISOTP_SRV_MAX_WFT
+#define ISOTP_SRV_MAX_WFT           (32U)
+#endif
+
+/** @brief Byte padding mặc định cho frame ngắn (DLC luôn = 8) */
+#define ISOTP_SRV_PADDING_BYTE      (0xCCU)
+
+/** @brief Payload tối đa của Single Frame (classic CAN, normal addressing) */
+#define ISOTP_SRV_SF_MAX_LENGTH     (7U)
+
+/** @brief Length tối đa dùng FF 12-bit, lớn hơn dùng escape 32-bit */
+#define ISOTP_SRV_FF_12BIT_MAX      (4095UL)
+
+/**
+ * @brief ISO-TP service status codes
+ */
+typedef enum {
+    ISOTP_SRV_SUCCESS = 0,
+    ISOTP_SRV_ERROR,
+    ISOTP_SRV_BUSY,                 /**< Link đang gửi message khác */
+    ISOTP_SRV_TIMEOUT,              /**< N_Bs / N_Cr timeout */
+    ISOTP_SRV_OVERFLOW,             /**< Peer trả FC OVFLW / sink từ chối length */
+    ISOTP_SRV_WRONG_SN,             /**< Sequence number CF không đúng */
+    ISOTP_SRV_WFT_OVERRUN,          /**< Quá ISOTP_SRV_MAX_WFT FC WAIT */
+    ISOTP_SRV_ABORTED               /**< RX bị thay bởi SF / FF mới */
+} isotp_srv_status_t;
+
+/**
+ * @brief RX begin callback (SF / FF)
+ * @param length    Tổng length message
+ * @param user_data User data của link
+ * @return false để từ chối (FF -> FC OVFLW, SF bị bỏ qua)
+ */
+typedef bool (*isotp_srv_rx_begin_t)(uint32_t length, void *user_data);
+
+/**
+ * @brief RX data callback, gọi cho mỗi SF / FF / CF theo thứ tự offset
+ * @param data      Payload của frame
+ * @param length    Bytes trong frame (1..7)
+ * @param offset    Offset trong message
+ * @param user_data User data của link
+ */
+typedef void (*isotp_srv_rx_data_t)(const uint8_t *data, uint8_t length,
+                                    uint32_t offset, void *user_data);
+
+/**
+ * @brief RX / TX completion callback
+ * @param status    ISOTP_SRV_SUCCESS hoặc lý do abort
+ * @param user_data User data của link
+ */
+typedef void (*isotp_srv_done_t)(isotp_srv_status_t status, void *user_data);
+
+/**
+ * @brief Frame transmit hook
+ * @param instance    config.instance của link
+ * @param id          CAN id
+ * @param is_extended 29-bit id
+ * @param data        8 bytes (đã padding)
+ * @param user_data   User data của link
+ * @return true nếu frame đã được nhận để gửi, false = TX bận (retry sau)
+ */
+typedef bool (*isotp_srv_tx_frame_t)(uint8_t instance, uint32_t id, bool is_extended,
+                                     const uint8_t *data, void *user_data);
+
+/**
+ * @brief ISO-TP link configuration
+ */
+typedef struct {
+    uint8_t instance;               /**< CAN instance (tx_frame = NULL), hoặc truyền cho tx_frame */
+    uint8_t tx_mb;                  /**< TX mailbox, CAN_SetupTxMailbox đã gọi (khi tx_frame = NULL) */
+    uint32_t tx_id;                 /**< CAN id gửi đi */
+    uint32_t rx_id;                 /**< CAN id nhận (frame khác id bị bỏ qua) */
+    can_id_type_t id_type;          /**< STD / EXT cho cả hai id */
+    uint8_t block_size;             /**< BS gửi trong FC (0 = không giới hạn) */
+    uint8_t st_min;                 /**< STmin gửi trong FC (encoding ISO 15765-2) */
+    uint8_t padding;                /**< Byte padding */
+    isotp_srv_rx_begin_t rx_begin;  /**< Có thể NULL (nhận mọi length) */
+    isotp_srv_rx_data_t rx_data;    /**< RX sink (NULL = buffer mode) */
+    isotp_srv_done_t rx_done;       /**< RX kết thúc (có thể NULL) */
+    isotp_srv_done_t tx_done;       /**< TX kết thúc (có thể NULL) */
+    void *user_data;                /**< Truyền cho mọi callback */
+    isotp_srv_tx_frame_t tx_frame;  /**< NULL = CAN_Send(instance, tx_mb) */
+} isotp_srv_config_t;
+
+/**
+ * @brief ISO-TP link state (application cấp phát, không truy cập trực tiếp)
+ */
+typedef struct {
+    isotp_srv_config_t config;
+
+    /* RX */
+    uint8_t rx_state;
+    uint8_t rx_sn;
+    uint8_t rx_bs_count;
+    uint8_t rx_wft;
+    bool rx_paused;
+    bool fc_pending;
+    uint8_t fc_status;
+    uint32_t rx_length;
+    uint32_t rx_offset;
+    uint32_t rx_deadline;
+
+    /* Buffer mode */
+    uint8_t *rx_buffer;
+    uint32_t rx_buffer_size;
+    uint32_t rx_complete_length;
+    bool rx_need_buffer;
+    uint8_t rx_head[6];
+
+    /* TX */
+    uint8_t tx_state;
+    uint8_t tx_sn;
+    uint8_t tx_bs;
+    uint8_t tx_bs_count;
+    uint8_t tx_wft;
+    uint32_t tx_st_us;
+    const uint8_t *tx_data;
+    uint32_t tx_length;
+    uint32_t tx_offset;
+    uint32_t tx_deadline;
+    uint32_t tx_next;
+} isotp_srv_link_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Initialize link
+ * @param link   Link state
+ * @param config Configuration (copy vào link)
+ * @return isotp_srv_status_t
+ */
+isotp_srv_status_t ISOTP_SRV_Init(isotp_srv_link_t *link, const isotp_srv_config_t *config);
+
+/**
+ * @brief Đổi BS / STmin gửi trong các FC tiếp theo
+ * @param link       Link
+ * @param block_size BS (0 = không giới hạn)
+ * @param st_min     STmin (0x00-0x7F ms, 0xF1-0xF9 = 100-900 µs)
+ */
+void ISOTP_SRV_SetFlowControl(isotp_srv_link_t *link, uint8_t block_size, uint8_t st_min);
+
+/**
+ * @brief Đưa một CAN frame nhận được vào link
+ * @param link    Link
+ * @param message Frame (id khác rx_id bị bỏ qua)
+ * @return true nếu frame thuộc link này
+ */
+bool ISOTP_SRV_OnFrame(isotp_srv_link_t *link, const can_message_t *message);
+
+/**
+ * @brief Gửi CF theo STmin, retry FC, kiểm tra timeout
+ * @param link Link
+ * @note Gọi liên tục trong main loop (mỗi lần tối đa một frame)
+ */
+void ISOTP_SRV_Process(isotp_srv_link_t *link);
+
+/**
+ * @brief Bắt đầu gửi message (non-blocking)
+ * @param link   Link
+ * @param data   Data (phải tồn tại tới tx_done)
+ * @param length Bytes (1 .. 2^32 - 1)
+ * @return ISOTP_SRV_BUSY nếu đang gửi hoặc tx_mb bận, ISOTP_SRV_ERROR nếu sai tham số
+ * @note Message <= 7 bytes: tx_done được gọi ngay trong ISOTP_SRV_Send()
+ */
+isotp_srv_status_t ISOTP_SRV_Send(isotp_srv_link_t *link, const uint8_t *data, uint32_t length);
+
+/**
+ * @brief Check link đang gửi
+ * @param link Link
+ * @return bool
+ */
+bool ISOTP_SRV_IsTxBusy(const isotp_srv_link_t *link);
+
+/**
+ * @brief Giữ CTS tiếp theo (sink hết buffer), peer nhận FC WAIT định kỳ
+ * @param link Link
+ */
+void ISOTP_SRV_RxPause(isotp_srv_link_t *link);
+
+/**
+ * @brief Cho phép RX tiếp tục, gửi CTS nếu peer đang chờ
+ * @param link Link
+ */
+void ISOTP_SRV_RxResume(isotp_srv_link_t *link);
+
+/**
+ * @brief Gắn buffer nhận message tiếp theo (buffer mode, rx_data = NULL)
+ * @details Sau rx_done(ISOTP_SRV_SUCCESS) buffer được tách khỏi link và thuộc
+ *          application (message dài ISOTP_SRV_GetRxLength() bytes). Khi chưa
+ *          có buffer: FF được giữ bằng FC WAIT, SF bị drop với rx_done(OVERFLOW).
+ * @param link   Link
+ * @param buffer Buffer (NULL = tách buffer hiện tại)
+ * @param size   Bytes, message dài hơn bị từ chối bằng FC OVFLW
+ */
+void ISOTP_SRV_SetRxBuffer(isotp_srv_link_t *link, uint8_t *buffer, uint32_t size);
+
+/**
+ * @brief Length message vừa nhận xong trong buffer mode
+ * @param link Link
+ * @return uint32_t Bytes
+ */
+uint32_t ISOTP_SRV_GetRxLength(const isotp_srv_link_t *link);
+
+/**
+ * @brief Đưa frame từ RX ring của can_srv vào các link (zero-copy peek)
+ * @details Frame được đọc ngay trong ring slot và release sau khi xử lý.
+ *          Frame không thuộc link nào được chuyển cho other (NULL = bỏ qua).
+ * @param instance can_srv instance
+ * @param links Mảng link
+ * @param count Số link
+ * @param other Callback cho frame khác (có thể NULL)
+ * @return uint32_t Số frame đã đọc
+ * @note Thay cho CAN_SRV_Receive() / CAN_SRV_ReceiveBatch() trong main loop
+ */
+uint32_t ISOTP_SRV_PollCanSrv(can_srv_instance_t instance, isotp_srv_link_t *const *links,
+                              uint8_t count, can_srv_rx_callback_t other);
+
+/**
+ * @brief tx_frame hook gửi qua CAN_SRV_Send() (TX pool / queue của can_srv)
+ * @details Link đặt config.instance = can_srv instance (CAN_SRV_CAN0..2), cùng
+ *          bus với ISOTP_SRV_PollCanSrv().
+ * @param instance    can_srv_instance_t
+ * @param id          CAN id
+ * @param is_extended 29-bit id
+ * @param data        8 bytes
+ * @param user_data   Không dùng
+ * @return bool false nếu TX MB và TX queue đều đầy
+ */
+bool ISOTP_SRV_CanSrvTxFrame(uint8_t instance, uint32_t id, bool is_extended, const uint8_t *data,
+                             void *user_data);
+
+#endif /* ISOTP_SRV_H */
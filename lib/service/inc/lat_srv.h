@@ -0,0 +1,127 @@
+/**
+ * @file    lat_srv.h
+ * @brief   Latency Service Layer - ISR Latency / Jitter Histograms
+ * @details
+ * Service layer đo thời gian từ hardware trigger tới lúc vào ISR, dùng để
+ * kiểm tra priority gán bằng NVIC_SetPriority() dưới tải thực.
+ *
+ * Nguyên lý:
+ * - Trigger là lần expire của một LPIT channel periodic (reference channel):
+ *   trực tiếp (LPIT_IRQHandler) hoặc qua TRGMUX / DMAMUX (ADC, DMA)
+ * - Sau expire counter reload TVAL và đếm xuống, nên tại ISR entry
+ *   (TVAL - CVAL) là số LPIT counts kể từ trigger
+ * - HAL handlers build với NVIC_ISR_TRACE_ENABLE = 1 gọi hook ở entry,
+ *   service snapshot CVAL và cộng vào histogram của IRQ tương ứng
+ *
+ * @code
+ * // Build flags: -DNVIC_ISR_TRACE_ENABLE=1
+ * static lat_srv_probe_t s_lat_adc;
+ * static lat_srv_probe_t s_lat_lpit;
+ *
+ * LPIT_Init(LPIT_CLK_SRC_FIRC);       // 48 MHz: ~21 ns mỗi count
+ * ... LPIT channel 0 periodic, trigger ADC0 qua TRGMUX ...
+ * LAT_SRV_Init(0U);
+ * LAT_SRV_Register(&s_lat_lpit, LPIT0_Ch0_IRQn, "lpit0_ch0");
+ * LAT_SRV_Register(&s_lat_adc, ADC0_IRQn, "adc0");
+ * ...
+ * LAT_SRV_Dump(LPUART1);
+ * @endcode
+ *
+ * @note Latency của IRQ trigger gián tiếp bao gồm thời gian peripheral
+ *       (vd. ADC sample + conversion): min là phần cố định, max - min là jitter.
+ * @note Latency phải nhỏ hơn một period của reference channel.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+#ifndef LAT_SRV_H
+#define LAT_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "nvic.h"
+#include "uart.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Số IRQ đo đồng thời */
+#ifndef LAT_SRV_MAX_PROBES
+#define LAT_SRV_MAX_PROBES          (8U)
+#endif
+
+/** @brief Số bins mỗi histogram (bin cuối = overflow) */
+#ifndef LAT_SRV_BINS
+#define LAT_SRV_BINS                (16U)
+#endif
+
+/** @brief Bin width = 2^LAT_SRV_BIN_SHIFT LPIT counts */
+#ifndef LAT_SRV_BIN_SHIFT
+#define LAT_SRV_BIN_SHIFT           (1U)
+#endif
+
+/**
+ * @brief Latency service status codes
+ */
+typedef enum {
+    LAT_SRV_SUCCESS = 0,
+    LAT_SRV_ERROR,
+    LAT_SRV_NOT_INITIALIZED
+} lat_srv_status_t;
+
+/**
+ * @brief Latency histogram của một IRQ (LPIT counts)
+ */
+typedef struct {
+    const char *name;               /**< Tên in ra trong dump */
+    IRQn_Type irq;                  /**< Instrumented IRQ */
+    uint32_t count;                 /**< Số sample */
+    uint32_t min;                   /**< Min latency */
+    uint32_t max;                   /**< Max latency */
+    uint64_t total;                 /**< Tổng (avg = total / count) */
+    uint32_t bins[LAT_SRV_BINS];    /**< Histogram */
+} lat_srv_probe_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Khởi tạo latency service
+ * @details Reference channel phải được cấu hình periodic (LPIT_ConfigChannel)
+ *          trước; TVAL được đọc một lần ở đây. Cài hook bằng
+ *          NVIC_InstallEntryHook().
+ * @param ref_channel LPIT channel có expire là trigger
+ * @return lat_srv_status_t LAT_SRV_ERROR khi HAL không build với NVIC_ISR_TRACE_ENABLE
+ */
+lat_srv_status_t LAT_SRV_Init(uint8_t ref_channel);
+
+/**
+ * @brief Đăng ký một IRQ để đo
+ * @param probe Histogram storage (application cấp phát)
+ * @param irq   IRQ number (ADC0_IRQn, DMA0_IRQn + ch, LPIT0_Ch0_IRQn + ch)
+ * @param name  Tên in ra trong dump (không copy)
+ * @return lat_srv_status_t LAT_SRV_ERROR khi bảng probe đầy
+ */
+lat_srv_status_t LAT_SRV_Register(lat_srv_probe_t *probe, IRQn_Type irq, const char *name);
+
+/**
+ * @brief Xóa histogram của một probe
+ * @param probe Probe
+ */
+void LAT_SRV_Reset(lat_srv_probe_t *probe);
+
+/**
+ * @brief In count / min / avg / max và histogram (ns) qua UART (blocking)
+ * @param base LPUART đã init
+ * @return lat_srv_status_t Status of operation
+ */
+lat_srv_status_t LAT_SRV_Dump(LPUART_RegType *base);
+
+#endif /* LAT_SRV_H */
@@ -0,0 +1,181 @@
+/**
+ * @file    nvm_srv.h
+ * @brief   NVM Service Layer - FlexRAM EEPROM Emulation Parameter Storage
+ * @details
+ * Service layer lưu calibration / config parameters trong emulated EEPROM
+ * (FlexRAM EEE mode, FlexNVM làm EEPROM backup). FTFC tự quản lý wear
+ * leveling trong backup, mỗi word ghi vào FlexRAM là một EEE record.
+ *
+ * Features:
+ * - Lần boot đầu: partition FlexNVM (tùy chọn) và bật FlexRAM EEE mode
+ * - Parameter theo id, offset gán lúc init theo thứ tự trong bảng (word aligned)
+ * - RAM shadow cache: NVM_SRV_Write / NVM_SRV_Read chỉ chạm RAM (vài µs)
+ * - Write coalescing: dirty bitmap theo word, nhiều lần ghi cùng word trước
+ *   NVM_SRV_Process() chỉ tạo một EEE write; word không đổi không bị ghi
+ * - NVM_SRV_Process() non-blocking: tối đa một word mỗi lần gọi, chỉ khi
+ *   FTFC idle (EEE write mất ~100 µs .. vài ms, không bao giờ chờ sector erase)
+ * - Tùy chọn (NVM_SRV_PARAM_CRC_ENABLE): CRC-32 mỗi parameter tính bằng
+ *   hardware CRC engine, phát hiện parameter bị ghi dở khi mất nguồn
+ *
+ * @code
+ * enum { PARAM_GAIN = 1, PARAM_OFFSET = 2, PARAM_NODE_ID = 3 };
+ *
+ * static const nvm_srv_param_t s_params[] = {
+ *     { PARAM_GAIN,    sizeof(float) * 4U },
+ *     { PARAM_OFFSET,  sizeof(int16_t) * 4U },
+ *     { PARAM_NODE_ID, sizeof(uint8_t) }
+ * };
+ *
+ * static const nvm_srv_config_t s_nvm_cfg = {
+ *     s_params, 3U, true, FTFC_EEESIZE_4KB, FTFC_DEPART_DF32_EE32
+ * };
+ *
+ * NVM_SRV_Init(&s_nvm_cfg);
+ * NVM_SRV_Read(PARAM_GAIN, gain, sizeof(gain));
+ *
+ * gain[0] = 1.02f;
+ * NVM_SRV_Write(PARAM_GAIN, gain, sizeof(gain));  // RAM only, trả về ngay
+ *
+ * while (1) {
+ *     NVM_SRV_Process();                           // main loop / idle task
+ * }
+ * @endcode
+ *
+ * @note Thêm parameter mới ở cuối bảng: đổi thứ tự hoặc size làm dịch offset
+ *       của các parameter phía sau (data cũ bị đọc sai).
+ * @note Chỉ word 32-bit là atomic khi mất nguồn; parameter nhiều word có thể
+ *       bị ghi dở. Gọi NVM_SRV_Flush() trước reset / shutdown có kiểm soát.
+ * @note FlexNVM dùng cho EEPROM backup không còn là data flash cho FTFC_Program().
+ * @note NVM_SRV_PARAM_CRC_ENABLE thêm một word CRC sau mỗi parameter (đổi
+ *       layout EEE); CRC_Init() phải được gọi trước NVM_SRV_Init().
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.1
+ */
+
+#ifndef NVM_SRV_H
+#define NVM_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "ftfc.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Bytes EEE được mirror trong RAM shadow (bội số của 4, <= EEE size) */
+#ifndef NVM_SRV_SHADOW_SIZE
+#define NVM_SRV_SHADOW_SIZE         (1024U)
+#endif
+
+/** @brief Số parameter tối đa */
+#ifndef NVM_SRV_MAX_PARAMS
+#define NVM_SRV_MAX_PARAMS          (32U)
+#endif
+
+/**
+ * @brief CRC-32 word sau mỗi parameter (0 = tắt, layout tương thích v1.0)
+ * @details CRC được tính lại trong NVM_SRV_Process() bằng hardware CRC engine,
+ *          parameter có CRC sai lúc init được NVM_SRV_Read() báo NVM_SRV_CRC_ERROR.
+ */
+#ifndef NVM_SRV_PARAM_CRC_ENABLE
+#define NVM_SRV_PARAM_CRC_ENABLE    (0U)
+#endif
+
+/**
+ * @brief NVM service status codes
+ */
+typedef enum {
+    NVM_SRV_SUCCESS = 0,
+    NVM_SRV_ERROR,
+    NVM_SRV_NOT_INITIALIZED,
+    NVM_SRV_INVALID_ID,             /**< Id không có trong bảng parameter */
+    NVM_SRV_INVALID_LENGTH,         /**< Length lớn hơn size của parameter */
+    NVM_SRV_NO_SPACE,               /**< Bảng parameter vượt shadow / EEE size */
+    NVM_SRV_NOT_PARTITIONED,        /**< FlexNVM chưa partition và allow_partition = false */
+    NVM_SRV_TIMEOUT,
+    NVM_SRV_CRC_ERROR               /**< CRC parameter sai (chưa từng ghi hoặc ghi dở) */
+} nvm_srv_status_t;
+
+/**
+ * @brief Parameter descriptor
+ */
+typedef struct {
+    uint16_t id;                    /**< Application id (duy nhất) */
+    uint16_t size;                  /**< Bytes */
+} nvm_srv_param_t;
+
+/**
+ * @brief NVM service configuration
+ */
+typedef struct {
+    const nvm_srv_param_t *params;  /**< Bảng parameter (giữ nguyên thứ tự giữa các firmware) */
+    uint8_t param_count;            /**< Số parameter */
+    bool allow_partition;           /**< Partition FlexNVM nếu chưa partition (lần boot đầu) */
+    uint8_t eee_size_code;          /**< FTFC_EEESIZE_x khi partition */
+    uint8_t depart_code;            /**< FTFC_DEPART_x khi partition */
+} nvm_srv_config_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Initialize NVM service
+ * @details Partition FlexNVM nếu cần, bật FlexRAM EEE mode, gán offset cho
+ *          parameter và load RAM shadow từ FlexRAM.
+ * @param config Configuration (bảng params phải tồn tại suốt runtime)
+ * @return nvm_srv_status_t
+ * @note Gọi ở RUN mode, sau FTFC_Init()
+ */
+nvm_srv_status_t NVM_SRV_Init(const nvm_srv_config_t *config);
+
+/**
+ * @brief Ghi parameter vào RAM shadow, đánh dấu word thay đổi là dirty
+ * @param id     Parameter id
+ * @param data   Data
+ * @param length Bytes (<= size của parameter, ghi từ đầu parameter)
+ * @return nvm_srv_status_t
+ * @note ISR-safe, không chạm flash
+ */
+nvm_srv_status_t NVM_SRV_Write(uint16_t id, const void *data, uint16_t length);
+
+/**
+ * @brief Đọc parameter từ RAM shadow
+ * @param id     Parameter id
+ * @param data   Buffer
+ * @param length Bytes (<= size của parameter)
+ * @return nvm_srv_status_t
+ * @note Với NVM_SRV_PARAM_CRC_ENABLE, NVM_SRV_CRC_ERROR vẫn copy data nhưng
+ *       application nên dùng giá trị default cho tới NVM_SRV_Write() kế tiếp.
+ */
+nvm_srv_status_t NVM_SRV_Read(uint16_t id, void *data, uint16_t length);
+
+/**
+ * @brief Ghi tối đa một dirty word vào FlexRAM (non-blocking)
+ * @details Bỏ qua khi FTFC đang bận (EEE write trước hoặc command khác)
+ *          hoặc không ở RUN mode. Với NVM_SRV_PARAM_CRC_ENABLE, CRC của một
+ *          parameter vừa ghi được tính lại trước (bỏ qua nếu CRC engine bận).
+ * @return uint32_t Số dirty word còn lại
+ */
+uint32_t NVM_SRV_Process(void);
+
+/**
+ * @brief Ghi hết dirty words (blocking)
+ * @param timeout_loops Số vòng chờ tối đa (0 = không giới hạn)
+ * @return NVM_SRV_SUCCESS, NVM_SRV_TIMEOUT nếu còn dirty word
+ */
+nvm_srv_status_t NVM_SRV_Flush(uint32_t timeout_loops);
+
+/**
+ * @brief Số dirty word chưa ghi xuống FlexRAM
+ * @return uint32_t Pending words
+ */
+uint32_t NVM_SRV_GetPendingCount(void);
+
+#endif /* NVM_SRV_H */
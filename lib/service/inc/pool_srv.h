@@ -0,0 +1,160 @@
+/**
+ * @file    pool_srv.h
+ * @brief   Pool Service Layer - Fixed-Block Pools and Ref-Counted Messages
+ * @details
+ * Service layer cấp phát block kích thước cố định không dùng heap, để CAN
+ * frames, UART frames và ADC blocks được chuyển giữa các module bằng pointer
+ * thay vì copy qua callback.
+ *
+ * Features:
+ * - Free list lock-free (LDREX / STREX, atomic.h): alloc / free gọi được từ
+ *   ISR và thread mà không mask interrupt
+ * - Message buffer có reference count: producer alloc (refs = 1), mỗi
+ *   consumer giữ thêm bằng Retain, block trả về pool ở Release cuối cùng
+ * - Storage do application cấp phát (static), mỗi loại message một pool
+ *
+ * @code
+ * POOL_SRV_STORAGE(s_can_storage, sizeof(can_srv_message_t), 8U);
+ * static pool_srv_t s_can_pool;
+ *
+ * POOL_SRV_Init(&s_can_pool, s_can_storage,
+ *               POOL_SRV_BLOCK_SIZE(sizeof(can_srv_message_t)), 8U);
+ *
+ * // ISR: producer
+ * pool_srv_msg_t *msg = POOL_SRV_MsgAlloc(&s_can_pool, MSG_TYPE_CAN);
+ * if (msg != NULL) {
+ *     memcpy(msg->data, &frame, sizeof(frame));
+ *     msg->length = sizeof(frame);
+ *     SCHED_SRV_Post(&s_rx_work, (uint32_t)msg);   // ownership chuyển đi
+ * }
+ *
+ * // Thread: consumer
+ * POOL_SRV_MsgRetain(msg);          // chia sẻ cho logger
+ * ...
+ * POOL_SRV_MsgRelease(msg);
+ * @endcode
+ *
+ * @note Block đã Free / Release không được truy cập lại (không kiểm tra double free).
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+#ifndef POOL_SRV_H
+#define POOL_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @brief Pool service status codes
+ */
+typedef enum {
+    POOL_SRV_SUCCESS = 0,
+    POOL_SRV_ERROR,
+    POOL_SRV_NOT_INITIALIZED
+} pool_srv_status_t;
+
+/**
+ * @brief Fixed-block pool
+ */
+typedef struct {
+    volatile uint32_t free_head;    /**< Địa chỉ block free đầu tiên (0 = hết) */
+    volatile uint32_t free_count;   /**< Số block free */
+    uint8_t *base;                  /**< Storage */
+    uint32_t block_size;            /**< Bytes mỗi block (bội số của 4) */
+    uint32_t block_count;           /**< Số block */
+} pool_srv_t;
+
+/**
+ * @brief Reference-counted message buffer (header đầu mỗi block)
+ */
+typedef struct {
+    pool_srv_t *pool;               /**< Pool chứa message */
+    volatile uint32_t refs;         /**< Reference count */
+    uint16_t type;                  /**< Application tag (CAN / UART / ADC ...) */
+    uint16_t length;                /**< Bytes hợp lệ trong data */
+    uint8_t data[];                 /**< Payload (POOL_SRV_MsgCapacity bytes) */
+} pool_srv_msg_t;
+
+/** @brief Block size cho message có payload bytes */
+#define POOL_SRV_BLOCK_SIZE(payload) \
+    ((((uint32_t)sizeof(pool_srv_msg_t) + (uint32_t)(payload)) + 3U) & ~3U)
+
+/** @brief Static storage (word aligned) cho count messages */
+#define POOL_SRV_STORAGE(name, payload, count) \
+    static uint32_t name[(POOL_SRV_BLOCK_SIZE(payload) / 4U) * (count)]
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Khởi tạo pool, mọi block vào free list
+ * @param pool        Pool
+ * @param storage     Storage word aligned, block_size * block_count bytes
+ * @param block_size  Bytes mỗi block (bội số của 4, >= 4)
+ * @param block_count Số block
+ * @return pool_srv_status_t Status of operation
+ */
+pool_srv_status_t POOL_SRV_Init(pool_srv_t *pool, void *storage,
+                                uint32_t block_size, uint32_t block_count);
+
+/**
+ * @brief Lấy một block (ISR-safe, lock-free)
+ * @param pool Pool
+ * @return void* Block, NULL khi pool rỗng
+ */
+void *POOL_SRV_Alloc(pool_srv_t *pool);
+
+/**
+ * @brief Trả block về pool (ISR-safe, lock-free)
+ * @param pool  Pool đã cấp block
+ * @param block Block
+ * @return pool_srv_status_t POOL_SRV_ERROR khi block không thuộc pool
+ */
+pool_srv_status_t POOL_SRV_Free(pool_srv_t *pool, void *block);
+
+/**
+ * @brief Số block còn free
+ * @param pool Pool
+ * @return uint32_t Free blocks
+ */
+uint32_t POOL_SRV_GetFreeCount(const pool_srv_t *pool);
+
+/**
+ * @brief Lấy một message (refs = 1, length = 0)
+ * @param pool Pool có block_size >= POOL_SRV_BLOCK_SIZE(0)
+ * @param type Application tag
+ * @return pool_srv_msg_t* Message, NULL khi pool rỗng
+ */
+pool_srv_msg_t *POOL_SRV_MsgAlloc(pool_srv_t *pool, uint16_t type);
+
+/**
+ * @brief Thêm một reference (ISR-safe)
+ * @param msg Message
+ */
+void POOL_SRV_MsgRetain(pool_srv_msg_t *msg);
+
+/**
+ * @brief Bỏ một reference, trả block về pool khi refs về 0 (ISR-safe)
+ * @param msg Message
+ */
+void POOL_SRV_MsgRelease(pool_srv_msg_t *msg);
+
+/**
+ * @brief Số bytes payload tối đa của message
+ * @param msg Message
+ * @return uint32_t Capacity
+ */
+uint32_t POOL_SRV_MsgCapacity(const pool_srv_msg_t *msg);
+
+#endif /* POOL_SRV_H */
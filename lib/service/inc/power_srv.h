@@ -0,0 +1,183 @@
+/**
+ * @file    power_srv.h
+ * @brief   Power Mode Service Layer - RUN / HSRUN / VLPR Transitions
+ * @details
+ * Service layer quản lý run mode của S32K144: burst 112 MHz (HSRUN) cho
+ * DSP nặng, RUN bình thường, VLPR (SIRC, <= 4 MHz) khi idle lâu.
+ *
+ * Features:
+ * - Clock configuration riêng cho từng mode (RCCR / HCCR / VCCR), tùy chọn
+ *   SPLL config riêng (SPLL được relock trong khi system clock chạy tạm FIRC)
+ * - SMC PMCTRL sequencing: HSRUN <-> VLPR tự đi qua RUN, chờ PMSTAT và CSR
+ * - VLPR: SPLL / SOSC / FIRC tự tắt trước khi vào và bật lại khi ra
+ * - Callback registry: BEFORE (có thể veto), AFTER (clock cache đã update,
+ *   driver tính lại baud / timing), ABORTED (transition bị veto hoặc fail)
+ * - ClockManager notifier (ClockManager_RegisterNotifier) nhận BEFORE / AFTER
+ *   sau khi không callback nào veto
+ *
+ * @code
+ * static const power_srv_config_t s_power_cfg = {
+ *     .run   = { { SCG_CLOCK_SRC_SPLL, SCG_CLOCK_DIV_BY_2, SCG_CLOCK_DIV_BY_1, SCG_CLOCK_DIV_BY_3 }, NULL },
+ *     .hsrun = { { SCG_CLOCK_SRC_SPLL, SCG_CLOCK_DIV_BY_1, SCG_CLOCK_DIV_BY_2, SCG_CLOCK_DIV_BY_4 }, NULL },
+ *     .vlpr  = { { SCG_CLOCK_SRC_SIRC, SCG_CLOCK_DIV_BY_2, SCG_CLOCK_DIV_BY_1, SCG_CLOCK_DIV_BY_4 }, NULL },
+ *     .allow_hsrun = true,
+ *     .allow_vlpr = true
+ * };
+ *
+ * static bool OnPowerChange(power_srv_event_t event, power_srv_mode_t from,
+ *                           power_srv_mode_t to, void *user_data)
+ * {
+ *     if (event == POWER_SRV_EVENT_AFTER) {
+ *         // UART / CAN / SysTick tự tính lại qua ClockManager notifier
+ *         // LPIT: reload theo clock mới
+ *         LPIT_SetPeriod(0U, LPIT_CalculatePeriod(LPIT_GetClockFreq(), 1000U));
+ *     }
+ *     return true;
+ * }
+ *
+ * POWER_SRV_Init(&s_power_cfg);
+ * POWER_SRV_RegisterCallback(OnPowerChange, NULL);
+ * POWER_SRV_SetMode(POWER_SRV_MODE_HSRUN);    // FFT / filter burst
+ * POWER_SRV_SetMode(POWER_SRV_MODE_RUN);
+ * @endcode
+ *
+ * @note SPLL / SOSC phải được init trước POWER_SRV_Init(). RUN và HSRUN dùng
+ *       chung SPLL khi spll = NULL (vd. SPLL 112 MHz, RUN divCore = 2).
+ * @note Peripheral clocked từ SPLLDIV2 / FIRCDIV2 / SOSCDIV2 dừng trong VLPR:
+ *       chỉ SIRCDIV2 còn chạy.
+ * @note Không program / erase flash trong HSRUN hoặc VLPR.
+ * @warning PMPROT là write-once: POWER_SRV_Init() phải là nơi đầu tiên ghi nó.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+#ifndef POWER_SRV_H
+#define POWER_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "scg.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Số callback tối đa */
+#ifndef POWER_SRV_MAX_CALLBACKS
+#define POWER_SRV_MAX_CALLBACKS     (8U)
+#endif
+
+/**
+ * @brief Power service status codes
+ */
+typedef enum {
+    POWER_SRV_SUCCESS = 0,
+    POWER_SRV_ERROR,
+    POWER_SRV_NOT_INITIALIZED,
+    POWER_SRV_NOT_ALLOWED,          /**< Mode không được PMPROT cho phép hoặc bị callback veto */
+    POWER_SRV_TIMEOUT,
+    POWER_SRV_REGISTRY_FULL
+} power_srv_status_t;
+
+/**
+ * @brief Run modes
+ */
+typedef enum {
+    POWER_SRV_MODE_RUN = 0,         /**< RUN, core <= 80 MHz */
+    POWER_SRV_MODE_HSRUN,           /**< HSRUN, core <= 112 MHz */
+    POWER_SRV_MODE_VLPR             /**< VLPR, SIRC, core <= 4 MHz */
+} power_srv_mode_t;
+
+/**
+ * @brief Transition events
+ */
+typedef enum {
+    POWER_SRV_EVENT_BEFORE = 0,     /**< Trước khi đổi clock, return false để veto */
+    POWER_SRV_EVENT_AFTER,          /**< Mode mới active, ClockManager đã update */
+    POWER_SRV_EVENT_ABORTED         /**< Transition không hoàn tất (veto / lỗi), mode thật: POWER_SRV_GetMode() */
+} power_srv_event_t;
+
+/**
+ * @brief Transition callback
+ * @param event     BEFORE / AFTER / ABORTED
+ * @param from      Mode hiện tại
+ * @param to        Mode yêu cầu
+ * @param user_data User data khi register
+ * @return false ở BEFORE để veto (vd. transfer đang chạy), bỏ qua ở event khác
+ */
+typedef bool (*power_srv_callback_t)(power_srv_event_t event, power_srv_mode_t from,
+                                     power_srv_mode_t to, void *user_data);
+
+/**
+ * @brief Clock của một mode
+ */
+typedef struct {
+    scg_system_clock_config_t clock;    /**< RCCR / HCCR / VCCR */
+    const scg_spll_config_t *spll;      /**< SPLL relock khi vào mode (NULL = giữ SPLL hiện tại) */
+} power_srv_mode_config_t;
+
+/**
+ * @brief Power service configuration
+ */
+typedef struct {
+    power_srv_mode_config_t run;        /**< RUN clock */
+    power_srv_mode_config_t hsrun;      /**< HSRUN clock */
+    power_srv_mode_config_t vlpr;       /**< VLPR clock (source phải là SIRC, spll bị bỏ qua) */
+    bool allow_hsrun;                   /**< PMPROT[AHSRUN] */
+    bool allow_vlpr;                    /**< PMPROT[AVLP] */
+} power_srv_config_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Initialize power service
+ * @details Ghi PMPROT, lưu config, đọc mode hiện tại từ PMSTAT.
+ * @param config Mode clock configuration (copy vào service)
+ * @return power_srv_status_t
+ */
+power_srv_status_t POWER_SRV_Init(const power_srv_config_t *config);
+
+/**
+ * @brief Register transition callback
+ * @param callback  Callback function
+ * @param user_data User data
+ * @return POWER_SRV_REGISTRY_FULL nếu đã đủ POWER_SRV_MAX_CALLBACKS
+ * @note Callback được gọi theo thứ tự register, ở thread mode của caller
+ */
+power_srv_status_t POWER_SRV_RegisterCallback(power_srv_callback_t callback, void *user_data);
+
+/**
+ * @brief Unregister transition callback (callback + user_data phải khớp)
+ * @param callback  Callback function
+ * @param user_data User data
+ * @return power_srv_status_t
+ */
+power_srv_status_t POWER_SRV_UnregisterCallback(power_srv_callback_t callback, void *user_data);
+
+/**
+ * @brief Switch run mode
+ * @details BEFORE callbacks -> clock / SMC sequencing (interrupt masked) ->
+ *          ClockManager_Update() -> AFTER callbacks.
+ * @param mode Target mode
+ * @return power_srv_status_t
+ *         - POWER_SRV_SUCCESS: đã ở mode mới (hoặc đã ở sẵn)
+ *         - POWER_SRV_NOT_ALLOWED: PMPROT không cho phép hoặc callback veto
+ *         - POWER_SRV_TIMEOUT / POWER_SRV_ERROR: sequencing fail, ABORTED đã gửi
+ * @note Không gọi từ ISR hoặc từ trong callback
+ */
+power_srv_status_t POWER_SRV_SetMode(power_srv_mode_t mode);
+
+/**
+ * @brief Get current run mode
+ * @return power_srv_mode_t
+ */
+power_srv_mode_t POWER_SRV_GetMode(void);
+
+#endif /* POWER_SRV_H */
@@ -0,0 +1,137 @@
+/**
+ * @file    prof_srv.h
+ * @brief   Profiling Service Layer - DWT Cycle Counter Probes
+ * @details
+ * Service layer đo cycle cost của hot path bằng DWT CYCCNT (Cortex-M4).
+ * Mỗi probe là một biến static có tên, PROF_BEGIN / PROF_END bao quanh code
+ * cần đo, kết quả (count / min / avg / max cycles) dump qua UART.
+ *
+ * @code
+ * PROF_SRV_DEFINE(p_can_send);
+ *
+ * PROF_SRV_Init();
+ * PROF_BEGIN(p_can_send);
+ * (void)CAN_Send(0U, 8U, &msg);
+ * PROF_END(p_can_send);
+ * ...
+ * PROF_SRV_Dump(LPUART1);
+ * @endcode
+ *
+ * Features:
+ * - Begin / end: một register read mỗi đầu, overhead đo lúc init và trừ ra
+ * - Probe tự đăng ký vào danh sách dump ở lần PROF_END đầu tiên
+ * - PROF_END gọi được từ ISR (update trong critical section ngắn)
+ * - Compile out toàn bộ với PROF_SRV_ENABLE = 0
+ *
+ * @note Cycles là core clock; kết quả phụ thuộc flash wait states và cache.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+#ifndef PROF_SRV_H
+#define PROF_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "uart.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Enable profiling (0 = PROF_BEGIN / PROF_END compile to nothing) */
+#ifndef PROF_SRV_ENABLE
+#define PROF_SRV_ENABLE             (1U)
+#endif
+
+/** @brief DWT cycle counter (ARMv7-M) */
+#define PROF_SRV_CYCCNT             (*(volatile uint32_t *)0xE0001004UL)
+
+/**
+ * @brief Profiling service status codes
+ */
+typedef enum {
+    PROF_SRV_SUCCESS = 0,
+    PROF_SRV_ERROR,
+    PROF_SRV_NOT_INITIALIZED
+} prof_srv_status_t;
+
+/**
+ * @brief Named probe point
+ */
+typedef struct prof_srv_probe {
+    const char *name;               /**< Tên in ra trong dump */
+    uint32_t start;                 /**< CYCCNT at PROF_BEGIN */
+    uint32_t count;                 /**< Số lần đo */
+    uint32_t min;                   /**< Min cycles */
+    uint32_t max;                   /**< Max cycles */
+    uint64_t total;                 /**< Tổng cycles (avg = total / count) */
+    struct prof_srv_probe *next;    /**< Dump list */
+    bool registered;                /**< Linked in dump list */
+} prof_srv_probe_t;
+
+/** @brief Static initializer */
+#define PROF_SRV_PROBE_INIT(label)  { (label), 0U, 0U, 0xFFFFFFFFUL, 0U, 0U, NULL, false }
+
+/** @brief Định nghĩa probe, tên = tên biến */
+#define PROF_SRV_DEFINE(var)        static prof_srv_probe_t var = PROF_SRV_PROBE_INIT(#var)
+
+/*******************************************************************************
+ * Probe Macros
+ ******************************************************************************/
+#if PROF_SRV_ENABLE
+#define PROF_BEGIN(probe)           ((probe).start = PROF_SRV_CYCCNT)
+#define PROF_END(probe)             PROF_SRV_Record(&(probe), PROF_SRV_CYCCNT - (probe).start)
+#else
+#define PROF_BEGIN(probe)           ((void)0)
+#define PROF_END(probe)             ((void)0)
+#endif
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Enable DWT cycle counter và đo overhead của PROF_BEGIN / PROF_END
+ * @return prof_srv_status_t PROF_SRV_ERROR khi core không có DWT cycle counter
+ */
+prof_srv_status_t PROF_SRV_Init(void);
+
+/**
+ * @brief Ghi một lần đo (dùng qua PROF_END)
+ * @param probe  Probe
+ * @param cycles Raw cycles giữa begin và end (overhead được trừ ở đây)
+ */
+void PROF_SRV_Record(prof_srv_probe_t *probe, uint32_t cycles);
+
+/**
+ * @brief Xóa kết quả một probe (vẫn giữ trong dump list)
+ * @param probe Probe
+ */
+void PROF_SRV_Reset(prof_srv_probe_t *probe);
+
+/**
+ * @brief Xóa kết quả tất cả probe đã đăng ký
+ */
+void PROF_SRV_ResetAll(void);
+
+/**
+ * @brief Overhead của một cặp begin / end (cycles)
+ * @return uint32_t Cycles trừ khỏi mỗi lần đo
+ */
+uint32_t PROF_SRV_GetOverhead(void);
+
+/**
+ * @brief In bảng kết quả qua UART (blocking)
+ * @details Mỗi dòng: "name count min avg max" (cycles). Không gọi từ ISR.
+ * @param base LPUART đã init
+ * @return prof_srv_status_t Status of operation
+ */
+prof_srv_status_t PROF_SRV_Dump(LPUART_RegType *base);
+
+#endif /* PROF_SRV_H */
@@ -0,0 +1,198 @@
+/**
+ * @file    rtt_srv.h
+ * @brief   RTT Service Layer - Debugger Memory Ring-buffer Channels
+ * @details
+ * Kênh log / telemetry qua RAM mà SWD probe đọc ở background (RTT: Real
+ * Time Transfer). Target chỉ copy vào ring và cập nhật write offset, probe
+ * đọc ring qua AHB-AP trong lúc core chạy: không dùng UART, không dùng pin,
+ * không chờ. Control block theo layout SEGGER RTT nên J-Link (RTT Viewer /
+ * telnet 19021), OpenOCD (rtt setup / rtt server) và pyOCD đều dùng được.
+ *
+ * Features:
+ * - Up channel (target → host) và down channel (host → target), số lượng
+ *   cấu hình compile-time
+ * - Mode theo channel: skip (bỏ cả message khi thiếu chỗ), trim (ghi phần
+ *   vừa), block (chờ host đọc, chỉ dùng khi có probe)
+ * - Ghi được từ ISR: mỗi Write là một critical section ngắn
+ * - TRACE_SRV_InitRtt(): binary trace logger ghi thẳng vào ring của một up
+ *   channel (zero-copy), tools/trace_decode.py --tcp đọc từ RTT server
+ *
+ * @code
+ * RTT_SRV_Init();
+ * RTT_SRV_WriteString(0U, "boot\n");                  // channel 0 "Terminal"
+ *
+ * char cmd[16];
+ * uint32_t n = RTT_SRV_Read(0U, cmd, sizeof(cmd));     // từ RTT Viewer
+ * @endcode
+ *
+ * @note Control block (_SEGGER_RTT) và buffers nằm ở SRAM_U (DMA_BUFFER_SRAM_U):
+ *       probe là một bus master như DMA. OpenOCD: "rtt setup <addr của
+ *       _SEGGER_RTT> 1024 \"SEGGER RTT\"". ID chỉ được ghi khi RTT_SRV_Init()
+ *       đã xong, probe không thấy control block dở dang.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+#ifndef RTT_SRV_H
+#define RTT_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Số up channel (target → host), channel 0 = terminal */
+#ifndef RTT_SRV_MAX_UP_BUFFERS
+#define RTT_SRV_MAX_UP_BUFFERS          (2U)
+#endif
+
+/** @brief Số down channel (host → target), channel 0 = terminal */
+#ifndef RTT_SRV_MAX_DOWN_BUFFERS
+#define RTT_SRV_MAX_DOWN_BUFFERS        (1U)
+#endif
+
+/** @brief Kích thước buffer up channel 0 (bytes) */
+#ifndef RTT_SRV_TERMINAL_UP_SIZE
+#define RTT_SRV_TERMINAL_UP_SIZE        (1024U)
+#endif
+
+/** @brief Kích thước buffer down channel 0 (bytes) */
+#ifndef RTT_SRV_TERMINAL_DOWN_SIZE
+#define RTT_SRV_TERMINAL_DOWN_SIZE      (16U)
+#endif
+
+/**
+ * @brief RTT service status codes
+ */
+typedef enum {
+    RTT_SRV_SUCCESS = 0,
+    RTT_SRV_ERROR,
+    RTT_SRV_NOT_INITIALIZED
+} rtt_srv_status_t;
+
+/**
+ * @brief Hành vi khi up buffer không đủ chỗ (giá trị Flags của SEGGER RTT)
+ */
+typedef enum {
+    RTT_SRV_MODE_NO_BLOCK_SKIP = 0U,    /**< Bỏ cả message */
+    RTT_SRV_MODE_NO_BLOCK_TRIM = 1U,    /**< Ghi phần vừa, bỏ phần còn lại */
+    RTT_SRV_MODE_BLOCK         = 2U     /**< Chờ host đọc (treo nếu không có probe) */
+} rtt_srv_mode_t;
+
+/**
+ * @brief Up / down buffer descriptor (layout SEGGER_RTT_BUFFER_UP / _DOWN)
+ */
+typedef struct {
+    const char *name;               /**< Tên channel hiển thị ở host */
+    char *buffer;                   /**< Ring storage */
+    uint32_t size;                  /**< Ring size (bytes), dùng size - 1 */
+    volatile uint32_t wr_off;       /**< Up: target ghi, down: host ghi */
+    volatile uint32_t rd_off;       /**< Up: host ghi, down: target ghi */
+    uint32_t flags;                 /**< rtt_srv_mode_t */
+} rtt_srv_buffer_t;
+
+/**
+ * @brief Control block (layout SEGGER_RTT_CB, probe tìm theo acID)
+ */
+typedef struct {
+    char id[16];                    /**< "SEGGER RTT", ghi cuối cùng */
+    int32_t max_up;                 /**< RTT_SRV_MAX_UP_BUFFERS */
+    int32_t max_down;               /**< RTT_SRV_MAX_DOWN_BUFFERS */
+    rtt_srv_buffer_t up[RTT_SRV_MAX_UP_BUFFERS];
+    rtt_srv_buffer_t down[RTT_SRV_MAX_DOWN_BUFFERS];
+} rtt_srv_cb_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Khởi tạo control block, cấu hình channel 0 (terminal) up / down
+ * @return rtt_srv_status_t Status of initialization
+ */
+rtt_srv_status_t RTT_SRV_Init(void);
+
+/**
+ * @brief Cấu hình một up channel
+ * @param channel Up channel (1 - RTT_SRV_MAX_UP_BUFFERS - 1, 0 để thay terminal)
+ * @param name    Tên channel (string tồn tại suốt chương trình)
+ * @param buffer  Ring storage (nên đặt DMA_BUFFER_SRAM_U)
+ * @param size    Ring size (bytes, >= 2)
+ * @param mode    Hành vi khi đầy
+ * @return rtt_srv_status_t Status of operation
+ */
+rtt_srv_status_t RTT_SRV_ConfigUpBuffer(uint8_t channel, const char *name, void *buffer,
+                                        uint32_t size, rtt_srv_mode_t mode);
+
+/**
+ * @brief Cấu hình một down channel
+ * @param channel Down channel
+ * @param name    Tên channel
+ * @param buffer  Ring storage
+ * @param size    Ring size (bytes, >= 2)
+ * @return rtt_srv_status_t Status of operation
+ */
+rtt_srv_status_t RTT_SRV_ConfigDownBuffer(uint8_t channel, const char *name, void *buffer,
+                                          uint32_t size);
+
+/**
+ * @brief Ghi vào up channel (mọi context, trừ RTT_SRV_MODE_BLOCK chỉ ở thread)
+ * @param channel Up channel
+ * @param data    Dữ liệu
+ * @param length  Số byte
+ * @return uint32_t Số byte đã ghi (skip: 0 hoặc length)
+ */
+uint32_t RTT_SRV_Write(uint8_t channel, const void *data, uint32_t length);
+
+/**
+ * @brief Ghi string (không kèm '\0') vào up channel
+ * @param channel Up channel
+ * @param str     NUL-terminated string
+ * @return uint32_t Số byte đã ghi
+ */
+uint32_t RTT_SRV_WriteString(uint8_t channel, const char *str);
+
+/**
+ * @brief Số byte còn trống của up channel
+ * @param channel Up channel
+ * @return uint32_t Free space (bytes), 0 nếu channel chưa cấu hình
+ */
+uint32_t RTT_SRV_GetFreeSpace(uint8_t channel);
+
+/**
+ * @brief Đọc dữ liệu host gửi qua down channel (non-blocking)
+ * @param channel Down channel
+ * @param buffer  Buffer đích
+ * @param size    Kích thước buffer
+ * @return uint32_t Số byte đã đọc
+ */
+uint32_t RTT_SRV_Read(uint8_t channel, void *buffer, uint32_t size);
+
+/**
+ * @brief Down channel có dữ liệu chưa đọc
+ * @param channel Down channel
+ */
+bool RTT_SRV_HasData(uint8_t channel);
+
+/**
+ * @brief Read offset host đã đọc tới (producer tự quản lý ring, vd. trace_srv)
+ * @param channel Up channel
+ * @return uint32_t RdOff
+ */
+uint32_t RTT_SRV_GetUpReadOffset(uint8_t channel);
+
+/**
+ * @brief Publish dữ liệu đã ghi trực tiếp vào ring tới offset (DMB trước khi ghi WrOff)
+ * @param channel Up channel
+ * @param offset  WrOff mới (< size)
+ */
+void RTT_SRV_SetUpWriteOffset(uint8_t channel, uint32_t offset);
+
+#endif /* RTT_SRV_H */
@@ -0,0 +1,166 @@
+/**
+ * @file    sched_srv.h
+ * @brief   Scheduler Service Layer - Run-to-Completion Event Executive
+ * @details
+ * Service layer thay superloop + blocking calls bằng executive cooperative:
+ * ISR / HAL callback chỉ post event, công việc thật chạy ở thread mode theo
+ * priority, mỗi handler chạy tới hết (run-to-completion, không cần stack riêng).
+ *
+ * Features:
+ * - SCHED_SRV_PRIORITIES event queues (0 = cao nhất), FIFO trong cùng priority
+ * - Work item static (handler + user_data + priority), post kèm một uint32_t param
+ * - Post ISR-safe, lock-free (MPSC queue, không mask interrupt), không cấp phát động
+ * - Sau mỗi handler dispatcher chọn lại queue cao nhất: work latency-sensitive
+ *   vượt lên background work ở ranh giới handler
+ * - Không còn event: CPU ngủ WFI (hoặc idle hook, vd. TIMER_SRV_Idle) với
+ *   interrupt masked nên không mất wake-up
+ * - Adapter cho lpit_callback_t / dma_callback_t / can_callback_t
+ *
+ * @code
+ * static void OnCanRx(uint32_t param, void *user_data);
+ * static sched_srv_work_t s_can_rx_work = SCHED_SRV_WORK_INIT(OnCanRx, NULL, 0U);
+ *
+ * SCHED_SRV_Init();
+ * CAN_InstallRxCallback(0U, 16U, SCHED_SRV_CanCallback, &s_can_rx_work);
+ * SCHED_SRV_Run();    // không return
+ *
+ * static void OnCanRx(uint32_t param, void *user_data)
+ * {
+ *     uint8_t mb = SCHED_SRV_CAN_MB(param);
+ *     ...
+ * }
+ * @endcode
+ *
+ * @note Handler không được block; việc dài nên tách thành nhiều event.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+#ifndef SCHED_SRV_H
+#define SCHED_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Số priority levels (tối đa 32) */
+#ifndef SCHED_SRV_PRIORITIES
+#define SCHED_SRV_PRIORITIES        (4U)
+#endif
+
+/** @brief Số event mỗi queue (lũy thừa của 2) */
+#ifndef SCHED_SRV_QUEUE_SIZE
+#define SCHED_SRV_QUEUE_SIZE        (16U)
+#endif
+
+/** @brief Param của SCHED_SRV_CanCallback: (instance << 8) | mbIndex */
+#define SCHED_SRV_CAN_INSTANCE(param)   ((uint8_t)((param) >> 8U))
+#define SCHED_SRV_CAN_MB(param)         ((uint8_t)((param) & 0xFFU))
+
+/**
+ * @brief Scheduler service status codes
+ */
+typedef enum {
+    SCHED_SRV_SUCCESS = 0,
+    SCHED_SRV_ERROR,
+    SCHED_SRV_NOT_INITIALIZED,
+    SCHED_SRV_QUEUE_FULL
+} sched_srv_status_t;
+
+/**
+ * @brief Event handler (thread mode)
+ * @param param     Giá trị truyền khi post
+ * @param user_data User data của work item
+ */
+typedef void (*sched_srv_handler_t)(uint32_t param, void *user_data);
+
+/**
+ * @brief Work item: handler + priority, post nhiều lần được
+ */
+typedef struct {
+    sched_srv_handler_t handler;    /**< Handler chạy trong SCHED_SRV_Run */
+    void *user_data;                /**< User data truyền cho handler */
+    uint8_t priority;               /**< Queue (0 = cao nhất) */
+} sched_srv_work_t;
+
+/** @brief Static initializer */
+#define SCHED_SRV_WORK_INIT(h, user, prio)  { (h), (user), (uint8_t)(prio) }
+
+/**
+ * @brief Idle hook, gọi với interrupt masked khi mọi queue rỗng
+ * @details Mặc định NVIC_WaitForInterrupt(); hook phải ngủ tới interrupt kế
+ *          tiếp và return (vd. gọi TIMER_SRV_Idle(true)).
+ */
+typedef void (*sched_srv_idle_hook_t)(void);
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Khởi tạo scheduler (xóa mọi queue)
+ * @return sched_srv_status_t Status of operation
+ */
+sched_srv_status_t SCHED_SRV_Init(void);
+
+/**
+ * @brief Post một event (ISR-safe)
+ * @param work  Work item
+ * @param param Giá trị truyền cho handler
+ * @return sched_srv_status_t SCHED_SRV_QUEUE_FULL khi queue của priority đầy
+ */
+sched_srv_status_t SCHED_SRV_Post(const sched_srv_work_t *work, uint32_t param);
+
+/**
+ * @brief Dispatch một event của queue cao nhất đang có event
+ * @return bool true nếu đã chạy một handler
+ * @note Dùng khi tích hợp vào superloop có sẵn thay cho SCHED_SRV_Run()
+ */
+bool SCHED_SRV_RunOnce(void);
+
+/**
+ * @brief Vòng lặp executive: dispatch event, ngủ khi không còn event
+ * @note Không return
+ */
+void SCHED_SRV_Run(void);
+
+/**
+ * @brief Thay WFI mặc định khi idle
+ * @param hook Idle hook (NULL = WFI)
+ */
+void SCHED_SRV_SetIdleHook(sched_srv_idle_hook_t hook);
+
+/**
+ * @brief Số event bị bỏ vì queue đầy từ lúc init
+ * @param priority Priority level
+ * @return uint32_t Overflow count (0 với priority không hợp lệ)
+ */
+uint32_t SCHED_SRV_GetOverflowCount(uint8_t priority);
+
+/**
+ * @brief LPIT callback adapter: LPIT_InstallCallback(ch, SCHED_SRV_LpitCallback, &work)
+ * @details Post work với param = channel
+ */
+void SCHED_SRV_LpitCallback(uint8_t channel, void *userData);
+
+/**
+ * @brief DMA callback adapter: DMA_InstallCallback(ch, SCHED_SRV_DmaCallback, &work)
+ * @details Post work với param = channel
+ */
+void SCHED_SRV_DmaCallback(uint8_t channel, void *userData);
+
+/**
+ * @brief CAN callback adapter: CAN_InstallRxCallback(inst, mb, SCHED_SRV_CanCallback, &work)
+ * @details Post work với param = (instance << 8) | mbIndex
+ */
+void SCHED_SRV_CanCallback(uint8_t instance, uint8_t mbIndex, void *userData);
+
+#endif /* SCHED_SRV_H */
@@ -0,0 +1,159 @@
+/**
+ * @file    secoc_srv.h
+ * @brief   SecOC Service Layer - CMAC-Authenticated CAN Frames (CSEc)
+ * @details
+ * Secure onboard communication kiểu AUTOSAR SecOC cho classic CAN: mỗi PDU
+ * được cấu hình một key CSEc, payload được gửi kèm freshness value rút gọn
+ * và AES-CMAC rút gọn trong cùng frame 8 bytes.
+ *
+ * Secured frame: payload | freshness (LSB, big-endian) | MAC (MSB của CMAC)
+ *
+ * MAC input: Data ID (16-bit) | payload | freshness đầy đủ (32-bit), big-endian.
+ * Tối đa 14 bytes: một CMAC block, CSEc xử lý trong một command.
+ *
+ * Features:
+ * - TX / RX hook cho can_srv (CAN_SRV_RegisterHooks): application vẫn gọi
+ *   CAN_SRV_Send / CAN_SRV_Receive với payload thuần
+ * - CMAC generate / verify bằng CSEc (truncated MAC được engine so sánh),
+ *   CPU không chạy AES
+ * - Freshness counter 32-bit mỗi PDU, receiver dựng lại giá trị đầy đủ từ
+ *   phần rút gọn; frame có freshness cũ (replay) bị MAC verify loại
+ * - PDU không có trong bảng đi qua không đổi
+ *
+ * @code
+ * static const secoc_srv_pdu_config_t s_pdus[] = {
+ *     { .id = 0x120U, .is_extended = false, .data_id = 0x0120U, .key_id = CSEC_KEY_1,
+ *       .data_length = 4U, .freshness_length = 1U, .mac_length = 3U }
+ * };
+ *
+ * CSEC_Init();
+ * CAN_SRV_Init(CAN_SRV_CAN0, &can_cfg);
+ * SECOC_SRV_Init(s_pdus, 1U);
+ * SECOC_SRV_SetFreshness(0x120U, false, saved_tx, saved_rx);
+ * CAN_SRV_RegisterHooks(CAN_SRV_CAN0, SECOC_SRV_TxHook, SECOC_SRV_RxHook);
+ *
+ * msg.id = 0x120U; msg.length = 4U;               // payload thuần
+ * CAN_SRV_Send(CAN_SRV_CAN0, &msg);               // bus: 4 data + 1 FV + 3 MAC
+ * @endcode
+ *
+ * @note Hook chạy trong main loop context, CMAC blocking (vài µs mỗi frame).
+ *       CSEc bận (flash / EEE write đang chạy): TX trả lỗi để application gửi
+ *       lại, RX frame bị drop và đếm trong crypto_errors.
+ * @note Freshness counter chỉ nằm trong RAM: application lưu / khôi phục qua
+ *       SECOC_SRV_GetFreshness / SECOC_SRV_SetFreshness (vd. nvm_srv).
+ * @note can_sched_srv và CAN_SRV_PeekRx không đi qua hook của can_srv.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+#ifndef SECOC_SRV_H
+#define SECOC_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "can_srv.h"
+#include "csec.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Số PDU secured tối đa */
+#ifndef SECOC_SRV_MAX_PDUS
+#define SECOC_SRV_MAX_PDUS          (16U)
+#endif
+
+/**
+ * @brief SecOC service status codes
+ */
+typedef enum {
+    SECOC_SRV_SUCCESS = 0,
+    SECOC_SRV_ERROR,
+    SECOC_SRV_NOT_INITIALIZED,
+    SECOC_SRV_INVALID_ID            /**< Id không có trong bảng PDU */
+} secoc_srv_status_t;
+
+/**
+ * @brief Secured PDU configuration
+ */
+typedef struct {
+    uint32_t id;                    /**< CAN id */
+    bool is_extended;               /**< true = 29-bit id */
+    uint16_t data_id;               /**< SecOC Data ID, đưa vào MAC input */
+    csec_key_id_t key_id;           /**< CSEc key slot */
+    uint8_t data_length;            /**< Payload bytes */
+    uint8_t freshness_length;       /**< Freshness bytes trên bus (0-4) */
+    uint8_t mac_length;             /**< MAC bytes trên bus (>= 1), data + freshness + MAC <= 8 */
+} secoc_srv_pdu_config_t;
+
+/**
+ * @brief SecOC statistics
+ */
+typedef struct {
+    uint32_t tx_authenticated;      /**< Frame đã gắn MAC */
+    uint32_t rx_authenticated;      /**< Frame verify đúng */
+    uint32_t rx_mac_failed;         /**< MAC sai (giả mạo, replay, key sai) */
+    uint32_t rx_length_errors;      /**< DLC khác data + freshness + MAC */
+    uint32_t crypto_errors;         /**< CSEc bận hoặc lỗi command */
+} secoc_srv_stats_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Khởi tạo SecOC service, reset freshness counter và statistics
+ * @details CSEC_Init() phải được gọi trước, key của các PDU đã được load.
+ * @param pdus  Bảng PDU (phải tồn tại suốt runtime)
+ * @param count Số PDU (<= SECOC_SRV_MAX_PDUS)
+ * @return secoc_srv_status_t Status of operation
+ */
+secoc_srv_status_t SECOC_SRV_Init(const secoc_srv_pdu_config_t *pdus, uint8_t count);
+
+/**
+ * @brief Khôi phục freshness counter của một PDU (sau reset)
+ * @param id          CAN id
+ * @param is_extended true = 29-bit id
+ * @param tx          Freshness đã gửi gần nhất
+ * @param rx          Freshness đã chấp nhận gần nhất
+ * @return secoc_srv_status_t Status of operation
+ */
+secoc_srv_status_t SECOC_SRV_SetFreshness(uint32_t id, bool is_extended, uint32_t tx, uint32_t rx);
+
+/**
+ * @brief Đọc freshness counter của một PDU (để lưu NVM)
+ * @param id          CAN id
+ * @param is_extended true = 29-bit id
+ * @param tx          Pointer nhận freshness TX
+ * @param rx          Pointer nhận freshness RX
+ * @return secoc_srv_status_t Status of operation
+ */
+secoc_srv_status_t SECOC_SRV_GetFreshness(uint32_t id, bool is_extended, uint32_t *tx, uint32_t *rx);
+
+/**
+ * @brief can_srv TX hook: append freshness + MAC
+ * @param msg Message (payload data_length bytes)
+ * @return false nếu không gắn được MAC (length sai, CSEc bận / lỗi, counter hết)
+ */
+bool SECOC_SRV_TxHook(can_srv_message_t *msg);
+
+/**
+ * @brief can_srv RX hook: verify MAC, bỏ freshness + MAC khỏi message
+ * @param msg Message nhận được
+ * @return false nếu frame không xác thực được
+ */
+bool SECOC_SRV_RxHook(can_srv_message_t *msg);
+
+/**
+ * @brief Đọc statistics
+ * @param stats Pointer nhận statistics
+ * @return secoc_srv_status_t Status of operation
+ */
+secoc_srv_status_t SECOC_SRV_GetStats(secoc_srv_stats_t *stats);
+
+#endif /* SECOC_SRV_H */
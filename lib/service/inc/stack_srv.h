@@ -0,0 +1,151 @@
+/**
+ * @file    stack_srv.h
+ * @brief   Stack Service Layer - Stack / Heap High-Water Mark and Overflow Guard
+ * @details
+ * Service layer đo mức dùng main stack và heap để giảm RAM reservation
+ * (STACK_SIZE / HEAP_SIZE trong linker script) có căn cứ.
+ *
+ * Nguyên lý:
+ * - init_data_bss() build với STARTUP_STACK_PAINT = 1 tô phần stack chưa
+ *   dùng và toàn bộ heap bằng pattern ngay sau reset
+ * - High-water mark = word thấp nhất (stack) / cao nhất (heap) không còn
+ *   pattern; toàn bộ ISR chạy trên MSP nên con số đã bao gồm nesting
+ * - Overflow guard: Cortex-M4 không có stack limit register và SYSMPU của
+ *   S32K144 chỉ cấp quyền (không chặn được một vùng SRAM), nên guard dùng
+ *   một DWT watchpoint (write) trên cửa sổ STACK_SRV_GUARD_SIZE bytes gần
+ *   đáy stack, báo bằng DebugMonitor exception
+ *
+ * Layout (địa chỉ tăng lên trên):
+ *
+ *   __StackTop   ------------------
+ *                 stack dùng bình thường
+ *   guard        ------------------  <- write vào đây = overflow
+ *                 STACK_SRV_GUARD_RESERVE (exception frame + handler)
+ *   __StackLimit ------------------
+ *
+ * @code
+ * // Build flags: -DSTARTUP_STACK_PAINT=1
+ * static void on_overflow(uint32_t pc)
+ * {
+ *     log_fatal(pc);                  // chạy trên phần reserve, giữ ngắn
+ *     NVIC_SystemReset();
+ * }
+ *
+ * STACK_SRV_Init(on_overflow);
+ * ...
+ * stack_srv_usage_t usage;
+ * STACK_SRV_GetStackUsage(&usage);    // usage.used: peak bytes từ reset
+ * @endcode
+ *
+ * @note Linker script GCC phải định nghĩa __StackTop, __StackLimit,
+ *       __HeapBase, __HeapLimit (linker script S32K144 của S32 SDK).
+ * @note Khi debugger bật halting debug (C_DEBUGEN), watchpoint halt core
+ *       thay vì vào DebugMonitor exception.
+ * @note Heap high-water mark là ước lượng: block đã malloc mà chưa ghi
+ *       ở cuối heap vẫn mang pattern.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+#ifndef STACK_SRV_H
+#define STACK_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Paint pattern, phải trùng STARTUP_STACK_PAINT_PATTERN */
+#ifndef STACK_SRV_PATTERN
+#define STACK_SRV_PATTERN           (0xDEADBEEFUL)
+#endif
+
+/** @brief Kích thước cửa sổ watchpoint (bytes, lũy thừa của 2, >= 4) */
+#ifndef STACK_SRV_GUARD_SIZE
+#define STACK_SRV_GUARD_SIZE        (32U)
+#endif
+
+/** @brief Bytes dưới guard dành cho exception frame (FPU: 104) và handler */
+#ifndef STACK_SRV_GUARD_RESERVE
+#define STACK_SRV_GUARD_RESERVE     (256U)
+#endif
+
+/** @brief DWT comparator dùng cho guard (Cortex-M4 có 4 comparator) */
+#ifndef STACK_SRV_DWT_COMPARATOR
+#define STACK_SRV_DWT_COMPARATOR    (3U)
+#endif
+
+/**
+ * @brief Stack service status codes
+ */
+typedef enum {
+    STACK_SRV_SUCCESS = 0,
+    STACK_SRV_ERROR,
+    STACK_SRV_NOT_INITIALIZED,
+    STACK_SRV_NOT_PAINTED           /**< Startup không tô pattern (STARTUP_STACK_PAINT = 0) */
+} stack_srv_status_t;
+
+/**
+ * @brief Mức dùng một vùng RAM
+ */
+typedef struct {
+    uint32_t size;                  /**< Kích thước vùng (bytes) */
+    uint32_t used;                  /**< High-water mark (bytes) */
+    uint32_t free;                  /**< size - used */
+} stack_srv_usage_t;
+
+/**
+ * @brief Overflow callback (DebugMonitor exception context, trên phần reserve)
+ * @param pc Stacked PC: lệnh ngay sau lệnh đã ghi vào guard
+ */
+typedef void (*stack_srv_overflow_cb_t)(uint32_t pc);
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Khởi tạo service và bật overflow guard trên main stack
+ * @details Install handler DebugMonitor (RAM vector table), priority 0,
+ *          DEMCR.MON_EN và DWT comparator STACK_SRV_DWT_COMPARATOR.
+ * @param callback Gọi khi overflow, NULL = NVIC_SystemReset()
+ * @return stack_srv_status_t STACK_SRV_ERROR nếu core không đủ DWT comparator
+ *         hoặc stack nhỏ hơn reserve + guard
+ */
+stack_srv_status_t STACK_SRV_Init(stack_srv_overflow_cb_t callback);
+
+/**
+ * @brief High-water mark của main stack từ reset
+ * @param usage Pointer nhận kết quả
+ * @return stack_srv_status_t Status of operation
+ */
+stack_srv_status_t STACK_SRV_GetStackUsage(stack_srv_usage_t *usage);
+
+/**
+ * @brief High-water mark của heap (_sbrk) từ reset
+ * @param usage Pointer nhận kết quả
+ * @return stack_srv_status_t Status of operation
+ */
+stack_srv_status_t STACK_SRV_GetHeapUsage(stack_srv_usage_t *usage);
+
+/**
+ * @brief Số lần guard bị chạm từ reset
+ * @details Guard tắt sau mỗi lần chạm (callback return được mà không
+ *          trigger lại), STACK_SRV_Init bật lại.
+ * @return uint32_t Overflow count
+ */
+uint32_t STACK_SRV_GetOverflowCount(void);
+
+/**
+ * @brief DebugMonitor handler (được STACK_SRV_Init install)
+ */
+void STACK_SRV_DebugMonHandler(void);
+
+#endif /* STACK_SRV_H */
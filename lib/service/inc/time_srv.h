@@ -0,0 +1,79 @@
+/**
+ * @file    time_srv.h
+ * @brief   Time Service Layer - 64-bit Monotonic Microsecond Clock
+ * @details
+ * Time base chung cho mọi subsystem (CAN timestamp, ADC, trace) trên hai LPIT
+ * channels chained:
+ * - Channel (n - 1): prescaler, reload mỗi 1 us
+ * - Channel n (chained): đếm us trên 32 bit, interrupt khi wrap (~71 phút)
+ *   tăng 32 bit cao trong RAM
+ *
+ * Đọc không cần critical section: double read epoch + pending wrap flag,
+ * gọi được từ ISR bất kỳ priority nào.
+ *
+ * @code
+ * LPIT_Init(LPIT_CLK_SRC_SIRC);
+ * TIME_SRV_Init(3U);                  // channels 2 (prescaler) + 3
+ * NVIC_EnableIRQ(LPIT0_Ch3_IRQn);     // LPIT_IRQHandler(3) tăng epoch
+ * TRACE_SRV_InstallTimeSource(TIME_SRV_GetMicros32);
+ *
+ * uint64_t t0 = TIME_SRV_GetMicros64();
+ * @endcode
+ *
+ * @note LPIT clock phải là bội số của 1 MHz (SIRC / SOSC 8 MHz, FIRC 48 MHz).
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+#ifndef TIME_SRV_H
+#define TIME_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @brief Time service status codes
+ */
+typedef enum {
+    TIME_SRV_SUCCESS = 0,
+    TIME_SRV_ERROR,
+    TIME_SRV_NOT_INITIALIZED
+} time_srv_status_t;
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Khởi tạo và start time base
+ * @details LPIT_Init() phải được gọi trước. Dùng channel - 1 làm prescaler,
+ *          application enable NVIC IRQ của channel.
+ * @param channel LPIT channel đếm us (1-3)
+ * @return time_srv_status_t Status of operation
+ */
+time_srv_status_t TIME_SRV_Init(uint8_t channel);
+
+/**
+ * @brief Microseconds since TIME_SRV_Init(), 64 bit (không wrap)
+ * @return uint64_t Monotonic timestamp (us), 0 khi chưa init
+ */
+uint64_t TIME_SRV_GetMicros64(void);
+
+/**
+ * @brief Microseconds since TIME_SRV_Init(), 32 bit thấp (wrap ~71 phút)
+ * @details Một register read, dùng cho timestamp / khoảng thời gian ngắn
+ *          (vd. trace_srv_time_source_t).
+ * @return uint32_t Timestamp (us)
+ */
+uint32_t TIME_SRV_GetMicros32(void);
+
+#endif /* TIME_SRV_H */
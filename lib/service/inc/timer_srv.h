@@ -0,0 +1,215 @@
+/**
+ * @file    timer_srv.h
+ * @brief   Soft Timer Service Layer - Hierarchical Timing Wheel API
+ * @details
+ * Service layer cho số lượng lớn software timers (one-shot / periodic) dùng
+ * chung MỘT LPIT channel, thay cho lpit_srv (một callback mỗi hardware channel,
+ * tối đa 4 timers).
+ *
+ * Features:
+ * - Hierarchical timing wheel: TIMER_SRV_LEVELS levels x 32 slots,
+ *   start / stop O(1) (intrusive doubly-linked list, bitmap mỗi level)
+ * - Tickless: LPIT chạy one-shot tới deadline kế tiếp, không có tick interrupt
+ *   định kỳ khi không có timer hết hạn
+ * - Timer object do application cấp phát, không giới hạn số lượng
+ * - Tickless idle: TIMER_SRV_Idle() ngủ (WFI hoặc VLPS) tới deadline kế tiếp,
+ *   SysTick 1 ms được tạm dừng và bù lại từ LPIT khi wake-up
+ * - Long sleep: với TIMER_SRV_EnableLptmrSleep(), idle VLPS dài dùng LPTMR0
+ *   (LPO 1 kHz, luôn chạy) thay cho LPIT, SIRC có thể tắt trong VLPS
+ *
+ * @note Callbacks chạy trong LPIT interrupt context (LPIT_IRQHandler(channel)).
+ *       Gọi TIMER_SRV_Start() / TIMER_SRV_Stop() từ callback là hợp lệ.
+ *
+ * @code
+ * static timer_srv_timer_t s_blink;
+ *
+ * LPIT_Init(LPIT_CLK_SRC_SIRC);
+ * TIMER_SRV_Init(0U);
+ * NVIC_EnableIRQ(LPIT0_Ch0_IRQn);
+ * TIMER_SRV_Start(&s_blink, TIMER_SRV_MS_TO_TICKS(500U), TIMER_SRV_MS_TO_TICKS(500U),
+ *                 Blink_Callback, NULL);
+ * @endcode
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+#ifndef TIMER_SRV_H
+#define TIMER_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Tick resolution (us) */
+#ifndef TIMER_SRV_TICK_US
+#define TIMER_SRV_TICK_US           (1000U)
+#endif
+
+/** @brief Số level của wheel, mỗi level 32 slots (5 levels → 2^25 ticks) */
+#ifndef TIMER_SRV_LEVELS
+#define TIMER_SRV_LEVELS            (5U)
+#endif
+
+/** @brief Idle ngắn hơn giá trị này chỉ dùng WFI (VLPS entry/exit không đáng) */
+#ifndef TIMER_SRV_VLPS_MIN_TICKS
+#define TIMER_SRV_VLPS_MIN_TICKS    (2U)
+#endif
+
+/** @brief Idle tối thiểu (ticks) để ngủ VLPS bằng LPTMR thay cho LPIT */
+#ifndef TIMER_SRV_LPTMR_MIN_TICKS
+#define TIMER_SRV_LPTMR_MIN_TICKS   (20U)
+#endif
+
+/** @brief Timeout / period tối đa (ticks) */
+#define TIMER_SRV_MAX_TICKS         ((1UL << (5U * TIMER_SRV_LEVELS)) - 1U)
+
+/** @brief Convert milliseconds to ticks (round up) */
+#define TIMER_SRV_MS_TO_TICKS(ms)   ((uint32_t)((((uint64_t)(ms) * 1000U) + TIMER_SRV_TICK_US - 1U) / TIMER_SRV_TICK_US))
+
+/**
+ * @brief Timer service status codes
+ */
+typedef enum {
+    TIMER_SRV_SUCCESS = 0,
+    TIMER_SRV_ERROR,
+    TIMER_SRV_NOT_INITIALIZED
+} timer_srv_status_t;
+
+typedef struct timer_srv_timer timer_srv_timer_t;
+
+/**
+ * @brief Timer callback (LPIT interrupt context)
+ */
+typedef void (*timer_srv_callback_t)(timer_srv_timer_t *timer, void *user_data);
+
+/**
+ * @brief Soft timer object
+ * @details Do application cấp phát; các field là private của service.
+ */
+struct timer_srv_timer {
+    timer_srv_timer_t *next;        /**< Slot list */
+    timer_srv_timer_t *prev;        /**< Slot list */
+    uint32_t expires;               /**< Absolute expiry tick */
+    uint32_t period;                /**< Reload ticks, 0 = one-shot */
+    timer_srv_callback_t callback;  /**< Expiry callback */
+    void *user_data;                /**< Callback argument */
+    uint8_t level;                  /**< Wheel level of the slot */
+    uint8_t slot;                   /**< Slot index in level */
+    volatile bool active;           /**< Linked in the wheel */
+};
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Khởi tạo timer service trên một LPIT channel
+ * @details LPIT_Init() phải được gọi trước. Channel được cấu hình one-shot
+ *          (stopOnInterrupt); application enable NVIC IRQ của channel này.
+ * @param lpit_channel LPIT channel (0-3)
+ * @return timer_srv_status_t Status of operation
+ */
+timer_srv_status_t TIMER_SRV_Init(uint8_t lpit_channel);
+
+/**
+ * @brief Start (hoặc restart) một timer
+ * @param timer      Timer object
+ * @param timeout    Ticks tới lần expire đầu tiên (1 - TIMER_SRV_MAX_TICKS, 0 → 1)
+ * @param period     Reload ticks sau mỗi lần expire, 0 = one-shot
+ * @param callback   Expiry callback
+ * @param user_data  Callback argument
+ * @return timer_srv_status_t Status of operation
+ */
+timer_srv_status_t TIMER_SRV_Start(timer_srv_timer_t *timer, uint32_t timeout, uint32_t period,
+                                   timer_srv_callback_t callback, void *user_data);
+
+/**
+ * @brief Stop một timer (không làm gì nếu timer không chạy)
+ * @param timer Timer object
+ */
+void TIMER_SRV_Stop(timer_srv_timer_t *timer);
+
+/**
+ * @brief Kiểm tra timer đang chạy
+ * @param timer Timer object
+ * @return true nếu timer đang chờ expire
+ */
+bool TIMER_SRV_IsActive(const timer_srv_timer_t *timer);
+
+/**
+ * @brief Thời gian hiện tại của service (ticks, wrap 32 bit)
+ * @return uint32_t Ticks since TIMER_SRV_Init()
+ */
+uint32_t TIMER_SRV_GetTicks(void);
+
+/**
+ * @brief Ticks tới deadline kế tiếp (timer expire sớm nhất hoặc wake-up giữ time base)
+ * @return uint32_t 0 khi deadline đã tới
+ */
+uint32_t TIMER_SRV_GetIdleTicks(void);
+
+/**
+ * @brief Tickless idle: ngủ tới interrupt kế tiếp
+ * @details Dừng SysTick (nếu đang chạy với interrupt), vào WFI hoặc VLPS với
+ *          interrupt masked, rồi cộng thời gian đã ngủ (đo bằng LPIT) vào
+ *          SYSTICK_GetTicks(). Wake-up bởi deadline của service hoặc bất kỳ
+ *          interrupt nào khác; gọi trong main loop khi không còn việc.
+ *
+ *          VLPS chỉ được dùng khi allow_vlps, idle >= TIMER_SRV_VLPS_MIN_TICKS
+ *          và application đã chuẩn bị: SMC_SetProtection(true, ...), LPIT clock
+ *          từ SIRC với SCG_SetSircLowPowerEnable(true, true), LPIT_SetDozeEnable(true).
+ *
+ *          Khi LPTMR sleep enabled và idle >= TIMER_SRV_LPTMR_MIN_TICKS: LPIT
+ *          dừng, LPTMR0 đếm (ms) tới 1 tick trước deadline, wheel time được
+ *          cập nhật từ LPTMR khi wake-up, rồi LPIT chạy nốt tới deadline.
+ *          Idle ngắn hơn chỉ dùng WFI (LPIT có thể không có clock trong VLPS).
+ *
+ * @param allow_vlps Cho phép VLPS thay vì WFI (sleep)
+ *
+ * @note SysTick phải được cấu hình bằng SYSTICK_ConfigMillisecond().
+ */
+void TIMER_SRV_Idle(bool allow_vlps);
+
+/**
+ * @brief Dùng LPTMR0 cho các idle VLPS dài
+ * @details Cấu hình LPTMR0 (time counter, LPO 1 kHz, interrupt on compare);
+ *          LPTMR0 thuộc về service. Application cài LPTMR_IRQHandler()
+ *          (LPTMR_InstallIrqHandler()) và NVIC_EnableIRQ(LPTMR0_IRQn).
+ *          Mỗi lần ngủ tối đa 65.5 s; idle dài hơn wake-up rồi ngủ tiếp.
+ *
+ *          Trong idle LPTMR, LPIT không cần clock: SCG_SetSircLowPowerEnable()
+ *          có thể để false để giảm dòng VLPS.
+ *
+ * @param enable true = dùng LPTMR khi idle >= TIMER_SRV_LPTMR_MIN_TICKS
+ * @return timer_srv_status_t Status of operation
+ *
+ * @code
+ * TIMER_SRV_Init(0U);
+ * LPTMR_InstallIrqHandler();
+ * TIMER_SRV_EnableLptmrSleep(true);
+ * NVIC_EnableIRQ(LPTMR0_IRQn);
+ * for (;;) {
+ *     TIMER_SRV_Idle(true);
+ * }
+ * @endcode
+ */
+timer_srv_status_t TIMER_SRV_EnableLptmrSleep(bool enable);
+
+/**
+ * @brief Blocking delay, core ngủ (WFI) trong lúc chờ
+ * @details Thay cho SYSTICK_DelayMs() busy-wait. Không gọi từ interrupt
+ *          hoặc timer callback.
+ * @param ticks Delay (ticks), vd. TIMER_SRV_MS_TO_TICKS(10U)
+ * @return timer_srv_status_t Status of operation
+ */
+timer_srv_status_t TIMER_SRV_Delay(uint32_t ticks);
+
+#endif /* TIMER_SRV_H */
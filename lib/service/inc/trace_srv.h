@@ -0,0 +1,203 @@
+/**
+ * @file    trace_srv.h
+ * @brief   Trace Service Layer - Deferred Binary Logger API
+ * @details
+ * Service layer thay thế printf qua UART bằng binary trace record.
+ * Hot path chỉ ghi vài word vào RAM ring (không format, không chờ UART),
+ * TRACE_SRV_Process() drain ring qua UART DMA ở background.
+ *
+ * Record format (little-endian 32-bit words):
+ * - Word 0: [31:28] = 0xA (sync), [27:24] = số args (0-4),
+ *           [23:16] = sequence (phát hiện mất record), [15:0] = trace ID
+ * - Word 1: timestamp (mặc định DWT CYCCNT)
+ * - Word 2..: args (raw uint32_t)
+ *
+ * Trace ID map tới format string ở host: khai báo ID trong một header của
+ * application với comment chứa format, vd:
+ * @code
+ * #define TRC_CAN_TX   (0x0101U)   // TRACE: "CAN tx id=0x%x dlc=%u"
+ * @endcode
+ * và decode bằng tools/trace_decode.py.
+ *
+ * Features:
+ * - TRACE_LOG0..TRACE_LOG4: vài chục cycle, gọi được từ ISR
+ * - Ring full → record bị drop và đếm, không block
+ * - Compile out toàn bộ với TRACE_SRV_ENABLE = 0
+ * - TRACE_SRV_InitRtt(): ring là một RTT up channel (rtt_srv), debug probe
+ *   đọc ở background, không UART và không cần TRACE_SRV_Process()
+ *
+ * @code
+ * RTT_SRV_Init();
+ * TRACE_SRV_InitRtt(1U);
+ * // host: JLinkGDBServer / OpenOCD "rtt server start 9091 1"
+ * // python3 tools/trace_decode.py -m app/trace_ids.h --tcp localhost:9091
+ * @endcode
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.1
+ */
+
+#ifndef TRACE_SRV_H
+#define TRACE_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "uart.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Enable trace logging (0 = TRACE_LOGx compile to nothing) */
+#ifndef TRACE_SRV_ENABLE
+#define TRACE_SRV_ENABLE            (1U)
+#endif
+
+/** @brief Trace ring size in 32-bit words (power of 2) */
+#ifndef TRACE_SRV_BUFFER_WORDS
+#define TRACE_SRV_BUFFER_WORDS      (1024U)
+#endif
+
+/** @brief Cho phép dùng RTT up channel làm drain (TRACE_SRV_InitRtt) */
+#ifndef TRACE_SRV_RTT_ENABLE
+#define TRACE_SRV_RTT_ENABLE        (1U)
+#endif
+
+/** @brief Record sync nibble in word 0 */
+#define TRACE_SRV_SYNC              (0xAU)
+
+/** @brief Maximum args per record */
+#define TRACE_SRV_MAX_ARGS          (4U)
+
+/**
+ * @brief Trace service status codes
+ */
+typedef enum {
+    TRACE_SRV_SUCCESS = 0,
+    TRACE_SRV_ERROR,
+    TRACE_SRV_NOT_INITIALIZED
+} trace_srv_status_t;
+
+/**
+ * @brief Timestamp source (free-running counter)
+ */
+typedef uint32_t (*trace_srv_time_source_t)(void);
+
+/*******************************************************************************
+ * Logging Macros
+ ******************************************************************************/
+#if TRACE_SRV_ENABLE
+#define TRACE_LOG0(id)                  TRACE_SRV_Log0((uint16_t)(id))
+#define TRACE_LOG1(id, a)               TRACE_SRV_Log1((uint16_t)(id), (uint32_t)(a))
+#define TRACE_LOG2(id, a, b)            TRACE_SRV_Log2((uint16_t)(id), (uint32_t)(a), (uint32_t)(b))
+#define TRACE_LOG3(id, a, b, c)         TRACE_SRV_Log3((uint16_t)(id), (uint32_t)(a), (uint32_t)(b), (uint32_t)(c))
+#define TRACE_LOG4(id, a, b, c, d)      TRACE_SRV_Log4((uint16_t)(id), (uint32_t)(a), (uint32_t)(b), (uint32_t)(c), (uint32_t)(d))
+#else
+#define TRACE_LOG0(id)                  ((void)0)
+#define TRACE_LOG1(id, a)               ((void)0)
+#define TRACE_LOG2(id, a, b)            ((void)0)
+#define TRACE_LOG3(id, a, b, c)         ((void)0)
+#define TRACE_LOG4(id, a, b, c, d)      ((void)0)
+#endif
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Initialize trace service
+ * @details Enable DWT cycle counter (timestamp mặc định). UART phải được
+ *          init trước (UART_Init), nên dùng baud cao (>= 1 Mbps).
+ * @param base        UART instance dùng để drain
+ * @param dma_channel DMA channel cho TX (bỏ qua khi UART_DMA_ENABLE = 0,
+ *                    khi đó drain qua UART_WriteAsync)
+ * @return trace_srv_status_t Status of initialization
+ */
+trace_srv_status_t TRACE_SRV_Init(LPUART_RegType *base, uint8_t dma_channel);
+
+#if TRACE_SRV_RTT_ENABLE
+/**
+ * @brief Initialize trace service với RTT up channel làm drain
+ * @details Đăng ký trace ring làm storage của up channel (mode skip) rồi
+ *          ghi record thẳng vào đó: probe đọc qua SWD, firmware chỉ cập nhật
+ *          WrOff. RTT_SRV_Init() phải được gọi trước.
+ * @param up_channel RTT up channel (1 - RTT_SRV_MAX_UP_BUFFERS - 1)
+ * @return trace_srv_status_t TRACE_SRV_NOT_INITIALIZED nếu RTT chưa init
+ */
+trace_srv_status_t TRACE_SRV_InitRtt(uint8_t up_channel);
+#endif
+
+/**
+ * @brief Thay timestamp source (vd. LPIT microsecond counter)
+ * @param source Time source (NULL = DWT CYCCNT)
+ */
+void TRACE_SRV_InstallTimeSource(trace_srv_time_source_t source);
+
+/**
+ * @brief Ghi record không có args
+ * @param id Trace ID
+ */
+void TRACE_SRV_Log0(uint16_t id);
+
+/**
+ * @brief Ghi record 1 arg
+ * @param id Trace ID
+ * @param a0 Arg 0
+ */
+void TRACE_SRV_Log1(uint16_t id, uint32_t a0);
+
+/**
+ * @brief Ghi record 2 args
+ * @param id Trace ID
+ * @param a0 Arg 0
+ * @param a1 Arg 1
+ */
+void TRACE_SRV_Log2(uint16_t id, uint32_t a0, uint32_t a1);
+
+/**
+ * @brief Ghi record 3 args
+ * @param id Trace ID
+ * @param a0 Arg 0
+ * @param a1 Arg 1
+ * @param a2 Arg 2
+ */
+void TRACE_SRV_Log3(uint16_t id, uint32_t a0, uint32_t a1, uint32_t a2);
+
+/**
+ * @brief Ghi record 4 args
+ * @param id Trace ID
+ * @param a0 Arg 0
+ * @param a1 Arg 1
+ * @param a2 Arg 2
+ * @param a3 Arg 3
+ */
+void TRACE_SRV_Log4(uint16_t id, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+
+/**
+ * @brief Drain trace ring ra UART (gọi trong main loop)
+ * @details Non-blocking: khi transfer trước đã xong, start transfer mới cho
+ *          đoạn liên tục tiếp theo của ring.
+ */
+void TRACE_SRV_Process(void);
+
+/**
+ * @brief Số record bị drop do ring full
+ * @return uint32_t Dropped record count
+ */
+uint32_t TRACE_SRV_GetDropCount(void);
+
+/**
+ * @brief Copy các word mới nhất của ring (kể cả phần đã drain), cũ trước
+ * @details Dùng cho crash dump: không lock, không phụ thuộc UART. Word đầu
+ *          có thể nằm giữa một record, decoder resync theo sync nibble.
+ * @param dest  Buffer đích
+ * @param words Số word tối đa
+ * @return uint32_t Số word đã copy
+ */
+uint32_t TRACE_SRV_CopyTail(uint32_t *dest, uint32_t words);
+
+#endif /* TRACE_SRV_H */
@@ -9,6 +9,7 @@
  * - UART initialization với baudrate
  * - Send byte operation
  * - Send string operation
+ * - Send binary frame (COBS + CRC-16, xem frame_srv.h)
  * 
  * @author  PhucPH32
  * @date    05/12/2025
@@ -62,4 +63,13 @@ uart_srv_status_t UART_SRV_SendByte(uint8_t data);
  */
 uart_srv_status_t UART_SRV_SendString(const char *str);
 
+/**
+ * @brief Send binary frame (COBS + CRC-16 + delimiter)
+ * @details Encode streaming qua frame_srv, không cần buffer trung gian
+ * @param payload Payload bytes
+ * @param len     Payload length
+ * @return uart_srv_status_t Status of operation
+ */
+uart_srv_status_t UART_SRV_SendFrame(const uint8_t *payload, uint32_t len);
+
 #endif /* UART_SRV_H */
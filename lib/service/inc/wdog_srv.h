@@ -0,0 +1,139 @@
+/**
+ * @file    wdog_srv.h
+ * @brief   Watchdog Service Layer - Task Supervision API
+ * @details
+ * Service layer trên WDOG driver: WDOG chỉ được refresh khi MỌI task đã
+ * đăng ký check-in đúng hạn, nên một task bị treo (hoặc một queue bị đói)
+ * cũng reset MCU, không chỉ khi cả main loop treo.
+ *
+ * Features:
+ * - Tối đa WDOG_SRV_MAX_TASKS tasks, mỗi task có hạn check-in riêng
+ *   (tính bằng số lần gọi WDOG_SRV_Service())
+ * - WDOG_SRV_CheckIn() ISR-safe, lock-free (LDREX / STREX trên bitmask)
+ * - Window mode: WDOG_SRV_Service() gọi trước khi window mở không refresh
+ *   và không tiêu thụ check-in
+ * - Task trễ hạn: ngừng refresh vĩnh viễn, fault hook được gọi một lần với
+ *   id của task (vd. ghi log vào crash_srv), WDOG reset MCU khi hết timeout
+ *
+ * @code
+ * static void OnControl(uint32_t param, void *user_data)
+ * {
+ *     ...
+ *     WDOG_SRV_CheckIn(TASK_CONTROL);
+ * }
+ *
+ * // 10 ms timer_srv timer post s_wdog_work (priority thấp nhất)
+ * static void OnWdogWork(uint32_t param, void *user_data)
+ * {
+ *     (void)WDOG_SRV_Service();
+ * }
+ *
+ * wdog_config_t cfg = { .clockSource = WDOG_CLK_SRC_LPO, .timeoutUs = 50000U, .windowUs = 5000U };
+ * WDOG_SRV_Init(&cfg);
+ * WDOG_SRV_Register(TASK_CONTROL, 1U);    // check-in mỗi 10 ms
+ * WDOG_SRV_Register(TASK_COMMS, 10U);     // check-in ít nhất mỗi 100 ms
+ * @endcode
+ *
+ * @note Timeout của WDOG phải dài hơn chu kỳ gọi WDOG_SRV_Service() (và
+ *       window ngắn hơn), vd. Service mỗi 10 ms với timeout 50 ms.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+#ifndef WDOG_SRV_H
+#define WDOG_SRV_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "wdog.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** @brief Số task tối đa (1 - 32, một bit mỗi task) */
+#ifndef WDOG_SRV_MAX_TASKS
+#define WDOG_SRV_MAX_TASKS          (8U)
+#endif
+
+/** @brief Không có task lỗi */
+#define WDOG_SRV_NO_TASK            (0xFFU)
+
+/**
+ * @brief Watchdog service status codes
+ */
+typedef enum {
+    WDOG_SRV_SUCCESS = 0,
+    WDOG_SRV_ERROR,
+    WDOG_SRV_NOT_INITIALIZED,
+    WDOG_SRV_TOO_EARLY,             /**< Window chưa mở, chưa refresh */
+    WDOG_SRV_TASK_FAULT             /**< Task trễ hạn, không refresh nữa */
+} wdog_srv_status_t;
+
+/**
+ * @brief Fault hook (context của WDOG_SRV_Service())
+ * @param task_id Task đầu tiên trễ hạn check-in
+ */
+typedef void (*wdog_srv_fault_hook_t)(uint8_t task_id);
+
+/*******************************************************************************
+ * API Function Declarations
+ ******************************************************************************/
+
+/**
+ * @brief Khởi tạo service và cấu hình WDOG (WDOG_Init())
+ * @param config WDOG configuration
+ * @return wdog_srv_status_t Status of operation
+ */
+wdog_srv_status_t WDOG_SRV_Init(const wdog_config_t *config);
+
+/**
+ * @brief Đăng ký task cần giám sát
+ * @details Check-in của task được xóa; task có hạn tới lần Service() thứ
+ *          max_periods để check-in lần đầu.
+ * @param task_id     Task id (0 - WDOG_SRV_MAX_TASKS-1)
+ * @param max_periods Số lần WDOG_SRV_Service() liên tiếp tối đa không có check-in (>= 1)
+ * @return wdog_srv_status_t Status of operation
+ */
+wdog_srv_status_t WDOG_SRV_Register(uint8_t task_id, uint16_t max_periods);
+
+/**
+ * @brief Ngừng giám sát task
+ * @param task_id Task id
+ * @return wdog_srv_status_t Status of operation
+ */
+wdog_srv_status_t WDOG_SRV_Unregister(uint8_t task_id);
+
+/**
+ * @brief Task báo còn sống (ISR-safe)
+ * @param task_id Task id
+ */
+void WDOG_SRV_CheckIn(uint8_t task_id);
+
+/**
+ * @brief Kiểm tra check-in của mọi task, refresh WDOG khi tất cả đúng hạn
+ * @details Gọi định kỳ (thread mode hoặc interrupt). Task không check-in
+ *          từ lần Service() trước bị tăng missed count; hết hạn → fault.
+ * @return wdog_srv_status_t WDOG_SRV_SUCCESS (đã refresh), WDOG_SRV_TOO_EARLY,
+ *         WDOG_SRV_TASK_FAULT
+ */
+wdog_srv_status_t WDOG_SRV_Service(void);
+
+/**
+ * @brief Cài fault hook (NULL để bỏ)
+ * @param hook Fault hook
+ */
+void WDOG_SRV_SetFaultHook(wdog_srv_fault_hook_t hook);
+
+/**
+ * @brief Task đã gây fault
+ * @return uint8_t Task id, WDOG_SRV_NO_TASK khi chưa có fault
+ */
+uint8_t WDOG_SRV_GetFaultTask(void);
+
+#endif /* WDOG_SRV_H */
@@ -0,0 +1,501 @@
+/**
+ * @file    adc_scan_srv.c
+ * @brief   ADC Scan Service Implementation
+ * @details DMA frame callback copy frame vào bảng latest-value theo slot,
+ *          cập nhật min / max, frame counter chẵn / lẻ cho snapshot
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../inc/adc_scan_srv.h"
+#include "atomic.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+#define ADC_SCAN_SRV_NO_SLOT            (0xFFU)
+#define ADC_SCAN_SRV_CHANNEL_COUNT      (32U)       /* ADCH 0 .. 31 (AD0-15, temp, bandgap) */
+#define ADC_SCAN_SRV_BG_FRAC            (4U)        /* Bandgap filter: Q4 */
+
+#define ADC_SCAN_SRV_ADC_BITS          (12U)
+
+#define ADC_SCAN_SRV_MINMAX(min, max)   (((uint32_t)(max) << 16) | (uint32_t)(min))
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+/* Ping-pong frame buffer của DMA */
+static uint16_t s_frames[2U * ADC_SCAN_SRV_MAX_CHANNELS] DMA_BUFFER_SRAM_U;
+
+/* Writer duy nhất: DMA ISR. Index theo slot */
+static volatile uint16_t s_latest[ADC_SCAN_SRV_MAX_CHANNELS];
+static volatile uint32_t s_minmax[ADC_SCAN_SRV_MAX_CHANNELS];   /* max[31:16] | min[15:0] */
+
+/* Oversampling: accumulator + số frame còn thiếu của từng slot */
+static uint32_t s_os_acc[ADC_SCAN_SRV_MAX_CHANNELS];
+static uint16_t s_os_remaining[ADC_SCAN_SRV_MAX_CHANNELS];
+static uint8_t s_os_bits[ADC_SCAN_SRV_MAX_CHANNELS];
+static volatile uint16_t s_os_value[ADC_SCAN_SRV_MAX_CHANNELS];
+static volatile uint16_t s_os_valid = 0U;                       /* Bit mỗi slot */
+static uint16_t s_os_mask = 0U;                                 /* Slot có n > 0 */
+
+/* Scale Q16 (mV / LSB): đo từ bandgap nếu có trong scan list, ngược lại nominal */
+static volatile uint32_t s_scale = 0U;
+static uint32_t s_bg_filtered = 0U;
+static uint8_t s_bg_slot = ADC_SCAN_SRV_NO_SLOT;
+
+/* Lẻ khi ISR đang ghi bảng, frame count = s_seq / 2 */
+static volatile uint32_t s_seq = 0U;
+
+/* Bit mỗi slot: set bởi ResetMinMax (mọi context), xóa bởi ISR */
+static volatile uint32_t s_reset_request = 0U;
+
+static uint8_t s_slot_of[ADC_SCAN_SRV_CHANNEL_COUNT];
+static uint8_t s_num_slots = 0U;
+static ADC_Instance_t s_instance = ADC_INSTANCE_0;
+static bool s_track_min_max = false;
+static bool s_running = false;
+static volatile bool s_initialized = false;
+static volatile adc_scan_srv_frame_hook_t s_frame_hook = NULL;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/* Đọc và xóa reset request trong một LDREX / STREX */
+static uint32_t ADC_SCAN_SRV_TakeResets(void)
+{
+    uint32_t value;
+
+    do {
+        value = ATOMIC_LoadExclusive(&s_reset_request);
+    } while (ATOMIC_StoreExclusive(&s_reset_request, 0U) != 0U);
+
+    return value;
+}
+
+/**
+ * @brief Frame callback (DMA ISR), block = R[0..n-1] của một lần scan
+ */
+static void ADC_SCAN_SRV_OnFrame(ADC_Instance_t instance, const uint16_t *block,
+                                 uint16_t count, void *user_data)
+{
+    adc_scan_srv_frame_hook_t hook = s_frame_hook;
+    uint32_t resets = 0U;
+    uint32_t minmax;
+    uint16_t value;
+    uint32_t i;
+
+    (void)instance;
+    (void)user_data;
+
+    if (s_track_min_max) {
+        resets = ADC_SCAN_SRV_TakeResets();
+    }
+
+    s_seq++;
+
+    for (i = 0U; i < count; i++) {
+        value = block[i];
+        s_latest[i] = value;
+
+        if (s_track_min_max) {
+            minmax = s_minmax[i];
+            if ((resets & (1UL << i)) != 0U) {
+                minmax = ADC_SCAN_SRV_MINMAX(value, value);
+            } else if (value < (uint16_t)minmax) {
+                minmax = (minmax & 0xFFFF0000UL) | (uint32_t)value;
+            } else if (value > (uint16_t)(minmax >> 16)) {
+                minmax = (minmax & 0x0000FFFFUL) | ((uint32_t)value << 16);
+            } else {
+                /* Trong khoảng, giữ nguyên */
+            }
+            s_minmax[i] = minmax;
+        }
+
+        /* VREFH tracking: IIR trên bandgap, một phép chia mỗi frame */
+        if (i == s_bg_slot) {
+            if (s_bg_filtered == 0U) {
+                s_bg_filtered = (uint32_t)value << ADC_SCAN_SRV_BG_FRAC;
+            } else {
+                s_bg_filtered = (uint32_t)((int32_t)s_bg_filtered +
+                                (((int32_t)((uint32_t)value << ADC_SCAN_SRV_BG_FRAC) -
+                                  (int32_t)s_bg_filtered) >> ADC_SCAN_SRV_VREF_FILTER_SHIFT));
+            }
+            if (s_bg_filtered != 0U) {
+                s_scale = ((uint32_t)ADC_BANDGAP_MV << (ADC_VREF_SCALE_SHIFT + ADC_SCAN_SRV_BG_FRAC)) /
+                          s_bg_filtered;
+            }
+        }
+
+        /* Decimate: 4^n frame cộng dồn (tối đa 256 * 4095, vừa 32 bit), >> n */
+        if ((s_os_mask & (1U << i)) != 0U) {
+            s_os_acc[i] += value;
+            s_os_remaining[i]--;
+            if (s_os_remaining[i] == 0U) {
+                s_os_value[i] = (uint16_t)(s_os_acc[i] >> s_os_bits[i]);
+                s_os_valid |= (uint16_t)(1U << i);
+                s_os_acc[i] = 0U;
+                s_os_remaining[i] = (uint16_t)(1U << (2U * s_os_bits[i]));
+            }
+        }
+    }
+
+    s_seq++;
+
+    if (hook != NULL) {
+        hook(block, (uint8_t)count);
+    }
+}
+
+/**
+ * @brief Slot của channel, ADC_SCAN_SRV_NO_SLOT nếu không scan
+ */
+static inline uint8_t ADC_SCAN_SRV_Slot(ADC_Channel_t channel)
+{
+    if ((uint32_t)channel >= ADC_SCAN_SRV_CHANNEL_COUNT) {
+        return ADC_SCAN_SRV_NO_SLOT;
+    }
+
+    return s_slot_of[channel];
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+adc_scan_srv_status_t ADC_SCAN_SRV_Start(const adc_scan_srv_config_t *config)
+{
+    ADC_ScanGroupConfig_t group;
+    uint32_t i;
+
+    if ((config == NULL) || (config->channels == NULL) || (config->num_channels == 0U) ||
+        (config->num_channels > ADC_SCAN_SRV_MAX_CHANNELS) ||
+        ((uint32_t)config->instance > (uint32_t)ADC_INSTANCE_1)) {
+        return ADC_SCAN_SRV_ERROR;
+    }
+    if (s_running) {
+        return ADC_SCAN_SRV_ERROR;
+    }
+
+    s_initialized = false;
+
+    for (i = 0U; i < ADC_SCAN_SRV_CHANNEL_COUNT; i++) {
+        s_slot_of[i] = ADC_SCAN_SRV_NO_SLOT;
+    }
+
+    /* Channel trùng: bảng theo channel không biết chọn slot nào */
+    for (i = 0U; i < config->num_channels; i++) {
+        if (((uint32_t)config->channels[i] >= (uint32_t)ADC_CHANNEL_DISABLED) ||
+            (s_slot_of[config->channels[i]] != ADC_SCAN_SRV_NO_SLOT)) {
+            return ADC_SCAN_SRV_ERROR;
+        }
+        s_slot_of[config->channels[i]] = (uint8_t)i;
+    }
+
+    s_os_mask = 0U;
+    s_os_valid = 0U;
+    for (i = 0U; i < config->num_channels; i++) {
+        s_os_bits[i] = (config->oversample_bits != NULL) ? config->oversample_bits[i] : 0U;
+        if (s_os_bits[i] > ADC_SCAN_SRV_MAX_OVERSAMPLE_BITS) {
+            return ADC_SCAN_SRV_ERROR;
+        }
+        if (s_os_bits[i] != 0U) {
+            s_os_mask |= (uint16_t)(1U << i);
+        }
+        s_os_acc[i] = 0U;
+        s_os_remaining[i] = (uint16_t)(1U << (2U * s_os_bits[i]));
+    }
+
+    /* AVGE / AVGS chung cho mọi slot của instance */
+    if (ADC_ConfigureAveraging(config->instance, &config->hw_average) != ADC_STATUS_SUCCESS) {
+        return ADC_SCAN_SRV_ERROR;
+    }
+
+    /* Chưa có frame bandgap: dùng nominal VREFH */
+    s_bg_slot = s_slot_of[ADC_CHANNEL_BANDGAP];
+    s_bg_filtered = 0U;
+    s_scale = ADC_ComputeNominalScale((config->vref_mv != 0U) ? config->vref_mv : ADC_SCAN_SRV_DEFAULT_VREF_MV,
+                                      ADC_RESOLUTION_12BIT);
+
+    s_instance = config->instance;
+    s_num_slots = config->num_channels;
+    s_track_min_max = config->track_min_max;
+    s_seq = 0U;
+    /* Frame đầu tiên khởi tạo min / max */
+    s_reset_request = (1UL << config->num_channels) - 1U;
+
+    group.channels[0] = NULL;
+    group.channels[1] = NULL;
+    group.numChannels[0] = 0U;
+    group.numChannels[1] = 0U;
+    group.channels[config->instance] = config->channels;
+    group.numChannels[config->instance] = config->num_channels;
+    group.prescaler = config->prescaler;
+    group.multFactor = config->mult;
+    group.modulus = config->modulus;
+    group.delay = 0U;
+    group.triggerSource = PDB_TRIGGER_SOFTWARE;
+    group.continuousMode = true;
+
+    if (ADC_ConfigScanGroup(&group) != ADC_STATUS_SUCCESS) {
+        return ADC_SCAN_SRV_ERROR;
+    }
+
+    if (ADC_StartScanGroupDma(config->instance, config->dma_channel, s_frames,
+                              ADC_SCAN_SRV_OnFrame, NULL) != ADC_STATUS_SUCCESS) {
+        (void)ADC_StopScanGroup();
+        return ADC_SCAN_SRV_ERROR;
+    }
+
+    s_running = true;
+    s_initialized = true;
+
+    /* PDB continuous: một software trigger, sau đó tự lặp mỗi modulus */
+    if (ADC_StartScanGroup() != ADC_STATUS_SUCCESS) {
+        (void)ADC_SCAN_SRV_Stop();
+        return ADC_SCAN_SRV_ERROR;
+    }
+
+    return ADC_SCAN_SRV_SUCCESS;
+}
+
+adc_scan_srv_status_t ADC_SCAN_SRV_Stop(void)
+{
+    if (!s_initialized) {
+        return ADC_SCAN_SRV_NOT_INITIALIZED;
+    }
+    if (!s_running) {
+        return ADC_SCAN_SRV_SUCCESS;
+    }
+
+    (void)ADC_StopDmaStream(s_instance);
+    (void)ADC_StopScanGroup();
+    s_running = false;
+
+    return ADC_SCAN_SRV_SUCCESS;
+}
+
+adc_scan_srv_status_t ADC_SCAN_SRV_Read(ADC_Channel_t channel, uint16_t *value)
+{
+    uint8_t slot;
+
+    if (!s_initialized) {
+        return ADC_SCAN_SRV_NOT_INITIALIZED;
+    }
+    if (value == NULL) {
+        return ADC_SCAN_SRV_ERROR;
+    }
+
+    slot = ADC_SCAN_SRV_Slot(channel);
+    if ((slot == ADC_SCAN_SRV_NO_SLOT) || (s_seq < 2U)) {
+        return ADC_SCAN_SRV_NO_DATA;
+    }
+
+    /* Halfword load: không tear */
+    *value = s_latest[slot];
+
+    return ADC_SCAN_SRV_SUCCESS;
+}
+
+adc_scan_srv_status_t ADC_SCAN_SRV_ReadOversampled(ADC_Channel_t channel, uint16_t *value,
+                                                   uint8_t *bits)
+{
+    uint8_t slot;
+
+    if (!s_initialized) {
+        return ADC_SCAN_SRV_NOT_INITIALIZED;
+    }
+    if (value == NULL) {
+        return ADC_SCAN_SRV_ERROR;
+    }
+
+    slot = ADC_SCAN_SRV_Slot(channel);
+    if (slot == ADC_SCAN_SRV_NO_SLOT) {
+        return ADC_SCAN_SRV_NO_DATA;
+    }
+
+    if ((s_os_mask & (1U << slot)) == 0U) {
+        /* n = 0: giá trị thô */
+        if (s_seq < 2U) {
+            return ADC_SCAN_SRV_NO_DATA;
+        }
+        *value = s_latest[slot];
+    } else {
+        if ((s_os_valid & (1U << slot)) == 0U) {
+            return ADC_SCAN_SRV_NO_DATA;
+        }
+        *value = s_os_value[slot];
+    }
+
+    if (bits != NULL) {
+        *bits = (uint8_t)(ADC_SCAN_SRV_ADC_BITS + s_os_bits[slot]);
+    }
+
+    return ADC_SCAN_SRV_SUCCESS;
+}
+
+adc_scan_srv_status_t ADC_SCAN_SRV_ReadMillivolts(ADC_Channel_t channel, uint32_t *millivolts)
+{
+    adc_scan_srv_status_t status;
+    uint16_t value;
+
+    if (millivolts == NULL) {
+        return ADC_SCAN_SRV_ERROR;
+    }
+
+    status = ADC_SCAN_SRV_Read(channel, &value);
+    if (status == ADC_SCAN_SRV_SUCCESS) {
+        *millivolts = ADC_ApplyVrefScale(value, s_scale);
+    }
+
+    return status;
+}
+
+adc_scan_srv_status_t ADC_SCAN_SRV_GetVrefMillivolts(uint32_t *millivolts)
+{
+    if (!s_initialized) {
+        return ADC_SCAN_SRV_NOT_INITIALIZED;
+    }
+    if (millivolts == NULL) {
+        return ADC_SCAN_SRV_ERROR;
+    }
+
+    *millivolts = ADC_GetVrefFromScale(s_scale, ADC_RESOLUTION_12BIT);
+
+    return ((s_bg_slot != ADC_SCAN_SRV_NO_SLOT) && (s_seq >= 2U)) ? ADC_SCAN_SRV_SUCCESS
+                                                                  : ADC_SCAN_SRV_NO_DATA;
+}
+
+adc_scan_srv_status_t ADC_SCAN_SRV_ReadTemperature(int32_t *deci_celsius)
+{
+    adc_scan_srv_status_t status;
+    uint16_t value;
+
+    if (deci_celsius == NULL) {
+        return ADC_SCAN_SRV_ERROR;
+    }
+
+    status = ADC_SCAN_SRV_Read(ADC_CHANNEL_TEMP_SENSOR, &value);
+    if (status == ADC_SCAN_SRV_SUCCESS) {
+        *deci_celsius = ADC_ConvertToTemperature(value, s_scale);
+    }
+
+    return status;
+}
+
+adc_scan_srv_status_t ADC_SCAN_SRV_GetMinMax(ADC_Channel_t channel, uint16_t *min, uint16_t *max)
+{
+    uint32_t minmax;
+    uint8_t slot;
+
+    if (!s_initialized) {
+        return ADC_SCAN_SRV_NOT_INITIALIZED;
+    }
+    if ((min == NULL) || (max == NULL) || !s_track_min_max) {
+        return ADC_SCAN_SRV_ERROR;
+    }
+
+    slot = ADC_SCAN_SRV_Slot(channel);
+    if ((slot == ADC_SCAN_SRV_NO_SLOT) || (s_seq < 2U)) {
+        return ADC_SCAN_SRV_NO_DATA;
+    }
+
+    /* Một word load: min và max cùng một lần cập nhật */
+    minmax = s_minmax[slot];
+    *min = (uint16_t)minmax;
+    *max = (uint16_t)(minmax >> 16);
+
+    return ADC_SCAN_SRV_SUCCESS;
+}
+
+adc_scan_srv_status_t ADC_SCAN_SRV_ResetMinMax(ADC_Channel_t channel)
+{
+    uint32_t bits;
+    uint32_t value;
+    uint8_t slot;
+
+    if (!s_initialized) {
+        return ADC_SCAN_SRV_NOT_INITIALIZED;
+    }
+
+    if (channel == ADC_CHANNEL_DISABLED) {
+        bits = (1UL << s_num_slots) - 1U;
+    } else {
+        slot = ADC_SCAN_SRV_Slot(channel);
+        if (slot == ADC_SCAN_SRV_NO_SLOT) {
+            return ADC_SCAN_SRV_NO_DATA;
+        }
+        bits = 1UL << slot;
+    }
+
+    do {
+        value = ATOMIC_LoadExclusive(&s_reset_request);
+    } while (ATOMIC_StoreExclusive(&s_reset_request, value | bits) != 0U);
+
+    return ADC_SCAN_SRV_SUCCESS;
+}
+
+adc_scan_srv_status_t ADC_SCAN_SRV_GetSnapshot(uint16_t *values, uint32_t *frame)
+{
+    uint32_t start;
+    uint32_t retries;
+    uint32_t i;
+
+    if (!s_initialized) {
+        return ADC_SCAN_SRV_NOT_INITIALIZED;
+    }
+    if (values == NULL) {
+        return ADC_SCAN_SRV_ERROR;
+    }
+
+    for (retries = 0U; retries < ADC_SCAN_SRV_SNAPSHOT_RETRIES; retries++) {
+        start = s_seq;
+        if (start < 2U) {
+            return ADC_SCAN_SRV_NO_DATA;
+        }
+        if ((start & 1U) != 0U) {
+            /* Chen giữa lúc ISR đang ghi (reader priority cao hơn) */
+            continue;
+        }
+
+        for (i = 0U; i < s_num_slots; i++) {
+            values[i] = s_latest[i];
+        }
+
+        /* Không có frame mới trong lúc copy: snapshot nhất quán */
+        if (s_seq == start) {
+            if (frame != NULL) {
+                *frame = start >> 1;
+            }
+            return ADC_SCAN_SRV_SUCCESS;
+        }
+    }
+
+    return ADC_SCAN_SRV_BUSY;
+}
+
+void ADC_SCAN_SRV_InstallFrameHook(adc_scan_srv_frame_hook_t hook)
+{
+    s_frame_hook = hook;
+}
+
+uint32_t ADC_SCAN_SRV_GetFrameCount(void)
+{
+    return s_seq >> 1;
+}
+
+uint32_t ADC_SCAN_SRV_GetOverruns(void)
+{
+    if (!s_initialized) {
+        return 0U;
+    }
+
+    return ADC_GetDmaStreamOverruns(s_instance);
+}
@@ -0,0 +1,287 @@
+/**
+ * @file    can_gw_srv.c
+ * @brief   CAN Gateway Service Implementation
+ * @details Binary search trên routing table theo key (src, IDE, ID), copy 4
+ *          word mailbox sang TX MB trống đầu tiên của pool bus đích
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../inc/can_gw_srv.h"
+#include "can_reg.h"
+#include "nvic.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+#define CAN_GW_SRV_CS_TX_INACTIVE       (0x08000000UL)
+#define CAN_GW_SRV_CS_TX_DATA           (0x0C000000UL)
+#define CAN_GW_SRV_CS_CODE_MASK         (0x0F000000UL)
+#define CAN_GW_SRV_CS_SRR               (0x00400000UL)
+#define CAN_GW_SRV_CS_IDE               (0x00200000UL)
+#define CAN_GW_SRV_CS_FRAME_MASK        (0x007F0000UL)  /* SRR | IDE | RTR | DLC */
+
+#define CAN_GW_SRV_ID_STD_SHIFT         (18U)
+#define CAN_GW_SRV_ID_STD_MASK          (0x7FFUL)
+#define CAN_GW_SRV_ID_EXT_MASK          (0x1FFFFFFFUL)
+
+/* Key: src[31:30] | IDE[29] | ID[28:0] */
+#define CAN_GW_SRV_KEY_SRC_SHIFT        (30U)
+#define CAN_GW_SRV_KEY_IDE              (0x20000000UL)
+
+#if ((CAN_GW_SRV_FIRST_MB + CAN_GW_SRV_MB_COUNT) > 16U) || (CAN_GW_SRV_MB_COUNT == 0U)
+#error "CAN_GW_SRV pool must lie within MB0-15 (can_srv MAXMB)"
+#endif
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static CAN_Type *const s_gw_bases[3] = { CAN0, CAN1, CAN2 };
+static const can_gw_srv_route_t *s_routes = NULL;
+static can_gw_srv_route_state_t *s_states = NULL;
+static uint16_t s_count = 0U;
+static can_gw_srv_time_source_t s_time_source = NULL;
+static volatile bool s_initialized = false;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static inline uint32_t CAN_GW_SRV_MakeKey(uint32_t src, bool is_extended, uint32_t id)
+{
+    return (src << CAN_GW_SRV_KEY_SRC_SHIFT) |
+           (is_extended ? (CAN_GW_SRV_KEY_IDE | (id & CAN_GW_SRV_ID_EXT_MASK))
+                        : (id & CAN_GW_SRV_ID_STD_MASK));
+}
+
+static inline uint32_t CAN_GW_SRV_RouteKey(const can_gw_srv_route_t *route)
+{
+    return CAN_GW_SRV_MakeKey((uint32_t)route->src, route->is_extended, route->id);
+}
+
+/**
+ * @brief Binary search route theo key
+ * @return Index, hoặc s_count nếu không có route
+ */
+static uint16_t CAN_GW_SRV_Find(uint32_t key)
+{
+    uint32_t lo = 0U;
+    uint32_t hi = s_count;
+    uint32_t mid;
+    uint32_t mid_key;
+
+    while (lo < hi) {
+        mid = (lo + hi) >> 1;
+        mid_key = CAN_GW_SRV_RouteKey(&s_routes[mid]);
+        if (mid_key == key) {
+            return (uint16_t)mid;
+        }
+        if (mid_key < key) {
+            lo = mid + 1U;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return s_count;
+}
+
+/**
+ * @brief Copy frame vào TX MB trống đầu tiên của pool
+ * @return false nếu pool đầy
+ */
+static bool CAN_GW_SRV_Transmit(CAN_Type *base, uint32_t cs, uint32_t id_word,
+                                uint32_t data0, uint32_t data1)
+{
+    volatile uint32_t *mb;
+    uint32_t basepri;
+    uint32_t i;
+    bool sent = false;
+
+    /* ISR của bus nguồn khác (priority khác) có thể cùng ghi pool này */
+    basepri = NVIC_EnterCritical();
+
+    for (i = 0U; i < CAN_GW_SRV_MB_COUNT; i++) {
+        mb = &base->RAMn[(CAN_GW_SRV_FIRST_MB + i) * 4U];
+        if ((mb[0] & CAN_GW_SRV_CS_CODE_MASK) == CAN_GW_SRV_CS_TX_INACTIVE) {
+            base->IFLAG1 = (1UL << (CAN_GW_SRV_FIRST_MB + i));
+            mb[1] = id_word;
+            mb[2] = data0;
+            mb[3] = data1;
+            mb[0] = cs;
+            sent = true;
+            break;
+        }
+    }
+
+    NVIC_ExitCritical(basepri);
+
+    return sent;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+can_gw_srv_status_t CAN_GW_SRV_Init(const can_gw_srv_route_t *routes,
+                                    can_gw_srv_route_state_t *states, uint16_t count)
+{
+    uint32_t used_src = 0U;
+    uint32_t used_dst = 0U;
+    uint32_t prev_key = 0U;
+    uint32_t key;
+    uint32_t inst;
+    uint32_t i;
+
+    if ((routes == NULL) || (states == NULL) || (count == 0U)) {
+        return CAN_GW_SRV_ERROR;
+    }
+
+    for (i = 0U; i < count; i++) {
+        if (((uint32_t)routes[i].src >= CAN_SRV_INSTANCE_COUNT) ||
+            ((uint32_t)routes[i].dst >= CAN_SRV_INSTANCE_COUNT) ||
+            (routes[i].src == routes[i].dst)) {
+            return CAN_GW_SRV_ERROR;
+        }
+
+        /* Strictly sorted: binary search cần thứ tự, key trùng là route trùng */
+        key = CAN_GW_SRV_RouteKey(&routes[i]);
+        if ((i > 0U) && (key <= prev_key)) {
+            return CAN_GW_SRV_ERROR;
+        }
+        prev_key = key;
+
+        used_src |= 1UL << (uint32_t)routes[i].src;
+        used_dst |= 1UL << (uint32_t)routes[i].dst;
+    }
+
+    for (inst = 0U; inst < CAN_SRV_INSTANCE_COUNT; inst++) {
+        if (((used_src | used_dst) & (1UL << inst)) != 0U) {
+            if (!CAN_SRV_IsInitialized((can_srv_instance_t)inst)) {
+                return CAN_GW_SRV_NOT_INITIALIZED;
+            }
+        }
+    }
+
+    CAN_GW_SRV_Deinit();
+
+    for (i = 0U; i < count; i++) {
+        states[i].forwarded = 0U;
+        states[i].rate_limited = 0U;
+        states[i].dropped = 0U;
+        states[i].last_us = 0U;
+    }
+
+    for (inst = 0U; inst < CAN_SRV_INSTANCE_COUNT; inst++) {
+        if ((used_dst & (1UL << inst)) != 0U) {
+            for (i = 0U; i < CAN_GW_SRV_MB_COUNT; i++) {
+                s_gw_bases[inst]->RAMn[(CAN_GW_SRV_FIRST_MB + i) * 4U] = CAN_GW_SRV_CS_TX_INACTIVE;
+            }
+        }
+    }
+
+    s_routes = routes;
+    s_states = states;
+    s_count = count;
+    s_initialized = true;
+
+    for (inst = 0U; inst < CAN_SRV_INSTANCE_COUNT; inst++) {
+        if ((used_src & (1UL << inst)) != 0U) {
+            (void)CAN_SRV_RegisterRawRxHook((can_srv_instance_t)inst, CAN_GW_SRV_RxHook);
+        }
+    }
+
+    return CAN_GW_SRV_SUCCESS;
+}
+
+void CAN_GW_SRV_Deinit(void)
+{
+    uint32_t inst;
+
+    s_initialized = false;
+
+    /* Bus chưa init trả NOT_INITIALIZED, bỏ qua */
+    for (inst = 0U; inst < CAN_SRV_INSTANCE_COUNT; inst++) {
+        (void)CAN_SRV_RegisterRawRxHook((can_srv_instance_t)inst, NULL);
+    }
+}
+
+void CAN_GW_SRV_SetTimeSource(can_gw_srv_time_source_t source)
+{
+    s_time_source = source;
+}
+
+const can_gw_srv_route_state_t *CAN_GW_SRV_GetStats(uint16_t route)
+{
+    if (!s_initialized || (route >= s_count)) {
+        return NULL;
+    }
+
+    return &s_states[route];
+}
+
+bool CAN_GW_SRV_RxHook(can_srv_instance_t instance, const uint32_t *mb_words)
+{
+    const can_gw_srv_route_t *route;
+    can_gw_srv_route_state_t *state;
+    uint32_t cs = mb_words[0];
+    uint32_t id_word = mb_words[1];
+    bool is_extended = ((cs & CAN_GW_SRV_CS_IDE) != 0U);
+    uint32_t id;
+    uint32_t now;
+    uint16_t index;
+
+    if (!s_initialized) {
+        return false;
+    }
+
+    id = is_extended ? (id_word & CAN_GW_SRV_ID_EXT_MASK)
+                     : ((id_word >> CAN_GW_SRV_ID_STD_SHIFT) & CAN_GW_SRV_ID_STD_MASK);
+
+    index = CAN_GW_SRV_Find(CAN_GW_SRV_MakeKey((uint32_t)instance, is_extended, id));
+    if (index >= s_count) {
+        return false;
+    }
+
+    route = &s_routes[index];
+    state = &s_states[index];
+
+    /* Rate limit: last_us = 0 nghĩa là chưa forward lần nào */
+    if ((route->min_interval_ms != 0U) && (s_time_source != NULL)) {
+        now = s_time_source();
+        if ((state->last_us != 0U) &&
+            ((now - state->last_us) < ((uint32_t)route->min_interval_ms * 1000U))) {
+            state->rate_limited++;
+            return ((route->flags & CAN_GW_SRV_FLAG_LOCAL) == 0U);
+        }
+        state->last_us = (now != 0U) ? now : 1U;
+    }
+
+    if (route->remap_id != CAN_GW_SRV_NO_REMAP) {
+        id_word = is_extended ? (route->remap_id & CAN_GW_SRV_ID_EXT_MASK)
+                              : ((route->remap_id & CAN_GW_SRV_ID_STD_MASK) << CAN_GW_SRV_ID_STD_SHIFT);
+    } else {
+        /* Bỏ PRIO bits local của bus nguồn */
+        id_word &= CAN_GW_SRV_ID_EXT_MASK;
+    }
+
+    /* CS: giữ IDE / RTR / DLC của frame nhận, CODE = TX_DATA, SRR = 1 cho 29-bit */
+    cs = (cs & CAN_GW_SRV_CS_FRAME_MASK) | CAN_GW_SRV_CS_TX_DATA;
+    if (is_extended) {
+        cs |= CAN_GW_SRV_CS_SRR;
+    }
+
+    if (CAN_GW_SRV_Transmit(s_gw_bases[route->dst], cs, id_word, mb_words[2], mb_words[3])) {
+        state->forwarded++;
+    } else {
+        state->dropped++;
+    }
+
+    return ((route->flags & CAN_GW_SRV_FLAG_LOCAL) == 0U);
+}
@@ -0,0 +1,309 @@
+/**
+ * @file    can_sched_srv.c
+ * @brief   CAN Periodic TX Scheduler Service Implementation
+ * @details Mỗi message là một periodic soft timer (timer_srv); callback copy
+ *          mailbox image build sẵn vào TX mailbox trống đầu tiên của pool
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../inc/can_sched_srv.h"
+#include "can_reg.h"
+#include "nvic.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+#define CAN_SCHED_SRV_CS_TX_INACTIVE    (0x08000000UL)
+#define CAN_SCHED_SRV_CS_TX_DATA        (0x0C000000UL)
+#define CAN_SCHED_SRV_CS_CODE_MASK      (0x0F000000UL)
+#define CAN_SCHED_SRV_CS_SRR            (0x00400000UL)
+#define CAN_SCHED_SRV_CS_IDE            (0x00200000UL)
+#define CAN_SCHED_SRV_CS_DLC_SHIFT      (16U)
+
+#define CAN_SCHED_SRV_ID_STD_SHIFT      (18U)
+#define CAN_SCHED_SRV_ID_STD_MASK       (0x7FFUL)
+#define CAN_SCHED_SRV_ID_EXT_MASK       (0x1FFFFFFFUL)
+
+#if ((CAN_SCHED_SRV_FIRST_MB + CAN_SCHED_SRV_MB_COUNT) > 16U) || (CAN_SCHED_SRV_MB_COUNT == 0U)
+#error "CAN_SCHED_SRV pool must lie within MB0-15 (can_srv MAXMB)"
+#endif
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static can_sched_srv_msg_t *s_msgs = NULL;
+static can_sched_srv_time_source_t s_time_source = NULL;
+static bool s_running = false;
+static bool s_initialized = false;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static uint32_t CAN_SCHED_SRV_Gcd(uint32_t a, uint32_t b)
+{
+    uint32_t t;
+
+    while (b != 0U) {
+        t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+/* Offset trùng tick với ít message nhất: o ≡ o_j (mod gcd(p, p_j)) */
+static uint32_t CAN_SCHED_SRV_PickOffset(uint32_t period)
+{
+    const can_sched_srv_msg_t *other;
+    uint32_t limit = (period < CAN_SCHED_SRV_OFFSET_SEARCH) ? period : CAN_SCHED_SRV_OFFSET_SEARCH;
+    uint32_t best = 0U;
+    uint32_t best_hits = 0xFFFFFFFFUL;
+    uint32_t offset;
+    uint32_t hits;
+    uint32_t g;
+
+    for (offset = 0U; offset < limit; offset++) {
+        hits = 0U;
+        for (other = s_msgs; other != NULL; other = other->next) {
+            g = CAN_SCHED_SRV_Gcd(period, other->period);
+            if ((offset % g) == (other->offset % g)) {
+                hits++;
+            }
+        }
+        if (hits < best_hits) {
+            best_hits = hits;
+            best = offset;
+            if (hits == 0U) {
+                break;
+            }
+        }
+    }
+
+    return best;
+}
+
+static void CAN_SCHED_SRV_PackData(can_sched_srv_msg_t *msg, const uint8_t *data, uint8_t length)
+{
+    uint32_t word0 = 0U;
+    uint32_t word1 = 0U;
+    uint8_t i;
+
+    for (i = 0U; (i < length) && (i < 4U); i++) {
+        word0 |= ((uint32_t)data[i] << (24U - (i * 8U)));
+    }
+    for (i = 4U; i < length; i++) {
+        word1 |= ((uint32_t)data[i] << (56U - (i * 8U)));
+    }
+
+    msg->word[0] = word0;
+    msg->word[1] = word1;
+}
+
+/* LPIT interrupt context: chỉ copy image, không build frame */
+static void CAN_SCHED_SRV_OnTimer(timer_srv_timer_t *timer, void *user_data)
+{
+    can_sched_srv_msg_t *msg = (can_sched_srv_msg_t *)user_data;
+    volatile uint32_t *mb;
+    uint32_t basepri;
+    uint32_t now;
+    uint32_t nominal;
+    uint32_t deviation;
+    uint32_t i;
+
+    (void)timer;
+
+    if (s_time_source != NULL) {
+        now = s_time_source();
+        if (msg->last_us != 0U) {
+            nominal = msg->period * TIMER_SRV_TICK_US;
+            deviation = now - msg->last_us;
+            deviation = (deviation > nominal) ? (deviation - nominal) : (nominal - deviation);
+            if (deviation > msg->stats.jitter_max_us) {
+                msg->stats.jitter_max_us = deviation;
+            }
+        }
+        msg->last_us = (now != 0U) ? now : 1U;
+    }
+
+    for (i = 0U; i < CAN_SCHED_SRV_MB_COUNT; i++) {
+        mb = &CAN0->RAMn[(CAN_SCHED_SRV_FIRST_MB + i) * 4U];
+        if ((mb[0] & CAN_SCHED_SRV_CS_CODE_MASK) == CAN_SCHED_SRV_CS_TX_INACTIVE) {
+            /* Update() từ context priority cao hơn không được xé đôi payload */
+            basepri = NVIC_EnterCritical();
+            CAN0->IFLAG1 = (1UL << (CAN_SCHED_SRV_FIRST_MB + i));
+            mb[1] = msg->id;
+            mb[2] = msg->word[0];
+            mb[3] = msg->word[1];
+            mb[0] = msg->cs;
+            NVIC_ExitCritical(basepri);
+
+            msg->stats.sent++;
+            return;
+        }
+    }
+
+    msg->stats.missed++;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+can_sched_srv_status_t CAN_SCHED_SRV_Init(void)
+{
+    uint32_t i;
+
+    CAN_SCHED_SRV_Stop();
+
+    for (i = 0U; i < CAN_SCHED_SRV_MB_COUNT; i++) {
+        CAN0->RAMn[(CAN_SCHED_SRV_FIRST_MB + i) * 4U] = CAN_SCHED_SRV_CS_TX_INACTIVE;
+    }
+
+    s_msgs = NULL;
+    s_running = false;
+    s_initialized = true;
+
+    return CAN_SCHED_SRV_SUCCESS;
+}
+
+can_sched_srv_status_t CAN_SCHED_SRV_SetTimeSource(can_sched_srv_time_source_t source)
+{
+    s_time_source = source;
+    CAN_SCHED_SRV_ResetStats();
+
+    return CAN_SCHED_SRV_SUCCESS;
+}
+
+can_sched_srv_status_t CAN_SCHED_SRV_Add(can_sched_srv_msg_t *msg, const can_sched_srv_msg_config_t *config)
+{
+    static const uint8_t zero[8] = { 0U };
+    uint32_t period;
+
+    if (!s_initialized) {
+        return CAN_SCHED_SRV_NOT_INITIALIZED;
+    }
+
+    if ((msg == NULL) || (config == NULL) || (config->length > 8U) ||
+        (config->period_ms == 0U) || s_running) {
+        return CAN_SCHED_SRV_ERROR;
+    }
+
+    period = TIMER_SRV_MS_TO_TICKS(config->period_ms);
+    if ((period > TIMER_SRV_MAX_TICKS) ||
+        ((config->offset_ms != CAN_SCHED_SRV_OFFSET_AUTO) &&
+         (TIMER_SRV_MS_TO_TICKS(config->offset_ms) >= TIMER_SRV_MAX_TICKS))) {
+        return CAN_SCHED_SRV_ERROR;
+    }
+
+    msg->cs = CAN_SCHED_SRV_CS_TX_DATA | ((uint32_t)config->length << CAN_SCHED_SRV_CS_DLC_SHIFT);
+    if (config->is_extended) {
+        msg->cs |= CAN_SCHED_SRV_CS_IDE | CAN_SCHED_SRV_CS_SRR;
+        msg->id = config->id & CAN_SCHED_SRV_ID_EXT_MASK;
+    } else {
+        msg->id = (config->id & CAN_SCHED_SRV_ID_STD_MASK) << CAN_SCHED_SRV_ID_STD_SHIFT;
+    }
+    CAN_SCHED_SRV_PackData(msg, (config->data != NULL) ? config->data : zero, config->length);
+
+    msg->period = period;
+    msg->offset = (config->offset_ms == CAN_SCHED_SRV_OFFSET_AUTO) ?
+                  CAN_SCHED_SRV_PickOffset(period) : TIMER_SRV_MS_TO_TICKS(config->offset_ms);
+    msg->last_us = 0U;
+    msg->stats.sent = 0U;
+    msg->stats.missed = 0U;
+    msg->stats.jitter_max_us = 0U;
+    msg->timer.active = false;
+
+    msg->next = s_msgs;
+    s_msgs = msg;
+
+    return CAN_SCHED_SRV_SUCCESS;
+}
+
+can_sched_srv_status_t CAN_SCHED_SRV_Start(void)
+{
+    can_sched_srv_msg_t *msg;
+    uint32_t basepri;
+
+    if (!s_initialized) {
+        return CAN_SCHED_SRV_NOT_INITIALIZED;
+    }
+
+    /* Interrupt masked: mọi timer start cùng một tick, offset giữ đúng tương quan */
+    basepri = NVIC_EnterCritical();
+    for (msg = s_msgs; msg != NULL; msg = msg->next) {
+        msg->last_us = 0U;
+        if (TIMER_SRV_Start(&msg->timer, msg->offset + 1U, msg->period,
+                            CAN_SCHED_SRV_OnTimer, msg) != TIMER_SRV_SUCCESS) {
+            NVIC_ExitCritical(basepri);
+            CAN_SCHED_SRV_Stop();
+            return CAN_SCHED_SRV_ERROR;
+        }
+    }
+    s_running = true;
+    NVIC_ExitCritical(basepri);
+
+    return CAN_SCHED_SRV_SUCCESS;
+}
+
+void CAN_SCHED_SRV_Stop(void)
+{
+    can_sched_srv_msg_t *msg;
+
+    for (msg = s_msgs; msg != NULL; msg = msg->next) {
+        TIMER_SRV_Stop(&msg->timer);
+    }
+    s_running = false;
+}
+
+can_sched_srv_status_t CAN_SCHED_SRV_Update(can_sched_srv_msg_t *msg, const uint8_t *data)
+{
+    uint32_t basepri;
+
+    if ((msg == NULL) || (data == NULL)) {
+        return CAN_SCHED_SRV_ERROR;
+    }
+
+    basepri = NVIC_EnterCritical();
+    CAN_SCHED_SRV_PackData(msg, data, (uint8_t)((msg->cs >> CAN_SCHED_SRV_CS_DLC_SHIFT) & 0x0FU));
+    NVIC_ExitCritical(basepri);
+
+    return CAN_SCHED_SRV_SUCCESS;
+}
+
+can_sched_srv_status_t CAN_SCHED_SRV_GetStats(const can_sched_srv_msg_t *msg, can_sched_srv_stats_t *stats)
+{
+    uint32_t basepri;
+
+    if ((msg == NULL) || (stats == NULL)) {
+        return CAN_SCHED_SRV_ERROR;
+    }
+
+    basepri = NVIC_EnterCritical();
+    *stats = msg->stats;
+    NVIC_ExitCritical(basepri);
+
+    return CAN_SCHED_SRV_SUCCESS;
+}
+
+void CAN_SCHED_SRV_ResetStats(void)
+{
+    can_sched_srv_msg_t *msg;
+    uint32_t basepri;
+
+    basepri = NVIC_EnterCritical();
+    for (msg = s_msgs; msg != NULL; msg = msg->next) {
+        msg->last_us = 0U;
+        msg->stats.sent = 0U;
+        msg->stats.missed = 0U;
+        msg->stats.jitter_max_us = 0U;
+    }
+    NVIC_ExitCritical(basepri);
+}
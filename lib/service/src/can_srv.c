@@ -1,7 +1,8 @@
 /**
  * @file    can_srv.c
  * @brief   CAN Service Layer Implementation
- * @details Implementation của CAN service layer, wrapper cho CAN driver
+ * @details Implementation của CAN service layer, wrapper cho CAN driver.
+ *          Mỗi instance (CAN0 / CAN1 / CAN2) có state struct riêng.
  * 
  * @author  PhucPH32
  * @date    05/12/2025
@@ -12,22 +13,77 @@
  * Includes
  ******************************************************************************/
 #include "../inc/can_srv.h"
-#include "S32K144.h"
+#include "../inc/can_gw_srv.h"
+#include "can_reg.h"
+#include "lfqueue.h"
+#include "nvic.h"
 #include <string.h>
 
 /*******************************************************************************
  * Private Definitions
  ******************************************************************************/
-#define CAN_MAX_MB      (32U)    /* Maximum message buffers */
-#define CAN_RX_MB       (4U)     /* RX mailbox number */
-#define CAN_TX_MB       (8U)     /* TX mailbox number */
+#define CAN_MAX_MB      (16U)    /* MAXMB = 15: MB0-15, đủ cho cả CAN1 / CAN2 */
+#define CAN_TX_MB_MASK  (((1UL << CAN_SRV_TX_MB_COUNT) - 1UL) << CAN_SRV_TX_MB_FIRST)
+#define CAN_NO_MB       (0xFFU)
+
+#define CAN_CS_CODE_MASK        (0x0F000000UL)
+#define CAN_CS_TX_INACTIVE      (0x08000000UL)
+
+#if ((CAN_SRV_RX_RING_SIZE & (CAN_SRV_RX_RING_SIZE - 1U)) != 0U)
+#error "CAN_SRV_RX_RING_SIZE must be a power of 2"
+#endif
+
+#if ((CAN_SRV_TX_QUEUE_SIZE & (CAN_SRV_TX_QUEUE_SIZE - 1U)) != 0U) || (CAN_SRV_TX_QUEUE_SIZE == 0U)
+#error "CAN_SRV_TX_QUEUE_SIZE must be a power of 2"
+#endif
+
+#if (CAN_SRV_INSTANCE_COUNT == 0U) || (CAN_SRV_INSTANCE_COUNT > 3U)
+#error "CAN_SRV_INSTANCE_COUNT must be 1..3"
+#endif
+
+#if (CAN_SRV_TX_MB_COUNT == 0U) || ((CAN_SRV_TX_MB_FIRST + CAN_SRV_TX_MB_COUNT) > CAN_MAX_MB) || \
+    (CAN_SRV_RX_MB >= CAN_MAX_MB) || \
+    ((CAN_SRV_RX_MB >= CAN_SRV_TX_MB_FIRST) && (CAN_SRV_RX_MB < (CAN_SRV_TX_MB_FIRST + CAN_SRV_TX_MB_COUNT)))
+#error "can_srv mailbox partition must lie within MB0-15 and RX MB must not overlap the TX pool"
+#endif
+
+/* TX pool của can_gw_srv dùng cùng MB0-15 trên mọi bus */
+#if ((CAN_SRV_RX_MB >= CAN_GW_SRV_FIRST_MB) && (CAN_SRV_RX_MB < (CAN_GW_SRV_FIRST_MB + CAN_GW_SRV_MB_COUNT))) || \
+    ((CAN_SRV_TX_MB_FIRST < (CAN_GW_SRV_FIRST_MB + CAN_GW_SRV_MB_COUNT)) && \
+     (CAN_GW_SRV_FIRST_MB < (CAN_SRV_TX_MB_FIRST + CAN_SRV_TX_MB_COUNT)))
+#error "CAN_GW_SRV mailbox pool must not overlap the can_srv TX pool or CAN_SRV_RX_MB"
+#endif
+
+/**
+ * @brief State của một instance
+ */
+typedef struct {
+    CAN_Type *base;
+    bool initialized;
+    uint32_t baudrate;
+    can_srv_rx_callback_t rx_callback;
+    can_srv_tx_hook_t tx_hook;
+    can_srv_rx_hook_t rx_hook;
+    can_srv_raw_rx_hook_t raw_rx_hook;
+    uint32_t rx_rejected;
+    volatile uint32_t rx_overflow;
+
+    /* RX ring: ISR là producer, main loop là consumer (SPSC lock-free) */
+    lfq_spsc_t rx_queue;
+    can_srv_message_t rx_storage[CAN_SRV_RX_RING_SIZE];
+
+    /* TX queue: push / pop đều trong critical section (Send có thể chạy ở mọi context) */
+    lfq_spsc_t tx_queue;
+    can_srv_message_t tx_storage[CAN_SRV_TX_QUEUE_SIZE];
+} can_srv_ctx_t;
 
 /*******************************************************************************
  * Private Variables
  ******************************************************************************/
-static bool s_can_initialized = false;
-static CAN_Type *s_can_instance = NULL;
-static can_srv_rx_callback_t s_rx_callback = NULL;
+static CAN_Type *const s_can_bases[3] = { CAN0, CAN1, CAN2 };
+/* RX ring / TX queue: ISR và main loop truy cập liên tục, đặt ở SRAM_L */
+static can_srv_ctx_t s_ctx[CAN_SRV_INSTANCE_COUNT] FAST_DATA_SRAM_L;
+static can_srv_time_source_t s_time_source = NULL;
 
 /*******************************************************************************
  * Private Functions
@@ -81,78 +137,268 @@ static void CAN_CalculateTiming(uint32_t baudrate, uint8_t *presdiv, uint8_t *pr
     }
 }
 
+/**
+ * @brief Lấy state của instance đã init
+ * @return NULL nếu instance không hợp lệ hoặc chưa init
+ */
+static can_srv_ctx_t *CAN_SRV_GetCtx(can_srv_instance_t instance)
+{
+    if ((uint32_t)instance >= CAN_SRV_INSTANCE_COUNT) {
+        return NULL;
+    }
+
+    return s_ctx[instance].initialized ? &s_ctx[instance] : NULL;
+}
+
+/**
+ * @brief Copy 4 word của RX mailbox (CS, ID, DATA0, DATA1) và giải phóng mailbox
+ * @param base CAN instance
+ * @param words Buffer 4 word
+ * @return uint16_t Free running timer lúc unlock
+ * @note Caller phải đảm bảo IFLAG của RX mailbox đang được set
+ */
+static uint16_t CAN_SRV_ReadMailboxWords(CAN_Type *base, uint32_t *words)
+{
+    uint16_t now;
+    
+    /* Lock the mailbox by reading control/status word */
+    words[0] = base->RAMn[CAN_SRV_RX_MB * 4];
+    words[1] = base->RAMn[CAN_SRV_RX_MB * 4 + 1];
+    words[2] = base->RAMn[CAN_SRV_RX_MB * 4 + 2];
+    words[3] = base->RAMn[CAN_SRV_RX_MB * 4 + 3];
+    
+    /* Unlock mailbox by reading free running timer */
+    now = (uint16_t)base->TIMER;
+    
+    /* Clear interrupt flag */
+    base->IFLAG1 = (1U << CAN_SRV_RX_MB);
+    
+    return now;
+}
+
+/**
+ * @brief Giải mã 4 word mailbox thành message
+ * @param ctx Instance state
+ * @param words CS, ID, DATA0, DATA1
+ * @param now Free running timer lúc đọc mailbox
+ * @param msg Pointer to store received message
+ */
+static void CAN_SRV_Unpack(const can_srv_ctx_t *ctx, const uint32_t *words, uint16_t now,
+                           can_srv_message_t *msg)
+{
+    uint32_t cs = words[0];
+    uint32_t id_word = words[1];
+    uint32_t data_word1 = words[2];
+    uint32_t data_word2 = words[3];
+    
+    if (cs & 0x00200000) { /* IDE = 1 */
+        msg->isExtended = true;
+        msg->id = (id_word >> 1) & 0x1FFFFFFF;
+    } else {
+        msg->isExtended = false;
+        msg->id = (id_word >> 18) & 0x7FF;
+    }
+    
+    /* Read length */
+    msg->length = (cs >> 16) & 0x0F;
+    if (msg->length > 8) {
+        msg->length = 8;
+    }
+    
+    /* Read data */
+    for (uint8_t i = 0; i < msg->length; i++) {
+        if (i < 4) {
+            msg->data[i] = (uint8_t)(data_word1 >> (24 - i * 8));
+        } else {
+            msg->data[i] = (uint8_t)(data_word2 >> (56 - i * 8));
+        }
+    }
+    
+    /* Timestamp: TIME_STAMP là giá trị timer lúc nhận, tuổi frame = now - TIME_STAMP */
+    msg->timeStamp = (uint16_t)(cs & 0xFFFFU);
+    if ((s_time_source != NULL) && (ctx->baudrate >= 1000U)) {
+        uint16_t age = (uint16_t)(now - msg->timeStamp);
+        msg->timestampUs = s_time_source() - (((uint32_t)age * 1000U) / (ctx->baudrate / 1000U));
+    } else {
+        msg->timestampUs = 0U;
+    }
+}
+
+/**
+ * @brief Nạp message vào TX mailbox (MB phải đang INACTIVE)
+ */
+static void CAN_SRV_WriteMailbox(CAN_Type *base, uint8_t mb, const can_srv_message_t *msg)
+{
+    /* Configure message buffer */
+    uint32_t cs = 0x0C000000 | ((uint32_t)msg->length << 16); /* CODE = TX_DATA */
+    
+    if (msg->isExtended) {
+        cs |= 0x00200000; /* IDE = 1 */
+        base->RAMn[mb * 4 + 1] = (msg->id << 1) | 0x01; /* SRR = 1 */
+    } else {
+        base->RAMn[mb * 4 + 1] = (msg->id << 18);
+    }
+    
+    /* Copy data */
+    uint32_t *data_ptr = (uint32_t *)&base->RAMn[mb * 4 + 2];
+    uint32_t data_word1 = 0, data_word2 = 0;
+    
+    for (uint8_t i = 0; i < msg->length; i++) {
+        if (i < 4) {
+            data_word1 |= ((uint32_t)msg->data[i] << (24 - i * 8));
+        } else {
+            data_word2 |= ((uint32_t)msg->data[i] << (56 - i * 8));
+        }
+    }
+    
+    data_ptr[0] = data_word1;
+    data_ptr[1] = data_word2;
+    
+    /* Activate transmission */
+    base->RAMn[mb * 4] = cs;
+}
+
+/**
+ * @brief TX mailbox rảnh đầu tiên trong pool
+ * @return Số MB, CAN_NO_MB nếu mọi MB đang gửi
+ */
+static uint8_t CAN_SRV_FindFreeTxMb(const CAN_Type *base)
+{
+    uint8_t mb;
+    
+    for (mb = CAN_SRV_TX_MB_FIRST; mb < (CAN_SRV_TX_MB_FIRST + CAN_SRV_TX_MB_COUNT); mb++) {
+        if ((base->RAMn[mb * 4] & CAN_CS_CODE_MASK) == CAN_CS_TX_INACTIVE) {
+            return mb;
+        }
+    }
+    
+    return CAN_NO_MB;
+}
+
+/**
+ * @brief Nạp message từ TX queue vào các TX MB rảnh (theo thứ tự queue)
+ * @note Caller giữ critical section
+ */
+static void CAN_SRV_DrainTx(can_srv_ctx_t *ctx)
+{
+    const can_srv_message_t *next;
+    uint8_t mb;
+    
+    while ((next = (const can_srv_message_t *)LFQ_SpscPeekRead(&ctx->tx_queue)) != NULL) {
+        mb = CAN_SRV_FindFreeTxMb(ctx->base);
+        if (mb == CAN_NO_MB) {
+            break;
+        }
+        CAN_SRV_WriteMailbox(ctx->base, mb, next);
+        LFQ_SpscCommitRead(&ctx->tx_queue);
+    }
+}
+
+/**
+ * @brief Chạy RX hook (nếu có) trên message vừa lấy ra
+ * @return true nếu message được chấp nhận
+ */
+static bool CAN_SRV_ApplyRxHook(can_srv_ctx_t *ctx, can_srv_message_t *msg)
+{
+    if ((ctx->rx_hook != NULL) && !ctx->rx_hook(msg)) {
+        ctx->rx_rejected++;
+        return false;
+    }
+    
+    return true;
+}
+
 /*******************************************************************************
  * Public Functions
  ******************************************************************************/
 
-can_srv_status_t CAN_SRV_Init(const can_srv_config_t *config)
+can_srv_status_t CAN_SRV_Init(can_srv_instance_t instance, const can_srv_config_t *config)
 {
-    if (config == NULL) {
+    can_srv_ctx_t *ctx;
+    CAN_Type *base;
+    uint8_t mb;
+    
+    if ((config == NULL) || ((uint32_t)instance >= CAN_SRV_INSTANCE_COUNT)) {
         return CAN_SRV_ERROR;
     }
     
-    /* Use CAN0 as default instance */
-    s_can_instance = CAN0;
+    ctx = &s_ctx[instance];
+    base = s_can_bases[instance];
     
-    /* Enable CAN0 clock via PCC */
-    /* PCC->PCCn[PCC_FlexCAN0_INDEX] = PCC_PCCn_CGC_MASK; */
+    /* ISR của instance bỏ qua state trong lúc cấu hình lại */
+    ctx->initialized = false;
+    ctx->base = base;
+    ctx->baudrate = config->baudrate;
     
     /* Enter freeze mode for configuration */
-    s_can_instance->MCR |= CAN_MCR_FRZ_MASK | CAN_MCR_HALT_MASK;
-    while (!(s_can_instance->MCR & CAN_MCR_FRZACK_MASK));
+    base->MCR |= CAN_MCR_FRZ_MASK | CAN_MCR_HALT_MASK;
+    while (!(base->MCR & CAN_MCR_FRZACK_MASK));
     
     /* Disable self-reception */
-    s_can_instance->MCR |= CAN_MCR_SRXDIS_MASK;
+    base->MCR |= CAN_MCR_SRXDIS_MASK;
     
     /* Enable individual RX masking */
-    s_can_instance->MCR |= CAN_MCR_IRMQ_MASK;
+    base->MCR |= CAN_MCR_IRMQ_MASK;
     
     /* Set maximum number of message buffers */
-    s_can_instance->MCR = (s_can_instance->MCR & ~CAN_MCR_MAXMB_MASK) | CAN_MCR_MAXMB(0x0F);
+    base->MCR = (base->MCR & ~CAN_MCR_MAXMB_MASK) | CAN_MCR_MAXMB(CAN_MAX_MB - 1U);
     
     /* Calculate and set bit timing */
     uint8_t presdiv, propseg, pseg1, pseg2;
     CAN_CalculateTiming(config->baudrate, &presdiv, &propseg, &pseg1, &pseg2);
     
-    s_can_instance->CTRL1 = CAN_CTRL1_PRESDIV(presdiv) |
-                            CAN_CTRL1_PROPSEG(propseg) |
-                            CAN_CTRL1_PSEG1(pseg1) |
-                            CAN_CTRL1_PSEG2(pseg2) |
-                            CAN_CTRL1_RJW(1);
+    base->CTRL1 = CAN_CTRL1_PRESDIV(presdiv) |
+                  CAN_CTRL1_PROPSEG(propseg) |
+                  CAN_CTRL1_PSEG1(pseg1) |
+                  CAN_CTRL1_PSEG2(pseg2) |
+                  CAN_CTRL1_RJW(1);
     
     /* Configure RX message buffer with filter */
-    /* MB4 as RX */
-    s_can_instance->RAMn[CAN_RX_MB * 4] = 0x04000000; /* CODE = EMPTY, IDE = 0 */
+    base->RAMn[CAN_SRV_RX_MB * 4] = 0x04000000; /* CODE = EMPTY, IDE = 0 */
     
     /* Set RX filter */
     if (config->filter_extended) {
-        s_can_instance->RAMn[CAN_RX_MB * 4] |= 0x00200000; /* IDE = 1 */
-        s_can_instance->RAMn[CAN_RX_MB * 4 + 1] = (config->filter_id << 1);
-        s_can_instance->RXIMR[CAN_RX_MB] = (config->filter_mask << 1);
+        base->RAMn[CAN_SRV_RX_MB * 4] |= 0x00200000; /* IDE = 1 */
+        base->RAMn[CAN_SRV_RX_MB * 4 + 1] = (config->filter_id << 1);
+        base->RXIMR[CAN_SRV_RX_MB] = (config->filter_mask << 1);
     } else {
-        s_can_instance->RAMn[CAN_RX_MB * 4 + 1] = (config->filter_id << 18);
-        s_can_instance->RXIMR[CAN_RX_MB] = (config->filter_mask << 18);
+        base->RAMn[CAN_SRV_RX_MB * 4 + 1] = (config->filter_id << 18);
+        base->RXIMR[CAN_SRV_RX_MB] = (config->filter_mask << 18);
     }
     
-    /* Configure TX message buffer */
-    /* MB8 as TX inactive */
-    s_can_instance->RAMn[CAN_TX_MB * 4] = 0x08000000; /* CODE = INACTIVE */
+    /* Configure TX pool: mọi MB INACTIVE */
+    for (mb = CAN_SRV_TX_MB_FIRST; mb < (CAN_SRV_TX_MB_FIRST + CAN_SRV_TX_MB_COUNT); mb++) {
+        base->RAMn[mb * 4] = CAN_CS_TX_INACTIVE;
+    }
+    base->IFLAG1 = CAN_TX_MB_MASK | (1UL << CAN_SRV_RX_MB);
     
     /* Exit freeze mode */
-    s_can_instance->MCR &= ~(CAN_MCR_FRZ_MASK | CAN_MCR_HALT_MASK);
-    while (s_can_instance->MCR & CAN_MCR_FRZACK_MASK);
+    base->MCR &= ~(CAN_MCR_FRZ_MASK | CAN_MCR_HALT_MASK);
+    while (base->MCR & CAN_MCR_FRZACK_MASK);
     
-    /* Enable RX interrupt for MB4 */
-    s_can_instance->IMASK1 |= (1U << CAN_RX_MB);
+    /* Reset RX ring / TX queue */
+    (void)LFQ_SpscInit(&ctx->rx_queue, ctx->rx_storage, sizeof(ctx->rx_storage[0]), CAN_SRV_RX_RING_SIZE);
+    (void)LFQ_SpscInit(&ctx->tx_queue, ctx->tx_storage, sizeof(ctx->tx_storage[0]), CAN_SRV_TX_QUEUE_SIZE);
+    ctx->rx_overflow = 0U;
+    ctx->rx_rejected = 0U;
     
-    s_can_initialized = true;
+    /* Enable RX interrupt và TX done interrupt của pool */
+    base->IMASK1 |= (1UL << CAN_SRV_RX_MB) | CAN_TX_MB_MASK;
+    
+    ctx->initialized = true;
     
     return CAN_SRV_SUCCESS;
 }
 
-can_srv_status_t CAN_SRV_Send(const can_srv_message_t *msg)
+can_srv_status_t CAN_SRV_Send(can_srv_instance_t instance, const can_srv_message_t *msg)
 {
-    if (!s_can_initialized) {
+    can_srv_ctx_t *ctx = CAN_SRV_GetCtx(instance);
+    can_srv_message_t tx;
+    can_srv_status_t status = CAN_SRV_SUCCESS;
+    uint32_t basepri;
+    uint8_t mb;
+    
+    if (ctx == NULL) {
         return CAN_SRV_NOT_INITIALIZED;
     }
     
@@ -160,46 +406,46 @@ can_srv_status_t CAN_SRV_Send(const can_srv_message_t *msg)
         return CAN_SRV_ERROR;
     }
     
-    /* Wait for TX MB to be available */
-    uint32_t code = (s_can_instance->RAMn[CAN_TX_MB * 4] >> 24) & 0x0F;
-    if (code != 0x08) { /* Not INACTIVE */
+    /* Hết chỗ cả MB lẫn queue: trả lỗi trước khi chạy hook (freshness / MAC không bị phí) */
+    if ((CAN_SRV_FindFreeTxMb(ctx->base) == CAN_NO_MB) &&
+        (LFQ_SpscCount(&ctx->tx_queue) >= CAN_SRV_TX_QUEUE_SIZE)) {
         return CAN_SRV_ERROR;
     }
     
-    /* Configure message buffer */
-    uint32_t cs = 0x0C000000 | (msg->length << 16); /* CODE = TX_DATA */
-    
-    if (msg->isExtended) {
-        cs |= 0x00200000; /* IDE = 1 */
-        s_can_instance->RAMn[CAN_TX_MB * 4 + 1] = (msg->id << 1) | 0x01; /* SRR = 1 */
-    } else {
-        s_can_instance->RAMn[CAN_TX_MB * 4 + 1] = (msg->id << 18);
+    if (ctx->tx_hook != NULL) {
+        tx = *msg;
+        if (!ctx->tx_hook(&tx) || (tx.length > 8U)) {
+            return CAN_SRV_ERROR;
+        }
+        msg = &tx;
     }
     
-    /* Copy data */
-    uint32_t *data_ptr = (uint32_t *)&s_can_instance->RAMn[CAN_TX_MB * 4 + 2];
-    uint32_t data_word1 = 0, data_word2 = 0;
+    basepri = NVIC_EnterCritical();
     
-    for (uint8_t i = 0; i < msg->length; i++) {
-        if (i < 4) {
-            data_word1 |= ((uint32_t)msg->data[i] << (24 - i * 8));
-        } else {
-            data_word2 |= ((uint32_t)msg->data[i] << (56 - i * 8));
-        }
+    /* Message cũ trong queue đi trước, giữ thứ tự FIFO (cũng là đường drain khi không dùng ISR) */
+    CAN_SRV_DrainTx(ctx);
+    
+    mb = CAN_NO_MB;
+    if (LFQ_SpscCount(&ctx->tx_queue) == 0U) {
+        mb = CAN_SRV_FindFreeTxMb(ctx->base);
     }
     
-    data_ptr[0] = data_word1;
-    data_ptr[1] = data_word2;
+    if (mb != CAN_NO_MB) {
+        CAN_SRV_WriteMailbox(ctx->base, mb, msg);
+    } else if (!LFQ_SpscPush(&ctx->tx_queue, msg)) {
+        status = CAN_SRV_ERROR;
+    }
     
-    /* Activate transmission */
-    s_can_instance->RAMn[CAN_TX_MB * 4] = cs;
+    NVIC_ExitCritical(basepri);
     
-    return CAN_SRV_SUCCESS;
+    return status;
 }
 
-can_srv_status_t CAN_SRV_Receive(can_srv_message_t *msg)
+can_srv_status_t CAN_SRV_Receive(can_srv_instance_t instance, can_srv_message_t *msg)
 {
-    if (!s_can_initialized) {
+    can_srv_ctx_t *ctx = CAN_SRV_GetCtx(instance);
+    
+    if (ctx == NULL) {
         return CAN_SRV_NOT_INITIALIZED;
     }
     
@@ -207,66 +453,197 @@ can_srv_status_t CAN_SRV_Receive(can_srv_message_t *msg)
         return CAN_SRV_ERROR;
     }
     
-    /* Check if RX MB has data */
-    uint32_t iflag = s_can_instance->IFLAG1;
-    if (!(iflag & (1U << CAN_RX_MB))) {
-        return CAN_SRV_ERROR; /* No message available */
-    }
+    /* ISR là producer duy nhất: không đọc RX MB trực tiếp (ISR có thể preempt giữa chừng) */
+    do {
+        if (!LFQ_SpscPop(&ctx->rx_queue, msg)) {
+            return CAN_SRV_ERROR; /* No message available */
+        }
+    } while (!CAN_SRV_ApplyRxHook(ctx, msg));
     
-    /* Lock the mailbox by reading control/status word */
-    uint32_t cs = s_can_instance->RAMn[CAN_RX_MB * 4];
+    /* Call user callback if registered */
+    if (ctx->rx_callback != NULL) {
+        ctx->rx_callback(msg);
+    }
     
-    /* Read ID */
-    uint32_t id_word = s_can_instance->RAMn[CAN_RX_MB * 4 + 1];
+    return CAN_SRV_SUCCESS;
+}
+
+can_srv_status_t CAN_SRV_RegisterCallback(can_srv_instance_t instance, can_srv_rx_callback_t callback)
+{
+    can_srv_ctx_t *ctx = CAN_SRV_GetCtx(instance);
     
-    if (cs & 0x00200000) { /* IDE = 1 */
-        msg->isExtended = true;
-        msg->id = (id_word >> 1) & 0x1FFFFFFF;
-    } else {
-        msg->isExtended = false;
-        msg->id = (id_word >> 18) & 0x7FF;
+    if (ctx == NULL) {
+        return CAN_SRV_NOT_INITIALIZED;
     }
     
-    /* Read length */
-    msg->length = (cs >> 16) & 0x0F;
-    if (msg->length > 8) {
-        msg->length = 8;
-    }
+    ctx->rx_callback = callback;
     
-    /* Read data */
-    uint32_t *data_ptr = (uint32_t *)&s_can_instance->RAMn[CAN_RX_MB * 4 + 2];
-    uint32_t data_word1 = data_ptr[0];
-    uint32_t data_word2 = data_ptr[1];
+    return CAN_SRV_SUCCESS;
+}
+
+can_srv_status_t CAN_SRV_RegisterHooks(can_srv_instance_t instance,
+                                       can_srv_tx_hook_t tx_hook, can_srv_rx_hook_t rx_hook)
+{
+    can_srv_ctx_t *ctx = CAN_SRV_GetCtx(instance);
     
-    for (uint8_t i = 0; i < msg->length; i++) {
-        if (i < 4) {
-            msg->data[i] = (uint8_t)(data_word1 >> (24 - i * 8));
-        } else {
-            msg->data[i] = (uint8_t)(data_word2 >> (56 - i * 8));
-        }
+    if (ctx == NULL) {
+        return CAN_SRV_NOT_INITIALIZED;
     }
     
-    /* Unlock mailbox by reading free running timer */
-    (void)s_can_instance->TIMER;
+    ctx->tx_hook = tx_hook;
+    ctx->rx_hook = rx_hook;
     
-    /* Clear interrupt flag */
-    s_can_instance->IFLAG1 = (1U << CAN_RX_MB);
+    return CAN_SRV_SUCCESS;
+}
+
+can_srv_status_t CAN_SRV_RegisterRawRxHook(can_srv_instance_t instance, can_srv_raw_rx_hook_t hook)
+{
+    can_srv_ctx_t *ctx = CAN_SRV_GetCtx(instance);
     
-    /* Call user callback if registered */
-    if (s_rx_callback != NULL) {
-        s_rx_callback(msg);
+    if (ctx == NULL) {
+        return CAN_SRV_NOT_INITIALIZED;
     }
     
+    ctx->raw_rx_hook = hook;
+    
     return CAN_SRV_SUCCESS;
 }
 
-can_srv_status_t CAN_SRV_RegisterCallback(can_srv_rx_callback_t callback)
+uint32_t CAN_SRV_GetRxRejectCount(can_srv_instance_t instance)
 {
-    if (!s_can_initialized) {
+    can_srv_ctx_t *ctx = CAN_SRV_GetCtx(instance);
+    
+    return (ctx != NULL) ? ctx->rx_rejected : 0U;
+}
+
+can_srv_status_t CAN_SRV_RegisterTimeSource(can_srv_time_source_t source)
+{
+    s_time_source = source;
+    
+    return CAN_SRV_SUCCESS;
+}
+
+can_srv_status_t CAN_SRV_ReceiveBatch(can_srv_instance_t instance, can_srv_message_t *msgs,
+                                      uint32_t max_count, uint32_t *count)
+{
+    can_srv_ctx_t *ctx = CAN_SRV_GetCtx(instance);
+    uint32_t n = 0U;
+    
+    if (ctx == NULL) {
         return CAN_SRV_NOT_INITIALIZED;
     }
     
-    s_rx_callback = callback;
+    if (msgs == NULL || count == NULL) {
+        return CAN_SRV_ERROR;
+    }
+    
+    while ((n < max_count) && LFQ_SpscPop(&ctx->rx_queue, &msgs[n])) {
+        /* Frame bị hook từ chối: slot được dùng lại cho message kế tiếp */
+        if (CAN_SRV_ApplyRxHook(ctx, &msgs[n])) {
+            n++;
+        }
+    }
+    
+    *count = n;
     
     return CAN_SRV_SUCCESS;
 }
+
+const can_srv_message_t *CAN_SRV_PeekRx(can_srv_instance_t instance)
+{
+    can_srv_ctx_t *ctx = CAN_SRV_GetCtx(instance);
+    
+    if (ctx == NULL) {
+        return NULL;
+    }
+    
+    return (const can_srv_message_t *)LFQ_SpscPeekRead(&ctx->rx_queue);
+}
+
+void CAN_SRV_ReleaseRx(can_srv_instance_t instance)
+{
+    can_srv_ctx_t *ctx = CAN_SRV_GetCtx(instance);
+    
+    /* Release khi ring rỗng sẽ làm lệch tail */
+    if ((ctx != NULL) && (LFQ_SpscPeekRead(&ctx->rx_queue) != NULL)) {
+        LFQ_SpscCommitRead(&ctx->rx_queue);
+    }
+}
+
+uint32_t CAN_SRV_GetRxOverflowCount(can_srv_instance_t instance)
+{
+    can_srv_ctx_t *ctx = CAN_SRV_GetCtx(instance);
+    
+    return (ctx != NULL) ? ctx->rx_overflow : 0U;
+}
+
+bool CAN_SRV_IsInitialized(can_srv_instance_t instance)
+{
+    return (CAN_SRV_GetCtx(instance) != NULL);
+}
+
+uint32_t CAN_SRV_GetTxQueueCount(can_srv_instance_t instance)
+{
+    can_srv_ctx_t *ctx = CAN_SRV_GetCtx(instance);
+    
+    return (ctx != NULL) ? LFQ_SpscCount(&ctx->tx_queue) : 0U;
+}
+
+/*******************************************************************************
+ * Interrupt Handlers (User should implement in application)
+ ******************************************************************************/
+
+/**
+ * @brief CANx MB0-15 interrupt handler
+ * @note User should call this from CANx_ORed_0_15_MB_IRQHandler() in application
+ */
+void CAN_SRV_IRQHandler(can_srv_instance_t instance)
+{
+    can_srv_ctx_t *ctx = CAN_SRV_GetCtx(instance);
+    can_srv_message_t *slot;
+    can_srv_raw_rx_hook_t hook;
+    uint32_t words[4];
+    uint32_t basepri;
+    uint32_t iflag;
+    uint16_t now;
+    
+    if (ctx == NULL) {
+        return;
+    }
+    
+    iflag = ctx->base->IFLAG1;
+    
+    if ((iflag & CAN_TX_MB_MASK) != 0U) {
+        /* TX done: clear flag trước, rồi nạp MB rảnh từ queue */
+        ctx->base->IFLAG1 = iflag & CAN_TX_MB_MASK;
+        
+        /* Send() ở priority cao hơn cũng nạp MB: drain trong critical section */
+        basepri = NVIC_EnterCritical();
+        CAN_SRV_DrainTx(ctx);
+        NVIC_ExitCritical(basepri);
+    }
+    
+    if (!(iflag & (1U << CAN_SRV_RX_MB))) {
+        return;
+    }
+    
+    now = CAN_SRV_ReadMailboxWords(ctx->base, words);
+    
+    /* Raw hook (vd. gateway) xử lý frame ngay trên mailbox words, không giải mã */
+    hook = ctx->raw_rx_hook;
+    if ((hook != NULL) && hook(instance, words)) {
+        return;
+    }
+    
+    slot = (can_srv_message_t *)LFQ_SpscReserveWrite(&ctx->rx_queue);
+    
+    if (slot == NULL) {
+        /* Ring đầy: mailbox đã được giải phóng, message bị drop */
+        ctx->rx_overflow++;
+        return;
+    }
+    
+    /* Giải mã thẳng vào slot, publish sau khi đã ghi đầy đủ dữ liệu */
+    CAN_SRV_Unpack(ctx, words, now, slot);
+    LFQ_SpscCommitWrite(&ctx->rx_queue);
+}
@@ -4,8 +4,8 @@
  * @details Enhanced implementation với flexible configuration
  * 
  * @author  PhucPH32
- * @date    05/12/2025
- * @version 2.0
+ * @date    14/10/2026
+ * @version 2.1
  */
 
 /*******************************************************************************
@@ -14,6 +14,7 @@
 #include "../inc/clock_srv_v2.h"
 #include "../../../../Core/BareMetal/scg/scg.h"
 #include "../../../../Core/BareMetal/pcc/pcc.h"
+#include "clock_manager.h"
 #include <string.h>
 
 /*******************************************************************************
@@ -23,6 +24,59 @@ static bool s_clock_initialized = false;
 static clock_srv_v2_config_t s_current_config;
 static clock_srv_v2_frequencies_t s_current_freq;
 
+/*******************************************************************************
+ * Preset Table (validate lúc build)
+ ******************************************************************************/
+
+/* RUN 80 MHz: SOSC 8 MHz / 1 * 40 = VCO 320 MHz -> SPLL 160 MHz */
+CLOCK_SRV_V2_STATIC_ASSERT_SPLL(8000000UL, CLOCK_SRV_V2_SPLL_PREDIV_1, 40U);
+CLOCK_SRV_V2_STATIC_ASSERT_SYSCLK(CLOCK_SRV_V2_SPLL_OUT_HZ(8000000UL, CLOCK_SRV_V2_SPLL_PREDIV_1, 40U),
+                                  CLOCK_SRV_V2_DIV_2, CLOCK_SRV_V2_DIV_4, CLOCK_SRV_V2_DIV_8,
+                                  CLOCK_SRV_V2_LIMITS_RUN);
+
+/* RUN 48 MHz: FIRC */
+CLOCK_SRV_V2_STATIC_ASSERT_SYSCLK(48000000UL, CLOCK_SRV_V2_DIV_1, CLOCK_SRV_V2_DIV_1, CLOCK_SRV_V2_DIV_2,
+                                  CLOCK_SRV_V2_LIMITS_RUN);
+
+/* HSRUN 112 MHz: SOSC 8 MHz / 1 * 28 = VCO 224 MHz -> SPLL 112 MHz */
+CLOCK_SRV_V2_STATIC_ASSERT_SPLL(8000000UL, CLOCK_SRV_V2_SPLL_PREDIV_1, 28U);
+CLOCK_SRV_V2_STATIC_ASSERT_SYSCLK(CLOCK_SRV_V2_SPLL_OUT_HZ(8000000UL, CLOCK_SRV_V2_SPLL_PREDIV_1, 28U),
+                                  CLOCK_SRV_V2_DIV_1, CLOCK_SRV_V2_DIV_2, CLOCK_SRV_V2_DIV_4,
+                                  CLOCK_SRV_V2_LIMITS_HSRUN);
+
+/* VLPR 4 MHz: SIRC 8 MHz */
+CLOCK_SRV_V2_STATIC_ASSERT_SYSCLK(8000000UL, CLOCK_SRV_V2_DIV_2, CLOCK_SRV_V2_DIV_2, CLOCK_SRV_V2_DIV_8,
+                                  CLOCK_SRV_V2_LIMITS_VLPR);
+
+static const clock_srv_v2_config_t s_presets[CLOCK_SRV_V2_PRESET_COUNT] = {
+    [CLOCK_SRV_V2_PRESET_RUN_80MHZ] = {
+        .sosc = CLOCK_SRV_V2_SOSC_DEFAULT(),
+        .spll = CLOCK_SRV_V2_SPLL_80MHZ(),
+        .sys = { CLOCK_SRV_V2_SOURCE_SPLL, CLOCK_SRV_V2_DIV_2, CLOCK_SRV_V2_DIV_4, CLOCK_SRV_V2_DIV_8 }
+    },
+    [CLOCK_SRV_V2_PRESET_RUN_48MHZ] = {
+        .firc = CLOCK_SRV_V2_FIRC_DEFAULT(),
+        .sys = { CLOCK_SRV_V2_SOURCE_FIRC, CLOCK_SRV_V2_DIV_1, CLOCK_SRV_V2_DIV_1, CLOCK_SRV_V2_DIV_2 }
+    },
+    [CLOCK_SRV_V2_PRESET_HSRUN_112MHZ] = {
+        .sosc = CLOCK_SRV_V2_SOSC_DEFAULT(),
+        .spll = { true, CLOCK_SRV_V2_SPLL_PREDIV_1, 28U, CLOCK_SRV_V2_DIV_1, CLOCK_SRV_V2_DIV_2 },
+        .sys = { CLOCK_SRV_V2_SOURCE_SPLL, CLOCK_SRV_V2_DIV_1, CLOCK_SRV_V2_DIV_2, CLOCK_SRV_V2_DIV_4 }
+    },
+    [CLOCK_SRV_V2_PRESET_VLPR_4MHZ] = {
+        .sirc = { true, true, CLOCK_SRV_V2_DIV_1, CLOCK_SRV_V2_DIV_1 },
+        .sys = { CLOCK_SRV_V2_SOURCE_SIRC, CLOCK_SRV_V2_DIV_2, CLOCK_SRV_V2_DIV_2, CLOCK_SRV_V2_DIV_8 }
+    }
+};
+
+/* Tên preset cho CLOCK_SRV_V2_InitPreset() (API cũ) */
+static const char * const s_preset_names[CLOCK_SRV_V2_PRESET_COUNT] = {
+    [CLOCK_SRV_V2_PRESET_RUN_80MHZ]    = "RUN_80MHz",
+    [CLOCK_SRV_V2_PRESET_RUN_48MHZ]    = "RUN_48MHz",
+    [CLOCK_SRV_V2_PRESET_HSRUN_112MHZ] = "HSRUN_112MHz",
+    [CLOCK_SRV_V2_PRESET_VLPR_4MHZ]    = "VLPR_4MHz"
+};
+
 /*******************************************************************************
  * Private Functions
  ******************************************************************************/
@@ -71,10 +125,11 @@ static void UpdateFrequencies(void)
         s_current_freq.firc_hz = 0;
     }
     
-    /* Calculate SPLL frequency */
+    /* Calculate SPLL frequency (SPLL_CLK = VCO / 2) */
     if (s_current_config.spll.enable) {
-        uint32_t spll_input = s_current_freq.sosc_hz / (s_current_config.spll.prediv + 1);
-        s_current_freq.spll_hz = spll_input * s_current_config.spll.mult;
+        s_current_freq.spll_hz = CLOCK_SRV_V2_CalculateSPLLFreq(s_current_freq.sosc_hz,
+                                                                (uint8_t)s_current_config.spll.prediv,
+                                                                s_current_config.spll.mult);
     } else {
         s_current_freq.spll_hz = 0;
     }
@@ -143,9 +198,21 @@ clock_srv_v2_status_t CLOCK_SRV_V2_Init(const clock_srv_v2_config_t *config)
         return CLOCK_SRV_V2_INVALID_CONFIG;
     }
     
+    return CLOCK_SRV_V2_InitStatic(config);
+}
+
+clock_srv_v2_status_t CLOCK_SRV_V2_InitStatic(const clock_srv_v2_config_t *config)
+{
+    if (config == NULL) {
+        return CLOCK_SRV_V2_ERROR;
+    }
+    
     /* Save configuration */
     memcpy(&s_current_config, config, sizeof(clock_srv_v2_config_t));
     
+    /* Driver pause traffic trước khi clock đổi */
+    ClockManager_NotifyBeforeChange();
+    
     /* 1. Configure SOSC if enabled */
     if (config->sosc.enable) {
         scg_sosc_config_t sosc_cfg = {
@@ -200,59 +267,76 @@ clock_srv_v2_status_t CLOCK_SRV_V2_Init(const clock_srv_v2_config_t *config)
     
     s_clock_initialized = true;
     
+    /* Refresh cache, driver tính lại baud / timing (AFTER) */
+    ClockManager_Update();
+    
     return CLOCK_SRV_V2_SUCCESS;
 }
 
 clock_srv_v2_status_t CLOCK_SRV_V2_InitPreset(const char *preset_name)
 {
-    clock_srv_v2_config_t preset_cfg = {0};
-    
-    if (strcmp(preset_name, "RUN_80MHz") == 0) {
-        /* SOSC 8MHz -> SPLL x20 = 160MHz -> DIV2 = 80MHz */
-        preset_cfg.sosc = CLOCK_SRV_V2_SOSC_DEFAULT();
-        preset_cfg.spll = CLOCK_SRV_V2_SPLL_80MHZ();
-        preset_cfg.sys.source = CLOCK_SRV_V2_SOURCE_SPLL;
-        preset_cfg.sys.core_div = CLOCK_SRV_V2_DIV_1;
-        preset_cfg.sys.bus_div = CLOCK_SRV_V2_DIV_2;
-        preset_cfg.sys.slow_div = CLOCK_SRV_V2_DIV_2;
+    uint32_t i;
+    
+    if (preset_name == NULL) {
+        return CLOCK_SRV_V2_ERROR;
     }
-    else if (strcmp(preset_name, "RUN_48MHz") == 0) {
-        /* FIRC 48MHz */
-        preset_cfg.firc = CLOCK_SRV_V2_FIRC_DEFAULT();
-        preset_cfg.sys.source = CLOCK_SRV_V2_SOURCE_FIRC;
-        preset_cfg.sys.core_div = CLOCK_SRV_V2_DIV_1;
-        preset_cfg.sys.bus_div = CLOCK_SRV_V2_DIV_1;
-        preset_cfg.sys.slow_div = CLOCK_SRV_V2_DIV_2;
+    
+    for (i = 0U; i < (uint32_t)CLOCK_SRV_V2_PRESET_COUNT; i++) {
+        if (strcmp(preset_name, s_preset_names[i]) == 0) {
+            return CLOCK_SRV_V2_InitStatic(&s_presets[i]);
+        }
     }
-    else if (strcmp(preset_name, "HSRUN_112MHz") == 0) {
-        /* SOSC 8MHz / 2 * 28 = 112MHz */
-        preset_cfg.sosc = CLOCK_SRV_V2_SOSC_DEFAULT();
-        preset_cfg.spll.enable = true;
-        preset_cfg.spll.prediv = CLOCK_SRV_V2_SPLL_PREDIV_2;
-        preset_cfg.spll.mult = 28;
-        preset_cfg.spll.div1 = CLOCK_SRV_V2_DIV_1;
-        preset_cfg.spll.div2 = CLOCK_SRV_V2_DIV_2;
-        preset_cfg.sys.source = CLOCK_SRV_V2_SOURCE_SPLL;
-        preset_cfg.sys.core_div = CLOCK_SRV_V2_DIV_1;
-        preset_cfg.sys.bus_div = CLOCK_SRV_V2_DIV_2;
-        preset_cfg.sys.slow_div = CLOCK_SRV_V2_DIV_4;
+    
+    return CLOCK_SRV_V2_INVALID_CONFIG;
+}
+
+clock_srv_v2_status_t CLOCK_SRV_V2_InitPresetId(clock_srv_v2_preset_t preset)
+{
+    if ((uint32_t)preset >= (uint32_t)CLOCK_SRV_V2_PRESET_COUNT) {
+        return CLOCK_SRV_V2_INVALID_CONFIG;
     }
-    else if (strcmp(preset_name, "VLPR_4MHz") == 0) {
-        /* SIRC 8MHz / 2 = 4MHz */
-        preset_cfg.sirc.enable = true;
-        preset_cfg.sirc.use_8mhz = true;
-        preset_cfg.sirc.div1 = CLOCK_SRV_V2_DIV_1;
-        preset_cfg.sirc.div2 = CLOCK_SRV_V2_DIV_1;
-        preset_cfg.sys.source = CLOCK_SRV_V2_SOURCE_SIRC;
-        preset_cfg.sys.core_div = CLOCK_SRV_V2_DIV_2;
-        preset_cfg.sys.bus_div = CLOCK_SRV_V2_DIV_2;
-        preset_cfg.sys.slow_div = CLOCK_SRV_V2_DIV_2;
+    
+    /* Preset đã qua _Static_assert, bỏ runtime validation */
+    return CLOCK_SRV_V2_InitStatic(&s_presets[preset]);
+}
+
+clock_srv_v2_status_t CLOCK_SRV_V2_SwitchSystemClock(clock_srv_v2_source_t source)
+{
+    clock_srv_v2_config_t new_cfg;
+    
+    if (!s_clock_initialized) {
+        return CLOCK_SRV_V2_NOT_INITIALIZED;
     }
-    else {
+    
+    /* Source mới phải đang enable */
+    memcpy(&new_cfg, &s_current_config, sizeof(clock_srv_v2_config_t));
+    new_cfg.sys.source = source;
+    if (CLOCK_SRV_V2_ValidateConfig(&new_cfg) != CLOCK_SRV_V2_SUCCESS) {
         return CLOCK_SRV_V2_INVALID_CONFIG;
     }
     
-    return CLOCK_SRV_V2_Init(&preset_cfg);
+    if (source == s_current_config.sys.source) {
+        return CLOCK_SRV_V2_SUCCESS;
+    }
+    
+    /* BEFORE: UART / CAN dừng traffic trên divider cũ */
+    ClockManager_NotifyBeforeChange();
+    
+    s_current_config.sys.source = source;
+    scg_rccr_config_t sys_cfg = {
+        .scs = (scg_system_clock_src_t)source,
+        .divcore = ConvertDivider(s_current_config.sys.core_div),
+        .divbus = ConvertDivider(s_current_config.sys.bus_div),
+        .divslow = ConvertDivider(s_current_config.sys.slow_div)
+    };
+    SCG_SysClkConfig(&sys_cfg);
+    
+    UpdateFrequencies();
+    
+    /* AFTER: UART SBR, CAN timing, SysTick reload theo clock mới */
+    ClockManager_Update();
+    
+    return CLOCK_SRV_V2_SUCCESS;
 }
 
 clock_srv_v2_status_t CLOCK_SRV_V2_GetFrequencies(clock_srv_v2_frequencies_t *freq)
@@ -308,7 +392,7 @@ clock_srv_v2_status_t CLOCK_SRV_V2_ValidateConfig(const clock_srv_v2_config_t *c
         return CLOCK_SRV_V2_ERROR;
     }
     
-    /* Check SPLL configuration */
+    /* Check SPLL configuration (cùng rule với CLOCK_SRV_V2_STATIC_ASSERT_SPLL) */
     if (config->spll.enable) {
         if (config->spll.mult < 16 || config->spll.mult > 47) {
             return CLOCK_SRV_V2_INVALID_CONFIG;
@@ -316,6 +400,10 @@ clock_srv_v2_status_t CLOCK_SRV_V2_ValidateConfig(const clock_srv_v2_config_t *c
         if (!config->sosc.enable) {
             return CLOCK_SRV_V2_INVALID_CONFIG; /* SPLL needs SOSC */
         }
+        uint32_t vco = CLOCK_SRV_V2_SPLL_VCO_HZ(config->sosc.freq_hz, config->spll.prediv, config->spll.mult);
+        if ((vco < CLOCK_SRV_V2_SPLL_VCO_MIN_HZ) || (vco > CLOCK_SRV_V2_SPLL_VCO_MAX_HZ)) {
+            return CLOCK_SRV_V2_INVALID_CONFIG;
+        }
     }
     
     /* Check system clock source is enabled */
@@ -356,5 +444,5 @@ clock_srv_v2_status_t CLOCK_SRV_V2_GetConfig(clock_srv_v2_config_t *config)
 
 uint32_t CLOCK_SRV_V2_CalculateSPLLFreq(uint32_t sosc_freq, uint8_t prediv, uint8_t mult)
 {
-    return (sosc_freq / (prediv + 1)) * mult;
+    return CLOCK_SRV_V2_SPLL_OUT_HZ(sosc_freq, prediv, mult);
 }
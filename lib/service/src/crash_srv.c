@@ -0,0 +1,251 @@
+/**
+ * @file    crash_srv.c
+ * @brief   Crash Service Layer Implementation
+ * @details Implementation của fault handler (frame từ MSP / PSP), capture
+ *          fault status registers + trace tail và dump qua UART
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../inc/crash_srv.h"
+#include "nvic.h"
+#include <stddef.h>
+#include <stdio.h>
+#if CRASH_SRV_TRACE_ENABLE
+#include "trace_srv.h"
+#endif
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+
+/* Exception frame (word index) */
+#define CRASH_SRV_FRAME_R0          (0U)
+#define CRASH_SRV_FRAME_R1          (1U)
+#define CRASH_SRV_FRAME_R2          (2U)
+#define CRASH_SRV_FRAME_R3          (3U)
+#define CRASH_SRV_FRAME_R12         (4U)
+#define CRASH_SRV_FRAME_LR          (5U)
+#define CRASH_SRV_FRAME_PC          (6U)
+#define CRASH_SRV_FRAME_XPSR        (7U)
+
+/* Basic frame 8 words, FP frame thêm S0-S15, FPSCR, reserved */
+#define CRASH_SRV_FRAME_BASIC_SIZE  (0x20UL)
+#define CRASH_SRV_FRAME_FP_SIZE     (0x68UL)
+
+#define CRASH_SRV_EXC_RETURN_FTYPE  (0x00000010UL)  /* 0 = FP frame */
+#define CRASH_SRV_XPSR_ALIGN        (0x00000200UL)  /* Frame được align thêm 4 bytes */
+#define CRASH_SRV_IPSR_MASK         (0x000001FFUL)
+
+/* CFSR: lỗi trong lúc stacking, frame không có giá trị */
+#define CRASH_SRV_CFSR_MSTKERR      (0x00000010UL)
+#define CRASH_SRV_CFSR_STKERR       (0x00001000UL)
+
+/* Số word được checksum (magic .. trace[]) */
+#define CRASH_SRV_SUM_WORDS         (offsetof(crash_srv_record_t, checksum) / sizeof(uint32_t))
+
+#define CRASH_SRV_LINE_SIZE         (96U)
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static crash_srv_record_t s_record __attribute__((section(CRASH_SRV_SECTION)));
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static uint32_t CRASH_SRV_Sum(const crash_srv_record_t *record)
+{
+    const uint32_t *word = (const uint32_t *)record;
+    uint32_t sum = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < CRASH_SRV_SUM_WORDS; i++) {
+        sum += word[i];
+    }
+
+    return ~sum;
+}
+
+static bool CRASH_SRV_IsValid(void)
+{
+    return (s_record.magic == CRASH_SRV_MAGIC) && (s_record.checksum == CRASH_SRV_Sum(&s_record)) &&
+           (s_record.trace_words <= CRASH_SRV_TRACE_WORDS);
+}
+
+/* Gọi từ CRASH_SRV_FaultHandler: frame = MSP / PSP lúc vào handler */
+static void __attribute__((used, noreturn)) CRASH_SRV_Capture(const uint32_t *frame, uint32_t exc_return)
+{
+    uint32_t count = CRASH_SRV_IsValid() ? s_record.fault_count : 0U;
+    uint32_t ipsr;
+    uint32_t sp;
+
+    __asm volatile ("mrs %0, ipsr" : "=r" (ipsr));
+
+    s_record.magic = CRASH_SRV_MAGIC;
+    s_record.fault_count = count + 1U;
+    s_record.exception = ipsr & CRASH_SRV_IPSR_MASK;
+    s_record.exc_return = exc_return;
+    s_record.cfsr = SCB->CFSR;
+    s_record.hfsr = SCB->HFSR;
+    s_record.mmfar = SCB->MMFAR;
+    s_record.bfar = SCB->BFAR;
+
+    if ((s_record.cfsr & (CRASH_SRV_CFSR_MSTKERR | CRASH_SRV_CFSR_STKERR)) == 0U) {
+        s_record.frame_valid = 1U;
+        s_record.r0 = frame[CRASH_SRV_FRAME_R0];
+        s_record.r1 = frame[CRASH_SRV_FRAME_R1];
+        s_record.r2 = frame[CRASH_SRV_FRAME_R2];
+        s_record.r3 = frame[CRASH_SRV_FRAME_R3];
+        s_record.r12 = frame[CRASH_SRV_FRAME_R12];
+        s_record.lr = frame[CRASH_SRV_FRAME_LR];
+        s_record.pc = frame[CRASH_SRV_FRAME_PC];
+        s_record.xpsr = frame[CRASH_SRV_FRAME_XPSR];
+
+        sp = (uint32_t)frame + (((exc_return & CRASH_SRV_EXC_RETURN_FTYPE) != 0U) ?
+                                CRASH_SRV_FRAME_BASIC_SIZE : CRASH_SRV_FRAME_FP_SIZE);
+        if ((s_record.xpsr & CRASH_SRV_XPSR_ALIGN) != 0U) {
+            sp += 4U;
+        }
+        s_record.sp = sp;
+    } else {
+        /* Stack pointer không trỏ tới vùng hợp lệ, không đọc frame */
+        s_record.frame_valid = 0U;
+        s_record.r0 = 0U;
+        s_record.r1 = 0U;
+        s_record.r2 = 0U;
+        s_record.r3 = 0U;
+        s_record.r12 = 0U;
+        s_record.lr = 0U;
+        s_record.pc = 0U;
+        s_record.xpsr = 0U;
+        s_record.sp = (uint32_t)frame;
+    }
+
+#if CRASH_SRV_TRACE_ENABLE
+    s_record.trace_words = TRACE_SRV_CopyTail(s_record.trace, CRASH_SRV_TRACE_WORDS);
+#else
+    s_record.trace_words = 0U;
+#endif
+
+    s_record.checksum = CRASH_SRV_Sum(&s_record);
+
+    __asm volatile ("dsb" ::: "memory");
+    NVIC_SystemReset();
+
+    for (;;) {
+    }
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+crash_srv_status_t CRASH_SRV_Init(void)
+{
+    if ((NVIC_InstallHandler(HardFault_IRQn, CRASH_SRV_FaultHandler) != NVIC_STATUS_SUCCESS) ||
+        (NVIC_InstallHandler(MemoryManagement_IRQn, CRASH_SRV_FaultHandler) != NVIC_STATUS_SUCCESS) ||
+        (NVIC_InstallHandler(BusFault_IRQn, CRASH_SRV_FaultHandler) != NVIC_STATUS_SUCCESS) ||
+        (NVIC_InstallHandler(UsageFault_IRQn, CRASH_SRV_FaultHandler) != NVIC_STATUS_SUCCESS)) {
+        return CRASH_SRV_ERROR;
+    }
+
+    (void)NVIC_EnableFaultHandlers(true, true, true);
+
+    return CRASH_SRV_SUCCESS;
+}
+
+bool CRASH_SRV_HasRecord(void)
+{
+    return CRASH_SRV_IsValid();
+}
+
+crash_srv_status_t CRASH_SRV_GetRecord(crash_srv_record_t *record)
+{
+    if (record == NULL) {
+        return CRASH_SRV_ERROR;
+    }
+
+    if (!CRASH_SRV_IsValid()) {
+        return CRASH_SRV_NO_RECORD;
+    }
+
+    *record = s_record;
+
+    return CRASH_SRV_SUCCESS;
+}
+
+void CRASH_SRV_Clear(void)
+{
+    s_record.magic = 0U;
+    s_record.fault_count = 0U;
+    s_record.checksum = 0U;
+}
+
+crash_srv_status_t CRASH_SRV_Dump(LPUART_RegType *base)
+{
+    char line[CRASH_SRV_LINE_SIZE];
+    uint32_t i;
+    int len;
+
+    if (base == NULL) {
+        return CRASH_SRV_ERROR;
+    }
+
+    if (!CRASH_SRV_IsValid()) {
+        return CRASH_SRV_NO_RECORD;
+    }
+
+    len = snprintf(line, sizeof(line), "crash: exception %lu, count %lu, frame %s\r\n",
+                   (unsigned long)s_record.exception, (unsigned long)s_record.fault_count,
+                   (s_record.frame_valid != 0U) ? "ok" : "lost");
+    (void)UART_SendBlocking(base, (const uint8_t *)line, (uint32_t)len);
+
+    len = snprintf(line, sizeof(line), "pc   %08lx lr   %08lx xpsr %08lx sp   %08lx\r\n",
+                   (unsigned long)s_record.pc, (unsigned long)s_record.lr,
+                   (unsigned long)s_record.xpsr, (unsigned long)s_record.sp);
+    (void)UART_SendBlocking(base, (const uint8_t *)line, (uint32_t)len);
+
+    len = snprintf(line, sizeof(line), "r0   %08lx r1   %08lx r2   %08lx r3   %08lx r12 %08lx\r\n",
+                   (unsigned long)s_record.r0, (unsigned long)s_record.r1, (unsigned long)s_record.r2,
+                   (unsigned long)s_record.r3, (unsigned long)s_record.r12);
+    (void)UART_SendBlocking(base, (const uint8_t *)line, (uint32_t)len);
+
+    len = snprintf(line, sizeof(line), "cfsr %08lx hfsr %08lx mmfar %08lx bfar %08lx exc %08lx\r\n",
+                   (unsigned long)s_record.cfsr, (unsigned long)s_record.hfsr,
+                   (unsigned long)s_record.mmfar, (unsigned long)s_record.bfar,
+                   (unsigned long)s_record.exc_return);
+    (void)UART_SendBlocking(base, (const uint8_t *)line, (uint32_t)len);
+
+    /* Trace tail: 8 word mỗi dòng, little-endian như trên ring */
+    for (i = 0U; i < s_record.trace_words; i += 8U) {
+        uint32_t j;
+
+        len = snprintf(line, sizeof(line), "trace");
+        for (j = i; (j < (i + 8U)) && (j < s_record.trace_words); j++) {
+            len += snprintf(&line[len], sizeof(line) - (uint32_t)len, " %08lx",
+                            (unsigned long)s_record.trace[j]);
+        }
+        len += snprintf(&line[len], sizeof(line) - (uint32_t)len, "\r\n");
+        (void)UART_SendBlocking(base, (const uint8_t *)line, (uint32_t)len);
+    }
+
+    return CRASH_SRV_SUCCESS;
+}
+
+/* Frame nằm trên MSP hoặc PSP tùy EXC_RETURN bit 2 */
+__attribute__((naked)) void CRASH_SRV_FaultHandler(void)
+{
+    __asm volatile ("tst   lr, #4\n\t"
+                    "ite   eq\n\t"
+                    "mrseq r0, msp\n\t"
+                    "mrsne r0, psp\n\t"
+                    "mov   r1, lr\n\t"
+                    "b     CRASH_SRV_Capture");
+}
@@ -0,0 +1,560 @@
+/**
+ * @file    datalog_srv.c
+ * @brief   Datalog Service Implementation
+ * @details ISR copy record raw vào capture ring, Process nén vào hai block
+ *          RAM luân phiên, block đầy được program bằng FTFC async
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../inc/datalog_srv.h"
+#include "ftfc.h"
+#include "nvic.h"
+#include <string.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+#define DATALOG_SRV_CAPTURE_MASK        (DATALOG_SRV_CAPTURE_WORDS - 1U)
+#define DATALOG_SRV_BLOCK_WORDS         (DATALOG_SRV_BLOCK_SIZE / 4U)
+#define DATALOG_SRV_HEADER_SIZE         ((uint32_t)sizeof(datalog_srv_block_header_t))
+#define DATALOG_SRV_NO_BLOCK            (0xFFU)
+
+/* Raw record: word 0 = type[31:28] | words[27:24] | aux[23:16] | count[7:0],
+   word 1 = timestamp, rồi payload */
+#define DATALOG_SRV_RAW_HEADER_WORDS    (2U)
+#define DATALOG_SRV_CAN_WORDS           (4U)
+
+/* Worst case sau nén: tag + varint(dt) + 16 x zigzag 17 bit (3 byte) */
+#define DATALOG_SRV_MAX_ENCODED         (1U + 5U + (DATALOG_SRV_MAX_ADC_CHANNELS * 3U))
+
+/* FlexCAN CS: IDE [21], RTR [20], DLC [19:16] */
+#define DATALOG_SRV_CS_FLAGS_SHIFT      (16U)
+#define DATALOG_SRV_CS_FLAGS_MASK       (0x3FU)
+#define DATALOG_SRV_CS_DLC_MASK         (0x0FU)
+
+#if ((DATALOG_SRV_CAPTURE_WORDS & DATALOG_SRV_CAPTURE_MASK) != 0U)
+#error "DATALOG_SRV_CAPTURE_WORDS must be a power of 2"
+#endif
+
+#if ((DATALOG_SRV_BLOCK_SIZE % FTFC_PHRASE_SIZE) != 0U) || \
+    ((FTFC_DFLASH_SECTOR_SIZE % DATALOG_SRV_BLOCK_SIZE) != 0U) || \
+    (DATALOG_SRV_BLOCK_SIZE < (16U + DATALOG_SRV_MAX_ENCODED))
+#error "DATALOG_SRV_BLOCK_SIZE must be a phrase multiple dividing the sector size"
+#endif
+
+typedef enum {
+    DATALOG_SRV_OP_NONE = 0,
+    DATALOG_SRV_OP_ERASE,
+    DATALOG_SRV_OP_PROGRAM
+} datalog_srv_op_t;
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+/* Capture ring: nhiều producer (ISR) dưới critical section, một consumer */
+static uint32_t s_capture[DATALOG_SRV_CAPTURE_WORDS];
+static volatile uint32_t s_cap_head = 0U;           /* Word index, producers */
+static volatile uint32_t s_cap_tail = 0U;           /* Word index, Process */
+static volatile uint32_t s_dropped = 0U;
+static volatile bool s_capturing = false;
+
+/* Block đang điền và block chờ / đang program */
+static uint32_t s_blocks[2][DATALOG_SRV_BLOCK_WORDS];
+static uint8_t s_fill = 0U;
+static uint8_t s_pending = DATALOG_SRV_NO_BLOCK;
+static uint32_t s_fill_used = DATALOG_SRV_HEADER_SIZE;
+static uint32_t s_fill_timestamp = 0U;
+static uint32_t s_last_timestamp = 0U;
+static int32_t s_prev_adc[DATALOG_SRV_MAX_ADC_CHANNELS];
+static bool s_flush_request = false;
+
+/* Flash */
+static datalog_srv_config_t s_config;
+static uint32_t s_sector_size = FTFC_DFLASH_SECTOR_SIZE;
+static uint32_t s_write_addr = 0U;
+static uint32_t s_sequence = 0U;
+static bool s_sector_ready = false;                 /* Sector của s_write_addr đã erase */
+static bool s_flash_full = false;
+static datalog_srv_op_t s_op = DATALOG_SRV_OP_NONE;
+static volatile bool s_op_done = false;
+static volatile status_t s_op_status = STATUS_SUCCESS;
+
+static datalog_srv_stats_t s_stats;
+static bool s_initialized = false;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static void DATALOG_SRV_OnFlashDone(status_t status, void *user_data)
+{
+    (void)user_data;
+
+    s_op_status = status;
+    s_op_done = true;
+}
+
+/**
+ * @brief Ghi record raw vào capture ring (ISR-safe, không chờ)
+ */
+static void DATALOG_SRV_Capture(uint32_t type, uint32_t aux, uint32_t count,
+                                const uint32_t *payload, uint32_t words)
+{
+    uint32_t timestamp;
+    uint32_t basepri;
+    uint32_t head;
+    uint32_t i;
+
+    if (!s_capturing) {
+        return;
+    }
+
+    timestamp = (s_config.time_source != NULL) ? s_config.time_source() : 0U;
+
+    basepri = NVIC_EnterCritical();
+
+    head = s_cap_head;
+    if ((DATALOG_SRV_CAPTURE_WORDS - (head - s_cap_tail)) < (DATALOG_SRV_RAW_HEADER_WORDS + words)) {
+        s_dropped++;
+        NVIC_ExitCritical(basepri);
+        return;
+    }
+
+    s_capture[head & DATALOG_SRV_CAPTURE_MASK] = (type << 28) | (words << 24) | (aux << 16) | count;
+    s_capture[(head + 1U) & DATALOG_SRV_CAPTURE_MASK] = timestamp;
+    for (i = 0U; i < words; i++) {
+        s_capture[(head + DATALOG_SRV_RAW_HEADER_WORDS + i) & DATALOG_SRV_CAPTURE_MASK] = payload[i];
+    }
+    s_cap_head = head + DATALOG_SRV_RAW_HEADER_WORDS + words;
+
+    NVIC_ExitCritical(basepri);
+}
+
+static inline uint32_t DATALOG_SRV_PutVarint(uint8_t *dst, uint32_t value)
+{
+    uint32_t n = 0U;
+
+    while (value >= 0x80U) {
+        dst[n++] = (uint8_t)(value | 0x80U);
+        value >>= 7;
+    }
+    dst[n++] = (uint8_t)value;
+
+    return n;
+}
+
+static inline uint32_t DATALOG_SRV_ZigZag(int32_t value)
+{
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+/**
+ * @brief Bắt đầu block mới: delta state về 0, block tự decode được
+ */
+static void DATALOG_SRV_ResetFill(void)
+{
+    s_fill_used = DATALOG_SRV_HEADER_SIZE;
+    memset(s_prev_adc, 0, sizeof(s_prev_adc));
+}
+
+/**
+ * @brief Đóng block đang điền, chuyển sang block còn lại
+ */
+static void DATALOG_SRV_Seal(void)
+{
+    uint8_t *block = (uint8_t *)s_blocks[s_fill];
+    datalog_srv_block_header_t header;
+
+    header.magic = DATALOG_SRV_BLOCK_MAGIC;
+    header.sequence = s_sequence++;
+    header.timestamp = s_fill_timestamp;
+    header.used = (uint16_t)s_fill_used;
+    header.version = DATALOG_SRV_BLOCK_VERSION;
+    header.reserved = 0xFFU;
+
+    memcpy(block, &header, sizeof(header));
+    memset(&block[s_fill_used], 0xFF, DATALOG_SRV_BLOCK_SIZE - s_fill_used);
+
+    s_pending = s_fill;
+    s_fill ^= 1U;
+    DATALOG_SRV_ResetFill();
+}
+
+/**
+ * @brief Nén một record raw (tại tail) vào block đang điền
+ */
+static void DATALOG_SRV_Encode(uint32_t tail)
+{
+    uint8_t *dst = &((uint8_t *)s_blocks[s_fill])[s_fill_used];
+    uint32_t hdr = s_capture[tail & DATALOG_SRV_CAPTURE_MASK];
+    uint32_t timestamp = s_capture[(tail + 1U) & DATALOG_SRV_CAPTURE_MASK];
+    uint32_t type = hdr >> 28;
+    uint32_t aux = (hdr >> 16) & 0xFFU;
+    uint32_t count = hdr & 0xFFU;
+    uint32_t p = tail + DATALOG_SRV_RAW_HEADER_WORDS;
+    uint32_t n = 0U;
+    uint32_t word;
+    uint32_t flags;
+    uint32_t dlc;
+    int32_t value;
+    uint32_t i;
+
+    if (s_fill_used == DATALOG_SRV_HEADER_SIZE) {
+        s_fill_timestamp = timestamp;
+        s_last_timestamp = timestamp;
+    }
+
+    if (type == DATALOG_SRV_TYPE_ADC) {
+        dst[n++] = (uint8_t)(DATALOG_SRV_TYPE_ADC | ((count - 1U) << 4));
+        n += DATALOG_SRV_PutVarint(&dst[n], timestamp - s_last_timestamp);
+        for (i = 0U; i < count; i++) {
+            word = s_capture[(p + (i >> 1)) & DATALOG_SRV_CAPTURE_MASK];
+            value = (int32_t)((word >> ((i & 1U) * 16U)) & 0xFFFFU);
+            n += DATALOG_SRV_PutVarint(&dst[n], DATALOG_SRV_ZigZag(value - s_prev_adc[i]));
+            s_prev_adc[i] = value;
+        }
+    } else {
+        /* CAN: CS, ID, DATA0, DATA1 (data big-endian như mailbox) */
+        flags = (s_capture[p & DATALOG_SRV_CAPTURE_MASK] >> DATALOG_SRV_CS_FLAGS_SHIFT) &
+                DATALOG_SRV_CS_FLAGS_MASK;
+        dlc = flags & DATALOG_SRV_CS_DLC_MASK;
+        if (dlc > 8U) {
+            dlc = 8U;
+        }
+
+        dst[n++] = (uint8_t)(DATALOG_SRV_TYPE_CAN | (aux << 4));
+        n += DATALOG_SRV_PutVarint(&dst[n], timestamp - s_last_timestamp);
+        n += DATALOG_SRV_PutVarint(&dst[n], s_capture[(p + 1U) & DATALOG_SRV_CAPTURE_MASK]);
+        dst[n++] = (uint8_t)flags;
+        for (i = 0U; i < dlc; i++) {
+            word = s_capture[(p + 2U + (i >> 2)) & DATALOG_SRV_CAPTURE_MASK];
+            dst[n++] = (uint8_t)(word >> (24U - ((i & 3U) * 8U)));
+        }
+    }
+
+    s_last_timestamp = timestamp;
+    s_fill_used += n;
+
+    s_stats.records++;
+    s_stats.raw_bytes += (DATALOG_SRV_RAW_HEADER_WORDS * 4U) + ((type == DATALOG_SRV_TYPE_ADC) ? (count * 2U) : 16U);
+    s_stats.encoded_bytes += n;
+}
+
+/**
+ * @brief Write pointer sang block kế tiếp, wrap hoặc đánh dấu full
+ */
+static void DATALOG_SRV_AdvanceWrite(uint32_t bytes)
+{
+    s_write_addr += bytes;
+    if (s_write_addr >= (s_config.flash_start + s_config.flash_size)) {
+        if (s_config.wrap) {
+            s_write_addr = s_config.flash_start;
+        } else {
+            s_flash_full = true;
+        }
+    }
+
+    if ((s_write_addr % s_sector_size) == 0U) {
+        s_sector_ready = false;
+    }
+}
+
+/**
+ * @brief State machine erase / program, một lệnh FTFC mỗi lần
+ */
+static void DATALOG_SRV_ServiceFlash(void)
+{
+    status_t status;
+
+    if (s_op != DATALOG_SRV_OP_NONE) {
+        if (!s_op_done) {
+            return;
+        }
+
+        s_op_done = false;
+        if (s_op == DATALOG_SRV_OP_ERASE) {
+            if (s_op_status == STATUS_SUCCESS) {
+                s_sector_ready = true;
+            } else {
+                /* Sector lỗi: bỏ qua, thử sector kế tiếp */
+                s_stats.flash_errors++;
+                DATALOG_SRV_AdvanceWrite(s_sector_size);
+            }
+        } else {
+            if (s_op_status == STATUS_SUCCESS) {
+                s_stats.blocks_written++;
+            } else {
+                s_stats.flash_errors++;
+                s_stats.blocks_lost++;
+            }
+            s_pending = DATALOG_SRV_NO_BLOCK;
+            DATALOG_SRV_AdvanceWrite(DATALOG_SRV_BLOCK_SIZE);
+        }
+        s_op = DATALOG_SRV_OP_NONE;
+    }
+
+    if (s_pending == DATALOG_SRV_NO_BLOCK) {
+        return;
+    }
+
+    if (s_flash_full) {
+        /* wrap = false: dừng capture, block cuối không còn chỗ */
+        s_capturing = false;
+        s_stats.blocks_lost++;
+        s_pending = DATALOG_SRV_NO_BLOCK;
+        return;
+    }
+
+    /* STATUS_BUSY: FTFC đang chạy lệnh của module khác, thử lại lần sau */
+    if (!s_sector_ready) {
+        status = FTFC_EraseSectorAsync(s_write_addr, DATALOG_SRV_OnFlashDone, NULL);
+        if (status == STATUS_SUCCESS) {
+            s_op = DATALOG_SRV_OP_ERASE;
+        }
+    } else {
+        status = FTFC_ProgramAsync(s_write_addr, s_blocks[s_pending], DATALOG_SRV_BLOCK_SIZE,
+                                   DATALOG_SRV_OnFlashDone, NULL);
+        if (status == STATUS_SUCCESS) {
+            s_op = DATALOG_SRV_OP_PROGRAM;
+        }
+    }
+
+    if ((status != STATUS_SUCCESS) && (status != STATUS_BUSY)) {
+        s_stats.flash_errors++;
+        s_stats.blocks_lost++;
+        s_pending = DATALOG_SRV_NO_BLOCK;
+    }
+}
+
+static bool DATALOG_SRV_IsBlank(uint32_t address, uint32_t size)
+{
+    const volatile uint32_t *p = (const volatile uint32_t *)address;
+    uint32_t i;
+
+    for (i = 0U; i < (size / 4U); i++) {
+        if (p[i] != 0xFFFFFFFFUL) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Tìm điểm ghi tiếp: sau block có sequence lớn nhất
+ */
+static void DATALOG_SRV_FindAppendPoint(void)
+{
+    const datalog_srv_block_header_t *header;
+    uint32_t end = s_config.flash_start + s_config.flash_size;
+    uint32_t last = 0U;
+    uint32_t addr;
+    uint32_t sector_end;
+    bool found = false;
+
+    for (addr = s_config.flash_start; addr < end; addr += DATALOG_SRV_BLOCK_SIZE) {
+        header = (const datalog_srv_block_header_t *)addr;
+        if ((header->magic == DATALOG_SRV_BLOCK_MAGIC) &&
+            (!found || ((int32_t)(header->sequence - s_sequence) >= 0))) {
+            s_sequence = header->sequence;
+            last = addr;
+            found = true;
+        }
+    }
+
+    s_write_addr = s_config.flash_start;
+    s_sector_ready = false;
+    s_flash_full = false;
+
+    if (!found) {
+        s_sequence = 0U;
+        return;
+    }
+
+    s_sequence++;
+    s_write_addr = last;
+    DATALOG_SRV_AdvanceWrite(DATALOG_SRV_BLOCK_SIZE);
+    if (s_flash_full || ((s_write_addr % s_sector_size) == 0U)) {
+        return;
+    }
+
+    /* Giữa sector: chỉ ghi tiếp nếu phần còn lại chưa bị ghi dở */
+    sector_end = (s_write_addr - (s_write_addr % s_sector_size)) + s_sector_size;
+    if (DATALOG_SRV_IsBlank(s_write_addr, sector_end - s_write_addr)) {
+        s_sector_ready = true;
+    } else {
+        DATALOG_SRV_AdvanceWrite(sector_end - s_write_addr);
+    }
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+datalog_srv_status_t DATALOG_SRV_Start(const datalog_srv_config_t *config)
+{
+    uint32_t start;
+    uint32_t end;
+
+    if (config == NULL) {
+        return DATALOG_SRV_ERROR;
+    }
+
+    if (s_capturing || !DATALOG_SRV_IsIdle()) {
+        return DATALOG_SRV_BUSY;
+    }
+
+    start = config->flash_start;
+    end = start + config->flash_size;
+    if ((start >= FTFC_DFLASH_BASE) && (end <= (FTFC_DFLASH_BASE + FTFC_DFLASH_SIZE)) && (end > start)) {
+        s_sector_size = FTFC_DFLASH_SECTOR_SIZE;
+#if FTFC_ASYNC_PFLASH_ENABLE
+    } else if ((end <= (FTFC_PFLASH_BASE + FTFC_PFLASH_SIZE)) && (end > start)) {
+        s_sector_size = FTFC_PFLASH_SECTOR_SIZE;
+#endif
+    } else {
+        return DATALOG_SRV_ERROR;
+    }
+
+    if (((start % s_sector_size) != 0U) || ((config->flash_size % s_sector_size) != 0U)) {
+        return DATALOG_SRV_ERROR;
+    }
+
+    s_config = *config;
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_dropped = 0U;
+    s_cap_head = 0U;
+    s_cap_tail = 0U;
+    s_fill = 0U;
+    s_pending = DATALOG_SRV_NO_BLOCK;
+    s_flush_request = false;
+    s_op = DATALOG_SRV_OP_NONE;
+    s_op_done = false;
+    DATALOG_SRV_ResetFill();
+
+    DATALOG_SRV_FindAppendPoint();
+    s_initialized = true;
+
+    if (s_flash_full) {
+        return DATALOG_SRV_FULL;
+    }
+
+    s_capturing = true;
+
+    return DATALOG_SRV_SUCCESS;
+}
+
+datalog_srv_status_t DATALOG_SRV_Stop(void)
+{
+    if (!s_initialized) {
+        return DATALOG_SRV_NOT_INITIALIZED;
+    }
+
+    s_capturing = false;
+    s_flush_request = true;
+
+    return DATALOG_SRV_SUCCESS;
+}
+
+void DATALOG_SRV_LogAdc(const uint16_t *values, uint8_t count)
+{
+    uint32_t payload[DATALOG_SRV_MAX_ADC_CHANNELS / 2U];
+    uint32_t i;
+
+    if ((values == NULL) || (count == 0U) || (count > DATALOG_SRV_MAX_ADC_CHANNELS)) {
+        return;
+    }
+
+    for (i = 0U; i < count; i += 2U) {
+        payload[i >> 1] = (uint32_t)values[i] |
+                          (((i + 1U) < count) ? ((uint32_t)values[i + 1U] << 16) : 0U);
+    }
+
+    DATALOG_SRV_Capture(DATALOG_SRV_TYPE_ADC, 0U, count, payload, ((uint32_t)count + 1U) >> 1);
+}
+
+void DATALOG_SRV_LogCan(can_srv_instance_t instance, const uint32_t *mb_words)
+{
+    if ((mb_words == NULL) || ((uint32_t)instance >= CAN_SRV_INSTANCE_COUNT)) {
+        return;
+    }
+
+    DATALOG_SRV_Capture(DATALOG_SRV_TYPE_CAN, (uint32_t)instance, 0U, mb_words, DATALOG_SRV_CAN_WORDS);
+}
+
+bool DATALOG_SRV_CanRawHook(can_srv_instance_t instance, const uint32_t *mb_words)
+{
+    DATALOG_SRV_LogCan(instance, mb_words);
+
+    return false;
+}
+
+void DATALOG_SRV_Process(void)
+{
+    uint32_t tail;
+    uint32_t hdr;
+    uint32_t n;
+
+    if (!s_initialized) {
+        return;
+    }
+
+    DATALOG_SRV_ServiceFlash();
+
+    tail = s_cap_tail;
+    for (n = 0U; (n < DATALOG_SRV_RECORDS_PER_PROCESS) && (tail != s_cap_head); n++) {
+        if ((s_fill_used + DATALOG_SRV_MAX_ENCODED) > DATALOG_SRV_BLOCK_SIZE) {
+            if (s_pending != DATALOG_SRV_NO_BLOCK) {
+                break;                              /* Cả hai block bận: record chờ trong capture ring */
+            }
+            DATALOG_SRV_Seal();
+            DATALOG_SRV_ServiceFlash();
+        }
+
+        hdr = s_capture[tail & DATALOG_SRV_CAPTURE_MASK];
+        DATALOG_SRV_Encode(tail);
+        tail += DATALOG_SRV_RAW_HEADER_WORDS + ((hdr >> 24) & 0xFU);
+        s_cap_tail = tail;
+    }
+
+    if (s_flush_request && (tail == s_cap_head) && (s_pending == DATALOG_SRV_NO_BLOCK)) {
+        s_flush_request = false;
+        if (s_fill_used > DATALOG_SRV_HEADER_SIZE) {
+            DATALOG_SRV_Seal();
+            DATALOG_SRV_ServiceFlash();
+        }
+    }
+}
+
+void DATALOG_SRV_Flush(void)
+{
+    s_flush_request = true;
+}
+
+bool DATALOG_SRV_IsIdle(void)
+{
+    return (s_cap_tail == s_cap_head) && (s_pending == DATALOG_SRV_NO_BLOCK) &&
+           (s_op == DATALOG_SRV_OP_NONE) && !s_flush_request;
+}
+
+datalog_srv_status_t DATALOG_SRV_GetStats(datalog_srv_stats_t *stats)
+{
+    if (stats == NULL) {
+        return DATALOG_SRV_ERROR;
+    }
+
+    if (!s_initialized) {
+        return DATALOG_SRV_NOT_INITIALIZED;
+    }
+
+    *stats = s_stats;
+    stats->dropped = s_dropped;
+
+    return DATALOG_SRV_SUCCESS;
+}
@@ -0,0 +1,189 @@
+/**
+ * @file    debounce_srv.c
+ * @brief   Debounce Service Implementation
+ * @details PORT ISR tắt IRQC của pin và start soft timer, timer callback đọc
+ *          lại pin, báo level mới rồi bật lại interrupt
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../inc/debounce_srv.h"
+#include "nvic.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static PORT_Type * const s_port_bases[DEBOUNCE_SRV_PORT_COUNT] = PORT_BASE_PTRS;
+
+/* Input theo (port, pin), NULL = pin không thuộc service */
+static debounce_srv_input_t *s_inputs[DEBOUNCE_SRV_PORT_COUNT][DEBOUNCE_SRV_PINS_PER_PORT];
+
+/* Bit mỗi pin đã đăng ký: ISR chỉ clear ISF của các pin này */
+static volatile uint32_t s_port_mask[DEBOUNCE_SRV_PORT_COUNT];
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static void DEBOUNCE_SRV_Report(debounce_srv_input_t *input, bool level)
+{
+    if (level == input->level) {
+        return;
+    }
+
+    input->level = level;
+    if (input->callback != NULL) {
+        input->callback(input, level, input->user_data);
+    }
+}
+
+/**
+ * @brief Timer hết hạn: pin đã ổn định debounce_ms
+ */
+static void DEBOUNCE_SRV_OnTimer(timer_srv_timer_t *timer, void *user_data)
+{
+    debounce_srv_input_t *input = (debounce_srv_input_t *)user_data;
+    bool level;
+
+    (void)timer;
+
+    if (s_inputs[input->port][input->pin] != input) {
+        return;
+    }
+
+    level = GPIO_PinRead(input->gpio);
+
+    /* Bật lại interrupt (RMW PCR cũng clear ISF cũ), rồi đọc lại: edge giữa
+       lần đọc và lúc bật không set ISF nên phải tự phát hiện */
+    PORT_SetPinInterrupt(input->port, input->pin, PORT_INT_EITHER_EDGE);
+    if (GPIO_PinRead(input->gpio) != level) {
+        PORT_SetPinInterrupt(input->port, input->pin, PORT_INT_DISABLED);
+        (void)TIMER_SRV_Start(&input->timer, input->ticks, 0U, DEBOUNCE_SRV_OnTimer, input);
+        return;
+    }
+
+    DEBOUNCE_SRV_Report(input, level);
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+debounce_srv_status_t DEBOUNCE_SRV_Add(debounce_srv_input_t *input, const debounce_srv_config_t *config)
+{
+    uint32_t basepri;
+
+    if ((input == NULL) || (config == NULL) ||
+        ((uint32_t)config->port >= DEBOUNCE_SRV_PORT_COUNT) ||
+        (config->pin >= DEBOUNCE_SRV_PINS_PER_PORT) ||
+        ((config->debounce_ms == 0U) && !config->hw_filter)) {
+        return DEBOUNCE_SRV_ERROR;
+    }
+
+    input->ticks = (config->debounce_ms != 0U) ? TIMER_SRV_MS_TO_TICKS(config->debounce_ms) : 0U;
+    if (input->ticks > TIMER_SRV_MAX_TICKS) {
+        return DEBOUNCE_SRV_ERROR;
+    }
+
+    basepri = NVIC_EnterCritical();
+    if (s_inputs[config->port][config->pin] != NULL) {
+        NVIC_ExitCritical(basepri);
+        return DEBOUNCE_SRV_BUSY;
+    }
+    s_inputs[config->port][config->pin] = input;
+    NVIC_ExitCritical(basepri);
+
+    input->gpio.base = GPIO_PORT_BASE(config->port);
+    input->gpio.mask = GPIO_PIN(config->pin);
+    input->callback = config->callback;
+    input->user_data = config->user_data;
+    input->port = config->port;
+    input->pin = config->pin;
+    input->timer.active = false;                    /* Object mới, chưa link vào wheel */
+
+    GPIO_Init((gpio_port_t)config->port, config->pin, GPIO_DIR_INPUT);
+    PORT_SetPullConfig(config->port, config->pin, config->pull);
+    if (config->hw_filter) {
+        PORT_EnableDigitalFilter(config->port, config->pin);
+    } else {
+        PORT_DisableDigitalFilter(config->port, config->pin);
+    }
+
+    input->level = GPIO_PinRead(input->gpio);
+
+    basepri = NVIC_EnterCritical();
+    s_port_mask[config->port] |= (1UL << config->pin);
+    NVIC_ExitCritical(basepri);
+
+    PORT_SetPinInterrupt(config->port, config->pin, PORT_INT_EITHER_EDGE);
+
+    return DEBOUNCE_SRV_SUCCESS;
+}
+
+debounce_srv_status_t DEBOUNCE_SRV_Remove(debounce_srv_input_t *input)
+{
+    uint32_t basepri;
+
+    if ((input == NULL) || ((uint32_t)input->port >= DEBOUNCE_SRV_PORT_COUNT) ||
+        (input->pin >= DEBOUNCE_SRV_PINS_PER_PORT) || (s_inputs[input->port][input->pin] != input)) {
+        return DEBOUNCE_SRV_ERROR;
+    }
+
+    PORT_SetPinInterrupt(input->port, input->pin, PORT_INT_DISABLED);
+    TIMER_SRV_Stop(&input->timer);
+
+    basepri = NVIC_EnterCritical();
+    s_port_mask[input->port] &= ~(1UL << input->pin);
+    s_inputs[input->port][input->pin] = NULL;
+    NVIC_ExitCritical(basepri);
+
+    PORT_DisableDigitalFilter(input->port, input->pin);
+
+    return DEBOUNCE_SRV_SUCCESS;
+}
+
+bool DEBOUNCE_SRV_Read(const debounce_srv_input_t *input)
+{
+    return (input != NULL) && input->level;
+}
+
+void DEBOUNCE_SRV_PortIRQHandler(port_name_t port)
+{
+    PORT_Type *base;
+    debounce_srv_input_t *input;
+    uint32_t flags;
+    uint8_t pin;
+
+    if ((uint32_t)port >= DEBOUNCE_SRV_PORT_COUNT) {
+        return;
+    }
+
+    base = s_port_bases[port];
+    flags = base->ISFR & s_port_mask[port];
+    base->ISFR = flags;
+
+    while (flags != 0U) {
+        pin = (uint8_t)(31U - (uint32_t)__builtin_clz(flags));
+        flags &= ~(1UL << pin);
+
+        input = s_inputs[port][pin];
+        if (input == NULL) {
+            continue;
+        }
+
+        if (input->ticks == 0U) {
+            /* Chỉ digital filter: edge đã được hardware lọc */
+            DEBOUNCE_SRV_Report(input, GPIO_PinRead(input->gpio));
+        } else {
+            /* Tắt interrupt tới khi timer hết hạn: bounce không tạo IRQ nữa */
+            PORT_SetPinInterrupt(port, pin, PORT_INT_DISABLED);
+            (void)TIMER_SRV_Start(&input->timer, input->ticks, 0U, DEBOUNCE_SRV_OnTimer, input);
+        }
+    }
+}
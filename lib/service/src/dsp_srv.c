@@ -0,0 +1,341 @@
+/**
+ * @file    dsp_srv.c
+ * @brief   DSP Service Layer Implementation
+ * @details Implementation của fixed-point block kernels cho ADC buffers,
+ *          SMLAD / SSAT trên Cortex-M4, C fallback cho target khác
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../inc/dsp_srv.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define DSP_SRV_USE_ASM             (1U)
+#else
+#define DSP_SRV_USE_ASM             (0U)
+#endif
+
+/* SMLAD với (1, 1): cộng 2 halfword trong một instruction */
+#define DSP_SRV_PAIR_ONES           (0x00010001UL)
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/* acc + lo(x)*lo(y) + hi(x)*hi(y), halfwords signed */
+static inline int32_t DSP_SRV_Smlad(uint32_t x, uint32_t y, int32_t acc)
+{
+#if DSP_SRV_USE_ASM
+    int32_t result;
+
+    __asm ("smlad %0, %1, %2, %3" : "=r" (result) : "r" (x), "r" (y), "r" (acc));
+
+    return result;
+#else
+    return acc + ((int32_t)(int16_t)x * (int32_t)(int16_t)y) +
+           ((int32_t)(int16_t)(x >> 16) * (int32_t)(int16_t)(y >> 16));
+#endif
+}
+
+/* Saturate to int16 range */
+static inline int16_t DSP_SRV_Ssat16(int32_t x)
+{
+#if DSP_SRV_USE_ASM
+    int32_t result;
+
+    __asm ("ssat %0, #16, %1" : "=r" (result) : "r" (x));
+
+    return (int16_t)result;
+#else
+    if (x > 32767) {
+        return 32767;
+    }
+    if (x < -32768) {
+        return -32768;
+    }
+    return (int16_t)x;
+#endif
+}
+
+static inline uint32_t DSP_SRV_Pack(int16_t lo, int16_t hi)
+{
+    return (uint32_t)(uint16_t)lo | ((uint32_t)(uint16_t)hi << 16);
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+dsp_srv_status_t DSP_SRV_RawToQ15(const uint16_t *src, dsp_srv_q15_t *dst, uint32_t n,
+                                  uint8_t resolution_bits, uint16_t offset)
+{
+    uint32_t shift;
+    uint32_t i;
+
+    if ((src == NULL) || (dst == NULL) || (resolution_bits == 0U) || (resolution_bits > 15U)) {
+        return DSP_SRV_ERROR;
+    }
+
+    shift = 15U - resolution_bits;
+    for (i = 0U; i < n; i++) {
+        dst[i] = DSP_SRV_Ssat16(((int32_t)src[i] - (int32_t)offset) * (int32_t)(1UL << shift));
+    }
+
+    return DSP_SRV_SUCCESS;
+}
+
+uint32_t DSP_SRV_MillivoltGainQ16(uint32_t vref_mv, uint8_t resolution_bits)
+{
+    if ((resolution_bits == 0U) || (resolution_bits > 16U)) {
+        return 0U;
+    }
+
+    /* Divide một lần ở đây thay vì mỗi sample */
+    return (uint32_t)(((uint64_t)vref_mv << 16) / ((1UL << resolution_bits) - 1U));
+}
+
+void DSP_SRV_RawToMillivolts(const uint16_t *src, uint16_t *dst, uint32_t n, uint32_t gain_q16)
+{
+    uint32_t i;
+
+    if ((src == NULL) || (dst == NULL)) {
+        return;
+    }
+
+    for (i = 0U; i < n; i++) {
+        dst[i] = (uint16_t)((((uint32_t)src[i] * gain_q16) + 0x8000U) >> 16);
+    }
+}
+
+void DSP_SRV_ScaleQ15(const dsp_srv_q15_t *src, dsp_srv_q15_t *dst, uint32_t n,
+                      dsp_srv_q15_t scale, uint8_t shift)
+{
+    uint32_t rshift;
+    uint32_t i;
+
+    if ((src == NULL) || (dst == NULL) || (shift > 15U)) {
+        return;
+    }
+
+    rshift = 15U - shift;
+    for (i = 0U; i < n; i++) {
+        dst[i] = DSP_SRV_Ssat16(((int32_t)src[i] * (int32_t)scale) >> rshift);
+    }
+}
+
+void DSP_SRV_ScaleQ31(const dsp_srv_q31_t *src, dsp_srv_q31_t *dst, uint32_t n,
+                      dsp_srv_q31_t scale, uint8_t shift)
+{
+    uint32_t rshift;
+    uint32_t i;
+    int64_t product;
+
+    if ((src == NULL) || (dst == NULL) || (shift > 31U)) {
+        return;
+    }
+
+    rshift = 31U - shift;
+    for (i = 0U; i < n; i++) {
+        /* SMULL + shift; saturate chỉ cần khi shift > 0 hoặc -1 * -1 */
+        product = ((int64_t)src[i] * (int64_t)scale) >> rshift;
+        if (product > (int64_t)INT32_MAX) {
+            dst[i] = INT32_MAX;
+        } else if (product < (int64_t)INT32_MIN) {
+            dst[i] = INT32_MIN;
+        } else {
+            dst[i] = (dsp_srv_q31_t)product;
+        }
+    }
+}
+
+dsp_srv_status_t DSP_SRV_MovingAverageInit(dsp_srv_mavg_t *state, dsp_srv_q15_t *history,
+                                           uint8_t window_log2)
+{
+    uint32_t i;
+
+    if ((state == NULL) || (history == NULL) || (window_log2 > 15U)) {
+        return DSP_SRV_ERROR;
+    }
+
+    for (i = 0U; i < (1UL << window_log2); i++) {
+        history[i] = 0;
+    }
+
+    state->history = history;
+    state->sum = 0;
+    state->index = 0U;
+    state->window_log2 = window_log2;
+
+    return DSP_SRV_SUCCESS;
+}
+
+void DSP_SRV_MovingAverageQ15(dsp_srv_mavg_t *state, const dsp_srv_q15_t *src,
+                              dsp_srv_q15_t *dst, uint32_t n)
+{
+    uint32_t mask;
+    uint32_t index;
+    int32_t sum;
+    dsp_srv_q15_t x;
+    uint32_t i;
+
+    if ((state == NULL) || (src == NULL) || (dst == NULL)) {
+        return;
+    }
+
+    mask = (1UL << state->window_log2) - 1U;
+    index = state->index;
+    sum = state->sum;
+
+    /* Running sum: 1 add + 1 sub mỗi sample, không phụ thuộc window size */
+    for (i = 0U; i < n; i++) {
+        x = src[i];
+        sum += (int32_t)x - (int32_t)state->history[index];
+        state->history[index] = x;
+        index = (index + 1U) & mask;
+        dst[i] = (dsp_srv_q15_t)(sum >> state->window_log2);
+    }
+
+    state->index = (uint16_t)index;
+    state->sum = sum;
+}
+
+dsp_srv_status_t DSP_SRV_LowPassInit(dsp_srv_lowpass_t *state, uint8_t shift, dsp_srv_q15_t initial)
+{
+    if ((state == NULL) || (shift == 0U) || (shift > 15U)) {
+        return DSP_SRV_ERROR;
+    }
+
+    state->y = (int32_t)initial * 65536;
+    state->shift = shift;
+
+    return DSP_SRV_SUCCESS;
+}
+
+void DSP_SRV_LowPassQ15(dsp_srv_lowpass_t *state, const dsp_srv_q15_t *src,
+                        dsp_srv_q15_t *dst, uint32_t n)
+{
+    int32_t y;
+    uint32_t i;
+
+    if ((state == NULL) || (src == NULL) || (dst == NULL)) {
+        return;
+    }
+
+    /* 16 bit thêm trong accumulator: shift lớn vẫn không mất step nhỏ */
+    y = state->y;
+    for (i = 0U; i < n; i++) {
+        y += (((int32_t)src[i] * 65536) - y) >> state->shift;
+        dst[i] = (dsp_srv_q15_t)(y >> 16);
+    }
+    state->y = y;
+}
+
+void DSP_SRV_BiquadInit(dsp_srv_biquad_t *state, int16_t b0, int16_t b1, int16_t b2,
+                        int16_t a1, int16_t a2)
+{
+    if (state == NULL) {
+        return;
+    }
+
+    state->b0_b1 = DSP_SRV_Pack(b0, b1);
+    state->b2_na1 = DSP_SRV_Pack(b2, (int16_t)-a1);
+    state->na2 = -(int32_t)a2;
+    state->x1 = 0;
+    state->x2 = 0;
+    state->y1 = 0;
+    state->y2 = 0;
+}
+
+void DSP_SRV_BiquadQ15(dsp_srv_biquad_t *state, const dsp_srv_q15_t *src,
+                       dsp_srv_q15_t *dst, uint32_t n)
+{
+    dsp_srv_q15_t x0;
+    dsp_srv_q15_t x1;
+    dsp_srv_q15_t x2;
+    dsp_srv_q15_t y1;
+    dsp_srv_q15_t y2;
+    int32_t acc;
+    uint32_t i;
+
+    if ((state == NULL) || (src == NULL) || (dst == NULL)) {
+        return;
+    }
+
+    x1 = state->x1;
+    x2 = state->x2;
+    y1 = state->y1;
+    y2 = state->y2;
+
+    for (i = 0U; i < n; i++) {
+        x0 = src[i];
+
+        acc = DSP_SRV_Smlad(state->b0_b1, DSP_SRV_Pack(x0, x1), 0);
+        acc = DSP_SRV_Smlad(state->b2_na1, DSP_SRV_Pack(x2, y1), acc);
+        acc += state->na2 * (int32_t)y2;
+
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = DSP_SRV_Ssat16(acc >> DSP_SRV_BIQUAD_FRAC_BITS);
+        dst[i] = y1;
+    }
+
+    state->x1 = x1;
+    state->x2 = x2;
+    state->y1 = y1;
+    state->y2 = y2;
+}
+
+dsp_srv_status_t DSP_SRV_DecimateQ15(const dsp_srv_q15_t *src, dsp_srv_q15_t *dst, uint32_t n,
+                                     uint8_t factor_log2)
+{
+    uint32_t factor;
+    uint32_t out;
+    uint32_t i;
+    uint32_t k;
+    int32_t sum;
+
+    if ((src == NULL) || (dst == NULL) || (factor_log2 == 0U) || (factor_log2 > 15U)) {
+        return DSP_SRV_ERROR;
+    }
+
+    factor = 1UL << factor_log2;
+    if ((n & (factor - 1U)) != 0U) {
+        return DSP_SRV_ERROR;
+    }
+
+    if (((uintptr_t)src & 3U) == 0U) {
+        /* Aligned: đọc 2 sample / word, một SMLAD cộng cả hai */
+        const uint32_t *pairs = (const uint32_t *)(const void *)src;
+
+        for (out = 0U; out < (n >> factor_log2); out++) {
+            sum = 0;
+            for (k = 0U; k < (factor >> 1); k++) {
+                sum = DSP_SRV_Smlad(*pairs, DSP_SRV_PAIR_ONES, sum);
+                pairs++;
+            }
+            dst[out] = (dsp_srv_q15_t)(sum >> factor_log2);
+        }
+    } else {
+        i = 0U;
+        for (out = 0U; out < (n >> factor_log2); out++) {
+            sum = 0;
+            for (k = 0U; k < factor; k++) {
+                sum += src[i];
+                i++;
+            }
+            dst[out] = (dsp_srv_q15_t)(sum >> factor_log2);
+        }
+    }
+
+    return DSP_SRV_SUCCESS;
+}
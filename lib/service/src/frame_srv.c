@@ -0,0 +1,327 @@
+/**
+ * @file    frame_srv.c
+ * @brief   Frame Service Layer Implementation
+ * @details Implementation của COBS framing + CRC-16, CRC qua hardware CRC
+ *          engine với lookup table fallback
+ * 
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.1
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../inc/frame_srv.h"
+#if FRAME_SRV_HW_CRC_ENABLE
+#include "crc.h"
+#endif
+#include <stddef.h>
+#include <string.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+#define FRAME_SRV_CRC_INIT          (0xFFFFU)
+#define FRAME_SRV_COBS_MAX_CODE     (0xFFU)
+
+/**
+ * @brief Output context cho FRAME_SRV_Encode()
+ */
+typedef struct {
+    uint8_t *out;
+    uint32_t size;
+    uint32_t len;
+    bool overflow;
+} frame_srv_mem_writer_t;
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+
+/* CRC-16/CCITT-FALSE lookup table (poly 0x1021): đoạn ngắn / engine bận */
+static const uint16_t s_crc16_table[256] = {
+    0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+    0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU,
+    0x1231U, 0x0210U, 0x3273U, 0x2252U, 0x52B5U, 0x4294U, 0x72F7U, 0x62D6U,
+    0x9339U, 0x8318U, 0xB37BU, 0xA35AU, 0xD3BDU, 0xC39CU, 0xF3FFU, 0xE3DEU,
+    0x2462U, 0x3443U, 0x0420U, 0x1401U, 0x64E6U, 0x74C7U, 0x44A4U, 0x5485U,
+    0xA56AU, 0xB54BU, 0x8528U, 0x9509U, 0xE5EEU, 0xF5CFU, 0xC5ACU, 0xD58DU,
+    0x3653U, 0x2672U, 0x1611U, 0x0630U, 0x76D7U, 0x66F6U, 0x5695U, 0x46B4U,
+    0xB75BU, 0xA77AU, 0x9719U, 0x8738U, 0xF7DFU, 0xE7FEU, 0xD79DU, 0xC7BCU,
+    0x48C4U, 0x58E5U, 0x6886U, 0x78A7U, 0x0840U, 0x1861U, 0x2802U, 0x3823U,
+    0xC9CCU, 0xD9EDU, 0xE98EU, 0xF9AFU, 0x8948U, 0x9969U, 0xA90AU, 0xB92BU,
+    0x5AF5U, 0x4AD4U, 0x7AB7U, 0x6A96U, 0x1A71U, 0x0A50U, 0x3A33U, 0x2A12U,
+    0xDBFDU, 0xCBDCU, 0xFBBFU, 0xEB9EU, 0x9B79U, 0x8B58U, 0xBB3BU, 0xAB1AU,
+    0x6CA6U, 0x7C87U, 0x4CE4U, 0x5CC5U, 0x2C22U, 0x3C03U, 0x0C60U, 0x1C41U,
+    0xEDAEU, 0xFD8FU, 0xCDECU, 0xDDCDU, 0xAD2AU, 0xBD0BU, 0x8D68U, 0x9D49U,
+    0x7E97U, 0x6EB6U, 0x5ED5U, 0x4EF4U, 0x3E13U, 0x2E32U, 0x1E51U, 0x0E70U,
+    0xFF9FU, 0xEFBEU, 0xDFDDU, 0xCFFCU, 0xBF1BU, 0xAF3AU, 0x9F59U, 0x8F78U,
+    0x9188U, 0x81A9U, 0xB1CAU, 0xA1EBU, 0xD10CU, 0xC12DU, 0xF14EU, 0xE16FU,
+    0x1080U, 0x00A1U, 0x30C2U, 0x20E3U, 0x5004U, 0x4025U, 0x7046U, 0x6067U,
+    0x83B9U, 0x9398U, 0xA3FBU, 0xB3DAU, 0xC33DU, 0xD31CU, 0xE37FU, 0xF35EU,
+    0x02B1U, 0x1290U, 0x22F3U, 0x32D2U, 0x4235U, 0x5214U, 0x6277U, 0x7256U,
+    0xB5EAU, 0xA5CBU, 0x95A8U, 0x8589U, 0xF56EU, 0xE54FU, 0xD52CU, 0xC50DU,
+    0x34E2U, 0x24C3U, 0x14A0U, 0x0481U, 0x7466U, 0x6447U, 0x5424U, 0x4405U,
+    0xA7DBU, 0xB7FAU, 0x8799U, 0x97B8U, 0xE75FU, 0xF77EU, 0xC71DU, 0xD73CU,
+    0x26D3U, 0x36F2U, 0x0691U, 0x16B0U, 0x6657U, 0x7676U, 0x4615U, 0x5634U,
+    0xD94CU, 0xC96DU, 0xF90EU, 0xE92FU, 0x99C8U, 0x89E9U, 0xB98AU, 0xA9ABU,
+    0x5844U, 0x4865U, 0x7806U, 0x6827U, 0x18C0U, 0x08E1U, 0x3882U, 0x28A3U,
+    0xCB7DU, 0xDB5CU, 0xEB3FU, 0xFB1EU, 0x8BF9U, 0x9BD8U, 0xABBBU, 0xBB9AU,
+    0x4A75U, 0x5A54U, 0x6A37U, 0x7A16U, 0x0AF1U, 0x1AD0U, 0x2AB3U, 0x3A92U,
+    0xFD2EU, 0xED0FU, 0xDD6CU, 0xCD4DU, 0xBDAAU, 0xAD8BU, 0x9DE8U, 0x8DC9U,
+    0x7C26U, 0x6C07U, 0x5C64U, 0x4C45U, 0x3CA2U, 0x2C83U, 0x1CE0U, 0x0CC1U,
+    0xEF1FU, 0xFF3EU, 0xCF5DU, 0xDF7CU, 0xAF9BU, 0xBFBAU, 0x8FD9U, 0x9FF8U,
+    0x6E17U, 0x7E36U, 0x4E55U, 0x5E74U, 0x2E93U, 0x3EB2U, 0x0ED1U, 0x1EF0U
+};
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static inline uint16_t FRAME_SRV_CrcByte(uint16_t crc, uint8_t data)
+{
+    return (uint16_t)((crc << 8) ^ s_crc16_table[((crc >> 8) ^ data) & 0xFFU]);
+}
+
+static void FRAME_SRV_FlushBlock(frame_srv_encoder_t *enc)
+{
+    enc->block[0] = (uint8_t)(enc->block_len + 1U);
+    enc->write(enc->block, (uint32_t)enc->block_len + 1U, enc->ctx);
+    enc->block_len = 0U;
+}
+
+static void FRAME_SRV_EncodeByte(frame_srv_encoder_t *enc, uint8_t data)
+{
+    if (data == FRAME_SRV_DELIMITER) {
+        /* Zero ends the block, code byte carries the distance */
+        FRAME_SRV_FlushBlock(enc);
+    } else {
+        enc->block[1U + enc->block_len] = data;
+        enc->block_len++;
+
+        /* Full block (code 0xFF) has no implicit zero */
+        if (enc->block_len == (FRAME_SRV_COBS_MAX_CODE - 1U)) {
+            FRAME_SRV_FlushBlock(enc);
+        }
+    }
+}
+
+static void FRAME_SRV_MemWrite(const uint8_t *data, uint32_t len, void *ctx)
+{
+    frame_srv_mem_writer_t *writer = (frame_srv_mem_writer_t *)ctx;
+
+    if ((writer->len + len) > writer->size) {
+        writer->overflow = true;
+        return;
+    }
+
+    memcpy(&writer->out[writer->len], data, len);
+    writer->len += len;
+}
+
+static void FRAME_SRV_DecoderRestart(frame_srv_decoder_t *dec)
+{
+    dec->len = 0U;
+    dec->crc = FRAME_SRV_CRC_INIT;
+    dec->code = 0U;
+    dec->remaining = 0U;
+}
+
+static void FRAME_SRV_DecoderStore(frame_srv_decoder_t *dec, uint8_t data)
+{
+    if (dec->len >= dec->buffer_size) {
+        dec->overflows++;
+        dec->discard = true;
+        return;
+    }
+
+    dec->buffer[dec->len] = data;
+    dec->len++;
+}
+
+static void FRAME_SRV_DecoderEndFrame(frame_srv_decoder_t *dec)
+{
+    if (dec->discard) {
+        dec->discard = false;
+    } else if (dec->code == 0U) {
+        /* Empty frame / back-to-back delimiters: resync, not an error */
+    } else if ((dec->remaining != 0U) || (dec->len < FRAME_SRV_CRC_SIZE) ||
+               ((dec->crc = FRAME_SRV_Crc16(FRAME_SRV_CRC_INIT, dec->buffer, dec->len)) != 0U)) {
+        /* CRC over payload + big-endian CRC leaves a zero residue */
+        dec->crc_errors++;
+    } else {
+        dec->frames_ok++;
+        if (dec->callback != NULL) {
+            dec->callback(dec->buffer, (uint16_t)(dec->len - FRAME_SRV_CRC_SIZE), dec->ctx);
+        }
+    }
+
+    FRAME_SRV_DecoderRestart(dec);
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+uint16_t FRAME_SRV_Crc16(uint16_t crc, const uint8_t *data, uint32_t len)
+{
+#if FRAME_SRV_HW_CRC_ENABLE
+    crc_config_t config = CRC_CONFIG_CRC16_CCITT_FALSE;
+    uint32_t result;
+#endif
+    uint32_t i;
+
+    if (data == NULL) {
+        return crc;
+    }
+
+#if FRAME_SRV_HW_CRC_ENABLE
+    /* Không truncate, không reflect: running CRC chính là seed của engine */
+    if (len >= FRAME_SRV_HW_CRC_MIN_LEN) {
+        config.seed = crc;
+        if (CRC_Compute(&config, data, len, &result) == STATUS_SUCCESS) {
+            return (uint16_t)result;
+        }
+    }
+#endif
+
+    for (i = 0U; i < len; i++) {
+        crc = FRAME_SRV_CrcByte(crc, data[i]);
+    }
+
+    return crc;
+}
+
+frame_srv_status_t FRAME_SRV_EncoderBegin(frame_srv_encoder_t *enc, frame_srv_write_t write, void *ctx)
+{
+    if ((enc == NULL) || (write == NULL)) {
+        return FRAME_SRV_ERROR;
+    }
+
+    enc->write = write;
+    enc->ctx = ctx;
+    enc->block_len = 0U;
+    enc->crc = FRAME_SRV_CRC_INIT;
+
+    return FRAME_SRV_SUCCESS;
+}
+
+frame_srv_status_t FRAME_SRV_EncoderPut(frame_srv_encoder_t *enc, const uint8_t *data, uint32_t len)
+{
+    uint32_t i;
+
+    if ((enc == NULL) || (enc->write == NULL) || ((data == NULL) && (len != 0U))) {
+        return FRAME_SRV_ERROR;
+    }
+
+    enc->crc = FRAME_SRV_Crc16(enc->crc, data, len);
+
+    for (i = 0U; i < len; i++) {
+        FRAME_SRV_EncodeByte(enc, data[i]);
+    }
+
+    return FRAME_SRV_SUCCESS;
+}
+
+frame_srv_status_t FRAME_SRV_EncoderEnd(frame_srv_encoder_t *enc)
+{
+    static const uint8_t delimiter = FRAME_SRV_DELIMITER;
+
+    if ((enc == NULL) || (enc->write == NULL)) {
+        return FRAME_SRV_ERROR;
+    }
+
+    FRAME_SRV_EncodeByte(enc, (uint8_t)(enc->crc >> 8));
+    FRAME_SRV_EncodeByte(enc, (uint8_t)(enc->crc & 0xFFU));
+
+    /* Last block is always flushed, even empty (code 0x01) */
+    FRAME_SRV_FlushBlock(enc);
+    enc->write(&delimiter, 1U, enc->ctx);
+
+    enc->write = NULL;
+
+    return FRAME_SRV_SUCCESS;
+}
+
+frame_srv_status_t FRAME_SRV_Encode(const uint8_t *payload, uint32_t len,
+                                    uint8_t *out, uint32_t out_size, uint32_t *out_len)
+{
+    frame_srv_encoder_t enc;
+    frame_srv_mem_writer_t writer;
+
+    if ((out == NULL) || (out_len == NULL) || ((payload == NULL) && (len != 0U))) {
+        return FRAME_SRV_ERROR;
+    }
+
+    writer.out = out;
+    writer.size = out_size;
+    writer.len = 0U;
+    writer.overflow = false;
+
+    (void)FRAME_SRV_EncoderBegin(&enc, FRAME_SRV_MemWrite, &writer);
+    (void)FRAME_SRV_EncoderPut(&enc, payload, len);
+    (void)FRAME_SRV_EncoderEnd(&enc);
+
+    *out_len = writer.len;
+
+    return writer.overflow ? FRAME_SRV_BUFFER_FULL : FRAME_SRV_SUCCESS;
+}
+
+frame_srv_status_t FRAME_SRV_DecoderInit(frame_srv_decoder_t *dec, uint8_t *buffer, uint16_t buffer_size,
+                                         frame_srv_frame_cb_t callback, void *ctx)
+{
+    if ((dec == NULL) || (buffer == NULL) || (buffer_size <= FRAME_SRV_CRC_SIZE)) {
+        return FRAME_SRV_ERROR;
+    }
+
+    dec->buffer = buffer;
+    dec->buffer_size = buffer_size;
+    dec->callback = callback;
+    dec->ctx = ctx;
+    dec->discard = false;
+    dec->frames_ok = 0U;
+    dec->crc_errors = 0U;
+    dec->overflows = 0U;
+    FRAME_SRV_DecoderRestart(dec);
+
+    return FRAME_SRV_SUCCESS;
+}
+
+void FRAME_SRV_DecoderFeed(frame_srv_decoder_t *dec, const uint8_t *data, uint32_t len)
+{
+    uint32_t i;
+    uint8_t byte;
+
+    if ((dec == NULL) || (data == NULL)) {
+        return;
+    }
+
+    for (i = 0U; i < len; i++) {
+        byte = data[i];
+
+        if (byte == FRAME_SRV_DELIMITER) {
+            FRAME_SRV_DecoderEndFrame(dec);
+        } else if (dec->discard) {
+            /* Wait for the next delimiter */
+        } else if (dec->remaining == 0U) {
+            /* New code byte: the previous block ended with an implicit zero */
+            if ((dec->code != 0U) && (dec->code != FRAME_SRV_COBS_MAX_CODE)) {
+                FRAME_SRV_DecoderStore(dec, 0U);
+            }
+            dec->code = byte;
+            dec->remaining = (uint8_t)(byte - 1U);
+        } else {
+            FRAME_SRV_DecoderStore(dec, byte);
+            dec->remaining--;
+        }
+    }
+}
+
+void FRAME_SRV_DecoderReset(frame_srv_decoder_t *dec)
+{
+    if (dec != NULL) {
+        FRAME_SRV_DecoderRestart(dec);
+        dec->discard = true;
+    }
+}
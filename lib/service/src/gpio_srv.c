@@ -298,87 +298,105 @@ gpio_srv_status_t GPIO_SRV_TogglePin(uint8_t port, uint8_t pin)
 }
 
 /*******************************************************************************
- * Interrupt Handlers (User should implement in application)
+ * Interrupt Handlers
  ******************************************************************************/
 
 /**
- * @brief PORT A interrupt handler
- * @note User should call this from PORTA_IRQHandler() in application
+ * @brief Dispatch mọi pin pending của một port
+ * @details Đọc ISFR một lần, clear bằng một lần write-one-to-clear rồi duyệt
+ *          các bit set bằng CLZ: thời gian tỷ lệ với số pin pending, không phụ
+ *          thuộc số pin của port. Edge đến trong lúc chạy callback set lại
+ *          ISFR nên IRQ pending lại.
  */
-void GPIO_SRV_PORTA_IRQHandler(void)
+static void GPIO_SRV_DispatchPort(uint8_t port)
 {
-    for (uint8_t pin = 0; pin < MAX_CALLBACKS; pin++) {
-        if (GPIO_SRV_IsInterruptPending(0, pin)) {
-            /* Execute callback if registered */
-            if (s_callbacks_porta[pin].enabled && s_callbacks_porta[pin].callback != NULL) {
-                s_callbacks_porta[pin].callback(0, pin);
-            }
-            /* Clear interrupt flag */
-            GPIO_SRV_ClearInterrupt(0, pin);
+    PORT_Type *port_base = GPIO_SRV_GetPORTBase(port);
+    gpio_callback_entry_t *callbacks = GPIO_SRV_GetCallbackArray(port);
+    uint32_t flags;
+    uint8_t pin;
+
+    flags = port_base->ISFR;
+    port_base->ISFR = flags;
+
+    while (flags != 0U) {
+        pin = (uint8_t)(31U - (uint32_t)__builtin_clz(flags));
+        flags &= ~(1UL << pin);
+
+        if (callbacks[pin].enabled && (callbacks[pin].callback != NULL)) {
+            callbacks[pin].callback(port, pin);
         }
     }
 }
 
+/**
+ * @brief PORT A interrupt handler
+ * @note Gọi từ PORTA_IRQHandler() của application, hoặc bật GPIO_SRV_PORT_IRQ_HANDLERS
+ */
+void GPIO_SRV_PORTA_IRQHandler(void)
+{
+    GPIO_SRV_DispatchPort(0);
+}
+
 /**
  * @brief PORT B interrupt handler
- * @note User should call this from PORTB_IRQHandler() in application
+ * @note Gọi từ PORTB_IRQHandler() của application, hoặc bật GPIO_SRV_PORT_IRQ_HANDLERS
  */
 void GPIO_SRV_PORTB_IRQHandler(void)
 {
-    for (uint8_t pin = 0; pin < MAX_CALLBACKS; pin++) {
-        if (GPIO_SRV_IsInterruptPending(1, pin)) {
-            if (s_callbacks_portb[pin].enabled && s_callbacks_portb[pin].callback != NULL) {
-                s_callbacks_portb[pin].callback(1, pin);
-            }
-            GPIO_SRV_ClearInterrupt(1, pin);
-        }
-    }
+    GPIO_SRV_DispatchPort(1);
 }
 
 /**
  * @brief PORT C interrupt handler
- * @note User should call this from PORTC_IRQHandler() in application
+ * @note Gọi từ PORTC_IRQHandler() của application, hoặc bật GPIO_SRV_PORT_IRQ_HANDLERS
  */
 void GPIO_SRV_PORTC_IRQHandler(void)
 {
-    for (uint8_t pin = 0; pin < MAX_CALLBACKS; pin++) {
-        if (GPIO_SRV_IsInterruptPending(2, pin)) {
-            if (s_callbacks_portc[pin].enabled && s_callbacks_portc[pin].callback != NULL) {
-                s_callbacks_portc[pin].callback(2, pin);
-            }
-            GPIO_SRV_ClearInterrupt(2, pin);
-        }
-    }
+    GPIO_SRV_DispatchPort(2);
 }
 
 /**
  * @brief PORT D interrupt handler
- * @note User should call this from PORTD_IRQHandler() in application
+ * @note Gọi từ PORTD_IRQHandler() của application, hoặc bật GPIO_SRV_PORT_IRQ_HANDLERS
  */
 void GPIO_SRV_PORTD_IRQHandler(void)
 {
-    for (uint8_t pin = 0; pin < MAX_CALLBACKS; pin++) {
-        if (GPIO_SRV_IsInterruptPending(3, pin)) {
-            if (s_callbacks_portd[pin].enabled && s_callbacks_portd[pin].callback != NULL) {
-                s_callbacks_portd[pin].callback(3, pin);
-            }
-            GPIO_SRV_ClearInterrupt(3, pin);
-        }
-    }
+    GPIO_SRV_DispatchPort(3);
 }
 
 /**
  * @brief PORT E interrupt handler
- * @note User should call this from PORTE_IRQHandler() in application
+ * @note Gọi từ PORTE_IRQHandler() của application, hoặc bật GPIO_SRV_PORT_IRQ_HANDLERS
  */
 void GPIO_SRV_PORTE_IRQHandler(void)
 {
-    for (uint8_t pin = 0; pin < MAX_CALLBACKS; pin++) {
-        if (GPIO_SRV_IsInterruptPending(4, pin)) {
-            if (s_callbacks_porte[pin].enabled && s_callbacks_porte[pin].callback != NULL) {
-                s_callbacks_porte[pin].callback(4, pin);
-            }
-            GPIO_SRV_ClearInterrupt(4, pin);
-        }
-    }
+    GPIO_SRV_DispatchPort(4);
+}
+
+#if (GPIO_SRV_PORT_IRQ_HANDLERS == 1U)
+/* Vector table entries: application không định nghĩa PORTx_IRQHandler nữa */
+void PORTA_IRQHandler(void)
+{
+    GPIO_SRV_DispatchPort(0);
+}
+
+void PORTB_IRQHandler(void)
+{
+    GPIO_SRV_DispatchPort(1);
+}
+
+void PORTC_IRQHandler(void)
+{
+    GPIO_SRV_DispatchPort(2);
+}
+
+void PORTD_IRQHandler(void)
+{
+    GPIO_SRV_DispatchPort(3);
+}
+
+void PORTE_IRQHandler(void)
+{
+    GPIO_SRV_DispatchPort(4);
 }
+#endif
@@ -0,0 +1,284 @@
+/**
+ * @file    gpio_wave_srv.c
+ * @brief   GPIO Waveform Service Implementation
+ * @details DMA channel với DMAMUX periodic trigger, source always-on: mỗi
+ *          trigger từ TRGMUX một minor loop = một sample vào GPIO register
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../inc/gpio_wave_srv.h"
+#include "dma.h"
+#include "lpit.h"
+#include "nvic.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+#define GPIO_WAVE_SRV_BITS_PER_BYTE     (8U)
+#define GPIO_WAVE_SRV_REG_BYTES         (4U)
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static volatile bool s_busy = false;
+static bool s_loop = false;
+static bool s_use_lpit = false;
+static uint8_t s_dma_channel = 0U;
+static uint8_t s_lpit_channel = 0U;
+
+static gpio_wave_srv_callback_t s_callback = NULL;
+static void *s_user_data = NULL;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief Địa chỉ byte lane của register đích
+ */
+static uint32_t GPIO_WAVE_SRV_TargetAddr(gpio_port_t port, gpio_wave_srv_reg_t target, uint8_t lane)
+{
+    GPIO_Type *base = GPIO_PORT_BASE(port);
+    uint32_t addr;
+
+    switch (target) {
+        case GPIO_WAVE_SRV_REG_PSOR:
+            addr = (uint32_t)&base->PSOR;
+            break;
+        case GPIO_WAVE_SRV_REG_PCOR:
+            addr = (uint32_t)&base->PCOR;
+            break;
+        case GPIO_WAVE_SRV_REG_PTOR:
+            addr = (uint32_t)&base->PTOR;
+            break;
+        default:
+            addr = (uint32_t)&base->PDOR;
+            break;
+    }
+
+    /* Little-endian: lane n = bit [8n + 7 : 8n] */
+    return addr + lane;
+}
+
+static dma_transfer_size_t GPIO_WAVE_SRV_TransferSize(gpio_wave_srv_width_t width)
+{
+    switch (width) {
+        case GPIO_WAVE_SRV_WIDTH_16:
+            return DMA_TRANSFER_SIZE_2B;
+        case GPIO_WAVE_SRV_WIDTH_32:
+            return DMA_TRANSFER_SIZE_4B;
+        default:
+            return DMA_TRANSFER_SIZE_1B;
+    }
+}
+
+/**
+ * @brief Tắt trigger và DMA request, giữ nguyên level pin
+ */
+static void GPIO_WAVE_SRV_Halt(void)
+{
+    if (s_use_lpit) {
+        (void)LPIT_StopChannel(s_lpit_channel);
+    }
+    (void)DMA_StopChannel(s_dma_channel);
+    (void)DMA_SetPeriodicTrigger(s_dma_channel, false);
+}
+
+/**
+ * @brief Major loop complete (DMA ISR): one-shot dừng, loop chỉ báo vòng mới
+ */
+static void GPIO_WAVE_SRV_OnDmaDone(uint8_t channel, void *user_data)
+{
+    gpio_wave_srv_callback_t callback = s_callback;
+    void *cb_data = s_user_data;
+
+    (void)channel;
+    (void)user_data;
+
+    if (!s_busy) {
+        return;
+    }
+
+    if (!s_loop) {
+        GPIO_WAVE_SRV_Halt();
+        (void)DMA_InstallCallback(s_dma_channel, NULL, NULL);
+        s_busy = false;
+    }
+
+    /* Gọi sau khi clear busy: callback được phép Start waveform kế tiếp */
+    if (callback != NULL) {
+        callback(cb_data);
+    }
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+gpio_wave_srv_status_t GPIO_WAVE_SRV_Start(const gpio_wave_srv_config_t *config,
+                                           gpio_wave_srv_callback_t callback,
+                                           void *user_data)
+{
+    dma_channel_config_t dma_cfg;
+    lpit_channel_config_t lpit_cfg = {
+        .channel = 0U,
+        .mode = LPIT_MODE_32BIT_PERIODIC,
+        .period = 0U,
+        .enableInterrupt = false,
+        .chainChannel = false,
+        .startOnTrigger = false,
+        .stopOnInterrupt = false,
+        .reloadOnTrigger = false
+    };
+    uint32_t width;
+    uint32_t basepri;
+    uint32_t lpit_freq;
+    bool use_lpit;
+
+    if ((config == NULL) || (config->pattern == NULL) ||
+        ((uint32_t)config->port > (uint32_t)GPIO_PORT_E) ||
+        ((uint32_t)config->target > (uint32_t)GPIO_WAVE_SRV_REG_PTOR) ||
+        (config->dma_channel >= GPIO_WAVE_SRV_DMA_CHANNELS) ||
+        (config->length == 0U) || (config->length > GPIO_WAVE_SRV_MAX_SAMPLES)) {
+        return GPIO_WAVE_SRV_ERROR;
+    }
+
+    width = (uint32_t)config->width;
+    if (((width != 1U) && (width != 2U) && (width != 4U)) ||
+        ((config->lane % width) != 0U) || ((config->lane + width) > GPIO_WAVE_SRV_REG_BYTES)) {
+        return GPIO_WAVE_SRV_ERROR;
+    }
+
+    /* LPIT trigger: service tự set period; source khác do application pace */
+    use_lpit = ((uint32_t)config->trigger >= (uint32_t)TRGMUX_SRC_LPIT_CH0) &&
+               ((uint32_t)config->trigger <= (uint32_t)TRGMUX_SRC_LPIT_CH3);
+    if (use_lpit) {
+        lpit_freq = LPIT_GetClockFreq();
+        if ((config->sample_rate_hz == 0U) || (config->sample_rate_hz > (lpit_freq / 2U))) {
+            return GPIO_WAVE_SRV_ERROR;
+        }
+        lpit_cfg.channel = (uint8_t)((uint32_t)config->trigger - (uint32_t)TRGMUX_SRC_LPIT_CH0);
+        lpit_cfg.period = LPIT_CalculatePeriod(lpit_freq, config->sample_rate_hz);
+    }
+
+    basepri = NVIC_EnterCritical();
+    if (s_busy) {
+        NVIC_ExitCritical(basepri);
+        return GPIO_WAVE_SRV_BUSY;
+    }
+    s_busy = true;
+    NVIC_ExitCritical(basepri);
+
+    dma_cfg.channel = config->dma_channel;
+    dma_cfg.source = DMAMUX_SRC_ALWAYS_ON_60;
+    dma_cfg.transferType = DMA_TRANSFER_MEM_TO_PERIPH;
+    dma_cfg.transferSize = GPIO_WAVE_SRV_TransferSize(config->width);
+    dma_cfg.priority = DMA_PRIORITY_HIGH;
+    dma_cfg.sourceAddr = (uint32_t)config->pattern;
+    dma_cfg.sourceOffset = (int16_t)width;
+    dma_cfg.sourceLastAddrAdjust = config->loop ? -(int32_t)((uint32_t)config->length * width) : 0;
+    dma_cfg.destAddr = GPIO_WAVE_SRV_TargetAddr(config->port, config->target, config->lane);
+    dma_cfg.destOffset = 0;
+    dma_cfg.destLastAddrAdjust = 0;
+    dma_cfg.minorLoopBytes = width;
+    dma_cfg.majorLoopCount = config->length;
+    dma_cfg.enableInterrupt = (!config->loop) || (callback != NULL);
+    dma_cfg.disableRequestAfterDone = !config->loop;
+    dma_cfg.enablePeriodicTrigger = true;
+
+    s_dma_channel = config->dma_channel;
+    s_lpit_channel = lpit_cfg.channel;
+    s_use_lpit = use_lpit;
+    s_loop = config->loop;
+    s_callback = callback;
+    s_user_data = user_data;
+
+    if (use_lpit) {
+        (void)LPIT_StopChannel(lpit_cfg.channel);
+    }
+
+    /* TRIG được set cùng ENBL trong ConfigChannel (enablePeriodicTrigger) */
+    if ((DMA_ConfigChannel(&dma_cfg) != STATUS_SUCCESS) ||
+        (DMA_InstallCallback(config->dma_channel, GPIO_WAVE_SRV_OnDmaDone, NULL) != STATUS_SUCCESS) ||
+        (TRGMUX_SetSource(TRGMUX_TARGET_DMAMUX0, config->dma_channel, config->trigger) != STATUS_SUCCESS) ||
+        (use_lpit && (LPIT_ConfigChannel(&lpit_cfg) != STATUS_SUCCESS))) {
+        GPIO_WAVE_SRV_Halt();
+        (void)DMA_InstallCallback(config->dma_channel, NULL, NULL);
+        s_busy = false;
+        return GPIO_WAVE_SRV_ERROR;
+    }
+
+    /* Sample 0 ghi ngay bởi software START, sample i tại trigger thứ i */
+    (void)DMA_StartChannel(config->dma_channel);
+    if (use_lpit) {
+        (void)LPIT_StartChannel(lpit_cfg.channel);
+    }
+
+    return GPIO_WAVE_SRV_SUCCESS;
+}
+
+gpio_wave_srv_status_t GPIO_WAVE_SRV_Stop(void)
+{
+    if (!s_busy) {
+        return GPIO_WAVE_SRV_SUCCESS;
+    }
+
+    GPIO_WAVE_SRV_Halt();
+    (void)DMA_InstallCallback(s_dma_channel, NULL, NULL);
+    s_busy = false;
+
+    return GPIO_WAVE_SRV_SUCCESS;
+}
+
+bool GPIO_WAVE_SRV_IsBusy(void)
+{
+    return s_busy;
+}
+
+uint16_t GPIO_WAVE_SRV_GetRemaining(void)
+{
+    uint16_t count = 0U;
+
+    if (!s_busy || (DMA_GetRemainingMajorLoops(s_dma_channel, &count) != STATUS_SUCCESS)) {
+        return 0U;
+    }
+
+    return count;
+}
+
+uint32_t GPIO_WAVE_SRV_EncodeWs2812(const uint8_t *data, uint32_t num_bytes, uint8_t lane_mask,
+                                    uint8_t *slots, uint32_t max_slots)
+{
+    uint32_t i;
+    uint32_t n = 0U;
+    uint8_t bit;
+
+    if ((data == NULL) || (slots == NULL) || (lane_mask == 0U) ||
+        (num_bytes > (max_slots / (GPIO_WAVE_SRV_BITS_PER_BYTE * GPIO_WAVE_SRV_WS2812_SLOTS_PER_BIT)))) {
+        return 0U;
+    }
+
+    for (i = 0U; i < num_bytes; i++) {
+        for (bit = 0x80U; bit != 0U; bit >>= 1) {
+            /* Slot 0 toggle lên high; bit 0: toggle xuống ở slot 1, bit 1: ở slot 2 */
+            slots[n] = lane_mask;
+            if ((data[i] & bit) != 0U) {
+                slots[n + 1U] = 0U;
+                slots[n + 2U] = lane_mask;
+            } else {
+                slots[n + 1U] = lane_mask;
+                slots[n + 2U] = 0U;
+            }
+            n += GPIO_WAVE_SRV_WS2812_SLOTS_PER_BIT;
+        }
+    }
+
+    return n;
+}
@@ -0,0 +1,612 @@
+/**
+ * @file    isotp_srv.c
+ * @brief   ISO-TP Service Layer Implementation
+ * @details Implementation của SF / FF / CF / FC state machine (ISO 15765-2),
+ *          streaming RX và TX pacing theo STmin / BS
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.1
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../inc/isotp_srv.h"
+#include "../inc/time_srv.h"
+#include <stddef.h>
+#include <string.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+
+/* PCI type (nibble cao của byte 0) */
+#define ISOTP_PCI_SF            (0x00U)
+#define ISOTP_PCI_FF            (0x10U)
+#define ISOTP_PCI_CF            (0x20U)
+#define ISOTP_PCI_FC            (0x30U)
+
+/* Flow status */
+#define ISOTP_FS_CTS            (0x00U)
+#define ISOTP_FS_WAIT           (0x01U)
+#define ISOTP_FS_OVFLW          (0x02U)
+
+#define ISOTP_CAN_DLC           (8U)
+#define ISOTP_CF_PAYLOAD        (7U)
+
+typedef enum {
+    ISOTP_RX_IDLE = 0,
+    ISOTP_RX_CF,                /* Chờ CF */
+    ISOTP_RX_HOLD               /* Cuối block nhưng sink pause, gửi FC WAIT */
+} isotp_rx_state_t;
+
+typedef enum {
+    ISOTP_TX_IDLE = 0,
+    ISOTP_TX_WAIT_FC,
+    ISOTP_TX_SEND_CF
+} isotp_tx_state_t;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static bool ISOTP_SRV_Expired(uint32_t now, uint32_t deadline)
+{
+    return ((int32_t)(now - deadline) >= 0);
+}
+
+/* STmin encoding -> µs, giá trị reserved xử lý như 127 ms */
+static uint32_t ISOTP_SRV_StMinToUs(uint8_t st_min)
+{
+    if (st_min <= 0x7FU) {
+        return (uint32_t)st_min * 1000UL;
+    }
+    if ((st_min >= 0xF1U) && (st_min <= 0xF9U)) {
+        return (uint32_t)(st_min - 0xF0U) * 100UL;
+    }
+    return 127000UL;
+}
+
+/* pci: bytes đầu (PCI), payload copy sau PCI, phần còn lại padding */
+static status_t ISOTP_SRV_SendFrame(const isotp_srv_link_t *link, const uint8_t *pci, uint8_t pci_len,
+                                    const uint8_t *payload, uint8_t payload_len)
+{
+    can_message_t msg;
+
+    msg.id = link->config.tx_id;
+    msg.idType = link->config.id_type;
+    msg.frameType = CAN_FRAME_DATA;
+    msg.dataLength = ISOTP_CAN_DLC;
+    memset(msg.data, link->config.padding, sizeof(msg.data));
+    memcpy(&msg.data[0], pci, pci_len);
+    if (payload_len > 0U) {
+        memcpy(&msg.data[pci_len], payload, payload_len);
+    }
+
+    if (link->config.tx_frame != NULL) {
+        return link->config.tx_frame(link->config.instance, msg.id, (msg.idType == CAN_ID_EXT),
+                                     msg.data, link->config.user_data) ? STATUS_SUCCESS : STATUS_BUSY;
+    }
+
+    return CAN_Send(link->config.instance, link->config.tx_mb, &msg);
+}
+
+/* MB bận thì giữ FC lại, Process retry trước mọi CF */
+static void ISOTP_SRV_SendFc(isotp_srv_link_t *link, uint8_t flow_status)
+{
+    uint8_t pci[3];
+
+    pci[0] = (uint8_t)(ISOTP_PCI_FC | flow_status);
+    pci[1] = link->config.block_size;
+    pci[2] = link->config.st_min;
+
+    link->fc_status = flow_status;
+    link->fc_pending = (ISOTP_SRV_SendFrame(link, pci, 3U, NULL, 0U) != STATUS_SUCCESS);
+}
+
+static void ISOTP_SRV_RxFinish(isotp_srv_link_t *link, isotp_srv_status_t status)
+{
+    link->rx_state = ISOTP_RX_IDLE;
+    link->rx_need_buffer = false;
+
+    /* Buffer mode: message hoàn chỉnh, buffer chuyển cho application */
+    if ((status == ISOTP_SRV_SUCCESS) && (link->config.rx_data == NULL) && (link->rx_buffer != NULL)) {
+        link->rx_complete_length = link->rx_length;
+        link->rx_buffer = NULL;
+        link->rx_buffer_size = 0U;
+    }
+
+    if (link->config.rx_done != NULL) {
+        link->config.rx_done(status, link->config.user_data);
+    }
+}
+
+static void ISOTP_SRV_TxFinish(isotp_srv_link_t *link, isotp_srv_status_t status)
+{
+    link->tx_state = ISOTP_TX_IDLE;
+    link->tx_data = NULL;
+    if (link->config.tx_done != NULL) {
+        link->config.tx_done(status, link->config.user_data);
+    }
+}
+
+/* Block mới: CTS nếu sink sẵn sàng, ngược lại FC WAIT và chờ Resume */
+static void ISOTP_SRV_RxNextBlock(isotp_srv_link_t *link, uint32_t now)
+{
+    link->rx_bs_count = 0U;
+
+    if (link->rx_paused || link->rx_need_buffer) {
+        link->rx_state = ISOTP_RX_HOLD;
+        link->rx_wft = 1U;
+        link->rx_deadline = now + ISOTP_SRV_WAIT_PERIOD_US;
+        ISOTP_SRV_SendFc(link, ISOTP_FS_WAIT);
+    } else {
+        link->rx_state = ISOTP_RX_CF;
+        link->rx_wft = 0U;
+        link->rx_deadline = now + ISOTP_SRV_N_CR_TIMEOUT_US;
+        ISOTP_SRV_SendFc(link, ISOTP_FS_CTS);
+    }
+}
+
+static bool ISOTP_SRV_RxBegin(isotp_srv_link_t *link, uint32_t length)
+{
+    /* SF / FF mới thay thế reception đang dở (ISO 15765-2 9.8.3) */
+    if (link->rx_state != ISOTP_RX_IDLE) {
+        ISOTP_SRV_RxFinish(link, ISOTP_SRV_ABORTED);
+    }
+
+    if ((link->config.rx_begin != NULL) &&
+        !link->config.rx_begin(length, link->config.user_data)) {
+        return false;
+    }
+
+    if ((link->config.rx_data == NULL) && (link->rx_buffer != NULL) && (length > link->rx_buffer_size)) {
+        return false;
+    }
+
+    link->rx_length = length;
+    link->rx_offset = 0U;
+    return true;
+}
+
+static void ISOTP_SRV_RxDeliver(isotp_srv_link_t *link, const uint8_t *data, uint8_t length)
+{
+    if (link->config.rx_data != NULL) {
+        link->config.rx_data(data, length, link->rx_offset, link->config.user_data);
+    } else if (link->rx_buffer != NULL) {
+        /* Copy duy nhất: frame -> vị trí cuối cùng trong buffer của caller */
+        memcpy(&link->rx_buffer[link->rx_offset], data, length);
+    } else if (link->rx_need_buffer) {
+        /* Payload FF chờ buffer (tối đa 6 bytes) */
+        memcpy(&link->rx_head[link->rx_offset], data, length);
+    } else {
+        /* Không có sink */
+    }
+    link->rx_offset += length;
+}
+
+/* Tiếp tục block đang HOLD khi sink / buffer đã sẵn sàng */
+static void ISOTP_SRV_RxRelease(isotp_srv_link_t *link)
+{
+    if ((link->rx_state == ISOTP_RX_HOLD) && !link->rx_paused && !link->rx_need_buffer) {
+        link->rx_state = ISOTP_RX_CF;
+        link->rx_wft = 0U;
+        link->rx_deadline = TIME_SRV_GetMicros32() + ISOTP_SRV_N_CR_TIMEOUT_US;
+        ISOTP_SRV_SendFc(link, ISOTP_FS_CTS);
+    }
+}
+
+static bool ISOTP_SRV_NoBuffer(const isotp_srv_link_t *link)
+{
+    return ((link->config.rx_data == NULL) && (link->rx_buffer == NULL));
+}
+
+static void ISOTP_SRV_OnSingleFrame(isotp_srv_link_t *link, const uint8_t *data, uint8_t dlc)
+{
+    uint8_t length = data[0] & 0x0FU;
+
+    if ((length == 0U) || (length > ISOTP_SRV_SF_MAX_LENGTH) || (dlc < (length + 1U))) {
+        return;
+    }
+
+    /* SF không flow control được: không có buffer thì drop */
+    if (ISOTP_SRV_NoBuffer(link)) {
+        if (link->config.rx_done != NULL) {
+            link->config.rx_done(ISOTP_SRV_OVERFLOW, link->config.user_data);
+        }
+        return;
+    }
+
+    if (ISOTP_SRV_RxBegin(link, length)) {
+        ISOTP_SRV_RxDeliver(link, &data[1], length);
+        ISOTP_SRV_RxFinish(link, ISOTP_SRV_SUCCESS);
+    }
+}
+
+static void ISOTP_SRV_OnFirstFrame(isotp_srv_link_t *link, const uint8_t *data, uint8_t dlc, uint32_t now)
+{
+    uint32_t length;
+    uint8_t header;
+
+    if (dlc < ISOTP_CAN_DLC) {
+        return;
+    }
+
+    length = ((uint32_t)(data[0] & 0x0FU) << 8U) | data[1];
+    header = 2U;
+    if (length == 0U) {
+        /* Escape sequence: length 32-bit big endian */
+        length = ((uint32_t)data[2] << 24U) | ((uint32_t)data[3] << 16U) |
+                 ((uint32_t)data[4] << 8U) | data[5];
+        header = 6U;
+        if (length <= ISOTP_SRV_FF_12BIT_MAX) {
+            return;
+        }
+    } else if (length <= ISOTP_SRV_SF_MAX_LENGTH) {
+        return;
+    }
+
+    if (!ISOTP_SRV_RxBegin(link, length)) {
+        ISOTP_SRV_SendFc(link, ISOTP_FS_OVFLW);
+        return;
+    }
+
+    /* Buffer mode chưa có buffer: giữ payload FF, FC WAIT tới SetRxBuffer */
+    link->rx_need_buffer = ISOTP_SRV_NoBuffer(link);
+    ISOTP_SRV_RxDeliver(link, &data[header], (uint8_t)(ISOTP_CAN_DLC - header));
+    link->rx_sn = 1U;
+    ISOTP_SRV_RxNextBlock(link, now);
+}
+
+static void ISOTP_SRV_OnConsecutiveFrame(isotp_srv_link_t *link, const uint8_t *data, uint8_t dlc, uint32_t now)
+{
+    uint32_t remaining;
+    uint8_t length;
+
+    if (link->rx_state != ISOTP_RX_CF) {
+        return;
+    }
+
+    if ((data[0] & 0x0FU) != link->rx_sn) {
+        ISOTP_SRV_RxFinish(link, ISOTP_SRV_WRONG_SN);
+        return;
+    }
+
+    remaining = link->rx_length - link->rx_offset;
+    length = (remaining > ISOTP_CF_PAYLOAD) ? ISOTP_CF_PAYLOAD : (uint8_t)remaining;
+    if (dlc < (length + 1U)) {
+        return;
+    }
+
+    link->rx_sn = (link->rx_sn + 1U) & 0x0FU;
+    ISOTP_SRV_RxDeliver(link, &data[1], length);
+
+    if (link->rx_offset >= link->rx_length) {
+        ISOTP_SRV_RxFinish(link, ISOTP_SRV_SUCCESS);
+    } else if ((link->config.block_size != 0U) && (++link->rx_bs_count >= link->config.block_size)) {
+        ISOTP_SRV_RxNextBlock(link, now);
+    } else {
+        link->rx_deadline = now + ISOTP_SRV_N_CR_TIMEOUT_US;
+    }
+}
+
+static void ISOTP_SRV_OnFlowControl(isotp_srv_link_t *link, const uint8_t *data, uint8_t dlc, uint32_t now)
+{
+    if ((link->tx_state != ISOTP_TX_WAIT_FC) || (dlc < 3U)) {
+        return;
+    }
+
+    switch (data[0] & 0x0FU) {
+        case ISOTP_FS_CTS:
+            link->tx_bs = data[1];
+            link->tx_st_us = ISOTP_SRV_StMinToUs(data[2]);
+            link->tx_bs_count = 0U;
+            link->tx_wft = 0U;
+            link->tx_next = now;
+            link->tx_state = ISOTP_TX_SEND_CF;
+            break;
+
+        case ISOTP_FS_WAIT:
+            if (++link->tx_wft > ISOTP_SRV_MAX_WFT) {
+                ISOTP_SRV_TxFinish(link, ISOTP_SRV_WFT_OVERRUN);
+            } else {
+                link->tx_deadline = now + ISOTP_SRV_N_BS_TIMEOUT_US;
+            }
+            break;
+
+        case ISOTP_FS_OVFLW:
+            ISOTP_SRV_TxFinish(link, ISOTP_SRV_OVERFLOW);
+            break;
+
+        default:
+            ISOTP_SRV_TxFinish(link, ISOTP_SRV_ERROR);
+            break;
+    }
+}
+
+static void ISOTP_SRV_TxSendCf(isotp_srv_link_t *link, uint32_t now)
+{
+    uint32_t remaining = link->tx_length - link->tx_offset;
+    uint8_t length = (remaining > ISOTP_CF_PAYLOAD) ? ISOTP_CF_PAYLOAD : (uint8_t)remaining;
+    uint8_t pci = (uint8_t)(ISOTP_PCI_CF | link->tx_sn);
+
+    if (!ISOTP_SRV_Expired(now, link->tx_next)) {
+        return;
+    }
+
+    /* MB còn frame trước: thử lại lần Process sau */
+    if (ISOTP_SRV_SendFrame(link, &pci, 1U, &link->tx_data[link->tx_offset], length) != STATUS_SUCCESS) {
+        return;
+    }
+
+    link->tx_offset += length;
+    link->tx_sn = (link->tx_sn + 1U) & 0x0FU;
+
+    if (link->tx_offset >= link->tx_length) {
+        ISOTP_SRV_TxFinish(link, ISOTP_SRV_SUCCESS);
+    } else if ((link->tx_bs != 0U) && (++link->tx_bs_count >= link->tx_bs)) {
+        link->tx_state = ISOTP_TX_WAIT_FC;
+        link->tx_deadline = now + ISOTP_SRV_N_BS_TIMEOUT_US;
+    } else {
+        link->tx_next = now + link->tx_st_us;
+    }
+}
+
+/* Frame đã qua lọc id của link */
+static void ISOTP_SRV_Input(isotp_srv_link_t *link, const uint8_t *data, uint8_t dlc)
+{
+    uint32_t now = TIME_SRV_GetMicros32();
+
+    switch (data[0] & 0xF0U) {
+        case ISOTP_PCI_SF:
+            ISOTP_SRV_OnSingleFrame(link, data, dlc);
+            break;
+        case ISOTP_PCI_FF:
+            ISOTP_SRV_OnFirstFrame(link, data, dlc, now);
+            break;
+        case ISOTP_PCI_CF:
+            ISOTP_SRV_OnConsecutiveFrame(link, data, dlc, now);
+            break;
+        case ISOTP_PCI_FC:
+            ISOTP_SRV_OnFlowControl(link, data, dlc, now);
+            break;
+        default:
+            /* PCI reserved: bỏ qua */
+            break;
+    }
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+isotp_srv_status_t ISOTP_SRV_Init(isotp_srv_link_t *link, const isotp_srv_config_t *config)
+{
+    if ((link == NULL) || (config == NULL)) {
+        return ISOTP_SRV_ERROR;
+    }
+
+    memset(link, 0, sizeof(*link));
+    link->config = *config;
+
+    return ISOTP_SRV_SUCCESS;
+}
+
+void ISOTP_SRV_SetFlowControl(isotp_srv_link_t *link, uint8_t block_size, uint8_t st_min)
+{
+    link->config.block_size = block_size;
+    link->config.st_min = st_min;
+}
+
+bool ISOTP_SRV_OnFrame(isotp_srv_link_t *link, const can_message_t *message)
+{
+    if ((message->id != link->config.rx_id) || (message->idType != link->config.id_type) ||
+        (message->frameType != CAN_FRAME_DATA) || (message->dataLength == 0U)) {
+        return false;
+    }
+
+    ISOTP_SRV_Input(link, message->data, message->dataLength);
+
+    return true;
+}
+
+void ISOTP_SRV_Process(isotp_srv_link_t *link)
+{
+    uint32_t now = TIME_SRV_GetMicros32();
+
+    if (link->fc_pending) {
+        ISOTP_SRV_SendFc(link, link->fc_status);
+        if (link->fc_pending) {
+            return;
+        }
+    }
+
+    switch (link->rx_state) {
+        case ISOTP_RX_CF:
+            if (ISOTP_SRV_Expired(now, link->rx_deadline)) {
+                ISOTP_SRV_RxFinish(link, ISOTP_SRV_TIMEOUT);
+            }
+            break;
+
+        case ISOTP_RX_HOLD:
+            if (ISOTP_SRV_Expired(now, link->rx_deadline)) {
+                if (++link->rx_wft > ISOTP_SRV_MAX_WFT) {
+                    ISOTP_SRV_RxFinish(link, ISOTP_SRV_WFT_OVERRUN);
+                } else {
+                    link->rx_deadline = now + ISOTP_SRV_WAIT_PERIOD_US;
+                    ISOTP_SRV_SendFc(link, ISOTP_FS_WAIT);
+                }
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    switch (link->tx_state) {
+        case ISOTP_TX_WAIT_FC:
+            if (ISOTP_SRV_Expired(now, link->tx_deadline)) {
+                ISOTP_SRV_TxFinish(link, ISOTP_SRV_TIMEOUT);
+            }
+            break;
+
+        case ISOTP_TX_SEND_CF:
+            if (!link->fc_pending) {
+                ISOTP_SRV_TxSendCf(link, now);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+isotp_srv_status_t ISOTP_SRV_Send(isotp_srv_link_t *link, const uint8_t *data, uint32_t length)
+{
+    uint8_t pci[6];
+    uint8_t pci_len;
+    status_t status;
+
+    if ((data == NULL) || (length == 0U)) {
+        return ISOTP_SRV_ERROR;
+    }
+
+    if (link->tx_state != ISOTP_TX_IDLE) {
+        return ISOTP_SRV_BUSY;
+    }
+
+    if (length <= ISOTP_SRV_SF_MAX_LENGTH) {
+        pci[0] = (uint8_t)(ISOTP_PCI_SF | length);
+        status = ISOTP_SRV_SendFrame(link, pci, 1U, data, (uint8_t)length);
+        if (status != STATUS_SUCCESS) {
+            return (status == STATUS_BUSY) ? ISOTP_SRV_BUSY : ISOTP_SRV_ERROR;
+        }
+        link->tx_data = data;
+        ISOTP_SRV_TxFinish(link, ISOTP_SRV_SUCCESS);
+        return ISOTP_SRV_SUCCESS;
+    }
+
+    if (length <= ISOTP_SRV_FF_12BIT_MAX) {
+        pci[0] = (uint8_t)(ISOTP_PCI_FF | (length >> 8U));
+        pci[1] = (uint8_t)length;
+        pci_len = 2U;
+    } else {
+        pci[0] = ISOTP_PCI_FF;
+        pci[1] = 0U;
+        pci[2] = (uint8_t)(length >> 24U);
+        pci[3] = (uint8_t)(length >> 16U);
+        pci[4] = (uint8_t)(length >> 8U);
+        pci[5] = (uint8_t)length;
+        pci_len = 6U;
+    }
+
+    status = ISOTP_SRV_SendFrame(link, pci, pci_len, data, (uint8_t)(ISOTP_CAN_DLC - pci_len));
+    if (status != STATUS_SUCCESS) {
+        return (status == STATUS_BUSY) ? ISOTP_SRV_BUSY : ISOTP_SRV_ERROR;
+    }
+
+    link->tx_data = data;
+    link->tx_length = length;
+    link->tx_offset = ISOTP_CAN_DLC - pci_len;
+    link->tx_sn = 1U;
+    link->tx_wft = 0U;
+    link->tx_deadline = TIME_SRV_GetMicros32() + ISOTP_SRV_N_BS_TIMEOUT_US;
+    link->tx_state = ISOTP_TX_WAIT_FC;
+
+    return ISOTP_SRV_SUCCESS;
+}
+
+bool ISOTP_SRV_IsTxBusy(const isotp_srv_link_t *link)
+{
+    return (link->tx_state != ISOTP_TX_IDLE);
+}
+
+void ISOTP_SRV_RxPause(isotp_srv_link_t *link)
+{
+    link->rx_paused = true;
+}
+
+void ISOTP_SRV_RxResume(isotp_srv_link_t *link)
+{
+    link->rx_paused = false;
+    ISOTP_SRV_RxRelease(link);
+}
+
+void ISOTP_SRV_SetRxBuffer(isotp_srv_link_t *link, uint8_t *buffer, uint32_t size)
+{
+    link->rx_buffer = buffer;
+    link->rx_buffer_size = (buffer != NULL) ? size : 0U;
+
+    if (!link->rx_need_buffer || (buffer == NULL)) {
+        return;
+    }
+
+    /* FF đang chờ buffer: kiểm tra length, chuyển payload FF vào buffer */
+    if (link->rx_length > size) {
+        ISOTP_SRV_SendFc(link, ISOTP_FS_OVFLW);
+        ISOTP_SRV_RxFinish(link, ISOTP_SRV_OVERFLOW);
+        return;
+    }
+
+    memcpy(buffer, link->rx_head, link->rx_offset);
+    link->rx_need_buffer = false;
+    ISOTP_SRV_RxRelease(link);
+}
+
+uint32_t ISOTP_SRV_GetRxLength(const isotp_srv_link_t *link)
+{
+    return link->rx_complete_length;
+}
+
+uint32_t ISOTP_SRV_PollCanSrv(can_srv_instance_t instance, isotp_srv_link_t *const *links,
+                              uint8_t count, can_srv_rx_callback_t other)
+{
+    const can_srv_message_t *msg;
+    can_id_type_t id_type;
+    uint32_t frames = 0U;
+    bool handled;
+    uint8_t i;
+
+    /* Xử lý ngay trong ring slot, release sau khi link đã copy payload */
+    while ((msg = CAN_SRV_PeekRx(instance)) != NULL) {
+        id_type = msg->isExtended ? CAN_ID_EXT : CAN_ID_STD;
+        handled = false;
+
+        if (msg->length > 0U) {
+            for (i = 0U; i < count; i++) {
+                if ((links[i]->config.rx_id == msg->id) && (links[i]->config.id_type == id_type)) {
+                    ISOTP_SRV_Input(links[i], msg->data, msg->length);
+                    handled = true;
+                    break;
+                }
+            }
+        }
+
+        if (!handled && (other != NULL)) {
+            other(msg);
+        }
+
+        CAN_SRV_ReleaseRx(instance);
+        frames++;
+    }
+
+    return frames;
+}
+
+bool ISOTP_SRV_CanSrvTxFrame(uint8_t instance, uint32_t id, bool is_extended, const uint8_t *data,
+                             void *user_data)
+{
+    can_srv_message_t msg;
+
+    (void)user_data;
+
+    msg.id = id;
+    msg.isExtended = is_extended;
+    msg.length = 8U;
+    memcpy(msg.data, data, 8U);
+    msg.timeStamp = 0U;
+    msg.timestampUs = 0U;
+
+    return (CAN_SRV_Send((can_srv_instance_t)instance, &msg) == CAN_SRV_SUCCESS);
+}
@@ -0,0 +1,225 @@
+/**
+ * @file    lat_srv.c
+ * @brief   Latency Service Layer Implementation
+ * @details Implementation của ISR entry hook: snapshot LPIT counter, histogram mỗi IRQ
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../inc/lat_srv.h"
+#include "lpit.h"
+#include <stddef.h>
+#include <stdio.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+#define LAT_SRV_LINE_SIZE           (96U)
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static lat_srv_probe_t *s_lat_probes[LAT_SRV_MAX_PROBES];
+static volatile uint32_t s_lat_probe_count = 0U;
+static uint32_t s_lat_period = 0U;         /* TVAL của reference channel */
+static uint32_t s_lat_clock_hz = 0U;
+static uint8_t s_lat_channel = 0U;
+static bool s_lat_initialized = false;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/* Handler context: đọc counter trước tiên, rồi mới tìm probe */
+static void LAT_SRV_OnIsrEntry(IRQn_Type irq)
+{
+    lat_srv_probe_t *probe = NULL;
+    uint32_t value = 0U;
+    uint32_t latency;
+    uint32_t bin;
+    uint32_t i;
+
+    (void)LPIT_GetCurrentValue(s_lat_channel, &value);
+
+    for (i = 0U; i < s_lat_probe_count; i++) {
+        if (s_lat_probes[i]->irq == irq) {
+            probe = s_lat_probes[i];
+            break;
+        }
+    }
+    if (probe == NULL) {
+        return;
+    }
+
+    latency = (value <= s_lat_period) ? (s_lat_period - value) : 0U;
+
+    bin = latency >> LAT_SRV_BIN_SHIFT;
+    if (bin >= LAT_SRV_BINS) {
+        bin = LAT_SRV_BINS - 1U;
+    }
+
+    /* Cùng IRQ không lồng nhau: không cần critical section */
+    probe->bins[bin]++;
+    probe->count++;
+    probe->total += latency;
+    if (latency < probe->min) {
+        probe->min = latency;
+    }
+    if (latency > probe->max) {
+        probe->max = latency;
+    }
+}
+
+static inline uint32_t LAT_SRV_CountsToNs(uint32_t counts)
+{
+    return (uint32_t)(((uint64_t)counts * 1000000000ULL) / s_lat_clock_hz);
+}
+
+static void LAT_SRV_Print(LPUART_RegType *base, const char *line, int len)
+{
+    if (len > (int)(LAT_SRV_LINE_SIZE - 1U)) {
+        len = (int)(LAT_SRV_LINE_SIZE - 1U);
+    }
+    if (len > 0) {
+        (void)UART_SendBlocking(base, (const uint8_t *)line, (uint32_t)len);
+    }
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+lat_srv_status_t LAT_SRV_Init(uint8_t ref_channel)
+{
+#if NVIC_ISR_TRACE_ENABLE
+    s_lat_clock_hz = LPIT_GetClockFreq();
+    if ((s_lat_clock_hz == 0U) || (LPIT_GetPeriod(ref_channel, &s_lat_period) != STATUS_SUCCESS)) {
+        return LAT_SRV_ERROR;
+    }
+
+    s_lat_channel = ref_channel;
+    s_lat_probe_count = 0U;
+    s_lat_initialized = true;
+
+    NVIC_InstallEntryHook(LAT_SRV_OnIsrEntry);
+
+    return LAT_SRV_SUCCESS;
+#else
+    (void)ref_channel;
+
+    /* HAL handlers không gọi hook */
+    return LAT_SRV_ERROR;
+#endif
+}
+
+lat_srv_status_t LAT_SRV_Register(lat_srv_probe_t *probe, IRQn_Type irq, const char *name)
+{
+    uint32_t basepri;
+    lat_srv_status_t status = LAT_SRV_SUCCESS;
+
+    if (!s_lat_initialized) {
+        return LAT_SRV_NOT_INITIALIZED;
+    }
+
+    if (probe == NULL) {
+        return LAT_SRV_ERROR;
+    }
+
+    probe->name = (name != NULL) ? name : "irq";
+    probe->irq = irq;
+    LAT_SRV_Reset(probe);
+
+    basepri = NVIC_EnterCritical();
+    if (s_lat_probe_count < LAT_SRV_MAX_PROBES) {
+        s_lat_probes[s_lat_probe_count] = probe;
+        s_lat_probe_count++;
+    } else {
+        status = LAT_SRV_ERROR;
+    }
+    NVIC_ExitCritical(basepri);
+
+    return status;
+}
+
+void LAT_SRV_Reset(lat_srv_probe_t *probe)
+{
+    uint32_t basepri;
+    uint32_t i;
+
+    if (probe == NULL) {
+        return;
+    }
+
+    basepri = NVIC_EnterCritical();
+    probe->count = 0U;
+    probe->total = 0U;
+    probe->min = 0xFFFFFFFFUL;
+    probe->max = 0U;
+    for (i = 0U; i < LAT_SRV_BINS; i++) {
+        probe->bins[i] = 0U;
+    }
+    NVIC_ExitCritical(basepri);
+}
+
+lat_srv_status_t LAT_SRV_Dump(LPUART_RegType *base)
+{
+    char line[LAT_SRV_LINE_SIZE];
+    lat_srv_probe_t snapshot;
+    uint32_t basepri;
+    uint32_t p;
+    uint32_t i;
+    int len;
+
+    if (!s_lat_initialized) {
+        return LAT_SRV_NOT_INITIALIZED;
+    }
+
+    if (base == NULL) {
+        return LAT_SRV_ERROR;
+    }
+
+    for (p = 0U; p < s_lat_probe_count; p++) {
+        /* Snapshot: histogram vẫn được update trong lúc in */
+        basepri = NVIC_EnterCritical();
+        snapshot = *s_lat_probes[p];
+        NVIC_ExitCritical(basepri);
+
+        if (snapshot.count == 0U) {
+            len = snprintf(line, sizeof(line), "%s (irq %d): no samples\r\n",
+                           snapshot.name, (int)snapshot.irq);
+            LAT_SRV_Print(base, line, len);
+            continue;
+        }
+
+        len = snprintf(line, sizeof(line), "%s (irq %d): n=%lu min=%lu avg=%lu max=%lu ns\r\n",
+                       snapshot.name, (int)snapshot.irq, (unsigned long)snapshot.count,
+                       (unsigned long)LAT_SRV_CountsToNs(snapshot.min),
+                       (unsigned long)LAT_SRV_CountsToNs((uint32_t)(snapshot.total / snapshot.count)),
+                       (unsigned long)LAT_SRV_CountsToNs(snapshot.max));
+        LAT_SRV_Print(base, line, len);
+
+        for (i = 0U; i < LAT_SRV_BINS; i++) {
+            if (snapshot.bins[i] == 0U) {
+                continue;
+            }
+            if (i == (LAT_SRV_BINS - 1U)) {
+                len = snprintf(line, sizeof(line), "  >= %6lu ns : %lu\r\n",
+                               (unsigned long)LAT_SRV_CountsToNs(i << LAT_SRV_BIN_SHIFT),
+                               (unsigned long)snapshot.bins[i]);
+            } else {
+                len = snprintf(line, sizeof(line), "  %6lu-%6lu ns : %lu\r\n",
+                               (unsigned long)LAT_SRV_CountsToNs(i << LAT_SRV_BIN_SHIFT),
+                               (unsigned long)LAT_SRV_CountsToNs((i + 1U) << LAT_SRV_BIN_SHIFT),
+                               (unsigned long)snapshot.bins[i]);
+            }
+            LAT_SRV_Print(base, line, len);
+        }
+    }
+
+    return LAT_SRV_SUCCESS;
+}
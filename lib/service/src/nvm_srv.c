@@ -0,0 +1,432 @@
+/**
+ * @file    nvm_srv.c
+ * @brief   NVM Service Layer Implementation
+ * @details Implementation của RAM shadow, dirty bitmap theo word và lazy
+ *          flush xuống FlexRAM (EEE mode), CRC-32 parameter tùy chọn
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.1
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../inc/nvm_srv.h"
+#include "nvic.h"
+#include "smc.h"
+#if NVM_SRV_PARAM_CRC_ENABLE
+#include "crc.h"
+#endif
+#include <stddef.h>
+#include <string.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+#define NVM_SRV_SHADOW_WORDS    (NVM_SRV_SHADOW_SIZE / 4U)
+#define NVM_SRV_DIRTY_WORDS     ((NVM_SRV_SHADOW_WORDS + 31U) / 32U)
+
+#if NVM_SRV_PARAM_CRC_ENABLE
+#define NVM_SRV_CRC_SIZE        (4U)
+#if (NVM_SRV_MAX_PARAMS > 32U)
+#error "NVM_SRV_PARAM_CRC_ENABLE: stale / valid bitmap giới hạn 32 parameter"
+#endif
+#else
+#define NVM_SRV_CRC_SIZE        (0U)
+#endif
+
+#define NVM_SRV_ALIGN4(x)       (((uint32_t)(x) + 3U) & ~3U)
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static const nvm_srv_param_t *s_params = NULL;
+static uint8_t s_param_count = 0U;
+static uint16_t s_offsets[NVM_SRV_MAX_PARAMS];
+
+static uint32_t s_shadow[NVM_SRV_SHADOW_WORDS];
+static volatile uint32_t s_dirty[NVM_SRV_DIRTY_WORDS];
+static volatile uint32_t s_pending = 0U;
+
+/* Word đang quét tiếp theo, Process đi vòng qua bitmap */
+static uint32_t s_scan_word = 0U;
+static bool s_initialized = false;
+
+#if NVM_SRV_PARAM_CRC_ENABLE
+static const crc_config_t s_crc_config = CRC_CONFIG_CRC32;
+static volatile uint32_t s_crc_stale = 0U;     /* Parameter cần tính lại CRC */
+static volatile uint32_t s_crc_valid = 0U;     /* Parameter có data hợp lệ */
+#endif
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static uint32_t NVM_SRV_EeeSize(uint8_t eee_size_code)
+{
+    switch (eee_size_code) {
+        case FTFC_EEESIZE_4KB:
+            return 4096U;
+        case FTFC_EEESIZE_2KB:
+            return 2048U;
+        case FTFC_EEESIZE_1KB:
+            return 1024U;
+        default:
+            return 0U;
+    }
+}
+
+static int32_t NVM_SRV_Find(uint16_t id)
+{
+    uint32_t i;
+
+    for (i = 0U; i < s_param_count; i++) {
+        if (s_params[i].id == id) {
+            return (int32_t)i;
+        }
+    }
+
+    return -1;
+}
+
+/* Partition lần đầu (nếu được phép) rồi bật EEE mode */
+static nvm_srv_status_t NVM_SRV_EnableEee(const nvm_srv_config_t *config, uint32_t *eee_size)
+{
+    uint8_t eee_code;
+    uint8_t depart;
+
+    if (FTFC_GetPartition(&eee_code, &depart) != STATUS_SUCCESS) {
+        return NVM_SRV_ERROR;
+    }
+
+    if (eee_code == FTFC_EEESIZE_NONE) {
+        if (!config->allow_partition) {
+            return NVM_SRV_NOT_PARTITIONED;
+        }
+        if (FTFC_ProgramPartition(config->eee_size_code, config->depart_code, true) != STATUS_SUCCESS) {
+            return NVM_SRV_ERROR;
+        }
+        eee_code = config->eee_size_code;
+    }
+
+    *eee_size = NVM_SRV_EeeSize(eee_code);
+
+    if (!FTFC_IsEeeReady() &&
+        (FTFC_SetFlexRamFunction(FTFC_FLEXRAM_EEE) != STATUS_SUCCESS)) {
+        return NVM_SRV_ERROR;
+    }
+
+    return NVM_SRV_SUCCESS;
+}
+
+/* Dirty word + CRC word chưa tính (mỗi parameter stale tạo tối đa một word) */
+static uint32_t NVM_SRV_Pending(void)
+{
+#if NVM_SRV_PARAM_CRC_ENABLE
+    return s_pending + (uint32_t)__builtin_popcount(s_crc_stale);
+#else
+    return s_pending;
+#endif
+}
+
+/* Đánh dấu word thay đổi, gọi với interrupt masked */
+static void NVM_SRV_MarkDirty(uint32_t word)
+{
+    uint32_t bit = 1UL << (word & 31U);
+
+    if ((s_dirty[word >> 5U] & bit) == 0U) {
+        s_dirty[word >> 5U] |= bit;
+        s_pending++;
+    }
+}
+
+#if NVM_SRV_PARAM_CRC_ENABLE
+/* CRC-32 của data parameter trong shadow, word CRC nằm ngay sau data */
+static status_t NVM_SRV_ParamCrc(uint32_t index, uint32_t *crc)
+{
+    return CRC_Compute(&s_crc_config, (const uint8_t *)s_shadow + s_offsets[index],
+                       s_params[index].size, crc);
+}
+
+static uint32_t NVM_SRV_CrcWord(uint32_t index)
+{
+    return (s_offsets[index] + NVM_SRV_ALIGN4(s_params[index].size)) >> 2U;
+}
+
+/* Tính lại CRC của một parameter stale, CRC word mới thành dirty word */
+static void NVM_SRV_UpdateCrc(void)
+{
+    uint32_t basepri;
+    uint32_t index;
+    uint32_t word;
+    uint32_t crc;
+
+    if (s_crc_stale == 0U) {
+        return;
+    }
+
+    index = (uint32_t)__builtin_ctz(s_crc_stale);
+
+    /* Clear trước khi tính: Write trong lúc tính sẽ set stale lại */
+    basepri = NVIC_EnterCritical();
+    s_crc_stale &= ~(1UL << index);
+    NVIC_ExitCritical(basepri);
+
+    if (NVM_SRV_ParamCrc(index, &crc) != STATUS_SUCCESS) {
+        /* CRC engine đang được dùng ở context khác, thử lại lần sau */
+        basepri = NVIC_EnterCritical();
+        s_crc_stale |= (1UL << index);
+        NVIC_ExitCritical(basepri);
+        return;
+    }
+
+    word = NVM_SRV_CrcWord(index);
+
+    basepri = NVIC_EnterCritical();
+    if ((s_crc_stale & (1UL << index)) == 0U) {
+        if (s_shadow[word] != crc) {
+            s_shadow[word] = crc;
+            NVM_SRV_MarkDirty(word);
+        }
+    }
+    NVIC_ExitCritical(basepri);
+}
+#endif
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+nvm_srv_status_t NVM_SRV_Init(const nvm_srv_config_t *config)
+{
+    const volatile uint32_t *flexram = (const volatile uint32_t *)FTFC_FLEXRAM_BASE;
+    nvm_srv_status_t status;
+    uint32_t eee_size = 0U;
+    uint32_t offset = 0U;
+    uint32_t i;
+
+    if ((config == NULL) || (config->params == NULL) ||
+        (config->param_count == 0U) || (config->param_count > NVM_SRV_MAX_PARAMS)) {
+        return NVM_SRV_ERROR;
+    }
+
+    s_initialized = false;
+
+    /* Offset word aligned theo thứ tự bảng */
+    for (i = 0U; i < config->param_count; i++) {
+        if (config->params[i].size == 0U) {
+            return NVM_SRV_ERROR;
+        }
+        s_offsets[i] = (uint16_t)offset;
+        offset += NVM_SRV_ALIGN4(config->params[i].size) + NVM_SRV_CRC_SIZE;
+    }
+
+    if (offset > NVM_SRV_SHADOW_SIZE) {
+        return NVM_SRV_NO_SPACE;
+    }
+
+    status = NVM_SRV_EnableEee(config, &eee_size);
+    if (status != NVM_SRV_SUCCESS) {
+        return status;
+    }
+
+    if (offset > eee_size) {
+        return NVM_SRV_NO_SPACE;
+    }
+
+    s_params = config->params;
+    s_param_count = config->param_count;
+
+    /* FlexRAM đã được FTFC load từ EEPROM backup lúc reset */
+    for (i = 0U; i < NVM_SRV_SHADOW_WORDS; i++) {
+        s_shadow[i] = (i < (eee_size / 4U)) ? flexram[i] : 0xFFFFFFFFUL;
+    }
+    for (i = 0U; i < NVM_SRV_DIRTY_WORDS; i++) {
+        s_dirty[i] = 0U;
+    }
+    s_pending = 0U;
+    s_scan_word = 0U;
+
+#if NVM_SRV_PARAM_CRC_ENABLE
+    s_crc_stale = 0U;
+    s_crc_valid = 0U;
+    for (i = 0U; i < s_param_count; i++) {
+        uint32_t crc;
+
+        if (NVM_SRV_ParamCrc(i, &crc) != STATUS_SUCCESS) {
+            return NVM_SRV_ERROR;
+        }
+        if (s_shadow[NVM_SRV_CrcWord(i)] == crc) {
+            s_crc_valid |= (1UL << i);
+        }
+    }
+#endif
+
+    s_initialized = true;
+
+    return NVM_SRV_SUCCESS;
+}
+
+nvm_srv_status_t NVM_SRV_Write(uint16_t id, const void *data, uint16_t length)
+{
+    const uint8_t *src = (const uint8_t *)data;
+    uint8_t *shadow = (uint8_t *)s_shadow;
+    uint32_t basepri;
+    uint32_t offset;
+    int32_t index;
+    uint32_t i;
+
+    if (!s_initialized) {
+        return NVM_SRV_NOT_INITIALIZED;
+    }
+
+    if (data == NULL) {
+        return NVM_SRV_ERROR;
+    }
+
+    index = NVM_SRV_Find(id);
+    if (index < 0) {
+        return NVM_SRV_INVALID_ID;
+    }
+
+    if (length > s_params[index].size) {
+        return NVM_SRV_INVALID_LENGTH;
+    }
+
+    offset = s_offsets[index];
+
+    /* Chỉ byte thay đổi mới làm word dirty (không wear khi ghi lại cùng giá trị) */
+    basepri = NVIC_EnterCritical();
+    for (i = 0U; i < length; i++) {
+        if (shadow[offset + i] != src[i]) {
+            shadow[offset + i] = src[i];
+            NVM_SRV_MarkDirty((offset + i) >> 2U);
+#if NVM_SRV_PARAM_CRC_ENABLE
+            s_crc_stale |= (1UL << (uint32_t)index);
+#endif
+        }
+    }
+#if NVM_SRV_PARAM_CRC_ENABLE
+    /* Application đã ghi: shadow là nguồn đúng, CRC theo sau */
+    s_crc_valid |= (1UL << (uint32_t)index);
+#endif
+    NVIC_ExitCritical(basepri);
+
+    return NVM_SRV_SUCCESS;
+}
+
+nvm_srv_status_t NVM_SRV_Read(uint16_t id, void *data, uint16_t length)
+{
+    uint32_t basepri;
+    int32_t index;
+
+    if (!s_initialized) {
+        return NVM_SRV_NOT_INITIALIZED;
+    }
+
+    if (data == NULL) {
+        return NVM_SRV_ERROR;
+    }
+
+    index = NVM_SRV_Find(id);
+    if (index < 0) {
+        return NVM_SRV_INVALID_ID;
+    }
+
+    if (length > s_params[index].size) {
+        return NVM_SRV_INVALID_LENGTH;
+    }
+
+    /* Snapshot nhất quán với Write từ ISR */
+    basepri = NVIC_EnterCritical();
+    memcpy(data, (const uint8_t *)s_shadow + s_offsets[index], length);
+    NVIC_ExitCritical(basepri);
+
+#if NVM_SRV_PARAM_CRC_ENABLE
+    if ((s_crc_valid & (1UL << (uint32_t)index)) == 0U) {
+        return NVM_SRV_CRC_ERROR;
+    }
+#endif
+
+    return NVM_SRV_SUCCESS;
+}
+
+uint32_t NVM_SRV_Process(void)
+{
+    volatile uint32_t *flexram = (volatile uint32_t *)FTFC_FLEXRAM_BASE;
+    uint32_t basepri;
+    uint32_t scanned;
+    uint32_t word;
+    uint32_t value;
+    bool found = false;
+
+    if (!s_initialized) {
+        return NVM_SRV_Pending();
+    }
+
+#if NVM_SRV_PARAM_CRC_ENABLE
+    NVM_SRV_UpdateCrc();
+#endif
+
+    if (s_pending == 0U) {
+        return NVM_SRV_Pending();
+    }
+
+    /* FlexRAM write khi CCIF = 0 bị bỏ qua (ACCERR) */
+    if (!FTFC_IsIdle() || !FTFC_IsEeeReady() || (SMC_GetPowerMode() != SMC_POWER_MODE_RUN)) {
+        return NVM_SRV_Pending();
+    }
+
+    basepri = NVIC_EnterCritical();
+    for (scanned = 0U; scanned < NVM_SRV_SHADOW_WORDS; scanned++) {
+        word = s_scan_word;
+        s_scan_word = ((s_scan_word + 1U) < NVM_SRV_SHADOW_WORDS) ? (s_scan_word + 1U) : 0U;
+
+        if ((s_dirty[word >> 5U] & (1UL << (word & 31U))) != 0U) {
+            /* Clear trước khi ghi: Write sau snapshot sẽ set dirty lại */
+            s_dirty[word >> 5U] &= ~(1UL << (word & 31U));
+            s_pending--;
+            value = s_shadow[word];
+            found = true;
+            break;
+        }
+    }
+    NVIC_ExitCritical(basepri);
+
+    /* Word không đổi so với EEE (vd. ghi rồi ghi lại giá trị cũ) thì bỏ qua */
+    if (found && (flexram[word] != value)) {
+        flexram[word] = value;
+    }
+
+    return NVM_SRV_Pending();
+}
+
+nvm_srv_status_t NVM_SRV_Flush(uint32_t timeout_loops)
+{
+    uint32_t loops = 0U;
+
+    if (!s_initialized) {
+        return NVM_SRV_NOT_INITIALIZED;
+    }
+
+    while (NVM_SRV_Process() > 0U) {
+        if ((timeout_loops != 0U) && (++loops >= timeout_loops)) {
+            return NVM_SRV_TIMEOUT;
+        }
+    }
+
+    /* Word cuối đã vào EEE khi CCIF set lại */
+    while (!FTFC_IsIdle()) {
+        if ((timeout_loops != 0U) && (++loops >= timeout_loops)) {
+            return NVM_SRV_TIMEOUT;
+        }
+    }
+
+    return NVM_SRV_SUCCESS;
+}
+
+uint32_t NVM_SRV_GetPendingCount(void)
+{
+    return NVM_SRV_Pending();
+}
@@ -0,0 +1,152 @@
+/**
+ * @file    pool_srv.c
+ * @brief   Pool Service Layer Implementation
+ * @details Implementation của lock-free free list (Treiber stack) và ref-counted messages
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../inc/pool_srv.h"
+#include "atomic.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+pool_srv_status_t POOL_SRV_Init(pool_srv_t *pool, void *storage,
+                                uint32_t block_size, uint32_t block_count)
+{
+    uint32_t i;
+    uint32_t block;
+
+    if ((pool == NULL) || (storage == NULL) || (block_count == 0U) ||
+        (block_size < 4U) || ((block_size & 3U) != 0U) || (((uint32_t)storage & 3U) != 0U)) {
+        return POOL_SRV_ERROR;
+    }
+
+    pool->base = (uint8_t *)storage;
+    pool->block_size = block_size;
+    pool->block_count = block_count;
+
+    /* Word đầu của block free = địa chỉ block free kế tiếp */
+    for (i = 0U; i < block_count; i++) {
+        block = (uint32_t)pool->base + (i * block_size);
+        *(uint32_t *)block = ((i + 1U) < block_count) ? (block + block_size) : 0U;
+    }
+
+    pool->free_count = block_count;
+    ATOMIC_Barrier();
+    pool->free_head = (uint32_t)pool->base;
+
+    return POOL_SRV_SUCCESS;
+}
+
+void *POOL_SRV_Alloc(pool_srv_t *pool)
+{
+    uint32_t head;
+    uint32_t next;
+
+    if (pool == NULL) {
+        return NULL;
+    }
+
+    /* Interrupt giữa LDREX và STREX xóa monitor -> retry, không có ABA */
+    do {
+        head = ATOMIC_LoadExclusive(&pool->free_head);
+        if (head == 0U) {
+            ATOMIC_ClearExclusive();
+            return NULL;
+        }
+        next = *(volatile uint32_t *)head;
+    } while (ATOMIC_StoreExclusive(&pool->free_head, next) != 0U);
+
+    (void)ATOMIC_Add(&pool->free_count, -1);
+
+    return (void *)head;
+}
+
+pool_srv_status_t POOL_SRV_Free(pool_srv_t *pool, void *block)
+{
+    uint32_t addr = (uint32_t)block;
+    uint32_t head;
+
+    if ((pool == NULL) || (block == NULL) || (pool->base == NULL)) {
+        return POOL_SRV_ERROR;
+    }
+
+    if ((addr < (uint32_t)pool->base) ||
+        (addr >= ((uint32_t)pool->base + (pool->block_size * pool->block_count))) ||
+        (((addr - (uint32_t)pool->base) % pool->block_size) != 0U)) {
+        return POOL_SRV_ERROR;
+    }
+
+    do {
+        head = ATOMIC_LoadExclusive(&pool->free_head);
+        *(volatile uint32_t *)addr = head;
+    } while (ATOMIC_StoreExclusive(&pool->free_head, addr) != 0U);
+
+    (void)ATOMIC_Add(&pool->free_count, 1);
+
+    return POOL_SRV_SUCCESS;
+}
+
+uint32_t POOL_SRV_GetFreeCount(const pool_srv_t *pool)
+{
+    if (pool == NULL) {
+        return 0U;
+    }
+
+    return pool->free_count;
+}
+
+pool_srv_msg_t *POOL_SRV_MsgAlloc(pool_srv_t *pool, uint16_t type)
+{
+    pool_srv_msg_t *msg;
+
+    if ((pool == NULL) || (pool->block_size < sizeof(pool_srv_msg_t))) {
+        return NULL;
+    }
+
+    msg = (pool_srv_msg_t *)POOL_SRV_Alloc(pool);
+    if (msg != NULL) {
+        msg->pool = pool;
+        msg->refs = 1U;
+        msg->type = type;
+        msg->length = 0U;
+    }
+
+    return msg;
+}
+
+void POOL_SRV_MsgRetain(pool_srv_msg_t *msg)
+{
+    if (msg != NULL) {
+        (void)ATOMIC_Add(&msg->refs, 1);
+    }
+}
+
+void POOL_SRV_MsgRelease(pool_srv_msg_t *msg)
+{
+    if (msg == NULL) {
+        return;
+    }
+
+    if (ATOMIC_Add(&msg->refs, -1) == 0U) {
+        (void)POOL_SRV_Free(msg->pool, msg);
+    }
+}
+
+uint32_t POOL_SRV_MsgCapacity(const pool_srv_msg_t *msg)
+{
+    if (msg == NULL) {
+        return 0U;
+    }
+
+    return msg->pool->block_size - (uint32_t)sizeof(pool_srv_msg_t);
+}
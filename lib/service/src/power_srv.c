@@ -0,0 +1,372 @@
+/**
+ * @file    power_srv.c
+ * @brief   Power Mode Service Layer Implementation
+ * @details Implementation của RUN / HSRUN / VLPR sequencing (SCG + SMC) và
+ *          transition callback registry
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../inc/power_srv.h"
+#include "smc.h"
+#include "clock_manager.h"
+#include "nvic.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Types
+ ******************************************************************************/
+typedef struct {
+    power_srv_callback_t callback;
+    void *user_data;
+} power_srv_entry_t;
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static power_srv_config_t s_config;
+static power_srv_entry_t s_callbacks[POWER_SRV_MAX_CALLBACKS];
+static power_srv_mode_t s_mode = POWER_SRV_MODE_RUN;
+static bool s_initialized = false;
+
+/* Clock source đã tắt khi vào VLPR, bit = scg_clock_source_t */
+static uint8_t s_vlpr_stopped = 0U;
+
+/* RUN tạm chạy FIRC 48 MHz trong lúc SPLL relock */
+static const scg_system_clock_config_t s_firc_park = {
+    SCG_CLOCK_SRC_FIRC, SCG_CLOCK_DIV_BY_1, SCG_CLOCK_DIV_BY_2, SCG_CLOCK_DIV_BY_2
+};
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static power_srv_mode_t POWER_SRV_ReadMode(void)
+{
+    switch (SMC_GetPowerMode()) {
+        case SMC_POWER_MODE_HSRUN:
+            return POWER_SRV_MODE_HSRUN;
+        case SMC_POWER_MODE_VLPR:
+            return POWER_SRV_MODE_VLPR;
+        default:
+            return POWER_SRV_MODE_RUN;
+    }
+}
+
+static void POWER_SRV_Notify(power_srv_event_t event, power_srv_mode_t from,
+                             power_srv_mode_t to, uint32_t count)
+{
+    uint32_t i;
+
+    for (i = 0U; i < count; i++) {
+        if (s_callbacks[i].callback != NULL) {
+            (void)s_callbacks[i].callback(event, from, to, s_callbacks[i].user_data);
+        }
+    }
+}
+
+/* BEFORE: callback đầu tiên veto thì các callback đã đồng ý nhận ABORTED */
+static bool POWER_SRV_NotifyBefore(power_srv_mode_t from, power_srv_mode_t to)
+{
+    uint32_t i;
+
+    for (i = 0U; i < POWER_SRV_MAX_CALLBACKS; i++) {
+        if ((s_callbacks[i].callback != NULL) &&
+            !s_callbacks[i].callback(POWER_SRV_EVENT_BEFORE, from, to, s_callbacks[i].user_data)) {
+            POWER_SRV_Notify(POWER_SRV_EVENT_ABORTED, from, to, i);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static power_srv_status_t POWER_SRV_EnterRunMode(smc_run_mode_t mode, scg_system_clock_mode_t clock)
+{
+    switch (SMC_SetRunMode(mode)) {
+        case SMC_STATUS_SUCCESS:
+            break;
+        case SMC_STATUS_TIMEOUT:
+            return POWER_SRV_TIMEOUT;
+        case SMC_STATUS_ERROR:
+            return POWER_SRV_NOT_ALLOWED;
+        default:
+            return POWER_SRV_ERROR;
+    }
+
+    /* PMSTAT đổi trước, CSR chuyển sang xCCR của mode mới ngay sau đó */
+    return SCG_WaitForSystemClock(clock) ? POWER_SRV_SUCCESS : POWER_SRV_TIMEOUT;
+}
+
+static bool POWER_SRV_EnsureClock(scg_clock_source_t source)
+{
+    return SCG_IsClockValid(source) || SCG_EnableClock(source);
+}
+
+/* Chỉ gọi trong RUN: SPLL không relock được khi đang là system clock */
+static bool POWER_SRV_RelockSpll(const scg_spll_config_t *spll)
+{
+    return POWER_SRV_EnsureClock(SCG_CLOCK_SRC_FIRC) &&
+           SCG_SetSystemClockConfig(SCG_SYSTEM_CLOCK_MODE_RUN, &s_firc_park) &&
+           SCG_InitSPLL(spll);
+}
+
+/* Bật lại clock đã tắt khi vào VLPR (FIRC, SOSC trước SPLL) rồi apply RUN clock */
+static power_srv_status_t POWER_SRV_RestoreRunClock(void)
+{
+    bool ok = true;
+
+    if ((s_vlpr_stopped & (1U << SCG_CLOCK_SRC_FIRC)) != 0U) {
+        ok = SCG_EnableClock(SCG_CLOCK_SRC_FIRC);
+    }
+    if (ok && ((s_vlpr_stopped & (1U << SCG_CLOCK_SRC_SOSC)) != 0U)) {
+        ok = SCG_EnableClock(SCG_CLOCK_SRC_SOSC);
+    }
+    if (ok && (s_config.run.spll != NULL)) {
+        ok = SCG_InitSPLL(s_config.run.spll);
+    } else if (ok && ((s_vlpr_stopped & (1U << SCG_CLOCK_SRC_SPLL)) != 0U)) {
+        ok = SCG_EnableClock(SCG_CLOCK_SRC_SPLL);
+    }
+    s_vlpr_stopped = 0U;
+
+    if (!ok || !SCG_SetSystemClockConfig(SCG_SYSTEM_CLOCK_MODE_RUN, &s_config.run.clock)) {
+        return POWER_SRV_ERROR;
+    }
+
+    return POWER_SRV_SUCCESS;
+}
+
+static power_srv_status_t POWER_SRV_RunToHsrun(void)
+{
+    if ((s_config.hsrun.spll != NULL) && !POWER_SRV_RelockSpll(s_config.hsrun.spll)) {
+        return POWER_SRV_ERROR;
+    }
+
+    /* HCCR chỉ được apply khi PMSTAT = HSRUN */
+    if (!SCG_SetSystemClockConfig(SCG_SYSTEM_CLOCK_MODE_HSRUN, &s_config.hsrun.clock)) {
+        return POWER_SRV_ERROR;
+    }
+
+    return POWER_SRV_EnterRunMode(SMC_RUN_MODE_HSRUN, SCG_SYSTEM_CLOCK_MODE_HSRUN);
+}
+
+static power_srv_status_t POWER_SRV_HsrunToRun(void)
+{
+    power_srv_status_t status;
+
+    if (s_config.run.spll == NULL) {
+        if (!SCG_SetSystemClockConfig(SCG_SYSTEM_CLOCK_MODE_RUN, &s_config.run.clock)) {
+            return POWER_SRV_ERROR;
+        }
+        return POWER_SRV_EnterRunMode(SMC_RUN_MODE_RUN, SCG_SYSTEM_CLOCK_MODE_RUN);
+    }
+
+    /* Ra RUN trên FIRC, relock SPLL, rồi mới chuyển RUN clock sang SPLL */
+    if (!POWER_SRV_EnsureClock(SCG_CLOCK_SRC_FIRC) ||
+        !SCG_SetSystemClockConfig(SCG_SYSTEM_CLOCK_MODE_RUN, &s_firc_park)) {
+        return POWER_SRV_ERROR;
+    }
+
+    status = POWER_SRV_EnterRunMode(SMC_RUN_MODE_RUN, SCG_SYSTEM_CLOCK_MODE_RUN);
+    if (status != POWER_SRV_SUCCESS) {
+        return status;
+    }
+
+    if (!SCG_InitSPLL(s_config.run.spll) ||
+        !SCG_SetSystemClockConfig(SCG_SYSTEM_CLOCK_MODE_RUN, &s_config.run.clock)) {
+        return POWER_SRV_ERROR;
+    }
+
+    return POWER_SRV_SUCCESS;
+}
+
+static power_srv_status_t POWER_SRV_RunToVlpr(void)
+{
+    static const scg_clock_source_t stop_order[] = {
+        SCG_CLOCK_SRC_SPLL, SCG_CLOCK_SRC_SOSC, SCG_CLOCK_SRC_FIRC
+    };
+    power_srv_status_t status;
+    uint32_t i;
+
+    if (!POWER_SRV_EnsureClock(SCG_CLOCK_SRC_SIRC) ||
+        !SCG_SetSystemClockConfig(SCG_SYSTEM_CLOCK_MODE_VLPR, &s_config.vlpr.clock)) {
+        return POWER_SRV_ERROR;
+    }
+
+    /* RUN tạm chạy SIRC để tắt được SPLL / SOSC / FIRC (không có trong VLPR) */
+    if (!SCG_SetSystemClockConfig(SCG_SYSTEM_CLOCK_MODE_RUN, &s_config.vlpr.clock)) {
+        return POWER_SRV_ERROR;
+    }
+
+    s_vlpr_stopped = 0U;
+    for (i = 0U; i < (sizeof(stop_order) / sizeof(stop_order[0])); i++) {
+        if (SCG_IsClockValid(stop_order[i]) && SCG_DisableClock(stop_order[i])) {
+            s_vlpr_stopped |= (uint8_t)(1U << stop_order[i]);
+        }
+    }
+
+    status = POWER_SRV_EnterRunMode(SMC_RUN_MODE_VLPR, SCG_SYSTEM_CLOCK_MODE_VLPR);
+    if (status != POWER_SRV_SUCCESS) {
+        /* Vẫn ở RUN: khôi phục clock như trước */
+        (void)POWER_SRV_RestoreRunClock();
+    }
+
+    return status;
+}
+
+static power_srv_status_t POWER_SRV_VlprToRun(void)
+{
+    /* RCCR vẫn là SIRC (park lúc vào VLPR) */
+    power_srv_status_t status = POWER_SRV_EnterRunMode(SMC_RUN_MODE_RUN, SCG_SYSTEM_CLOCK_MODE_RUN);
+
+    if (status != POWER_SRV_SUCCESS) {
+        return status;
+    }
+
+    return POWER_SRV_RestoreRunClock();
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+power_srv_status_t POWER_SRV_Init(const power_srv_config_t *config)
+{
+    uint32_t i;
+
+    if (config == NULL) {
+        return POWER_SRV_ERROR;
+    }
+
+    if (config->allow_vlpr && (config->vlpr.clock.source != SCG_CLOCK_SRC_SIRC)) {
+        return POWER_SRV_ERROR;
+    }
+
+    SMC_SetProtection(config->allow_vlpr, config->allow_hsrun);
+
+    s_config = *config;
+    s_config.vlpr.spll = NULL;
+    for (i = 0U; i < POWER_SRV_MAX_CALLBACKS; i++) {
+        s_callbacks[i].callback = NULL;
+        s_callbacks[i].user_data = NULL;
+    }
+    s_vlpr_stopped = 0U;
+    s_mode = POWER_SRV_ReadMode();
+    s_initialized = true;
+
+    return POWER_SRV_SUCCESS;
+}
+
+power_srv_status_t POWER_SRV_RegisterCallback(power_srv_callback_t callback, void *user_data)
+{
+    uint32_t i;
+
+    if (!s_initialized) {
+        return POWER_SRV_NOT_INITIALIZED;
+    }
+
+    if (callback == NULL) {
+        return POWER_SRV_ERROR;
+    }
+
+    for (i = 0U; i < POWER_SRV_MAX_CALLBACKS; i++) {
+        if (s_callbacks[i].callback == NULL) {
+            s_callbacks[i].user_data = user_data;
+            s_callbacks[i].callback = callback;
+            return POWER_SRV_SUCCESS;
+        }
+    }
+
+    return POWER_SRV_REGISTRY_FULL;
+}
+
+power_srv_status_t POWER_SRV_UnregisterCallback(power_srv_callback_t callback, void *user_data)
+{
+    uint32_t i;
+
+    if (!s_initialized) {
+        return POWER_SRV_NOT_INITIALIZED;
+    }
+
+    for (i = 0U; i < POWER_SRV_MAX_CALLBACKS; i++) {
+        if ((s_callbacks[i].callback == callback) && (s_callbacks[i].user_data == user_data)) {
+            s_callbacks[i].callback = NULL;
+            s_callbacks[i].user_data = NULL;
+            return POWER_SRV_SUCCESS;
+        }
+    }
+
+    return POWER_SRV_ERROR;
+}
+
+power_srv_status_t POWER_SRV_SetMode(power_srv_mode_t mode)
+{
+    power_srv_status_t status = POWER_SRV_SUCCESS;
+    power_srv_mode_t from;
+    uint32_t primask;
+
+    if (!s_initialized) {
+        return POWER_SRV_NOT_INITIALIZED;
+    }
+
+    if (mode > POWER_SRV_MODE_VLPR) {
+        return POWER_SRV_ERROR;
+    }
+
+    if (((mode == POWER_SRV_MODE_HSRUN) && !s_config.allow_hsrun) ||
+        ((mode == POWER_SRV_MODE_VLPR) && !s_config.allow_vlpr)) {
+        return POWER_SRV_NOT_ALLOWED;
+    }
+
+    from = s_mode;
+    if (from == mode) {
+        return POWER_SRV_SUCCESS;
+    }
+
+    if (!POWER_SRV_NotifyBefore(from, mode)) {
+        return POWER_SRV_NOT_ALLOWED;
+    }
+
+    /* Driver notifier (UART / CAN / SysTick): AFTER đến từ ClockManager_Update() bên dưới */
+    ClockManager_NotifyBeforeChange();
+
+    /* Sequencing không bị ISR chen vào giữa lúc clock đang đổi */
+    primask = NVIC_DisableGlobalIRQ();
+
+    /* HSRUN <-> VLPR luôn đi qua RUN */
+    if (from == POWER_SRV_MODE_HSRUN) {
+        status = POWER_SRV_HsrunToRun();
+    } else if (from == POWER_SRV_MODE_VLPR) {
+        status = POWER_SRV_VlprToRun();
+    }
+
+    if (status == POWER_SRV_SUCCESS) {
+        if (mode == POWER_SRV_MODE_HSRUN) {
+            status = POWER_SRV_RunToHsrun();
+        } else if (mode == POWER_SRV_MODE_VLPR) {
+            status = POWER_SRV_RunToVlpr();
+        }
+    }
+
+    NVIC_EnableGlobalIRQ(primask);
+
+    s_mode = POWER_SRV_ReadMode();
+
+    /* Cache phải phản ánh clock thật trước AFTER / ABORTED, kể cả khi fail giữa chừng */
+    ClockManager_Update();
+
+    POWER_SRV_Notify((status == POWER_SRV_SUCCESS) ? POWER_SRV_EVENT_AFTER : POWER_SRV_EVENT_ABORTED,
+                     from, mode, POWER_SRV_MAX_CALLBACKS);
+
+    return status;
+}
+
+power_srv_mode_t POWER_SRV_GetMode(void)
+{
+    return s_mode;
+}
@@ -0,0 +1,180 @@
+/**
+ * @file    prof_srv.c
+ * @brief   Profiling Service Layer Implementation
+ * @details Implementation của DWT probes: min / max / avg accumulation và UART dump
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../inc/prof_srv.h"
+#include "nvic.h"
+#include <stddef.h>
+#include <stdio.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+
+/* Cortex-M4 DWT (ARMv7-M debug registers) */
+#define PROF_SRV_DEMCR              (*(volatile uint32_t *)0xE000EDFCUL)
+#define PROF_SRV_DEMCR_TRCENA       (0x01000000UL)
+#define PROF_SRV_DWT_CTRL           (*(volatile uint32_t *)0xE0001000UL)
+#define PROF_SRV_DWT_CTRL_CYCCNTENA (0x00000001UL)
+#define PROF_SRV_DWT_CTRL_NOCYCCNT  (0x02000000UL)
+
+/* Số lần đo probe rỗng khi calibrate */
+#define PROF_SRV_CALIBRATE_RUNS     (16U)
+
+#define PROF_SRV_LINE_SIZE          (96U)
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static prof_srv_probe_t *s_prof_list = NULL;
+static uint32_t s_prof_overhead = 0U;
+static bool s_prof_initialized = false;
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+prof_srv_status_t PROF_SRV_Init(void)
+{
+    prof_srv_probe_t probe = PROF_SRV_PROBE_INIT("calibrate");
+    uint32_t cycles;
+    uint32_t i;
+
+    PROF_SRV_DEMCR |= PROF_SRV_DEMCR_TRCENA;
+    if ((PROF_SRV_DWT_CTRL & PROF_SRV_DWT_CTRL_NOCYCCNT) != 0U) {
+        return PROF_SRV_ERROR;
+    }
+    PROF_SRV_DWT_CTRL |= PROF_SRV_DWT_CTRL_CYCCNTENA;
+
+    /* Overhead = min của begin / end rỗng (cùng code sinh ra như macro) */
+    for (i = 0U; i < PROF_SRV_CALIBRATE_RUNS; i++) {
+        probe.start = PROF_SRV_CYCCNT;
+        cycles = PROF_SRV_CYCCNT - probe.start;
+        if (cycles < probe.min) {
+            probe.min = cycles;
+        }
+    }
+    s_prof_overhead = probe.min;
+    s_prof_initialized = true;
+
+    return PROF_SRV_SUCCESS;
+}
+
+void PROF_SRV_Record(prof_srv_probe_t *probe, uint32_t cycles)
+{
+    uint32_t basepri;
+
+    if (probe == NULL) {
+        return;
+    }
+
+    cycles = (cycles > s_prof_overhead) ? (cycles - s_prof_overhead) : 0U;
+
+    basepri = NVIC_EnterCritical();
+
+    if (!probe->registered) {
+        probe->next = s_prof_list;
+        s_prof_list = probe;
+        probe->registered = true;
+    }
+
+    probe->count++;
+    probe->total += cycles;
+    if (cycles < probe->min) {
+        probe->min = cycles;
+    }
+    if (cycles > probe->max) {
+        probe->max = cycles;
+    }
+
+    NVIC_ExitCritical(basepri);
+}
+
+void PROF_SRV_Reset(prof_srv_probe_t *probe)
+{
+    uint32_t basepri;
+
+    if (probe == NULL) {
+        return;
+    }
+
+    basepri = NVIC_EnterCritical();
+    probe->count = 0U;
+    probe->total = 0U;
+    probe->min = 0xFFFFFFFFUL;
+    probe->max = 0U;
+    NVIC_ExitCritical(basepri);
+}
+
+void PROF_SRV_ResetAll(void)
+{
+    prof_srv_probe_t *probe;
+
+    for (probe = s_prof_list; probe != NULL; probe = probe->next) {
+        PROF_SRV_Reset(probe);
+    }
+}
+
+uint32_t PROF_SRV_GetOverhead(void)
+{
+    return s_prof_overhead;
+}
+
+prof_srv_status_t PROF_SRV_Dump(LPUART_RegType *base)
+{
+    char line[PROF_SRV_LINE_SIZE];
+    const prof_srv_probe_t *probe;
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    uint32_t basepri;
+    int len;
+
+    if (!s_prof_initialized) {
+        return PROF_SRV_NOT_INITIALIZED;
+    }
+
+    if (base == NULL) {
+        return PROF_SRV_ERROR;
+    }
+
+    len = snprintf(line, sizeof(line), "%-24s %10s %10s %10s %10s\r\n",
+                   "probe", "count", "min", "avg", "max");
+    (void)UART_SendBlocking(base, (const uint8_t *)line, (uint32_t)len);
+
+    for (probe = s_prof_list; probe != NULL; probe = probe->next) {
+        /* Snapshot: probe có thể được update từ ISR trong lúc in */
+        basepri = NVIC_EnterCritical();
+        count = probe->count;
+        min = probe->min;
+        max = probe->max;
+        total = probe->total;
+        NVIC_ExitCritical(basepri);
+
+        if (count == 0U) {
+            len = snprintf(line, sizeof(line), "%-24s %10lu %10s %10s %10s\r\n",
+                           probe->name, 0UL, "-", "-", "-");
+        } else {
+            len = snprintf(line, sizeof(line), "%-24s %10lu %10lu %10lu %10lu\r\n",
+                           probe->name, (unsigned long)count, (unsigned long)min,
+                           (unsigned long)(total / count), (unsigned long)max);
+        }
+
+        if (len > (int)(sizeof(line) - 1U)) {
+            len = (int)(sizeof(line) - 1U);
+        }
+        (void)UART_SendBlocking(base, (const uint8_t *)line, (uint32_t)len);
+    }
+
+    return PROF_SRV_SUCCESS;
+}
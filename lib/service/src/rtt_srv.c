@@ -0,0 +1,322 @@
+/**
+ * @file    rtt_srv.c
+ * @brief   RTT Service Layer Implementation
+ * @details Control block SEGGER RTT trong RAM, ring up / down dùng byte
+ *          offset, data được publish bằng DMB rồi mới ghi offset
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../inc/rtt_srv.h"
+#include "nvic.h"
+#include "atomic.h"
+#include <string.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+#define RTT_SRV_MODE_MASK               (0x3U)
+
+#if (RTT_SRV_MAX_UP_BUFFERS < 1U) || (RTT_SRV_MAX_DOWN_BUFFERS < 1U)
+#error "RTT needs at least one up and one down buffer (terminal)"
+#endif
+
+/*******************************************************************************
+ * Public Variables
+ ******************************************************************************/
+/* Tên symbol theo SEGGER: J-Link / pyOCD tìm control block theo symbol này */
+rtt_srv_cb_t _SEGGER_RTT DMA_BUFFER_SRAM_U;
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static char s_terminal_up[RTT_SRV_TERMINAL_UP_SIZE] DMA_BUFFER_SRAM_U;
+static char s_terminal_down[RTT_SRV_TERMINAL_DOWN_SIZE] DMA_BUFFER_SRAM_U;
+static bool s_rtt_initialized = false;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static uint32_t RTT_SRV_UpFree(const rtt_srv_buffer_t *up)
+{
+    uint32_t rd = up->rd_off;
+    uint32_t wr = up->wr_off;
+
+    /* Một byte luôn trống: wr == rd nghĩa là rỗng */
+    if (rd > wr) {
+        return rd - wr - 1U;
+    }
+
+    return up->size - 1U - (wr - rd);
+}
+
+/**
+ * @brief Copy vào ring (tối đa 2 đoạn) rồi publish WrOff
+ */
+static void RTT_SRV_CopyUp(rtt_srv_buffer_t *up, const uint8_t *data, uint32_t length)
+{
+    uint32_t wr = up->wr_off;
+    uint32_t first = up->size - wr;
+
+    if (first > length) {
+        first = length;
+    }
+
+    memcpy(&up->buffer[wr], data, first);
+    memcpy(&up->buffer[0], &data[first], length - first);
+
+    wr += length;
+    if (wr >= up->size) {
+        wr -= up->size;
+    }
+
+    /* Probe chỉ được thấy WrOff mới sau khi data đã nằm trong RAM */
+    ATOMIC_Barrier();
+    up->wr_off = wr;
+}
+
+static rtt_srv_buffer_t *RTT_SRV_GetUp(uint8_t channel)
+{
+    if (!s_rtt_initialized || (channel >= RTT_SRV_MAX_UP_BUFFERS) ||
+        (_SEGGER_RTT.up[channel].buffer == NULL)) {
+        return NULL;
+    }
+
+    return &_SEGGER_RTT.up[channel];
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+rtt_srv_status_t RTT_SRV_Init(void)
+{
+    rtt_srv_cb_t *cb = &_SEGGER_RTT;
+
+    memset(cb, 0, sizeof(*cb));
+    cb->max_up = (int32_t)RTT_SRV_MAX_UP_BUFFERS;
+    cb->max_down = (int32_t)RTT_SRV_MAX_DOWN_BUFFERS;
+
+    cb->up[0].name = "Terminal";
+    cb->up[0].buffer = s_terminal_up;
+    cb->up[0].size = RTT_SRV_TERMINAL_UP_SIZE;
+    cb->up[0].flags = (uint32_t)RTT_SRV_MODE_NO_BLOCK_SKIP;
+
+    cb->down[0].name = "Terminal";
+    cb->down[0].buffer = s_terminal_down;
+    cb->down[0].size = RTT_SRV_TERMINAL_DOWN_SIZE;
+    cb->down[0].flags = (uint32_t)RTT_SRV_MODE_NO_BLOCK_SKIP;
+
+    /* ID ghi cuối và tách hai phần: image trong flash không chứa chuỗi đầy
+       đủ, probe không nhận nhầm control block chưa khởi tạo */
+    ATOMIC_Barrier();
+    memcpy(&cb->id[7], "RTT", 4U);
+    ATOMIC_Barrier();
+    memcpy(&cb->id[0], "SEGGER", 6U);
+    ATOMIC_Barrier();
+    cb->id[6] = ' ';
+
+    s_rtt_initialized = true;
+
+    return RTT_SRV_SUCCESS;
+}
+
+rtt_srv_status_t RTT_SRV_ConfigUpBuffer(uint8_t channel, const char *name, void *buffer,
+                                        uint32_t size, rtt_srv_mode_t mode)
+{
+    rtt_srv_buffer_t *up;
+    uint32_t basepri;
+
+    if (!s_rtt_initialized) {
+        return RTT_SRV_NOT_INITIALIZED;
+    }
+
+    if ((channel >= RTT_SRV_MAX_UP_BUFFERS) || (buffer == NULL) || (size < 2U) ||
+        ((uint32_t)mode > (uint32_t)RTT_SRV_MODE_BLOCK)) {
+        return RTT_SRV_ERROR;
+    }
+
+    up = &_SEGGER_RTT.up[channel];
+
+    basepri = NVIC_EnterCritical();
+    up->buffer = NULL;
+    ATOMIC_Barrier();
+    up->name = name;
+    up->size = size;
+    up->wr_off = 0U;
+    up->rd_off = 0U;
+    up->flags = (uint32_t)mode;
+    ATOMIC_Barrier();
+    up->buffer = (char *)buffer;
+    NVIC_ExitCritical(basepri);
+
+    return RTT_SRV_SUCCESS;
+}
+
+rtt_srv_status_t RTT_SRV_ConfigDownBuffer(uint8_t channel, const char *name, void *buffer,
+                                          uint32_t size)
+{
+    rtt_srv_buffer_t *down;
+
+    if (!s_rtt_initialized) {
+        return RTT_SRV_NOT_INITIALIZED;
+    }
+
+    if ((channel >= RTT_SRV_MAX_DOWN_BUFFERS) || (buffer == NULL) || (size < 2U)) {
+        return RTT_SRV_ERROR;
+    }
+
+    down = &_SEGGER_RTT.down[channel];
+    down->buffer = NULL;
+    ATOMIC_Barrier();
+    down->name = name;
+    down->size = size;
+    down->wr_off = 0U;
+    down->rd_off = 0U;
+    down->flags = (uint32_t)RTT_SRV_MODE_NO_BLOCK_SKIP;
+    ATOMIC_Barrier();
+    down->buffer = (char *)buffer;
+
+    return RTT_SRV_SUCCESS;
+}
+
+uint32_t RTT_SRV_Write(uint8_t channel, const void *data, uint32_t length)
+{
+    rtt_srv_buffer_t *up = RTT_SRV_GetUp(channel);
+    const uint8_t *src = (const uint8_t *)data;
+    uint32_t written = 0U;
+    uint32_t basepri;
+    uint32_t chunk;
+
+    if ((up == NULL) || (data == NULL) || (length == 0U)) {
+        return 0U;
+    }
+
+    if ((up->flags & RTT_SRV_MODE_MASK) == (uint32_t)RTT_SRV_MODE_BLOCK) {
+        /* Ghi từng phần vừa chỗ, chờ host đọc ngoài critical section */
+        while (written < length) {
+            basepri = NVIC_EnterCritical();
+            chunk = RTT_SRV_UpFree(up);
+            if (chunk > (length - written)) {
+                chunk = length - written;
+            }
+            if (chunk != 0U) {
+                RTT_SRV_CopyUp(up, &src[written], chunk);
+            }
+            NVIC_ExitCritical(basepri);
+            written += chunk;
+        }
+        return written;
+    }
+
+    basepri = NVIC_EnterCritical();
+    chunk = RTT_SRV_UpFree(up);
+    if (length > chunk) {
+        if ((up->flags & RTT_SRV_MODE_MASK) == (uint32_t)RTT_SRV_MODE_NO_BLOCK_SKIP) {
+            NVIC_ExitCritical(basepri);
+            return 0U;
+        }
+        length = chunk;
+    }
+    if (length != 0U) {
+        RTT_SRV_CopyUp(up, src, length);
+    }
+    NVIC_ExitCritical(basepri);
+
+    return length;
+}
+
+uint32_t RTT_SRV_WriteString(uint8_t channel, const char *str)
+{
+    if (str == NULL) {
+        return 0U;
+    }
+
+    return RTT_SRV_Write(channel, str, (uint32_t)strlen(str));
+}
+
+uint32_t RTT_SRV_GetFreeSpace(uint8_t channel)
+{
+    rtt_srv_buffer_t *up = RTT_SRV_GetUp(channel);
+
+    return (up != NULL) ? RTT_SRV_UpFree(up) : 0U;
+}
+
+uint32_t RTT_SRV_Read(uint8_t channel, void *buffer, uint32_t size)
+{
+    rtt_srv_buffer_t *down;
+    uint8_t *dst = (uint8_t *)buffer;
+    uint32_t rd;
+    uint32_t wr;
+    uint32_t end;
+    uint32_t chunk;
+    uint32_t n = 0U;
+
+    if (!s_rtt_initialized || (channel >= RTT_SRV_MAX_DOWN_BUFFERS) || (buffer == NULL)) {
+        return 0U;
+    }
+
+    down = &_SEGGER_RTT.down[channel];
+    if (down->buffer == NULL) {
+        return 0U;
+    }
+
+    /* Một consumer duy nhất: rd_off chỉ target ghi */
+    rd = down->rd_off;
+    wr = down->wr_off;
+    while ((rd != wr) && (n < size)) {
+        end = (wr > rd) ? wr : down->size;
+        chunk = end - rd;
+        if (chunk > (size - n)) {
+            chunk = size - n;
+        }
+        memcpy(&dst[n], &down->buffer[rd], chunk);
+        n += chunk;
+        rd += chunk;
+        if (rd >= down->size) {
+            rd = 0U;
+        }
+    }
+
+    if (n != 0U) {
+        ATOMIC_Barrier();
+        down->rd_off = rd;
+    }
+
+    return n;
+}
+
+bool RTT_SRV_HasData(uint8_t channel)
+{
+    if (!s_rtt_initialized || (channel >= RTT_SRV_MAX_DOWN_BUFFERS) ||
+        (_SEGGER_RTT.down[channel].buffer == NULL)) {
+        return false;
+    }
+
+    return _SEGGER_RTT.down[channel].wr_off != _SEGGER_RTT.down[channel].rd_off;
+}
+
+uint32_t RTT_SRV_GetUpReadOffset(uint8_t channel)
+{
+    rtt_srv_buffer_t *up = RTT_SRV_GetUp(channel);
+
+    return (up != NULL) ? up->rd_off : 0U;
+}
+
+void RTT_SRV_SetUpWriteOffset(uint8_t channel, uint32_t offset)
+{
+    rtt_srv_buffer_t *up = RTT_SRV_GetUp(channel);
+
+    if ((up == NULL) || (offset >= up->size)) {
+        return;
+    }
+
+    ATOMIC_Barrier();
+    up->wr_off = offset;
+}
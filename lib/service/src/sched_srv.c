@@ -0,0 +1,187 @@
+/**
+ * @file    sched_srv.c
+ * @brief   Scheduler Service Layer Implementation
+ * @details Implementation của priority event queues, dispatcher và idle
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../inc/sched_srv.h"
+#include "nvic.h"
+#include "atomic.h"
+#include "lfqueue.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+#if (SCHED_SRV_PRIORITIES == 0U) || (SCHED_SRV_PRIORITIES > 32U)
+#error "SCHED_SRV_PRIORITIES must be 1..32"
+#endif
+
+#if (SCHED_SRV_QUEUE_SIZE & (SCHED_SRV_QUEUE_SIZE - 1U)) != 0U
+#error "SCHED_SRV_QUEUE_SIZE must be a power of 2"
+#endif
+
+/*******************************************************************************
+ * Private Types
+ ******************************************************************************/
+typedef struct {
+    const sched_srv_work_t *work;
+    uint32_t param;
+} sched_srv_event_t;
+
+/* MPSC: producer là mọi ISR / handler, consumer là dispatcher */
+typedef struct {
+    lfq_mpsc_t queue;
+    sched_srv_event_t events[SCHED_SRV_QUEUE_SIZE];
+    volatile uint32_t seq[SCHED_SRV_QUEUE_SIZE];
+    volatile uint32_t overflows;
+} sched_srv_queue_t;
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static sched_srv_queue_t s_queues[SCHED_SRV_PRIORITIES];
+static sched_srv_idle_hook_t s_idle_hook = NULL;
+static bool s_initialized = false;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static bool SCHED_SRV_IsIdle(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < SCHED_SRV_PRIORITIES; i++) {
+        if (!LFQ_MpscIsEmpty(&s_queues[i].queue)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+sched_srv_status_t SCHED_SRV_Init(void)
+{
+    uint32_t basepri;
+    uint32_t i;
+
+    basepri = NVIC_EnterCritical();
+    for (i = 0U; i < SCHED_SRV_PRIORITIES; i++) {
+        (void)LFQ_MpscInit(&s_queues[i].queue, s_queues[i].events, s_queues[i].seq,
+                           sizeof(sched_srv_event_t), SCHED_SRV_QUEUE_SIZE);
+        s_queues[i].overflows = 0U;
+    }
+    s_initialized = true;
+    NVIC_ExitCritical(basepri);
+
+    return SCHED_SRV_SUCCESS;
+}
+
+sched_srv_status_t SCHED_SRV_Post(const sched_srv_work_t *work, uint32_t param)
+{
+    sched_srv_queue_t *queue;
+    sched_srv_event_t event;
+
+    if (!s_initialized) {
+        return SCHED_SRV_NOT_INITIALIZED;
+    }
+
+    if ((work == NULL) || (work->handler == NULL) || (work->priority >= SCHED_SRV_PRIORITIES)) {
+        return SCHED_SRV_ERROR;
+    }
+
+    queue = &s_queues[work->priority];
+    event.work = work;
+    event.param = param;
+
+    /* Lock-free: post không mask interrupt */
+    if (!LFQ_MpscPush(&queue->queue, &event)) {
+        (void)ATOMIC_Add(&queue->overflows, 1);
+        return SCHED_SRV_QUEUE_FULL;
+    }
+
+    return SCHED_SRV_SUCCESS;
+}
+
+bool SCHED_SRV_RunOnce(void)
+{
+    sched_srv_event_t event;
+    uint32_t i;
+
+    if (!s_initialized) {
+        return false;
+    }
+
+    /* Queue 0 = priority cao nhất */
+    for (i = 0U; i < SCHED_SRV_PRIORITIES; i++) {
+        if (LFQ_MpscPop(&s_queues[i].queue, &event)) {
+            event.work->handler(event.param, event.work->user_data);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void SCHED_SRV_Run(void)
+{
+    uint32_t basepri;
+
+    while (1) {
+        while (SCHED_SRV_RunOnce()) {
+        }
+
+        /* Masked: event post giữa check và WFI vẫn để lại IRQ pending nên WFI return ngay */
+        basepri = NVIC_EnterCritical();
+        if (SCHED_SRV_IsIdle()) {
+            if (s_idle_hook != NULL) {
+                s_idle_hook();
+            } else {
+                NVIC_WaitForInterrupt();
+            }
+        }
+        NVIC_ExitCritical(basepri);
+    }
+}
+
+void SCHED_SRV_SetIdleHook(sched_srv_idle_hook_t hook)
+{
+    s_idle_hook = hook;
+}
+
+uint32_t SCHED_SRV_GetOverflowCount(uint8_t priority)
+{
+    if (priority >= SCHED_SRV_PRIORITIES) {
+        return 0U;
+    }
+
+    return s_queues[priority].overflows;
+}
+
+void SCHED_SRV_LpitCallback(uint8_t channel, void *userData)
+{
+    (void)SCHED_SRV_Post((const sched_srv_work_t *)userData, (uint32_t)channel);
+}
+
+void SCHED_SRV_DmaCallback(uint8_t channel, void *userData)
+{
+    (void)SCHED_SRV_Post((const sched_srv_work_t *)userData, (uint32_t)channel);
+}
+
+void SCHED_SRV_CanCallback(uint8_t instance, uint8_t mbIndex, void *userData)
+{
+    (void)SCHED_SRV_Post((const sched_srv_work_t *)userData,
+                         ((uint32_t)instance << 8U) | (uint32_t)mbIndex);
+}
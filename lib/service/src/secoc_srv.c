@@ -0,0 +1,289 @@
+/**
+ * @file    secoc_srv.c
+ * @brief   SecOC Service Layer Implementation
+ * @details Implementation của freshness counter, MAC input và TX / RX hook
+ *          cho can_srv, CMAC bằng CSEc
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../inc/secoc_srv.h"
+#include <stddef.h>
+#include <string.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+
+/* Data ID (2) + payload (<= 8) + freshness (4) */
+#define SECOC_SRV_MAC_INPUT_MAX     (14U)
+#define SECOC_SRV_FRESHNESS_SIZE    (4U)
+
+/*******************************************************************************
+ * Private Types
+ ******************************************************************************/
+typedef struct {
+    uint32_t tx_freshness;          /* Giá trị đã gửi gần nhất */
+    uint32_t rx_freshness;          /* Giá trị đã chấp nhận gần nhất */
+} secoc_srv_pdu_state_t;
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static const secoc_srv_pdu_config_t *s_pdus = NULL;
+static uint8_t s_pdu_count = 0U;
+static secoc_srv_pdu_state_t s_state[SECOC_SRV_MAX_PDUS];
+static secoc_srv_stats_t s_stats;
+static bool s_initialized = false;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static int32_t SECOC_SRV_Find(uint32_t id, bool is_extended)
+{
+    uint32_t i;
+
+    for (i = 0U; i < s_pdu_count; i++) {
+        if ((s_pdus[i].id == id) && (s_pdus[i].is_extended == is_extended)) {
+            return (int32_t)i;
+        }
+    }
+
+    return -1;
+}
+
+/* Data ID | payload | freshness, big-endian */
+static uint32_t SECOC_SRV_BuildMacInput(const secoc_srv_pdu_config_t *pdu, const uint8_t *payload,
+                                        uint32_t freshness, uint8_t *out)
+{
+    uint32_t n = 0U;
+    uint32_t i;
+
+    out[n++] = (uint8_t)(pdu->data_id >> 8U);
+    out[n++] = (uint8_t)pdu->data_id;
+    memcpy(&out[n], payload, pdu->data_length);
+    n += pdu->data_length;
+    for (i = 0U; i < SECOC_SRV_FRESHNESS_SIZE; i++) {
+        out[n++] = (uint8_t)(freshness >> (24U - (i * 8U)));
+    }
+
+    return n;
+}
+
+/* Freshness đầy đủ nhỏ nhất > last có cùng phần rút gọn với giá trị nhận được */
+static bool SECOC_SRV_RebuildFreshness(uint32_t last, uint32_t truncated, uint8_t length, uint32_t *freshness)
+{
+    uint32_t mask;
+    uint32_t candidate;
+
+    if (length >= SECOC_SRV_FRESHNESS_SIZE) {
+        candidate = truncated;
+    } else {
+        mask = (length == 0U) ? 0U : ((1UL << (length * 8U)) - 1U);
+        candidate = (last & ~mask) | truncated;
+        if (candidate <= last) {
+            candidate += mask + 1U;
+        }
+    }
+
+    /* Counter wrap: không bao giờ chấp nhận giá trị quay về */
+    if (candidate <= last) {
+        return false;
+    }
+
+    *freshness = candidate;
+    return true;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+secoc_srv_status_t SECOC_SRV_Init(const secoc_srv_pdu_config_t *pdus, uint8_t count)
+{
+    uint32_t i;
+
+    if ((pdus == NULL) || (count == 0U) || (count > SECOC_SRV_MAX_PDUS)) {
+        return SECOC_SRV_ERROR;
+    }
+
+    for (i = 0U; i < count; i++) {
+        if ((pdus[i].freshness_length > SECOC_SRV_FRESHNESS_SIZE) || (pdus[i].mac_length == 0U) ||
+            (((uint32_t)pdus[i].data_length + pdus[i].freshness_length + pdus[i].mac_length) > 8U)) {
+            return SECOC_SRV_ERROR;
+        }
+    }
+
+    s_initialized = false;
+    s_pdus = pdus;
+    s_pdu_count = count;
+    memset(s_state, 0, sizeof(s_state));
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_initialized = true;
+
+    return SECOC_SRV_SUCCESS;
+}
+
+secoc_srv_status_t SECOC_SRV_SetFreshness(uint32_t id, bool is_extended, uint32_t tx, uint32_t rx)
+{
+    int32_t index;
+
+    if (!s_initialized) {
+        return SECOC_SRV_NOT_INITIALIZED;
+    }
+
+    index = SECOC_SRV_Find(id, is_extended);
+    if (index < 0) {
+        return SECOC_SRV_INVALID_ID;
+    }
+
+    s_state[index].tx_freshness = tx;
+    s_state[index].rx_freshness = rx;
+
+    return SECOC_SRV_SUCCESS;
+}
+
+secoc_srv_status_t SECOC_SRV_GetFreshness(uint32_t id, bool is_extended, uint32_t *tx, uint32_t *rx)
+{
+    int32_t index;
+
+    if (!s_initialized) {
+        return SECOC_SRV_NOT_INITIALIZED;
+    }
+
+    if ((tx == NULL) || (rx == NULL)) {
+        return SECOC_SRV_ERROR;
+    }
+
+    index = SECOC_SRV_Find(id, is_extended);
+    if (index < 0) {
+        return SECOC_SRV_INVALID_ID;
+    }
+
+    *tx = s_state[index].tx_freshness;
+    *rx = s_state[index].rx_freshness;
+
+    return SECOC_SRV_SUCCESS;
+}
+
+bool SECOC_SRV_TxHook(can_srv_message_t *msg)
+{
+    const secoc_srv_pdu_config_t *pdu;
+    uint8_t input[SECOC_SRV_MAC_INPUT_MAX];
+    uint8_t mac[CSEC_BLOCK_SIZE];
+    uint32_t freshness;
+    uint32_t length;
+    uint32_t i;
+    int32_t index;
+
+    if (!s_initialized) {
+        return true;
+    }
+
+    index = SECOC_SRV_Find(msg->id, msg->isExtended);
+    if (index < 0) {
+        return true;
+    }
+    pdu = &s_pdus[index];
+
+    if ((msg->length != pdu->data_length) || (s_state[index].tx_freshness == 0xFFFFFFFFUL)) {
+        return false;
+    }
+
+    freshness = s_state[index].tx_freshness + 1U;
+    length = SECOC_SRV_BuildMacInput(pdu, msg->data, freshness, input);
+
+    if (CSEC_GenerateMac(pdu->key_id, input, length, mac) != STATUS_SUCCESS) {
+        s_stats.crypto_errors++;
+        return false;
+    }
+
+    /* Freshness LSB trước MAC, cả hai big-endian */
+    length = pdu->data_length;
+    for (i = pdu->freshness_length; i > 0U; i--) {
+        msg->data[length++] = (uint8_t)(freshness >> ((i - 1U) * 8U));
+    }
+    memcpy(&msg->data[length], mac, pdu->mac_length);
+    msg->length = (uint8_t)(length + pdu->mac_length);
+
+    s_state[index].tx_freshness = freshness;
+    s_stats.tx_authenticated++;
+
+    return true;
+}
+
+bool SECOC_SRV_RxHook(can_srv_message_t *msg)
+{
+    const secoc_srv_pdu_config_t *pdu;
+    uint8_t input[SECOC_SRV_MAC_INPUT_MAX];
+    uint8_t mac[CSEC_BLOCK_SIZE] = { 0U };
+    uint32_t truncated = 0U;
+    uint32_t freshness;
+    uint32_t length;
+    uint32_t i;
+    int32_t index;
+    bool verified = false;
+
+    if (!s_initialized) {
+        return true;
+    }
+
+    index = SECOC_SRV_Find(msg->id, msg->isExtended);
+    if (index < 0) {
+        return true;
+    }
+    pdu = &s_pdus[index];
+
+    if (msg->length != (pdu->data_length + pdu->freshness_length + pdu->mac_length)) {
+        s_stats.rx_length_errors++;
+        return false;
+    }
+
+    for (i = 0U; i < pdu->freshness_length; i++) {
+        truncated = (truncated << 8U) | msg->data[pdu->data_length + i];
+    }
+
+    if (!SECOC_SRV_RebuildFreshness(s_state[index].rx_freshness, truncated, pdu->freshness_length, &freshness)) {
+        s_stats.rx_mac_failed++;
+        return false;
+    }
+
+    length = SECOC_SRV_BuildMacInput(pdu, msg->data, freshness, input);
+
+    /* CSEc đọc nguyên một block, chỉ mac_length * 8 bit đầu được so sánh */
+    memcpy(mac, &msg->data[pdu->data_length + pdu->freshness_length], pdu->mac_length);
+
+    if (CSEC_VerifyMac(pdu->key_id, input, length, mac,
+                       (uint16_t)(pdu->mac_length * 8U), &verified) != STATUS_SUCCESS) {
+        s_stats.crypto_errors++;
+        return false;
+    }
+
+    if (!verified) {
+        s_stats.rx_mac_failed++;
+        return false;
+    }
+
+    s_state[index].rx_freshness = freshness;
+    msg->length = pdu->data_length;
+    s_stats.rx_authenticated++;
+
+    return true;
+}
+
+secoc_srv_status_t SECOC_SRV_GetStats(secoc_srv_stats_t *stats)
+{
+    if (stats == NULL) {
+        return SECOC_SRV_ERROR;
+    }
+
+    *stats = s_stats;
+
+    return SECOC_SRV_SUCCESS;
+}
@@ -0,0 +1,213 @@
+/**
+ * @file    stack_srv.c
+ * @brief   Stack Service Layer Implementation
+ * @details Implementation của high-water mark scan (painted stack / heap)
+ *          và DWT watchpoint guard với DebugMonitor handler
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../inc/stack_srv.h"
+#include "nvic.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+
+/* Cortex-M4 debug registers (ARMv7-M) */
+#define STACK_SRV_DEMCR             (*(volatile uint32_t *)0xE000EDFCUL)
+#define STACK_SRV_DEMCR_TRCENA      (0x01000000UL)
+#define STACK_SRV_DEMCR_MON_EN      (0x00010000UL)
+#define STACK_SRV_DWT_CTRL          (*(volatile uint32_t *)0xE0001000UL)
+#define STACK_SRV_DWT_CTRL_NUMCOMP_SHIFT (28U)
+#define STACK_SRV_DWT_COMP(n)       (*(volatile uint32_t *)(0xE0001020UL + ((n) * 16U)))
+#define STACK_SRV_DWT_MASK(n)       (*(volatile uint32_t *)(0xE0001024UL + ((n) * 16U)))
+#define STACK_SRV_DWT_FUNCTION(n)   (*(volatile uint32_t *)(0xE0001028UL + ((n) * 16U)))
+#define STACK_SRV_DWT_FUNCTION_WRITE (0x6UL)    /* Watchpoint on write access */
+#define STACK_SRV_DFSR_DWTTRAP      (0x00000004UL)
+
+/* SHPR index của DebugMonitor (exception 12) */
+#define STACK_SRV_SHPR_DEBUGMON     (8U)
+
+/* Stacked PC trong exception frame */
+#define STACK_SRV_FRAME_PC          (6U)
+
+#if ((STACK_SRV_GUARD_SIZE & (STACK_SRV_GUARD_SIZE - 1U)) != 0U) || (STACK_SRV_GUARD_SIZE < 4U)
+#error "STACK_SRV_GUARD_SIZE must be a power of two >= 4"
+#endif
+
+/*******************************************************************************
+ * Linker Symbols
+ ******************************************************************************/
+extern uint32_t __StackTop[];
+extern uint32_t __StackLimit[];
+extern uint32_t __HeapBase[];
+extern uint32_t __HeapLimit[];
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static stack_srv_overflow_cb_t s_callback = NULL;
+static volatile uint32_t s_overflow_count = 0U;
+static bool s_painted = false;
+static bool s_initialized = false;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/* log2 cho DWT MASK: số bit địa chỉ bỏ qua khi so sánh */
+static uint32_t STACK_SRV_Log2(uint32_t value)
+{
+    uint32_t bits = 0U;
+
+    while (value > 1U) {
+        value >>= 1U;
+        bits++;
+    }
+
+    return bits;
+}
+
+/* Gọi từ STACK_SRV_DebugMonHandler với con trỏ tới exception frame */
+static void __attribute__((used)) STACK_SRV_DebugMonDispatch(const uint32_t *frame)
+{
+    if ((SCB->DFSR & STACK_SRV_DFSR_DWTTRAP) == 0U) {
+        /* Debug event khác (BKPT, vector catch), không thuộc service */
+        return;
+    }
+
+    SCB->DFSR = STACK_SRV_DFSR_DWTTRAP;
+    STACK_SRV_DWT_FUNCTION(STACK_SRV_DWT_COMPARATOR) = 0U;
+    s_overflow_count++;
+
+    if (s_callback != NULL) {
+        s_callback(frame[STACK_SRV_FRAME_PC]);
+    } else {
+        NVIC_SystemReset();
+    }
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+stack_srv_status_t STACK_SRV_Init(stack_srv_overflow_cb_t callback)
+{
+    uint32_t guard;
+    uint32_t comparators;
+
+    /* Word thấp nhất của stack chỉ còn pattern nếu startup đã tô */
+    s_painted = (__StackLimit[0] == STACK_SRV_PATTERN);
+
+    guard = ((uint32_t)__StackLimit + STACK_SRV_GUARD_RESERVE + (STACK_SRV_GUARD_SIZE - 1U)) &
+            ~(STACK_SRV_GUARD_SIZE - 1U);
+    if ((guard + STACK_SRV_GUARD_SIZE) > (uint32_t)__StackTop) {
+        return STACK_SRV_ERROR;
+    }
+
+    STACK_SRV_DEMCR |= STACK_SRV_DEMCR_TRCENA;
+    comparators = STACK_SRV_DWT_CTRL >> STACK_SRV_DWT_CTRL_NUMCOMP_SHIFT;
+    if (comparators <= STACK_SRV_DWT_COMPARATOR) {
+        return STACK_SRV_ERROR;
+    }
+
+    if (NVIC_InstallHandler(DebugMonitor_IRQn, STACK_SRV_DebugMonHandler) != NVIC_STATUS_SUCCESS) {
+        return STACK_SRV_ERROR;
+    }
+
+    s_callback = callback;
+
+    /* Priority cao nhất: overflow trong ISR bất kỳ cũng được bắt */
+    SCB->SHPR[STACK_SRV_SHPR_DEBUGMON] = 0U;
+    SCB->DFSR = STACK_SRV_DFSR_DWTTRAP;
+
+    STACK_SRV_DWT_FUNCTION(STACK_SRV_DWT_COMPARATOR) = 0U;
+    STACK_SRV_DWT_COMP(STACK_SRV_DWT_COMPARATOR) = guard;
+    STACK_SRV_DWT_MASK(STACK_SRV_DWT_COMPARATOR) = STACK_SRV_Log2(STACK_SRV_GUARD_SIZE);
+    STACK_SRV_DWT_FUNCTION(STACK_SRV_DWT_COMPARATOR) = STACK_SRV_DWT_FUNCTION_WRITE;
+    STACK_SRV_DEMCR |= STACK_SRV_DEMCR_MON_EN;
+
+    s_initialized = true;
+
+    return STACK_SRV_SUCCESS;
+}
+
+stack_srv_status_t STACK_SRV_GetStackUsage(stack_srv_usage_t *usage)
+{
+    const volatile uint32_t *word = __StackLimit;
+    const volatile uint32_t *top = __StackTop;
+
+    if (usage == NULL) {
+        return STACK_SRV_ERROR;
+    }
+
+    if (!s_initialized) {
+        return STACK_SRV_NOT_INITIALIZED;
+    }
+
+    if (!s_painted) {
+        return STACK_SRV_NOT_PAINTED;
+    }
+
+    /* Stack tăng xuống: word đầu tiên từ đáy bị ghi là điểm sâu nhất */
+    while ((word < top) && (*word == STACK_SRV_PATTERN)) {
+        word++;
+    }
+
+    usage->size = (uint32_t)top - (uint32_t)__StackLimit;
+    usage->used = (uint32_t)top - (uint32_t)word;
+    usage->free = usage->size - usage->used;
+
+    return STACK_SRV_SUCCESS;
+}
+
+stack_srv_status_t STACK_SRV_GetHeapUsage(stack_srv_usage_t *usage)
+{
+    const volatile uint32_t *base = __HeapBase;
+    const volatile uint32_t *word = __HeapLimit;
+
+    if (usage == NULL) {
+        return STACK_SRV_ERROR;
+    }
+
+    if (!s_initialized) {
+        return STACK_SRV_NOT_INITIALIZED;
+    }
+
+    if (!s_painted) {
+        return STACK_SRV_NOT_PAINTED;
+    }
+
+    /* Heap tăng lên: word cao nhất bị ghi là đỉnh _sbrk từng đạt */
+    while ((word > base) && (*(word - 1) == STACK_SRV_PATTERN)) {
+        word--;
+    }
+
+    usage->size = (uint32_t)__HeapLimit - (uint32_t)base;
+    usage->used = (uint32_t)word - (uint32_t)base;
+    usage->free = usage->size - usage->used;
+
+    return STACK_SRV_SUCCESS;
+}
+
+uint32_t STACK_SRV_GetOverflowCount(void)
+{
+    return s_overflow_count;
+}
+
+/* Frame nằm trên MSP hoặc PSP tùy EXC_RETURN bit 2 */
+__attribute__((naked)) void STACK_SRV_DebugMonHandler(void)
+{
+    __asm volatile ("tst   lr, #4\n\t"
+                    "ite   eq\n\t"
+                    "mrseq r0, msp\n\t"
+                    "mrsne r0, psp\n\t"
+                    "b     STACK_SRV_DebugMonDispatch");
+}
@@ -0,0 +1,142 @@
+/**
+ * @file    time_srv.c
+ * @brief   Time Service Layer Implementation
+ * @details Implementation của 64-bit us clock: LPIT prescaler channel + chained
+ *          32-bit us counter, 32 bit cao đếm bằng wrap interrupt
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../inc/time_srv.h"
+#include "lpit.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+#define TIME_SRV_COUNTER_TOP        (0xFFFFFFFFUL)
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static volatile uint32_t s_time_epoch = 0U;    /* Upper 32 bit, tăng mỗi wrap */
+static uint8_t s_time_channel = 0U;
+static bool s_time_initialized = false;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static void TIME_SRV_OnWrap(uint8_t channel, void *userData)
+{
+    (void)channel;
+    (void)userData;
+
+    s_time_epoch++;
+}
+
+/* Counter đếm xuống, elapsed = TOP - CVAL */
+static inline uint32_t TIME_SRV_ReadCounter(void)
+{
+    uint32_t value = TIME_SRV_COUNTER_TOP;
+
+    (void)LPIT_GetCurrentValue(s_time_channel, &value);
+
+    return TIME_SRV_COUNTER_TOP - value;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+time_srv_status_t TIME_SRV_Init(uint8_t channel)
+{
+    lpit_channel_config_t config = {
+        .channel = 0U,
+        .mode = LPIT_MODE_32BIT_PERIODIC,
+        .period = 0U,
+        .enableInterrupt = false,
+        .chainChannel = false,
+        .startOnTrigger = false,
+        .stopOnInterrupt = false,
+        .reloadOnTrigger = false
+    };
+    uint32_t freq = LPIT_GetClockFreq();
+
+    if ((channel == 0U) || (channel >= LPIT_MAX_CHANNELS) ||
+        (freq < 1000000U) || ((freq % 1000000U) != 0U)) {
+        return TIME_SRV_ERROR;
+    }
+
+    s_time_initialized = false;
+    (void)LPIT_StopChannel(channel);
+    (void)LPIT_StopChannel(channel - 1U);
+
+    /* Prescaler: expire mỗi 1 us, trigger channel kế tiếp */
+    config.channel = channel - 1U;
+    config.period = (freq / 1000000U) - 1U;
+    if (LPIT_ConfigChannel(&config) != STATUS_SUCCESS) {
+        return TIME_SRV_ERROR;
+    }
+
+    /* us counter: đếm mỗi lần prescaler expire, interrupt khi wrap */
+    config.channel = channel;
+    config.period = TIME_SRV_COUNTER_TOP;
+    config.enableInterrupt = true;
+    config.chainChannel = true;
+    if ((LPIT_ConfigChannel(&config) != STATUS_SUCCESS) ||
+        (LPIT_InstallCallback(channel, TIME_SRV_OnWrap, NULL) != STATUS_SUCCESS)) {
+        return TIME_SRV_ERROR;
+    }
+
+    s_time_channel = channel;
+    s_time_epoch = 0U;
+
+    /* Chained channel trước để không mất trigger đầu tiên */
+    (void)LPIT_StartChannel(channel);
+    (void)LPIT_StartChannel(channel - 1U);
+
+    s_time_initialized = true;
+
+    return TIME_SRV_SUCCESS;
+}
+
+uint64_t TIME_SRV_GetMicros64(void)
+{
+    uint32_t epoch;
+    uint32_t low;
+    bool pending;
+
+    if (!s_time_initialized) {
+        return 0U;
+    }
+
+    /* Retry nếu wrap handler chạy giữa hai lần đọc epoch */
+    do {
+        epoch = s_time_epoch;
+        low = TIME_SRV_ReadCounter();
+        pending = LPIT_GetInterruptFlag(s_time_channel);
+    } while (epoch != s_time_epoch);
+
+    /* Wrap đã xảy ra nhưng handler chưa chạy (caller priority cao hơn / IRQ masked):
+     * low nhỏ nghĩa là counter đã được đọc sau wrap */
+    if (pending && (low < 0x80000000UL)) {
+        epoch++;
+    }
+
+    return ((uint64_t)epoch << 32) | (uint64_t)low;
+}
+
+uint32_t TIME_SRV_GetMicros32(void)
+{
+    if (!s_time_initialized) {
+        return 0U;
+    }
+
+    return TIME_SRV_ReadCounter();
+}
@@ -0,0 +1,539 @@
+/**
+ * @file    timer_srv.c
+ * @brief   Soft Timer Service Layer Implementation
+ * @details Implementation của hierarchical timing wheel trên một LPIT channel
+ *          chạy one-shot tới deadline kế tiếp (tickless)
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../inc/timer_srv.h"
+#include "lpit.h"
+#include "lptmr.h"
+#include "nvic.h"
+#include "smc.h"
+#include "systick.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+#define TIMER_SRV_WHEEL_BITS        (5U)
+#define TIMER_SRV_WHEEL_SLOTS       (1UL << TIMER_SRV_WHEEL_BITS)
+#define TIMER_SRV_WHEEL_MASK        (TIMER_SRV_WHEEL_SLOTS - 1U)
+
+#if (TIMER_SRV_LEVELS == 0U) || ((TIMER_SRV_LEVELS * TIMER_SRV_WHEEL_BITS) > 30U)
+#error "TIMER_SRV_LEVELS must be 1-6"
+#endif
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static timer_srv_timer_t *s_wheel[TIMER_SRV_LEVELS][TIMER_SRV_WHEEL_SLOTS];
+static uint32_t s_occupied[TIMER_SRV_LEVELS];   /* Bit n = slot n non-empty */
+
+static uint32_t s_now = 0U;                 /* Wheel time (ticks) */
+static uint32_t s_deadline = 0U;            /* Tick at which the LPIT one-shot fires */
+static uint32_t s_arm_base = 0U;            /* Tick at which the one-shot was started */
+static uint32_t s_arm_carry = 0U;           /* Counts of s_arm_base already elapsed at start */
+static uint32_t s_arm_counts = 0U;          /* Counts of the running one-shot */
+static uint32_t s_counts_per_tick = 0U;
+static uint32_t s_max_sleep = 0U;           /* Longest one-shot (ticks) */
+static uint8_t s_channel = 0U;
+static bool s_processing = false;           /* Inside the expiry handler */
+static bool s_initialized = false;
+static uint32_t s_idle_us_remainder = 0U;   /* SysTick compensation < 1 ms */
+static bool s_lptmr_sleep = false;          /* Long VLPS idle on LPTMR0 */
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/* Level theo khoảng cách tới expiry, slot theo expiry tuyệt đối */
+static void TIMER_SRV_Link(timer_srv_timer_t *timer, uint32_t base)
+{
+    uint32_t delta = timer->expires - base;
+    uint32_t level = 0U;
+    uint32_t slot;
+
+    while ((level < (TIMER_SRV_LEVELS - 1U)) &&
+           (delta >= (1UL << (TIMER_SRV_WHEEL_BITS * (level + 1U))))) {
+        level++;
+    }
+    slot = (timer->expires >> (TIMER_SRV_WHEEL_BITS * level)) & TIMER_SRV_WHEEL_MASK;
+
+    timer->level = (uint8_t)level;
+    timer->slot = (uint8_t)slot;
+    timer->prev = NULL;
+    timer->next = s_wheel[level][slot];
+    if (timer->next != NULL) {
+        timer->next->prev = timer;
+    }
+    s_wheel[level][slot] = timer;
+    s_occupied[level] |= (1UL << slot);
+    timer->active = true;
+}
+
+static void TIMER_SRV_Unlink(timer_srv_timer_t *timer)
+{
+    if (timer->prev != NULL) {
+        timer->prev->next = timer->next;
+    } else {
+        s_wheel[timer->level][timer->slot] = timer->next;
+    }
+    if (timer->next != NULL) {
+        timer->next->prev = timer->prev;
+    }
+    if (s_wheel[timer->level][timer->slot] == NULL) {
+        s_occupied[timer->level] &= ~(1UL << timer->slot);
+    }
+    timer->active = false;
+}
+
+/* Ticks từ s_now tới event kế tiếp: expiry ở level 0 hoặc cascade ở level cao hơn */
+static uint32_t TIMER_SRV_NextEvent(void)
+{
+    uint32_t best = s_max_sleep;
+    uint32_t level;
+    uint32_t shift;
+    uint32_t index;
+    uint32_t rot;
+    uint32_t delta;
+
+    for (level = 0U; level < TIMER_SRV_LEVELS; level++) {
+        if (s_occupied[level] == 0U) {
+            continue;
+        }
+
+        shift = TIMER_SRV_WHEEL_BITS * level;
+        index = ((s_now >> shift) + 1U) & TIMER_SRV_WHEEL_MASK;
+
+        /* Xoay bitmap để bit 0 là slot ngay sau slot hiện tại */
+        rot = s_occupied[level];
+        if (index != 0U) {
+            rot = (rot >> index) | (rot << (TIMER_SRV_WHEEL_SLOTS - index));
+        }
+
+        delta = ((((s_now >> shift) + 1U + (uint32_t)__builtin_ctz(rot)) << shift)) - s_now;
+        if (delta < best) {
+            best = delta;
+        }
+    }
+
+    return best;
+}
+
+/* Whole ticks since s_arm_base, counts of the next tick in *remainder */
+static uint32_t TIMER_SRV_Elapsed(uint32_t *remainder)
+{
+    uint32_t value = 0U;
+    uint32_t counts;
+
+    (void)LPIT_GetCurrentValue(s_channel, &value);
+    counts = (value < s_arm_counts) ? ((s_arm_counts - 1U) - value) : 0U;
+    counts += s_arm_carry;
+
+    *remainder = counts % s_counts_per_tick;
+
+    return counts / s_counts_per_tick;
+}
+
+/* Thời gian hiện tại (ticks), gọi với interrupt masked */
+static uint32_t TIMER_SRV_Now(void)
+{
+    uint32_t remainder;
+
+    if (s_processing) {
+        return s_now;
+    }
+
+    /* Deadline đã tới, handler pending */
+    if (LPIT_GetInterruptFlag(s_channel)) {
+        return s_deadline;
+    }
+
+    return s_arm_base + TIMER_SRV_Elapsed(&remainder);
+}
+
+static void TIMER_SRV_DelayCallback(timer_srv_timer_t *timer, void *user_data)
+{
+    (void)timer;
+
+    *(volatile bool *)user_data = true;
+}
+
+/* Program the one-shot for the next event, carry = counts of s_now already elapsed */
+static void TIMER_SRV_Arm(uint32_t carry)
+{
+    uint32_t ticks = TIMER_SRV_NextEvent();
+
+    s_arm_base = s_now;
+    s_arm_carry = carry;
+    s_arm_counts = (ticks * s_counts_per_tick) - carry;
+    s_deadline = s_now + ticks;
+
+    (void)LPIT_StopChannel(s_channel);
+    (void)LPIT_SetPeriod(s_channel, s_arm_counts - 1U);
+    (void)LPIT_StartChannel(s_channel);
+}
+
+/* LPIT one-shot: advance tới s_deadline, cascade rồi expire level 0 */
+static void TIMER_SRV_OnTimeout(uint8_t channel, void *userData)
+{
+    timer_srv_timer_t *timer;
+    timer_srv_callback_t callback;
+    uint32_t basepri;
+    uint32_t level;
+    uint32_t shift;
+    uint32_t slot;
+
+    (void)channel;
+    (void)userData;
+
+    basepri = NVIC_EnterCritical();
+
+    s_now = s_deadline;
+    s_processing = true;
+
+    /* Không có slot non-empty nào nằm giữa (s_now cũ, s_deadline), chỉ cần xử lý tại s_deadline */
+    for (level = TIMER_SRV_LEVELS - 1U; level > 0U; level--) {
+        shift = TIMER_SRV_WHEEL_BITS * level;
+        if ((s_now & ((1UL << shift) - 1U)) != 0U) {
+            continue;
+        }
+        slot = (s_now >> shift) & TIMER_SRV_WHEEL_MASK;
+        while ((timer = s_wheel[level][slot]) != NULL) {
+            TIMER_SRV_Unlink(timer);
+            TIMER_SRV_Link(timer, s_now);
+        }
+    }
+
+    slot = s_now & TIMER_SRV_WHEEL_MASK;
+    while ((timer = s_wheel[0][slot]) != NULL) {
+        TIMER_SRV_Unlink(timer);
+        if (timer->period != 0U) {
+            timer->expires += timer->period;
+            TIMER_SRV_Link(timer, s_now);
+        }
+
+        /* Callback chạy với interrupt enabled, có thể Start / Stop bất kỳ timer nào */
+        callback = timer->callback;
+        NVIC_ExitCritical(basepri);
+        callback(timer, timer->user_data);
+        basepri = NVIC_EnterCritical();
+    }
+
+    s_processing = false;
+    TIMER_SRV_Arm(0U);
+
+    NVIC_ExitCritical(basepri);
+}
+
+/*
+ * Idle VLPS dài trên LPTMR0 (LPO 1 kHz), gọi với interrupt masked.
+ * LPIT dừng trong lúc ngủ; wheel time cập nhật từ LPTMR counter rồi one-shot
+ * được arm lại cho phần còn lại (< 1 tick + phần lẻ ms) tới deadline.
+ * Trả về false nếu không ngủ (deadline quá gần hoặc LPIT đã hết hạn).
+ */
+static bool TIMER_SRV_SleepLptmr(void)
+{
+    uint32_t remainder;
+    uint32_t now;
+    uint32_t sleep_ms;
+    uint32_t slept_ms;
+    uint64_t counts;
+
+    now = s_arm_base + TIMER_SRV_Elapsed(&remainder);
+    (void)LPIT_StopChannel(s_channel);
+
+    /* One-shot hết hạn ngay trước khi dừng: handler pending xử lý deadline */
+    if (LPIT_GetInterruptFlag(s_channel)) {
+        return false;
+    }
+
+    /* Dừng trước deadline ít nhất 1 tick: expiry vẫn do LPIT one-shot xử lý */
+    sleep_ms = (uint32_t)(((uint64_t)(s_deadline - now - 1U) * TIMER_SRV_TICK_US) / 1000U);
+    if (sleep_ms > ((uint32_t)LPTMR_MAX_COMPARE + 1U)) {
+        sleep_ms = (uint32_t)LPTMR_MAX_COMPARE + 1U;
+    }
+
+    if ((sleep_ms < 2U) || (LPTMR_SetCompare((uint16_t)(sleep_ms - 1U)) != STATUS_SUCCESS)) {
+        s_now = now;
+        TIMER_SRV_Arm(remainder);
+        return false;
+    }
+
+    (void)LPTMR_Start();
+    if (SMC_EnterStopMode(SMC_STOP_MODE_VLPS) == SMC_STATUS_ERROR) {
+        NVIC_WaitForInterrupt();
+    }
+
+    /* Wake-up bởi LPTMR (compare) hoặc interrupt khác (counter) */
+    slept_ms = LPTMR_GetCompareFlag() ? sleep_ms : (uint32_t)LPTMR_GetCounter();
+    (void)LPTMR_Stop();
+    (void)NVIC_ClearPendingIRQ(LPTMR0_IRQn);
+
+    counts = ((uint64_t)slept_ms * s_counts_per_tick * 1000U) / TIMER_SRV_TICK_US;
+    counts += remainder;
+
+    /* Không vượt qua deadline: slot tại s_deadline phải được expire bởi LPIT */
+    if (counts >= ((uint64_t)(s_deadline - now) * s_counts_per_tick)) {
+        counts = ((uint64_t)(s_deadline - now) * s_counts_per_tick) - 1U;
+    }
+
+    s_now = now + (uint32_t)(counts / s_counts_per_tick);
+    TIMER_SRV_Arm((uint32_t)(counts % s_counts_per_tick));
+
+    return true;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+timer_srv_status_t TIMER_SRV_Init(uint8_t lpit_channel)
+{
+    lpit_channel_config_t config = {
+        .channel = lpit_channel,
+        .mode = LPIT_MODE_32BIT_PERIODIC,
+        .period = 0U,
+        .enableInterrupt = true,
+        .chainChannel = false,
+        .startOnTrigger = false,
+        .stopOnInterrupt = true,        /* One-shot */
+        .reloadOnTrigger = false
+    };
+    uint32_t level;
+    uint32_t slot;
+    uint32_t basepri;
+
+    s_counts_per_tick = (uint32_t)(((uint64_t)LPIT_GetClockFreq() * TIMER_SRV_TICK_US) / 1000000U);
+    if (s_counts_per_tick == 0U) {
+        return TIMER_SRV_ERROR;
+    }
+
+    if ((LPIT_ConfigChannel(&config) != STATUS_SUCCESS) ||
+        (LPIT_InstallCallback(lpit_channel, TIMER_SRV_OnTimeout, NULL) != STATUS_SUCCESS)) {
+        return TIMER_SRV_ERROR;
+    }
+
+    basepri = NVIC_EnterCritical();
+
+    for (level = 0U; level < TIMER_SRV_LEVELS; level++) {
+        for (slot = 0U; slot < TIMER_SRV_WHEEL_SLOTS; slot++) {
+            s_wheel[level][slot] = NULL;
+        }
+        s_occupied[level] = 0U;
+    }
+
+    s_channel = lpit_channel;
+    s_max_sleep = 0xFFFFFFFFUL / s_counts_per_tick;
+    s_now = 0U;
+    s_processing = false;
+    s_initialized = true;
+
+    /* Không có timer: one-shot dài nhất, chỉ để giữ time base */
+    TIMER_SRV_Arm(0U);
+
+    NVIC_ExitCritical(basepri);
+
+    return TIMER_SRV_SUCCESS;
+}
+
+timer_srv_status_t TIMER_SRV_Start(timer_srv_timer_t *timer, uint32_t timeout, uint32_t period,
+                                   timer_srv_callback_t callback, void *user_data)
+{
+    uint32_t basepri;
+    uint32_t remainder;
+
+    if (!s_initialized) {
+        return TIMER_SRV_NOT_INITIALIZED;
+    }
+
+    if ((timer == NULL) || (callback == NULL) ||
+        (timeout > TIMER_SRV_MAX_TICKS) || (period > TIMER_SRV_MAX_TICKS)) {
+        return TIMER_SRV_ERROR;
+    }
+
+    if (timeout == 0U) {
+        timeout = 1U;
+    }
+
+    basepri = NVIC_EnterCritical();
+
+    if (timer->active) {
+        TIMER_SRV_Unlink(timer);
+    }
+
+    timer->period = period;
+    timer->callback = callback;
+    timer->user_data = user_data;
+
+    if (s_processing) {
+        /* Từ callback: one-shot được arm lại khi handler kết thúc */
+        timer->expires = s_now + timeout;
+        TIMER_SRV_Link(timer, s_now);
+    } else if (LPIT_GetInterruptFlag(s_channel)) {
+        /* Deadline đã tới, handler đang pending sẽ advance tới s_deadline */
+        timer->expires = s_deadline + timeout;
+        TIMER_SRV_Link(timer, s_deadline);
+    } else {
+        /* Cập nhật wheel time (không có event nào trước s_deadline) */
+        s_now = s_arm_base + TIMER_SRV_Elapsed(&remainder);
+        timer->expires = s_now + timeout;
+        TIMER_SRV_Link(timer, s_now);
+
+        if (TIMER_SRV_NextEvent() < (s_deadline - s_now)) {
+            TIMER_SRV_Arm(remainder);
+        }
+    }
+
+    NVIC_ExitCritical(basepri);
+
+    return TIMER_SRV_SUCCESS;
+}
+
+void TIMER_SRV_Stop(timer_srv_timer_t *timer)
+{
+    uint32_t basepri;
+
+    if (timer == NULL) {
+        return;
+    }
+
+    /* Không reprogram LPIT: wake-up thừa ở deadline cũ chỉ arm lại */
+    basepri = NVIC_EnterCritical();
+    if (timer->active) {
+        TIMER_SRV_Unlink(timer);
+    }
+    NVIC_ExitCritical(basepri);
+}
+
+bool TIMER_SRV_IsActive(const timer_srv_timer_t *timer)
+{
+    return (timer != NULL) && timer->active;
+}
+
+uint32_t TIMER_SRV_GetTicks(void)
+{
+    uint32_t basepri;
+    uint32_t ticks;
+
+    if (!s_initialized) {
+        return 0U;
+    }
+
+    basepri = NVIC_EnterCritical();
+    ticks = TIMER_SRV_Now();
+    NVIC_ExitCritical(basepri);
+
+    return ticks;
+}
+
+uint32_t TIMER_SRV_GetIdleTicks(void)
+{
+    uint32_t basepri;
+    uint32_t ticks;
+
+    if (!s_initialized) {
+        return 0U;
+    }
+
+    basepri = NVIC_EnterCritical();
+    ticks = s_deadline - TIMER_SRV_Now();
+    NVIC_ExitCritical(basepri);
+
+    return ticks;
+}
+
+void TIMER_SRV_Idle(bool allow_vlps)
+{
+    uint32_t basepri;
+    uint32_t before;
+    uint32_t idle;
+    uint64_t slept_us;
+    bool tick_running;
+
+    if (!s_initialized) {
+        return;
+    }
+
+    /* Masked: interrupt pending vẫn wake WFI, handler chạy sau khi bù thời gian */
+    basepri = NVIC_EnterCritical();
+
+    before = TIMER_SRV_Now();
+    idle = s_deadline - before;
+    if (idle == 0U) {
+        NVIC_ExitCritical(basepri);
+        return;
+    }
+
+    tick_running = SYSTICK_SuspendTick();
+
+    if (allow_vlps && s_lptmr_sleep) {
+        /* VLPS chỉ qua LPTMR: LPIT có thể không có clock trong VLPS */
+        if ((idle < TIMER_SRV_LPTMR_MIN_TICKS) || !TIMER_SRV_SleepLptmr()) {
+            NVIC_WaitForInterrupt();
+        }
+    } else if (!allow_vlps || (idle < TIMER_SRV_VLPS_MIN_TICKS) ||
+               (SMC_EnterStopMode(SMC_STOP_MODE_VLPS) == SMC_STATUS_ERROR)) {
+        NVIC_WaitForInterrupt();
+    }
+
+    if (tick_running) {
+        slept_us = ((uint64_t)(TIMER_SRV_Now() - before) * TIMER_SRV_TICK_US) + s_idle_us_remainder;
+        s_idle_us_remainder = (uint32_t)(slept_us % 1000U);
+        SYSTICK_ResumeTick((uint32_t)(slept_us / 1000U));
+    }
+
+    NVIC_ExitCritical(basepri);
+}
+
+timer_srv_status_t TIMER_SRV_EnableLptmrSleep(bool enable)
+{
+    lptmr_config_t config = {
+        .mode = LPTMR_MODE_TIMER,
+        .clockSource = LPTMR_CLK_SRC_LPO1K,     /* 1 count = 1 ms, chạy trong VLPS */
+        .prescaler = 0U,
+        .pinSelect = LPTMR_PIN_TRGMUX,
+        .pinActiveLow = false,
+        .freeRunning = false,
+        .enableInterrupt = true,           /* Wake-up source */
+        .compare = LPTMR_MAX_COMPARE
+    };
+
+    if (!s_initialized) {
+        return TIMER_SRV_NOT_INITIALIZED;
+    }
+
+    if (enable && (LPTMR_Init(&config) != STATUS_SUCCESS)) {
+        return TIMER_SRV_ERROR;
+    }
+
+    s_lptmr_sleep = enable;
+
+    return TIMER_SRV_SUCCESS;
+}
+
+timer_srv_status_t TIMER_SRV_Delay(uint32_t ticks)
+{
+    timer_srv_timer_t timer = { 0 };
+    volatile bool done = false;
+    timer_srv_status_t status;
+
+    status = TIMER_SRV_Start(&timer, ticks, 0U, TIMER_SRV_DelayCallback, (void *)&done);
+    if (status != TIMER_SRV_SUCCESS) {
+        return status;
+    }
+
+    while (!done) {
+        TIMER_SRV_Idle(false);
+    }
+
+    return TIMER_SRV_SUCCESS;
+}
@@ -0,0 +1,338 @@
+/**
+ * @file    trace_srv.c
+ * @brief   Trace Service Layer Implementation
+ * @details Implementation của deferred binary logger: RAM ring + UART drain
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.1
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../inc/trace_srv.h"
+#include <stddef.h>
+#if UART_DMA_ENABLE
+#include "dma.h"
+#endif
+#if TRACE_SRV_RTT_ENABLE
+#include "rtt_srv.h"
+#endif
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+#define TRACE_SRV_MASK              (TRACE_SRV_BUFFER_WORDS - 1U)
+#define TRACE_SRV_BYTE_MASK         ((TRACE_SRV_BUFFER_WORDS << 2) - 1U)
+
+#if ((TRACE_SRV_BUFFER_WORDS & TRACE_SRV_MASK) != 0U)
+#error "TRACE_SRV_BUFFER_WORDS must be a power of 2"
+#endif
+
+/* Cortex-M4 DWT cycle counter (ARMv7-M debug registers) */
+#define TRACE_SRV_DEMCR             (*(volatile uint32_t *)0xE000EDFCUL)
+#define TRACE_SRV_DEMCR_TRCENA      (0x01000000UL)
+#define TRACE_SRV_DWT_CTRL          (*(volatile uint32_t *)0xE0001000UL)
+#define TRACE_SRV_DWT_CTRL_CYCCNTENA (0x00000001UL)
+#define TRACE_SRV_DWT_CYCCNT        (*(volatile uint32_t *)0xE0001004UL)
+
+/* Bytes per DMA transfer: CITER is 15 bits */
+#define TRACE_SRV_MAX_CHUNK_BYTES   (0x7FFCU)
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+/* SRAM_U: đọc bởi DMA (UART drain) hoặc debug probe (RTT) */
+static uint32_t s_trace_ring[TRACE_SRV_BUFFER_WORDS] DMA_BUFFER_SRAM_U;
+static volatile uint32_t s_trace_head = 0U;         /* Word index, producers */
+static volatile uint32_t s_trace_tail_bytes = 0U;   /* Byte index, drain */
+static volatile uint32_t s_trace_dropped = 0U;
+static uint8_t s_trace_seq = 0U;
+static uint32_t s_trace_inflight = 0U;              /* Bytes in the running transfer */
+static trace_srv_time_source_t s_time_source = NULL;
+static LPUART_RegType *s_trace_uart = NULL;
+static uint8_t s_trace_dma_channel = 0U;
+static bool s_trace_initialized = false;
+#if TRACE_SRV_RTT_ENABLE
+static bool s_trace_rtt = false;                    /* Ring là RTT up buffer, host drain */
+static uint8_t s_trace_rtt_channel = 0U;
+#endif
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static inline uint32_t TRACE_SRV_EnterCritical(void)
+{
+    uint32_t primask;
+
+    __asm volatile ("mrs %0, primask" : "=r" (primask));
+    __asm volatile ("cpsid i" : : : "memory");
+
+    return primask;
+}
+
+static inline void TRACE_SRV_ExitCritical(uint32_t primask)
+{
+    __asm volatile ("msr primask, %0" : : "r" (primask) : "memory");
+}
+
+static inline void TRACE_SRV_Commit(uint16_t id, uint32_t nargs, const uint32_t *args)
+{
+    uint32_t timestamp = (s_time_source != NULL) ? s_time_source() : TRACE_SRV_DWT_CYCCNT;
+    uint32_t primask;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t reserve = 0U;
+    uint32_t i;
+
+    primask = TRACE_SRV_EnterCritical();
+
+    head = s_trace_head;
+    tail = s_trace_tail_bytes;
+
+#if TRACE_SRV_RTT_ENABLE
+    if (s_trace_rtt) {
+        /* Host là drain: tail suy ra từ RdOff; giữ 1 word trống vì
+           WrOff == RdOff nghĩa là rỗng */
+        tail = (head << 2) - (((head << 2) - RTT_SRV_GetUpReadOffset(s_trace_rtt_channel)) & TRACE_SRV_BYTE_MASK);
+        reserve = 1U;
+    }
+#endif
+
+    /* A word is free only once the drain has sent all 4 of its bytes */
+    if ((TRACE_SRV_BUFFER_WORDS - ((((head << 2) - tail) + 3U) >> 2)) < (nargs + 2U + reserve)) {
+        s_trace_dropped++;
+        TRACE_SRV_ExitCritical(primask);
+        return;
+    }
+
+    s_trace_ring[head & TRACE_SRV_MASK] = ((uint32_t)TRACE_SRV_SYNC << 28) | (nargs << 24) |
+                                          ((uint32_t)s_trace_seq << 16) | (uint32_t)id;
+    s_trace_ring[(head + 1U) & TRACE_SRV_MASK] = timestamp;
+    for (i = 0U; i < nargs; i++) {
+        s_trace_ring[(head + 2U + i) & TRACE_SRV_MASK] = args[i];
+    }
+
+    s_trace_seq++;
+    s_trace_head = head + 2U + nargs;
+
+#if TRACE_SRV_RTT_ENABLE
+    if (s_trace_rtt) {
+        RTT_SRV_SetUpWriteOffset(s_trace_rtt_channel, (s_trace_head << 2) & TRACE_SRV_BYTE_MASK);
+    }
+#endif
+
+    TRACE_SRV_ExitCritical(primask);
+}
+
+/**
+ * @brief Enable DWT cycle counter (timestamp mặc định) và xóa ring state
+ */
+static void TRACE_SRV_Reset(void)
+{
+    TRACE_SRV_DEMCR |= TRACE_SRV_DEMCR_TRCENA;
+    TRACE_SRV_DWT_CYCCNT = 0U;
+    TRACE_SRV_DWT_CTRL |= TRACE_SRV_DWT_CTRL_CYCCNTENA;
+
+    s_trace_head = 0U;
+    s_trace_tail_bytes = 0U;
+    s_trace_inflight = 0U;
+    s_trace_dropped = 0U;
+    s_trace_seq = 0U;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+trace_srv_status_t TRACE_SRV_Init(LPUART_RegType *base, uint8_t dma_channel)
+{
+    if (base == NULL) {
+        return TRACE_SRV_ERROR;
+    }
+
+#if UART_DMA_ENABLE
+    if (UART_ConfigTxDMA(base, dma_channel) != UART_STATUS_SUCCESS) {
+        return TRACE_SRV_ERROR;
+    }
+#else
+    (void)dma_channel;
+    if (UART_EnableAsync(base) != UART_STATUS_SUCCESS) {
+        return TRACE_SRV_ERROR;
+    }
+#endif
+
+    TRACE_SRV_Reset();
+
+    s_trace_uart = base;
+    s_trace_dma_channel = dma_channel;
+#if TRACE_SRV_RTT_ENABLE
+    s_trace_rtt = false;
+#endif
+    s_trace_initialized = true;
+
+    return TRACE_SRV_SUCCESS;
+}
+
+#if TRACE_SRV_RTT_ENABLE
+trace_srv_status_t TRACE_SRV_InitRtt(uint8_t up_channel)
+{
+    rtt_srv_status_t status;
+
+    s_trace_initialized = false;
+
+    /* Ring của trace chính là storage của up channel: không copy */
+    status = RTT_SRV_ConfigUpBuffer(up_channel, "Trace", s_trace_ring,
+                                    TRACE_SRV_BUFFER_WORDS << 2, RTT_SRV_MODE_NO_BLOCK_SKIP);
+    if (status == RTT_SRV_NOT_INITIALIZED) {
+        return TRACE_SRV_NOT_INITIALIZED;
+    }
+    if (status != RTT_SRV_SUCCESS) {
+        return TRACE_SRV_ERROR;
+    }
+
+    TRACE_SRV_Reset();
+
+    s_trace_uart = NULL;
+    s_trace_rtt_channel = up_channel;
+    s_trace_rtt = true;
+    s_trace_initialized = true;
+
+    return TRACE_SRV_SUCCESS;
+}
+#endif
+
+void TRACE_SRV_InstallTimeSource(trace_srv_time_source_t source)
+{
+    s_time_source = source;
+}
+
+void TRACE_SRV_Log0(uint16_t id)
+{
+    TRACE_SRV_Commit(id, 0U, NULL);
+}
+
+void TRACE_SRV_Log1(uint16_t id, uint32_t a0)
+{
+    TRACE_SRV_Commit(id, 1U, &a0);
+}
+
+void TRACE_SRV_Log2(uint16_t id, uint32_t a0, uint32_t a1)
+{
+    uint32_t args[2];
+
+    args[0] = a0;
+    args[1] = a1;
+    TRACE_SRV_Commit(id, 2U, args);
+}
+
+void TRACE_SRV_Log3(uint16_t id, uint32_t a0, uint32_t a1, uint32_t a2)
+{
+    uint32_t args[3];
+
+    args[0] = a0;
+    args[1] = a1;
+    args[2] = a2;
+    TRACE_SRV_Commit(id, 3U, args);
+}
+
+void TRACE_SRV_Log4(uint16_t id, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3)
+{
+    uint32_t args[4];
+
+    args[0] = a0;
+    args[1] = a1;
+    args[2] = a2;
+    args[3] = a3;
+    TRACE_SRV_Commit(id, 4U, args);
+}
+
+void TRACE_SRV_Process(void)
+{
+    const uint8_t *ring = (const uint8_t *)s_trace_ring;
+    uint32_t tail;
+    uint32_t offset;
+    uint32_t chunk;
+
+    if (!s_trace_initialized) {
+        return;
+    }
+
+#if TRACE_SRV_RTT_ENABLE
+    if (s_trace_rtt) {
+        return;                                     /* Probe đọc ring ở background */
+    }
+#endif
+
+#if UART_DMA_ENABLE
+    if (s_trace_inflight != 0U) {
+        if (!DMA_IsChannelDone(s_trace_dma_channel)) {
+            return;
+        }
+        (void)DMA_ClearDone(s_trace_dma_channel);
+        s_trace_tail_bytes += s_trace_inflight;
+        s_trace_inflight = 0U;
+    }
+#endif
+
+    tail = s_trace_tail_bytes;
+    chunk = (s_trace_head << 2) - tail;
+    if (chunk == 0U) {
+        return;
+    }
+
+    /* Contiguous part only, the wrapped remainder goes in the next call */
+    offset = tail & TRACE_SRV_BYTE_MASK;
+    if (chunk > ((TRACE_SRV_BUFFER_WORDS << 2) - offset)) {
+        chunk = (TRACE_SRV_BUFFER_WORDS << 2) - offset;
+    }
+    if (chunk > TRACE_SRV_MAX_CHUNK_BYTES) {
+        chunk = TRACE_SRV_MAX_CHUNK_BYTES;
+    }
+
+#if UART_DMA_ENABLE
+    if (UART_SendDMA(s_trace_uart, s_trace_dma_channel, &ring[offset], chunk) == UART_STATUS_SUCCESS) {
+        s_trace_inflight = chunk;
+    }
+#else
+    {
+        uint32_t written = 0U;
+
+        (void)UART_WriteAsync(s_trace_uart, &ring[offset], chunk, &written);
+        s_trace_tail_bytes = tail + written;
+    }
+#endif
+}
+
+uint32_t TRACE_SRV_GetDropCount(void)
+{
+    return s_trace_dropped;
+}
+
+uint32_t TRACE_SRV_CopyTail(uint32_t *dest, uint32_t words)
+{
+    uint32_t head = s_trace_head;
+    uint32_t start;
+    uint32_t i;
+
+    if (dest == NULL) {
+        return 0U;
+    }
+
+    /* Không lock: gọi được từ fault handler, record cuối có thể đang ghi dở */
+    if (words > TRACE_SRV_BUFFER_WORDS) {
+        words = TRACE_SRV_BUFFER_WORDS;
+    }
+    if (words > head) {
+        words = head;
+    }
+
+    start = head - words;
+    for (i = 0U; i < words; i++) {
+        dest[i] = s_trace_ring[(start + i) & TRACE_SRV_MASK];
+    }
+
+    return words;
+}
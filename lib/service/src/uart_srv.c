@@ -12,6 +12,7 @@
  * Includes
  ******************************************************************************/
 #include "../inc/uart_srv.h"
+#include "../inc/frame_srv.h"
 #include "../../../../Core/BareMetal/uart/UART.h"
 #include <string.h>
 
@@ -21,6 +22,21 @@
 static bool s_uart_initialized = false;
 static LPUART_Type *s_uart_instance = NULL;
 
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static void UART_SRV_FrameWrite(const uint8_t *data, uint32_t len, void *ctx)
+{
+    uint32_t i;
+
+    (void)ctx;
+
+    for (i = 0U; i < len; i++) {
+        LPUART_transmit_char(s_uart_instance, data[i]);
+    }
+}
+
 /*******************************************************************************
  * Public Functions
  ******************************************************************************/
@@ -79,3 +95,22 @@ uart_srv_status_t UART_SRV_SendString(const char *str)
     
     return UART_SRV_SUCCESS;
 }
+
+uart_srv_status_t UART_SRV_SendFrame(const uint8_t *payload, uint32_t len)
+{
+    frame_srv_encoder_t enc;
+
+    if (!s_uart_initialized) {
+        return UART_SRV_NOT_INITIALIZED;
+    }
+
+    if ((payload == NULL) && (len != 0U)) {
+        return UART_SRV_ERROR;
+    }
+
+    (void)FRAME_SRV_EncoderBegin(&enc, UART_SRV_FrameWrite, NULL);
+    (void)FRAME_SRV_EncoderPut(&enc, payload, len);
+    (void)FRAME_SRV_EncoderEnd(&enc);
+
+    return UART_SRV_SUCCESS;
+}
@@ -0,0 +1,211 @@
+/**
+ * @file    wdog_srv.c
+ * @brief   Watchdog Service Layer Implementation
+ * @details Implementation của task check-in bitmask, hạn check-in và
+ *          refresh WDOG có điều kiện
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "../inc/wdog_srv.h"
+#include "nvic.h"
+#include "atomic.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Private Definitions
+ ******************************************************************************/
+#if (WDOG_SRV_MAX_TASKS == 0U) || (WDOG_SRV_MAX_TASKS > 32U)
+#error "WDOG_SRV_MAX_TASKS must be 1..32"
+#endif
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+/* Bit mỗi task: set bởi CheckIn (mọi context), xóa bởi Service */
+static volatile uint32_t s_checked = 0U;
+static uint32_t s_registered = 0U;
+static uint16_t s_max_periods[WDOG_SRV_MAX_TASKS];
+static uint16_t s_missed[WDOG_SRV_MAX_TASKS];
+static wdog_srv_fault_hook_t s_fault_hook = NULL;
+static volatile uint8_t s_fault_task = WDOG_SRV_NO_TASK;
+static bool s_initialized = false;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/* Đọc và xóa bitmask check-in trong một LDREX / STREX */
+static uint32_t WDOG_SRV_TakeCheckins(void)
+{
+    uint32_t value;
+
+    do {
+        value = ATOMIC_LoadExclusive(&s_checked);
+    } while (ATOMIC_StoreExclusive(&s_checked, 0U) != 0U);
+
+    return value;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+wdog_srv_status_t WDOG_SRV_Init(const wdog_config_t *config)
+{
+    uint32_t i;
+
+    if (config == NULL) {
+        return WDOG_SRV_ERROR;
+    }
+
+    s_initialized = false;
+    s_registered = 0U;
+    s_checked = 0U;
+    s_fault_task = WDOG_SRV_NO_TASK;
+    for (i = 0U; i < WDOG_SRV_MAX_TASKS; i++) {
+        s_max_periods[i] = 0U;
+        s_missed[i] = 0U;
+    }
+
+    if (WDOG_Init(config) != STATUS_SUCCESS) {
+        return WDOG_SRV_ERROR;
+    }
+
+    s_initialized = true;
+
+    return WDOG_SRV_SUCCESS;
+}
+
+wdog_srv_status_t WDOG_SRV_Register(uint8_t task_id, uint16_t max_periods)
+{
+    uint32_t basepri;
+    uint32_t bit;
+
+    if (!s_initialized) {
+        return WDOG_SRV_NOT_INITIALIZED;
+    }
+    if ((task_id >= WDOG_SRV_MAX_TASKS) || (max_periods == 0U)) {
+        return WDOG_SRV_ERROR;
+    }
+
+    bit = 1UL << task_id;
+
+    /* Service() có thể chạy trong interrupt */
+    basepri = NVIC_EnterCritical();
+    s_max_periods[task_id] = max_periods;
+    s_missed[task_id] = 0U;
+    s_registered |= bit;
+    NVIC_ExitCritical(basepri);
+
+    return WDOG_SRV_SUCCESS;
+}
+
+wdog_srv_status_t WDOG_SRV_Unregister(uint8_t task_id)
+{
+    uint32_t basepri;
+
+    if (!s_initialized) {
+        return WDOG_SRV_NOT_INITIALIZED;
+    }
+    if (task_id >= WDOG_SRV_MAX_TASKS) {
+        return WDOG_SRV_ERROR;
+    }
+
+    basepri = NVIC_EnterCritical();
+    s_registered &= ~(1UL << task_id);
+    NVIC_ExitCritical(basepri);
+
+    return WDOG_SRV_SUCCESS;
+}
+
+void WDOG_SRV_CheckIn(uint8_t task_id)
+{
+    uint32_t bit;
+    uint32_t value;
+
+    if (task_id >= WDOG_SRV_MAX_TASKS) {
+        return;
+    }
+
+    bit = 1UL << task_id;
+    do {
+        value = ATOMIC_LoadExclusive(&s_checked);
+    } while (ATOMIC_StoreExclusive(&s_checked, value | bit) != 0U);
+}
+
+wdog_srv_status_t WDOG_SRV_Service(void)
+{
+    uint32_t basepri;
+    uint32_t checked;
+    uint32_t pending;
+    uint32_t i;
+    uint8_t fault = WDOG_SRV_NO_TASK;
+    wdog_srv_fault_hook_t hook = NULL;
+
+    if (!s_initialized) {
+        return WDOG_SRV_NOT_INITIALIZED;
+    }
+    if (s_fault_task != WDOG_SRV_NO_TASK) {
+        return WDOG_SRV_TASK_FAULT;
+    }
+
+    /* Window chưa mở: giữ check-in cho lần Service() sau */
+    if (!WDOG_IsRefreshAllowed()) {
+        return WDOG_SRV_TOO_EARLY;
+    }
+
+    basepri = NVIC_EnterCritical();
+
+    checked = WDOG_SRV_TakeCheckins();
+    pending = s_registered;
+    for (i = 0U; (pending != 0U) && (i < WDOG_SRV_MAX_TASKS); i++) {
+        if ((pending & (1UL << i)) == 0U) {
+            continue;
+        }
+        pending &= ~(1UL << i);
+
+        if ((checked & (1UL << i)) != 0U) {
+            s_missed[i] = 0U;
+        } else {
+            s_missed[i]++;
+            if ((s_missed[i] >= s_max_periods[i]) && (fault == WDOG_SRV_NO_TASK)) {
+                fault = (uint8_t)i;
+            }
+        }
+    }
+
+    if (fault == WDOG_SRV_NO_TASK) {
+        WDOG_Refresh();
+    } else {
+        s_fault_task = fault;
+        hook = s_fault_hook;
+    }
+
+    NVIC_ExitCritical(basepri);
+
+    if (fault != WDOG_SRV_NO_TASK) {
+        /* Không refresh nữa: WDOG reset MCU khi hết timeout */
+        if (hook != NULL) {
+            hook(fault);
+        }
+        return WDOG_SRV_TASK_FAULT;
+    }
+
+    return WDOG_SRV_SUCCESS;
+}
+
+void WDOG_SRV_SetFaultHook(wdog_srv_fault_hook_t hook)
+{
+    s_fault_hook = hook;
+}
+
+uint8_t WDOG_SRV_GetFaultTask(void)
+{
+    return s_fault_task;
+}
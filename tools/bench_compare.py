@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+"""
+Compare two reports of lib/service/example/benchmark_suite.c and flag regressions.
+
+Report lines (anything else, e.g. '#' comments or boot output, is ignored):
+    BENCH_BEGIN,<suite version>,<core clock Hz>
+    BENCH,<metric>,<value>,<unit>
+    BENCH_SKIP,<metric>,<reason>
+    BENCH_END,<metric count>
+
+Units ending in per_s or permille are higher-is-better; cycles, ns and count
+are lower-is-better.
+
+Usage:
+    python3 tools/bench_compare.py baseline.txt current.txt
+    python3 tools/bench_compare.py --tolerance 3 baseline.txt current.txt
+    python3 tools/bench_compare.py current.txt        # print one report
+
+Exit status 1 when a metric is worse than the baseline by more than the
+tolerance (percent), a metric disappeared, or the suite versions differ.
+"""
+
+import argparse
+import sys
+
+HIGHER_IS_BETTER = ('per_s', 'permille')
+
+
+def load(path):
+    report = {'version': None, 'clock': None, 'metrics': {}, 'skipped': {}, 'complete': False}
+    with open(path, encoding='utf-8', errors='replace') as f:
+        for line in f:
+            fields = line.strip().split(',')
+            if fields[0] == 'BENCH_BEGIN' and len(fields) == 3:
+                report['version'], report['clock'] = int(fields[1]), int(fields[2])
+                report['metrics'].clear()
+                report['skipped'].clear()
+                report['complete'] = False
+            elif fields[0] == 'BENCH' and len(fields) == 4:
+                report['metrics'][fields[1]] = (int(fields[2]), fields[3])
+            elif fields[0] == 'BENCH_SKIP' and len(fields) == 3:
+                report['skipped'][fields[1]] = fields[2]
+            elif fields[0] == 'BENCH_END' and len(fields) == 2:
+                report['complete'] = int(fields[1]) == len(report['metrics'])
+    if report['version'] is None:
+        sys.exit('%s: no BENCH_BEGIN line' % path)
+    if not report['complete']:
+        print('warning: %s: report incomplete (no BENCH_END or metric count mismatch)' % path)
+    return report
+
+
+def change(old, new, unit):
+    """Relative change in percent, positive = better."""
+    if old == 0:
+        return 0.0 if new == 0 else (100.0 if unit.endswith(HIGHER_IS_BETTER) else -100.0)
+    pct = 100.0 * (new - old) / old
+    return pct if unit.endswith(HIGHER_IS_BETTER) else -pct
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument('reports', nargs='+', metavar='report', help='baseline and current report (or one report)')
+    ap.add_argument('-t', '--tolerance', type=float, default=5.0, help='allowed loss in percent (default 5)')
+    opts = ap.parse_args()
+
+    if len(opts.reports) == 1:
+        cur = load(opts.reports[0])
+        for name, (value, unit) in sorted(cur['metrics'].items()):
+            print('%-28s %12u %s' % (name, value, unit))
+        for name, reason in sorted(cur['skipped'].items()):
+            print('%-28s %12s (%s)' % (name, 'skipped', reason))
+        return 0
+    if len(opts.reports) != 2:
+        ap.error('expected one or two reports')
+
+    base, cur = load(opts.reports[0]), load(opts.reports[1])
+    failed = False
+    if base['version'] != cur['version']:
+        print('suite version %s -> %s: reports are not comparable' % (base['version'], cur['version']))
+        return 1
+    if base['clock'] != cur['clock']:
+        print('warning: core clock %s -> %s Hz' % (base['clock'], cur['clock']))
+
+    for name in sorted(set(base['metrics']) | set(cur['metrics'])):
+        if name not in cur['metrics']:
+            reason = next((r for k, r in cur['skipped'].items() if name.startswith(k)), 'missing')
+            print('%-28s %12u -> %12s  REGRESSION (%s)' % (name, base['metrics'][name][0], '-', reason))
+            failed = True
+            continue
+        value, unit = cur['metrics'][name]
+        if name not in base['metrics']:
+            print('%-28s %12s -> %12u %s  new' % (name, '-', value, unit))
+            continue
+        old = base['metrics'][name][0]
+        pct = change(old, value, unit)
+        verdict = ''
+        if pct < -opts.tolerance:
+            verdict = '  REGRESSION'
+            failed = True
+        print('%-28s %12u -> %12u %-11s %+6.1f%%%s' % (name, old, value, unit, pct, verdict))
+
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
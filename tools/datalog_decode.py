@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+"""
+Decode a flash dump of the datalog region written by lib/service/src/datalog_srv.c.
+
+Blocks are sorted by sequence number, so a wrapped ring decodes oldest first.
+
+Usage:
+    python3 tools/datalog_decode.py dump.bin
+    python3 tools/datalog_decode.py -B 512 -c 1000000 dump.bin
+    python3 tools/datalog_decode.py --csv dump.bin > log.csv
+
+Dump the region with the debugger, e.g. OpenOCD:
+    dump_image dump.bin 0x10000000 0x8000
+"""
+
+import argparse
+import struct
+
+MAGIC = 0x474F4C44
+HEADER = struct.Struct('<IIIHBB')
+TYPE_ADC = 1
+TYPE_CAN = 2
+
+
+def varint(buf, pos):
+    value = shift = 0
+    while True:
+        b = buf[pos]
+        pos += 1
+        value |= (b & 0x7F) << shift
+        if b < 0x80:
+            return value, pos
+        shift += 7
+
+
+def unzigzag(v):
+    return (v >> 1) ^ -(v & 1)
+
+
+def blocks(data, block_size):
+    found = []
+    for off in range(0, len(data) - block_size + 1, block_size):
+        magic, seq, ts, used, version, _ = HEADER.unpack_from(data, off)
+        if magic == MAGIC and HEADER.size <= used <= block_size:
+            found.append((seq, off, ts, used, version))
+    # Sequence is 32-bit: sort relative to the oldest block in a wrapped ring
+    if found:
+        newest = max(found, key=lambda b: b[0])[0]
+        found.sort(key=lambda b: (b[0] - newest - 1) & 0xFFFFFFFF)
+    return found
+
+
+def records(data, off, ts, used):
+    """Yield (timestamp, kind, fields) for one block."""
+    pos = off + HEADER.size
+    end = off + used
+    prev = [0] * 16
+    while pos < end:
+        tag = data[pos]
+        pos += 1
+        dt, pos = varint(data, pos)
+        ts = (ts + dt) & 0xFFFFFFFF
+        if tag & 0xF == TYPE_ADC:
+            values = []
+            for i in range((tag >> 4) + 1):
+                d, pos = varint(data, pos)
+                prev[i] += unzigzag(d)
+                values.append(prev[i])
+            yield ts, 'ADC', values
+        elif tag & 0xF == TYPE_CAN:
+            id_word, pos = varint(data, pos)
+            flags = data[pos]
+            pos += 1
+            ide = bool(flags & 0x20)
+            dlc = min(flags & 0xF, 8)
+            can_id = id_word & 0x1FFFFFFF if ide else (id_word >> 18) & 0x7FF
+            payload = data[pos:pos + dlc]
+            pos += dlc
+            yield ts, 'CAN%d' % (tag >> 4), (can_id, ide, bool(flags & 0x10), payload)
+        else:
+            raise ValueError('bad tag 0x%02X at 0x%X' % (tag, pos - 1))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument('dump', help='binary dump of the log region')
+    ap.add_argument('-B', '--block-size', type=int, default=512, help='DATALOG_SRV_BLOCK_SIZE')
+    ap.add_argument('-c', '--clock', type=float, default=0.0,
+                    help='timestamp clock in Hz (e.g. 1000000 for microseconds) to print seconds')
+    ap.add_argument('--csv', action='store_true', help='one CSV line per record')
+    opts = ap.parse_args()
+
+    with open(opts.dump, 'rb') as f:
+        data = f.read()
+
+    raw = stored = count = 0
+    for seq, off, ts, used, version in blocks(data, opts.block_size):
+        if version != 1:
+            print('--- block %u: unknown version %u ---' % (seq, version))
+            continue
+        stored += used
+        try:
+            for ts_rec, kind, fields in records(data, off, ts, used):
+                count += 1
+                stamp = '%.6f' % (ts_rec / opts.clock) if opts.clock else '%u' % ts_rec
+                if kind == 'ADC':
+                    raw += 8 + 2 * len(fields)
+                    text = ' '.join('%u' % v for v in fields)
+                    sep = ','.join('%u' % v for v in fields)
+                else:
+                    raw += 24
+                    can_id, ide, rtr, payload = fields
+                    ident = ('%08X' if ide else '%03X') % can_id
+                    text = '%s%s [%d] %s' % (ident, ' R' if rtr else '', len(payload), payload.hex(' '))
+                    sep = '%s,%d,%s' % (ident, rtr, payload.hex())
+                if opts.csv:
+                    print('%s,%s,%s' % (stamp, kind, sep))
+                else:
+                    print('%12s  %-5s %s' % (stamp, kind, text))
+        except (IndexError, ValueError) as e:
+            print('--- block %u: %s ---' % (seq, e))
+
+    if not opts.csv and stored:
+        print('--- %u records, %u bytes raw, %u bytes in flash (%.1fx) ---' %
+              (count, raw, stored, raw / stored))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,337 @@
+#!/usr/bin/env python3
+"""
+Generate a C header with static inline pack / unpack functions from a DBC file.
+
+For every BO_ message the header holds:
+    - <MSG>_ID / _DLC / _IS_EXTENDED
+    - <msg>_t with one raw field per signal (smallest fitting integer type)
+    - <MSG>_<SIG>_DECODE(raw) / _ENCODE(phys): factor / offset as float
+    - <MSG>_Pack(data, msg) / <MSG>_Unpack(msg, data): one constant
+      shift / mask expression per touched byte, no bit loops
+    - <MSG>_Changed(old, new): bitmask of <MSG>_<SIG>_CHANGED from a masked
+      XOR of the raw payloads, nothing is unpacked
+    - <MSG>_Update(msg, last, data): Changed + Unpack + copy, for RX paths
+
+Intel (@1) and Motorola (@0) byte order, signed and unsigned signals.
+Multiplexed signals (m<N>) are skipped with a warning, the multiplexor
+itself is generated as a normal signal.
+
+Usage:
+    python3 tools/dbc_codegen.py body.dbc -o app/can_body_db.h
+    python3 tools/dbc_codegen.py body.dbc -o app/can_body_db.h -p BODY -n 0x100-0x1FF
+"""
+
+import argparse
+import os
+import re
+import sys
+
+BO_RE = re.compile(r'^BO_\s+(\d+)\s+(\w+)\s*:\s*(\d+)\s+(\w+)')
+SG_RE = re.compile(r'^\s*SG_\s+(\w+)\s*(M|m\d+)?\s*:\s*(\d+)\|(\d+)@([01])([+-])\s*'
+                   r'\(\s*([^,]+)\s*,\s*([^)]+)\)\s*\[\s*([^|]+)\|([^\]]+)\]\s*"([^"]*)"')
+VALTYPE_RE = re.compile(r'^SIG_VALTYPE_\s+(\d+)\s+(\w+)\s*:\s*([12])')
+
+
+class Signal:
+    def __init__(self, name, start, length, intel, signed, factor, offset, unit):
+        self.name = name
+        self.start = start
+        self.length = length
+        self.intel = intel
+        self.signed = signed
+        self.factor = factor
+        self.offset = offset
+        self.unit = unit
+
+    def bit_positions(self):
+        """Message bit position (byte * 8 + bit) of raw bit k, k = 0 is the LSB."""
+        if self.intel:
+            return [self.start + k for k in range(self.length)]
+        # Motorola: start bit is the MSB, sawtooth numbering toward the LSB
+        msb_first = []
+        pos = self.start
+        for _ in range(self.length):
+            msb_first.append(pos)
+            pos = pos + 15 if pos % 8 == 0 else pos - 1
+        return list(reversed(msb_first))
+
+    def runs(self):
+        """[(byte, first bit in byte, first raw bit, width)] with contiguous bits."""
+        runs = []
+        for k, pos in enumerate(self.bit_positions()):
+            byte, bit = divmod(pos, 8)
+            if runs and runs[-1][0] == byte and runs[-1][1] + runs[-1][3] == bit:
+                runs[-1][3] += 1
+            else:
+                runs.append([byte, bit, k, 1])
+        return [tuple(r) for r in runs]
+
+    def width(self):
+        for bits in (8, 16, 32, 64):
+            if self.length <= bits:
+                return bits
+        raise ValueError('signal %s longer than 64 bits' % self.name)
+
+    def ctype(self):
+        return '%sint%u_t' % ('' if self.signed else 'u', self.width())
+
+
+class Message:
+    def __init__(self, can_id, name, dlc, sender):
+        self.extended = (can_id & 0x80000000) != 0
+        self.id = can_id & 0x1FFFFFFF
+        self.name = name
+        self.dlc = dlc
+        self.sender = sender
+        self.signals = []
+
+
+def parse(path):
+    messages = []
+    floats = set()
+    current = None
+
+    with open(path, encoding='utf-8', errors='replace') as f:
+        for lineno, line in enumerate(f, 1):
+            m = BO_RE.match(line)
+            if m:
+                current = Message(int(m.group(1)), m.group(2), int(m.group(3)), m.group(4))
+                messages.append(current)
+                continue
+
+            m = SG_RE.match(line)
+            if m and current is not None:
+                mux = m.group(2)
+                if mux is not None and mux != 'M':
+                    print('%s:%d: warning: multiplexed signal %s.%s skipped'
+                          % (path, lineno, current.name, m.group(1)), file=sys.stderr)
+                    continue
+                current.signals.append(Signal(
+                    m.group(1), int(m.group(3)), int(m.group(4)), m.group(5) == '1', m.group(6) == '-',
+                    float(m.group(7)), float(m.group(8)), m.group(11)))
+                continue
+
+            m = VALTYPE_RE.match(line)
+            if m:
+                floats.add((int(m.group(1)), m.group(2)))
+                continue
+
+            if line.strip() == '':
+                current = None
+
+    for msg in messages:
+        raw_id = msg.id | (0x80000000 if msg.extended else 0)
+        for sig in msg.signals:
+            if (raw_id, sig.name) in floats:
+                # IEEE float signals: raw bits in the integer field, caller reinterprets
+                print('warning: %s.%s is a float signal, generated as raw bits'
+                      % (msg.name, sig.name), file=sys.stderr)
+                sig.signed = False
+            for byte, _, _, _ in sig.runs():
+                if byte >= msg.dlc:
+                    raise ValueError('%s.%s exceeds DLC %u' % (msg.name, sig.name, msg.dlc))
+    return messages
+
+
+def c_float(value):
+    text = repr(float(value))
+    if 'e' not in text and '.' not in text:
+        text += '.0'
+    return text + 'f'
+
+
+def snake(name):
+    """EngineData -> Engine_Data, ABSStatus -> ABS_Status."""
+    return re.sub(r'(?<=[a-z0-9])(?=[A-Z])|(?<=[A-Z])(?=[A-Z][a-z])', '_', name)
+
+
+def emit_message(out, msg, prefix):
+    upper = snake(prefix + msg.name).upper()
+    lower = snake(prefix + msg.name).lower()
+    count = len(msg.signals)
+    mask_type = 'uint32_t' if count <= 32 else 'uint64_t'
+    one = '1UL' if count <= 32 else '1ULL'
+
+    out.append('/' + '*' * 79)
+    out.append(' * %s: id 0x%X%s, DLC %u, sender %s'
+               % (msg.name, msg.id, ' (extended)' if msg.extended else '', msg.dlc, msg.sender))
+    out.append(' ' + '*' * 78 + '/')
+    out.append('')
+    out.append('#define %-40s (0x%XUL)' % (upper + '_ID', msg.id))
+    out.append('#define %-40s (%uU)' % (upper + '_DLC', msg.dlc))
+    out.append('#define %-40s (%s)' % (upper + '_IS_EXTENDED', 'true' if msg.extended else 'false'))
+    out.append('')
+
+    for i, sig in enumerate(msg.signals):
+        out.append('#define %-40s (%s << %uU)' % ('%s_%s_CHANGED' % (upper, snake(sig.name).upper()), one, i))
+    for sig in msg.signals:
+        name = '%s_%s' % (upper, snake(sig.name).upper())
+        off = c_float(sig.offset)
+        out.append('#define %-40s ((float)(raw) * %s + %s)'
+                   % (name + '_DECODE(raw)', c_float(sig.factor), off))
+        # Round to nearest: (50.0 - 0) / 0.1 = 499.99..
+        out.append('#define %-40s ((%s)((((phys) - %s) / %s) + (((phys) >= %s) ? 0.5f : -0.5f)))'
+                   % (name + '_ENCODE(phys)', sig.ctype(), off, c_float(sig.factor), off))
+    out.append('')
+
+    out.append('/**')
+    out.append(' * @brief %s raw signal values' % msg.name)
+    out.append(' */')
+    out.append('typedef struct {')
+    for sig in msg.signals:
+        unit = (', ' + sig.unit) if sig.unit else ''
+        out.append('    %-9s %s;%s/**< %u bit @%u %s, x%s + %s%s */'
+                   % (sig.ctype(), sig.name, ' ' * max(1, 24 - len(sig.name)), sig.length, sig.start,
+                      'Intel' if sig.intel else 'Motorola', repr(sig.factor), repr(sig.offset), unit))
+    if not msg.signals:
+        out.append('    uint8_t reserved;')
+    out.append('} %s_t;' % lower)
+    out.append('')
+
+    # Pack: one expression per byte
+    per_byte = [[] for _ in range(msg.dlc)]
+    for sig in msg.signals:
+        field = '(uint%u_t)msg->%s' % (sig.width(), sig.name)
+        for byte, bit, k, width in sig.runs():
+            mask = (1 << width) - 1
+            expr = field if k == 0 else '(%s >> %uU)' % (field, k)
+            expr = '(%s & 0x%XU)' % (expr, mask)
+            if bit:
+                expr = '(%s << %uU)' % (expr, bit)
+            per_byte[byte].append(expr)
+
+    out.append('static inline void %s_Pack(uint8_t *data, const %s_t *msg)' % (upper, lower))
+    out.append('{')
+    if not msg.signals:
+        out.append('    (void)msg;')
+    for byte in range(msg.dlc):
+        if per_byte[byte]:
+            out.append('    data[%u] = (uint8_t)(%s);' % (byte, ' |\n               '.join(per_byte[byte])))
+        else:
+            out.append('    data[%u] = 0U;' % byte)
+    out.append('}')
+    out.append('')
+
+    out.append('static inline void %s_Unpack(%s_t *msg, const uint8_t *data)' % (upper, lower))
+    out.append('{')
+    if not msg.signals:
+        out.append('    (void)msg;')
+        out.append('    (void)data;')
+    for sig in msg.signals:
+        utype = 'uint%u_t' % sig.width()
+        terms = []
+        for byte, bit, k, width in sig.runs():
+            mask = (1 << width) - 1
+            expr = 'data[%u]' % byte if bit == 0 else '(data[%u] >> %uU)' % (byte, bit)
+            if bit + width < 8:
+                expr = '(%s & 0x%XU)' % (expr, mask)
+            expr = '(%s)%s' % (utype, expr)
+            if k:
+                expr = '(%s << %uU)' % (expr, k)
+            terms.append(expr)
+        raw = ' |\n        '.join(terms)
+        if sig.signed and sig.length < sig.width():
+            sign = 1 << (sig.length - 1)
+            out.append('    msg->%s = (%s)((%s)((%s) ^ 0x%XU) - 0x%XU);'
+                       % (sig.name, sig.ctype(), utype, raw, sign, sign))
+        else:
+            out.append('    msg->%s = (%s)(%s);' % (sig.name, sig.ctype(), raw))
+    out.append('}')
+    out.append('')
+
+    # Changed: XOR of the payloads against constant per-signal masks
+    used = sorted({byte for sig in msg.signals for byte, _, _, _ in sig.runs()})
+    out.append('static inline %s %s_Changed(const uint8_t *old, const uint8_t *data)' % (mask_type, upper))
+    out.append('{')
+    out.append('    %s changed = 0U;' % mask_type)
+    for byte in used:
+        out.append('    uint8_t x%u = (uint8_t)(old[%u] ^ data[%u]);' % (byte, byte, byte))
+    if not msg.signals:
+        out.append('    (void)old;')
+        out.append('    (void)data;')
+    for sig in msg.signals:
+        masks = {}
+        for byte, bit, _, width in sig.runs():
+            masks[byte] = masks.get(byte, 0) | (((1 << width) - 1) << bit)
+        cond = ' | '.join('(x%u & 0x%02XU)' % (b, m) for b, m in sorted(masks.items()))
+        out.append('    if ((%s) != 0U) {' % cond)
+        out.append('        changed |= %s_%s_CHANGED;' % (upper, snake(sig.name).upper()))
+        out.append('    }')
+    out.append('    return changed;')
+    out.append('}')
+    out.append('')
+
+    out.append('static inline %s %s_Update(%s_t *msg, uint8_t *last, const uint8_t *data)'
+               % (mask_type, upper, lower))
+    out.append('{')
+    out.append('    %s changed = %s_Changed(last, data);' % (mask_type, upper))
+    out.append('    uint32_t i;')
+    out.append('')
+    out.append('    if (changed != 0U) {')
+    out.append('        %s_Unpack(msg, data);' % upper)
+    out.append('        for (i = 0U; i < %s_DLC; i++) {' % upper)
+    out.append('            last[i] = data[i];')
+    out.append('        }')
+    out.append('    }')
+    out.append('    return changed;')
+    out.append('}')
+    out.append('')
+
+
+def in_range(msg, ranges):
+    return not ranges or any(lo <= msg.id <= hi for lo, hi in ranges)
+
+
+def parse_ranges(text):
+    ranges = []
+    for part in text.split(','):
+        lo, _, hi = part.partition('-')
+        ranges.append((int(lo, 0), int(hi or lo, 0)))
+    return ranges
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument('dbc', help='DBC file')
+    ap.add_argument('-o', '--output', required=True, help='generated header')
+    ap.add_argument('-p', '--prefix', default='', help='prefix for generated names')
+    ap.add_argument('-n', '--ids', help='only ids in ranges, e.g. 0x100-0x1FF,0x300')
+    opts = ap.parse_args()
+
+    try:
+        messages = parse(opts.dbc)
+    except ValueError as e:
+        print('error: %s' % e, file=sys.stderr)
+        return 1
+
+    prefix = (opts.prefix + '_') if opts.prefix else ''
+    ranges = parse_ranges(opts.ids) if opts.ids else []
+    base = os.path.basename(opts.output)
+    guard = re.sub(r'\W', '_', base).upper()
+
+    out = [
+        '/**',
+        ' * @file    %s' % base,
+        ' * @brief   CAN signal pack / unpack generated from %s' % os.path.basename(opts.dbc),
+        ' * @details Generated by tools/dbc_codegen.py, do not edit.',
+        ' */',
+        '',
+        '#ifndef %s' % guard,
+        '#define %s' % guard,
+        '',
+        '#include <stdint.h>',
+        '#include <stdbool.h>',
+        '',
+    ]
+    for msg in messages:
+        if in_range(msg, ranges):
+            emit_message(out, msg, prefix)
+    out.append('#endif /* %s */' % guard)
+
+    with open(opts.output, 'w', encoding='utf-8') as f:
+        f.write('\n'.join(out) + '\n')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+"""
+Build and run the host micro-benchmarks in tools/host_bench/.
+
+The service / middleware sources are compiled unchanged with the native gcc
+(HAL_HOST_BUILD=1): the peripheral and PPB register windows are mapped as RAM
+at their S32K144 addresses and the drivers they call are mocked, so the pure
+logic (can_srv RX / TX, CAN_CalculateTiming, touch filters, Nextion parser,
+SPLL calculator) can be profiled on the PC before validating on target.
+
+The report uses the benchmark_suite.c format (values in ps per operation):
+    python3 tools/host_bench.py -o base.txt
+    ... change the code ...
+    python3 tools/host_bench.py -o cur.txt
+    python3 tools/bench_compare.py base.txt cur.txt
+
+Profiling: the binary is built with -g -fno-omit-frame-pointer, e.g.
+    python3 tools/host_bench.py --no-run
+    perf record -g build/host_bench/host_bench && perf report
+    valgrind --tool=callgrind build/host_bench/host_bench 5
+
+Host tests (e.g. isotp_srv on a can_srv instance other than CAN0):
+    python3 tools/host_bench.py --test
+
+Extra defines go through -D (e.g. -D HAL_PARAM_CHECK_ENABLE=0U,
+-D CAN_SRV_TX_MB_COUNT=4U) to compare build configurations.
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+SOURCES = [
+    'tools/host_bench/host_bench_main.c',
+    'tools/host_bench/host_regs.c',
+    'tools/host_bench/host_drivers.c',
+    'tools/host_bench/bench_can.c',
+    'tools/host_bench/bench_clock.c',
+    'tools/host_bench/bench_touch.c',
+    'tools/host_bench/bench_nextion.c',
+    # Code under test, unmodified
+    'lib/hal/can/can.c',
+    'lib/hal/utils/lfqueue.c',
+    'lib/service/src/can_srv.c',
+    'lib/middleware/TouchSensor/touch_sensor.c',
+    'lib/middleware/HMI/Nextion.c',
+]
+
+# Host tests (--test): one binary per test, exit code = failed checks
+TEST_COMMON = [
+    'tools/host_bench/host_regs.c',
+    'tools/host_bench/host_drivers.c',
+    'lib/hal/can/can.c',
+    'lib/hal/utils/lfqueue.c',
+    'lib/service/src/can_srv.c',
+]
+
+TESTS = {
+    'test_isotp': ['tools/host_bench/test_isotp.c', 'lib/service/src/isotp_srv.c'],
+}
+
+DEFINES = ['CPU_S32K144HFT0VLLT', 'HAL_HOST_BUILD=1U', 'UART_DMA_ENABLE=1']
+
+# 32-bit address casts in the HAL are intended, only noise on a 64-bit host
+CFLAGS = ['-std=gnu99', '-g', '-fno-omit-frame-pointer', '-Wall', '-Wextra',
+          '-Wno-int-to-pointer-cast', '-Wno-pointer-to-int-cast', '-pthread']
+
+
+def include_dirs():
+    dirs = [ROOT, os.path.join(ROOT, 'tools', 'host_bench')]
+    for path, _, _ in os.walk(os.path.join(ROOT, 'lib')):
+        dirs.append(path)
+    return dirs
+
+
+def build(opts, name='host_bench', sources=SOURCES):
+    os.makedirs(opts.build_dir, exist_ok=True)
+    binary = os.path.join(opts.build_dir, name)
+    cmd = [opts.cc] + CFLAGS + [opts.opt] + opts.cflags
+    cmd += ['-D' + d for d in DEFINES + opts.define]
+    cmd += ['-I' + d for d in include_dirs()]
+    cmd += [os.path.join(ROOT, s) for s in sources]
+    cmd += ['-o', binary]
+    if opts.verbose:
+        print(' '.join(cmd))
+    if subprocess.call(cmd) != 0:
+        sys.exit('host_bench: %s build failed' % name)
+    return binary
+
+
+def run_tests(opts):
+    failed = 0
+    for name, sources in sorted(TESTS.items()):
+        binary = build(opts, name, sources + TEST_COMMON)
+        if opts.no_run:
+            print(binary)
+        elif subprocess.call([binary]) != 0:
+            failed += 1
+    return 1 if failed else 0
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument('--cc', default=os.environ.get('CC', 'gcc'), help='host C compiler (default gcc)')
+    ap.add_argument('-O', '--opt', default='-O2', help='optimization flag (default -O2)')
+    ap.add_argument('-D', '--define', action='append', default=[], help='extra define, repeatable')
+    ap.add_argument('--cflags', nargs=argparse.REMAINDER, default=[], help='extra compiler flags (last option)')
+    ap.add_argument('--build-dir', default=os.path.join(ROOT, 'build', 'host_bench'), help='output directory')
+    ap.add_argument('-w', '--window', type=int, help='minimum timed window per run in ms (default 20)')
+    ap.add_argument('-o', '--output', help='also write the report to this file')
+    ap.add_argument('--test', action='store_true', help='build and run the host tests instead')
+    ap.add_argument('--no-run', action='store_true', help='only build')
+    ap.add_argument('-v', '--verbose', action='store_true', help='print the compiler command')
+    opts = ap.parse_args()
+
+    if opts.test:
+        return run_tests(opts)
+
+    binary = build(opts)
+    if opts.no_run:
+        print(binary)
+        return 0
+
+    run = [binary] + ([str(opts.window)] if opts.window else [])
+    report = subprocess.run(run, stdout=subprocess.PIPE, universal_newlines=True)
+    sys.stdout.write(report.stdout)
+    if opts.output:
+        with open(opts.output, 'w', encoding='utf-8') as f:
+            f.write(report.stdout)
+    return report.returncode
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,167 @@
+/**
+ * @file    bench_can.c
+ * @brief   Host workload: CAN bit timing và can_srv RX / TX path
+ * @details
+ * - host_can_timing: CAN_CalculateTiming() (can.c) trên bảng clock x baudrate
+ * - host_can_srv_rx: CAN_SRV_IRQHandler() (đọc MB, unpack, ring) +
+ *   CAN_SRV_Receive() + RX hook lọc ID, time source bật
+ * - host_can_srv_tx: CAN_SRV_Send() + TX hook, MB được trả về INACTIVE sau
+ *   mỗi frame (giả lập TX complete)
+ *
+ * can_srv chạy trên CAN0 của register mock, mailbox RAM được nạp trước mỗi
+ * frame như khi FlexCAN vừa nhận xong.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "host_bench.h"
+#include "host_mock.h"
+#include "can.h"
+#include "can_srv.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define BENCH_CAN_ID            (0x123U)
+#define BENCH_CAN_CS_RX_FULL    (0x02000000UL | (8UL << 16))    /* CODE = FULL, DLC 8 */
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static const uint32_t s_canClocks[] = { 8000000U, 40000000U, 48000000U, 80000000U };
+static const uint32_t s_canBauds[] = { 125000U, 250000U, 500000U, 1000000U };
+
+static uint32_t s_timeUs = 0U;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static void BENCH_CanTiming(uint32_t n)
+{
+    can_timing_config_t timing;
+    uint32_t acc = 0U;
+
+    for (uint32_t i = 0U; i < n; i++) {
+        uint32_t clock = s_canClocks[i & 3U];
+        uint32_t baud = s_canBauds[(i >> 2) & 3U];
+
+        if (CAN_CalculateTiming(clock, baud, &timing) == STATUS_SUCCESS) {
+            acc += timing.preDiv + timing.propSeg + timing.phaseSeg1;
+        }
+    }
+
+    g_hostBenchSink = acc;
+}
+
+static uint32_t BENCH_CanTimeSource(void)
+{
+    return s_timeUs++;
+}
+
+static bool BENCH_CanRxHook(can_srv_message_t *msg)
+{
+    return (msg->id & 0x700U) == (BENCH_CAN_ID & 0x700U);
+}
+
+static bool BENCH_CanTxHook(can_srv_message_t *msg)
+{
+    /* Kiểu hook của secoc_srv: ghi counter vào byte cuối */
+    msg->data[7]++;
+    return true;
+}
+
+static void BENCH_CanSrvRx(uint32_t n)
+{
+    volatile uint32_t *mb = &CAN0->RAMn[CAN_SRV_RX_MB * 4U];
+    can_srv_message_t msg;
+    uint32_t acc = 0U;
+
+    for (uint32_t i = 0U; i < n; i++) {
+        mb[0] = BENCH_CAN_CS_RX_FULL | (i & 0xFFFFU);
+        mb[1] = (BENCH_CAN_ID << 18);
+        mb[2] = 0x11223344UL ^ i;
+        mb[3] = 0x55667788UL;
+        CAN0->IFLAG1 = (1UL << CAN_SRV_RX_MB);
+
+        CAN_SRV_IRQHandler(CAN_SRV_CAN0);
+        if (CAN_SRV_Receive(CAN_SRV_CAN0, &msg) == CAN_SRV_SUCCESS) {
+            acc += msg.data[0] + msg.timestampUs;
+        }
+    }
+
+    g_hostBenchSink = acc;
+}
+
+static void BENCH_CanSrvTx(uint32_t n)
+{
+    can_srv_message_t msg = {
+        .id = BENCH_CAN_ID,
+        .data = { 1U, 2U, 3U, 4U, 5U, 6U, 7U, 0U },
+        .length = 8U,
+        .isExtended = false
+    };
+    uint32_t acc = 0U;
+
+    for (uint32_t i = 0U; i < n; i++) {
+        msg.data[0] = (uint8_t)i;
+        if (CAN_SRV_Send(CAN_SRV_CAN0, &msg) == CAN_SRV_SUCCESS) {
+            acc++;
+        }
+        /* TX complete: pool MB về INACTIVE */
+        for (uint32_t m = CAN_SRV_TX_MB_FIRST; m < (CAN_SRV_TX_MB_FIRST + CAN_SRV_TX_MB_COUNT); m++) {
+            CAN0->RAMn[m * 4U] = 0x08000000UL;
+        }
+    }
+
+    g_hostBenchSink = acc;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+void BENCH_Can(bool regsMapped)
+{
+    const can_srv_config_t config = {
+        .baudrate = 500000U,
+        .filter_id = BENCH_CAN_ID,
+        .filter_mask = 0x7FFU,
+        .filter_extended = false
+    };
+    can_srv_status_t status;
+
+    HOST_BenchRun("host_can_timing", BENCH_CanTiming);
+
+    if (!regsMapped) {
+        HOST_BenchSkip("host_can_srv", "no register mock");
+        return;
+    }
+
+    /* Freeze handshake của CAN_SRV_Init() cần register model */
+    HOST_RegsReset();
+    if (!HOST_ModelStart()) {
+        HOST_BenchSkip("host_can_srv", "register model failed");
+        return;
+    }
+    status = CAN_SRV_Init(CAN_SRV_CAN0, &config);
+    HOST_ModelStop();
+
+    if (status != CAN_SRV_SUCCESS) {
+        HOST_BenchSkip("host_can_srv", "init failed");
+        return;
+    }
+
+    (void)CAN_SRV_RegisterTimeSource(BENCH_CanTimeSource);
+    (void)CAN_SRV_RegisterHooks(CAN_SRV_CAN0, BENCH_CanTxHook, BENCH_CanRxHook);
+
+    HOST_BenchRun("host_can_srv_rx", BENCH_CanSrvRx);
+    HOST_BenchRun("host_can_srv_tx", BENCH_CanSrvTx);
+
+    (void)CAN_SRV_RegisterTimeSource(NULL);
+}
@@ -0,0 +1,101 @@
+/**
+ * @file    bench_clock.c
+ * @brief   Host workload: SPLL calculator
+ * @details
+ * - host_spll_calc: một lần tính SPLL_CLK từ (SOSC, PREDIV, MULT)
+ * - host_spll_search: tìm (PREDIV, MULT) trong VCO range cho SPLL_CLK gần
+ *   target nhất, quét đủ 8 x 32 tổ hợp
+ *
+ * Phép tính là CLOCK_SRV_V2_SPLL_OUT_HZ(), đúng thân của
+ * CLOCK_SRV_V2_CalculateSPLLFreq(). clock_srv_v2.c chưa build được với API
+ * scg.h hiện tại nên workload dùng macro của header thay vì link file đó.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "host_bench.h"
+#include "clock_srv_v2.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define BENCH_SPLL_MULT_MIN     (16U)
+#define BENCH_SPLL_MULT_MAX     (47U)
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static const uint32_t s_soscHz[] = { 8000000U, 12000000U, 16000000U, 40000000U };
+static const uint32_t s_targetHz[] = { 80000000U, 112000000U, 100000000U, 96000000U };
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/* Không inline: đo đúng chi phí một lần gọi calculator */
+static __attribute__((noinline)) uint32_t BENCH_SpllFreq(uint32_t sosc_freq, uint8_t prediv, uint8_t mult)
+{
+    return CLOCK_SRV_V2_SPLL_OUT_HZ(sosc_freq, prediv, mult);
+}
+
+static uint32_t BENCH_SpllSearch(uint32_t sosc_freq, uint32_t target)
+{
+    uint32_t bestErr = UINT32_MAX;
+    uint32_t best = 0U;
+
+    for (uint8_t prediv = 0U; prediv <= (uint8_t)CLOCK_SRV_V2_SPLL_PREDIV_8; prediv++) {
+        for (uint8_t mult = BENCH_SPLL_MULT_MIN; mult <= BENCH_SPLL_MULT_MAX; mult++) {
+            uint32_t out = BENCH_SpllFreq(sosc_freq, prediv, mult);
+            uint32_t vco = out * 2U;
+            uint32_t err = (out > target) ? (out - target) : (target - out);
+
+            if ((vco < CLOCK_SRV_V2_SPLL_VCO_MIN_HZ) || (vco > CLOCK_SRV_V2_SPLL_VCO_MAX_HZ)) {
+                continue;
+            }
+            if (err < bestErr) {
+                bestErr = err;
+                best = ((uint32_t)prediv << 8) | mult;
+            }
+        }
+    }
+
+    return best;
+}
+
+static void BENCH_SpllCalc(uint32_t n)
+{
+    uint32_t acc = 0U;
+
+    for (uint32_t i = 0U; i < n; i++) {
+        acc += BENCH_SpllFreq(s_soscHz[i & 3U], (uint8_t)(i & 7U),
+                              (uint8_t)(BENCH_SPLL_MULT_MIN + (i & 31U)));
+    }
+
+    g_hostBenchSink = acc;
+}
+
+static void BENCH_SpllSearchAll(uint32_t n)
+{
+    uint32_t acc = 0U;
+
+    for (uint32_t i = 0U; i < n; i++) {
+        acc += BENCH_SpllSearch(s_soscHz[i & 3U], s_targetHz[(i >> 2) & 3U]);
+    }
+
+    g_hostBenchSink = acc;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+void BENCH_Clock(void)
+{
+    HOST_BenchRun("host_spll_calc", BENCH_SpllCalc);
+    HOST_BenchRun("host_spll_search", BENCH_SpllSearchAll);
+}
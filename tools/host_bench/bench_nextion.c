@@ -0,0 +1,121 @@
+/**
+ * @file    bench_nextion.c
+ * @brief   Host workload: Nextion RX parser và TX command queue
+ * @details
+ * - host_nextion_parse: NextionUpdate() trên luồng reply trộn (touch event,
+ *   number kể cả -1 chứa 0xFF, string, page id, cmd finished), cắt thành
+ *   burst như circular RX DMA báo về; đo theo từng byte
+ * - host_nextion_setval: NextionSetVal() (format command) + NextionProcess()
+ *   đến khi queue trống, mock DMA xong ngay
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "host_bench.h"
+#include "Nextion.h"
+#include <string.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define BENCH_NEX_BURST         (24U)   /* Byte mỗi lần RX DMA notification */
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static const uint8_t s_nexStream[] = {
+    0x65, 0x01, 0x05, 0x01, 0xFF, 0xFF, 0xFF,               /* page 1 id 5 press */
+    0x71, 0x2A, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,         /* number 42 */
+    0x65, 0x01, 0x05, 0x00, 0xFF, 0xFF, 0xFF,               /* page 1 id 5 release */
+    0x70, 'h', 'e', 'l', 'l', 'o', 0xFF, 0xFF, 0xFF,        /* string "hello" */
+    0x71, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,         /* number -1 */
+    0x66, 0x02, 0xFF, 0xFF, 0xFF,                           /* current page 2 */
+    0x01, 0xFF, 0xFF, 0xFF,                                 /* cmd finished */
+    0x65, 0x07, 0x03, 0x01, 0xFF, 0xFF, 0xFF                /* page 7 id 3 press */
+};
+
+static Nextion s_nex;
+static NexComp s_comps[NEXTION_MAX_COMP_COUNT];
+static uint32_t s_nexEvents = 0U;
+static uint32_t s_nexPos = 0U;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static void BENCH_NexOnEvent(void)
+{
+    s_nexEvents++;
+}
+
+static void BENCH_NexParse(uint32_t n)
+{
+    uint32_t pos = s_nexPos;
+
+    while (n > 0U) {
+        uint32_t chunk = sizeof(s_nexStream) - pos;
+
+        if (chunk > BENCH_NEX_BURST) {
+            chunk = BENCH_NEX_BURST;
+        }
+        if (chunk > n) {
+            chunk = n;
+        }
+
+        (void)NextionUpdate(&s_nex, &s_nexStream[pos], chunk);
+        pos += chunk;
+        if (pos >= sizeof(s_nexStream)) {
+            pos = 0U;
+        }
+        n -= chunk;
+    }
+
+    s_nexPos = pos;
+    g_hostBenchSink = s_nexEvents + (uint32_t)s_nex.NextNumBuff;
+}
+
+static void BENCH_NexSetVal(uint32_t n)
+{
+    for (uint32_t i = 0U; i < n; i++) {
+        (void)NextionSetVal(&s_nex, &s_comps[i % NEXTION_MAX_COMP_COUNT], (int)(i * 7919U) - 500000);
+        while (NextionProcess(&s_nex) != NEX_OK) {
+        }
+    }
+
+    g_hostBenchSink = s_nex._txTail;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+void BENCH_Nextion(void)
+{
+    static char names[NEXTION_MAX_COMP_COUNT][8];
+
+    memset(&s_nex, 0, sizeof(s_nex));
+    if (NextionInit(&s_nex, LPUART1, 2U, 3U) != NEX_OK) {
+        HOST_BenchSkip("host_nextion", "init failed");
+        return;
+    }
+
+    /* Đủ bảng component, rải trên 8 page */
+    for (uint32_t i = 0U; i < NEXTION_MAX_COMP_COUNT; i++) {
+        uint8_t page = (uint8_t)(i % NEXTION_MAX_PAGES);
+        uint8_t id = (uint8_t)((i * 5U) % NEXTION_MAX_PAGE_IDS);
+
+        names[i][0] = 'n';
+        names[i][1] = (char)('0' + (i / 10U));
+        names[i][2] = (char)('0' + (i % 10U));
+        names[i][3] = '\0';
+        (void)NextionAddComp(&s_nex, &s_comps[i], names[i], page, id, BENCH_NexOnEvent, BENCH_NexOnEvent);
+    }
+
+    HOST_BenchRun("host_nextion_parse", BENCH_NexParse);
+    HOST_BenchRun("host_nextion_setval", BENCH_NexSetVal);
+}
@@ -0,0 +1,131 @@
+/**
+ * @file    bench_touch.c
+ * @brief   Host workload: touch sensor filter / detection path
+ * @details
+ * TOUCH_Process() ở software trigger mode trên TOUCH_MAX_CHANNELS channel,
+ * mock ADC trả baseline + nhiễu và lần lượt "chạm" từng channel, nên mỗi
+ * frame chạy median filter, drift compensation, debounce và callback.
+ * - host_touch_frame_median5: median-of-5 bật
+ * - host_touch_frame_raw: không median filter
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "host_bench.h"
+#include "host_mock.h"
+#include "touch_sensor.h"
+#include <stddef.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define BENCH_TOUCH_BASELINE    (2000U)
+#define BENCH_TOUCH_THRESHOLD   (100U)
+#define BENCH_TOUCH_DEPTH       (400U)  /* ADC giảm khi chạm */
+#define BENCH_TOUCH_PERIOD      (512U)  /* Frame mỗi lượt chạm một channel */
+#define BENCH_TOUCH_HOLD        (64U)   /* Frame giữ chạm */
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static uint32_t s_sampleCount = 0U;
+static uint32_t s_noise = 1U;
+static uint32_t s_events = 0U;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static uint16_t BENCH_TouchSample(uint8_t channel)
+{
+    uint32_t frame = s_sampleCount / TOUCH_MAX_CHANNELS;
+    uint32_t touched = (frame / BENCH_TOUCH_PERIOD) % TOUCH_MAX_CHANNELS;
+    uint16_t value;
+
+    s_sampleCount++;
+    s_noise = (s_noise * 1103515245U) + 12345U;
+    value = (uint16_t)(BENCH_TOUCH_BASELINE + ((s_noise >> 16) & 0x0FU) - 8U);
+
+    if (((uint32_t)(channel - 1U) == touched) && ((frame % BENCH_TOUCH_PERIOD) < BENCH_TOUCH_HOLD)) {
+        value = (uint16_t)(value - BENCH_TOUCH_DEPTH);
+    }
+
+    return value;
+}
+
+static void BENCH_TouchCallback(uint8_t channel, touch_state_t state, int16_t delta)
+{
+    (void)channel;
+    (void)state;
+    (void)delta;
+    s_events++;
+}
+
+static bool BENCH_TouchSetup(uint8_t medianWindow)
+{
+    const touch_system_config_t system = {
+        .trigger_mode = TOUCH_TRIGGER_SW,
+        .num_channels = TOUCH_MAX_CHANNELS,
+        .callback = BENCH_TouchCallback
+    };
+    touch_channel_config_t channel = {
+        .baseline = BENCH_TOUCH_BASELINE,
+        .threshold = BENCH_TOUCH_THRESHOLD,
+        .debounce_count = 3U,
+        .enable_drift_compensation = true,
+        .median_window = medianWindow
+    };
+
+    (void)TOUCH_StopScan();
+    if (TOUCH_Init(&system) != TOUCH_STATUS_SUCCESS) {
+        return false;
+    }
+
+    for (uint8_t i = 0U; i < TOUCH_MAX_CHANNELS; i++) {
+        channel.adc_channel = (uint8_t)(i + 1U);    /* 0 = channel không dùng */
+        if (TOUCH_ConfigChannel(i, &channel) != TOUCH_STATUS_SUCCESS) {
+            return false;
+        }
+    }
+
+    s_sampleCount = 0U;
+    return TOUCH_StartScan() == TOUCH_STATUS_SUCCESS;
+}
+
+static void BENCH_TouchFrames(uint32_t n)
+{
+    for (uint32_t i = 0U; i < n; i++) {
+        (void)TOUCH_Process();
+    }
+
+    g_hostBenchSink = s_events;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+void BENCH_Touch(void)
+{
+    HOST_AdcSetSource(BENCH_TouchSample);
+
+    if (BENCH_TouchSetup(5U)) {
+        HOST_BenchRun("host_touch_frame_median5", BENCH_TouchFrames);
+    } else {
+        HOST_BenchSkip("host_touch_frame_median5", "setup failed");
+    }
+
+    if (BENCH_TouchSetup(1U)) {
+        HOST_BenchRun("host_touch_frame_raw", BENCH_TouchFrames);
+    } else {
+        HOST_BenchSkip("host_touch_frame_raw", "setup failed");
+    }
+
+    (void)TOUCH_StopScan();
+    HOST_AdcSetSource(NULL);
+}
@@ -0,0 +1,59 @@
+/**
+ * @file    host_bench.h
+ * @brief   Harness của host micro-benchmark (đo thời gian, in report)
+ * @details
+ * Mỗi workload là một hàm chạy n lần thao tác cần đo. Harness tự tăng n đến
+ * khi một lượt chạy đủ dài, lặp lại vài lượt và lấy lượt nhanh nhất, rồi in
+ * cùng format với lib/service/example/benchmark_suite.c để so sánh bằng
+ * tools/bench_compare.py:
+ *   BENCH_BEGIN,<suite version>,0
+ *   BENCH,<metric>,<ps mỗi thao tác>,ps
+ *   BENCH_SKIP,<metric>,<reason>
+ *   BENCH_END,<metric count>
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+#ifndef HOST_BENCH_H
+#define HOST_BENCH_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/** @brief Workload: chạy đúng n thao tác */
+typedef void (*host_bench_body_t)(uint32_t n);
+
+/** @brief Ghi kết quả vào đây để compiler không bỏ phần tính toán */
+extern volatile uint32_t g_hostBenchSink;
+
+/*******************************************************************************
+ * API Functions
+ ******************************************************************************/
+
+/**
+ * @brief Đo một workload và in dòng BENCH (picosecond mỗi thao tác)
+ * @param metric Tên metric (không chứa dấu phẩy)
+ * @param body   Workload
+ */
+void HOST_BenchRun(const char *metric, host_bench_body_t body);
+
+/**
+ * @brief In dòng BENCH_SKIP cho workload không chạy được trên host này
+ */
+void HOST_BenchSkip(const char *metric, const char *reason);
+
+/* Workload groups (bench_*.c) */
+void BENCH_Can(bool regsMapped);
+void BENCH_Clock(void);
+void BENCH_Touch(void);
+void BENCH_Nextion(void);
+
+#endif /* HOST_BENCH_H */
@@ -0,0 +1,116 @@
+/**
+ * @file    host_bench_main.c
+ * @brief   Host micro-benchmark: entry point và timing harness
+ * @details
+ * Build và chạy bằng tools/host_bench.py. Binary cũng chạy trực tiếp dưới
+ * perf / valgrind --tool=callgrind / gprof (build với -pg) để profile.
+ *
+ * Usage: host_bench [min window ms] (mặc định HOST_BENCH_WINDOW_MS)
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "host_bench.h"
+#include "host_mock.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Tăng khi workload hoặc format report đổi: report khác version không so sánh */
+#define HOST_BENCH_VERSION      (1U)
+
+#define HOST_BENCH_WINDOW_MS    (20U)   /* Thời gian tối thiểu của một lượt đo */
+#define HOST_BENCH_REPEAT       (5U)    /* Số lượt, lấy lượt nhanh nhất */
+#define HOST_BENCH_MAX_N        (1UL << 30)
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+volatile uint32_t g_hostBenchSink;
+
+static uint64_t s_windowNs = (uint64_t)HOST_BENCH_WINDOW_MS * 1000000ULL;
+static uint32_t s_metricCount = 0U;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static uint64_t HOST_NowNs(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+static uint64_t HOST_TimeBody(host_bench_body_t body, uint32_t n)
+{
+    uint64_t start = HOST_NowNs();
+
+    body(n);
+    return HOST_NowNs() - start;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+void HOST_BenchRun(const char *metric, host_bench_body_t body)
+{
+    uint32_t n = 1U;
+    uint64_t best;
+
+    /* Warm-up + calibrate: gấp đôi n đến khi một lượt dài hơn window */
+    while ((HOST_TimeBody(body, n) < s_windowNs) && (n < HOST_BENCH_MAX_N)) {
+        n <<= 1;
+    }
+
+    best = UINT64_MAX;
+    for (uint32_t r = 0U; r < HOST_BENCH_REPEAT; r++) {
+        uint64_t t = HOST_TimeBody(body, n);
+        if (t < best) {
+            best = t;
+        }
+    }
+
+    printf("BENCH,%s,%llu,ps\n", metric, (unsigned long long)((best * 1000ULL) / n));
+    s_metricCount++;
+}
+
+void HOST_BenchSkip(const char *metric, const char *reason)
+{
+    printf("BENCH_SKIP,%s,%s\n", metric, reason);
+}
+
+int main(int argc, char **argv)
+{
+    bool mapped;
+
+    if (argc > 1) {
+        s_windowNs = strtoull(argv[1], NULL, 10) * 1000000ULL;
+    }
+
+    mapped = HOST_RegsInit();
+
+    printf("BENCH_BEGIN,%u,0\n", HOST_BENCH_VERSION);
+    if (!mapped) {
+        printf("# register windows not mapped, register-backed workloads skipped\n");
+    }
+
+    BENCH_Can(mapped);
+    BENCH_Clock();
+    BENCH_Touch();
+    BENCH_Nextion();
+
+    printf("BENCH_END,%u\n", s_metricCount);
+
+    return 0;
+}
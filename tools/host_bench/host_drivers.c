@@ -0,0 +1,201 @@
+/**
+ * @file    host_drivers.c
+ * @brief   Driver mock cho host benchmark build
+ * @details
+ * Thay các HAL driver mà code được bench gọi tới nhưng không thuộc phần
+ * cần đo (cấu hình ADC / DMA / UART / clock). Mọi hàm trả success ngay,
+ * riêng ADC_ReadBlocking() lấy sample từ nguồn do bench đăng ký.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "host_mock.h"
+#include "adc.h"
+#include "dma.h"
+#include "uart.h"
+#include "nvic.h"
+#include "pcc.h"
+#include "scg.h"
+#include "clock_manager.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define HOST_BUS_CLOCK_HZ   (40000000U)
+#define HOST_SOSC_DIV2_HZ   (8000000U)
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static host_adc_source_t s_adcSource = NULL;
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+void HOST_AdcSetSource(host_adc_source_t source)
+{
+    s_adcSource = source;
+}
+
+/* ADC (touch_sensor.c) */
+ADC_Status_t ADC_Init(ADC_Instance_t instance, const ADC_Config_t *config)
+{
+    (void)instance;
+    (void)config;
+    return ADC_STATUS_SUCCESS;
+}
+
+ADC_Status_t ADC_ReadBlocking(ADC_Instance_t instance, ADC_Channel_t channel, uint16_t *result)
+{
+    (void)instance;
+    *result = (s_adcSource != NULL) ? s_adcSource((uint8_t)channel) : 0U;
+    return ADC_STATUS_SUCCESS;
+}
+
+ADC_Status_t ADC_ConfigScanGroup(const ADC_ScanGroupConfig_t *config)
+{
+    (void)config;
+    return ADC_STATUS_SUCCESS;
+}
+
+ADC_Status_t ADC_StartScanGroup(void)
+{
+    return ADC_STATUS_SUCCESS;
+}
+
+ADC_Status_t ADC_StopScanGroup(void)
+{
+    return ADC_STATUS_SUCCESS;
+}
+
+ADC_Status_t ADC_StartScanGroupDma(ADC_Instance_t instance, uint8_t dmaChannel, uint16_t *frames,
+                                   ADC_DmaCallback_t callback, void *userData)
+{
+    (void)instance;
+    (void)dmaChannel;
+    (void)frames;
+    (void)callback;
+    (void)userData;
+    return ADC_STATUS_SUCCESS;
+}
+
+ADC_Status_t ADC_StopDmaStream(ADC_Instance_t instance)
+{
+    (void)instance;
+    return ADC_STATUS_SUCCESS;
+}
+
+uint32_t ADC_GetDmaStreamOverruns(ADC_Instance_t instance)
+{
+    (void)instance;
+    return 0U;
+}
+
+/* DMA / UART (Nextion.c): transfer coi như xong ngay */
+bool DMA_IsChannelDone(uint8_t channel)
+{
+    (void)channel;
+    return true;
+}
+
+status_t DMA_ClearDone(uint8_t channel)
+{
+    (void)channel;
+    return STATUS_SUCCESS;
+}
+
+UART_Status_t UART_ConfigTxDMA(LPUART_RegType *base, uint8_t dmaChannel)
+{
+    (void)base;
+    (void)dmaChannel;
+    return UART_STATUS_SUCCESS;
+}
+
+UART_Status_t UART_SendDMA(LPUART_RegType *base, uint8_t dmaChannel,
+                           const uint8_t *txBuff, uint32_t txSize)
+{
+    (void)base;
+    (void)dmaChannel;
+    (void)txBuff;
+    (void)txSize;
+    return UART_STATUS_SUCCESS;
+}
+
+UART_Status_t UART_StartCircularRxDMA(LPUART_RegType *base, uint8_t dmaChannel,
+                                      uint8_t *rxBuff, uint16_t rxSize,
+                                      UART_RxDmaCallback_t callback, void *userData)
+{
+    (void)base;
+    (void)dmaChannel;
+    (void)rxBuff;
+    (void)rxSize;
+    (void)callback;
+    (void)userData;
+    return UART_STATUS_SUCCESS;
+}
+
+/* NVIC: host không có interrupt */
+uint32_t NVIC_DisableGlobalIRQ(void)
+{
+    return 0U;
+}
+
+void NVIC_EnableGlobalIRQ(uint32_t primask)
+{
+    (void)primask;
+}
+
+nvic_status_t NVIC_InstallHandler(IRQn_Type IRQn, nvic_handler_t handler)
+{
+    (void)IRQn;
+    (void)handler;
+    return NVIC_STATUS_SUCCESS;
+}
+
+/* Clock (can.c) */
+bool PCC_EnableCANClock(uint8_t instance, can_clk_src_t clockSource)
+{
+    (void)instance;
+    (void)clockSource;
+    return true;
+}
+
+bool PCC_DisableCANClock(uint8_t instance)
+{
+    (void)instance;
+    return true;
+}
+
+uint32_t PCC_GetSoscDiv2Freq(void)
+{
+    return HOST_SOSC_DIV2_HZ;
+}
+
+uint32_t SCG_GetBusClockFreq(void)
+{
+    return HOST_BUS_CLOCK_HZ;
+}
+
+uint32_t ClockManager_GetBusFreq(void)
+{
+    return HOST_BUS_CLOCK_HZ;
+}
+
+bool ClockManager_RegisterNotifier(clock_notify_callback_t callback, void *userData)
+{
+    (void)callback;
+    (void)userData;
+    return true;
+}
+
+void ClockManager_UnregisterNotifier(clock_notify_callback_t callback, void *userData)
+{
+    (void)callback;
+    (void)userData;
+}
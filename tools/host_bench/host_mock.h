@@ -0,0 +1,69 @@
+/**
+ * @file    host_mock.h
+ * @brief   Register block và driver mock cho host benchmark build
+ * @details
+ * Host build (HAL_HOST_BUILD = 1) chạy service / middleware code trên PC:
+ * - Register mock: vùng peripheral (0x40000000) và PPB (0xE0000000) được
+ *   mmap thành RAM tại đúng địa chỉ của S32K144, nên CAN0, LPUART1, ... dùng
+ *   nguyên macro base address trong *_reg.h
+ * - Register là RAM thuần: bit w1c không tự clear, status bit không tự set.
+ *   Bench tự nạp trạng thái cần (MB code, IFLAG) trước mỗi lần chạy
+ * - HOST_ModelStart(): thread nhỏ giả lập handshake FlexCAN FRZ -> FRZACK
+ *   để code cấu hình (CAN_SRV_Init) không treo trong vòng poll
+ * - Driver mock (host_drivers.c): ADC / DMA / UART / clock driver mà
+ *   touch_sensor.c, Nextion.c, can.c gọi tới, luôn trả success
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ *
+ * @note Chỉ dùng cho tools/host_bench, không bao giờ link vào firmware
+ */
+
+#ifndef HOST_MOCK_H
+#define HOST_MOCK_H
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/** @brief ADC sample source của mock ADC_ReadBlocking() */
+typedef uint16_t (*host_adc_source_t)(uint8_t channel);
+
+/*******************************************************************************
+ * API Functions
+ ******************************************************************************/
+
+/**
+ * @brief Map các register window thành RAM (gọi một lần trước mọi bench)
+ * @return false nếu host không cho map tại địa chỉ cố định
+ */
+bool HOST_RegsInit(void);
+
+/**
+ * @brief Đưa mọi register về 0 (trạng thái sau reset của mock)
+ */
+void HOST_RegsReset(void);
+
+/**
+ * @brief Chạy register model (FlexCAN0-2: FRZACK theo FRZ)
+ * @note Chỉ bật quanh đoạn cấu hình, tắt trước khi đo để không chiếm CPU
+ */
+bool HOST_ModelStart(void);
+
+/**
+ * @brief Dừng register model
+ */
+void HOST_ModelStop(void);
+
+/**
+ * @brief Đăng ký nguồn sample cho mock ADC_ReadBlocking() (NULL = luôn 0)
+ */
+void HOST_AdcSetSource(host_adc_source_t source);
+
+#endif /* HOST_MOCK_H */
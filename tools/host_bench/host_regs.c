@@ -0,0 +1,150 @@
+/**
+ * @file    host_regs.c
+ * @brief   Register block mock: peripheral / PPB window trên RAM của host
+ * @details
+ * Linux x86-64 / AArch64 để trống vùng địa chỉ thấp, nên hai window 1 MB
+ * map được tại đúng base address của S32K144 (MAP_FIXED_NOREPLACE, không đè
+ * mapping có sẵn). Driver code dùng nguyên con trỏ (CAN_Type *)CAN0_BASE.
+ *
+ * Register model (thread riêng) chỉ giả lập những handshake mà code cấu hình
+ * poll vô hạn; cập nhật bằng CAS để không làm mất write của code đang chạy.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+#define _GNU_SOURCE
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "host_mock.h"
+#include "can_reg.h"
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include <sys/mman.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define HOST_PERIPH_BASE    (0x40000000UL)  /* AIPS peripherals, GPIO ở 0x400FF000 */
+#define HOST_PPB_BASE       (0xE0000000UL)  /* NVIC, SCB, SysTick, DWT, MCM */
+#define HOST_WINDOW_SIZE    (0x00100000UL)
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE (0x100000)
+#endif
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static const uintptr_t s_windows[] = { HOST_PERIPH_BASE, HOST_PPB_BASE };
+static bool s_mapped = false;
+
+static CAN_Type *const s_modelCan[] = { CAN0, CAN1, CAN2 };
+static pthread_t s_modelThread;
+static volatile bool s_modelRun = false;
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/**
+ * @brief FlexCAN: FRZACK theo FRZ (freeze mode vào / ra ngay lập tức)
+ */
+static void HOST_ModelCan(CAN_Type *base)
+{
+    uint32_t mcr = __atomic_load_n(&base->MCR, __ATOMIC_RELAXED);
+    uint32_t want;
+
+    do {
+        want = (mcr & CAN_MCR_FRZ_MASK) ? (mcr | CAN_MCR_FRZACK_MASK) : (mcr & ~CAN_MCR_FRZACK_MASK);
+        if (want == mcr) {
+            return;
+        }
+    } while (!__atomic_compare_exchange_n(&base->MCR, &mcr, want, false,
+                                          __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
+
+static void *HOST_ModelThread(void *arg)
+{
+    (void)arg;
+
+    while (s_modelRun) {
+        for (uint32_t i = 0U; i < (sizeof(s_modelCan) / sizeof(s_modelCan[0])); i++) {
+            HOST_ModelCan(s_modelCan[i]);
+        }
+        /* Host một core: nhường CPU cho vòng poll của code đang cấu hình */
+        (void)sched_yield();
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+bool HOST_RegsInit(void)
+{
+    if (s_mapped) {
+        return true;
+    }
+
+    for (uint32_t i = 0U; i < (sizeof(s_windows) / sizeof(s_windows[0])); i++) {
+        void *p = mmap((void *)s_windows[i], HOST_WINDOW_SIZE, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+        if (p != (void *)s_windows[i]) {
+            /* Kernel cũ bỏ qua NOREPLACE và trả địa chỉ khác: không dùng được */
+            if (p != MAP_FAILED) {
+                (void)munmap(p, HOST_WINDOW_SIZE);
+            }
+            while (i-- > 0U) {
+                (void)munmap((void *)s_windows[i], HOST_WINDOW_SIZE);
+            }
+            return false;
+        }
+    }
+
+    s_mapped = true;
+    return true;
+}
+
+void HOST_RegsReset(void)
+{
+    if (!s_mapped) {
+        return;
+    }
+
+    for (uint32_t i = 0U; i < (sizeof(s_windows) / sizeof(s_windows[0])); i++) {
+        memset((void *)s_windows[i], 0, HOST_WINDOW_SIZE);
+    }
+}
+
+bool HOST_ModelStart(void)
+{
+    if (!s_mapped || s_modelRun) {
+        return s_mapped;
+    }
+
+    s_modelRun = true;
+    if (pthread_create(&s_modelThread, NULL, HOST_ModelThread, NULL) != 0) {
+        s_modelRun = false;
+        return false;
+    }
+
+    return true;
+}
+
+void HOST_ModelStop(void)
+{
+    if (!s_modelRun) {
+        return;
+    }
+
+    s_modelRun = false;
+    (void)pthread_join(s_modelThread, NULL);
+}
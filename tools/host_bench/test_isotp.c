@@ -0,0 +1,191 @@
+/**
+ * @file    test_isotp.c
+ * @brief   Host test: isotp_srv trên can_srv, link không ở CAN0
+ * @details
+ * Link dùng tx_frame = ISOTP_SRV_CanSrvTxFrame với config.instance = CAN1:
+ * - SF của ISOTP_SRV_Send() nằm trong TX MB của CAN1, TX MB của CAN0 không đổi
+ * - FF nhận trên CAN1 (CAN_SRV_IRQHandler + ISOTP_SRV_PollCanSrv), FC trả
+ *   lời cũng đi trên CAN1
+ * - Wrapper gọi thẳng ISOTP_SRV_CanSrvTxFrame() với instance CAN1 gửi trên CAN1
+ *
+ * Build và chạy bằng tools/host_bench.py --test, exit code = số check fail.
+ *
+ * @author  PhucPH32
+ * @date    14/10/2026
+ * @version 1.0
+ */
+
+/*******************************************************************************
+ * Includes
+ ******************************************************************************/
+#include "host_mock.h"
+#include "isotp_srv.h"
+#include "time_srv.h"
+#include <stdio.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define TEST_TX_ID              (0x7E8U)
+#define TEST_RX_ID              (0x7E0U)
+
+#define TEST_CS_CODE_MASK       (0x0F000000UL)
+#define TEST_CS_CODE_TX_DATA    (0x0C000000UL)
+#define TEST_CS_INACTIVE        (0x08000000UL)
+#define TEST_CS_RX_FULL         (0x02000000UL | (8UL << 16))    /* CODE = FULL, DLC 8 */
+
+#define TEST_CHECK(cond)        TEST_Check((cond), #cond, __LINE__)
+
+/*******************************************************************************
+ * Private Variables
+ ******************************************************************************/
+static uint32_t s_failures = 0U;
+static uint32_t s_timeUs = 0U;
+static uint8_t s_rxBuf[64];
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+static void TEST_Check(bool cond, const char *expr, int line)
+{
+    if (!cond) {
+        printf("FAIL,%d,%s\n", line, expr);
+        s_failures++;
+    }
+}
+
+static volatile uint32_t *TEST_TxMb(CAN_Type *base)
+{
+    return &base->RAMn[CAN_SRV_TX_MB_FIRST * 4U];
+}
+
+static void TEST_TxComplete(CAN_Type *base)
+{
+    for (uint32_t m = CAN_SRV_TX_MB_FIRST; m < (CAN_SRV_TX_MB_FIRST + CAN_SRV_TX_MB_COUNT); m++) {
+        base->RAMn[m * 4U] = TEST_CS_INACTIVE;
+    }
+}
+
+static bool TEST_CanSrvInit(void)
+{
+    const can_srv_config_t config = {
+        .baudrate = 500000U,
+        .filter_id = TEST_RX_ID,
+        .filter_mask = 0x7FFU,
+        .filter_extended = false
+    };
+    bool ok;
+
+    /* Freeze handshake của CAN_SRV_Init() cần register model */
+    HOST_RegsReset();
+    if (!HOST_ModelStart()) {
+        return false;
+    }
+    ok = (CAN_SRV_Init(CAN_SRV_CAN0, &config) == CAN_SRV_SUCCESS) &&
+         (CAN_SRV_Init(CAN_SRV_CAN1, &config) == CAN_SRV_SUCCESS);
+    HOST_ModelStop();
+
+    TEST_TxComplete(CAN0);
+    TEST_TxComplete(CAN1);
+    return ok;
+}
+
+static void TEST_SingleFrameOnCan1(isotp_srv_link_t *link)
+{
+    static const uint8_t payload[] = { 0x3EU, 0x00U };
+    volatile uint32_t *mb1 = TEST_TxMb(CAN1);
+
+    TEST_CHECK(ISOTP_SRV_Send(link, payload, sizeof(payload)) == ISOTP_SRV_SUCCESS);
+
+    TEST_CHECK((mb1[0] & TEST_CS_CODE_MASK) == TEST_CS_CODE_TX_DATA);
+    TEST_CHECK(((mb1[1] >> 18) & 0x7FFU) == TEST_TX_ID);
+    TEST_CHECK((mb1[2] >> 24) == 0x02U);                        /* SF, length 2 */
+    TEST_CHECK(TEST_TxMb(CAN0)[0] == TEST_CS_INACTIVE);
+
+    TEST_TxComplete(CAN1);
+}
+
+static void TEST_FlowControlOnCan1(isotp_srv_link_t *link)
+{
+    isotp_srv_link_t *const links[] = { link };
+    volatile uint32_t *rx = &CAN1->RAMn[CAN_SRV_RX_MB * 4U];
+    volatile uint32_t *mb1 = TEST_TxMb(CAN1);
+
+    /* FF length 20 trên CAN1 */
+    rx[0] = TEST_CS_RX_FULL;
+    rx[1] = (TEST_RX_ID << 18);
+    rx[2] = 0x10140102UL;
+    rx[3] = 0x03040506UL;
+    CAN1->IFLAG1 = (1UL << CAN_SRV_RX_MB);
+
+    CAN_SRV_IRQHandler(CAN_SRV_CAN1);
+    TEST_CHECK(ISOTP_SRV_PollCanSrv(CAN_SRV_CAN1, links, 1U, NULL) == 1U);
+    ISOTP_SRV_Process(link);
+
+    TEST_CHECK((mb1[0] & TEST_CS_CODE_MASK) == TEST_CS_CODE_TX_DATA);
+    TEST_CHECK(((mb1[1] >> 18) & 0x7FFU) == TEST_TX_ID);
+    TEST_CHECK((mb1[2] >> 28) == 0x3U);                         /* FC */
+    TEST_CHECK(TEST_TxMb(CAN0)[0] == TEST_CS_INACTIVE);
+    TEST_CHECK(link->rx_length == 20U);
+
+    TEST_TxComplete(CAN1);
+}
+
+static void TEST_DirectHookOnCan1(void)
+{
+    static const uint8_t frame[8] = { 0x02U, 0x3EU, 0x80U, 0xCCU, 0xCCU, 0xCCU, 0xCCU, 0xCCU };
+    volatile uint32_t *mb1 = TEST_TxMb(CAN1);
+
+    TEST_CHECK(ISOTP_SRV_CanSrvTxFrame((uint8_t)CAN_SRV_CAN1, TEST_TX_ID, false, frame, NULL));
+
+    TEST_CHECK((mb1[0] & TEST_CS_CODE_MASK) == TEST_CS_CODE_TX_DATA);
+    TEST_CHECK((mb1[2] >> 16) == 0x023EU);
+    TEST_CHECK(TEST_TxMb(CAN0)[0] == TEST_CS_INACTIVE);
+
+    TEST_TxComplete(CAN1);
+}
+
+/*******************************************************************************
+ * Public Functions
+ ******************************************************************************/
+
+/* isotp_srv timing: đồng hồ giả, tăng mỗi lần đọc */
+uint32_t TIME_SRV_GetMicros32(void)
+{
+    return s_timeUs++;
+}
+
+int main(void)
+{
+    const isotp_srv_config_t config = {
+        .tx_id = TEST_TX_ID,
+        .rx_id = TEST_RX_ID,
+        .id_type = CAN_ID_STD,
+        .instance = (uint8_t)CAN_SRV_CAN1,
+        .block_size = 0U,
+        .st_min = 0U,
+        .padding = ISOTP_SRV_PADDING_BYTE,
+        .tx_frame = ISOTP_SRV_CanSrvTxFrame
+    };
+    static isotp_srv_link_t link;
+
+    if (!HOST_RegsInit()) {
+        printf("# register windows not mapped, test skipped\n");
+        return 0;
+    }
+    if (!TEST_CanSrvInit()) {
+        printf("FAIL,%d,can_srv init\n", __LINE__);
+        return 1;
+    }
+
+    TEST_CHECK(ISOTP_SRV_Init(&link, &config) == ISOTP_SRV_SUCCESS);
+    ISOTP_SRV_SetRxBuffer(&link, s_rxBuf, sizeof(s_rxBuf));
+
+    TEST_SingleFrameOnCan1(&link);
+    TEST_FlowControlOnCan1(&link);
+    TEST_DirectHookOnCan1();
+
+    printf("TEST_END,isotp_can_srv,%u\n", s_failures);
+    return (int)s_failures;
+}
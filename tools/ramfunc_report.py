@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+"""
+List the code that runs from SRAM, read from a GNU ld map file (-Wl,-Map=app.map).
+
+Reports every .code_ram input section (HAL_RAMFUNC functions) and any other
+code section the linker script placed in SRAM_L / SRAM_U, with the symbols
+it holds, their address and size.
+
+Usage:
+    python3 tools/ramfunc_report.py build/app.map
+    python3 tools/ramfunc_report.py -a build/app.map      # detail .code_ram left in flash
+"""
+
+import argparse
+import re
+import sys
+
+REGIONS = (
+    ('SRAM_L', 0x1FFF8000, 0x20000000),
+    ('SRAM_U', 0x20000000, 0x20007000),
+)
+
+# " .code_ram      0x1fff8400       0x58 ./lib/hal/dma/dma.o" (name may wrap)
+SECTION_RE = re.compile(r'^ (\.\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$')
+SECTION_NAME_RE = re.compile(r'^ (\.\S+)$')
+SECTION_TAIL_RE = re.compile(r'^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$')
+SYMBOL_RE = re.compile(r'^\s+0x([0-9a-fA-F]+)\s+([A-Za-z_]\w*)\s*$')
+
+
+def region_of(addr):
+    for name, lo, hi in REGIONS:
+        if lo <= addr < hi:
+            return name
+    return None
+
+
+def is_code(name):
+    return name == '.code_ram' or name.startswith('.code_ram.') or \
+        name == '.text' or name.startswith('.text.')
+
+
+def parse(path):
+    """Return [(section, addr, size, object, [(symbol, addr)])] of code input sections."""
+    sections = []
+    current = None
+    pending = None
+    in_map = False
+
+    with open(path, encoding='utf-8', errors='replace') as f:
+        for line in f:
+            line = line.rstrip('\n')
+            if line.startswith('Linker script and memory map'):
+                in_map = True
+                continue
+            if not in_map:
+                continue
+
+            if pending is not None:
+                m = SECTION_TAIL_RE.match(line)
+                pending_name, pending = pending, None
+                if m:
+                    current = [pending_name, int(m.group(1), 16), int(m.group(2), 16), m.group(3), []]
+                    sections.append(current)
+                    continue
+
+            m = SECTION_RE.match(line)
+            if m:
+                current = [m.group(1), int(m.group(2), 16), int(m.group(3), 16), m.group(4), []]
+                sections.append(current)
+                continue
+
+            m = SECTION_NAME_RE.match(line)
+            if m:
+                pending = m.group(1)
+                current = None
+                continue
+
+            m = SYMBOL_RE.match(line)
+            if m and current is not None and '=' not in line:
+                current[4].append((m.group(2), int(m.group(1), 16)))
+                continue
+
+            if line and not line[0].isspace():
+                current = None
+
+    return [s for s in sections if is_code(s[0]) and s[2] > 0]
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument('map', help='GNU ld map file')
+    ap.add_argument('-a', '--all', action='store_true', help='list .code_ram sections linked into flash')
+    opts = ap.parse_args()
+
+    sections = parse(opts.map)
+    ram = [s for s in sections if region_of(s[1])]
+    misplaced = [s for s in sections if s[0].startswith('.code_ram') and not region_of(s[1])]
+
+    total = 0
+    print('%-10s %-8s %6s  %-32s %s' % ('address', 'region', 'size', 'symbol', 'object'))
+    for name, addr, size, obj, symbols in sorted(ram, key=lambda s: s[1]):
+        region = region_of(addr)
+        total += size
+        end = addr + size
+        if not symbols:
+            print('0x%08x %-8s %6u  %-32s %s' % (addr, region, size, '(' + name + ')', obj))
+        symbols = sorted(symbols, key=lambda s: s[1])
+        for i, (sym, sym_addr) in enumerate(symbols):
+            sym_end = symbols[i + 1][1] if i + 1 < len(symbols) else end
+            print('0x%08x %-8s %6u  %-32s %s' % (sym_addr, region, sym_end - sym_addr, sym, obj))
+    print('%u byte(s) of code in SRAM' % total)
+
+    if misplaced:
+        # Linker script without a .code_ram rule: functions stayed in flash
+        print('warning: %d .code_ram section(s) linked into flash' % len(misplaced), file=sys.stderr)
+        if opts.all:
+            for name, addr, size, obj, _ in misplaced:
+                print('  0x%08x %6u  %s' % (addr, size, obj), file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
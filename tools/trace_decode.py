@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+"""
+Decode binary trace records produced by lib/service/src/trace_srv.c.
+
+ID -> format map is read from C headers, one entry per line:
+    #define TRC_CAN_TX   (0x0101U)   // TRACE: "CAN tx id=0x%x dlc=%u"
+
+Usage:
+    python3 tools/trace_decode.py -m app/trace_ids.h capture.bin
+    python3 tools/trace_decode.py -m app/trace_ids.h -p /dev/ttyUSB0 -b 2000000
+    python3 tools/trace_decode.py -m app/trace_ids.h -c 80000000 capture.bin
+    python3 tools/trace_decode.py -m app/trace_ids.h -t localhost:9091
+
+--tcp reads an RTT up channel (TRACE_SRV_InitRtt) from the debugger's RTT
+server, e.g. OpenOCD "rtt server start 9091 1" or the J-Link RTT telnet port.
+"""
+
+import argparse
+import re
+import socket
+import struct
+import sys
+
+SYNC = 0xA
+MAX_ARGS = 4
+DEFINE_RE = re.compile(r'#define\s+(\w+)\s+\(?\s*(0x[0-9A-Fa-f]+|\d+)[uU]?\s*\)?.*TRACE:\s*"(.*)"')
+
+
+def load_map(paths):
+    formats = {}
+    for path in paths:
+        with open(path, encoding='utf-8', errors='replace') as f:
+            for line in f:
+                m = DEFINE_RE.search(line)
+                if m:
+                    formats[int(m.group(2), 0)] = (m.group(1), m.group(3))
+    return formats
+
+
+def records(stream):
+    """Yield (seq, id, timestamp, args), resyncing on the 0xA nibble."""
+    buf = b''
+    while True:
+        chunk = stream.read(4096)
+        if not chunk:
+            return
+        buf += chunk
+        pos = 0
+        while len(buf) - pos >= 8:
+            (hdr,) = struct.unpack_from('<I', buf, pos)
+            nargs = (hdr >> 24) & 0xF
+            if (hdr >> 28) != SYNC or nargs > MAX_ARGS:
+                pos += 1                    # lost alignment, slide one byte
+                continue
+            size = 8 + 4 * nargs
+            if len(buf) - pos < size:
+                break
+            ts = struct.unpack_from('<I', buf, pos + 4)[0]
+            args = struct.unpack_from('<%dI' % nargs, buf, pos + 8)
+            yield (hdr >> 16) & 0xFF, hdr & 0xFFFF, ts, args
+            pos += size
+        buf = buf[pos:]
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument('input', nargs='?', help='capture file (default: stdin)')
+    ap.add_argument('-m', '--map', action='append', default=[], help='C header with TRACE: formats')
+    ap.add_argument('-p', '--port', help='read from serial port (needs pyserial)')
+    ap.add_argument('-b', '--baud', type=int, default=2000000)
+    ap.add_argument('-t', '--tcp', metavar='HOST:PORT', help='read from an RTT TCP server')
+    ap.add_argument('-c', '--clock', type=float, default=0.0,
+                    help='timestamp clock in Hz (e.g. core clock for DWT) to print seconds')
+    opts = ap.parse_args()
+
+    formats = load_map(opts.map)
+
+    if opts.tcp:
+        host, _, port = opts.tcp.rpartition(':')
+        sock = socket.create_connection((host or 'localhost', int(port)))
+        stream = sock.makefile('rb', buffering=0)     # raw: read() returns what has arrived
+    elif opts.port:
+        import serial
+        stream = serial.Serial(opts.port, opts.baud)
+    elif opts.input:
+        stream = open(opts.input, 'rb')
+    else:
+        stream = sys.stdin.buffer
+
+    last_seq = None
+    for seq, trace_id, ts, args in records(stream):
+        if last_seq is not None and seq != ((last_seq + 1) & 0xFF):
+            print('--- %d record(s) lost ---' % ((seq - last_seq - 1) & 0xFF))
+        last_seq = seq
+
+        stamp = '%12.6f' % (ts / opts.clock) if opts.clock else '%10u' % ts
+        name, fmt = formats.get(trace_id, ('0x%04X' % trace_id, ' '.join(['%x'] * len(args))))
+        try:
+            text = fmt % args
+        except (TypeError, ValueError):
+            text = fmt + ' ' + ' '.join('0x%08X' % a for a in args)
+        print('%s  %-20s %s' % (stamp, name, text))
+
+
+if __name__ == '__main__':
+    main()